@@ -0,0 +1,107 @@
+# ----------------------------------------------------------
+# --- Generate translation key IDs from the reference catalogue
+# ----------------------------------------------------------
+# Usage:
+#   cmake -DINPUT=<en_US.json> -DOUTPUT=<TranslationKeys.h> -P GenerateTranslationKeys.cmake
+#
+# Flattens the nested JSON the same way i18n::parseJsonContent() does
+# ("MENU": {"FILE_NEW": ...} becomes "MENU.FILE_NEW") and emits one
+# i18n::Key enumerator per key, with dots turned into underscores, plus
+# the table of key names in the same order. The header is only rewritten
+# when its content changes, so editing a translation text does not rebuild
+# every file that includes i18n.h.
+cmake_minimum_required(VERSION 3.19)
+
+if (NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "GenerateTranslationKeys: INPUT and OUTPUT must be defined")
+endif ()
+
+function(ads_collect_translation_keys json prefix)
+    string(JSON count LENGTH "${json}")
+    if (count GREATER 0)
+        math(EXPR last "${count} - 1")
+        foreach (index RANGE ${last})
+            string(JSON member MEMBER "${json}" ${index})
+            string(JSON type TYPE "${json}" "${member}")
+            if (type STREQUAL "OBJECT")
+                string(JSON child GET "${json}" "${member}")
+                ads_collect_translation_keys("${child}" "${prefix}${member}.")
+            else ()
+                list(APPEND TRANSLATION_KEYS "${prefix}${member}")
+            endif ()
+        endforeach ()
+    endif ()
+    set(TRANSLATION_KEYS "${TRANSLATION_KEYS}" PARENT_SCOPE)
+endfunction()
+
+file(READ "${INPUT}" catalogue)
+set(TRANSLATION_KEYS "")
+ads_collect_translation_keys("${catalogue}" "")
+
+list(LENGTH TRANSLATION_KEYS key_count)
+if (key_count EQUAL 0)
+    message(FATAL_ERROR "GenerateTranslationKeys: no keys found in ${INPUT}")
+endif ()
+
+set(enumerators "")
+set(names "")
+set(seen "")
+foreach (key IN LISTS TRANSLATION_KEYS)
+    string(REPLACE "." "_" identifier "${key}")
+    if (NOT identifier MATCHES "^[A-Za-z_][A-Za-z0-9_]*$")
+        message(FATAL_ERROR "GenerateTranslationKeys: '${key}' is not a valid identifier")
+    endif ()
+    if (identifier IN_LIST seen)
+        message(FATAL_ERROR "GenerateTranslationKeys: '${key}' collides with another key as ${identifier}")
+    endif ()
+    list(APPEND seen "${identifier}")
+    string(APPEND enumerators "        ${identifier},\n")
+    string(APPEND names "        \"${key}\",\n")
+endforeach ()
+
+get_filename_component(input_name "${INPUT}" NAME)
+file(WRITE "${OUTPUT}.tmp" "/*
+ * Adventure Designer Studio
+ * Generated from ${input_name} by cmake/GenerateTranslationKeys.cmake.
+ * Do not edit: add keys to the reference catalogue instead.
+ */
+#ifndef ADS_TRANSLATION_KEYS_H
+#define ADS_TRANSLATION_KEYS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ADS::i18n {
+    /**
+     * @brief Compile-time ID of every key of the reference catalogue
+     */
+    enum class Key : uint16_t {
+${enumerators}    };
+
+    /**
+     * Number of keys in the reference catalogue
+     */
+    inline constexpr size_t KEY_COUNT = ${key_count};
+
+    /**
+     * Translation key of each Key, indexed by its value
+     */
+    inline constexpr std::array<std::string_view, KEY_COUNT> KEY_NAMES = {
+${names}    };
+
+    /**
+     * @brief Get the translation key a Key stands for
+     */
+    [[nodiscard]] constexpr std::string_view keyName(const Key key)
+    {
+        return KEY_NAMES[static_cast<size_t>(key)];
+    }
+}
+
+#endif //ADS_TRANSLATION_KEYS_H
+")
+
+configure_file("${OUTPUT}.tmp" "${OUTPUT}" COPYONLY)
+file(REMOVE "${OUTPUT}.tmp")
@@ -24,6 +24,7 @@
 #include "src/classes/env/env.h"
 #include "i18nUtils.h"
 #include "app.h"
+#include "Logger/logger.h"
 #include "UI/Window.h"
 #include "imgui/window_intialization_exception.h"
 
@@ -39,6 +40,9 @@
 #include "imgui_impl_sdlrenderer2.h"
 #include "languages.h"
 #include "spdlog/spdlog.h"
+#include "Core/FrameBenchmark.h"
+#include "Core/JobSystem.h"
+#include "Core/StartupTimer.h"
 
 #if !SDL_VERSION_ATLEAST(2, 0, 17)
 #error This backend requires SDL 2.0.17+ because of SDL_RenderGeometry() function
@@ -51,81 +55,157 @@ using namespace ADS::Constants; // ADS::Constants::System::SystemConst;
  * @brief Application entry point
  *
  * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
- * @version Jan 2026
+ * @version Oct 2026
  *
  * Initializes the Adventure Designer Studio application by setting up SDL,
  * creating the main window, loading fonts (including FontAwesome icons),
  * configuring ImGui backends, and running the main application loop.
  *
  * The function performs the following initialization steps:
- * 1. Creates the App instance and retrieves translation manager
- * 2. Creates main window with configured dimensions and position
- * 3. Loads default fonts and custom fonts from environment configuration
- * 4. Loads FontAwesome icon font for UI elements
- * 5. Sets up ImGui backends for SDL2 and SDL renderer
- * 6. Runs the application main loop
+ * 1. Creates the App instance, which starts loading the translations and
+ *    the STARTUP_PROJECT on the worker pool
+ * 2. Creates main window with configured dimensions and position meanwhile
+ * 3. Waits for the translations and creates the IDE (App::completeStartup())
+ * 4. Loads default fonts, custom fonts from environment configuration and
+ *    the FontAwesome icon font, and builds the font atlas, restoring it
+ *    from the disk cache when the fonts have not changed; on the pool
+ * 5. Sets up the ImGui backends of the renderer chosen by RENDERER in .env
+ *    while the fonts are built, then waits for them
+ * 6. Runs the application main loop, or the frame benchmark
  * 7. Performs cleanup and shutdown
  *
+ * Each step is timed by ADS::Core::StartupTimer; the timings and the time
+ * to the first frame are logged once that frame is presented.
+ *
+ * With `--benchmark <frames>`, and the other options of
+ * ADS::Core::FrameBenchmark, no window is shown: SDL's dummy video driver
+ * and software renderer stand in for the display and the GPU, whatever
+ * RENDERER says, and a fixed number of frames is drawn and measured
+ * instead of running the loop. `--replay <file>` does the same with the
+ * frames of an input log, and `--window 1` keeps the window and renderer.
+ *
+ * @param argc Number of command line arguments
+ * @param argv Command line arguments
+ *
  * @return 0 on successful execution
  *
  * @note This function handles all application lifecycle from initialization to shutdown
  * @see ADS::Core::App
  */
-int main()
+int main(int argc, char *argv[])
 {
     try {
+        const optional<ADS::Core::FrameBenchmark::Options> benchmark = ADS::Core::FrameBenchmark::parseArguments(argc, argv);
+        const bool headless = benchmark && !benchmark->window;
+        if (headless) {
+            // Must be set before SDL_Init(), which the App constructor calls
+            SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+            SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+        }
+
         SDL_SetMainReady();  // Required when using SDL_MAIN_HANDLED
         auto *app = new ADS::Core::App();
 
-        // Create window
-        auto *sdlWindowInformation = new ADS::UI::SDL_WINDOW_INFO({
-                app->getTranslationsManager()->_t("APP_TITLE"),
-                SDL_WINDOWPOS_CENTERED,
-                SDL_WINDOWPOS_CENTERED,
-                System::DEFAULT_X_WIN_SIZE,
-                System::DEFAULT_Y_WIN_SIZE,
-        });
-
-        auto *flags = new ADS::UI::SDL_FLAGS();
+        // Create window; the translations are still loading, completeStartup() sets the translated title
         ADS::UI::ImGuiManager &imguiObject = app->getImGuiObject();
-        pair<boost::uuids::uuid, ADS::UI::Window *> windowInfo = imguiObject.newWindow(sdlWindowInformation, flags);
-        ADS::UI::Window *mainWindow = windowInfo.second;
-        app->setMainWindow(mainWindow);
+        ADS::UI::Window *mainWindow = nullptr;
+        {
+            ADS::Core::StartupTimer::Phase phase("Window");
+            auto *sdlWindowInformation = new ADS::UI::SDL_WINDOW_INFO({
+                    System::APPLICATION_NAME,
+                    SDL_WINDOWPOS_CENTERED,
+                    SDL_WINDOWPOS_CENTERED,
+                    System::DEFAULT_X_WIN_SIZE,
+                    System::DEFAULT_Y_WIN_SIZE,
+            });
+
+            auto *flags = new ADS::UI::SDL_FLAGS();
+            if (headless) {
+                flags->rendererFlags = SDL_RENDERER_SOFTWARE;
+            } else {
+                flags->renderer = ADS::UI::parseRendererKind(app->getEnv()->getConfig().renderer);
+            }
+            pair<boost::uuids::uuid, ADS::UI::Window *> windowInfo = imguiObject.newWindow(sdlWindowInformation, flags);
+            mainWindow = windowInfo.second;
+            app->setMainWindow(mainWindow);
+        }
+        ADS::UI::RenderBackend &backend = mainWindow->getBackend();
+        spdlog::info("Renderer: {}", backend.getName());
+
+        app->completeStartup();
 
         // Load fonts
-        ADS::Environment *env = app->getEnv();
+        const ADS::Config& config = app->getEnv()->getConfig();
         ADS::UI::Fonts *fm = imguiObject.getFontManager();
 
         // Set the font manager as static member in App for global access
         ADS::Core::App::setFontManager(fm);
 
-        fm->loadDefaultFonts();
-        fm->loadFontFromFile("lightFont", env->get("LIGHT_FONT")->data());
-        fm->loadFontFromFile("mediumFont", env->get("MEDIUM_FONT")->data());
-        fm->loadFontFromFile("regularFont", env->get("REGULAR_FONT")->data());
-        // Load icons AFTER other fonts so they merge with the regular font (which becomes default)
-        fm->loadIconFont("public/fonts/FontAwesome/fontawesome-webfont.ttf", 13.0f);
+        // Bake the characters of the current locale into the first atlas
+        app->getTranslationsManager()->update();
+        app->addLocaleGlyphs();
+
+        // Rasterise the fonts once; later starts restore the atlas from the disk cache
+        // Glyphs are rasterised for the pixels they cover: the DPI scale ImGui draws them at, times the Retina ratio
+        const float dpiScale = mainWindow->getMainScale() * mainWindow->getPixelRatio();
+        auto loadFonts = [fm, &config, dpiScale]()
+        {
+            ADS::Core::StartupTimer::Phase phase("Fonts");
+            fm->loadDefaultFonts();
+            fm->loadFontFromFile("lightFont", config.lightFont);
+            fm->loadFontFromFile("mediumFont", config.mediumFont);
+            fm->loadFontFromFile("regularFont", config.regularFont);
+            // Load icons AFTER other fonts so they merge with the regular font (which becomes default)
+            fm->loadIconFont("public/fonts/FontAwesome/fontawesome-webfont.ttf", 13.0f);
+            fm->buildAtlas(System::FONT_CACHE_DIR, dpiScale);
+        };
+
+        // The fonts only touch the atlas, which nothing reads before the first frame,
+        // so they are built on the pool while the backends are set up here
+        ADS::Core::JobSystem *jobs = ADS::Core::App::getJobSystem();
+        const ADS::Core::JobSystem::JobHandle fonts = jobs->submit(loadFonts, ADS::Core::JobSystem::Priority::High);
 
         // Setup backends
-        ImGui_ImplSDL2_InitForSDLRenderer(mainWindow->getWindow(), mainWindow->getRenderer());
-        ImGui_ImplSDLRenderer2_Init(mainWindow->getRenderer());
-        mainWindow->setStyle();
+        {
+            ADS::Core::StartupTimer::Phase phase("Backends");
+            backend.init();
+            mainWindow->setStyle();
+        }
+
+        {
+            ADS::Core::StartupTimer::Phase phase("Waiting for fonts");
+            jobs->wait(fonts);
+        }
+        if (fonts.getState() == ADS::Core::JobSystem::State::Failed) {
+            throw runtime_error("Cannot load the fonts: " + fonts.getError());
+        }
+        if (fonts.getState() != ADS::Core::JobSystem::State::Completed) {
+            loadFonts();
+        }
 
         // Run the application
-        app->run();
+        int exitCode = 0;
+        if (benchmark) {
+            exitCode = app->runBenchmark(*benchmark);
+        } else {
+            app->run();
+        }
 
         // Cleanup
         app->shutdown();
         delete app;
 
-        return 0;
+        ADS::Core::Logger::shutdown();
+        return exitCode;
     } catch (const std::exception& e) {
         spdlog::error("Fatal error: {}", e.what());
         SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, "Fatal Error", e.what(), nullptr);
+        ADS::Core::Logger::shutdown();
         return 1;
     } catch (...) {
         spdlog::error("Unknown fatal error occurred");
         SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, "Fatal Error", "Unknown error occurred", nullptr);
+        ADS::Core::Logger::shutdown();
         return 1;
     }
 }
@@ -14,20 +14,86 @@
 #include "app.h"
 
 #include <SDL.h>
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <random>
 #include "adsString.h"
 #include "i18nUtils.h"
 #include "Logger/logger.h"
 #include "imgui.h"
 #include "imgui_impl_sdl2.h"
-#include "imgui_impl_sdlrenderer2.h"
 #include "System.h"
+#include "Core/AllocationCounter.h"
+#include "Core/Profiling.h"
+#include "Core/ProjectStorage.h"
+#include "Core/StartupTimer.h"
+#include "Core/TextBuffer.h"
 
 namespace ADS::Core {
 
+    namespace {
+        /**
+         * @brief Check whether a replay needs an event type; the others are not recorded
+         */
+        bool isReplayedEvent(const Uint32 type)
+        {
+            switch (type) {
+                case SDL_QUIT:
+                case SDL_WINDOWEVENT:
+                case SDL_KEYDOWN:
+                case SDL_KEYUP:
+                case SDL_TEXTEDITING:
+                case SDL_TEXTINPUT:
+                case SDL_MOUSEMOTION:
+                case SDL_MOUSEBUTTONDOWN:
+                case SDL_MOUSEBUTTONUP:
+                case SDL_MOUSEWHEEL:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        /**
+         * @brief Check whether a window event may come with a new display DPI
+         *
+         * Moving to another monitor is reported as a display change from
+         * SDL 2.0.18, as a move before; a new OS scale resizes the window.
+         */
+        bool isDisplayChange(const Uint8 windowEvent)
+        {
+            switch (windowEvent) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+                case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+#else
+                case SDL_WINDOWEVENT_MOVED:
+#endif
+                case SDL_WINDOWEVENT_SIZE_CHANGED:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        /**
+         * Bytes of an event before what is recorded: its type and timestamp
+         */
+        constexpr size_t RECORDED_EVENT_OFFSET = sizeof(SDL_CommonEvent);
+    }
+
     // Define static member variables
     Environment* App::m_environment = nullptr;
     i18n::i18n* App::m_translationsManager = nullptr;
     UI::Fonts* App::m_fontManager = nullptr;
+    UI::AssetManager* App::m_assetManager = nullptr;
+    UI::RenderBackend* App::m_renderBackend = nullptr;
+    JobSystem* App::m_jobSystem = nullptr;
+    std::atomic<Uint32> App::m_wakeEvent{0};
+    std::atomic<int> App::m_continuousRequests{0};
+    UI::ImGuiManager* App::m_imguiManager = nullptr;
 
     /**
      * @brief Initialize all internal App structures and systems
@@ -52,33 +118,97 @@ namespace ADS::Core {
      */
     void App::init()
     {
-        Environment *e = App::getEnv();
-        i18n::i18n* tm = App::getTranslationsManager();
-        this->setDebugMode(stringToBool(e->getOrDefault("DEBUG", "false")));
+        const std::shared_ptr<const Config> settings = App::getEnv()->getConfig();
+        const Config& config = *settings;
+        this->setDebugMode(config.debug);
+
+        // Log calls only queue their message; LOG_OVERFLOW decides what happens when the queue is full
+        {
+            StartupTimer::Phase phase("Logger");
+            Logger::init(this->isDebug(),
+                         parseLogOverflowPolicy(config.logOverflow),
+                         config.logQueueSize);
+            Logger::setLevels(config.logLevels);
+        }
+        // Binary event trace of the frame phases, saving, loading and dispatch; F12 writes it.
+        // Switched on first, so the startup phases are in it
+        this->m_traceFile = config.traceFile;
+        TraceRecorder::setThreadName("Main thread");
+        TraceRecorder::setEnabled(!this->m_traceFile.empty());
 
-        if (this->isDebug()) {
-            tm->setLocale(ADS::Constants::Languages::ENGLISH_UNITED_STATES.data());
+        {
+            StartupTimer::Phase phase("JobSystem");
+            // 0 lets the pool size itself to the machine
+            m_jobSystem = new JobSystem(config.jobWorkers);
+            m_jobSystem->setMainThreadWakeup(&App::requestRedraw);
         }
 
-        Logger::init(this->isDebug());
-        // Note: we can use format to notify the line and file.
-        // spdlog::info(format("{}:{} - Retrieve the languages from .env file", __FILE__, __LINE__));
-        spdlog::info("Retrieve the languages from .env file");
-        const std::string *languagesAllowedFromEnv = e->get("LANGUAGES");
-        spdlog::info("Load the available languages");
+        // Parsing the catalogues needs none of SDL, the window or the renderer set up here
+        // meanwhile; completeStartup() waits for them before anything translates
+        m_translationsManager = nullptr;
+        this->m_translationsJob = m_jobSystem->submit([debug = this->isDebug(), languages = config.languages,
+                                                       lazy = config.lazyLanguages,
+                                                       watch = config.watchTranslations]() {
+            StartupTimer::Phase phase("Translations");
+            auto *translations = new i18n::i18n(
+                "public/translations/core",
+                std::string(ADS::Constants::Languages::ENGLISH_UNITED_STATES)
+            );
+            if (debug) {
+                translations->setLocale(ADS::Constants::Languages::ENGLISH_UNITED_STATES.data());
+            }
+            spdlog::info("Load the available languages");
+            if (lazy) {
+                // Only the current locale and the fallback are parsed now
+                translations->setLoadMode(i18n::LoadMode::Lazy);
+            }
+            translations->addLanguages(languages);
+            if (watch) {
+                // Edited translation files are swapped in by update()
+                translations->watchTranslations();
+            }
+            m_translationsManager = translations;
+        }, JobSystem::Priority::High);
 
-        for (const std::vector<std::string> languages = explode(*languagesAllowedFromEnv, ',');
-             const string &language: languages) {
-            tm->addLanguage(std::string(language));
+        // The startup project is read alongside, and shown whenever it is ready
+        if (!config.startupProject.empty()) {
+            this->m_preloadedProject = std::make_shared<std::unique_ptr<Project>>();
+            this->m_preloadJob = m_jobSystem->submit([project = this->m_preloadedProject,
+                                                      path = config.startupProject]() {
+                StartupTimer::Phase phase("Project preload");
+                try {
+                    *project = ProjectStorage::load(path);
+                } catch (const std::exception& e) {
+                    ADS_LOG_ERROR(Project, "App: cannot open the startup project {} — {}", path, e.what());
+                }
+            });
         }
-        spdlog::info("Initializing the ImGui Library Manager");
-        this->m_imguiObject = UI::ImGuiManager();
 
-        // Initialize IDE renderer
-        spdlog::info("Creating IDE Renderer...");
-        this->m_ideRenderer = new IDE::IDERenderer();
+        // Wait for input between frames instead of redrawing an unchanged UI
+        this->m_idleRendering = config.idleRendering;
+        this->m_framesToRender = ADS::Constants::System::IDLE_SETTLE_FRAMES;
+        this->m_headless = false;
+        this->m_replaying = false;
+        this->m_replayDeltaTime = 0.0f;
+        // Settings edited while the editor runs are applied by update(), without a restart
+        App::getEnv()->subscribe([this](const std::vector<std::string>& keys, const Config& changed) {
+            this->applySettings(keys, changed);
+        });
+        if (config.watchEnvironment) {
+            App::getEnv()->setChangeWakeup(&App::requestRedraw);
+            App::getEnv()->watch();
+        }
+        this->m_glyphsGeneration = 0;
+        this->m_pendingFontScale = 0.0f;
+        {
+            StartupTimer::Phase phase("ImGui");
+            spdlog::info("Initializing the ImGui Library Manager");
+            this->m_imguiObject = UI::ImGuiManager();
+            m_imguiManager = &this->m_imguiObject;
+        }
 
-        // Initialize application state
+        // Initialize application state; the IDE renderer is created by completeStartup()
+        this->m_ideRenderer = nullptr;
         this->m_running = false;
         this->m_mainWindow = nullptr;
         this->m_renderer = nullptr;
@@ -88,34 +218,77 @@ namespace ADS::Core {
      * @brief Construct App instance and initialize environment
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Nov 2025
+     * @version Oct 2026
      *
      * Creates a new App instance and allocates an Environment object
-     * to manage application configuration from .env files and initializes
-     * the translation system.
+     * to manage application configuration from .env files, then starts
+     * the logger, the worker pool and, on the pool, the translation
+     * system. Each step is timed by StartupTimer.
      */
     App::App()
     {
-        m_translationsManager = new i18n::i18n(
-            "public/translations/core",
-            std::string(ADS::Constants::Languages::ENGLISH_UNITED_STATES)
-        );
-        m_environment = new Environment();
+        {
+            StartupTimer::Phase phase("Environment");
+            m_environment = new Environment();
+        }
         this->init();
     }
 
+    /**
+     * @brief Finish the startup once the main window exists
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The window was created under the application name, as the title
+     * needs the translations; it gets the translated one here.
+     */
+    void App::completeStartup()
+    {
+        {
+            StartupTimer::Phase phase("Waiting for translations");
+            m_jobSystem->wait(this->m_translationsJob);
+        }
+        if (this->m_translationsJob.getState() != JobSystem::State::Completed) {
+            throw std::runtime_error(std::format("Cannot load the translations: {}", this->m_translationsJob.getError()));
+        }
+        m_translationsManager->takeOwnership();
+        if (this->m_mainWindow != nullptr) {
+            const std::string title(m_translationsManager->_t(i18n::Key::APP_TITLE));
+            SDL_SetWindowTitle(this->m_mainWindow->getWindow(), title.c_str());
+        }
+
+        {
+            StartupTimer::Phase phase("IDE");
+            spdlog::info("Creating IDE Renderer...");
+            this->m_ideRenderer = new IDE::IDERenderer();
+        }
+
+        if (this->m_preloadJob.isValid()) {
+            m_jobSystem->then(this->m_preloadJob, [this, project = this->m_preloadedProject]() {
+                if (*project) {
+                    this->m_ideRenderer->setActiveProject(project->release());
+                }
+            }, JobSystem::Lane::Main, JobSystem::Priority::Normal, this->m_preloadCancel);
+        }
+    }
+
     /**
      * @brief Destroy App instance and release resources
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Nov 2025
      *
-     * Deallocates the Environment object to prevent memory leaks.
+     * Stops the worker pool first, so no job outlives the objects it uses,
+     * then deallocates the Environment object to prevent memory leaks.
      */
     App::~App()
     {
+        delete m_jobSystem;
+        m_jobSystem = nullptr;
         delete m_environment;
         delete this->m_ideRenderer;
+        m_imguiManager = nullptr;
     }
 
     /**
@@ -211,6 +384,132 @@ namespace ADS::Core {
         App::m_fontManager = fontManager;
     }
 
+    /**
+     * @brief Get the asset manager instance for app-wide usage
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Provides access to the texture cache of the main window, so panels
+     * can show images without loading them on the UI thread.
+     *
+     * @return Pointer to the UI::AssetManager, or nullptr before setMainWindow()
+     *         and after shutdown()
+     *
+     * @see setMainWindow(), ADS::UI::AssetManager
+     */
+    UI::AssetManager *App::getAssetManager()
+    {
+        return App::m_assetManager;
+    }
+
+    /**
+     * @brief Get the render backend of the main window
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * For textures drawn by the IDE itself, such as scene previews, rather
+     * than loaded through the asset manager.
+     *
+     * @return Pointer to the UI::RenderBackend, or nullptr before setMainWindow()
+     *         and after shutdown()
+     *
+     * @see setMainWindow(), ADS::UI::RenderBackend
+     */
+    UI::RenderBackend *App::getRenderBackend()
+    {
+        return App::m_renderBackend;
+    }
+
+    /**
+     * @brief Get the worker pool for app-wide usage
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Subsystems submit their background work here instead of starting
+     * their own threads, and post results to its main-thread lane.
+     *
+     * @return Pointer to the JobSystem, or nullptr once the App is destroyed
+     *
+     * @see JobSystem, update()
+     */
+    JobSystem *App::getJobSystem()
+    {
+        return App::m_jobSystem;
+    }
+
+    /**
+     * @brief Get the ImGui manager for app-wide usage
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Lets the toolbar and menus switch the prebuilt theme styles
+     * without holding a reference to the App.
+     *
+     * @return Pointer to the ImGuiManager, or nullptr once the App is destroyed
+     *
+     * @see UI::ImGuiManager::setDarkTheme(), UI::ImGuiManager::setLightTheme()
+     */
+    UI::ImGuiManager *App::getImGuiManager()
+    {
+        return App::m_imguiManager;
+    }
+
+    /**
+     * @brief Wake the main loop to draw a frame
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Pushes the event registered in setMainWindow(); SDL_PushEvent() is
+     * thread-safe, so background tasks can call this when they finish.
+     *
+     * @see beginContinuousRendering(), processEvents()
+     */
+    void App::requestRedraw()
+    {
+        const Uint32 wakeEvent = m_wakeEvent.load(std::memory_order_relaxed);
+        if (wakeEvent == 0) {
+            return;
+        }
+
+        SDL_Event event{};
+        event.type = wakeEvent;
+        SDL_PushEvent(&event);
+    }
+
+    /**
+     * @brief Keep drawing frames back to back until the matching end call
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @see endContinuousRendering(), needsContinuousRendering()
+     */
+    void App::beginContinuousRendering()
+    {
+        if (m_continuousRequests.fetch_add(1, std::memory_order_relaxed) == 0) {
+            // The loop may be waiting already
+            requestRedraw();
+        }
+    }
+
+    /**
+     * @brief Release a beginContinuousRendering() request
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @see beginContinuousRendering()
+     */
+    void App::endContinuousRendering()
+    {
+        m_continuousRequests.fetch_sub(1, std::memory_order_relaxed);
+    }
+
     /**
      * @brief Check if application is running in debug mode
      *
@@ -254,76 +553,579 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Dec 2025
      *
-     * Runs the main application loop which continuously processes events,
-     * updates application state, and renders frames until the application
-     * is signaled to exit. This is a blocking call that only returns when
+     * Runs the main application loop which processes events, updates
+     * application state, and renders frames until the application is
+     * signaled to exit. This is a blocking call that only returns when
      * the application should terminate.
      *
-     * The main loop executes three phases per iteration:
-     * 1. Event processing (user input, window events)
-     * 2. State updates (game logic, animations)
-     * 3. Rendering (UI and graphics)
+     * The main loop executes five phases per iteration:
+     * 1. Waiting, while idle, for the next event
+     * 2. Event processing (user input, window events)
+     * 3. Results of background jobs, for up to MAIN_THREAD_JOB_BUDGET_US
+     * 4. State updates (game logic, animations)
+     * 5. Rendering (UI and graphics)
+     *
+     * Phase 3 is the one point where jobs posted to the main-thread lane of
+     * the JobSystem touch ImGui, SDL and the project; posting one wakes a
+     * waiting loop.
+     *
+     * With IDLE_RENDERING on, an unchanged UI is redrawn only every
+     * System::IDLE_WAIT_MS instead of on every pass, so the editor does
+     * not keep a core busy while the user is away.
+     *
+     * With INPUT_LOG set, the input and frame times of the session are
+     * recorded into it, along with a fresh seed for what is random, for
+     * runBenchmark() to replay.
      *
      * @note Must be called after proper initialization of window and ImGui backends
-     * @see processEvents(), update(), render(), isRunning()
+     * @see waitForEvents(), processEvents(), JobSystem::runMainThreadJobs(), update(), render(), isRunning()
      */
     void App::run()
     {
         m_running = true;
 
+        const std::string inputLog = App::getEnv()->getConfig()->inputLog;
+        if (!inputLog.empty()) {
+            std::random_device random;
+            // Never 0, which leaves TextBuffer seeds random
+            const uint64_t seed = (static_cast<uint64_t>(random()) << 32 | random()) | 1;
+            TextBuffer::setSeed(seed);
+            // The replay starts from this layout, at this window size
+            size_t layoutSize = 0;
+            const char *layout = ImGui::SaveIniSettingsToMemory(&layoutSize);
+            if (m_inputLog.open(std::filesystem::path(inputLog), seed, std::string_view(layout, layoutSize))) {
+                spdlog::info("Recording input to {}", inputLog);
+                SDL_Event resize{};
+                resize.type = SDL_WINDOWEVENT;
+                resize.window.event = SDL_WINDOWEVENT_SIZE_CHANGED;
+                SDL_GetWindowSize(m_mainWindow->getWindow(), &resize.window.data1, &resize.window.data2);
+                recordEvent(resize);
+            } else {
+                spdlog::error("Cannot record input to {}", inputLog);
+            }
+        }
+
         while (m_running) {
+            {
+                TraceRecorder::Scope trace("App::waitForEvents");
+                ADS_ZONE("App::waitForEvents");
+                waitForEvents();
+            }
+            TraceRecorder::Scope frame("Frame");
+            ADS_ZONE("Frame");
+            {
+                TraceRecorder::Scope trace("App::processEvents");
+                ADS_ZONE("App::processEvents");
+                processEvents();
+            }
+            {
+                TraceRecorder::Scope trace("JobSystem::runMainThreadJobs");
+                ADS_ZONE("JobSystem::runMainThreadJobs");
+                m_jobSystem->runMainThreadJobs(
+                    std::chrono::microseconds(ADS::Constants::System::MAIN_THREAD_JOB_BUDGET_US));
+            }
+            {
+                TraceRecorder::Scope trace("App::update");
+                ADS_ZONE("App::update");
+                update();
+            }
+            {
+                TraceRecorder::Scope trace("App::render");
+                ADS_ZONE("App::render");
+                render();
+            }
+            // Start deferred native file dialogs AFTER SDL_RenderPresent and
+            // deliver the answers of closed ones. The dialogs run on their
+            // own thread, so the loop keeps rendering while they are open.
+            TraceRecorder::Scope trace("IDERenderer::processPendingDialogs");
+            ADS_ZONE("IDERenderer::processPendingDialogs");
+            m_ideRenderer->processPendingDialogs();
+        }
+    }
+
+    /**
+     * @brief Draw a fixed number of frames and report their cost
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The ImGui layout file is not read, so every run starts from the
+     * default docking layout, and shutdown() does not save it. A replay
+     * starts from the layout its log recorded instead, and the recorded
+     * window size arrives with the first frame's events.
+     *
+     * @param options Benchmark settings from the command line
+     * @return int Exit code for main()
+     *
+     * @see run(), sendInput(), FrameBenchmark, InputLog
+     */
+    int App::runBenchmark(const FrameBenchmark::Options &options)
+    {
+        // Seeded before the project is built, like the recorded session was before its first edit
+        InputLog replay;
+        uint32_t frames = options.frames;
+        if (!options.replay.empty()) {
+            replay.load(options.replay);
+            TextBuffer::setSeed(replay.getSeed());
+            if (!replay.getState().empty()) {
+                ImGui::LoadIniSettingsFromMemory(replay.getState().data(), replay.getState().size());
+            }
+            m_replaying = true;
+            if (frames == 0 && replay.getFrameCount() > options.warmup) {
+                frames = static_cast<uint32_t>(replay.getFrameCount() - options.warmup);
+            }
+            spdlog::info("Replaying {} frames of {}", replay.getFrameCount(), options.replay.string());
+        }
+
+        // Measured on its own project, never on STARTUP_PROJECT
+        this->m_preloadCancel.cancel();
+        FrameBenchmark benchmark(options);
+        benchmark.loadInput();
+        if (std::unique_ptr<Project> project = benchmark.makeProject()) {
+            m_ideRenderer->setActiveProject(project.release());
+        }
+
+        m_headless = true;
+        m_imguiObject.getIO()->IniFilename = nullptr;
+        m_running = true;
+        if (!options.trace.empty()) {
+            // Written by shutdown(), like TRACE_FILE
+            m_traceFile = options.trace.string();
+        }
+
+        std::vector<const FrameBenchmark::Input *> events;
+        const uint32_t total = options.warmup + frames;
+        for (uint32_t frame = 0; frame < total && m_running; ++frame) {
+            const bool measured = frame >= options.warmup;
+            if (m_replaying) {
+                // Past the end of the log, frames go on with no input at the last frame time
+                m_replayEvents.clear();
+                if (frame < replay.getFrameCount()) {
+                    replay.eventsFor(frame, m_replayEvents);
+                    m_replayDeltaTime = replay.getDeltaTime(frame);
+                }
+            }
+            if (measured) {
+                benchmark.inputsFor(frame - options.warmup, events);
+                for (const FrameBenchmark::Input *input: events) {
+                    sendInput(*input);
+                }
+                benchmark.beginFrame(events.empty() && m_replayEvents.empty());
+                TraceRecorder::setEnabled(!m_traceFile.empty());
+            }
+            TraceRecorder::Scope trace("Frame");
+            ADS_ZONE("Frame");
+
             processEvents();
+            m_jobSystem->runMainThreadJobs(
+                std::chrono::microseconds(ADS::Constants::System::MAIN_THREAD_JOB_BUDGET_US));
             update();
             render();
-            // Run any deferred native file dialogs AFTER SDL_RenderPresent.
-            // The compositor now holds a clean frame, so blocking here does
-            // not produce a gray window.
             m_ideRenderer->processPendingDialogs();
+
+            if (measured) {
+                benchmark.endFrame();
+            }
+        }
+        m_running = false;
+        m_replaying = false;
+        m_replayEvents.clear();
+
+        if (options.report.empty()) {
+            benchmark.writeReport(std::cout);
+        } else {
+            std::ofstream out(options.report);
+            benchmark.writeReport(out);
+            if (!out) {
+                throw std::runtime_error(std::format("Cannot write benchmark report {}", options.report.string()));
+            }
+        }
+        spdlog::info("Benchmark: {} frames measured after {} warm-up frames", benchmark.getFrameCount(), options.warmup);
+        if (options.noAllocations) {
+            if (!AllocationCounter::isEnabled()) {
+                spdlog::warn("Benchmark: --no-allocations checks nothing without ADS_COUNT_ALLOCATIONS");
+            } else if (benchmark.getIdleAllocations() > 0) {
+                spdlog::error("Benchmark: idle frames made {} heap allocations; their call stacks are above",
+                              benchmark.getIdleAllocations());
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Queue a scripted input event as if SDL had received it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A key is pressed and released in the same frame; ImGui's input
+     * queue still sees both.
+     *
+     * @param input Event from the benchmark's input script
+     */
+    void App::sendInput(const FrameBenchmark::Input &input) const
+    {
+        using Kind = FrameBenchmark::Input::Kind;
+
+        const Uint32 windowId = SDL_GetWindowID(m_mainWindow->getWindow());
+        SDL_Event event{};
+        switch (input.kind) {
+            case Kind::Move:
+                event.type = SDL_MOUSEMOTION;
+                event.motion.windowID = windowId;
+                event.motion.x = static_cast<Sint32>(input.x);
+                event.motion.y = static_cast<Sint32>(input.y);
+                break;
+            case Kind::Press:
+            case Kind::Release:
+                event.type = (input.kind == Kind::Press) ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+                event.button.windowID = windowId;
+                event.button.button = SDL_BUTTON_LEFT;
+                event.button.state = (input.kind == Kind::Press) ? SDL_PRESSED : SDL_RELEASED;
+                event.button.clicks = 1;
+                event.button.x = static_cast<Sint32>(input.x);
+                event.button.y = static_cast<Sint32>(input.y);
+                break;
+            case Kind::Wheel:
+                event.type = SDL_MOUSEWHEEL;
+                event.wheel.windowID = windowId;
+                event.wheel.y = static_cast<Sint32>(input.y);
+                event.wheel.preciseY = input.y;
+                break;
+            case Kind::Key:
+                event.type = SDL_KEYDOWN;
+                event.key.windowID = windowId;
+                event.key.state = SDL_PRESSED;
+                event.key.keysym.sym = SDL_GetKeyFromName(input.text.c_str());
+                event.key.keysym.scancode = SDL_GetScancodeFromKey(event.key.keysym.sym);
+                SDL_PushEvent(&event);
+                event.type = SDL_KEYUP;
+                event.key.state = SDL_RELEASED;
+                break;
+            case Kind::Text:
+                event.type = SDL_TEXTINPUT;
+                event.text.windowID = windowId;
+                SDL_strlcpy(event.text.text, input.text.c_str(), sizeof(event.text.text));
+                break;
         }
+        SDL_PushEvent(&event);
     }
 
     /**
      * @brief Process SDL events and user input
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
      * Polls and processes all pending SDL events including window events,
      * user input, and system messages. Forwards ImGui-relevant events to
      * the ImGui backend and handles quit requests.
      *
+     * While replaying, only quit requests and window events get through
+     * from SDL, so touching a replay shown in a window does not change
+     * it; the recorded events of the frame follow them.
+     *
      * @note Sets running to false on SDL_QUIT or window close events
-     * @see run(), isRunning()
+     * @see run(), isRunning(), handleEvent(), recordEvent(), replayEvent()
      */
     void App::processEvents()
     {
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
-            ImGui_ImplSDL2_ProcessEvent(&event);
-            if (event.type == SDL_QUIT)
-                m_running = false;
-            if (event.type == SDL_WINDOWEVENT &&
-                event.window.event == SDL_WINDOWEVENT_CLOSE &&
-                event.window.windowID == SDL_GetWindowID(m_mainWindow->getWindow()))
-                m_running = false;
+            // Any event may change what is drawn; ImGui needs a few frames to settle it
+            m_framesToRender = ADS::Constants::System::IDLE_SETTLE_FRAMES;
+            if (event.type >= SDL_USEREVENT && event.type == m_wakeEvent.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            if (m_replaying && event.type != SDL_QUIT && event.type != SDL_WINDOWEVENT) {
+                continue;
+            }
+            if (m_inputLog.isRecording()) {
+                recordEvent(event);
+            }
+            handleEvent(event);
+        }
+        for (const InputLog::Event &recorded: m_replayEvents) {
+            replayEvent(recorded);
+        }
+        m_replayEvents.clear();
+    }
+
+    /**
+     * @brief Handle one SDL event, real or replayed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * F12 writes the event trace to TRACE_FILE while tracing is on.
+     *
+     * @param event Event to forward to ImGui and check for quit requests
+     */
+    void App::handleEvent(const SDL_Event &event)
+    {
+        if (event.type == SDL_TEXTINPUT && m_fontManager != nullptr) {
+            // Typed characters the atlas lacks are rasterised in the background
+            m_fontManager->addGlyphs(event.text.text);
+        }
+        ImGui_ImplSDL2_ProcessEvent(&event);
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F12 && event.key.repeat == 0 &&
+            TraceRecorder::isEnabled()) {
+            writeTrace();
+        }
+        if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_EXPOSED) {
+            // What a window showed may be gone even if its draw data is the same
+            m_viewportThrottle.invalidate();
+        }
+        if (event.type == SDL_WINDOWEVENT && isDisplayChange(event.window.event) &&
+            event.window.windowID == SDL_GetWindowID(m_mainWindow->getWindow())) {
+            updateDisplayScale();
+        }
+        if (event.type == SDL_QUIT)
+            m_running = false;
+        if (event.type == SDL_WINDOWEVENT &&
+            event.window.event == SDL_WINDOWEVENT_CLOSE &&
+            event.window.windowID == SDL_GetWindowID(m_mainWindow->getWindow()))
+            m_running = false;
+    }
+
+    /**
+     * @brief Record an event into INPUT_LOG, if it is one a replay needs
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * SDL zeroes the events it fills, so trimming the trailing zeros
+     * leaves a few bytes for most events, and only the typed characters
+     * of a text event.
+     *
+     * @param event Event just polled
+     */
+    void App::recordEvent(const SDL_Event &event)
+    {
+        if (!isReplayedEvent(event.type)) {
+            return;
+        }
+        const auto bytes = std::as_bytes(std::span(&event, 1)).subspan(RECORDED_EVENT_OFFSET);
+        size_t size = bytes.size();
+        while (size > 0 && bytes[size - 1] == std::byte{0}) {
+            --size;
+        }
+        m_inputLog.record(event.type, bytes.first(size));
+    }
+
+    /**
+     * @brief Rebuild a recorded event and handle it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Every replayed type but SDL_QUIT has the window id right after the
+     * timestamp, where the window event has it.
+     *
+     * @param recorded Event from the input log
+     */
+    void App::replayEvent(const InputLog::Event &recorded)
+    {
+        SDL_Event event{};
+        event.type = recorded.type;
+        event.common.timestamp = SDL_GetTicks();
+        const size_t size = std::min(recorded.payload.size(), sizeof(SDL_Event) - RECORDED_EVENT_OFFSET);
+        std::memcpy(reinterpret_cast<std::byte *>(&event) + RECORDED_EVENT_OFFSET, recorded.payload.data(), size);
+
+        if (event.type != SDL_QUIT) {
+            SDL_Window *window = m_mainWindow->getWindow();
+            event.window.windowID = SDL_GetWindowID(window);
+            if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                SDL_SetWindowSize(window, event.window.data1, event.window.data2);
+            }
+        }
+        handleEvent(event);
+    }
+
+    /**
+     * @brief Block until there is something to draw
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The event is left in the queue for processEvents(). Waking on the
+     * timeout still draws a frame, which is what lets autosave, expiring
+     * status messages and reloaded translations show up while idle.
+     *
+     * @see run(), needsContinuousRendering()
+     */
+    void App::waitForEvents()
+    {
+        using ADS::Constants::System;
+
+        if (!m_idleRendering) {
+            return;
+        }
+        if (m_framesToRender > 0) {
+            m_framesToRender--;
+            return;
+        }
+        if (needsContinuousRendering()) {
+            return;
         }
+
+        const bool typing = m_imguiObject.getIO()->WantTextInput;
+        SDL_WaitEventTimeout(nullptr, typing ? System::IDLE_TEXT_INPUT_WAIT_MS : System::IDLE_WAIT_MS);
+    }
+
+    /**
+     * @brief Check whether frames must be drawn back to back
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return true while dragging, loading images, saving, running main-thread
+     *         jobs left over by the budget, holding back a changed detached
+     *         window or asked to by a task
+     *
+     * @see waitForEvents(), beginContinuousRendering()
+     */
+    bool App::needsContinuousRendering() const
+    {
+        return ImGui::IsAnyMouseDown() ||
+               (m_assetManager != nullptr && m_assetManager->getPendingCount() > 0) ||
+               m_ideRenderer->needsContinuousRendering() ||
+               (m_fontManager != nullptr && m_fontManager->isRebuilding()) ||
+               m_jobSystem->hasMainThreadJobs() ||
+               m_viewportThrottle.hasPending() ||
+               m_continuousRequests.load(std::memory_order_relaxed) > 0;
     }
 
     /**
      * @brief Update application state and logic
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
      * Called once per frame to update application state, game logic,
-     * animations, and other time-dependent operations. Currently reserved
-     * for future implementation of application logic updates.
-     *
-     * @see run(), render()
+     * animations, and other time-dependent operations. Applies the .env
+     * settings reloaded since the previous frame, uploads the images
+     * decoded since the previous frame and swaps in the translations
+     * reloaded since then, then forwards the last frame's delta time to the
+     * IDE renderer, which drives autosave. Last, the font atlas follows the
+     * characters of the locale and of the text shown since the last frame.
+     *
+     * @see run(), render(), Environment::update(), UI::AssetManager::update(), i18n::i18n::update(), updateFontAtlas()
      */
     void App::update()
     {
-        // Future: game logic, state updates, animations, etc.
+        m_environment->update();
+        if (m_assetManager != nullptr) {
+            m_assetManager->update();
+        }
+        App::getTranslationsManager()->update();
+        m_ideRenderer->update(m_imguiObject.getIO()->DeltaTime);
+        updateFontAtlas();
+    }
+
+    /**
+     * @brief Swap in a rebuilt font atlas and start the next rebuild
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Runs between frames, when no draw data refers to the font texture.
+     * The backend's texture of the old atlas is released before the swap
+     * and the new one is uploaded by the next UI::RenderBackend::newFrame().
+     * An atlas rebuilt for a new display DPI brings the style sizes and
+     * font scale of that DPI with it, so nothing is drawn half scaled.
+     *
+     * @see update(), addLocaleGlyphs(), UI::Fonts::swapAtlas()
+     */
+    void App::updateFontAtlas()
+    {
+        if (m_fontManager == nullptr) {
+            return;
+        }
+
+        addLocaleGlyphs();
+        if (m_fontManager->hasRebuiltAtlas()) {
+            m_renderBackend->destroyFontsTexture();
+            const bool swapped = m_fontManager->swapAtlas();
+            // Sizes follow the DPI with the glyphs rasterised for it, or at once if those failed
+            if (m_pendingFontScale > 0.0f && (!swapped || m_fontManager->getDpiScale() == m_pendingFontScale)) {
+                m_imguiObject.setScale(m_mainWindow->getMainScale());
+                m_pendingFontScale = 0.0f;
+            }
+            m_viewportThrottle.invalidate();
+            m_framesToRender = ADS::Constants::System::IDLE_SETTLE_FRAMES;
+        }
+        m_fontManager->rebuildIfNeeded();
+    }
+
+    /**
+     * @brief Follow the main window to a display of another DPI
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Rescaling ImGui right away would show the old glyphs stretched, and
+     * rasterising them here would stall the frame, so the font manager
+     * rebuilds the atlas in the background and updateFontAtlas() applies
+     * the new sizes in the frame the atlas is swapped in. Until then the
+     * window keeps its old scale. Without fonts the sizes change at once.
+     *
+     * @see updateFontAtlas(), UI::Fonts::setDpiScale(), UI::ImGuiManager::setScale()
+     */
+    void App::updateDisplayScale()
+    {
+        if (!m_mainWindow->updateDPIScale()) {
+            return;
+        }
+
+        const float mainScale = m_mainWindow->getMainScale();
+        if (m_fontManager == nullptr) {
+            m_imguiObject.setScale(mainScale);
+            return;
+        }
+        const float fontScale = mainScale * m_mainWindow->getPixelRatio();
+        m_fontManager->setDpiScale(fontScale);
+        if (m_fontManager->getDpiScale() == fontScale && !m_fontManager->isRebuilding()) {
+            // The glyphs shown are already rasterised for it
+            m_imguiObject.setScale(mainScale);
+            m_pendingFontScale = 0.0f;
+            return;
+        }
+        ADS_LOG_INFO(Ui, "Display scale changed to {}; rebuilding the fonts", mainScale);
+        m_pendingFontScale = fontScale;
+    }
+
+    /**
+     * @brief Add the characters of the current locale to the font glyphs
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A new snapshot follows setLocale() and reloaded translations alike.
+     * Only the locale's own translations are read: the inherited ones come
+     * from the fallback, whose characters were added when it was current
+     * or are plain ASCII.
+     *
+     * @see updateFontAtlas(), UI::Fonts::addGlyphs()
+     */
+    void App::addLocaleGlyphs()
+    {
+        if (m_fontManager == nullptr) {
+            return;
+        }
+
+        const auto snapshot = App::getTranslationsManager()->snapshot();
+        if (snapshot->getGeneration() == m_glyphsGeneration) {
+            return;
+        }
+        m_glyphsGeneration = snapshot->getGeneration();
+
+        if (const i18n::TranslationMap *catalogue = snapshot->catalogue(snapshot->getLocale())) {
+            for (const auto &[key, translation]: *catalogue) {
+                m_fontManager->addGlyphs(translation);
+            }
+        }
     }
 
     /**
@@ -335,37 +1137,127 @@ namespace ADS::Core {
      * Prepares and renders a complete frame including ImGui UI elements.
      * Handles frame preparation, UI rendering via IDERenderer, and final
      * presentation to the screen. Supports multi-viewport rendering when
-     * enabled in ImGui configuration.
+     * enabled in ImGui configuration; detached windows are only drawn when
+     * they change, see UI::ViewportThrottle. The frame, ImGui::Render() and the
+     * draw data submission are timed by the IDE's FrameProfiler.
      *
      * @note Automatically handles DPI scaling and platform-specific rendering
-     * @see run(), update(), IDE::IDERenderer::render()
+     * @see run(), update(), IDE::IDERenderer::render(), IDE::FrameProfiler
      */
     void App::render()
     {
         ImGuiIO *io = m_imguiObject.getIO();
+        IDE::FrameProfiler &profiler = m_ideRenderer->getProfiler();
+        profiler.beginFrame();
 
         // Start the Dear ImGui frame
-        ImGui_ImplSDLRenderer2_NewFrame();
-        ImGui_ImplSDL2_NewFrame();
+        m_renderBackend->newFrame();
+        if (m_replaying) {
+            // ImGui rejects a frame that takes no time
+            io->DeltaTime = std::max(m_replayDeltaTime, 1e-6f);
+        } else if (m_inputLog.isRecording()) {
+            m_inputLog.endFrame(io->DeltaTime);
+        }
         ImGui::NewFrame();
 
         // Render the IDE
-        m_ideRenderer->render();
+        {
+            ADS_ZONE("IDERenderer::render");
+            m_ideRenderer->render();
+        }
 
         // Rendering
-        ImGui::Render();
-        SDL_RenderSetScale(m_renderer, io->DisplayFramebufferScale.x, io->DisplayFramebufferScale.y);
-        SDL_SetRenderDrawColor(m_renderer, 45, 45, 48, 255); // Dark gray background
-        SDL_RenderClear(m_renderer);
-        ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData(), m_renderer);
+        {
+            IDE::FrameProfiler::Scope scope(profiler, "ImGui::Render");
+            ADS_ZONE("ImGui::Render");
+            ImGui::Render();
+        }
+        {
+            IDE::FrameProfiler::Scope scope(profiler, "RenderDrawData");
+            TraceRecorder::Scope trace("RenderBackend::renderDrawData");
+            ADS_ZONE("RenderBackend::renderDrawData");
+            m_renderBackend->renderDrawData(ImGui::GetDrawData());
+        }
+        TraceRecorder::counter("Draw vertices", ImGui::GetDrawData()->TotalVtxCount);
+        ADS_PLOT("Queued jobs", m_jobSystem->getQueuedCount());
 
-        // Update and Render additional Platform Windows
+        // Update additional Platform Windows and render the ones that changed
         if (io->ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
+            TraceRecorder::Scope trace("RenderBackend::renderPlatformWindows");
+            ADS_ZONE("RenderBackend::renderPlatformWindows");
+            m_renderBackend->renderPlatformWindows(m_viewportThrottle);
+            TraceRecorder::counter("Viewports drawn", static_cast<int64_t>(m_viewportThrottle.getDrawnCount()));
         }
 
-        SDL_RenderPresent(m_renderer);
+        // Present waits for vsync, which is not CPU time of the frame
+        profiler.endFrame();
+        {
+            TraceRecorder::Scope trace("RenderBackend::present");
+            ADS_ZONE("RenderBackend::present");
+            m_renderBackend->present();
+        }
+        ADS_FRAME_MARK();
+
+        // Time to the first frame is what a start costs the user; the phases say where it went
+        if (StartupTimer::markFirstFrame()) {
+            for (const StartupTimer::Record &record: StartupTimer::getPhases()) {
+                spdlog::info("Startup: {:<24} {:8.1f} ms, from {:.1f} ms on the {} thread", record.name,
+                             record.durationMs, record.startMs, record.mainThread ? "main" : "worker");
+            }
+            spdlog::info("Startup: first frame presented after {:.1f} ms", StartupTimer::getFirstFrameMs());
+        }
+    }
+
+    /**
+     * @brief Write the event trace to TRACE_FILE
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Called on F12 and on shutdown. Recording goes on, so a later call
+     * writes the newest events again.
+     *
+     * @see Core::TraceRecorder::writeChromeTrace()
+     */
+    void App::writeTrace() const
+    {
+        if (TraceRecorder::writeChromeTrace(std::filesystem::path(m_traceFile))) {
+            spdlog::info("Trace written to {}", m_traceFile);
+        } else {
+            spdlog::error("Cannot write the trace to {}", m_traceFile);
+        }
+    }
+
+    /**
+     * @brief Apply the settings changed by a reload of the .env file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Settings read where they are used, such as AUTOSAVE_INTERVAL, need
+     * nothing here. Those only read at startup are reported as such.
+     *
+     * @param keys   Keys added, removed or changed
+     * @param config Settings after the reload
+     */
+    void App::applySettings(const std::vector<std::string>& keys, const Config& config)
+    {
+        for (const std::string& key : keys) {
+            if (key == "LOG_LEVELS") {
+                Logger::setLevels(config.logLevels);
+            } else if (key == "IDLE_RENDERING") {
+                this->m_idleRendering = config.idleRendering;
+                this->m_framesToRender = ADS::Constants::System::IDLE_SETTLE_FRAMES;
+            } else if (key == "TOOLTIP_DELAY") {
+                ImGui::GetStyle().HoverDelayNormal = config.tooltipDelay;
+            } else if (key == "TRACE_FILE") {
+                this->m_traceFile = config.traceFile;
+                TraceRecorder::setEnabled(!this->m_traceFile.empty());
+            } else if (key == "JOB_WORKERS" || key == "RENDERER" || key == "LANGUAGES" || key == "LOG_OVERFLOW" ||
+                       key == "LOG_QUEUE_SIZE" || key == "INPUT_LOG" || key.ends_with("_FONT")) {
+                spdlog::info("{} changed in the .env file; it takes effect after a restart", key);
+            }
+        }
     }
 
     /**
@@ -375,10 +1267,11 @@ namespace ADS::Core {
      * @version Dec 2025
      *
      * Safely shuts down and cleans up all application resources including:
-     * - Saving ImGui configuration to disk
-     * - Shutting down ImGui backends (SDL2 and SDLRenderer2)
+     * - Saving ImGui configuration to disk, except after a benchmark
+     * - Shutting down the ImGui backends of the render backend
      * - Destroying ImGui context
-     * - Releasing SDL renderer and window resources
+     * - Destroying the asset manager and its textures
+     * - Releasing the SDL renderer or OpenGL context and the window
      * - Quitting SDL subsystems
      *
      * Should be called after run() exits and before application termination.
@@ -390,11 +1283,25 @@ namespace ADS::Core {
     {
         using namespace ADS::Constants;
 
-        ImGui::SaveIniSettingsToDisk(System::CONFIG_FILE);
-        ImGui_ImplSDLRenderer2_Shutdown();
-        ImGui_ImplSDL2_Shutdown();
+        // A benchmark's layout must not replace the user's
+        if (!m_headless) {
+            ImGui::SaveIniSettingsToDisk(System::CONFIG_FILE);
+        }
+        if (!m_traceFile.empty()) {
+            writeTrace();
+        }
+        m_inputLog.close();
+        m_renderBackend->shutdown();
         ImGui::DestroyContext();
-        SDL_DestroyRenderer(m_renderer);
+        delete m_assetManager;      // Its textures belong to the renderer
+        m_assetManager = nullptr;
+        m_renderBackend = nullptr;
+        if (m_renderer != nullptr) {
+            SDL_DestroyRenderer(m_renderer);
+        }
+        if (m_mainWindow->getGLContext() != nullptr) {
+            SDL_GL_DeleteContext(m_mainWindow->getGLContext());
+        }
         SDL_DestroyWindow(m_mainWindow->getWindow());
         SDL_Quit();
 
@@ -470,13 +1377,26 @@ namespace ADS::Core {
      *
      * @param window Pointer to the Window instance to use as the main window
      *
-     * @note The window's renderer is automatically extracted and cached
+     * @note The window's renderer and render backend are automatically
+     *       extracted and cached, and the asset manager is created for them,
+     *       loading from public/assets and caching decoded images in
+     *       System::ASSET_CACHE_DIR. The event
+     *       used by requestRedraw() is registered here too
      * @see run(), processEvents(), render()
      */
     void App::setMainWindow(UI::Window *window)
     {
         this->m_mainWindow = window;
         this->m_renderer = window->getRenderer();
+        m_renderBackend = &window->getBackend();
+        UI::AssetManager::Settings assetSettings;
+        assetSettings.cacheDirectory = ADS::Constants::System::ASSET_CACHE_DIR;
+        delete m_assetManager;
+        m_assetManager = new UI::AssetManager(m_renderBackend, "public/assets", assetSettings);
+        if (m_wakeEvent.load(std::memory_order_relaxed) == 0) {
+            const Uint32 wakeEvent = SDL_RegisterEvents(1);
+            m_wakeEvent.store((wakeEvent == static_cast<Uint32>(-1)) ? 0 : wakeEvent, std::memory_order_relaxed);
+        }
         spdlog::info("Main window set successfully");
     }
 } // ADS
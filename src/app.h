@@ -15,11 +15,18 @@
 #define ADS_APP_H
 
 #include "env/env.h"
+#include <atomic>
 #include <spdlog/spdlog.h>
 
 #include "UI/UI.h"
+#include "UI/AssetManager.h"
+#include "UI/ViewportThrottle.h"
 #include "i18n/i18n.h"
 #include "IDE/IDERenderer.h"
+#include "Core/JobSystem.h"
+#include "Core/FrameBenchmark.h"
+#include "Core/InputLog.h"
+#include "Core/TraceRecorder.h"
 
 namespace ADS::Core {
     class App
@@ -40,6 +47,37 @@ namespace ADS::Core {
          */
         static UI::Fonts *m_fontManager;
 
+        /**
+         * Texture cache for the main window's renderer (created in setMainWindow)
+         */
+        static UI::AssetManager *m_assetManager;
+
+        /**
+         * Render backend of the main window, SDL_Renderer or OpenGL 3
+         * as chosen by RENDERER in .env (set in setMainWindow)
+         */
+        static UI::RenderBackend *m_renderBackend;
+
+        /**
+         * Worker pool shared by every subsystem, sized from JOB_WORKERS
+         */
+        static JobSystem *m_jobSystem;
+
+        /**
+         * SDL event type pushed by requestRedraw(), 0 until setMainWindow()
+         */
+        static std::atomic<Uint32> m_wakeEvent;
+
+        /**
+         * Open beginContinuousRendering() requests
+         */
+        static std::atomic<int> m_continuousRequests;
+
+        /**
+         * The ImGui manager of the running App, for app-wide usage
+         */
+        static UI::ImGuiManager *m_imguiManager;
+
         /**
          * Imgui object to interact with the GUI
          */
@@ -56,6 +94,77 @@ namespace ADS::Core {
          */
         bool m_isDebug;
 
+        /**
+         * Wait for events between frames when nothing is changing, from IDLE_RENDERING.
+         */
+        bool m_idleRendering;
+
+        /**
+         * Frames left to render before the loop may wait for events again.
+         */
+        int m_framesToRender;
+
+        /**
+         * Draws the detached panel windows only when they change, capped while unfocused.
+         */
+        UI::ViewportThrottle m_viewportThrottle;
+
+        /**
+         * Running a benchmark with no display: the ImGui layout is neither read nor saved.
+         */
+        bool m_headless;
+
+        /**
+         * Where the event trace is written, from TRACE_FILE; empty when tracing is off.
+         */
+        std::string m_traceFile;
+
+        /**
+         * Recording of the session's input into INPUT_LOG; closed when it is off.
+         */
+        InputLog m_inputLog;
+
+        /**
+         * Replaying an input log: real input is ignored and frames take the recorded delta time.
+         */
+        bool m_replaying;
+
+        /**
+         * Recorded events for the next processEvents() call, while replaying.
+         */
+        std::vector<InputLog::Event> m_replayEvents;
+
+        /**
+         * Recorded delta time of the next frame, while replaying.
+         */
+        float m_replayDeltaTime;
+
+        /**
+         * Generation of the translation snapshot whose locale was last added to the font glyphs.
+         */
+        uint64_t m_glyphsGeneration;
+
+        /**
+         * Font scale asked of the font manager after a DPI change, until an atlas at that scale is swapped in; 0 when none.
+         */
+        float m_pendingFontScale;
+
+        /**
+         * Translations being loaded on the pool since init(); completeStartup() waits for them.
+         */
+        JobSystem::JobHandle m_translationsJob;
+
+        /**
+         * Project of STARTUP_PROJECT being read on the pool since init(), nullptr until it is read.
+         */
+        JobSystem::JobHandle m_preloadJob;
+        std::shared_ptr<std::unique_ptr<Project>> m_preloadedProject;
+
+        /**
+         * Drops the preloaded project, e.g. when a benchmark brings its own.
+         */
+        CancellationToken m_preloadCancel;
+
         /**
          * Pointer to the main application window.
          * Used for event handling and rendering operations.
@@ -81,9 +190,10 @@ namespace ADS::Core {
          * @version Dec 2025
          *
          * Performs initial setup of all App subsystems including logger initialization,
-         * environment variable loading, translation system setup with configured languages,
-         * and ImGui manager initialization. Sets running state to false and initializes
-         * window/renderer pointers to nullptr.
+         * the worker pool and ImGui manager initialization. The translations, and the
+         * STARTUP_PROJECT if any, are loaded by jobs that run meanwhile; the IDE is
+         * created by completeStartup() once they are ready. Sets running state to false
+         * and initializes window/renderer pointers to nullptr.
          *
          * @note This is a private method called automatically by the constructor
          * @see App()
@@ -100,11 +210,127 @@ namespace ADS::Core {
          * user input, and system messages. Forwards ImGui-relevant events to
          * the ImGui backend and handles quit requests.
          *
+         * F12 writes the event trace to TRACE_FILE while tracing is on.
+         * The events are recorded into INPUT_LOG while it is set; while
+         * replaying, real input is dropped and the recorded events of the
+         * frame are handled instead.
+         *
          * @note Sets running to false on SDL_QUIT or window close events
-         * @see run(), isRunning()
+         * @see run(), isRunning(), writeTrace(), handleEvent()
          */
         void processEvents();
 
+        /**
+         * @brief Handle one SDL event, real or replayed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param event Event to forward to ImGui and check for quit requests
+         * @see processEvents()
+         */
+        void handleEvent(const SDL_Event &event);
+
+        /**
+         * @brief Record an event into INPUT_LOG, if it is one a replay needs
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Keyboard, text, mouse, window and quit events are kept, without
+         * their type and timestamp and with their trailing zero bytes
+         * trimmed; the others, some of which point to memory of this
+         * process, are not.
+         *
+         * @param event Event just polled
+         */
+        void recordEvent(const SDL_Event &event);
+
+        /**
+         * @brief Rebuild a recorded event and handle it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The event is addressed to the main window, whatever window it was
+         * recorded for, and a recorded resize resizes the main window.
+         *
+         * @param recorded Event from the input log
+         */
+        void replayEvent(const InputLog::Event &recorded);
+
+        /**
+         * @brief Write the events recorded so far to TRACE_FILE
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @see Core::TraceRecorder
+         */
+        void writeTrace() const;
+
+        /**
+         * @brief Apply the settings changed by a reload of the .env file
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param keys   Keys added, removed or changed
+         * @param config Settings after the reload
+         * @see Environment::subscribe()
+         */
+        void applySettings(const std::vector<std::string>& keys, const Config& config);
+
+        /**
+         * @brief Block until there is something to draw
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Returns at once while frames are left to settle the last input or
+         * needsContinuousRendering() holds; otherwise waits in
+         * SDL_WaitEventTimeout() for the next event, at most
+         * System::IDLE_WAIT_MS so time-based state still advances.
+         *
+         * @note Does nothing when IDLE_RENDERING is off
+         * @see run(), needsContinuousRendering()
+         */
+        void waitForEvents();
+
+        /**
+         * @brief Check whether frames must be drawn back to back
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * True while a mouse button is held (dragging windows, splitters or
+         * sliders), images are still being loaded, the IDE has work in
+         * progress or a task called beginContinuousRendering().
+         *
+         * @see waitForEvents(), IDE::IDERenderer::needsContinuousRendering()
+         */
+        [[nodiscard]] bool needsContinuousRendering() const;
+
+        /**
+         * @brief Swap in a rebuilt font atlas and start the next rebuild
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @see UI::Fonts::rebuildIfNeeded(), UI::Fonts::swapAtlas()
+         */
+        void updateFontAtlas();
+
+        /**
+         * @brief Follow the main window to a display of another DPI
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @see updateFontAtlas(), UI::Window::updateDPIScale()
+         */
+        void updateDisplayScale();
+
         /**
          * @brief Update application state and logic
          *
@@ -135,6 +361,19 @@ namespace ADS::Core {
          */
         void render();
 
+        /**
+         * @brief Queue a scripted input event as if SDL had received it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The event goes through processEvents() like real input, so the
+         * benchmark measures the same path.
+         *
+         * @param input Event from the benchmark's input script
+         */
+        void sendInput(const FrameBenchmark::Input &input) const;
+
     public:
         App();
 
@@ -183,6 +422,103 @@ namespace ADS::Core {
          */
         static void setFontManager(UI::Fonts *fontManager);
 
+        /**
+         * @brief Add the characters of the current locale to the font glyphs
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reads the last published translation snapshot and does nothing if
+         * it was already read. Called by update(), and by main() before the
+         * first atlas is built.
+         *
+         * @see UI::Fonts::addGlyphs()
+         */
+        void addLocaleGlyphs();
+
+        /**
+         * @brief Finish the startup once the main window exists
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Waits for the translations the constructor started loading on the
+         * pool and takes them over, titles the main window, creates the IDE
+         * and hands it the STARTUP_PROJECT when that has been read. Until
+         * this returns, getTranslationsManager() is nullptr. Called by
+         * main() between setMainWindow() and loading the fonts.
+         *
+         * @throws std::runtime_error if the translations could not be loaded
+         */
+        void completeStartup();
+
+        /**
+         * Get the asset manager instance for app-wide usage
+         *
+         * @return Pointer to the AssetManager, or nullptr before a main window is set
+         */
+        static UI::AssetManager *getAssetManager();
+
+        /**
+         * Get the render backend of the main window, to create textures
+         * that do not come from asset files
+         *
+         * @return Pointer to the RenderBackend, or nullptr before a main window is set
+         */
+        static UI::RenderBackend *getRenderBackend();
+
+        /**
+         * Get the worker pool for background work; results for ImGui, SDL
+         * or the project go to its main-thread lane, drained by run()
+         *
+         * @return Pointer to the JobSystem; valid while the App exists
+         */
+        static JobSystem *getJobSystem();
+
+        /**
+         * Get the ImGui manager for app-wide usage, e.g. to switch themes
+         *
+         * @return Pointer to the ImGuiManager; valid while the App exists
+         */
+        static UI::ImGuiManager *getImGuiManager();
+
+        /**
+         * @brief Wake the main loop to draw a frame
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * For background tasks whose result should be shown without waiting
+         * for input. Safe to call from any thread; does nothing before
+         * setMainWindow().
+         *
+         * @see beginContinuousRendering()
+         */
+        static void requestRedraw();
+
+        /**
+         * @brief Keep drawing frames back to back until the matching end call
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * For animations and tasks that report progress every frame. Calls
+         * nest; safe to call from any thread.
+         *
+         * @see endContinuousRendering(), requestRedraw()
+         */
+        static void beginContinuousRendering();
+
+        /**
+         * @brief Release a beginContinuousRendering() request
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @see beginContinuousRendering()
+         */
+        static void endContinuousRendering();
+
         /**
          * Return the translation for the text in language given
          *
@@ -214,21 +550,53 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Dec 2025
          *
-         * Runs the main application loop which continuously processes events,
-         * updates application state, and renders frames until the application
-         * is signaled to exit. This is a blocking call that only returns when
+         * Runs the main application loop which processes events, updates
+         * application state, and renders frames until the application is
+         * signaled to exit. This is a blocking call that only returns when
          * the application should terminate.
          *
-         * The main loop executes three phases per iteration:
-         * 1. Event processing (user input, window events)
-         * 2. State updates (game logic, animations)
-         * 3. Rendering (UI and graphics)
+         * The main loop executes four phases per iteration:
+         * 1. Waiting, while idle, for the next event
+         * 2. Event processing (user input, window events)
+         * 3. State updates (game logic, animations)
+         * 4. Rendering (UI and graphics)
          *
          * @note Must be called after proper initialization of window and ImGui backends
-         * @see processEvents(), update(), render(), isRunning()
+         * @see waitForEvents(), processEvents(), update(), render(), isRunning()
          */
         void run();
 
+        /**
+         * @brief Draw a fixed number of frames and report their cost
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Used instead of run() when main() was started with --benchmark
+         * or --replay, on SDL's dummy video driver and software renderer
+         * unless --window 1 was given. Loads the project of the options,
+         * draws the warm-up frames, then draws and measures the others,
+         * sending the scripted input before each one. Measured frames span
+         * event processing to the end of render(), with no waiting for
+         * events in between.
+         *
+         * A replay feeds every drawn frame, warm-up included, the events
+         * and delta time of the same frame of the input log, and seeds
+         * the session like the recording did, so it runs as fast as the
+         * machine allows and does the same work on every run.
+         *
+         * With --no-allocations, a measured frame that gets no input must
+         * not touch the heap: each allocation it makes is printed with its
+         * call stack, and the run fails.
+         *
+         * @param options Benchmark settings from the command line
+         * @return int Exit code for main(); 1 if an idle frame allocated under --no-allocations
+         *
+         * @throws std::runtime_error if the input script, the input log, the project or the report cannot be read or written
+         * @see FrameBenchmark, InputLog
+         */
+        int runBenchmark(const FrameBenchmark::Options &options);
+
         /**
          * @brief Perform cleanup and shutdown of all application systems
          *
@@ -236,10 +604,10 @@ namespace ADS::Core {
          * @version Dec 2025
          *
          * Safely shuts down and cleans up all application resources including:
-         * - Saving ImGui configuration to disk
-         * - Shutting down ImGui backends (SDL2 and SDLRenderer2)
+         * - Saving ImGui configuration to disk, except after a benchmark
+         * - Shutting down the ImGui backends of the render backend
          * - Destroying ImGui context
-         * - Releasing SDL renderer and window resources
+         * - Releasing the SDL renderer or OpenGL context and the window
          * - Quitting SDL subsystems
          *
          * Should be called after run() exits and before application termination.
@@ -309,7 +677,8 @@ namespace ADS::Core {
          *
          * @param window Pointer to the Window instance to use as the main window
          *
-         * @note The window's renderer is automatically extracted and cached
+         * @note The window's renderer and render backend are automatically
+         *       extracted and cached
          * @see run(), processEvents(), render()
          */
         void setMainWindow(UI::Window *window);
@@ -0,0 +1,344 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file BudgetPacker.cpp
+ * @brief Implementation of the BudgetPacker class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "BudgetPacker.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "Core/Project.h"
+
+namespace ADS::Compiler {
+
+    namespace {
+
+        /// Cells of the solve() table; bounds its time to a few milliseconds
+        constexpr uint64_t TABLE_CELLS = uint64_t{1} << 24;
+
+        /// Best priority of a budget nobody can meet; stays negative however many priorities are added to it
+        constexpr int64_t INFEASIBLE = std::numeric_limits<int64_t>::min() / 4;
+
+        constexpr uint32_t SCENE_PRIORITY = 3;
+        constexpr uint32_t CHARACTER_PRIORITY = 2;
+        constexpr uint32_t ITEM_PRIORITY = 1;
+
+        /// The one language the packer's compressor holds
+        constexpr std::string_view TEXT_LOCALE = "game";
+
+        std::string entityText(const Entities::BaseEntity& entity, const std::shared_ptr<const std::string>& description) {
+            std::string text = entity.getName();
+            if (description) {
+                text += *description;
+            }
+            return text;
+        }
+    }
+
+    BudgetPacker BudgetPacker::fromProject(const Core::Project& project, const TargetProfile& target) {
+        BudgetPacker packer;
+        std::unordered_map<const Entities::Scene*, uint32_t> sceneIndex;
+        std::deque<const Entities::Scene*> frontier;
+
+        for (const auto& scene : project.getScenes()) {
+            const std::vector<Entities::Scene*> exits = project.getExits(*scene);
+            const uint32_t index = packer.add(scene->getHandle(),
+                                              target.sceneRecord + target.exitRecord * static_cast<uint32_t>(exits.size()),
+                                              SCENE_PRIORITY);
+            packer.setText(index, entityText(*scene, scene->getDescription()));
+            sceneIndex.emplace(scene.get(), index);
+        }
+        for (const Core::EntityHandle handle : project.query(Core::EntityKind::Scene).where("isStartScene", true).handles()) {
+            const Entities::Scene* start = project.findScene(handle);
+            packer.setChoice(sceneIndex.at(start), Choice::Keep);
+            frontier.push_back(start);
+        }
+
+        // Each scene depends on the first scene found leading to it
+        std::vector<bool> reached(packer.size(), false);
+        for (const Entities::Scene* scene : frontier) {
+            reached[sceneIndex.at(scene)] = true;
+        }
+        while (!frontier.empty()) {
+            const Entities::Scene* scene = frontier.front();
+            frontier.pop_front();
+            for (const Entities::Scene* next : project.getExits(*scene)) {
+                const uint32_t index = sceneIndex.at(next);
+                if (!reached[index]) {
+                    reached[index] = true;
+                    packer.setDependency(index, sceneIndex.at(scene));
+                    frontier.push_back(next);
+                }
+            }
+        }
+
+        for (const auto& character : project.getCharacters()) {
+            const uint32_t index = packer.add(character->getHandle(), target.characterRecord, CHARACTER_PRIORITY);
+            packer.setText(index, entityText(*character, character->getDescription()));
+            if (character->isPlayer()) {
+                packer.setChoice(index, Choice::Keep);
+            }
+        }
+        for (const auto& item : project.getItems()) {
+            const uint32_t index = packer.add(item->getHandle(), target.itemRecord, ITEM_PRIORITY);
+            packer.setText(index, entityText(*item, item->getDescription()));
+        }
+        return packer;
+    }
+
+    uint32_t BudgetPacker::add(const Core::EntityHandle handle, const uint32_t recordBytes, const uint32_t priority) {
+        Entry entry;
+        entry.handle = handle;
+        entry.recordBytes = recordBytes;
+        entry.priority = priority;
+        m_entries.push_back(std::move(entry));
+        m_stale = true;
+        return static_cast<uint32_t>(m_entries.size() - 1);
+    }
+
+    bool BudgetPacker::setText(const uint32_t index, const std::string_view text) {
+        if (!m_texts.setText(TEXT_LOCALE, std::to_string(index), text)) {
+            return false;
+        }
+        m_stale = true;
+        return true;
+    }
+
+    void BudgetPacker::setRecordBytes(const uint32_t index, const uint32_t bytes) {
+        m_entries[index].recordBytes = bytes;
+        m_stale = true;
+    }
+
+    void BudgetPacker::setPriority(const uint32_t index, const uint32_t priority) {
+        m_entries[index].priority = priority;
+    }
+
+    void BudgetPacker::setChoice(const uint32_t index, const Choice choice) {
+        m_entries[index].choice = choice;
+    }
+
+    bool BudgetPacker::setDependency(const uint32_t index, const uint32_t dependency) {
+        for (uint32_t ancestor = dependency; ancestor != NO_DEPENDENCY; ancestor = m_entries[ancestor].dependency) {
+            if (ancestor == index) {
+                return false;
+            }
+        }
+        m_entries[index].dependency = dependency;
+        return true;
+    }
+
+    uint32_t BudgetPacker::cost(const uint32_t index) const {
+        refresh();
+        return m_costs[index];
+    }
+
+    uint32_t BudgetPacker::dictionaryBytes() const {
+        refresh();
+        const TextDictionary* dictionary = m_texts.getDictionary(TEXT_LOCALE);
+        return dictionary != nullptr ? static_cast<uint32_t>(dictionary->targetBytes()) : 0;
+    }
+
+    Core::EntityHandle BudgetPacker::handle(const uint32_t index) const {
+        return m_entries[index].handle;
+    }
+
+    size_t BudgetPacker::size() const {
+        return m_entries.size();
+    }
+
+    void BudgetPacker::refresh() const {
+        if (!m_stale) {
+            return;
+        }
+        // Only texts set since the last refresh are encoded, unless the dictionary is learnt again
+        m_texts.build();
+        m_costs.resize(m_entries.size());
+        for (size_t index = 0; index < m_entries.size(); ++index) {
+            const size_t textBytes = m_texts.getEncoded(TEXT_LOCALE, std::to_string(index)).size();
+            m_costs[index] = m_entries[index].recordBytes + static_cast<uint32_t>(textBytes);
+        }
+        m_stale = false;
+    }
+
+    BudgetPacker::Plan BudgetPacker::solve(const uint32_t budget) const {
+        refresh();
+        const auto n = static_cast<uint32_t>(m_entries.size());
+        Plan plan;
+        plan.dictionaryBytes = dictionaryBytes();
+
+        // Depth-first order of the dependency forest; end[p] is the position after p's subtree
+        std::vector<uint32_t> childStart(n + 1, 0);
+        for (const Entry& entry : m_entries) {
+            if (entry.dependency != NO_DEPENDENCY) {
+                ++childStart[entry.dependency + 1];
+            }
+        }
+        for (uint32_t index = 0; index < n; ++index) {
+            childStart[index + 1] += childStart[index];
+        }
+        std::vector<uint32_t> children(childStart[n]);
+        std::vector<uint32_t> fill(childStart.begin(), childStart.end() - 1);
+        for (uint32_t index = 0; index < n; ++index) {
+            if (m_entries[index].dependency != NO_DEPENDENCY) {
+                children[fill[m_entries[index].dependency]++] = index;
+            }
+        }
+
+        std::vector<uint32_t> order;
+        std::vector<uint32_t> end(n);
+        order.reserve(n);
+        struct Visit {
+            uint32_t entry;
+            uint32_t position;      ///< In order
+            uint32_t nextChild;     ///< In children
+        };
+        std::vector<Visit> stack;
+        const auto visit = [&](const uint32_t entry) {
+            stack.push_back({entry, static_cast<uint32_t>(order.size()), childStart[entry]});
+            order.push_back(entry);
+        };
+        for (uint32_t root = 0; root < n; ++root) {
+            if (m_entries[root].dependency != NO_DEPENDENCY) {
+                continue;
+            }
+            visit(root);
+            while (!stack.empty()) {
+                Visit& top = stack.back();
+                if (top.nextChild < childStart[top.entry + 1]) {
+                    visit(children[top.nextChild++]);
+                } else {
+                    end[top.position] = static_cast<uint32_t>(order.size());
+                    stack.pop_back();
+                }
+            }
+        }
+
+        // Keep reaches up to what an entry depends on and wins over Drop
+        std::vector<bool> required(n, false);
+        for (uint32_t index = 0; index < n; ++index) {
+            if (m_entries[index].choice == Choice::Keep) {
+                for (uint32_t up = index; up != NO_DEPENDENCY && !required[up]; up = m_entries[up].dependency) {
+                    required[up] = true;
+                }
+            }
+        }
+
+        const uint32_t available = budget > plan.dictionaryBytes ? budget - plan.dictionaryBytes : 0;
+        const uint64_t granule = std::max<uint64_t>(1, (uint64_t{n} * available + TABLE_CELLS - 1) / TABLE_CELLS);
+        const auto capacity = static_cast<uint32_t>(available / granule);
+        const size_t width = size_t{capacity} + 1;
+        std::vector<uint32_t> weight(n);
+        for (uint32_t p = 0; p < n; ++p) {
+            weight[p] = static_cast<uint32_t>((m_costs[order[p]] + granule - 1) / granule);
+        }
+
+        // Backwards over positions: row p holds the top priority of positions p.. within c cells.
+        // Only rows still referenced by an earlier position are kept; the choice of every cell is
+        // kept as a bit to rebuild the selection.
+        std::vector<uint32_t> references(n + 1, 0);
+        for (uint32_t p = 0; p < n; ++p) {
+            ++references[p + 1];
+            ++references[end[p]];
+        }
+        std::vector<std::vector<int64_t>> rows(n + 1);
+        std::vector<std::vector<int64_t>> spare;
+        const auto release = [&](const uint32_t row) {
+            if (--references[row] == 0) {
+                spare.push_back(std::move(rows[row]));
+                rows[row] = {};
+            }
+        };
+        const size_t words = (width + 63) / 64;
+        std::vector<uint64_t> taken(size_t{n} * words, 0);     // Bit c of row p: position p taken at c cells
+        const std::vector<int64_t> blocked(width, INFEASIBLE);    // Skipping a required entry
+        rows[n].assign(width, 0);
+
+        for (uint32_t p = n; p-- > 0;) {
+            const uint32_t entry = order[p];
+            const std::vector<int64_t>& next = rows[p + 1];
+            const std::vector<int64_t>& skip = required[entry] ? blocked : rows[end[p]];
+            std::vector<int64_t> row;
+            if (!spare.empty()) {
+                row = std::move(spare.back());
+                spare.pop_back();
+            }
+            row.resize(width);
+
+            if (m_entries[entry].choice == Choice::Drop && !required[entry]) {
+                std::ranges::copy(skip, row.begin());
+            } else {
+                const size_t w = std::min<size_t>(weight[p], width);
+                const auto priority = static_cast<int64_t>(m_entries[entry].priority);
+                uint64_t* bits = &taken[size_t{p} * words];
+                std::copy_n(skip.begin(), w, row.begin());
+                for (size_t c = w; c < width;) {
+                    // A word of choices at a time keeps the loop free of read-modify-writes
+                    const size_t stop = std::min(width, (c / 64 + 1) * 64);
+                    uint64_t word = 0;
+                    for (; c < stop; ++c) {
+                        const int64_t take = next[c - w] + priority;
+                        const bool better = take > skip[c];
+                        row[c] = better ? take : skip[c];
+                        word |= uint64_t{better} << (c % 64);
+                    }
+                    bits[(stop - 1) / 64] = word;
+                }
+            }
+            rows[p] = std::move(row);
+            release(p + 1);
+            release(end[p]);
+        }
+
+        std::vector<bool> kept(n, false);
+        if (n > 0 && rows[0][capacity] < 0) {
+            plan.fits = false;
+            for (uint32_t index = 0; index < n; ++index) {
+                kept[index] = required[index];
+            }
+        } else {
+            uint32_t c = capacity;
+            for (uint32_t p = 0; p < n;) {
+                if (taken[size_t{p} * words + c / 64] >> (c % 64) & 1) {
+                    kept[order[p]] = true;
+                    c -= weight[p];
+                    ++p;
+                } else {
+                    p = end[p];
+                }
+            }
+        }
+
+        plan.bytes = plan.dictionaryBytes;
+        for (uint32_t index = 0; index < n; ++index) {
+            if (kept[index]) {
+                plan.kept.push_back(index);
+                plan.bytes += m_costs[index];
+                plan.priority += m_entries[index].priority;
+            } else {
+                plan.dropped.push_back(index);
+            }
+        }
+        plan.fits = plan.fits && plan.bytes <= budget;
+        return plan;
+    }
+}
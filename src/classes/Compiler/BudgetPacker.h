@@ -0,0 +1,210 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_COMPILER_BUDGET_PACKER_H
+#define ADS_COMPILER_BUDGET_PACKER_H
+
+/**
+ * @file BudgetPacker.h
+ * @brief Decides which entities of a game fit the memory of a target platform
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Each entity costs a fixed record plus its text, compressed by a
+ * TextCompressor with the dictionary learnt from every text of the game,
+ * as the compiler stores it; the dictionary is paid for once. Choosing the entities that fit is a knapsack: each has a cost and a
+ * priority, some must stay, and some only make sense with another one (a
+ * scene is only reachable through the scene that leads to it). The packer
+ * keeps the costs current as texts change and solves the knapsack in a few
+ * milliseconds, so the editor can answer "what if" on every edit.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "Core/EntityHandle.h"
+#include "TextCompressor.h"
+
+namespace ADS::Core {
+    class Project;
+}
+
+namespace ADS::Compiler {
+
+    /**
+     * @brief Memory a target platform leaves for game data, and its record sizes
+     *
+     * The sizes are those of the runtime the compiler emits for the target.
+     */
+    struct TargetProfile {
+        std::string_view name;
+        uint32_t budget;                ///< Bytes free for game data once the interpreter is loaded
+        uint16_t sceneRecord;           ///< Fixed bytes of a scene, before its text
+        uint16_t characterRecord;
+        uint16_t itemRecord;
+        uint16_t exitRecord;            ///< Bytes of each exit of a scene
+    };
+
+    /**
+     * @brief Built-in targets, estimated for a typical text-adventure interpreter
+     */
+    inline constexpr std::array<TargetProfile, 4> TARGET_PROFILES = {{
+        {"ZX Spectrum 48K", 28 * 1024, 8, 6, 6, 2},
+        {"Amstrad CPC 464", 30 * 1024, 8, 6, 6, 2},
+        {"Commodore 64", 36 * 1024, 8, 6, 6, 2},
+        {"MSX2", 96 * 1024, 8, 6, 6, 2},
+    }};
+
+    /**
+     * @brief Fits a game into a memory budget
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Entries are addressed by the index add() returns. Each may depend on
+     * at most one other entry, so the dependencies form a forest; that
+     * shape is what lets solve() find the best selection exactly, by a
+     * dynamic program over the entries in depth-first order, in time
+     * proportional to entries times budget cells. Budgets are counted in
+     * cells of a few bytes and costs rounded up to whole cells, so a
+     * selection that fits in cells fits in bytes too.
+     *
+     * Not thread-safe.
+     */
+    class BudgetPacker {
+    public:
+        /**
+         * @brief What the creator decided for an entry
+         */
+        enum class Choice : uint8_t {
+            Auto,       ///< Kept if it is worth its bytes
+            Keep,       ///< Always kept, and so is what it depends on
+            Drop        ///< Never kept, and neither is what depends on it
+        };
+
+        /**
+         * @brief Outcome of solve()
+         */
+        struct Plan {
+            std::vector<uint32_t> kept;         ///< Entries kept, by index
+            std::vector<uint32_t> dropped;      ///< The others
+            uint32_t bytes = 0;                 ///< Kept entries plus the text dictionary
+            uint32_t dictionaryBytes = 0;       ///< Text dictionary alone
+            uint64_t priority = 0;              ///< Sum of the kept priorities
+            bool fits = true;                   ///< False if the Keep entries and the dictionary alone exceed the budget
+        };
+
+        static constexpr uint32_t NO_DEPENDENCY = UINT32_MAX;
+
+        /**
+         * @brief Collect the scenes, characters and items of a project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The text of an entity is its name and description. Scenes rank
+         * above characters and characters above items. The start scene
+         * and the player are kept. Other scenes depend on the scene they are
+         * first reached from, going breadth-first through the exits.
+         *
+         * @param project Project to pack
+         * @param target  Record sizes to use
+         * @return BudgetPacker The packer, with one entry per entity
+         */
+        static BudgetPacker fromProject(const Core::Project& project, const TargetProfile& target);
+
+        /**
+         * @brief Add an entry
+         *
+         * @param handle      Entity it stands for
+         * @param recordBytes Bytes it costs besides its text
+         * @param priority    Worth of keeping it
+         * @return uint32_t Index of the entry
+         */
+        uint32_t add(Core::EntityHandle handle, uint32_t recordBytes, uint32_t priority);
+
+        /**
+         * @brief Set the text of an entry, to be compressed
+         * @return bool False if the text holds a NUL byte; the entry keeps its previous text
+         */
+        bool setText(uint32_t index, std::string_view text);
+
+        void setRecordBytes(uint32_t index, uint32_t bytes);
+        void setPriority(uint32_t index, uint32_t priority);
+        void setChoice(uint32_t index, Choice choice);
+
+        /**
+         * @brief Make an entry depend on another, which must be kept for it to be kept
+         *
+         * @param index      Dependent entry
+         * @param dependency Entry it needs, or NO_DEPENDENCY
+         * @return bool False if that would close a cycle
+         */
+        bool setDependency(uint32_t index, uint32_t dependency);
+
+        /**
+         * @brief Get the bytes an entry costs, text compressed with its terminator
+         */
+        [[nodiscard]] uint32_t cost(uint32_t index) const;
+
+        /**
+         * @brief Get the bytes of the text dictionary, TextDictionary::targetBytes()
+         */
+        [[nodiscard]] uint32_t dictionaryBytes() const;
+
+        [[nodiscard]] Core::EntityHandle handle(uint32_t index) const;
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Choose the entries that fit
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Maximises the kept priority within the budget. Cheap enough to
+         * call after every edit: its table is capped at 16M cells, which
+         * a desktop fills in under 20 ms; a game of a few hundred entities
+         * takes around 10 ms on a 28 KB budget.
+         *
+         * @param budget Bytes available, e.g. TargetProfile::budget
+         * @return Plan The entries kept and dropped
+         */
+        [[nodiscard]] Plan solve(uint32_t budget) const;
+
+    private:
+        struct Entry {
+            Core::EntityHandle handle;
+            uint32_t recordBytes = 0;
+            uint32_t priority = 0;
+            uint32_t dependency = NO_DEPENDENCY;
+            Choice choice = Choice::Auto;
+        };
+
+        std::vector<Entry> m_entries;
+        mutable TextCompressor m_texts;                             ///< Text of each entry, keyed by its index
+        mutable std::vector<uint32_t> m_costs;                      ///< By entry
+        mutable bool m_stale = true;                                ///< m_texts and m_costs need rebuilding
+
+        /**
+         * @brief Compress what changed and recompute the costs, if anything did
+         */
+        void refresh() const;
+    };
+
+} // namespace ADS::Compiler
+
+#endif // ADS_COMPILER_BUDGET_PACKER_H
@@ -0,0 +1,347 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file TextCompressor.cpp
+ * @brief Implementation of the TextCompressor class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "TextCompressor.h"
+
+#include <algorithm>
+#include <format>
+#include <ranges>
+
+#include "Core/JobSystem.h"
+#include "Core/Project.h"
+
+namespace ADS::Compiler {
+
+    namespace {
+
+        /// Fewest occurrences that make a pair worth its two dictionary bytes
+        constexpr uint32_t MIN_PAIR_COUNT = 4;
+
+        /// Pairs tables are indexed by first * 256 + second
+        constexpr size_t PAIR_KEYS = 256 * 256;
+
+        /**
+         * @brief Replace every occurrence of a pair, left to right, by its code
+         */
+        void replacePair(std::vector<uint8_t>& codes, const uint8_t first, const uint8_t second, const uint8_t code) {
+            size_t out = 0;
+            for (size_t in = 0; in < codes.size(); ++in) {
+                if (in + 1 < codes.size() && codes[in] == first && codes[in + 1] == second) {
+                    codes[out++] = code;
+                    ++in;
+                } else {
+                    codes[out++] = codes[in];
+                }
+            }
+            codes.resize(out);
+        }
+
+        template<typename T>
+        void addEntityTexts(TextCompressor& compressor, const std::string_view locale, const std::string_view kind,
+                            const std::vector<T>& entities, std::vector<std::string>& rejected) {
+            for (const auto& entity : entities) {
+                std::string key = std::format("{}:{}:name", kind, entity->getId());
+                if (!compressor.setText(locale, key, entity->getName())) {
+                    rejected.push_back(std::move(key));
+                }
+                const auto description = entity->getDescription();
+                key = std::format("{}:{}:description", kind, entity->getId());
+                if (!compressor.setText(locale, key, description ? std::string_view(*description) : std::string_view())) {
+                    rejected.push_back(std::move(key));
+                }
+            }
+        }
+    }
+
+    std::string decodeText(const TextDictionary& dictionary, const std::span<const uint8_t> encoded) {
+        std::string text;
+        std::array<uint8_t, TextDictionary::MAX_DEPTH + 1> stack{};
+        const size_t firstPair = dictionary.firstPair();
+        const size_t lastCode = firstPair + dictionary.pairs.size();
+
+        for (const uint8_t code : encoded) {
+            if (code == 0 || code >= lastCode) {
+                break;
+            }
+            size_t top = 0;
+            stack[top++] = code;
+            while (top > 0) {
+                const uint8_t next = stack[--top];
+                if (next >= firstPair) {
+                    const auto& pair = dictionary.pairs[next - firstPair];
+                    stack[top++] = pair[1];
+                    stack[top++] = pair[0];
+                } else {
+                    text.push_back(static_cast<char>(dictionary.alphabet[next - 1]));
+                }
+            }
+        }
+        return text;
+    }
+
+    bool TextCompressor::setText(const std::string_view locale, const std::string_view key, const std::string_view text) {
+        // Code 0 ends a text on the target
+        if (text.contains('\0')) {
+            return false;
+        }
+        auto languageIt = m_languages.find(locale);
+        if (languageIt == m_languages.end()) {
+            languageIt = m_languages.emplace(std::string(locale), Language()).first;
+        }
+        Language& language = languageIt->second;
+
+        auto textIt = language.texts.find(key);
+        if (textIt == language.texts.end()) {
+            textIt = language.texts.emplace(std::string(key), Text()).first;
+        } else if (textIt->second.source == text) {
+            return true;
+        }
+        Text& entry = textIt->second;
+        language.changedBytes += text.size();
+        for (const char c : text) {
+            if (language.literalCode[static_cast<uint8_t>(c)] == 0) {
+                language.retrain = true;
+                break;
+            }
+        }
+        entry.source = text;
+        entry.dirty = true;
+        return true;
+    }
+
+    bool TextCompressor::removeText(const std::string_view locale, const std::string_view key) {
+        const auto languageIt = m_languages.find(locale);
+        if (languageIt == m_languages.end()) {
+            return false;
+        }
+        Language& language = languageIt->second;
+        const auto textIt = language.texts.find(key);
+        if (textIt == language.texts.end()) {
+            return false;
+        }
+        language.changedBytes += textIt->second.source.size();
+        language.texts.erase(textIt);
+        return true;
+    }
+
+    std::vector<std::string> TextCompressor::setProjectTexts(const Core::Project& project, const std::string_view locale) {
+        std::vector<std::string> rejected;
+        addEntityTexts(*this, locale, "scene", project.getScenes(), rejected);
+        addEntityTexts(*this, locale, "character", project.getCharacters(), rejected);
+        addEntityTexts(*this, locale, "item", project.getItems(), rejected);
+        return rejected;
+    }
+
+    size_t TextCompressor::build(Core::JobSystem* jobs) {
+        std::vector<Language*> pending;
+        for (auto& language : m_languages | std::views::values) {
+            if (language.retrain || std::ranges::any_of(language.texts, [](const auto& text) {
+                    return text.second.dirty;
+                })) {
+                pending.push_back(&language);
+            }
+        }
+
+        std::vector<size_t> encoded(pending.size(), 0);
+        if (jobs != nullptr && pending.size() > 1) {
+            std::vector<Core::JobSystem::JobHandle> handles;
+            handles.reserve(pending.size());
+            for (size_t index = 0; index < pending.size(); ++index) {
+                handles.push_back(jobs->submit([&encoded, &pending, index] {
+                    encoded[index] = build(*pending[index]);
+                }));
+            }
+            for (size_t index = 0; index < pending.size(); ++index) {
+                jobs->wait(handles[index]);
+                // A stopped pool cancels the job; finish the language here
+                if (handles[index].getState() != Core::JobSystem::State::Completed) {
+                    encoded[index] = build(*pending[index]);
+                }
+            }
+        } else {
+            for (size_t index = 0; index < pending.size(); ++index) {
+                encoded[index] = build(*pending[index]);
+            }
+        }
+
+        size_t total = 0;
+        for (const size_t count : encoded) {
+            total += count;
+        }
+        return total;
+    }
+
+    size_t TextCompressor::build(Language& language) {
+        if (language.changedBytes * 4 > language.trainedBytes) {
+            language.retrain = true;
+        }
+        if (language.retrain) {
+            train(language);
+        }
+
+        size_t count = 0;
+        for (Text& text : language.texts | std::views::values) {
+            if (text.dirty) {
+                encode(language, text);
+                text.dirty = false;
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    void TextCompressor::train(Language& language) {
+        TextDictionary& dictionary = language.dictionary;
+        std::array<bool, 256> used{};
+        size_t sourceBytes = 0;
+        for (const Text& text : language.texts | std::views::values) {
+            for (const char c : text.source) {
+                used[static_cast<uint8_t>(c)] = true;
+            }
+            sourceBytes += text.source.size();
+        }
+
+        // NUL never reaches here, so at most 255 literals
+        dictionary.alphabet.clear();
+        dictionary.pairs.clear();
+        language.literalCode.fill(0);
+        for (size_t byte = 0; byte < used.size(); ++byte) {
+            if (used[byte]) {
+                dictionary.alphabet.push_back(static_cast<uint8_t>(byte));
+                language.literalCode[byte] = static_cast<uint8_t>(dictionary.alphabet.size());
+            }
+        }
+
+        std::vector<std::vector<uint8_t>> corpus;
+        corpus.reserve(language.texts.size());
+        for (const Text& text : language.texts | std::views::values) {
+            std::vector<uint8_t>& codes = corpus.emplace_back(text.source.size());
+            std::ranges::transform(text.source, codes.begin(), [&language](const char c) {
+                return language.literalCode[static_cast<uint8_t>(c)];
+            });
+        }
+
+        // Each round turns the most frequent pair into the next free code
+        language.pairCode.assign(PAIR_KEYS, 0);
+        std::array<uint8_t, 256> depth{};
+        std::vector<uint32_t> counts(PAIR_KEYS);
+        for (size_t code = dictionary.firstPair(); code <= UINT8_MAX; ++code) {
+            std::ranges::fill(counts, 0);
+            for (const std::vector<uint8_t>& codes : corpus) {
+                for (size_t i = 0; i + 1 < codes.size(); ++i) {
+                    ++counts[codes[i] * 256 + codes[i + 1]];
+                }
+            }
+
+            size_t best = PAIR_KEYS;
+            for (size_t key = 0; key < PAIR_KEYS; ++key) {
+                if (counts[key] >= MIN_PAIR_COUNT && (best == PAIR_KEYS || counts[key] > counts[best])
+                    && std::max(depth[key / 256], depth[key % 256]) < TextDictionary::MAX_DEPTH) {
+                    best = key;
+                }
+            }
+            if (best == PAIR_KEYS) {
+                break;
+            }
+
+            const auto first = static_cast<uint8_t>(best / 256);
+            const auto second = static_cast<uint8_t>(best % 256);
+            dictionary.pairs.push_back({first, second});
+            depth[code] = static_cast<uint8_t>(std::max(depth[first], depth[second]) + 1);
+            language.pairCode[best] = static_cast<uint8_t>(code);
+            for (std::vector<uint8_t>& codes : corpus) {
+                replacePair(codes, first, second, static_cast<uint8_t>(code));
+            }
+        }
+
+        for (Text& text : language.texts | std::views::values) {
+            text.dirty = true;
+        }
+        language.trainedBytes = sourceBytes;
+        language.changedBytes = 0;
+        language.retrain = false;
+    }
+
+    void TextCompressor::encode(const Language& language, Text& text) {
+        std::vector<uint8_t>& codes = text.encoded;
+        codes.resize(text.source.size());
+        std::ranges::transform(text.source, codes.begin(), [&language](const char c) {
+            return language.literalCode[static_cast<uint8_t>(c)];
+        });
+
+        // Apply the pairs in the order they were learnt, which is the order of their codes
+        while (codes.size() > 1) {
+            uint8_t earliest = 0;
+            size_t key = 0;
+            for (size_t i = 0; i + 1 < codes.size(); ++i) {
+                const size_t candidate = codes[i] * 256 + codes[i + 1];
+                const uint8_t code = language.pairCode[candidate];
+                if (code != 0 && (earliest == 0 || code < earliest)) {
+                    earliest = code;
+                    key = candidate;
+                }
+            }
+            if (earliest == 0) {
+                break;
+            }
+            replacePair(codes, static_cast<uint8_t>(key / 256), static_cast<uint8_t>(key % 256), earliest);
+        }
+        codes.push_back(0);
+    }
+
+    const TextDictionary* TextCompressor::getDictionary(const std::string_view locale) const {
+        const auto it = m_languages.find(locale);
+        return it != m_languages.end() ? &it->second.dictionary : nullptr;
+    }
+
+    std::span<const uint8_t> TextCompressor::getEncoded(const std::string_view locale, const std::string_view key) const {
+        const auto languageIt = m_languages.find(locale);
+        if (languageIt == m_languages.end()) {
+            return {};
+        }
+        const auto textIt = languageIt->second.texts.find(key);
+        return textIt != languageIt->second.texts.end() ? std::span<const uint8_t>(textIt->second.encoded)
+                                                        : std::span<const uint8_t>();
+    }
+
+    TextCompressor::Statistics TextCompressor::getStatistics(const std::string_view locale) const {
+        Statistics statistics;
+        const auto it = m_languages.find(locale);
+        if (it == m_languages.end()) {
+            return statistics;
+        }
+        for (const Text& text : it->second.texts | std::views::values) {
+            ++statistics.texts;
+            statistics.sourceBytes += text.source.size();
+            statistics.encodedBytes += text.encoded.size();
+        }
+        statistics.dictionaryBytes = it->second.dictionary.targetBytes();
+        return statistics;
+    }
+
+    std::vector<std::string> TextCompressor::getLocales() const {
+        std::vector<std::string> locales;
+        locales.reserve(m_languages.size());
+        for (const auto& locale : m_languages | std::views::keys) {
+            locales.push_back(locale);
+        }
+        return locales;
+    }
+}
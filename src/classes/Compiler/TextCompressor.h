@@ -0,0 +1,208 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_COMPILER_TEXT_COMPRESSOR_H
+#define ADS_COMPILER_TEXT_COMPRESSOR_H
+
+/**
+ * @file TextCompressor.h
+ * @brief Dictionary compression of the game text for 8-bit targets
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Texts are compressed by byte pair substitution. Each language gets its
+ * own dictionary: the bytes its texts use become the literal codes, and
+ * every code left over stands for a pair of codes, learnt by repeatedly
+ * replacing the most frequent adjacent pair in all the texts. Pairs may
+ * hold other pairs, so a code can stand for a whole word. The target
+ * decodes with a loop and a small stack (see decodeText()), and the
+ * dictionary costs two bytes per pair.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ADS::Core {
+    class JobSystem;
+    class Project;
+}
+
+namespace ADS::Compiler {
+
+    /**
+     * @brief Codes of one language, as stored on the target
+     *
+     * Code 0 ends a text. Codes 1..alphabet.size() are literals; the codes
+     * after them are pairs, pairs[code - firstPair()].
+     */
+    struct TextDictionary {
+        /// Deepest nesting of pairs, so the target decoder's stack stays small
+        static constexpr size_t MAX_DEPTH = 16;
+
+        std::vector<uint8_t> alphabet;                  ///< Byte of each literal code
+        std::vector<std::array<uint8_t, 2>> pairs;      ///< Codes each pair code expands to
+
+        /**
+         * @brief Get the first pair code; 256 when the literals take every code
+         */
+        [[nodiscard]] size_t firstPair() const {
+            return alphabet.size() + 1;
+        }
+
+        /**
+         * @brief Get the bytes the dictionary takes on the target, with its two counts
+         */
+        [[nodiscard]] size_t targetBytes() const {
+            return 2 + alphabet.size() + 2 * pairs.size();
+        }
+    };
+
+    /**
+     * @brief Expand a compressed text, the way the target does
+     *
+     * @param dictionary Dictionary it was compressed with
+     * @param encoded    Codes, up to the first 0 or the end
+     * @return std::string The original text
+     */
+    [[nodiscard]] std::string decodeText(const TextDictionary& dictionary, std::span<const uint8_t> encoded);
+
+    /**
+     * @brief Compresses every text of a game, per language, and keeps it compressed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Texts are set by language and key. build() compresses what changed
+     * since the last build: a language keeps its dictionary while its texts
+     * change little, and only the texts set since are encoded again. It
+     * learns a new dictionary, and encodes all its texts, when a text uses
+     * a byte the alphabet lacks or a quarter of its bytes have changed since
+     * it was learnt. Languages are independent, so build() compresses them
+     * in parallel.
+     *
+     * Not thread-safe; build() blocks until every language is done.
+     */
+    class TextCompressor {
+    public:
+        /**
+         * @brief Sizes of one language
+         */
+        struct Statistics {
+            size_t texts = 0;
+            size_t sourceBytes = 0;         ///< Texts as set
+            size_t encodedBytes = 0;        ///< Texts compressed, terminators included
+            size_t dictionaryBytes = 0;     ///< TextDictionary::targetBytes()
+        };
+
+        /**
+         * @brief Set the text of a key in a language
+         *
+         * Code 0 ends a text on the target, so a text holding a NUL byte
+         * cannot be stored; it is rejected and the key keeps what it had.
+         *
+         * @param locale Language, e.g. "es_ES"
+         * @param key    Id of the text, e.g. "scene:hall:description"
+         * @param text   Text; setting the same text again changes nothing
+         * @return bool False if the text holds a NUL byte
+         */
+        bool setText(std::string_view locale, std::string_view key, std::string_view text);
+
+        /**
+         * @brief Remove the text of a key
+         * @return bool False if there was none
+         */
+        bool removeText(std::string_view locale, std::string_view key);
+
+        /**
+         * @brief Set the names and descriptions of every entity of a project
+         *
+         * Keys are "<kind>:<id>:name" and "<kind>:<id>:description".
+         *
+         * @param project Project to take the texts from
+         * @param locale  Language they are in
+         * @return std::vector<std::string> Keys of the texts rejected by setText(), for the caller to report
+         */
+        std::vector<std::string> setProjectTexts(const Core::Project& project, std::string_view locale);
+
+        /**
+         * @brief Compress what changed since the last build
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param jobs Pool to compress the languages on, one job each; nullptr to compress them here
+         * @return size_t Texts encoded
+         */
+        size_t build(Core::JobSystem* jobs = nullptr);
+
+        /**
+         * @brief Get the dictionary of a language, as of the last build
+         * @return const TextDictionary* The dictionary, or nullptr for an unknown language
+         */
+        [[nodiscard]] const TextDictionary* getDictionary(std::string_view locale) const;
+
+        /**
+         * @brief Get a compressed text, as of the last build
+         * @return std::span<const uint8_t> Its codes and terminator; empty if unknown or not built
+         */
+        [[nodiscard]] std::span<const uint8_t> getEncoded(std::string_view locale, std::string_view key) const;
+
+        [[nodiscard]] Statistics getStatistics(std::string_view locale) const;
+
+        [[nodiscard]] std::vector<std::string> getLocales() const;
+
+    private:
+        struct Text {
+            std::string source;
+            std::vector<uint8_t> encoded;
+            bool dirty = true;              ///< Set since the last build
+        };
+
+        struct Language {
+            std::map<std::string, Text, std::less<>> texts;
+            TextDictionary dictionary;
+            std::array<uint8_t, 256> literalCode{};     ///< Code of each byte; 0 if not in the alphabet
+            std::vector<uint8_t> pairCode;              ///< Code of each pair of codes (first * 256 + second); 0 if none
+            size_t trainedBytes = 0;                    ///< Source bytes when the dictionary was learnt
+            size_t changedBytes = 0;                    ///< Source bytes set or removed since
+            bool retrain = true;
+        };
+
+        std::map<std::string, Language, std::less<>> m_languages;
+
+        /**
+         * @brief Bring one language up to date
+         * @return size_t Texts encoded
+         */
+        static size_t build(Language& language);
+
+        /**
+         * @brief Learn the dictionary of a language from all its texts
+         */
+        static void train(Language& language);
+
+        /**
+         * @brief Encode one text with the dictionary of its language
+         */
+        static void encode(const Language& language, Text& text);
+    };
+
+} // namespace ADS::Compiler
+
+#endif // ADS_COMPILER_TEXT_COMPRESSOR_H
@@ -0,0 +1,360 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file AllocationCounter.cpp
+ * @brief Counting replacements of the global operator new
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Only the plain and the aligned operator new are replaced: the array and
+ * nothrow forms call them by default. Every operator delete is replaced
+ * too, since memory from malloc() must go back to free().
+ *
+ * Each block is preceded by a 16-byte header holding its size and tag, so
+ * any operator delete can take it off its tag without a lookup; blocks of
+ * a wider alignment keep the header in the padding before them.
+ *
+ * In ADS_ENABLE_TRACY builds every block is also reported to Tracy, in a
+ * memory pool named after its tag.
+ *
+ * Call stacks of violations come from backtrace() where the C library has
+ * it, and from std::stacktrace elsewhere; the frames only have names when
+ * the executable exports its symbols, which the build does for counting
+ * builds.
+ */
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdio>
+
+#include "Profiling.h"
+
+#ifdef ADS_COUNT_ALLOCATIONS
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#if __has_include(<execinfo.h>)
+#define ADS_STACK_FROM_EXECINFO
+#include <cxxabi.h>
+#include <execinfo.h>
+#elif __has_include(<stacktrace>)
+#include <stacktrace>
+#endif
+#endif
+
+namespace ADS::Core::AllocationCounter {
+    namespace {
+        constexpr std::array<const char*, TAG_COUNT> TAG_NAMES = {
+            "Other", "Project", "i18n", "Fonts", "Inspector", "Assets", "Undo"
+        };
+
+        /**
+         * @brief Live counters of one tag, on their own cache line
+         */
+        struct alignas(64) TagCounters {
+            std::atomic<uint64_t> bytes{0};
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> peakBytes{0};
+        };
+
+        /**
+         * @brief Print a violation to stderr
+         */
+        void printViolation(const char* scope, const std::size_t size, const std::string_view stack) {
+            std::fprintf(stderr, "Allocation of %zu bytes inside no-allocation scope \"%s\":\n%.*s", size, scope,
+                         static_cast<int>(stack.size()), stack.data());
+        }
+
+        std::atomic<uint64_t> g_count{0};
+        std::array<TagCounters, TAG_COUNT> g_tags;
+        std::atomic<uint64_t> g_violations{0};
+        std::atomic<ViolationHandler> g_violationHandler{&printViolation};
+        thread_local Tag t_tag = Tag::Other;
+        thread_local const char* t_forbidden = nullptr;     ///< Innermost NoAllocationScope; nullptr outside any
+        thread_local uint64_t t_violations = 0;
+    }
+
+    Scope::Scope(const Tag tag) : m_previous(t_tag) {
+        t_tag = tag;
+    }
+
+    Scope::~Scope() {
+        t_tag = m_previous;
+    }
+
+    NoAllocationScope::NoAllocationScope(const char* name) : m_previous(t_forbidden), m_violationsAtStart(t_violations) {
+        t_forbidden = name;
+    }
+
+    NoAllocationScope::~NoAllocationScope() {
+        t_forbidden = m_previous;
+    }
+
+    uint64_t NoAllocationScope::getViolations() const {
+        return t_violations - m_violationsAtStart;
+    }
+
+    void setViolationHandler(const ViolationHandler handler) {
+        g_violationHandler.store(handler != nullptr ? handler : &printViolation, std::memory_order_relaxed);
+    }
+
+    uint64_t getViolationCount() {
+        return g_violations.load(std::memory_order_relaxed);
+    }
+
+    bool isEnabled() {
+#ifdef ADS_COUNT_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    uint64_t getCount() {
+        return g_count.load(std::memory_order_relaxed);
+    }
+
+    const char* getTagName(const Tag tag) {
+        return TAG_NAMES[static_cast<size_t>(tag)];
+    }
+
+    TagStats getTagStats(const Tag tag) {
+        const TagCounters& counters = g_tags[static_cast<size_t>(tag)];
+        return {counters.bytes.load(std::memory_order_relaxed),
+                counters.allocations.load(std::memory_order_relaxed),
+                counters.peakBytes.load(std::memory_order_relaxed)};
+    }
+
+    std::array<TagStats, TAG_COUNT> getAllTagStats() {
+        std::array<TagStats, TAG_COUNT> stats;
+        for (size_t index = 0; index < TAG_COUNT; ++index) {
+            stats[index] = getTagStats(static_cast<Tag>(index));
+        }
+        return stats;
+    }
+
+    uint64_t getLiveBytes() {
+        uint64_t bytes = 0;
+        for (const TagCounters& counters : g_tags) {
+            bytes += counters.bytes.load(std::memory_order_relaxed);
+        }
+        return bytes;
+    }
+
+    void resetPeaks() {
+        for (TagCounters& counters : g_tags) {
+            counters.peakBytes.store(counters.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+#ifdef ADS_COUNT_ALLOCATIONS
+    namespace {
+        /**
+         * @brief Stored right before every block
+         */
+        struct alignas(16) Header {
+            uint64_t size;
+            Tag tag;
+        };
+
+        static_assert(sizeof(Header) == 16);
+
+        thread_local bool t_reporting = false;      ///< Inside the violation handler
+
+        /**
+         * @brief Describe the calling thread's stack, innermost frame first
+         */
+        std::string captureStack() {
+#ifdef ADS_STACK_FROM_EXECINFO
+            std::array<void*, 64> frames{};
+            const int count = backtrace(frames.data(), static_cast<int>(frames.size()));
+            char** symbols = backtrace_symbols(frames.data(), count);
+            if (symbols == nullptr) {
+                return "    (no call stack)\n";
+            }
+            std::string stack;
+            for (int index = 0; index < count; ++index) {
+                // "module(mangled+offset) [address]": demangle what is between '(' and '+'
+                std::string_view frame = symbols[index];
+                const size_t open = frame.find('(');
+                const size_t plus = frame.find('+', open);
+                stack += "    ";
+                if (open != std::string_view::npos && plus != std::string_view::npos && plus > open + 1) {
+                    const std::string mangled(frame.substr(open + 1, plus - open - 1));
+                    int status = 0;
+                    char* name = abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status);
+                    stack += frame.substr(0, open + 1);
+                    stack += status == 0 && name != nullptr ? std::string_view(name) : std::string_view(mangled);
+                    stack += frame.substr(plus);
+                    std::free(name);
+                } else {
+                    stack += frame;
+                }
+                stack += '\n';
+            }
+            std::free(symbols);
+            return stack;
+#elif defined(__cpp_lib_stacktrace)
+            return std::to_string(std::stacktrace::current()) + '\n';
+#else
+            return "    (no call stack on this platform)\n";
+#endif
+        }
+
+        /**
+         * @brief Count an allocation inside a NoAllocationScope and hand it to the handler
+         */
+        void reportViolation(const std::size_t size) noexcept {
+            ++t_violations;
+            g_violations.fetch_add(1, std::memory_order_relaxed);
+            t_reporting = true;
+            try {
+                g_violationHandler.load(std::memory_order_relaxed)(t_forbidden, size, captureStack());
+            } catch (...) {
+                // Out of memory while reporting; the count stands
+            }
+            t_reporting = false;
+        }
+
+        /**
+         * @brief Charge a new block to the current tag and write its header
+         */
+        void* track(void* memory, const std::size_t size) {
+            auto* header = static_cast<Header*>(memory);
+            header->size = size;
+            header->tag = t_tag;
+            TagCounters& counters = g_tags[static_cast<size_t>(header->tag)];
+            const uint64_t bytes = counters.bytes.fetch_add(size, std::memory_order_relaxed) + size;
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            uint64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+            while (bytes > peak && !counters.peakBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+            }
+            g_count.fetch_add(1, std::memory_order_relaxed);
+            // One Tracy memory pool per tag
+            ADS_MEMORY_ALLOC(header + 1, size, TAG_NAMES[static_cast<size_t>(header->tag)]);
+            if (t_forbidden != nullptr && !t_reporting) {
+                reportViolation(size);
+            }
+            return header + 1;
+        }
+
+        /**
+         * @brief Take a block off its tag
+         * @return Header* Header of the block
+         */
+        Header* untrack(void* memory) noexcept {
+            Header* header = static_cast<Header*>(memory) - 1;
+            ADS_MEMORY_FREE(memory, TAG_NAMES[static_cast<size_t>(header->tag)]);
+            TagCounters& counters = g_tags[static_cast<size_t>(header->tag)];
+            counters.bytes.fetch_sub(header->size, std::memory_order_relaxed);
+            counters.allocations.fetch_sub(1, std::memory_order_relaxed);
+            return header;
+        }
+
+        void* allocate(std::size_t size) {
+            if (void* memory = std::malloc(sizeof(Header) + size)) {
+                return track(memory, size);
+            }
+            throw std::bad_alloc();
+        }
+
+        void release(void* memory) noexcept {
+            if (memory != nullptr) {
+                std::free(untrack(memory));
+            }
+        }
+
+        /**
+         * @brief Room before an aligned block: the header, padded to the alignment
+         */
+        std::size_t alignedOffset(std::align_val_t alignment) {
+            return std::max(static_cast<std::size_t>(alignment), sizeof(Header));
+        }
+
+        void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+            const auto align = static_cast<std::size_t>(alignment);
+            const std::size_t offset = alignedOffset(alignment);
+            // aligned_alloc() wants a non-zero multiple of the alignment
+            const std::size_t rounded = (offset + size + align - 1) / align * align;
+#ifdef _WIN32
+            auto* memory = static_cast<std::byte*>(_aligned_malloc(rounded, align));
+#else
+            auto* memory = static_cast<std::byte*>(std::aligned_alloc(align, rounded));
+#endif
+            if (memory != nullptr) {
+                return track(memory + offset - sizeof(Header), size);
+            }
+            throw std::bad_alloc();
+        }
+
+        void releaseAligned(void* memory, std::align_val_t alignment) noexcept {
+            if (memory == nullptr) {
+                return;
+            }
+            untrack(memory);
+            void* block = static_cast<std::byte*>(memory) - alignedOffset(alignment);
+#ifdef _WIN32
+            _aligned_free(block);
+#else
+            std::free(block);
+#endif
+        }
+    }
+#endif
+}
+
+#ifdef ADS_COUNT_ALLOCATIONS
+void* operator new(std::size_t size) {
+    return ADS::Core::AllocationCounter::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return ADS::Core::AllocationCounter::allocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept {
+    ADS::Core::AllocationCounter::release(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    ADS::Core::AllocationCounter::release(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    ADS::Core::AllocationCounter::release(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    ADS::Core::AllocationCounter::release(memory);
+}
+
+void operator delete(void* memory, std::align_val_t alignment) noexcept {
+    ADS::Core::AllocationCounter::releaseAligned(memory, alignment);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t alignment) noexcept {
+    ADS::Core::AllocationCounter::releaseAligned(memory, alignment);
+}
+
+void operator delete[](void* memory, std::align_val_t alignment) noexcept {
+    ADS::Core::AllocationCounter::releaseAligned(memory, alignment);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t alignment) noexcept {
+    ADS::Core::AllocationCounter::releaseAligned(memory, alignment);
+}
+#endif
@@ -0,0 +1,193 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_ALLOCATION_COUNTER_H
+#define ADS_CORE_ALLOCATION_COUNTER_H
+
+/**
+ * @file AllocationCounter.h
+ * @brief Process-wide count of heap allocations, per subsystem
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Built with ADS_COUNT_ALLOCATIONS, the global operator new is replaced by
+ * one that counts its calls before allocating. Without it nothing is
+ * replaced and the count stays at zero, so release builds pay nothing.
+ *
+ * Every counted block also carries the Tag that was current on its thread
+ * when it was allocated, set with a Scope around the code of a subsystem.
+ * Freeing the block takes it off that tag, whichever thread or scope frees
+ * it, so the live bytes of a tag are what the subsystem still holds.
+ *
+ * A NoAllocationScope turns the count into a check: any operator new on
+ * its thread while it is open is reported with the call stack that made
+ * it. Debug and Test builds count allocations by default, so the check
+ * runs in the test suite and in benchmarks of a debug build.
+ *
+ * @see ADS::Core::FrameBenchmark, ADS::IDE::MemoryMonitor
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ADS::Core::AllocationCounter {
+    /**
+     * @brief Subsystem an allocation is charged to
+     */
+    enum class Tag : uint8_t {
+        Other,          ///< Allocated outside any Scope
+        Project,        ///< Entities, scene graph and search index
+        I18n,           ///< Translation catalogues
+        Fonts,          ///< Font sources and the glyph atlas
+        Inspector,      ///< Inspector panel caches
+        Assets,         ///< Decoded images of the asset manager
+        Undo            ///< Undo journal
+    };
+
+    inline constexpr size_t TAG_COUNT = 7;
+
+    /**
+     * @brief Memory held by one tag
+     */
+    struct TagStats {
+        uint64_t bytes = 0;             ///< Live bytes
+        uint64_t allocations = 0;       ///< Live blocks
+        uint64_t peakBytes = 0;         ///< Highest live bytes since start or resetPeaks()
+    };
+
+    /**
+     * @brief Charges the allocations of the enclosing block, on this thread, to a tag
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Scopes nest; the innermost one wins and the outer tag is restored
+     * when it closes. Costs a thread-local store, so scopes stay in builds
+     * without ADS_COUNT_ALLOCATIONS.
+     */
+    class Scope {
+    public:
+        explicit Scope(Tag tag);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Tag m_previous;
+    };
+
+    /**
+     * @brief Forbids heap allocations on this thread in the enclosing block
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * An operator new made inside the block still succeeds, but it counts
+     * as a violation and goes to the violation handler along with the name
+     * of the innermost scope and the call stack. Scopes nest. Allocations
+     * made by the handler itself are not checked.
+     *
+     * Without ADS_COUNT_ALLOCATIONS nothing is checked and getViolations()
+     * stays at zero.
+     */
+    class NoAllocationScope {
+    public:
+        /**
+         * @param name What the block is, for the report; a string literal
+         */
+        explicit NoAllocationScope(const char* name);
+        ~NoAllocationScope();
+
+        NoAllocationScope(const NoAllocationScope&) = delete;
+        NoAllocationScope& operator=(const NoAllocationScope&) = delete;
+
+        /**
+         * @brief Get the allocations made on this thread since the scope opened
+         * @return uint64_t Violations, inner scopes' included
+         */
+        [[nodiscard]] uint64_t getViolations() const;
+
+    private:
+        const char* m_previous;
+        uint64_t m_violationsAtStart;
+    };
+
+    /**
+     * @brief Receives every allocation made inside a NoAllocationScope
+     *
+     * Called on the allocating thread, before the allocation returns.
+     *
+     * @param scope Name of the innermost NoAllocationScope
+     * @param size Bytes requested
+     * @param stack Call stack of the allocation, one frame per line
+     */
+    using ViolationHandler = void (*)(const char* scope, std::size_t size, std::string_view stack);
+
+    /**
+     * @brief Replace the violation handler
+     * @param handler New handler; nullptr restores the default, which prints to stderr
+     */
+    void setViolationHandler(ViolationHandler handler);
+
+    /**
+     * @brief Get the violations of every thread so far
+     * @return uint64_t Allocations made inside a NoAllocationScope since the process started
+     */
+    [[nodiscard]] uint64_t getViolationCount();
+
+    /**
+     * @brief Check whether allocations are being counted
+     * @return bool True when built with ADS_COUNT_ALLOCATIONS
+     */
+    [[nodiscard]] bool isEnabled();
+
+    /**
+     * @brief Get the allocations made so far by every thread
+     * @return uint64_t Calls to operator new since the process started
+     */
+    [[nodiscard]] uint64_t getCount();
+
+    /**
+     * @brief Get the name of a tag, for display
+     * @return const char* Static string
+     */
+    [[nodiscard]] const char* getTagName(Tag tag);
+
+    /**
+     * @brief Get the memory held by a tag
+     * @return TagStats All zero when not built with ADS_COUNT_ALLOCATIONS
+     */
+    [[nodiscard]] TagStats getTagStats(Tag tag);
+
+    /**
+     * @brief Get the memory held by every tag
+     * @return std::array<TagStats, TAG_COUNT> Indexed by Tag
+     */
+    [[nodiscard]] std::array<TagStats, TAG_COUNT> getAllTagStats();
+
+    /**
+     * @brief Get the live bytes of every tag together
+     * @return uint64_t Bytes allocated through operator new and not freed yet
+     */
+    [[nodiscard]] uint64_t getLiveBytes();
+
+    /**
+     * @brief Restart every high-water mark from the current live bytes
+     */
+    void resetPeaks();
+}
+
+#endif // ADS_CORE_ALLOCATION_COUNTER_H
@@ -0,0 +1,151 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file BackgroundSaver.cpp
+ * @brief Implementation of the background project saver
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "BackgroundSaver.h"
+
+#include <exception>
+#include <system_error>
+
+#include "ProjectJournal.h"
+#include "ProjectStorage.h"
+#include "TraceRecorder.h"
+
+namespace ADS::Core {
+
+    BackgroundSaver::BackgroundSaver()
+        : m_state(State::Idle),
+          m_target(nullptr),
+          m_generation(0),
+          m_progress(0.0f),
+          m_finished(false),
+          m_failed(false) {
+    }
+
+    BackgroundSaver::~BackgroundSaver() {
+        if (m_worker.joinable()) {
+            m_worker.join();
+        }
+    }
+
+    /**
+     * @brief Snapshot a project and begin writing it in the background
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The snapshot is taken here, on the caller's thread, so the worker
+     * never observes the live project mid-edit.
+     *
+     * @param project Live project; it is updated by poll() once saved
+     * @param path    Destination file (`.ads` or `.adsproj`)
+     * @return bool False if a save is already in progress
+     */
+    bool BackgroundSaver::start(Project& project, const std::filesystem::path& path) {
+        if (isBusy()) {
+            return false;
+        }
+
+        m_snapshot = project.snapshot();
+        m_target = &project;
+        m_generation = project.getGeneration();
+        m_path = path;
+        m_error.clear();
+        m_failed = false;
+        m_progress.store(0.0f, std::memory_order_relaxed);
+        m_finished.store(false, std::memory_order_relaxed);
+        m_state = State::Saving;
+
+        m_worker = std::thread(&BackgroundSaver::run, this);
+        return true;
+    }
+
+    void BackgroundSaver::run() {
+        TraceRecorder::setThreadName("Background saver");
+        try {
+            ProjectStorage::write(*m_snapshot, m_path, [this](float fraction) {
+                m_progress.store(fraction, std::memory_order_relaxed);
+            });
+        } catch (const std::exception& e) {
+            m_error = e.what();
+            m_failed = true;
+        }
+        m_finished.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Finish a completed save on the main thread
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A detached save still removes the journal next to the new file: its
+     * entries predate the snapshot and replaying them would roll the
+     * freshly written state back.
+     *
+     * @return bool True exactly once per save, on the call that finished it
+     */
+    bool BackgroundSaver::poll() {
+        if (m_state != State::Saving || !m_finished.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        m_worker.join();
+        m_snapshot.reset();
+
+        if (m_failed) {
+            m_state = State::Failed;
+        } else {
+            if (m_target != nullptr) {
+                ProjectStorage::markSaved(*m_target, m_path, m_target->getGeneration() == m_generation);
+            } else {
+                std::error_code error;
+                std::filesystem::remove(ProjectJournal::pathFor(m_path), error);
+            }
+            m_state = State::Succeeded;
+        }
+        m_target = nullptr;
+        return true;
+    }
+
+    void BackgroundSaver::detach() {
+        m_target = nullptr;
+    }
+
+    bool BackgroundSaver::isBusy() const {
+        return m_state == State::Saving;
+    }
+
+    BackgroundSaver::State BackgroundSaver::getState() const {
+        return m_state;
+    }
+
+    float BackgroundSaver::getProgress() const {
+        return m_progress.load(std::memory_order_relaxed);
+    }
+
+    const std::filesystem::path& BackgroundSaver::getPath() const {
+        return m_path;
+    }
+
+    const std::string& BackgroundSaver::getError() const {
+        return m_error;
+    }
+
+} // namespace ADS::Core
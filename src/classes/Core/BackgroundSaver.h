@@ -0,0 +1,166 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_BACKGROUND_SAVER_H
+#define ADS_CORE_BACKGROUND_SAVER_H
+
+/**
+ * @file BackgroundSaver.h
+ * @brief Saves a project on a worker thread while editing continues
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The live project is never touched by the worker: start() takes a
+ * Project::snapshot() on the calling thread and the worker serialises that
+ * copy. Only the serialising is off the main thread; the snapshot itself
+ * copies every entity and takes time in proportion to the project. Completion is picked up by poll() on the main thread, which is the
+ * only place the live project is updated.
+ *
+ * @see ADS::Core::ProjectStorage
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Runs one full project save at a time off the main thread
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * All public methods must be called from the main thread. The worker
+     * only publishes its progress and a finished flag through atomics; the
+     * error text is read after the flag has been observed.
+     */
+    class BackgroundSaver {
+    public:
+        /**
+         * @brief Lifecycle of the most recent save
+         */
+        enum class State : uint8_t {
+            Idle,       ///< No save has been started yet
+            Saving,     ///< Worker is writing the snapshot
+            Succeeded,  ///< Last save completed
+            Failed      ///< Last save threw; see getError()
+        };
+
+        BackgroundSaver();
+
+        /**
+         * @brief Wait for a running save before destruction
+         *
+         * Joining here guarantees the file is either fully written or left
+         * at its previous version when the application shuts down.
+         */
+        ~BackgroundSaver();
+
+        BackgroundSaver(const BackgroundSaver&) = delete;
+        BackgroundSaver& operator=(const BackgroundSaver&) = delete;
+
+        /**
+         * @brief Snapshot a project and begin writing it in the background
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Blocks for the O(entities) copy made by Project::snapshot().
+         *
+         * @param project Live project; it is updated by poll() once saved
+         * @param path    Destination file (`.ads` or `.adsproj`)
+         * @return bool False if a save is already in progress
+         */
+        bool start(Project& project, const std::filesystem::path& path);
+
+        /**
+         * @brief Finish a completed save on the main thread
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Joins the worker and, on success, hands the live project to
+         * ProjectStorage::markSaved(). Its dirty set is cleared only when
+         * the generation is still the one that was snapshotted, so edits made
+         * during the save stay pending for the next save or autosave.
+         *
+         * @return bool True exactly once per save, on the call that finished it
+         */
+        bool poll();
+
+        /**
+         * @brief Forget the live project of the running save
+         *
+         * Must be called before that project is destroyed. The write still
+         * completes, but poll() will then only discard the stale journal.
+         */
+        void detach();
+
+        /**
+         * @brief Check whether a save is in progress
+         *
+         * @return bool True from start() until the poll() that finishes it
+         */
+        [[nodiscard]] bool isBusy() const;
+
+        /**
+         * @brief Get the state of the most recent save
+         * @return State Current state
+         */
+        [[nodiscard]] State getState() const;
+
+        /**
+         * @brief Get the completed fraction of the running save
+         * @return float Value in [0, 1]
+         */
+        [[nodiscard]] float getProgress() const;
+
+        /**
+         * @brief Get the destination of the most recent save
+         * @return const std::filesystem::path& Target path
+         */
+        [[nodiscard]] const std::filesystem::path& getPath() const;
+
+        /**
+         * @brief Get the failure reason of the most recent save
+         * @return const std::string& Exception message, empty unless Failed
+         */
+        [[nodiscard]] const std::string& getError() const;
+
+    private:
+        /**
+         * @brief Worker body: serialise the snapshot and publish the result
+         */
+        void run();
+
+        State m_state;                          ///< Main-thread view of the save lifecycle
+        std::thread m_worker;                   ///< Thread writing m_snapshot
+        std::unique_ptr<Project> m_snapshot;    ///< Copy owned by the worker while saving
+        Project* m_target;                      ///< Live project to update, nullptr once detached
+        uint64_t m_generation;                  ///< Generation of m_target when snapshotted
+        std::filesystem::path m_path;           ///< Destination file
+        std::string m_error;                    ///< Written by the worker before m_finished
+        std::atomic<float> m_progress;          ///< Completed fraction, written by the worker
+        std::atomic<bool> m_finished;           ///< Set by the worker as its last action
+        bool m_failed;                          ///< Written by the worker before m_finished
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_BACKGROUND_SAVER_H
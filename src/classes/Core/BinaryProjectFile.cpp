@@ -0,0 +1,454 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file BinaryProjectFile.cpp
+ * @brief Implementation of the binary project container
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "BinaryProjectFile.h"
+
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "MappedTextSource.h"
+#include "filesystem/file_not_found_exception.h"
+#include "filesystem/file_not_open_exception.h"
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+    using namespace BinaryFormat;
+
+    StringRef StringTableBuilder::add(std::string_view text) {
+        const size_t hash = std::hash<std::string_view>{}(text);
+        const auto [first, last] = m_refs.equal_range(hash);
+        for (auto it = first; it != last; ++it) {
+            if (std::string_view(m_data).substr(it->second.offset, it->second.length) == text) {
+                return it->second;
+            }
+        }
+        const StringRef ref{static_cast<uint32_t>(m_data.size()), static_cast<uint32_t>(text.size())};
+        m_data.append(text);
+        m_refs.emplace(hash, ref);
+        return ref;
+    }
+
+    const std::string& StringTableBuilder::data() const {
+        return m_data;
+    }
+
+    std::string_view BinaryFormat::resolveString(std::string_view table, StringRef ref) {
+        if (ref.offset > table.size() || ref.length > table.size() - ref.offset) {
+            throw Exceptions::project_format_exception("String reference outside the string table");
+        }
+        return table.substr(ref.offset, ref.length);
+    }
+
+    SceneRecord BinaryFormat::encode(const Entities::Scene& scene, StringTableBuilder& strings) {
+        const ImVec4& color = scene.getBackgroundColor();
+        return {
+            strings.add(scene.getId()),
+            strings.add(scene.getName()),
+            strings.add(*scene.getDescription()),
+            {color.x, color.y, color.z, color.w},
+            scene.getWidth(),
+            scene.getHeight(),
+            scene.isStartScene() ? uint32_t{FLAG_START_SCENE} : 0u,
+            0u
+        };
+    }
+
+    CharacterRecord BinaryFormat::encode(const Entities::Character& character, StringTableBuilder& strings) {
+        const ImVec4& color = character.getDialogColor();
+        return {
+            strings.add(character.getId()),
+            strings.add(character.getName()),
+            strings.add(*character.getDescription()),
+            {color.x, color.y, color.z, color.w},
+            character.getHealth(),
+            character.getMaxHealth(),
+            character.isPlayer() ? uint32_t{FLAG_PLAYER} : 0u,
+            0u
+        };
+    }
+
+    ItemRecord BinaryFormat::encode(const Entities::Item& item, StringTableBuilder& strings) {
+        uint32_t flags = 0;
+        if (item.isPickable()) flags |= FLAG_PICKABLE;
+        if (item.isUsable()) flags |= FLAG_USABLE;
+        return {
+            strings.add(item.getId()),
+            strings.add(item.getName()),
+            strings.add(*item.getDescription()),
+            item.getQuantity(),
+            item.getItemType(),
+            flags,
+            0u
+        };
+    }
+
+    /**
+     * @brief Set or bind an entity description from a string table reference
+     */
+    template<typename Entity>
+    static void applyDescription(StringRef ref, std::string_view table, Entity& target,
+                                 const std::shared_ptr<Entities::TextSource>& lazyText, StringPool* pool) {
+        const std::string_view text = resolveString(table, ref);
+        if (lazyText && ref.length >= LAZY_TEXT_MIN_BYTES) {
+            target.bindDescription(lazyText, packStringRef(ref));
+        } else if (pool != nullptr) {
+            target.shareDescription(pool->intern(text));
+        } else {
+            target.setDescription(std::string(text));
+        }
+    }
+
+    void BinaryFormat::apply(const SceneRecord& record, std::string_view table, Entities::Scene& target,
+                             const std::shared_ptr<Entities::TextSource>& lazyText, StringPool* pool) {
+        target.setName(std::string(resolveString(table, record.name)));
+        applyDescription(record.description, table, target, lazyText, pool);
+        target.setStartScene((record.flags & FLAG_START_SCENE) != 0);
+        target.setBackgroundColor(ImVec4(record.backgroundColor[0], record.backgroundColor[1],
+                                         record.backgroundColor[2], record.backgroundColor[3]));
+        target.setWidth(record.width);
+        target.setHeight(record.height);
+    }
+
+    void BinaryFormat::apply(const CharacterRecord& record, std::string_view table, Entities::Character& target,
+                             const std::shared_ptr<Entities::TextSource>& lazyText, StringPool* pool) {
+        target.setName(std::string(resolveString(table, record.name)));
+        applyDescription(record.description, table, target, lazyText, pool);
+        target.setPlayer((record.flags & FLAG_PLAYER) != 0);
+        target.setDialogColor(ImVec4(record.dialogColor[0], record.dialogColor[1],
+                                     record.dialogColor[2], record.dialogColor[3]));
+        target.setMaxHealth(record.maxHealth);
+        target.setHealth(record.health);
+    }
+
+    void BinaryFormat::apply(const ItemRecord& record, std::string_view table, Entities::Item& target,
+                             const std::shared_ptr<Entities::TextSource>& lazyText, StringPool* pool) {
+        target.setName(std::string(resolveString(table, record.name)));
+        applyDescription(record.description, table, target, lazyText, pool);
+        target.setPickable((record.flags & FLAG_PICKABLE) != 0);
+        target.setUsable((record.flags & FLAG_USABLE) != 0);
+        target.setQuantity(record.quantity);
+        target.setItemType(record.itemType);
+    }
+
+    /**
+     * @brief Map a binary project file for reading
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Checks the file exists and is large enough to hold a header before
+     * mapping it, since boost::interprocess refuses to map empty files.
+     *
+     * @param path Path to an existing `.ads` file
+     */
+    BinaryProjectFile::BinaryProjectFile(const std::filesystem::path& path) : m_path(path) {
+        if (!std::filesystem::exists(path)) {
+            throw Exceptions::file_not_found_exception(std::format("Project file not found: {}", path.string()));
+        }
+        if (std::filesystem::file_size(path) < sizeof(FileHeader)) {
+            throw Exceptions::project_format_exception(std::format("File too small to be a project: {}", path.string()));
+        }
+
+        m_mapping = boost::interprocess::file_mapping(path.string().c_str(), boost::interprocess::read_only);
+        m_region = boost::interprocess::mapped_region(m_mapping, boost::interprocess::read_only);
+        m_base = static_cast<const std::byte*>(m_region.get_address());
+        m_size = m_region.get_size();
+
+        validate();
+    }
+
+    /**
+     * @brief Validate the header and resolve every section in the directory
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Rejects files with a foreign signature, byte order or major version,
+     * truncated files, and directory entries whose range falls outside the
+     * mapping or whose size does not match the record count.
+     */
+    void BinaryProjectFile::validate() {
+        m_header = reinterpret_cast<const FileHeader*>(m_base);
+
+        if (std::memcmp(m_header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw Exceptions::project_format_exception("Not an ADS binary project (bad magic)");
+        }
+        if (m_header->byteOrderMark != BYTE_ORDER_MARK) {
+            throw Exceptions::project_format_exception("Project was written with a different byte order");
+        }
+        if (m_header->versionMajor != VERSION_MAJOR) {
+            throw Exceptions::project_format_exception(
+                std::format("Unsupported project version {}.{}", m_header->versionMajor, m_header->versionMinor));
+        }
+        if (m_header->fileSize != m_size) {
+            throw Exceptions::project_format_exception("Project file is truncated");
+        }
+
+        const uint64_t directoryEnd = sizeof(FileHeader) + uint64_t{m_header->sectionCount} * sizeof(SectionEntry);
+        if (directoryEnd > m_size) {
+            throw Exceptions::project_format_exception("Offset directory exceeds file size");
+        }
+
+        const auto* sections = reinterpret_cast<const SectionEntry*>(m_base + sizeof(FileHeader));
+        for (uint32_t i = 0; i < m_header->sectionCount; ++i) {
+            const SectionEntry& section = sections[i];
+            if (section.offset < directoryEnd || section.offset > m_size || section.size > m_size - section.offset) {
+                throw Exceptions::project_format_exception(std::format("Section {} lies outside the file", i));
+            }
+
+            const std::byte* start = m_base + section.offset;
+            auto checkRecords = [&section, i](size_t recordSize, size_t alignment) {
+                if (section.size != uint64_t{section.count} * recordSize || section.offset % alignment != 0) {
+                    throw Exceptions::project_format_exception(std::format("Section {} has an invalid record layout", i));
+                }
+            };
+
+            switch (section.kind) {
+                case SectionKind::Strings:
+                    m_strings = std::string_view(reinterpret_cast<const char*>(start), section.size);
+                    break;
+                case SectionKind::Scenes:
+                    checkRecords(sizeof(SceneRecord), alignof(SceneRecord));
+                    m_scenes = {reinterpret_cast<const SceneRecord*>(start), section.count};
+                    break;
+                case SectionKind::Characters:
+                    checkRecords(sizeof(CharacterRecord), alignof(CharacterRecord));
+                    m_characters = {reinterpret_cast<const CharacterRecord*>(start), section.count};
+                    break;
+                case SectionKind::Items:
+                    checkRecords(sizeof(ItemRecord), alignof(ItemRecord));
+                    m_items = {reinterpret_cast<const ItemRecord*>(start), section.count};
+                    break;
+                case SectionKind::Exits:
+                    checkRecords(sizeof(ExitRecord), alignof(ExitRecord));
+                    m_exits = {reinterpret_cast<const ExitRecord*>(start), section.count};
+                    break;
+                default:
+                    // Unknown sections come from newer minor versions and are skipped
+                    break;
+            }
+        }
+    }
+
+    /**
+     * @brief Resolve a string reference against the string table
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * References are validated lazily, on access, so opening a file never
+     * walks every record.
+     *
+     * @param ref Reference read from a record
+     * @return std::string_view View into the mapped string table
+     */
+    std::string_view BinaryProjectFile::getString(StringRef ref) const {
+        return resolveString(m_strings, ref);
+    }
+
+    const std::filesystem::path& BinaryProjectFile::getPath() const {
+        return m_path;
+    }
+
+    std::string_view BinaryProjectFile::getStringTable() const {
+        return m_strings;
+    }
+
+    std::string_view BinaryProjectFile::getProjectName() const {
+        return getString(m_header->projectName);
+    }
+
+    std::span<const SceneRecord> BinaryProjectFile::getScenes() const {
+        return m_scenes;
+    }
+
+    std::span<const CharacterRecord> BinaryProjectFile::getCharacters() const {
+        return m_characters;
+    }
+
+    std::span<const ItemRecord> BinaryProjectFile::getItems() const {
+        return m_items;
+    }
+
+    std::span<const ExitRecord> BinaryProjectFile::getExits() const {
+        return m_exits;
+    }
+
+    /**
+     * @brief Materialise a Project from the mapped records
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Records with an id that is already present in the project are skipped,
+     * mirroring the duplicate handling of Project::addScene() and friends.
+     * Exits are linked once every scene exists, by the ids of the records
+     * they point at.
+     *
+     * @param path     Path stored on the project as its file path
+     * @param lazyText Optional source for large descriptions
+     * @return std::unique_ptr<Project> Newly built project
+     */
+    std::unique_ptr<Project> BinaryProjectFile::toProject(const std::filesystem::path& path,
+                                                          const std::shared_ptr<Entities::TextSource>& lazyText) const {
+        auto project = std::make_unique<Project>(std::string(getProjectName()));
+
+        for (const SceneRecord& record : m_scenes) {
+            if (Entities::Scene* scene = project->addScene(std::string(getString(record.id)), std::string(getString(record.name)))) {
+                apply(record, m_strings, *scene, lazyText, &project->getStringPool());
+            }
+        }
+
+        for (const CharacterRecord& record : m_characters) {
+            if (Entities::Character* character = project->addCharacter(std::string(getString(record.id)), std::string(getString(record.name)))) {
+                apply(record, m_strings, *character, lazyText, &project->getStringPool());
+            }
+        }
+
+        for (const ItemRecord& record : m_items) {
+            if (Entities::Item* item = project->addItem(std::string(getString(record.id)), std::string(getString(record.name)))) {
+                apply(record, m_strings, *item, lazyText, &project->getStringPool());
+            }
+        }
+
+        std::vector<std::pair<std::string_view, std::string_view>> exits;
+        exits.reserve(m_exits.size());
+        for (const ExitRecord& record : m_exits) {
+            if (record.from >= m_scenes.size() || record.to >= m_scenes.size()) {
+                throw Exceptions::project_format_exception("Scene exit refers to a missing scene record");
+            }
+            exits.emplace_back(getString(m_scenes[record.from].id), getString(m_scenes[record.to].id));
+        }
+        project->addExits(exits);
+
+        project->setFilePath(path);
+        project->clearDirty();
+        return project;
+    }
+
+    /**
+     * @brief Serialise a project to the binary container
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Sections are laid out back to back after the directory: scenes,
+     * characters, items, exits, then the string table. All record sizes are
+     * multiples of 8, so every record section stays naturally aligned.
+     *
+     * @param project  Project to serialise
+     * @param path     Destination `.ads` file
+     * @param progress Optional callback; the file write counts as the last step
+     */
+    void BinaryProjectFile::write(const Project& project, const std::filesystem::path& path,
+                                  const ProgressCallback& progress) {
+        StringTableBuilder strings;
+        const size_t totalSteps = project.getScenes().size() + project.getCharacters().size()
+            + project.getItems().size() + 1;
+        size_t done = 0;
+
+        // Handle index → position in the scene section, for the exit records
+        std::vector<uint32_t> scenePositions;
+        std::vector<SceneRecord> scenes;
+        scenes.reserve(project.getScenes().size());
+        for (const auto& scene : project.getScenes()) {
+            const uint32_t index = scene->getHandle().index();
+            if (index >= scenePositions.size()) {
+                scenePositions.resize(index + 1);
+            }
+            scenePositions[index] = static_cast<uint32_t>(scenes.size());
+            scenes.push_back(encode(*scene, strings));
+            reportProgress(progress, ++done, totalSteps);
+        }
+
+        std::vector<ExitRecord> exits;
+        for (const auto& scene : project.getScenes()) {
+            const uint32_t from = scenePositions[scene->getHandle().index()];
+            for (const Entities::Scene* target : project.getExits(*scene)) {
+                exits.push_back({from, scenePositions[target->getHandle().index()]});
+            }
+        }
+
+        std::vector<CharacterRecord> characters;
+        characters.reserve(project.getCharacters().size());
+        for (const auto& character : project.getCharacters()) {
+            characters.push_back(encode(*character, strings));
+            reportProgress(progress, ++done, totalSteps);
+        }
+
+        std::vector<ItemRecord> items;
+        items.reserve(project.getItems().size());
+        for (const auto& item : project.getItems()) {
+            items.push_back(encode(*item, strings));
+            reportProgress(progress, ++done, totalSteps);
+        }
+
+        FileHeader header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.versionMajor = VERSION_MAJOR;
+        header.versionMinor = VERSION_MINOR;
+        header.byteOrderMark = BYTE_ORDER_MARK;
+        header.sectionCount = 5;
+        header.projectName = strings.add(project.getName());
+
+        SectionEntry sections[5] = {
+            {SectionKind::Scenes, static_cast<uint32_t>(scenes.size()), 0, scenes.size() * sizeof(SceneRecord)},
+            {SectionKind::Characters, static_cast<uint32_t>(characters.size()), 0, characters.size() * sizeof(CharacterRecord)},
+            {SectionKind::Items, static_cast<uint32_t>(items.size()), 0, items.size() * sizeof(ItemRecord)},
+            {SectionKind::Exits, static_cast<uint32_t>(exits.size()), 0, exits.size() * sizeof(ExitRecord)},
+            {SectionKind::Strings, static_cast<uint32_t>(strings.data().size()), 0, strings.data().size()}
+        };
+        uint64_t offset = sizeof(FileHeader) + sizeof(sections);
+        for (SectionEntry& section : sections) {
+            section.offset = offset;
+            offset += section.size;
+        }
+        header.fileSize = offset;
+
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                throw Exceptions::file_not_open_exception(std::format("Cannot write project file: {}", tempPath.string()));
+            }
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(sections), sizeof(sections));
+            out.write(reinterpret_cast<const char*>(scenes.data()), static_cast<std::streamsize>(sections[0].size));
+            out.write(reinterpret_cast<const char*>(characters.data()), static_cast<std::streamsize>(sections[1].size));
+            out.write(reinterpret_cast<const char*>(items.data()), static_cast<std::streamsize>(sections[2].size));
+            out.write(reinterpret_cast<const char*>(exits.data()), static_cast<std::streamsize>(sections[3].size));
+            out.write(strings.data().data(), static_cast<std::streamsize>(sections[4].size));
+            if (!out.good()) {
+                throw Exceptions::file_not_open_exception(std::format("Failed while writing project file: {}", tempPath.string()));
+            }
+        }
+        // Entities loaded from the old file may still read it through its mapping
+        MappedTextSource::release(path);
+        std::filesystem::rename(tempPath, path);
+        reportProgress(progress, totalSteps, totalSteps);
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,411 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_BINARY_PROJECT_FILE_H
+#define ADS_CORE_BINARY_PROJECT_FILE_H
+
+/**
+ * @file BinaryProjectFile.h
+ * @brief Versioned, memory-mappable binary container for projects
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The `.ads` container is laid out so it can be used in place once mapped:
+ *
+ *   [FileHeader][SectionEntry × sectionCount][records ...][string table]
+ *
+ * Every entity is stored as a fixed-size record whose strings are StringRef
+ * offsets into a single deduplicated string table. Opening a file therefore
+ * costs a header read plus the page faults for whichever records are touched,
+ * instead of a full parse.
+ *
+ * @see ADS::Core::Project
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "Project.h"
+#include "ProgressCallback.h"
+
+namespace ADS::Core {
+
+    namespace BinaryFormat {
+        inline constexpr char MAGIC[4] = {'A', 'D', 'S', 'B'}; ///< File signature
+        inline constexpr uint16_t VERSION_MAJOR = 1;            ///< Bumped on incompatible layout changes
+        inline constexpr uint16_t VERSION_MINOR = 1;            ///< Bumped on backwards-compatible additions
+        inline constexpr uint32_t BYTE_ORDER_MARK = 0x01020304; ///< Detects files written on another endianness
+
+        /**
+         * @brief Section identifiers stored in the offset directory
+         */
+        enum class SectionKind : uint32_t {
+            Strings    = 1,
+            Scenes     = 2,
+            Characters = 3,
+            Items      = 4,
+            Exits      = 5     ///< Since 1.1; older readers skip it
+        };
+
+        /**
+         * @brief Entity flag bits packed into the record `flags` field
+         */
+        enum RecordFlags : uint32_t {
+            FLAG_START_SCENE = 1u << 0,
+            FLAG_PLAYER      = 1u << 1,
+            FLAG_PICKABLE    = 1u << 2,
+            FLAG_USABLE      = 1u << 3
+        };
+
+        /**
+         * @brief Reference to a UTF-8 string inside the string table
+         */
+        struct StringRef {
+            uint32_t offset;    ///< Byte offset from the start of the string table
+            uint32_t length;    ///< Length in bytes, without terminator
+        };
+
+        /**
+         * @brief Fixed-size header at offset 0
+         */
+        struct FileHeader {
+            char magic[4];              ///< Always MAGIC
+            uint16_t versionMajor;      ///< Layout major version
+            uint16_t versionMinor;      ///< Layout minor version
+            uint32_t byteOrderMark;     ///< Always BYTE_ORDER_MARK in native order
+            uint32_t sectionCount;      ///< Number of SectionEntry following the header
+            StringRef projectName;      ///< Project display name
+            uint64_t fileSize;          ///< Total size, used to detect truncation
+        };
+
+        /**
+         * @brief One entry of the offset directory
+         */
+        struct SectionEntry {
+            SectionKind kind;           ///< What the section contains
+            uint32_t count;             ///< Number of records (bytes for Strings)
+            uint64_t offset;            ///< Absolute byte offset of the section
+            uint64_t size;              ///< Section size in bytes
+        };
+
+        /**
+         * @brief On-disk representation of a Scene
+         */
+        struct SceneRecord {
+            StringRef id;
+            StringRef name;
+            StringRef description;
+            float backgroundColor[4];
+            int32_t width;
+            int32_t height;
+            uint32_t flags;
+            uint32_t reserved;
+        };
+
+        /**
+         * @brief On-disk representation of a Character
+         */
+        struct CharacterRecord {
+            StringRef id;
+            StringRef name;
+            StringRef description;
+            float dialogColor[4];
+            int32_t health;
+            int32_t maxHealth;
+            uint32_t flags;
+            uint32_t reserved;
+        };
+
+        /**
+         * @brief On-disk representation of an Item
+         */
+        struct ItemRecord {
+            StringRef id;
+            StringRef name;
+            StringRef description;
+            int32_t quantity;
+            int32_t itemType;
+            uint32_t flags;
+            uint32_t reserved;
+        };
+
+        /**
+         * @brief Scene exit, as positions in the scene section
+         */
+        struct ExitRecord {
+            uint32_t from;      ///< Index of the source SceneRecord
+            uint32_t to;        ///< Index of the target SceneRecord
+        };
+
+        static_assert(sizeof(FileHeader) == 32, "FileHeader layout changed");
+        static_assert(sizeof(SectionEntry) == 24, "SectionEntry layout changed");
+        static_assert(sizeof(SceneRecord) == 56, "SceneRecord layout changed");
+        static_assert(sizeof(CharacterRecord) == 56, "CharacterRecord layout changed");
+        static_assert(sizeof(ItemRecord) == 40, "ItemRecord layout changed");
+        static_assert(sizeof(ExitRecord) == 8, "ExitRecord layout changed");
+
+        /**
+         * @brief Collects unique strings and hands out StringRef offsets
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Identical strings (ids reused as names, empty descriptions, ...) are
+         * stored once. Strings are keyed by hash and compared against the
+         * bytes already copied into the table, so callers' strings do not
+         * need to outlive the call; lazily loaded descriptions rely on this.
+         */
+        class StringTableBuilder {
+        private:
+            std::string m_data;
+            std::unordered_multimap<size_t, StringRef> m_refs;
+
+        public:
+            /**
+             * @brief Intern a string and return its reference
+             *
+             * @param text String to store; copied, so it may be a temporary
+             * @return StringRef Offset and length inside data()
+             */
+            StringRef add(std::string_view text);
+
+            /**
+             * @brief Get the accumulated string table bytes
+             */
+            [[nodiscard]] const std::string& data() const;
+        };
+
+        /**
+         * @brief Resolve a string reference against a string table
+         *
+         * @param table String table bytes
+         * @param ref   Reference read from a record
+         * @return std::string_view View into @p table
+         * @throws Exceptions::project_format_exception if the reference is out of range
+         */
+        [[nodiscard]] std::string_view resolveString(std::string_view table, StringRef ref);
+
+        /// Descriptions at least this long are bound lazily when a TextSource is supplied
+        inline constexpr uint32_t LAZY_TEXT_MIN_BYTES = 256;
+
+        /**
+         * @brief Pack a string reference into a TextSource key
+         */
+        [[nodiscard]] constexpr uint64_t packStringRef(StringRef ref) {
+            return (static_cast<uint64_t>(ref.offset) << 32) | ref.length;
+        }
+
+        /**
+         * @brief Recover the string reference stored in a TextSource key
+         */
+        [[nodiscard]] constexpr StringRef unpackStringRef(uint64_t key) {
+            return {static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key)};
+        }
+
+        /// @name Record codecs shared by the container and the autosave journal
+        /// @{
+        [[nodiscard]] SceneRecord encode(const Entities::Scene& scene, StringTableBuilder& strings);
+        [[nodiscard]] CharacterRecord encode(const Entities::Character& character, StringTableBuilder& strings);
+        [[nodiscard]] ItemRecord encode(const Entities::Item& item, StringTableBuilder& strings);
+
+        /**
+         * @brief Copy every field of a record except the id onto an entity
+         *
+         * With @p lazyText set, descriptions of at least LAZY_TEXT_MIN_BYTES
+         * are bound to that source instead of being copied; their bounds are
+         * still checked here so a later load cannot fail. With @p pool set,
+         * the descriptions that are copied are shared through it.
+         *
+         * @param record   Decoded record
+         * @param table    String table the record's references point into
+         * @param target   Entity receiving the values (its setters fire events)
+         * @param lazyText Optional source serving @p table keyed by packStringRef()
+         * @param pool     Optional pool for the copied descriptions, usually the target's project's
+         */
+        void apply(const SceneRecord& record, std::string_view table, Entities::Scene& target,
+                   const std::shared_ptr<Entities::TextSource>& lazyText = nullptr, StringPool* pool = nullptr);
+        void apply(const CharacterRecord& record, std::string_view table, Entities::Character& target,
+                   const std::shared_ptr<Entities::TextSource>& lazyText = nullptr, StringPool* pool = nullptr);
+        void apply(const ItemRecord& record, std::string_view table, Entities::Item& target,
+                   const std::shared_ptr<Entities::TextSource>& lazyText = nullptr, StringPool* pool = nullptr);
+        /// @}
+    }
+
+    /**
+     * @brief Read-only, memory-mapped view over a binary project file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The constructor maps the file and validates the header and the offset
+     * directory; records and strings are only paged in when accessed. Use
+     * toProject() to materialise a Core::Project, or write() to produce a file.
+     * The view keeps the mapping alive, so std::string_view values returned by
+     * getString() remain valid for the lifetime of the object.
+     */
+    class BinaryProjectFile {
+    private:
+        std::filesystem::path m_path;                       ///< File the mapping was opened from
+        boost::interprocess::file_mapping m_mapping;        ///< OS file mapping handle
+        boost::interprocess::mapped_region m_region;        ///< Mapped read-only view of the whole file
+        const std::byte* m_base = nullptr;                  ///< Start of the mapped bytes
+        size_t m_size = 0;                                  ///< Size of the mapped bytes
+        const BinaryFormat::FileHeader* m_header = nullptr; ///< Validated header
+        std::string_view m_strings;                         ///< String table section
+        std::span<const BinaryFormat::SceneRecord> m_scenes;         ///< Scene records section
+        std::span<const BinaryFormat::CharacterRecord> m_characters; ///< Character records section
+        std::span<const BinaryFormat::ItemRecord> m_items;           ///< Item records section
+        std::span<const BinaryFormat::ExitRecord> m_exits;           ///< Scene exits section, empty before 1.1
+
+        /**
+         * @brief Validate the header and resolve every section in the directory
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @throws Exceptions::project_format_exception on any inconsistency
+         */
+        void validate();
+
+    public:
+        /**
+         * @brief Map a binary project file for reading
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Maps the whole file read-only and validates its header and offset
+         * directory. No entity data is decoded at this point.
+         *
+         * @param path Path to an existing `.ads` file
+         * @throws Exceptions::file_not_found_exception if the file does not exist
+         * @throws Exceptions::project_format_exception if the file is malformed
+         */
+        explicit BinaryProjectFile(const std::filesystem::path& path);
+
+        // Non-copyable (owns the mapping)
+        BinaryProjectFile(const BinaryProjectFile&) = delete;
+        BinaryProjectFile& operator=(const BinaryProjectFile&) = delete;
+
+        /**
+         * @brief Resolve a string reference against the string table
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param ref Reference read from a record
+         * @return std::string_view View into the mapped string table
+         * @throws Exceptions::project_format_exception if the reference is out of range
+         */
+        [[nodiscard]] std::string_view getString(BinaryFormat::StringRef ref) const;
+
+        /**
+         * @brief Get the path the file was mapped from
+         *
+         * @return const std::filesystem::path& Path given to the constructor
+         */
+        [[nodiscard]] const std::filesystem::path& getPath() const;
+
+        /**
+         * @brief Get the whole string table, which StringRef offsets index
+         *
+         * @return std::string_view View into the mapped string table
+         */
+        [[nodiscard]] std::string_view getStringTable() const;
+
+        /**
+         * @brief Get the stored project display name
+         *
+         * @return std::string_view View into the mapped string table
+         */
+        [[nodiscard]] std::string_view getProjectName() const;
+
+        /**
+         * @brief Get the mapped scene records
+         *
+         * @return std::span<const BinaryFormat::SceneRecord> Records in file order
+         */
+        [[nodiscard]] std::span<const BinaryFormat::SceneRecord> getScenes() const;
+
+        /**
+         * @brief Get the mapped character records
+         *
+         * @return std::span<const BinaryFormat::CharacterRecord> Records in file order
+         */
+        [[nodiscard]] std::span<const BinaryFormat::CharacterRecord> getCharacters() const;
+
+        /**
+         * @brief Get the mapped item records
+         *
+         * @return std::span<const BinaryFormat::ItemRecord> Records in file order
+         */
+        [[nodiscard]] std::span<const BinaryFormat::ItemRecord> getItems() const;
+
+        /**
+         * @brief Get the mapped scene exit records
+         *
+         * @return std::span<const BinaryFormat::ExitRecord> Records in file order
+         */
+        [[nodiscard]] std::span<const BinaryFormat::ExitRecord> getExits() const;
+
+        /**
+         * @brief Materialise a Project from the mapped records
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Creates a new Project holding one entity per record. Without
+         * @p lazyText the project does not depend on the mapping and outlives
+         * this object; otherwise large descriptions are loaded through the
+         * source, which is expected to keep the mapping alive.
+         *
+         * @param path     Path stored on the project as its file path
+         * @param lazyText Optional source for large descriptions, e.g. a MappedTextSource
+         * @return std::unique_ptr<Project> Newly built project
+         */
+        [[nodiscard]] std::unique_ptr<Project> toProject(const std::filesystem::path& path,
+                                                         const std::shared_ptr<Entities::TextSource>& lazyText = nullptr) const;
+
+        /**
+         * @brief Serialise a project to the binary container
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Builds a deduplicated string table and writes the header, the offset
+         * directory and every record to a sibling temporary file, which is then
+         * renamed over @p path so an interrupted save never leaves a truncated
+         * project behind. Windows refuses to replace a mapped file, so every
+         * MappedTextSource still reading @p path is released first.
+         *
+         * @param project  Project to serialise
+         * @param path     Destination `.ads` file
+         * @param progress Optional callback, invoked as records are encoded
+         * @throws Exceptions::file_not_open_exception if the file cannot be written
+         */
+        static void write(const Project& project, const std::filesystem::path& path,
+                          const ProgressCallback& progress = {});
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_BINARY_PROJECT_FILE_H
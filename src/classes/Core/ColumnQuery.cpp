@@ -0,0 +1,385 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ColumnQuery.cpp
+ * @brief Implementation of the ColumnQuery class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The loops below are written for the auto-vectoriser: no branches on the
+ * data, no early exits, and float sums split over LANES independent
+ * accumulators, since a single accumulator would force the additions into
+ * source order.
+ */
+
+#include "ColumnQuery.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include "Profiling.h"
+
+namespace ADS::Core {
+
+    namespace {
+        /// Independent accumulators of the float sums
+        constexpr size_t LANES = 8;
+
+        /**
+         * @brief Call a function with the std comparison object of a Compare
+         */
+        template<typename Function>
+        void withComparison(const Compare compare, Function&& function) {
+            switch (compare) {
+                case Compare::Less:         function(std::less<>{}); break;
+                case Compare::LessEqual:    function(std::less_equal<>{}); break;
+                case Compare::Equal:        function(std::equal_to<>{}); break;
+                case Compare::NotEqual:     function(std::not_equal_to<>{}); break;
+                case Compare::GreaterEqual: function(std::greater_equal<>{}); break;
+                case Compare::Greater:      function(std::greater<>{}); break;
+            }
+        }
+
+        /**
+         * @brief AND the comparison of each value against a threshold into the mask
+         */
+        template<typename T, typename U>
+        void narrow(std::vector<uint8_t>& mask, const T* values, const Compare compare, const U threshold) {
+            uint8_t* selected = mask.data();
+            const size_t rows = mask.size();
+            withComparison(compare, [&](auto op) {
+                for (size_t i = 0; i < rows; ++i) {
+                    selected[i] &= static_cast<uint8_t>(op(static_cast<U>(values[i]), threshold));
+                }
+            });
+        }
+
+        /**
+         * @brief AND the comparison of two columns, row by row, into the mask
+         */
+        template<typename W, typename L, typename R>
+        void narrowColumns(std::vector<uint8_t>& mask, const L* left, const Compare compare, const R* right) {
+            uint8_t* selected = mask.data();
+            const size_t rows = mask.size();
+            withComparison(compare, [&](auto op) {
+                for (size_t i = 0; i < rows; ++i) {
+                    selected[i] &= static_cast<uint8_t>(op(static_cast<W>(left[i]), static_cast<W>(right[i])));
+                }
+            });
+        }
+
+        /**
+         * @brief The value of a row if it is selected, the fallback otherwise, without a branch
+         */
+        inline int32_t pick(const uint8_t selected, const int32_t value, const int32_t otherwise) {
+            const int32_t keep = -static_cast<int32_t>(selected);
+            return (value & keep) | (otherwise & ~keep);
+        }
+
+        /**
+         * @brief Map a float to an int32 that sorts in the same order, -0 just below +0
+         */
+        inline int32_t orderedKey(const float value) {
+            const int32_t bits = std::bit_cast<int32_t>(value);
+            return bits ^ ((bits >> 31) & std::numeric_limits<int32_t>::max());
+        }
+
+        inline float fromOrderedKey(const int32_t key) {
+            return std::bit_cast<float>(key ^ ((key >> 31) & std::numeric_limits<int32_t>::max()));
+        }
+
+        inline float pick(const uint8_t selected, const float value, const float otherwise) {
+            const uint32_t keep = 0u - selected;
+            return std::bit_cast<float>((std::bit_cast<uint32_t>(value) & keep) | (std::bit_cast<uint32_t>(otherwise) & ~keep));
+        }
+
+        /**
+         * @brief Outcome of rewriting a comparison against a real number as one against an integer
+         */
+        enum class IntThreshold {
+            Compare,    ///< Compare against the rewritten threshold
+            All,        ///< Every integer passes
+            None        ///< No integer passes
+        };
+
+        /**
+         * @brief Turn `x <op> value` over int32 x into an exact `x <op> threshold`
+         *
+         * `x < 2.5` is `x < 3` and `x <= 2.5` is `x <= 2`; equality with a
+         * fraction never holds. Thresholds beyond the int32 range decide
+         * the comparison for every row.
+         */
+        IntThreshold toIntThreshold(const Compare compare, const double value, int32_t& threshold) {
+            if (std::isnan(value)) {
+                return compare == Compare::NotEqual ? IntThreshold::All : IntThreshold::None;
+            }
+            double rounded = value;
+            switch (compare) {
+                case Compare::Less:
+                case Compare::GreaterEqual:
+                    rounded = std::ceil(value);
+                    break;
+                case Compare::LessEqual:
+                case Compare::Greater:
+                    rounded = std::floor(value);
+                    break;
+                case Compare::Equal:
+                case Compare::NotEqual:
+                    if (std::floor(value) != value) {
+                        return compare == Compare::NotEqual ? IntThreshold::All : IntThreshold::None;
+                    }
+                    break;
+            }
+            const bool below = compare == Compare::Less || compare == Compare::LessEqual;
+            if (rounded > static_cast<double>(std::numeric_limits<int32_t>::max())) {
+                return below || compare == Compare::NotEqual ? IntThreshold::All : IntThreshold::None;
+            }
+            if (rounded < static_cast<double>(std::numeric_limits<int32_t>::min())) {
+                return below || compare == Compare::Equal ? IntThreshold::None : IntThreshold::All;
+            }
+            threshold = static_cast<int32_t>(rounded);
+            return IntThreshold::Compare;
+        }
+    }
+
+    std::optional<ColumnFilter> ColumnFilter::parse(std::string_view term) {
+        ColumnFilter filter;
+        bool negated = false;
+        if (term.starts_with('!')) {
+            negated = true;
+            term.remove_prefix(1);
+        }
+
+        size_t end = 0;
+        while (end < term.size()
+               && (std::isalpha(static_cast<unsigned char>(term[end])) || term[end] == '_'
+                   || (end > 0 && std::isdigit(static_cast<unsigned char>(term[end]))))) {
+            ++end;
+        }
+        if (end == 0) {
+            return std::nullopt;
+        }
+        filter.property = std::string(term.substr(0, end));
+        std::string_view rest = term.substr(end);
+        if (rest.empty()) {
+            filter.compare = negated ? Compare::Equal : Compare::NotEqual;
+            return filter;
+        }
+        if (negated) {
+            return std::nullopt;
+        }
+
+        static constexpr std::array<std::pair<std::string_view, Compare>, 7> OPERATORS = {{
+            {"<=", Compare::LessEqual}, {">=", Compare::GreaterEqual}, {"!=", Compare::NotEqual},
+            {"==", Compare::Equal}, {"<", Compare::Less}, {">", Compare::Greater}, {"=", Compare::Equal}
+        }};
+        const auto op = std::find_if(OPERATORS.begin(), OPERATORS.end(), [rest](const auto& entry) {
+            return rest.starts_with(entry.first);
+        });
+        if (op == OPERATORS.end()) {
+            return std::nullopt;
+        }
+        filter.compare = op->second;
+        rest.remove_prefix(op->first.size());
+
+        if (rest == "true") {
+            filter.value = 1.0;
+        } else if (rest == "false") {
+            filter.value = 0.0;
+        } else {
+            const auto [last, error] = std::from_chars(rest.data(), rest.data() + rest.size(), filter.value);
+            if (error != std::errc() || last != rest.data() + rest.size()) {
+                return std::nullopt;
+            }
+        }
+        return filter;
+    }
+
+    ColumnQuery::ColumnQuery(const PropertyColumns& columns)
+        : m_columns(&columns),
+          m_mask(columns.getLiveRows().begin(), columns.getLiveRows().end()) {
+    }
+
+    ColumnQuery& ColumnQuery::where(const std::string_view property, const Compare compare, const double value) {
+        ADS_ZONE("ColumnQuery::where");
+        const PropertyColumns::Column* column = m_columns->findColumn(property);
+        if (column == nullptr) {
+            std::ranges::fill(m_mask, 0);
+            return *this;
+        }
+        if (column->isFloat) {
+            narrow(m_mask, column->floats.data(), compare, value);
+            return *this;
+        }
+        int32_t threshold = 0;
+        switch (toIntThreshold(compare, value, threshold)) {
+            case IntThreshold::Compare:
+                narrow(m_mask, column->ints.data(), compare, threshold);
+                break;
+            case IntThreshold::All:
+                break;
+            case IntThreshold::None:
+                std::ranges::fill(m_mask, 0);
+                break;
+        }
+        return *this;
+    }
+
+    ColumnQuery& ColumnQuery::where(const std::string_view property, const bool value) {
+        return where(property, value ? Compare::NotEqual : Compare::Equal, 0.0);
+    }
+
+    ColumnQuery& ColumnQuery::where(const ColumnFilter& filter) {
+        return where(filter.property, filter.compare, filter.value);
+    }
+
+    ColumnQuery& ColumnQuery::whereColumns(const std::string_view left, const Compare compare, const std::string_view right) {
+        ADS_ZONE("ColumnQuery::whereColumns");
+        const PropertyColumns::Column* l = m_columns->findColumn(left);
+        const PropertyColumns::Column* r = m_columns->findColumn(right);
+        if (l == nullptr || r == nullptr) {
+            std::ranges::fill(m_mask, 0);
+        } else if (!l->isFloat && !r->isFloat) {
+            narrowColumns<int32_t>(m_mask, l->ints.data(), compare, r->ints.data());
+        } else if (l->isFloat && r->isFloat) {
+            narrowColumns<float>(m_mask, l->floats.data(), compare, r->floats.data());
+        } else if (l->isFloat) {
+            narrowColumns<double>(m_mask, l->floats.data(), compare, r->ints.data());
+        } else {
+            narrowColumns<double>(m_mask, l->ints.data(), compare, r->floats.data());
+        }
+        return *this;
+    }
+
+    size_t ColumnQuery::count() const {
+        size_t selected = 0;
+        for (const uint8_t row : m_mask) {
+            selected += row;
+        }
+        return selected;
+    }
+
+    std::vector<EntityHandle> ColumnQuery::handles() const {
+        const std::span<const EntityHandle> rows = m_columns->getHandles();
+        std::vector<EntityHandle> result;
+        result.reserve(count());
+        for (size_t i = 0; i < m_mask.size(); ++i) {
+            if (m_mask[i]) {
+                result.push_back(rows[i]);
+            }
+        }
+        return result;
+    }
+
+    double ColumnQuery::sum(const std::string_view property) const {
+        ADS_ZONE("ColumnQuery::sum");
+        const PropertyColumns::Column* column = m_columns->findColumn(property);
+        if (column == nullptr) {
+            return 0.0;
+        }
+        const uint8_t* selected = m_mask.data();
+        const size_t rows = m_mask.size();
+        if (!column->isFloat) {
+            const int32_t* values = column->ints.data();
+            int64_t total = 0;
+            for (size_t i = 0; i < rows; ++i) {
+                total += pick(selected[i], values[i], 0);
+            }
+            return static_cast<double>(total);
+        }
+
+        const float* values = column->floats.data();
+        std::array<double, LANES> lanes{};
+        size_t i = 0;
+        for (; i + LANES <= rows; i += LANES) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                lanes[lane] += pick(selected[i + lane], values[i + lane], 0.0f);
+            }
+        }
+        double total = 0.0;
+        for (; i < rows; ++i) {
+            total += pick(selected[i], values[i], 0.0f);
+        }
+        for (const double lane : lanes) {
+            total += lane;
+        }
+        return total;
+    }
+
+    std::optional<double> ColumnQuery::min(const std::string_view property) const {
+        return extreme(property, false);
+    }
+
+    std::optional<double> ColumnQuery::max(const std::string_view property) const {
+        return extreme(property, true);
+    }
+
+    std::optional<double> ColumnQuery::extreme(const std::string_view property, const bool largest) const {
+        ADS_ZONE("ColumnQuery::extreme");
+        const PropertyColumns::Column* column = m_columns->findColumn(property);
+        if (column == nullptr) {
+            return std::nullopt;
+        }
+        const uint8_t* selected = m_mask.data();
+        const size_t rows = m_mask.size();
+
+        // Rows not selected take a value that never wins, so no row needs a branch
+        const int32_t neutral = largest ? std::numeric_limits<int32_t>::min() : std::numeric_limits<int32_t>::max();
+        int32_t best = neutral;
+        if (!column->isFloat) {
+            if (count() == 0) {
+                return std::nullopt;
+            }
+            const int32_t* values = column->ints.data();
+            if (largest) {
+                for (size_t i = 0; i < rows; ++i) {
+                    best = std::max(best, pick(selected[i], values[i], neutral));
+                }
+            } else {
+                for (size_t i = 0; i < rows; ++i) {
+                    best = std::min(best, pick(selected[i], values[i], neutral));
+                }
+            }
+            return best;
+        }
+
+        // Floats are compared through their ordered keys, as a float min or max
+        // reduction does not vectorise; NaNs are skipped like unselected rows,
+        // and both neutral keys are NaNs, so finding one means nothing was kept
+        const float* values = column->floats.data();
+        if (largest) {
+            for (size_t i = 0; i < rows; ++i) {
+                const uint8_t keep = selected[i] & static_cast<uint8_t>(values[i] == values[i]);
+                best = std::max(best, pick(keep, orderedKey(values[i]), neutral));
+            }
+        } else {
+            for (size_t i = 0; i < rows; ++i) {
+                const uint8_t keep = selected[i] & static_cast<uint8_t>(values[i] == values[i]);
+                best = std::min(best, pick(keep, orderedKey(values[i]), neutral));
+            }
+        }
+        if (best == neutral) {
+            return std::nullopt;
+        }
+        return fromOrderedKey(best);
+    }
+
+}
@@ -0,0 +1,175 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_COLUMN_QUERY_H
+#define ADS_CORE_COLUMN_QUERY_H
+
+/**
+ * @file ColumnQuery.h
+ * @brief Filters and aggregates over the property columns of one entity kind
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A query starts with every live row selected; each where() narrows the
+ * selection with one pass over one or two columns. The selection is a byte
+ * per row and every pass is a branch-free loop over contiguous arrays, so
+ * the compiler turns them into SIMD code for whatever the build targets
+ * without any intrinsics in the source.
+ *
+ * @see ADS::Core::PropertyColumns
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "EntityHandle.h"
+#include "PropertyColumns.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Comparison of a property against a value or another property
+     */
+    enum class Compare : uint8_t {
+        Less,
+        LessEqual,
+        Equal,
+        NotEqual,
+        GreaterEqual,
+        Greater
+    };
+
+    /**
+     * @brief One comparison of a property against a number, as typed by a user
+     */
+    struct ColumnFilter {
+        std::string property;
+        Compare compare = Compare::NotEqual;
+        double value = 0.0;
+
+        /**
+         * @brief Parse a term such as `quantity>10`, `health<=0`, `isPickable` or `!isPlayer`
+         *
+         * A bare property tests for non-zero and a property behind `!` for
+         * zero; `true` and `false` stand for 1 and 0. Recognises the
+         * operators <, <=, >, >=, =, == and !=.
+         *
+         * @param term Text without spaces
+         * @return std::optional<ColumnFilter> The filter, or empty if the term is not one
+         */
+        [[nodiscard]] static std::optional<ColumnFilter> parse(std::string_view term);
+    };
+
+    /**
+     * @brief Selection of the rows of a PropertyColumns, narrowed by comparisons
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Reads the columns it was made from; they must not change while the
+     * query is in use. Comparisons with a property that has no column
+     * select nothing.
+     */
+    class ColumnQuery {
+    public:
+        /**
+         * @param columns Columns to query; every live row starts selected
+         */
+        explicit ColumnQuery(const PropertyColumns& columns);
+
+        /**
+         * @brief Keep the rows whose property compares true against a number
+         *
+         * Integer properties are compared exactly, without rounding the
+         * number to an integer first.
+         *
+         * @param property Property id
+         * @param compare  Comparison, property on the left
+         * @param value    Number on the right
+         * @return ColumnQuery& This query
+         */
+        ColumnQuery& where(std::string_view property, Compare compare, double value);
+
+        /**
+         * @brief Keep the rows whose property is true, or false
+         * @param property Bool property id
+         * @param value    Value to keep
+         * @return ColumnQuery& This query
+         */
+        ColumnQuery& where(std::string_view property, bool value);
+
+        /**
+         * @brief Keep the rows passing a parsed filter
+         * @param filter Comparison to apply
+         * @return ColumnQuery& This query
+         */
+        ColumnQuery& where(const ColumnFilter& filter);
+
+        /**
+         * @brief Keep the rows where one property compares true against another
+         *
+         * @param left    Property on the left
+         * @param compare Comparison
+         * @param right   Property on the right
+         * @return ColumnQuery& This query
+         */
+        ColumnQuery& whereColumns(std::string_view left, Compare compare, std::string_view right);
+
+        /**
+         * @brief Get the number of rows selected
+         */
+        [[nodiscard]] size_t count() const;
+
+        /**
+         * @brief Get the handles of the entities selected, in handle index order
+         */
+        [[nodiscard]] std::vector<EntityHandle> handles() const;
+
+        /**
+         * @brief Add up a property over the rows selected
+         * @param property Property id
+         * @return double Sum; 0 if nothing is selected or the property has no column
+         */
+        [[nodiscard]] double sum(std::string_view property) const;
+
+        /**
+         * @brief Get the smallest value of a property over the rows selected
+         * @param property Property id
+         * @return std::optional<double> Minimum; empty if nothing is selected or the property has no column
+         */
+        [[nodiscard]] std::optional<double> min(std::string_view property) const;
+
+        /**
+         * @brief Get the largest value of a property over the rows selected
+         * @param property Property id
+         * @return std::optional<double> Maximum; empty if nothing is selected or the property has no column
+         */
+        [[nodiscard]] std::optional<double> max(std::string_view property) const;
+
+    private:
+        /**
+         * @brief Get the smallest or largest value of a property over the rows selected
+         */
+        [[nodiscard]] std::optional<double> extreme(std::string_view property, bool largest) const;
+
+        const PropertyColumns* m_columns;
+        std::vector<uint8_t> m_mask;    ///< 1 for the rows selected
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_COLUMN_QUERY_H
@@ -0,0 +1,203 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file CsvImportParser.cpp
+ * @brief Implementation of the CsvImportParser class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "CsvImportParser.h"
+
+#include <format>
+#include <optional>
+#include <string_view>
+
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+    namespace {
+        std::string_view trim(std::string_view text) {
+            const size_t first = text.find_first_not_of(" \t");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+        }
+
+        /**
+         * @brief Lowercase ASCII copy of a trimmed field, for matching keywords
+         */
+        std::string keyword(std::string_view text) {
+            std::string lower(trim(text));
+            for (char& c : lower) {
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+            }
+            return lower;
+        }
+
+        std::optional<EntityKind> kindOf(std::string_view text) {
+            const std::string kind = keyword(text);
+            if (kind.empty() || kind == "scene" || kind == "room" || kind == "location") {
+                return EntityKind::Scene;
+            }
+            if (kind == "character" || kind == "person" || kind == "npc") {
+                return EntityKind::Character;
+            }
+            if (kind == "item" || kind == "thing" || kind == "object") {
+                return EntityKind::Item;
+            }
+            return std::nullopt;
+        }
+    }
+
+    CsvImportParser::CsvImportParser(std::istream& in, const char delimiter)
+        : ImportParser(in), m_delimiter(delimiter) {
+        m_columns.fill(ABSENT);
+    }
+
+    bool CsvImportParser::readRow() {
+        size_t used = 0;
+        size_t rowBytes = 0;
+        bool quoted = false;
+        std::string* current = nullptr;
+
+        const auto nextField = [this, &used, &current]() {
+            if (used == m_fields.size()) {
+                m_fields.emplace_back();
+            }
+            current = &m_fields[used++];
+            current->clear();
+        };
+
+        if (!readLine(m_line)) {
+            return false;
+        }
+        nextField();
+        for (;;) {
+            rowBytes += m_line.size();
+            for (size_t i = 0; i < m_line.size(); ++i) {
+                const char c = m_line[i];
+                if (quoted) {
+                    if (c != '"') {
+                        *current += c;
+                    } else if (i + 1 < m_line.size() && m_line[i + 1] == '"') {
+                        *current += '"';
+                        ++i;
+                    } else {
+                        quoted = false;
+                    }
+                } else if (c == '"' && current->empty()) {
+                    quoted = true;
+                } else if (c == m_delimiter) {
+                    nextField();
+                } else {
+                    *current += c;
+                }
+            }
+            if (!quoted) {
+                break;
+            }
+            // A line break inside quotes belongs to the field
+            if (rowBytes > MAX_LINE_BYTES || !readLine(m_line)) {
+                throw Exceptions::project_format_exception(
+                    std::format("Quoted field never closes, near line {}", getLineNumber()));
+            }
+            *current += '\n';
+        }
+        m_fields.resize(used);
+        return true;
+    }
+
+    void CsvImportParser::readHeader() {
+        m_headerRead = true;
+        if (!readRow()) {
+            return;
+        }
+        for (size_t position = 0; position < m_fields.size(); ++position) {
+            const std::string name = keyword(m_fields[position]);
+            std::optional<Column> column;
+            if (name == "kind" || name == "type") {
+                column = KIND;
+            } else if (name == "id") {
+                column = ID;
+            } else if (name == "name" || name == "title") {
+                column = NAME;
+            } else if (name == "description") {
+                column = DESCRIPTION;
+            } else if (name == "exits") {
+                column = EXITS;
+            }
+            if (column && m_columns[*column] == ABSENT) {
+                m_columns[*column] = position;
+            }
+        }
+        if (m_columns[NAME] == ABSENT && m_columns[ID] == ABSENT) {
+            throw Exceptions::project_format_exception("The first row names neither a name nor an id column");
+        }
+    }
+
+    const std::string& CsvImportParser::field(const Column column) const {
+        static const std::string empty;
+        const size_t position = m_columns[column];
+        return position < m_fields.size() ? m_fields[position] : empty;
+    }
+
+    bool CsvImportParser::read(ImportBatch& batch, const size_t maxRecords) {
+        if (!m_headerRead) {
+            readHeader();
+        }
+        while (batch.size() < maxRecords) {
+            if (!readRow()) {
+                return false;
+            }
+            if (m_fields.size() == 1 && trim(m_fields.front()).empty()) {
+                continue;
+            }
+            const std::optional<EntityKind> kind = kindOf(field(KIND));
+            if (!kind) {
+                skip();
+                continue;
+            }
+
+            ImportRecord& record = batch.entities.emplace_back();
+            record.kind = *kind;
+            record.id = trim(field(ID));
+            record.name = trim(field(NAME));
+            record.description = field(DESCRIPTION);
+            if (record.name.empty()) {
+                record.name = record.id;
+            }
+            if (record.id.empty()) {
+                record.id = makeId(record.name);
+            }
+
+            if (*kind != EntityKind::Scene) {
+                continue;
+            }
+            std::string_view exits = field(EXITS);
+            while (!exits.empty()) {
+                const size_t end = exits.find_first_of(";|");
+                const std::string_view target = trim(exits.substr(0, end));
+                if (!target.empty()) {
+                    batch.exits.emplace_back(record.id, target);
+                }
+                exits = end == std::string_view::npos ? std::string_view{} : exits.substr(end + 1);
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_CSV_IMPORT_PARSER_H
+#define ADS_CORE_CSV_IMPORT_PARSER_H
+
+/**
+ * @file CsvImportParser.h
+ * @brief Entities from CSV and TSV spreadsheets
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "ImportParser.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Reads one entity per row of a delimited spreadsheet
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The first row names the columns, in any order and case:
+     *
+     * - `kind` or `type`: scene, room or location; character, person or
+     *   npc; item, thing or object. Empty means scene.
+     * - `id`: entity id; empty derives one from the name.
+     * - `name` or `title`: display name. Either it or `id` is required.
+     * - `description`
+     * - `exits`: ids of the scenes a scene leads to, separated by ';' or '|'
+     *
+     * Other columns are ignored. Fields follow RFC 4180: a quoted field
+     * may hold the delimiter, line breaks and doubled quotes. Rows of an
+     * unknown kind are skipped, blank rows silently.
+     */
+    class CsvImportParser : public ImportParser {
+    public:
+        /**
+         * @param in        Source
+         * @param delimiter ',' for CSV, '\t' for TSV
+         */
+        CsvImportParser(std::istream& in, char delimiter);
+
+        bool read(ImportBatch& batch, size_t maxRecords = BATCH_RECORDS) override;
+
+    private:
+        /**
+         * @brief Known columns, as positions in m_columns
+         */
+        enum Column : size_t {
+            KIND,
+            ID,
+            NAME,
+            DESCRIPTION,
+            EXITS,
+            COLUMN_COUNT
+        };
+
+        static constexpr size_t ABSENT = static_cast<size_t>(-1);
+
+        /**
+         * @brief Read the next row into m_fields
+         *
+         * @return bool False at the end of the source
+         * @throws Exceptions::project_format_exception if a quoted field never closes
+         */
+        bool readRow();
+
+        /**
+         * @brief Map the header row to m_columns
+         *
+         * @throws Exceptions::project_format_exception if there is neither a name nor an id column
+         */
+        void readHeader();
+
+        /**
+         * @brief Get a known field of the current row
+         * @return const std::string& Empty if the column is absent or the row is short
+         */
+        [[nodiscard]] const std::string& field(Column column) const;
+
+        char m_delimiter;
+        bool m_headerRead = false;
+        std::array<size_t, COLUMN_COUNT> m_columns{};   ///< Position of each known column, or ABSENT
+        std::vector<std::string> m_fields;              ///< Fields of the current row; reused
+        std::string m_line;                             ///< Line buffer; reused
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_CSV_IMPORT_PARSER_H
@@ -0,0 +1,369 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file DeltaStream.cpp
+ * @brief Implementation of the DeltaStream class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "DeltaStream.h"
+
+#include <algorithm>
+#include <bit>
+#include <unordered_map>
+
+#include <zlib.h>
+
+#include "Profiling.h"
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+
+    namespace {
+        /**
+         * @brief Tag written before each value, one per PropertyValue alternative
+         */
+        enum class ValueTag : uint8_t {
+            None   = 0,
+            False  = 1,
+            True   = 2,
+            Int    = 3,
+            Float  = 4,
+            String = 5,
+            Color  = 6,
+            Vector = 7,
+            Enum   = 8
+        };
+
+        constexpr size_t ENTITY_KIND_BITS = 0x0F;
+
+        class Writer {
+        public:
+            std::string bytes;
+
+            void byte(uint8_t value) {
+                bytes.push_back(static_cast<char>(value));
+            }
+
+            void varint(uint64_t value) {
+                while (value >= 0x80) {
+                    byte(static_cast<uint8_t>(value | 0x80));
+                    value >>= 7;
+                }
+                byte(static_cast<uint8_t>(value));
+            }
+
+            void signedVarint(int64_t value) {
+                varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+            }
+
+            void real(float value) {
+                const auto bits = std::bit_cast<uint32_t>(value);
+                for (int shift = 0; shift < 32; shift += 8) {
+                    byte(static_cast<uint8_t>(bits >> shift));
+                }
+            }
+
+            void text(std::string_view value) {
+                varint(value.size());
+                bytes.append(value);
+            }
+
+            void value(const Inspector::PropertyValue& value) {
+                std::visit([this](const auto& v) {
+                    using T = std::decay_t<decltype(v)>;
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        byte(static_cast<uint8_t>(ValueTag::None));
+                    } else if constexpr (std::is_same_v<T, bool>) {
+                        byte(static_cast<uint8_t>(v ? ValueTag::True : ValueTag::False));
+                    } else if constexpr (std::is_same_v<T, int>) {
+                        byte(static_cast<uint8_t>(ValueTag::Int));
+                        signedVarint(v);
+                    } else if constexpr (std::is_same_v<T, float>) {
+                        byte(static_cast<uint8_t>(ValueTag::Float));
+                        real(v);
+                    } else if constexpr (std::is_same_v<T, std::string>) {
+                        byte(static_cast<uint8_t>(ValueTag::String));
+                        text(v);
+                    } else if constexpr (std::is_same_v<T, ImVec4>) {
+                        byte(static_cast<uint8_t>(ValueTag::Color));
+                        real(v.x);
+                        real(v.y);
+                        real(v.z);
+                        real(v.w);
+                    } else if constexpr (std::is_same_v<T, ImVec2>) {
+                        byte(static_cast<uint8_t>(ValueTag::Vector));
+                        real(v.x);
+                        real(v.y);
+                    } else if constexpr (std::is_same_v<T, Inspector::EnumValue>) {
+                        byte(static_cast<uint8_t>(ValueTag::Enum));
+                        signedVarint(v.selectedIndex);
+                    }
+                }, value);
+            }
+        };
+
+        class Reader {
+        public:
+            explicit Reader(std::string_view bytes) : m_bytes(bytes) {}
+
+            [[nodiscard]] bool atEnd() const {
+                return m_offset == m_bytes.size();
+            }
+
+            [[nodiscard]] std::string_view rest() const {
+                return m_bytes.substr(m_offset);
+            }
+
+            uint8_t byte() {
+                need(1);
+                return static_cast<uint8_t>(m_bytes[m_offset++]);
+            }
+
+            uint64_t varint() {
+                uint64_t value = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    const uint8_t b = byte();
+                    value |= static_cast<uint64_t>(b & 0x7F) << shift;
+                    if ((b & 0x80) == 0) {
+                        return value;
+                    }
+                }
+                throw Exceptions::project_format_exception("Delta payload has an overlong varint");
+            }
+
+            int64_t signedVarint() {
+                const uint64_t value = varint();
+                return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+            }
+
+            /**
+             * @brief Read a count of items that take at least one byte each
+             */
+            size_t count() {
+                const uint64_t value = varint();
+                if (value > m_bytes.size() - m_offset) {
+                    throw Exceptions::project_format_exception("Delta payload count exceeds its size");
+                }
+                return static_cast<size_t>(value);
+            }
+
+            float real() {
+                uint32_t bits = 0;
+                for (int shift = 0; shift < 32; shift += 8) {
+                    bits |= static_cast<uint32_t>(byte()) << shift;
+                }
+                return std::bit_cast<float>(bits);
+            }
+
+            std::string_view text() {
+                const size_t size = count();
+                const std::string_view value = m_bytes.substr(m_offset, size);
+                m_offset += size;
+                return value;
+            }
+
+            Inspector::PropertyValue value() {
+                switch (static_cast<ValueTag>(byte())) {
+                    case ValueTag::None:   return std::monostate{};
+                    case ValueTag::False:  return false;
+                    case ValueTag::True:   return true;
+                    case ValueTag::Int:    return static_cast<int>(signedVarint());
+                    case ValueTag::Float:  return real();
+                    case ValueTag::String: return std::string(text());
+                    case ValueTag::Color: {
+                        ImVec4 color;
+                        color.x = real();
+                        color.y = real();
+                        color.z = real();
+                        color.w = real();
+                        return color;
+                    }
+                    case ValueTag::Vector: {
+                        ImVec2 vector;
+                        vector.x = real();
+                        vector.y = real();
+                        return vector;
+                    }
+                    case ValueTag::Enum:   return Inspector::EnumValue(static_cast<int>(signedVarint()), nullptr);
+                }
+                throw Exceptions::project_format_exception("Delta payload has an unknown value tag");
+            }
+
+        private:
+            void need(size_t size) const {
+                if (size > m_bytes.size() - m_offset) {
+                    throw Exceptions::project_format_exception("Delta payload is truncated");
+                }
+            }
+
+            std::string_view m_bytes;
+            size_t m_offset = 0;
+        };
+
+        /**
+         * @brief Ids written once per batch and referred to by position
+         */
+        class StringTable {
+        public:
+            uint32_t intern(const std::string& value) {
+                auto [it, inserted] = m_indexes.try_emplace(value, static_cast<uint32_t>(m_strings.size()));
+                if (inserted) {
+                    m_strings.push_back(&it->first);
+                }
+                return it->second;
+            }
+
+            void write(Writer& writer) const {
+                writer.varint(m_strings.size());
+                for (const std::string* value : m_strings) {
+                    writer.text(*value);
+                }
+            }
+
+        private:
+            std::unordered_map<std::string, uint32_t> m_indexes;
+            std::vector<const std::string*> m_strings;     ///< Keys of m_indexes in index order
+        };
+
+        const std::string& lookup(const std::vector<std::string>& strings, uint64_t index) {
+            if (index >= strings.size()) {
+                throw Exceptions::project_format_exception("Delta payload refers to a missing string");
+            }
+            return strings[index];
+        }
+    }
+
+    std::string DeltaStream::encode(const DeltaBatch& batch) {
+        ADS_ZONE("DeltaStream::encode");
+        uint64_t clockBase = batch.ops.empty() ? 0 : batch.ops.front().clock;
+        for (const DeltaOp& op : batch.ops) {
+            clockBase = std::min(clockBase, op.clock);
+        }
+
+        // Ops are written first so the string table is complete before the body is assembled
+        StringTable strings;
+        Writer ops;
+        ops.varint(batch.ops.size());
+        for (const DeltaOp& op : batch.ops) {
+            ops.byte(static_cast<uint8_t>(static_cast<uint8_t>(op.type) << 4 | static_cast<uint8_t>(op.kind)));
+            ops.varint(strings.intern(op.entity));
+            ops.varint(op.clock - clockBase);
+            if (op.type == DeltaOp::Type::Set) {
+                ops.varint(strings.intern(op.property));
+                ops.value(op.value);
+            } else if (op.type == DeltaOp::Type::Create) {
+                ops.varint(op.properties.size());
+                for (const auto& [property, value] : op.properties) {
+                    ops.varint(strings.intern(property));
+                    ops.value(value);
+                }
+            }
+        }
+
+        Writer body;
+        body.varint(batch.site);
+        body.varint(clockBase);
+        strings.write(body);
+        body.bytes.append(ops.bytes);
+
+        Writer payload;
+        payload.byte(DeltaFormat::VERSION);
+        if (body.bytes.size() >= COMPRESS_THRESHOLD) {
+            uLongf deflatedSize = compressBound(static_cast<uLong>(body.bytes.size()));
+            std::string deflated(deflatedSize, '\0');
+            if (compress2(reinterpret_cast<Bytef*>(deflated.data()), &deflatedSize,
+                          reinterpret_cast<const Bytef*>(body.bytes.data()),
+                          static_cast<uLong>(body.bytes.size()), Z_BEST_SPEED) == Z_OK
+                && deflatedSize < body.bytes.size()) {
+                payload.byte(DeltaFormat::FLAG_DEFLATED);
+                payload.varint(body.bytes.size());
+                payload.bytes.append(deflated.data(), deflatedSize);
+                return std::move(payload.bytes);
+            }
+        }
+        payload.byte(0);
+        payload.bytes.append(body.bytes);
+        return std::move(payload.bytes);
+    }
+
+    DeltaBatch DeltaStream::decode(std::string_view payload) {
+        ADS_ZONE("DeltaStream::decode");
+        Reader header(payload);
+        if (header.byte() != DeltaFormat::VERSION) {
+            throw Exceptions::project_format_exception("Unsupported delta payload version");
+        }
+        const uint8_t flags = header.byte();
+        std::string inflated;
+        std::string_view bodyBytes;
+        if (flags & DeltaFormat::FLAG_DEFLATED) {
+            const uint64_t rawSize = header.varint();
+            if (rawSize > MAX_BODY_BYTES) {
+                throw Exceptions::project_format_exception("Delta payload is too large");
+            }
+            bodyBytes = header.rest();
+            inflated.resize(rawSize);
+            uLongf inflatedSize = static_cast<uLongf>(rawSize);
+            if (uncompress(reinterpret_cast<Bytef*>(inflated.data()), &inflatedSize,
+                           reinterpret_cast<const Bytef*>(bodyBytes.data()),
+                           static_cast<uLong>(bodyBytes.size())) != Z_OK
+                || inflatedSize != rawSize) {
+                throw Exceptions::project_format_exception("Delta payload does not inflate");
+            }
+            bodyBytes = inflated;
+        } else {
+            bodyBytes = header.rest();
+        }
+
+        Reader body(bodyBytes);
+        DeltaBatch batch;
+        batch.site = body.varint();
+        const uint64_t clockBase = body.varint();
+        std::vector<std::string> strings(body.count());
+        for (std::string& value : strings) {
+            value = body.text();
+        }
+
+        batch.ops.resize(body.count());
+        for (DeltaOp& op : batch.ops) {
+            const uint8_t typeAndKind = body.byte();
+            const uint8_t type = typeAndKind >> 4;
+            const uint8_t kind = typeAndKind & ENTITY_KIND_BITS;
+            if (type < static_cast<uint8_t>(DeltaOp::Type::Create) || type > static_cast<uint8_t>(DeltaOp::Type::Remove)
+                || kind >= ENTITY_KIND_COUNT) {
+                throw Exceptions::project_format_exception("Delta payload has an unknown operation");
+            }
+            op.type = static_cast<DeltaOp::Type>(type);
+            op.kind = static_cast<EntityKind>(kind);
+            op.entity = lookup(strings, body.varint());
+            op.clock = clockBase + body.varint();
+            if (op.type == DeltaOp::Type::Set) {
+                op.property = lookup(strings, body.varint());
+                op.value = body.value();
+            } else if (op.type == DeltaOp::Type::Create) {
+                op.properties.resize(body.count());
+                for (auto& [property, value] : op.properties) {
+                    property = lookup(strings, body.varint());
+                    value = body.value();
+                }
+            }
+        }
+        if (!body.atEnd()) {
+            throw Exceptions::project_format_exception("Delta payload has trailing bytes");
+        }
+        return batch;
+    }
+
+}
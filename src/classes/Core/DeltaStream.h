@@ -0,0 +1,124 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_DELTA_STREAM_H
+#define ADS_CORE_DELTA_STREAM_H
+
+/**
+ * @file DeltaStream.h
+ * @brief Compact binary encoding of project edits for collaborative sessions
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A payload carries one batch of edits made on one site:
+ *
+ *   [version u8][flags u8][raw size varint, if deflated][body]
+ *
+ *   body := site clockBase stringCount string* opCount op*
+ *   op   := (type << 4 | kind) u8, entity string index, clock - clockBase
+ *           Set:    property string index, value
+ *           Create: property count, (property string index, value)*
+ *
+ * Every integer is a varint, signed ones zigzag-encoded. Entity and
+ * property ids are written once per batch in the string table, so a
+ * burst of edits to the same entities costs a few bytes per edit. Bodies
+ * of COMPRESS_THRESHOLD bytes or more are deflated when that makes them
+ * smaller.
+ *
+ * @see ADS::Core::SyncSession
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "EntityHandle.h"
+#include "Inspector/PropertyValue.h"
+
+namespace ADS::Core {
+
+    namespace DeltaFormat {
+        inline constexpr uint8_t VERSION = 1;           ///< Bumped on any layout change
+        inline constexpr uint8_t FLAG_DEFLATED = 0x01;  ///< Body is zlib-compressed
+    }
+
+    /**
+     * @brief One edit of a delta stream
+     */
+    struct DeltaOp {
+        enum class Type : uint8_t {
+            Create = 1,     ///< Entity added, with its starting values
+            Set    = 2,     ///< One property changed
+            Remove = 3      ///< Entity removed
+        };
+
+        Type type = Type::Set;
+        EntityKind kind = EntityKind::Scene;
+        std::string entity;                 ///< Id of the entity
+        uint64_t clock = 0;                 ///< Lamport time of the edit on its site
+        std::string property;               ///< Set: property changed
+        Inspector::PropertyValue value;     ///< Set: new value
+        std::vector<std::pair<std::string, Inspector::PropertyValue>> properties;  ///< Create: editable properties and their values
+    };
+
+    /**
+     * @brief Edits made on one site, in the order they were made
+     */
+    struct DeltaBatch {
+        uint64_t site = 0;              ///< Id of the site that made the edits
+        std::vector<DeltaOp> ops;
+    };
+
+    /**
+     * @brief Encodes and decodes delta stream payloads
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Stateless utility class. Enumeration values travel as their
+     * selected index; the receiver supplies the options.
+     */
+    class DeltaStream {
+    public:
+        /// Smallest body worth deflating
+        static constexpr size_t COMPRESS_THRESHOLD = 512;
+
+        /// Largest body a payload may inflate to
+        static constexpr size_t MAX_BODY_BYTES = 64u << 20;
+
+        DeltaStream() = delete;
+
+        /**
+         * @brief Encode a batch
+         *
+         * @param batch Edits to encode
+         * @return std::string Payload
+         */
+        [[nodiscard]] static std::string encode(const DeltaBatch& batch);
+
+        /**
+         * @brief Decode a payload made by encode()
+         *
+         * @param payload Payload to decode
+         * @return DeltaBatch The edits it carries
+         * @throws Exceptions::project_format_exception if the payload is malformed
+         */
+        [[nodiscard]] static DeltaBatch decode(std::string_view payload);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_DELTA_STREAM_H
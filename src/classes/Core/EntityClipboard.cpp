@@ -0,0 +1,346 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file EntityClipboard.cpp
+ * @brief Implementation of the EntityClipboard class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "EntityClipboard.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <unordered_set>
+#include <utility>
+
+#include "IdGenerator.h"
+#include "JsonProjectSerializer.h"
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+    using namespace BinaryFormat;
+
+    namespace {
+        constexpr uint32_t NOT_COPIED = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * @brief A validated payload; records are copied out, strings viewed in place
+         */
+        struct Payload {
+            std::vector<SceneRecord> scenes;
+            std::vector<CharacterRecord> characters;
+            std::vector<ItemRecord> items;
+            std::vector<ExitRecord> exits;
+            std::string_view strings;
+        };
+
+        /**
+         * @brief A pasted payload and the ids its records were given, kept by the undo step
+         */
+        struct PastedSet {
+            std::string bytes;                      ///< Owns the strings of payload
+            Payload payload;
+            std::vector<NewEntity> scenes;          ///< Final id and name of each scene record
+            std::vector<NewEntity> characters;
+            std::vector<NewEntity> items;
+            bool keepStartFlags = true;             ///< False if the project already had a start scene
+        };
+
+        template<typename Record>
+        void readRecords(std::string_view bytes, size_t& offset, uint32_t count, std::vector<Record>& records) {
+            // The payload may come unaligned from the system clipboard
+            records.resize(count);
+            if (count == 0) {
+                return;
+            }
+            std::memcpy(records.data(), bytes.data() + offset, count * sizeof(Record));
+            offset += count * sizeof(Record);
+        }
+
+        template<typename Record>
+        void appendRecords(std::string& bytes, const std::vector<Record>& records) {
+            bytes.append(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+        }
+
+        Payload parse(std::string_view bytes) {
+            ClipboardFormat::Header header{};
+            if (bytes.size() < sizeof(header)) {
+                throw Exceptions::project_format_exception("Clipboard payload is truncated");
+            }
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            if (std::memcmp(header.magic, ClipboardFormat::MAGIC, sizeof(ClipboardFormat::MAGIC)) != 0
+                || header.version != ClipboardFormat::VERSION) {
+                throw Exceptions::project_format_exception("Clipboard payload has an unknown format");
+            }
+            if (header.byteOrderMark != BYTE_ORDER_MARK) {
+                throw Exceptions::project_format_exception("Clipboard payload was written with another byte order");
+            }
+            const uint64_t size = sizeof(header)
+                + static_cast<uint64_t>(header.sceneCount) * sizeof(SceneRecord)
+                + static_cast<uint64_t>(header.characterCount) * sizeof(CharacterRecord)
+                + static_cast<uint64_t>(header.itemCount) * sizeof(ItemRecord)
+                + static_cast<uint64_t>(header.exitCount) * sizeof(ExitRecord)
+                + header.stringBytes;
+            if (size != bytes.size()) {
+                throw Exceptions::project_format_exception("Clipboard payload size does not match its header");
+            }
+
+            Payload payload;
+            size_t offset = sizeof(header);
+            readRecords(bytes, offset, header.sceneCount, payload.scenes);
+            readRecords(bytes, offset, header.characterCount, payload.characters);
+            readRecords(bytes, offset, header.itemCount, payload.items);
+            readRecords(bytes, offset, header.exitCount, payload.exits);
+            payload.strings = bytes.substr(offset);
+            for (const ExitRecord& exit : payload.exits) {
+                if (exit.from >= payload.scenes.size() || exit.to >= payload.scenes.size()) {
+                    throw Exceptions::project_format_exception("Scene exit refers to a missing scene record");
+                }
+            }
+            return payload;
+        }
+
+        /**
+         * @brief Give each record its final id, keeping the stored one when it is free
+         *
+         * @param records Records of one kind
+         * @param table   String table of the payload
+         * @param prefix  Prefix of the ids made for renamed records
+         * @param isTaken Whether the project already uses an id
+         * @param entries Receives the final id and name of each record, in order
+         * @return size_t Number of records given a new id
+         */
+        template<typename Record, typename IsTaken>
+        size_t assignIds(const std::vector<Record>& records, std::string_view table, std::string_view prefix,
+                         IsTaken&& isTaken, std::vector<NewEntity>& entries) {
+            // Views into entries, which are reserved up front and never move
+            std::unordered_set<std::string_view> used;
+            used.reserve(records.size());
+            entries.reserve(records.size());
+            size_t renamed = 0;
+            for (const Record& record : records) {
+                const std::string_view id = resolveString(table, record.id);
+                NewEntity& entry = entries.emplace_back();
+                entry.name = std::string(resolveString(table, record.name));
+                if (!id.empty() && !used.contains(id) && !isTaken(id)) {
+                    entry.id = std::string(id);
+                } else {
+                    entry.id = IdGenerator::makeEntityId(prefix);
+                    ++renamed;
+                }
+                used.insert(entry.id);
+            }
+            return renamed;
+        }
+
+        std::vector<std::string> idsOf(const std::vector<NewEntity>& entries) {
+            std::vector<std::string> ids;
+            ids.reserve(entries.size());
+            for (const NewEntity& entry : entries) {
+                ids.push_back(entry.id);
+            }
+            return ids;
+        }
+
+        /**
+         * @brief Add the entities of a pasted set under their final ids, then link their exits
+         *
+         * @return size_t Number of exits linked
+         */
+        size_t insert(Project& project, const PastedSet& set) {
+            const Payload& payload = set.payload;
+            StringPool* pool = &project.getStringPool();
+            project.addScenes(set.scenes, [&payload, &set, pool](Entities::Scene& scene, const size_t entry) {
+                apply(payload.scenes[entry], payload.strings, scene, nullptr, pool);
+                if (!set.keepStartFlags) {
+                    scene.setStartScene(false);
+                }
+            });
+            project.addCharacters(set.characters, [&payload, pool](Entities::Character& character, const size_t entry) {
+                apply(payload.characters[entry], payload.strings, character, nullptr, pool);
+            });
+            project.addItems(set.items, [&payload, pool](Entities::Item& item, const size_t entry) {
+                apply(payload.items[entry], payload.strings, item, nullptr, pool);
+            });
+
+            std::vector<std::pair<std::string_view, std::string_view>> exits;
+            exits.reserve(payload.exits.size());
+            for (const ExitRecord& exit : payload.exits) {
+                exits.emplace_back(set.scenes[exit.from].id, set.scenes[exit.to].id);
+            }
+            return project.addExits(exits);
+        }
+    }
+
+    std::string EntityClipboard::copy(const Project& project, std::span<const EntityHandle> entities) {
+        StringTableBuilder strings;
+        std::vector<SceneRecord> scenes;
+        std::vector<CharacterRecord> characters;
+        std::vector<ItemRecord> items;
+
+        // Handle index → position in the scene section, for the exit records
+        std::vector<uint32_t> scenePositions;
+        std::vector<const Entities::Scene*> copiedScenes;
+        for (const EntityHandle handle : entities) {
+            switch (handle.kind()) {
+                case EntityKind::Scene:
+                    if (const Entities::Scene* scene = project.findScene(handle)) {
+                        if (handle.index() >= scenePositions.size()) {
+                            scenePositions.resize(handle.index() + 1, NOT_COPIED);
+                        }
+                        if (scenePositions[handle.index()] == NOT_COPIED) {
+                            scenePositions[handle.index()] = static_cast<uint32_t>(scenes.size());
+                            scenes.push_back(encode(*scene, strings));
+                            copiedScenes.push_back(scene);
+                        }
+                    }
+                    break;
+                case EntityKind::Character:
+                    if (const Entities::Character* character = project.findCharacter(handle)) {
+                        characters.push_back(encode(*character, strings));
+                    }
+                    break;
+                case EntityKind::Item:
+                    if (const Entities::Item* item = project.findItem(handle)) {
+                        items.push_back(encode(*item, strings));
+                    }
+                    break;
+            }
+        }
+
+        std::vector<ExitRecord> exits;
+        for (size_t from = 0; from < copiedScenes.size(); ++from) {
+            for (const Entities::Scene* target : project.getExits(*copiedScenes[from])) {
+                const uint32_t index = target->getHandle().index();
+                if (index < scenePositions.size() && scenePositions[index] != NOT_COPIED) {
+                    exits.push_back({static_cast<uint32_t>(from), scenePositions[index]});
+                }
+            }
+        }
+
+        ClipboardFormat::Header header{};
+        std::memcpy(header.magic, ClipboardFormat::MAGIC, sizeof(ClipboardFormat::MAGIC));
+        header.version = ClipboardFormat::VERSION;
+        header.byteOrderMark = BYTE_ORDER_MARK;
+        header.sceneCount = static_cast<uint32_t>(scenes.size());
+        header.characterCount = static_cast<uint32_t>(characters.size());
+        header.itemCount = static_cast<uint32_t>(items.size());
+        header.exitCount = static_cast<uint32_t>(exits.size());
+        header.stringBytes = static_cast<uint32_t>(strings.data().size());
+
+        std::string bytes;
+        bytes.reserve(sizeof(header) + scenes.size() * sizeof(SceneRecord) + characters.size() * sizeof(CharacterRecord)
+            + items.size() * sizeof(ItemRecord) + exits.size() * sizeof(ExitRecord) + strings.data().size());
+        bytes.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        appendRecords(bytes, scenes);
+        appendRecords(bytes, characters);
+        appendRecords(bytes, items);
+        appendRecords(bytes, exits);
+        bytes += strings.data();
+        return bytes;
+    }
+
+    bool EntityClipboard::isBinary(std::string_view payload) {
+        return payload.size() >= sizeof(ClipboardFormat::MAGIC)
+            && std::memcmp(payload.data(), ClipboardFormat::MAGIC, sizeof(ClipboardFormat::MAGIC)) == 0;
+    }
+
+    std::string EntityClipboard::toJson(std::string_view payload) {
+        Project scratch("Clipboard");
+        paste(scratch, payload);
+        std::ostringstream out;
+        JsonProjectSerializer::write(scratch, out);
+        return std::move(out).str();
+    }
+
+    /**
+     * @brief Paste a payload into a project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A JSON payload is read into a scratch project and copied back to
+     * the binary form first, so both take the same path. The undo step
+     * keeps the payload and the final ids, charged to the journal budget.
+     *
+     * @param project Project receiving the entities
+     * @param payload Binary payload or `.adsproj` JSON
+     * @return PasteResult Handles of the pasted entities
+     */
+    PasteResult EntityClipboard::paste(Project& project, std::string_view payload) {
+        if (!isBinary(payload)) {
+            std::istringstream in{std::string(payload)};
+            const std::unique_ptr<Project> source = JsonProjectSerializer::read(in, "clipboard");
+            std::vector<EntityHandle> handles;
+            handles.reserve(source->getScenes().size() + source->getCharacters().size() + source->getItems().size());
+            for (const auto& scene : source->getScenes()) {
+                handles.push_back(scene->getHandle());
+            }
+            for (const auto& character : source->getCharacters()) {
+                handles.push_back(character->getHandle());
+            }
+            for (const auto& item : source->getItems()) {
+                handles.push_back(item->getHandle());
+            }
+            return paste(project, copy(*source, handles));
+        }
+
+        auto set = std::make_shared<PastedSet>();
+        set->bytes.assign(payload);
+        set->payload = parse(set->bytes);
+
+        PasteResult result;
+        const Payload& records = set->payload;
+        result.renamed += assignIds(records.scenes, records.strings, "scene",
+            [&project](std::string_view id) { return project.findScene(id) != nullptr; }, set->scenes);
+        result.renamed += assignIds(records.characters, records.strings, "char",
+            [&project](std::string_view id) { return project.findCharacter(id) != nullptr; }, set->characters);
+        result.renamed += assignIds(records.items, records.strings, "item",
+            [&project](std::string_view id) { return project.findItem(id) != nullptr; }, set->items);
+        set->keepStartFlags = std::ranges::none_of(project.getScenes(),
+            [](const auto& scene) { return scene->isStartScene(); });
+
+        result.exits = insert(project, *set);
+
+        result.entities.reserve(set->scenes.size() + set->characters.size() + set->items.size());
+        for (const NewEntity& entry : set->scenes) {
+            result.entities.push_back(project.findScene(entry.id)->getHandle());
+        }
+        for (const NewEntity& entry : set->characters) {
+            result.entities.push_back(project.findCharacter(entry.id)->getHandle());
+        }
+        for (const NewEntity& entry : set->items) {
+            result.entities.push_back(project.findItem(entry.id)->getHandle());
+        }
+
+        // Roughly: the payload, its decoded records and the final ids
+        const size_t bytes = 2 * set->bytes.size() + result.entities.size() * sizeof(NewEntity);
+        project.getUndoJournal().recordAction({
+            [set](Project& target) {
+                target.removeScenes(idsOf(set->scenes));
+                target.removeCharacters(idsOf(set->characters));
+                target.removeItems(idsOf(set->items));
+            },
+            [set](Project& target) {
+                insert(target, *set);
+            },
+            bytes
+        });
+        return result;
+    }
+}
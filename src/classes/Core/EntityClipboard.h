@@ -0,0 +1,149 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_ENTITY_CLIPBOARD_H
+#define ADS_CORE_ENTITY_CLIPBOARD_H
+
+/**
+ * @file EntityClipboard.h
+ * @brief Copy and paste of entity sets between projects
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The clipboard payload reuses the records of the binary project file:
+ *
+ *   [Header][SceneRecord × n][CharacterRecord × n][ItemRecord × n][ExitRecord × n][string table]
+ *
+ * Only exits between copied scenes are kept. External tools get the same
+ * set as an `.adsproj` JSON document, see EntityClipboard::toJson().
+ *
+ * @see ADS::Core::BinaryProjectFile
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinaryProjectFile.h"
+#include "EntityHandle.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    namespace ClipboardFormat {
+        inline constexpr char MAGIC[4] = {'A', 'D', 'S', 'C'};  ///< Payload signature
+        inline constexpr uint16_t VERSION = 1;                  ///< Bumped on any layout change
+
+        /**
+         * @brief Fixed-size header at offset 0
+         */
+        struct Header {
+            char magic[4];              ///< Always MAGIC
+            uint16_t version;           ///< Always VERSION
+            uint16_t reserved;
+            uint32_t byteOrderMark;     ///< Always BinaryFormat::BYTE_ORDER_MARK in native order
+            uint32_t sceneCount;
+            uint32_t characterCount;
+            uint32_t itemCount;
+            uint32_t exitCount;
+            uint32_t stringBytes;       ///< Size of the string table that ends the payload
+        };
+
+        static_assert(sizeof(Header) == 32, "Clipboard Header layout changed");
+    }
+
+    /**
+     * @brief Outcome of EntityClipboard::paste()
+     */
+    struct PasteResult {
+        std::vector<EntityHandle> entities;     ///< Pasted entities, scenes first
+        size_t renamed = 0;                     ///< Entities given a new id because theirs was taken
+        size_t exits = 0;                       ///< Exits linked between pasted scenes
+    };
+
+    /**
+     * @brief Serialises entity sets for the clipboard and pastes them into a project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Stateless utility class. A paste decodes the payload once: each
+     * record keeps its id unless the target project or an earlier record
+     * of the payload already uses it, in which case it gets a fresh one
+     * from IdGenerator, and exits are linked through the final ids. The
+     * entities are created with the bulk Project APIs, their fields set
+     * before they are tracked, so the paste raises no property events and
+     * is a single step of the project's undo journal.
+     */
+    class EntityClipboard {
+    public:
+        EntityClipboard() = delete;
+
+        /**
+         * @brief Serialise a set of entities to the binary payload
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param project  Project owning the entities
+         * @param entities Handles of the entities to copy; stale ones are skipped
+         * @return std::string Binary payload
+         */
+        [[nodiscard]] static std::string copy(const Project& project, std::span<const EntityHandle> entities);
+
+        /**
+         * @brief Check whether a payload is in the binary format
+         *
+         * @param payload Clipboard contents
+         * @return bool True if it starts with ClipboardFormat::MAGIC
+         */
+        [[nodiscard]] static bool isBinary(std::string_view payload);
+
+        /**
+         * @brief Convert a binary payload to its JSON form
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param payload Binary payload made by copy()
+         * @return std::string An `.adsproj` document holding the copied entities
+         * @throws Exceptions::project_format_exception if the payload is malformed
+         */
+        [[nodiscard]] static std::string toJson(std::string_view payload);
+
+        /**
+         * @brief Paste a payload into a project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Accepts a binary payload or a JSON document. Pasted scenes lose
+         * their start flag when the project already has a start scene.
+         * Undoing the paste removes every pasted entity; redoing it adds
+         * them again with the same ids.
+         *
+         * @param project Project receiving the entities
+         * @param payload Binary payload or `.adsproj` JSON
+         * @return PasteResult Handles of the pasted entities
+         * @throws Exceptions::project_format_exception if the payload is malformed
+         * @throws Exceptions::json_parse_exception if a JSON payload does not parse
+         */
+        static PasteResult paste(Project& project, std::string_view payload);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_ENTITY_CLIPBOARD_H
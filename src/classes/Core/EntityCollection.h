@@ -0,0 +1,293 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_ENTITY_COLLECTION_H
+#define ADS_CORE_ENTITY_COLLECTION_H
+
+/**
+ * @file EntityCollection.h
+ * @brief Pooled, id-indexed storage shared by every project entity type
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Project keeps one EntityCollection per entity type instead of a separate
+ * vector, index and pool for each, so storage and lookup behave the same
+ * for every kind and a new entity type only needs a new collection member.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "EntityPool.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Transparent hash for entity id keys
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Enables heterogeneous lookup so id containers can be queried with a
+     * std::string_view or const char* without building a temporary
+     * std::string for every lookup.
+     */
+    struct EntityIdHash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view id) const noexcept {
+            return std::hash<std::string_view>{}(id);
+        }
+    };
+
+    /**
+     * @brief Id and display name of an entity to create in a bulk add
+     */
+    struct NewEntity {
+        std::string id;     ///< Unique identifier within its collection
+        std::string name;   ///< Display name
+    };
+
+    /**
+     * @brief Ordered entities of one type, with O(1) lookup by id
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Entities live in an EntityPool and are owned by a vector that keeps
+     * insertion order, which is the order they are shown and saved in. An
+     * id → position index is kept in sync on every add and remove.
+     *
+     * The collection knows nothing about change tracking: add operations
+     * return the new entities and remove operations call a hook on each
+     * entity just before it is destroyed, so the owner can do its own
+     * bookkeeping.
+     *
+     * @tparam T Entity type; constructible from (id, name) and copy-constructible
+     */
+    template<typename T>
+    class EntityCollection {
+    public:
+        using Ptr = typename EntityPool<T>::Ptr;    ///< Owning pointer into the pool
+        using IdIndex = std::unordered_map<std::string, size_t, EntityIdHash, std::equal_to<>>; ///< Id → position
+        using const_iterator = typename std::vector<Ptr>::const_iterator;
+
+    private:
+        // The pool is declared before the vector so it is destroyed last
+        EntityPool<T> m_pool;           ///< Storage for the entities
+        std::vector<Ptr> m_entities;    ///< Owned entities in insertion order
+        IdIndex m_index;                ///< Id → position in m_entities
+
+        /**
+         * @brief Refresh index positions after elements have been erased
+         *
+         * @param first Position of the first element that may have shifted
+         */
+        void reindexFrom(size_t first) {
+            for (size_t i = first; i < m_entities.size(); ++i) {
+                m_index.find(m_entities[i]->getId())->second = i;
+            }
+        }
+
+        /**
+         * @brief Append an entity constructed in the pool from args
+         *
+         * Reserves the id first, so the duplicate check and the insertion
+         * share a single hash lookup. The reservation is withdrawn if the
+         * entity cannot be constructed or stored, so the index never holds
+         * a position past the end.
+         */
+        template<typename... Args>
+        T* emplace(const std::string& id, Args&&... args) {
+            const auto [slot, inserted] = m_index.try_emplace(id, m_entities.size());
+            if (!inserted) {
+                return nullptr;
+            }
+            try {
+                Ptr entity = m_pool.make(std::forward<Args>(args)...);
+                m_entities.push_back(std::move(entity));
+            } catch (...) {
+                m_index.erase(slot);
+                throw;
+            }
+            return m_entities.back().get();
+        }
+
+    public:
+        EntityCollection() = default;
+
+        // Non-copyable and non-movable, like the pool it owns
+        EntityCollection(const EntityCollection&) = delete;
+        EntityCollection& operator=(const EntityCollection&) = delete;
+
+        /**
+         * @brief Create and append a new entity
+         *
+         * @param id   Unique identifier within the collection
+         * @param name Display name
+         * @return T* Non-owning pointer to the new entity, or nullptr if the id is taken
+         */
+        T* add(const std::string& id, const std::string& name) {
+            return emplace(id, id, name);
+        }
+
+        /**
+         * @brief Append a copy of an existing entity
+         *
+         * @param entity Entity to copy, usually from another project
+         * @return T* Non-owning pointer to the copy, or nullptr if the id is taken
+         */
+        T* addCopy(const T& entity) {
+            return emplace(entity.getId(), entity);
+        }
+
+        /**
+         * @brief Append every entry whose id is not taken yet
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reserves the vector and the index once for the whole batch.
+         *
+         * @param entries Entities to create; duplicates are skipped
+         * @param onAdded Called with each entity and the position of its entry right after it is added
+         * @return size_t Number of entities added
+         */
+        template<typename OnAdded>
+        size_t addAll(std::span<const NewEntity> entries, OnAdded&& onAdded) {
+            m_entities.reserve(m_entities.size() + entries.size());
+            m_index.reserve(m_index.size() + entries.size());
+
+            const size_t before = m_entities.size();
+            for (size_t entry = 0; entry < entries.size(); ++entry) {
+                if (T* entity = add(entries[entry].id, entries[entry].name)) {
+                    onAdded(*entity, entry);
+                }
+            }
+            return m_entities.size() - before;
+        }
+
+        /**
+         * @brief Remove the entity with the given id
+         *
+         * @param id       Identifier of the entity to remove
+         * @param onRemove Called with the entity just before it is destroyed
+         * @return bool True if an entity was removed
+         */
+        template<typename OnRemove>
+        bool remove(std::string_view id, OnRemove&& onRemove) {
+            const auto it = m_index.find(id);
+            if (it == m_index.end()) {
+                return false;
+            }
+            const size_t position = it->second;
+            m_index.erase(it);
+            onRemove(*m_entities[position]);
+            m_entities.erase(m_entities.begin() + static_cast<std::ptrdiff_t>(position));
+            reindexFrom(position);
+            return true;
+        }
+
+        /**
+         * @brief Remove every listed entity in a single compaction pass
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Matching entities are destroyed in place, the vector is compacted
+         * once and only the positions after the first hole are reindexed, so
+         * removing k of n entities costs O(n + k) rather than O(n·k).
+         *
+         * @param ids      Ids to remove; unknown and repeated ids are ignored
+         * @param onRemove Called with each entity just before it is destroyed
+         * @return size_t Number of entities removed
+         */
+        template<typename OnRemove>
+        size_t removeAll(std::span<const std::string> ids, OnRemove&& onRemove) {
+            size_t first = m_entities.size();
+            size_t removed = 0;
+            for (const std::string& id : ids) {
+                const auto it = m_index.find(id);
+                if (it == m_index.end()) {
+                    continue;
+                }
+                const size_t position = it->second;
+                m_index.erase(it);
+                onRemove(*m_entities[position]);
+                m_entities[position].reset();
+                first = std::min(first, position);
+                ++removed;
+            }
+
+            if (removed > 0) {
+                std::erase(m_entities, nullptr);
+                reindexFrom(first);
+            }
+            return removed;
+        }
+
+        /**
+         * @brief Find an entity by id
+         *
+         * @param id Identifier to search for
+         * @return T* Non-owning pointer to the entity, or nullptr if not found
+         */
+        [[nodiscard]] T* find(std::string_view id) const {
+            const auto it = m_index.find(id);
+            return it != m_index.end() ? m_entities[it->second].get() : nullptr;
+        }
+
+        /**
+         * @brief Get the owned entities in insertion order (read-only)
+         * @return const std::vector<Ptr>& Owned entity vector
+         */
+        [[nodiscard]] const std::vector<Ptr>& getEntities() const {
+            return m_entities;
+        }
+
+        /**
+         * @brief Reserve room for a number of entities in total
+         * @param capacity Expected total entity count
+         */
+        void reserve(size_t capacity) {
+            m_entities.reserve(capacity);
+            m_index.reserve(capacity);
+        }
+
+        [[nodiscard]] size_t size() const {
+            return m_entities.size();
+        }
+
+        [[nodiscard]] bool empty() const {
+            return m_entities.empty();
+        }
+
+        [[nodiscard]] const_iterator begin() const {
+            return m_entities.begin();
+        }
+
+        [[nodiscard]] const_iterator end() const {
+            return m_entities.end();
+        }
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_ENTITY_COLLECTION_H
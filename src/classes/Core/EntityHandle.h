@@ -0,0 +1,114 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_ENTITY_HANDLE_H
+#define ADS_CORE_ENTITY_HANDLE_H
+
+/**
+ * @file EntityHandle.h
+ * @brief Compact generational identity of a project entity
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * String ids remain the persistent identity written to disk and shown to
+ * the user. At runtime an entity is identified by an EntityHandle: a slot
+ * index into its project's handle table, the slot's generation and the
+ * entity kind, packed into 64 bits. Comparing handles is one integer
+ * compare, and a handle whose entity was removed no longer resolves.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Identifies which project collection an entity belongs to
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Values are contiguous from zero so they can index per-kind arrays.
+     */
+    enum class EntityKind : uint8_t {
+        Scene     = 0,
+        Character = 1,
+        Item      = 2
+    };
+
+    inline constexpr size_t ENTITY_KIND_COUNT = 3; ///< Number of EntityKind values
+
+    /**
+     * @brief Index + generation + kind, packed into a single 64-bit value
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Layout, low to high: 32-bit slot index, 24-bit generation, 8-bit
+     * kind. Generations start at 1, so a default-constructed handle (all
+     * zero) never matches a live entity.
+     */
+    class EntityHandle {
+    private:
+        uint64_t m_value = 0;
+
+    public:
+        static constexpr uint32_t GENERATION_BITS = 24;                            ///< Width of the generation field
+        static constexpr uint32_t MAX_GENERATION = (1u << GENERATION_BITS) - 1;   ///< Last generation before a slot is retired
+
+        constexpr EntityHandle() = default;
+
+        constexpr EntityHandle(EntityKind kind, uint32_t index, uint32_t generation)
+            : m_value(static_cast<uint64_t>(index)
+                      | (static_cast<uint64_t>(generation & MAX_GENERATION) << 32)
+                      | (static_cast<uint64_t>(kind) << (32 + GENERATION_BITS))) {
+        }
+
+        /// Position in the project's handle table for kind()
+        [[nodiscard]] constexpr uint32_t index() const {
+            return static_cast<uint32_t>(m_value);
+        }
+
+        /// Generation of the slot when the handle was issued
+        [[nodiscard]] constexpr uint32_t generation() const {
+            return static_cast<uint32_t>(m_value >> 32) & MAX_GENERATION;
+        }
+
+        /// Collection the entity belongs to
+        [[nodiscard]] constexpr EntityKind kind() const {
+            return static_cast<EntityKind>(m_value >> (32 + GENERATION_BITS));
+        }
+
+        /// True unless default-constructed; says nothing about liveness
+        [[nodiscard]] constexpr bool isValid() const {
+            return m_value != 0;
+        }
+
+        /// Rebuild a handle from value(), e.g. when read back from a hash key
+        [[nodiscard]] static constexpr EntityHandle fromValue(uint64_t value) {
+            EntityHandle handle;
+            handle.m_value = value;
+            return handle;
+        }
+
+        /// Raw packed value, e.g. for use as a hash key
+        [[nodiscard]] constexpr uint64_t value() const {
+            return m_value;
+        }
+
+        constexpr bool operator==(const EntityHandle&) const = default;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_ENTITY_HANDLE_H
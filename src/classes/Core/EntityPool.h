@@ -0,0 +1,176 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_ENTITY_POOL_H
+#define ADS_CORE_ENTITY_POOL_H
+
+/**
+ * @file EntityPool.h
+ * @brief Slab allocator giving each entity type contiguous, stable storage
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Entities are constructed in place inside fixed-size slabs, so neighbours
+ * in a collection are usually neighbours in memory and creating or removing
+ * an entity never reaches the general-purpose heap once a slab exists.
+ * Slabs are never moved or released while the pool lives, which keeps the
+ * raw pointers handed to the inspector and the entities panel valid for as
+ * long as the entity itself.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Fixed-slab object pool with an intrusive free list
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Objects are handed out as Ptr, a std::unique_ptr whose deleter returns
+     * the slot to the pool, so owning collections keep their RAII semantics.
+     * Freed slots are reused most-recently-freed first, while they are still
+     * warm in cache. The pool must outlive every Ptr it created, and it is
+     * neither copyable nor movable because each deleter points back at it.
+     *
+     * @tparam T             Pooled type
+     * @tparam SlabCapacity  Number of objects per slab
+     */
+    template<typename T, size_t SlabCapacity = 256>
+    class EntityPool {
+    private:
+        /**
+         * @brief Storage for one object, or a free-list link while unused
+         */
+        union Slot {
+            Slot* next;
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        std::vector<std::unique_ptr<Slot[]>> m_slabs;   ///< Owned slabs, never reallocated
+        size_t m_slabUsed = SlabCapacity;               ///< Slots handed out from the newest slab
+        Slot* m_freeList = nullptr;                     ///< Head of the recycled slot list
+        size_t m_live = 0;                              ///< Objects currently constructed
+
+        /**
+         * @brief Take a slot from the free list, the newest slab, or a new slab
+         */
+        Slot* acquire() {
+            if (m_freeList != nullptr) {
+                Slot* slot = m_freeList;
+                m_freeList = slot->next;
+                return slot;
+            }
+            if (m_slabUsed == SlabCapacity) {
+                m_slabs.emplace_back(new Slot[SlabCapacity]);
+                m_slabUsed = 0;
+            }
+            return &m_slabs.back()[m_slabUsed++];
+        }
+
+        /**
+         * @brief Push a slot onto the free list
+         */
+        void release(Slot* slot) noexcept {
+            slot->next = m_freeList;
+            m_freeList = slot;
+        }
+
+        /**
+         * @brief Destroy a pooled object and recycle its slot
+         */
+        void destroy(T* object) noexcept {
+            object->~T();
+            release(reinterpret_cast<Slot*>(object));
+            --m_live;
+        }
+
+    public:
+        /**
+         * @brief unique_ptr deleter returning objects to their pool
+         */
+        class Deleter {
+        private:
+            EntityPool* m_pool = nullptr;
+
+        public:
+            Deleter() = default;
+            explicit Deleter(EntityPool* pool) : m_pool(pool) {}
+
+            void operator()(T* object) const noexcept {
+                m_pool->destroy(object);
+            }
+        };
+
+        /// Owning pointer to a pooled object
+        using Ptr = std::unique_ptr<T, Deleter>;
+
+        EntityPool() = default;
+        ~EntityPool() = default;
+
+        EntityPool(const EntityPool&) = delete;
+        EntityPool& operator=(const EntityPool&) = delete;
+        EntityPool(EntityPool&&) = delete;
+        EntityPool& operator=(EntityPool&&) = delete;
+
+        /**
+         * @brief Construct an object inside the pool
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * If the constructor throws, the slot is recycled and the exception
+         * propagates unchanged.
+         *
+         * @param args Constructor arguments forwarded to T
+         * @return Ptr Owning pointer; its address is stable until destroyed
+         */
+        template<typename... Args>
+        [[nodiscard]] Ptr make(Args&&... args) {
+            Slot* slot = acquire();
+            T* object;
+            try {
+                object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                release(slot);
+                throw;
+            }
+            ++m_live;
+            return Ptr(object, Deleter(this));
+        }
+
+        /**
+         * @brief Get the number of live objects
+         * @return size_t Objects constructed and not yet destroyed
+         */
+        [[nodiscard]] size_t size() const {
+            return m_live;
+        }
+
+        /**
+         * @brief Get the number of slots allocated across all slabs
+         * @return size_t Total slot count
+         */
+        [[nodiscard]] size_t capacity() const {
+            return m_slabs.size() * SlabCapacity;
+        }
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_ENTITY_POOL_H
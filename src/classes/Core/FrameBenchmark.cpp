@@ -0,0 +1,311 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file FrameBenchmark.cpp
+ * @brief Implementation of the headless frame benchmark
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "FrameBenchmark.h"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include "AllocationCounter.h"
+#include "ProjectStorage.h"
+
+namespace ADS::Core {
+
+    namespace {
+        uint64_t parseCount(const std::string_view option, const char* value) {
+            try {
+                size_t used = 0;
+                const unsigned long long count = std::stoull(value, &used);
+                if (value[used] == '\0') {
+                    return count;
+                }
+            } catch (const std::exception&) {
+            }
+            throw std::invalid_argument(std::format("{} expects a number, got '{}'", option, value));
+        }
+
+        /**
+         * @brief Nearest-rank percentile of sorted values
+         */
+        template<typename T>
+        T percentile(const std::vector<T>& sorted, const double fraction) {
+            const auto rank = static_cast<size_t>(fraction * static_cast<double>(sorted.size()) + 0.5);
+            return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+        }
+
+        template<typename T>
+        nlohmann::json summarize(std::vector<T> values) {
+            if (values.empty()) {
+                return nullptr;
+            }
+            std::sort(values.begin(), values.end());
+            const double total = std::accumulate(values.begin(), values.end(), 0.0);
+            return {
+                {"mean", total / static_cast<double>(values.size())},
+                {"p50", percentile(values, 0.50)},
+                {"p90", percentile(values, 0.90)},
+                {"p99", percentile(values, 0.99)},
+                {"max", values.back()}
+            };
+        }
+    }
+
+    std::optional<FrameBenchmark::Options> FrameBenchmark::parseArguments(const int argc, const char* const argv[]) {
+        bool requested = false;
+        Options parsed;
+
+        for (int index = 1; index < argc; ++index) {
+            const std::string_view option = argv[index];
+            if (index + 1 >= argc) {
+                throw std::invalid_argument(std::format("{} expects a value", option));
+            }
+            const char* value = argv[++index];
+
+            if (option == "--benchmark") {
+                parsed.frames = static_cast<uint32_t>(parseCount(option, value));
+                requested = true;
+            } else if (option == "--warmup") {
+                parsed.warmup = static_cast<uint32_t>(parseCount(option, value));
+            } else if (option == "--project") {
+                parsed.project = value;
+            } else if (option == "--entities") {
+                parsed.entities = parseCount(option, value);
+            } else if (option == "--input") {
+                parsed.input = value;
+            } else if (option == "--report") {
+                parsed.report = value;
+            } else if (option == "--trace") {
+                parsed.trace = value;
+            } else if (option == "--replay") {
+                parsed.replay = value;
+                requested = true;
+            } else if (option == "--window") {
+                parsed.window = parseCount(option, value) != 0;
+            } else if (option == "--no-allocations") {
+                parsed.noAllocations = parseCount(option, value) != 0;
+            } else {
+                throw std::invalid_argument(std::format("Unknown option {}", option));
+            }
+        }
+
+        if (!requested) {
+            return std::nullopt;
+        }
+        return parsed;
+    }
+
+    FrameBenchmark::FrameBenchmark(Options options)
+        : m_options(std::move(options)),
+          m_allocationsAtStart(0) {
+        m_frameMs.reserve(m_options.frames);
+        m_frameAllocations.reserve(m_options.frames);
+    }
+
+    const FrameBenchmark::Options& FrameBenchmark::getOptions() const {
+        return m_options;
+    }
+
+    void FrameBenchmark::loadInput() {
+        m_inputs.clear();
+        if (m_options.input.empty()) {
+            return;
+        }
+
+        std::ifstream in(m_options.input);
+        if (!in) {
+            throw std::runtime_error(std::format("Cannot read benchmark input {}", m_options.input.string()));
+        }
+
+        std::string line;
+        size_t lineNumber = 0;
+        while (std::getline(in, line)) {
+            ++lineNumber;
+            Input input;
+            try {
+                if (parseInput(line, input)) {
+                    m_inputs.push_back(std::move(input));
+                }
+            } catch (const std::runtime_error& e) {
+                throw std::runtime_error(std::format("{}:{}: {}", m_options.input.string(), lineNumber, e.what()));
+            }
+        }
+    }
+
+    bool FrameBenchmark::parseInput(const std::string& line, Input& input) {
+        std::istringstream fields(line);
+        std::string frames;
+        std::string kind;
+        if (!(fields >> frames) || frames.front() == '#') {
+            return false;
+        }
+        if (!(fields >> kind)) {
+            throw std::runtime_error("missing event");
+        }
+
+        try {
+            const size_t dash = frames.find('-');
+            input.first = static_cast<uint32_t>(std::stoul(frames.substr(0, dash)));
+            input.last = (dash == std::string::npos) ? input.first : static_cast<uint32_t>(std::stoul(frames.substr(dash + 1)));
+        } catch (const std::exception&) {
+            throw std::runtime_error(std::format("bad frame '{}'", frames));
+        }
+        if (input.last < input.first) {
+            throw std::runtime_error(std::format("empty frame range '{}'", frames));
+        }
+
+        input.x = 0.0f;
+        input.y = 0.0f;
+        if (kind == "move" || kind == "press" || kind == "release") {
+            input.kind = (kind == "move") ? Input::Kind::Move : (kind == "press") ? Input::Kind::Press : Input::Kind::Release;
+            if (!(fields >> input.x >> input.y)) {
+                throw std::runtime_error(std::format("{} expects x and y", kind));
+            }
+        } else if (kind == "wheel") {
+            input.kind = Input::Kind::Wheel;
+            if (!(fields >> input.y)) {
+                throw std::runtime_error("wheel expects notches");
+            }
+        } else if (kind == "key") {
+            input.kind = Input::Kind::Key;
+            if (!(fields >> input.text)) {
+                throw std::runtime_error("key expects a key name");
+            }
+        } else if (kind == "text") {
+            input.kind = Input::Kind::Text;
+            std::getline(fields >> std::ws, input.text);
+        } else {
+            throw std::runtime_error(std::format("unknown event '{}'", kind));
+        }
+        return true;
+    }
+
+    void FrameBenchmark::inputsFor(const uint32_t frame, std::vector<const Input*>& events) const {
+        events.clear();
+        for (const Input& input : m_inputs) {
+            if (frame >= input.first && frame <= input.last) {
+                events.push_back(&input);
+            }
+        }
+    }
+
+    std::unique_ptr<Project> FrameBenchmark::makeProject() const {
+        if (!m_options.project.empty()) {
+            return ProjectStorage::load(m_options.project);
+        }
+        if (m_options.entities > 0) {
+            return makeSyntheticProject(m_options.entities);
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<Project> FrameBenchmark::makeSyntheticProject(const size_t entities) {
+        auto project = std::make_unique<Project>(std::format("Benchmark {} entities", entities));
+
+        const size_t scenes = std::max<size_t>(entities / 2, 1);
+        const size_t characters = (entities - std::min(entities, scenes)) / 2;
+        const size_t items = entities - std::min(entities, scenes + characters);
+
+        const auto entries = [](const char* prefix, const char* name, const size_t count) {
+            std::vector<NewEntity> list;
+            list.reserve(count);
+            for (size_t index = 0; index < count; ++index) {
+                list.push_back({std::format("{}_{}", prefix, index), std::format("{} {}", name, index)});
+            }
+            return list;
+        };
+        project->addScenes(entries("scene", "Scene", scenes));
+        project->addCharacters(entries("char", "Character", characters));
+        project->addItems(entries("item", "Item", items));
+
+        for (size_t index = 0; index + 1 < scenes; ++index) {
+            project->addExit(std::format("scene_{}", index), std::format("scene_{}", index + 1));
+        }
+
+        // Nothing to save or undo: the run starts from a clean project
+        project->clearDirty();
+        return project;
+    }
+
+    void FrameBenchmark::beginFrame(const bool idle) {
+        m_allocationsAtStart = AllocationCounter::getCount();
+        m_frameStart = std::chrono::steady_clock::now();
+        if (idle && m_options.noAllocations) {
+            m_idleScope.emplace("Idle benchmark frame");
+        }
+    }
+
+    void FrameBenchmark::endFrame() {
+        const auto elapsed = std::chrono::steady_clock::now() - m_frameStart;
+        if (m_idleScope) {
+            const uint64_t violations = m_idleScope->getViolations();
+            m_idleScope.reset();
+            ++m_idleFrames;
+            m_allocatingIdleFrames += violations > 0 ? 1 : 0;
+            m_idleAllocations += violations;
+        }
+        m_frameMs.push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+        m_frameAllocations.push_back(AllocationCounter::getCount() - m_allocationsAtStart);
+    }
+
+    uint64_t FrameBenchmark::getIdleAllocations() const {
+        return m_idleAllocations;
+    }
+
+    size_t FrameBenchmark::getFrameCount() const {
+        return m_frameMs.size();
+    }
+
+    void FrameBenchmark::writeReport(std::ostream& out) const {
+        nlohmann::json report = {
+            {"frames", m_frameMs.size()},
+            {"warmup", m_options.warmup},
+            {"project", m_options.project.string()},
+            {"entities", m_options.entities},
+            {"input", m_options.input.string()},
+            {"frameMs", summarize(m_frameMs)}
+        };
+
+        if (AllocationCounter::isEnabled()) {
+            report["allocationsPerFrame"] = summarize(m_frameAllocations);
+            report["allocations"] = std::accumulate(m_frameAllocations.begin(), m_frameAllocations.end(), uint64_t{0});
+        } else {
+            // Not built with ADS_COUNT_ALLOCATIONS
+            report["allocationsPerFrame"] = nullptr;
+            report["allocations"] = nullptr;
+        }
+
+        if (m_options.noAllocations) {
+            report["idleFrames"] = {
+                {"checked", m_idleFrames},
+                {"allocating", m_allocatingIdleFrames},
+                {"allocations", m_idleAllocations}
+            };
+        }
+
+        out << report.dump(2) << '\n';
+    }
+}
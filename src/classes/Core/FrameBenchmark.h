@@ -0,0 +1,238 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_FRAME_BENCHMARK_H
+#define ADS_CORE_FRAME_BENCHMARK_H
+
+/**
+ * @file FrameBenchmark.h
+ * @brief Settings, scripted input and statistics of a headless frame benchmark
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * App::runBenchmark() draws a fixed number of frames with no display and
+ * no GPU; this class holds everything about the run that does not touch
+ * SDL or ImGui, so the numbers it reports are measured the same way on
+ * every machine.
+ *
+ * @see ADS::Core::App::runBenchmark(), ADS::Core::AllocationCounter
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Frame times and allocation counts of a headless run
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Started with `--benchmark <frames>` or `--replay <file>` on the command line:
+     *
+     *   --benchmark <n>      Frames to measure
+     *   --warmup <n>         Frames drawn first and not measured (default 10)
+     *   --project <file>     Project to load, or
+     *   --entities <n>       Synthetic project with n entities
+     *   --input <file>       Scripted input
+     *   --report <file>      JSON report; printed to stdout if omitted
+     *   --trace <file>       Chrome trace of the measured frames
+     *   --replay <file>      Input log to replay, from the first frame drawn,
+     *                        instead of the script; without --benchmark, or
+     *                        with 0, every frame of the log after the warm-up
+     *                        is measured
+     *   --window <0|1>       1 draws in a window instead of headless
+     *   --no-allocations <0|1>
+     *                        1 reports every heap allocation of a measured
+     *                        frame with no input, with its call stack, and
+     *                        fails the run if there was any; needs a build
+     *                        with ADS_COUNT_ALLOCATIONS
+     *
+     * The input script has one event per line, `#` starting a comment.
+     * Frames count from 0 after the warm-up; `first-last` repeats the event
+     * on every frame of the range:
+     *
+     *   <frames> move <x> <y>       Mouse position
+     *   <frames> press <x> <y>      Left button down there
+     *   <frames> release <x> <y>    Left button up there
+     *   <frames> wheel <dy>         Vertical scroll, in notches
+     *   <frames> key <name>         Key press and release, by SDL key name
+     *   <frames> text <text>        Typed text, the rest of the line
+     */
+    class FrameBenchmark {
+    public:
+        /**
+         * @brief Command line settings of a run
+         */
+        struct Options {
+            uint32_t frames = 0;
+            uint32_t warmup = 10;
+            std::filesystem::path project;      ///< Empty unless --project
+            size_t entities = 0;                ///< 0 unless --entities
+            std::filesystem::path input;        ///< Empty for no scripted input
+            std::filesystem::path report;       ///< Empty to print the report
+            std::filesystem::path trace;        ///< Empty for no trace
+            std::filesystem::path replay;       ///< Empty unless --replay
+            bool window = false;                ///< Draw in a window, with the configured renderer
+            bool noAllocations = false;         ///< Idle frames must not allocate
+        };
+
+        /**
+         * @brief One scripted input event
+         */
+        struct Input {
+            enum class Kind : uint8_t {
+                Move,
+                Press,
+                Release,
+                Wheel,
+                Key,
+                Text
+            };
+
+            uint32_t first;     ///< First measured frame it is sent on
+            uint32_t last;      ///< Last one, the same as first unless a range was given
+            Kind kind;
+            float x;            ///< Mouse position
+            float y;            ///< Mouse position, or the notches of a wheel event
+            std::string text;   ///< Key name or typed text
+        };
+
+        /**
+         * @brief Read the benchmark settings from the command line
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return std::optional<Options> Nothing unless --benchmark or --replay was given
+         * @throws std::invalid_argument on an unknown option or a missing value
+         */
+        [[nodiscard]] static std::optional<Options> parseArguments(int argc, const char* const argv[]);
+
+        explicit FrameBenchmark(Options options);
+
+        /**
+         * @brief Get the settings of the run
+         */
+        [[nodiscard]] const Options& getOptions() const;
+
+        /**
+         * @brief Read the scripted input named by the options, if any
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @throws std::runtime_error if the file cannot be read or a line is malformed
+         */
+        void loadInput();
+
+        /**
+         * @brief Get the events to send before a measured frame
+         *
+         * @param frame Measured frame, from 0
+         * @param events Replaced by the events, in script order
+         */
+        void inputsFor(uint32_t frame, std::vector<const Input*>& events) const;
+
+        /**
+         * @brief Build the project the run draws
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return std::unique_ptr<Project> The project file or a synthetic
+         *         project, or null to keep the IDE's own
+         */
+        [[nodiscard]] std::unique_ptr<Project> makeProject() const;
+
+        /**
+         * @brief Make a project with entities spread over every kind
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Half are scenes, a quarter characters and a quarter items. Each
+         * scene has an exit to the next one, so graph views have edges.
+         *
+         * @param entities Entities in total
+         */
+        [[nodiscard]] static std::unique_ptr<Project> makeSyntheticProject(size_t entities);
+
+        /**
+         * @brief Mark the start of a measured frame
+         *
+         * @param idle No input is sent on the frame; with --no-allocations
+         *        the frame runs inside a NoAllocationScope
+         */
+        void beginFrame(bool idle);
+
+        /**
+         * @brief Record the frame started by beginFrame()
+         */
+        void endFrame();
+
+        /**
+         * @brief Get the allocations made by idle frames under --no-allocations
+         * @return uint64_t Violations so far; 0 without the option
+         */
+        [[nodiscard]] uint64_t getIdleAllocations() const;
+
+        /**
+         * @brief Get the frames recorded so far
+         */
+        [[nodiscard]] size_t getFrameCount() const;
+
+        /**
+         * @brief Write the statistics of the recorded frames as JSON
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Frame times in milliseconds and allocations per frame, each with
+         * its mean, median, 90th and 99th percentiles and maximum; with
+         * --no-allocations, also the idle frames that allocated.
+         */
+        void writeReport(std::ostream& out) const;
+
+    private:
+        Options m_options;
+        std::vector<Input> m_inputs;
+        std::vector<double> m_frameMs;                  ///< Time of each recorded frame
+        std::vector<uint64_t> m_frameAllocations;       ///< Allocations of each recorded frame
+        std::chrono::steady_clock::time_point m_frameStart;
+        uint64_t m_allocationsAtStart;
+        std::optional<AllocationCounter::NoAllocationScope> m_idleScope;   ///< Open from beginFrame() to endFrame()
+        uint32_t m_idleFrames = 0;              ///< Idle frames checked for allocations
+        uint32_t m_allocatingIdleFrames = 0;    ///< Of those, the ones that allocated
+        uint64_t m_idleAllocations = 0;
+
+        /**
+         * @brief Parse one line of the input script
+         * @return bool False for blank and comment lines
+         * @throws std::runtime_error if the line is malformed
+         */
+        static bool parseInput(const std::string& line, Input& input);
+    };
+}
+
+#endif // ADS_CORE_FRAME_BENCHMARK_H
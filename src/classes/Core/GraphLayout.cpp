@@ -0,0 +1,436 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file GraphLayout.cpp
+ * @brief Implementation of the threaded Barnes–Hut scene graph layout
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "GraphLayout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+namespace ADS::Core {
+
+    /// Angle between consecutive spiral seeds, spreads them evenly
+    static constexpr float GOLDEN_ANGLE = 2.39996323f;
+
+    /// A run has converged once no node moves more than this fraction of the edge length
+    static constexpr float CONVERGED_STEP = 0.002f;
+
+    GraphLayout::GraphLayout()
+        : m_temperature(0.0f),
+          m_workerCount(0),
+          m_done(false),
+          m_stopRequested(false),
+          m_iteration(0),
+          m_state(State::Idle),
+          m_publishedFrame(0),
+          m_fetchedFrame(0) {
+    }
+
+    GraphLayout::~GraphLayout() {
+        stop();
+    }
+
+    bool GraphLayout::start(const Project& project) {
+        return start(project, Settings{});
+    }
+
+    /**
+     * @brief Copy the scene graph of a project and begin laying it out
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Exits are turned into an undirected adjacency without self-loops or
+     * duplicates, since two scenes leading to each other attract as one
+     * edge. The first quadtree is built here so the workers can start with
+     * the force phase.
+     *
+     * @param project  Project whose scenes and exits are laid out
+     * @param settings Tuning of this run
+     * @return bool False if a layout is already running
+     */
+    bool GraphLayout::start(const Project& project, const Settings& settings) {
+        if (isRunning()) {
+            return false;
+        }
+        join();
+
+        std::unordered_map<uint64_t, ImVec2> previous;
+        {
+            std::lock_guard lock(m_publishMutex);
+            for (size_t i = 0; i < m_handles.size() && i < m_published.size(); ++i) {
+                previous.emplace(m_handles[i].value(), m_published[i]);
+            }
+        }
+
+        const auto& scenes = project.getScenes();
+        const auto nodeCount = static_cast<uint32_t>(scenes.size());
+        m_settings = settings;
+        m_handles.clear();
+        m_positions.clear();
+        m_handles.reserve(nodeCount);
+        m_positions.reserve(nodeCount);
+
+        // Scene handle index → node, for the exits
+        std::vector<uint32_t> nodeOf;
+        for (uint32_t node = 0; node < nodeCount; ++node) {
+            const EntityHandle handle = scenes[node]->getHandle();
+            m_handles.push_back(handle);
+            if (handle.index() >= nodeOf.size()) {
+                nodeOf.resize(handle.index() + 1);
+            }
+            nodeOf[handle.index()] = node;
+
+            if (const auto it = previous.find(handle.value()); it != previous.end()) {
+                m_positions.push_back(it->second);
+            } else {
+                const float radius = settings.edgeLength * 0.5f * std::sqrt(static_cast<float>(node));
+                const float angle = GOLDEN_ANGLE * static_cast<float>(node);
+                m_positions.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+            }
+        }
+
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        for (uint32_t node = 0; node < nodeCount; ++node) {
+            for (const Entities::Scene* target : project.getExits(*scenes[node])) {
+                const uint32_t other = nodeOf[target->getHandle().index()];
+                if (other != node) {
+                    edges.emplace_back(node, other);
+                    edges.emplace_back(other, node);
+                }
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        m_offsets.assign(nodeCount + 1, 0);
+        m_neighbours.clear();
+        m_neighbours.reserve(edges.size());
+        for (const auto& [from, to] : edges) {
+            ++m_offsets[from + 1];
+            m_neighbours.push_back(to);
+        }
+        for (uint32_t node = 0; node < nodeCount; ++node) {
+            m_offsets[node + 1] += m_offsets[node];
+        }
+
+        m_displacements.assign(nodeCount, ImVec2(0.0f, 0.0f));
+        m_temperature = settings.edgeLength * (1.0f + 0.1f * std::sqrt(static_cast<float>(nodeCount)));
+        buildTree();
+        {
+            std::lock_guard lock(m_publishMutex);
+            m_published = m_positions;
+            ++m_publishedFrame;
+        }
+
+        // Small graphs are not worth waking every core for
+        const unsigned cores = settings.threads != 0 ? settings.threads : std::max(1u, std::thread::hardware_concurrency());
+        m_workerCount = std::clamp(nodeCount / 256 + 1, 1u, cores);
+        m_done = nodeCount == 0;
+        m_stopRequested.store(false, std::memory_order_relaxed);
+        m_iteration.store(0, std::memory_order_relaxed);
+        m_state.store(m_done ? State::Converged : State::Running, std::memory_order_release);
+        if (m_done) {
+            return true;
+        }
+
+        m_barrier = std::make_unique<std::barrier<>>(static_cast<std::ptrdiff_t>(m_workerCount));
+        for (unsigned worker = 0; worker < m_workerCount; ++worker) {
+            m_workers.emplace_back(&GraphLayout::run, this, worker);
+        }
+        return true;
+    }
+
+    void GraphLayout::stop() {
+        m_stopRequested.store(true, std::memory_order_relaxed);
+        join();
+    }
+
+    void GraphLayout::join() {
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+        m_barrier.reset();
+    }
+
+    /**
+     * @brief Worker body: compute the forces of one node range per iteration
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each iteration has two phases separated by the barrier. In the first,
+     * every worker reads the shared positions and quadtree and writes the
+     * displacements of its own range only. In the second, worker 0 alone
+     * moves the nodes and rebuilds the tree while the others wait, so no
+     * data is ever written while another thread reads it.
+     *
+     * @param worker Index of the worker, 0 being the coordinator
+     */
+    void GraphLayout::run(unsigned worker) {
+        const auto nodeCount = static_cast<uint32_t>(m_positions.size());
+        const uint32_t chunk = (nodeCount + m_workerCount - 1) / m_workerCount;
+        const uint32_t begin = std::min(nodeCount, worker * chunk);
+        const uint32_t end = std::min(nodeCount, begin + chunk);
+
+        while (true) {
+            computeForces(begin, end);
+            m_barrier->arrive_and_wait();
+            if (worker == 0) {
+                m_done = integrate();
+            }
+            m_barrier->arrive_and_wait();
+            if (m_done) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Compute the displacement of every node in [begin, end)
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Repulsion k²/d is summed over the quadtree, opening a cell only when
+     * its size exceeds theta times its distance. Attraction d²/k acts along
+     * each edge, and a weak pull proportional to the distance from the
+     * origin keeps disconnected parts of the graph from drifting apart.
+     */
+    void GraphLayout::computeForces(uint32_t begin, uint32_t end) {
+        const float k = m_settings.edgeLength;
+        const float k2 = k * k;
+        const float theta2 = m_settings.theta * m_settings.theta;
+        std::vector<int32_t> stack;
+        stack.reserve(4 * MAX_DEPTH);
+
+        for (uint32_t node = begin; node < end; ++node) {
+            const ImVec2 position = m_positions[node];
+            float forceX = 0.0f;
+            float forceY = 0.0f;
+
+            stack.push_back(0);
+            while (!stack.empty()) {
+                const Cell& cell = m_cells[stack.back()];
+                stack.pop_back();
+                if (cell.mass == 0.0f || (cell.firstChild < 0 && cell.body == static_cast<int32_t>(node))) {
+                    continue;
+                }
+                float dx = position.x - cell.centerX;
+                float dy = position.y - cell.centerY;
+                float distance2 = dx * dx + dy * dy;
+                if (cell.firstChild >= 0 && cell.size * cell.size >= theta2 * distance2) {
+                    for (int32_t child = 0; child < 4; ++child) {
+                        stack.push_back(cell.firstChild + child);
+                    }
+                    continue;
+                }
+                if (distance2 < MIN_DISTANCE * MIN_DISTANCE) {
+                    // Coincident bodies: separate them in a node-dependent direction
+                    dx = MIN_DISTANCE * static_cast<float>(node % 7 + 1);
+                    dy = MIN_DISTANCE * static_cast<float>(node % 5 + 1);
+                    distance2 = dx * dx + dy * dy;
+                }
+                const float strength = k2 * cell.mass / distance2;
+                forceX += dx * strength;
+                forceY += dy * strength;
+            }
+
+            for (uint32_t i = m_offsets[node]; i < m_offsets[node + 1]; ++i) {
+                const ImVec2 other = m_positions[m_neighbours[i]];
+                const float dx = other.x - position.x;
+                const float dy = other.y - position.y;
+                const float distance = std::sqrt(dx * dx + dy * dy);
+                forceX += dx * distance / k;
+                forceY += dy * distance / k;
+            }
+
+            forceX -= position.x * m_settings.gravity;
+            forceY -= position.y * m_settings.gravity;
+            m_displacements[node] = ImVec2(forceX, forceY);
+        }
+    }
+
+    /**
+     * @brief Apply the displacements, publish and decide whether to continue
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Every node moves along its force by at most the current temperature,
+     * which cools geometrically. The run ends when stop() was called, when
+     * the largest step falls below CONVERGED_STEP of the edge length, or
+     * at the iteration limit.
+     *
+     * @return bool True to stop iterating
+     */
+    bool GraphLayout::integrate() {
+        float largestStep = 0.0f;
+        for (size_t node = 0; node < m_positions.size(); ++node) {
+            const ImVec2 force = m_displacements[node];
+            const float length = std::sqrt(force.x * force.x + force.y * force.y);
+            if (length <= 0.0f || !std::isfinite(length)) {
+                continue;
+            }
+            const float step = std::min(length, m_temperature);
+            m_positions[node].x += force.x / length * step;
+            m_positions[node].y += force.y / length * step;
+            largestStep = std::max(largestStep, step);
+        }
+        m_temperature *= m_settings.cooling;
+        buildTree();
+
+        {
+            std::lock_guard lock(m_publishMutex);
+            m_published = m_positions;
+            ++m_publishedFrame;
+        }
+        const uint32_t iteration = m_iteration.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        if (m_stopRequested.load(std::memory_order_relaxed)) {
+            m_state.store(State::Stopped, std::memory_order_release);
+            return true;
+        }
+        if (largestStep < CONVERGED_STEP * m_settings.edgeLength || iteration >= m_settings.maxIterations) {
+            m_state.store(State::Converged, std::memory_order_release);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Rebuild m_cells from m_positions
+     *
+     * The root is the bounding square of all nodes, slightly enlarged so
+     * boundary nodes fall strictly inside.
+     */
+    void GraphLayout::buildTree() {
+        m_cells.clear();
+        if (m_positions.empty()) {
+            return;
+        }
+        float minX = m_positions[0].x;
+        float minY = m_positions[0].y;
+        float maxX = minX;
+        float maxY = minY;
+        for (const ImVec2& position : m_positions) {
+            minX = std::min(minX, position.x);
+            minY = std::min(minY, position.y);
+            maxX = std::max(maxX, position.x);
+            maxY = std::max(maxY, position.y);
+        }
+        const float size = std::max({maxX - minX, maxY - minY, 1.0f}) * 1.001f;
+
+        m_cells.reserve(2 * m_positions.size() + 1);
+        m_cells.push_back({0.0f, 0.0f, 0.0f, minX, minY, size, -1, -1});
+        for (uint32_t body = 0; body < m_positions.size(); ++body) {
+            insert(body);
+        }
+    }
+
+    /**
+     * @brief Insert one body into the quadtree
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Walks down from the root updating each cell's centre of mass. An
+     * occupied leaf is split and its body pushed one level down; at
+     * MAX_DEPTH bodies are merged into the leaf instead, which only
+     * happens for (nearly) coincident positions.
+     */
+    void GraphLayout::insert(uint32_t body) {
+        const ImVec2 position = m_positions[body];
+        int32_t index = 0;
+        for (int depth = 0;; ++depth) {
+            Cell& cell = m_cells[index];
+            cell.centerX = (cell.centerX * cell.mass + position.x) / (cell.mass + 1.0f);
+            cell.centerY = (cell.centerY * cell.mass + position.y) / (cell.mass + 1.0f);
+            cell.mass += 1.0f;
+
+            if (cell.firstChild < 0) {
+                if (cell.mass == 1.0f) {
+                    cell.body = static_cast<int32_t>(body);
+                    return;
+                }
+                if (depth >= MAX_DEPTH) {
+                    return;
+                }
+
+                // Split: the resident body moves into its quadrant
+                const int32_t resident = cell.body;
+                const float half = cell.size * 0.5f;
+                const float minX = cell.minX;
+                const float minY = cell.minY;
+                const auto firstChild = static_cast<int32_t>(m_cells.size());
+                cell.firstChild = firstChild;
+                cell.body = -1;
+                for (int32_t quadrant = 0; quadrant < 4; ++quadrant) {
+                    m_cells.push_back({0.0f, 0.0f, 0.0f,
+                                       minX + ((quadrant & 1) != 0 ? half : 0.0f),
+                                       minY + ((quadrant & 2) != 0 ? half : 0.0f),
+                                       half, -1, -1});
+                }
+                const ImVec2 residentPosition = m_positions[resident];
+                const int32_t residentQuadrant = (residentPosition.x >= minX + half ? 1 : 0)
+                                                 | (residentPosition.y >= minY + half ? 2 : 0);
+                Cell& target = m_cells[firstChild + residentQuadrant];
+                target.centerX = residentPosition.x;
+                target.centerY = residentPosition.y;
+                target.mass = 1.0f;
+                target.body = resident;
+            }
+
+            // Re-fetch: splitting may have reallocated m_cells
+            const Cell& parent = m_cells[index];
+            const float half = parent.size * 0.5f;
+            index = parent.firstChild + ((position.x >= parent.minX + half ? 1 : 0)
+                                         | (position.y >= parent.minY + half ? 2 : 0));
+        }
+    }
+
+    bool GraphLayout::fetchPositions(std::vector<NodePosition>& out) {
+        std::lock_guard lock(m_publishMutex);
+        if (m_publishedFrame == m_fetchedFrame) {
+            return false;
+        }
+        m_fetchedFrame = m_publishedFrame;
+        out.resize(m_published.size());
+        for (size_t i = 0; i < m_published.size(); ++i) {
+            out[i] = {m_handles[i], m_published[i]};
+        }
+        return true;
+    }
+
+    bool GraphLayout::isRunning() const {
+        return m_state.load(std::memory_order_acquire) == State::Running;
+    }
+
+    GraphLayout::State GraphLayout::getState() const {
+        return m_state.load(std::memory_order_acquire);
+    }
+
+    uint32_t GraphLayout::getIteration() const {
+        return m_iteration.load(std::memory_order_relaxed);
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,240 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_GRAPH_LAYOUT_H
+#define ADS_CORE_GRAPH_LAYOUT_H
+
+/**
+ * @file GraphLayout.h
+ * @brief Force-directed auto-layout of the scene graph on worker threads
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Fruchterman–Reingold layout with Barnes–Hut approximation of the
+ * repulsive forces: every iteration builds a quadtree over the current
+ * positions, and a node treats any cell that looks small enough from where
+ * it stands as a single body. One iteration is O(n log n) instead of
+ * O(n²), so graphs with tens of thousands of scenes settle in seconds.
+ *
+ * Like BackgroundSaver, the live project is only read by start() on the
+ * main thread; the workers operate on their own copy of the graph.
+ *
+ * @see ADS::Core::SceneGraph
+ */
+
+#include <atomic>
+#include <barrier>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "imgui.h"
+
+#include "EntityHandle.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Runs one scene graph layout at a time off the main thread
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * All public methods must be called from the main thread. Forces are
+     * computed in parallel over contiguous node ranges, one per worker;
+     * the first worker additionally moves the nodes, rebuilds the quadtree
+     * and publishes the positions between two barrier phases. The renderer
+     * picks up the latest published positions with fetchPositions() each
+     * frame, so it can draw the graph while it is still settling.
+     */
+    class GraphLayout {
+    public:
+        /**
+         * @brief Lifecycle of the most recent layout
+         */
+        enum class State : uint8_t {
+            Idle,       ///< No layout has been started yet
+            Running,    ///< Workers are iterating
+            Converged,  ///< Movement dropped below the threshold or the iteration limit was hit
+            Stopped     ///< stop() ended the layout early
+        };
+
+        /**
+         * @brief Tuning of a layout run
+         */
+        struct Settings {
+            float edgeLength = 160.0f;      ///< Preferred distance between connected scenes
+            float theta = 0.9f;             ///< Barnes–Hut opening angle; 0 computes every pair exactly
+            float gravity = 1.0f;           ///< Pull towards the origin, keeps disconnected parts together
+            float cooling = 0.97f;          ///< Per-iteration factor applied to the maximum step
+            uint32_t maxIterations = 600;   ///< Hard iteration limit
+            unsigned threads = 0;           ///< Worker count; 0 picks one per core
+        };
+
+        /**
+         * @brief Position of one scene
+         */
+        struct NodePosition {
+            EntityHandle scene;     ///< Scene the position belongs to
+            ImVec2 position;        ///< Centre of the scene node, in graph units
+        };
+
+        GraphLayout();
+
+        /**
+         * @brief Stop and join a running layout before destruction
+         */
+        ~GraphLayout();
+
+        GraphLayout(const GraphLayout&) = delete;
+        GraphLayout& operator=(const GraphLayout&) = delete;
+
+        /**
+         * @brief Copy the scene graph of a project and begin laying it out
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Scenes that were part of the previous run keep their last position
+         * as a starting point, so re-running after an edit only relaxes the
+         * neighbourhood of the change. Other scenes start on a spiral.
+         *
+         * @param project  Project whose scenes and exits are laid out
+         * @param settings Tuning of this run
+         * @return bool False if a layout is already running
+         */
+        bool start(const Project& project, const Settings& settings);
+
+        /// @copydoc start(const Project&, const Settings&)
+        bool start(const Project& project);
+
+        /**
+         * @brief End a running layout and wait for the workers
+         *
+         * The positions published last stay available to fetchPositions().
+         */
+        void stop();
+
+        /**
+         * @brief Copy the latest published positions
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param out Replaced with one entry per scene, in project order
+         * @return bool True if the positions changed since the previous call;
+         *         @p out is left untouched otherwise
+         */
+        bool fetchPositions(std::vector<NodePosition>& out);
+
+        /**
+         * @brief Check whether the workers are still iterating
+         * @return bool True from start() until the layout converges or is stopped
+         */
+        [[nodiscard]] bool isRunning() const;
+
+        /**
+         * @brief Get the state of the most recent layout
+         * @return State Current state
+         */
+        [[nodiscard]] State getState() const;
+
+        /**
+         * @brief Get the number of completed iterations of the current run
+         * @return uint32_t Iteration count
+         */
+        [[nodiscard]] uint32_t getIteration() const;
+
+    private:
+        /**
+         * @brief Quadtree node; a leaf holds at most one body unless it is at MAX_DEPTH
+         */
+        struct Cell {
+            float centerX;          ///< Centre of mass
+            float centerY;
+            float mass;             ///< Number of bodies inside
+            float minX;             ///< Square covered by the cell
+            float minY;
+            float size;
+            int32_t firstChild;     ///< Index of the first of four children, -1 for a leaf
+            int32_t body;           ///< Node held by a leaf, -1 if none
+        };
+
+        static constexpr int MAX_DEPTH = 24;            ///< Deeper cells merge coincident bodies
+        static constexpr float MIN_DISTANCE = 0.01f;    ///< Floor for distances, avoids division by zero
+
+        /**
+         * @brief Worker body: compute the forces of one node range per iteration
+         *
+         * @param worker Index of the worker, 0 being the coordinator
+         */
+        void run(unsigned worker);
+
+        /**
+         * @brief Compute the displacement of every node in [begin, end)
+         */
+        void computeForces(uint32_t begin, uint32_t end);
+
+        /**
+         * @brief Apply the displacements, publish and decide whether to continue
+         *
+         * Runs on worker 0 while the other workers wait at the barrier.
+         *
+         * @return bool True to stop iterating
+         */
+        bool integrate();
+
+        /**
+         * @brief Rebuild m_cells from m_positions
+         */
+        void buildTree();
+
+        /**
+         * @brief Insert one body into the quadtree
+         */
+        void insert(uint32_t body);
+
+        /**
+         * @brief Join the workers of the previous run
+         */
+        void join();
+
+        Settings m_settings;                        ///< Tuning of the current run
+        std::vector<EntityHandle> m_handles;        ///< Scene of each node
+        std::vector<uint32_t> m_offsets;            ///< Undirected adjacency rows, CSR
+        std::vector<uint32_t> m_neighbours;         ///< Undirected adjacency targets, CSR
+        std::vector<ImVec2> m_positions;            ///< Current positions, written by worker 0 only
+        std::vector<ImVec2> m_displacements;        ///< Per-node force of this iteration
+        std::vector<Cell> m_cells;                  ///< Quadtree of m_positions, root at 0
+        float m_temperature;                        ///< Maximum step of this iteration
+
+        std::vector<std::thread> m_workers;         ///< Force workers; worker 0 also integrates
+        std::unique_ptr<std::barrier<>> m_barrier;  ///< Separates the force and integration phases
+        unsigned m_workerCount;                     ///< Number of workers in the current run
+        bool m_done;                                ///< Set by worker 0 between barrier phases
+        std::atomic<bool> m_stopRequested;          ///< Set by stop()
+        std::atomic<uint32_t> m_iteration;          ///< Completed iterations
+        std::atomic<State> m_state;                 ///< Lifecycle, written by both sides
+
+        std::mutex m_publishMutex;                  ///< Guards m_published
+        std::vector<ImVec2> m_published;            ///< Positions of the latest finished iteration
+        uint64_t m_publishedFrame;                  ///< Bumped on every publish, guarded by m_publishMutex
+        uint64_t m_fetchedFrame;                    ///< Frame returned by the last fetchPositions()
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_GRAPH_LAYOUT_H
@@ -0,0 +1,291 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file IdGenerator.cpp
+ * @brief Implementation of the IdGenerator class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "IdGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+namespace ADS::Core {
+    namespace {
+        constexpr uint64_t EPOCH_MS = 1735689600000ull;     ///< 2025-01-01T00:00:00Z
+        constexpr int SEQUENCE_BITS = 12;
+        constexpr int SLOT_BITS = 10;
+        constexpr uint32_t MAX_SEQUENCE = (1u << SEQUENCE_BITS) - 1;
+        constexpr uint64_t MAX_TIME = (1ull << (64 - SLOT_BITS - SEQUENCE_BITS)) - 1;
+
+        static_assert(IdGenerator::MAX_THREADS == 1u << SLOT_BITS);
+
+        constexpr std::string_view CROCKFORD = "0123456789abcdefghjkmnpqrstvwxyz";
+        constexpr std::string_view HEX = "0123456789abcdef";
+
+        /**
+         * @brief Splitmix64, enough for the random bits of a UUID
+         */
+        uint64_t mix(uint64_t& state) {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        uint64_t randomSeed() {
+            std::random_device device;
+            return (static_cast<uint64_t>(device()) << 32) ^ device();
+        }
+
+        /**
+         * @brief Slots not held by a thread, and the last millisecond each one issued
+         *
+         * A slot goes into an id offset by a random base of the process, so
+         * two processes that start together do not hand out the same slots.
+         */
+        class SlotTable {
+        public:
+            SlotTable() : m_seed(randomSeed()) {
+                m_free.reserve(IdGenerator::MAX_THREADS);
+                for (size_t slot = IdGenerator::MAX_THREADS; slot-- > 0;) {
+                    m_free.push_back(static_cast<uint32_t>(slot));
+                }
+                m_base = static_cast<uint32_t>(mix(m_seed));
+            }
+
+            /**
+             * @return uint32_t Slot; lastMs set to the last millisecond it issued
+             */
+            uint32_t acquire(uint64_t& lastMs, uint64_t& seed) {
+                std::lock_guard lock(m_mutex);
+                if (m_free.empty()) {
+                    throw std::runtime_error("Too many threads are making ids at once");
+                }
+                const uint32_t slot = m_free.back();
+                m_free.pop_back();
+                lastMs = m_lastMs[slot];
+                seed = mix(m_seed);
+                return slot;
+            }
+
+            void release(const uint32_t slot, const uint64_t lastMs) {
+                std::lock_guard lock(m_mutex);
+                m_lastMs[slot] = lastMs;
+                m_free.push_back(slot);
+            }
+
+            /**
+             * @return uint32_t The slot as it goes into an id
+             */
+            [[nodiscard]] uint32_t tag(const uint32_t slot) const {
+                return (slot + m_base) & (IdGenerator::MAX_THREADS - 1);
+            }
+
+            /**
+             * @brief Give a forked child a base and random stream of its own
+             *
+             * Called in the child with the mutex still held from before the fork.
+             */
+            [[nodiscard]] uint64_t reseed() {
+                m_seed = randomSeed();
+                m_base = static_cast<uint32_t>(mix(m_seed));
+                return mix(m_seed);
+            }
+
+            std::mutex& mutex() { return m_mutex; }
+
+        private:
+            std::mutex m_mutex;
+            std::vector<uint32_t> m_free;
+            std::array<uint64_t, IdGenerator::MAX_THREADS> m_lastMs{};
+            uint64_t m_seed;
+            uint32_t m_base;
+        };
+
+        SlotTable& slotTable() {
+            // Outlives every thread_local that gives a slot back
+            static SlotTable* const table = new SlotTable();
+            return *table;
+        }
+
+        /**
+         * @brief The slot, clock and counter of one thread
+         */
+        class ThreadState {
+        public:
+            ThreadState() : m_slot(slotTable().acquire(m_lastMs, m_random)) {
+                // Whatever the previous holder of the slot issued in its last millisecond is taken
+                m_sequence = MAX_SEQUENCE;
+                m_tag = slotTable().tag(m_slot);
+                s_current = this;
+            }
+
+            ~ThreadState() {
+                s_current = nullptr;
+                slotTable().release(m_slot, m_lastMs);
+            }
+
+            /**
+             * @brief The state of the calling thread, if it has made an id yet
+             */
+            [[nodiscard]] static ThreadState* current() { return s_current; }
+
+            /**
+             * @brief Take a new random stream and tag after a fork, keeping the clock
+             */
+            void reseed(const uint64_t seed) {
+                m_random = seed;
+                m_tag = slotTable().tag(m_slot);
+            }
+
+            ThreadState(const ThreadState&) = delete;
+            ThreadState& operator=(const ThreadState&) = delete;
+
+            /**
+             * @brief Move to the next (millisecond, counter) pair of this thread
+             */
+            void advance() {
+                const auto now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+                if (now > m_lastMs) {
+                    m_lastMs = now;
+                    m_sequence = 0;
+                } else if (m_sequence < MAX_SEQUENCE) {
+                    ++m_sequence;
+                } else {
+                    // Counter used up, or the clock went back: borrow the next millisecond
+                    ++m_lastMs;
+                    m_sequence = 0;
+                }
+            }
+
+            [[nodiscard]] uint64_t id() const {
+                const uint64_t time = std::min(m_lastMs - std::min(m_lastMs, EPOCH_MS), MAX_TIME);
+                return time << (SLOT_BITS + SEQUENCE_BITS) | static_cast<uint64_t>(m_tag) << SEQUENCE_BITS | m_sequence;
+            }
+
+            [[nodiscard]] Uuid uuid() {
+                Uuid uuid;
+                // unix_ts_ms (48) | ver (4) | rand_a (12): the counter
+                uuid.high = (m_lastMs & 0xFFFFFFFFFFFFull) << 16 | 0x7000u | m_sequence;
+                // var (2) | rand_b (62): the slot, then random bits
+                uuid.low = 0x8000000000000000ull | static_cast<uint64_t>(m_tag) << 52 | (mix(m_random) >> 12);
+                return uuid;
+            }
+
+        private:
+            static thread_local ThreadState* s_current;
+
+            uint64_t m_lastMs = 0;
+            uint64_t m_random = 0;
+            uint32_t m_slot;
+            uint32_t m_tag = 0;
+            uint32_t m_sequence = 0;
+        };
+
+        thread_local ThreadState* ThreadState::s_current = nullptr;
+
+#ifndef _WIN32
+        /**
+         * @brief Keep a forked child from repeating the ids of its parent
+         *
+         * The child starts with a copy of the parent's random streams, so it
+         * takes new ones. Only the forking thread lives on in the child.
+         */
+        const bool forkHandlers = [] {
+            pthread_atfork(
+                [] { slotTable().mutex().lock(); },
+                [] { slotTable().mutex().unlock(); },
+                [] {
+                    const uint64_t seed = slotTable().reseed();
+                    slotTable().mutex().unlock();
+                    if (ThreadState* state = ThreadState::current()) {
+                        state->reseed(seed);
+                    }
+                });
+            return true;
+        }();
+#endif
+
+        ThreadState& threadState() {
+            thread_local ThreadState state;
+            return state;
+        }
+
+        /**
+         * @brief Five bits of a UUID, counted from the least significant
+         */
+        uint32_t uuidBits(const Uuid& uuid, const int offset) {
+            if (offset >= 64) {
+                return static_cast<uint32_t>(uuid.high >> (offset - 64)) & 0x1F;
+            }
+            const uint64_t bits = offset > 59 ? uuid.low >> offset | uuid.high << (64 - offset) : uuid.low >> offset;
+            return static_cast<uint32_t>(bits) & 0x1F;
+        }
+    }
+
+    std::string Uuid::toString() const {
+        std::string text(36, '-');
+        size_t position = 0;
+        for (int nibble = 0; nibble < 32; ++nibble) {
+            if (position == 8 || position == 13 || position == 18 || position == 23) {
+                ++position;
+            }
+            const uint64_t half = nibble < 16 ? high : low;
+            text[position++] = HEX[(half >> (60 - 4 * (nibble % 16))) & 0xF];
+        }
+        return text;
+    }
+
+    uint64_t IdGenerator::next() {
+        ThreadState& state = threadState();
+        state.advance();
+        return state.id();
+    }
+
+    Uuid IdGenerator::nextUuid() {
+        ThreadState& state = threadState();
+        state.advance();
+        return state.uuid();
+    }
+
+    std::string IdGenerator::makeEntityId(const std::string_view prefix) {
+        const Uuid uuid = nextUuid();
+        std::string text;
+        text.reserve(prefix.size() + 27);
+        text += prefix;
+        text += '_';
+        // 26 digits of 5 bits cover 130 bits; the first digit holds the top 3
+        for (int digit = 25; digit >= 0; --digit) {
+            text += CROCKFORD[uuidBits(uuid, 5 * digit)];
+        }
+        return text;
+    }
+
+    uint64_t IdGenerator::getUnixMs(const uint64_t id) {
+        return (id >> (SLOT_BITS + SEQUENCE_BITS)) + EPOCH_MS;
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ImportParser.cpp
+ * @brief Implementation of the ImportParser class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ImportParser.h"
+
+#include <format>
+#include <istream>
+#include <streambuf>
+
+#include "CsvImportParser.h"
+#include "InformImportParser.h"
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+    namespace {
+        /**
+         * @brief Lowercase extension of a path, without the dot
+         */
+        std::string extensionOf(const std::filesystem::path& path) {
+            std::string extension = path.extension().string();
+            if (!extension.empty()) {
+                extension.erase(0, 1);
+            }
+            for (char& c : extension) {
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+            }
+            return extension;
+        }
+    }
+
+    ImportParser::ImportParser(std::istream& in) : m_in(in) {}
+
+    uint64_t ImportParser::getBytesRead() const {
+        return m_bytesRead;
+    }
+
+    size_t ImportParser::getSkipped() const {
+        return m_skipped;
+    }
+
+    bool ImportParser::isSupported(const std::filesystem::path& path) {
+        const std::string extension = extensionOf(path);
+        return extension == "csv" || extension == "tsv" || extension == "tab"
+            || extension == "txt" || extension == "ni" || extension == "i7";
+    }
+
+    std::unique_ptr<ImportParser> ImportParser::create(const std::filesystem::path& path, std::istream& in) {
+        const std::string extension = extensionOf(path);
+        if (extension == "csv") {
+            return std::make_unique<CsvImportParser>(in, ',');
+        }
+        if (extension == "tsv" || extension == "tab") {
+            return std::make_unique<CsvImportParser>(in, '\t');
+        }
+        if (extension == "txt" || extension == "ni" || extension == "i7") {
+            return std::make_unique<InformImportParser>(in);
+        }
+        throw Exceptions::project_format_exception(std::format("Cannot import files of this type: {}", path.string()));
+    }
+
+    std::string ImportParser::makeId(std::string_view name) {
+        std::string id;
+        id.reserve(name.size());
+        bool separator = false;
+        for (const char c : name) {
+            const auto byte = static_cast<unsigned char>(c);
+            const bool ascii = byte < 0x80;
+            if (ascii && !((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))) {
+                separator = !id.empty();
+                continue;
+            }
+            if (separator) {
+                id += '_';
+                separator = false;
+            }
+            id += (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+        return id;
+    }
+
+    bool ImportParser::readLine(std::string& line) {
+        line.clear();
+        std::streambuf* buffer = m_in.rdbuf();
+        if (buffer == nullptr) {
+            return false;
+        }
+        for (;;) {
+            const int c = buffer->sbumpc();
+            if (c == std::char_traits<char>::eof()) {
+                if (line.empty()) {
+                    m_in.setstate(std::ios::eofbit);
+                    return false;
+                }
+                break;
+            }
+            ++m_bytesRead;
+            if (c == '\n') {
+                break;
+            }
+            if (line.size() == MAX_LINE_BYTES) {
+                throw Exceptions::project_format_exception(
+                    std::format("Line {} is longer than {} bytes", m_lineNumber + 1, MAX_LINE_BYTES));
+            }
+            line += static_cast<char>(c);
+        }
+        ++m_lineNumber;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        // Spreadsheets such as Excel's "CSV UTF-8" start the file with a byte order mark
+        if (m_lineNumber == 1 && line.starts_with(UTF8_BOM)) {
+            line.erase(0, UTF8_BOM.size());
+        }
+        return true;
+    }
+
+    void ImportParser::skip() {
+        ++m_skipped;
+    }
+
+    size_t ImportParser::getLineNumber() const {
+        return m_lineNumber;
+    }
+}
@@ -0,0 +1,184 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_IMPORT_PARSER_H
+#define ADS_CORE_IMPORT_PARSER_H
+
+/**
+ * @file ImportParser.h
+ * @brief Streaming readers of entities from foreign adventure formats
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A parser turns its source into ImportBatch chunks of bounded size; it
+ * never holds more than the line and the batch it is working on, so a
+ * source of any size can be imported. ProjectImporter drives a parser on
+ * a worker and inserts the batches into the project.
+ *
+ * @see ADS::Core::ProjectImporter
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "EntityHandle.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief One entity read from a foreign source
+     */
+    struct ImportRecord {
+        EntityKind kind = EntityKind::Scene;
+        std::string id;             ///< Id given by the source, empty to derive it from the name
+        std::string name;           ///< Display name
+        std::string description;    ///< Empty if the source gave none
+    };
+
+    /**
+     * @brief Entities and exits read from one chunk of a source
+     */
+    struct ImportBatch {
+        std::vector<ImportRecord> entities;
+        std::vector<std::pair<std::string, std::string>> exits;    ///< Source ids of the scenes an exit leads from and to
+
+        /**
+         * @brief Get the number of entities and exits held
+         */
+        [[nodiscard]] size_t size() const {
+            return entities.size() + exits.size();
+        }
+    };
+
+    /**
+     * @brief Reads a foreign source in batches
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Subclasses read the stream line by line through readLine(), which
+     * refuses lines longer than MAX_LINE_BYTES so a source without line
+     * breaks cannot be pulled into memory whole. A parser is used by one
+     * thread at a time.
+     */
+    class ImportParser {
+    public:
+        /// Entities and exits in a full batch
+        static constexpr size_t BATCH_RECORDS = 2048;
+
+        /// Longest line, or CSV row, a parser accepts
+        static constexpr size_t MAX_LINE_BYTES = 1u << 20;
+
+        /// Byte order mark some editors write before UTF-8 text
+        static constexpr std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+
+        /**
+         * @param in Source, read from its current position; must outlive the parser
+         */
+        explicit ImportParser(std::istream& in);
+        virtual ~ImportParser() = default;
+
+        ImportParser(const ImportParser&) = delete;
+        ImportParser& operator=(const ImportParser&) = delete;
+
+        /**
+         * @brief Append the next entities and exits of the source to a batch
+         *
+         * @param batch      Receives the records
+         * @param maxRecords Stop once the batch holds this many entities and exits
+         * @return bool False once the source is exhausted
+         * @throws Exceptions::project_format_exception if the source is malformed
+         */
+        virtual bool read(ImportBatch& batch, size_t maxRecords = BATCH_RECORDS) = 0;
+
+        /**
+         * @brief Get the bytes of the source consumed so far
+         */
+        [[nodiscard]] uint64_t getBytesRead() const;
+
+        /**
+         * @brief Get the rows or sentences that were not understood and were skipped
+         */
+        [[nodiscard]] size_t getSkipped() const;
+
+        /**
+         * @brief Check whether a file has a format some parser reads
+         *
+         * @param path Source file; only its extension is looked at
+         * @return bool True for .csv, .tsv, .tab, .txt, .ni and .i7
+         */
+        [[nodiscard]] static bool isSupported(const std::filesystem::path& path);
+
+        /**
+         * @brief Create the parser for a file, chosen by its extension
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param path Source file; only its extension is looked at
+         * @param in   Stream over the file
+         * @return std::unique_ptr<ImportParser> Parser reading @p in
+         * @throws Exceptions::project_format_exception if the extension is not supported
+         */
+        [[nodiscard]] static std::unique_ptr<ImportParser> create(const std::filesystem::path& path, std::istream& in);
+
+        /**
+         * @brief Derive an entity id from a display name
+         *
+         * Lowercases ASCII letters and turns every run of other ASCII
+         * characters into one underscore; UTF-8 sequences are kept. E.g.
+         * "The Old Mill" → "the_old_mill".
+         *
+         * @param name Display name
+         * @return std::string Id; empty if the name has no letter or digit
+         */
+        [[nodiscard]] static std::string makeId(std::string_view name);
+
+    protected:
+        /**
+         * @brief Read the next line, without its terminator
+         *
+         * @param line Replaced by the line; a trailing '\r', and a UTF8_BOM opening the
+         *             first line, are dropped
+         * @return bool False at the end of the source
+         * @throws Exceptions::project_format_exception if the line exceeds MAX_LINE_BYTES
+         */
+        bool readLine(std::string& line);
+
+        /**
+         * @brief Count a row or sentence that was skipped
+         */
+        void skip();
+
+        /**
+         * @brief Get the number of the line last read, from 1
+         */
+        [[nodiscard]] size_t getLineNumber() const;
+
+    private:
+        std::istream& m_in;
+        uint64_t m_bytesRead = 0;
+        size_t m_lineNumber = 0;
+        size_t m_skipped = 0;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_IMPORT_PARSER_H
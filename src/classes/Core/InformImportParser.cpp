@@ -0,0 +1,371 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file InformImportParser.cpp
+ * @brief Implementation of the InformImportParser class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "InformImportParser.h"
+
+#include <array>
+#include <format>
+#include <optional>
+
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+    namespace {
+        struct KindWord {
+            std::string_view word;
+            EntityKind kind;
+            bool plural;
+        };
+
+        constexpr std::array<KindWord, 20> KIND_WORDS = {{
+            {"room", EntityKind::Scene, false},         {"rooms", EntityKind::Scene, true},
+            {"person", EntityKind::Character, false},   {"people", EntityKind::Character, true},
+            {"man", EntityKind::Character, false},      {"men", EntityKind::Character, true},
+            {"woman", EntityKind::Character, false},    {"women", EntityKind::Character, true},
+            {"animal", EntityKind::Character, false},   {"animals", EntityKind::Character, true},
+            {"thing", EntityKind::Item, false},         {"things", EntityKind::Item, true},
+            {"container", EntityKind::Item, false},     {"containers", EntityKind::Item, true},
+            {"supporter", EntityKind::Item, false},     {"supporters", EntityKind::Item, true},
+            {"device", EntityKind::Item, false},        {"devices", EntityKind::Item, true},
+            {"vehicle", EntityKind::Item, false},       {"vehicles", EntityKind::Item, true}
+        }};
+
+        /// Directions followed by "of"; "above" and "below" stand alone
+        constexpr std::array<std::string_view, 12> DIRECTIONS = {
+            "north", "south", "east", "west", "northeast", "northwest",
+            "southeast", "southwest", "up", "down", "inside", "outside"
+        };
+
+        std::string_view trim(std::string_view text) {
+            const size_t first = text.find_first_not_of(" \t");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+        }
+
+        std::string lowercase(std::string_view text) {
+            std::string lower(text);
+            for (char& c : lower) {
+                if (c >= 'A' && c <= 'Z') {
+                    c = static_cast<char>(c - 'A' + 'a');
+                }
+            }
+            return lower;
+        }
+
+        bool startsWithWord(std::string_view lower, std::string_view word) {
+            return lower.starts_with(word) && (lower.size() == word.size() || lower[word.size()] == ' ');
+        }
+
+        /**
+         * @brief A name without its leading article
+         */
+        std::string_view stripArticle(std::string_view name) {
+            name = trim(name);
+            const std::string lower = lowercase(name.substr(0, 4));
+            for (const std::string_view article : {"the ", "an ", "a "}) {
+                if (lower.starts_with(article)) {
+                    return trim(name.substr(article.size()));
+                }
+            }
+            return name;
+        }
+
+        /**
+         * @brief Cut a phrase at the first of some lowercase separators
+         */
+        std::string_view cutAt(std::string_view text, std::string_view lower,
+                               std::initializer_list<std::string_view> separators) {
+            size_t end = text.size();
+            for (const std::string_view separator : separators) {
+                end = std::min(end, lower.find(separator));
+            }
+            return text.substr(0, end);
+        }
+
+        /**
+         * @brief Split "the lamp, the rope and a box" into its names
+         */
+        std::vector<std::string_view> splitNames(std::string_view subject) {
+            std::vector<std::string_view> names;
+            const std::string lower = lowercase(subject);
+            size_t start = 0;
+            while (start <= subject.size()) {
+                const size_t comma = lower.find(", ", start);
+                const size_t conjunction = lower.find(" and ", start);
+                const size_t end = std::min(comma, conjunction);
+                names.push_back(stripArticle(subject.substr(start, end == std::string::npos ? std::string::npos : end - start)));
+                if (end == std::string::npos) {
+                    break;
+                }
+                start = end + (end == comma ? 2 : 5);
+                // ", and" joins the last name
+                if (lower.compare(start, 4, "and ") == 0) {
+                    start += 4;
+                }
+            }
+            return names;
+        }
+    }
+
+    InformImportParser::InformImportParser(std::istream& in) : ImportParser(in) {}
+
+    bool InformImportParser::read(ImportBatch& batch, const size_t maxRecords) {
+        m_last = NO_RECORD;
+        for (;;) {
+            if (!m_sentencePending && !readSentence()) {
+                return false;
+            }
+            m_sentencePending = false;
+            if (m_paragraphStart) {
+                m_last = NO_RECORD;
+            }
+            // A quoted sentence may still describe the last record, so only stop before anything else
+            if (batch.size() >= maxRecords && m_sentence.front() != '"') {
+                m_sentencePending = true;
+                return true;
+            }
+            parseSentence(batch);
+        }
+    }
+
+    bool InformImportParser::readSentence() {
+        m_sentence.clear();
+        m_paragraphStart = m_paragraphEnded;
+        m_paragraphEnded = false;
+        bool quoted = false;
+
+        const auto finish = [this]() {
+            const std::string_view sentence = trim(m_sentence);
+            if (sentence.empty()) {
+                m_sentence.clear();
+                return false;
+            }
+            m_sentence = std::string(sentence);
+            return true;
+        };
+
+        for (;;) {
+            if (!m_lineLoaded) {
+                if (!readLine(m_line)) {
+                    return finish();
+                }
+                m_position = 0;
+                m_lineLoaded = true;
+                if (m_commentDepth == 0 && trim(m_line).empty()) {
+                    m_lineLoaded = false;
+                    // Quotes and sentences do not run across paragraphs
+                    quoted = false;
+                    if (finish()) {
+                        m_paragraphEnded = true;
+                        return true;
+                    }
+                    m_paragraphStart = true;
+                    continue;
+                }
+            }
+
+            while (m_position < m_line.size()) {
+                const char c = m_line[m_position++];
+                if (m_commentDepth > 0) {
+                    if (c == '[') {
+                        ++m_commentDepth;
+                    } else if (c == ']') {
+                        --m_commentDepth;
+                    }
+                    continue;
+                }
+                if (m_sentence.size() >= MAX_LINE_BYTES) {
+                    throw Exceptions::project_format_exception(
+                        std::format("Sentence near line {} is longer than {} bytes", getLineNumber(), MAX_LINE_BYTES));
+                }
+                if (quoted) {
+                    // Brackets inside quotes are text substitutions, not comments
+                    m_sentence += c;
+                    if (c == '"') {
+                        quoted = false;
+                        const size_t size = m_sentence.size();
+                        if (size >= 2 && (m_sentence[size - 2] == '.' || m_sentence[size - 2] == '!' || m_sentence[size - 2] == '?')) {
+                            if (finish()) {
+                                return true;
+                            }
+                        }
+                    }
+                } else if (c == '[') {
+                    ++m_commentDepth;
+                } else if (c == '"') {
+                    quoted = true;
+                    m_sentence += c;
+                } else if (c == '.') {
+                    if (finish()) {
+                        return true;
+                    }
+                } else {
+                    m_sentence += c;
+                }
+            }
+            // A line break inside a sentence is a space
+            m_lineLoaded = false;
+            m_sentence += ' ';
+        }
+    }
+
+    void InformImportParser::parseSentence(ImportBatch& batch) {
+        const std::string_view sentence = m_sentence;
+        if (sentence.front() == '"') {
+            if (m_last != NO_RECORD && sentence.size() >= 2 && sentence.back() == '"') {
+                batch.entities[m_last].description = sentence.substr(1, sentence.size() - 2);
+            } else {
+                skip();
+            }
+            m_last = NO_RECORD;
+            return;
+        }
+        m_last = NO_RECORD;
+
+        const std::string lower = lowercase(sentence);
+        size_t verb = lower.find(" is ");
+        size_t verbLength = 4;
+        const size_t are = lower.find(" are ");
+        if (are < verb) {
+            verb = are;
+            verbLength = 5;
+        }
+        if (verb == std::string::npos) {
+            skip();
+            return;
+        }
+        const std::string_view subject = trim(sentence.substr(0, verb));
+        const std::string_view predicate = trim(sentence.substr(verb + verbLength));
+        if (!parseDescription(subject, predicate, batch) && !parseConnection(subject, predicate, batch)
+            && !parseDeclaration(subject, predicate, batch)) {
+            skip();
+        }
+    }
+
+    bool InformImportParser::parseDeclaration(const std::string_view subject, const std::string_view predicate,
+                                              ImportBatch& batch) {
+        const std::string lower = lowercase(predicate);
+        std::string_view phrase = predicate;
+        std::string_view lowerPhrase = lower;
+        bool singular = false;
+        for (const std::string_view article : {"a ", "an "}) {
+            if (lowerPhrase.starts_with(article)) {
+                singular = true;
+                phrase.remove_prefix(article.size());
+                lowerPhrase.remove_prefix(article.size());
+                break;
+            }
+        }
+        // "a dark room in the Cellar": the kind is the last word before the location
+        const size_t end = cutAt(lowerPhrase, lowerPhrase, {" in ", " on ", " with ", " called ", ","}).size();
+        lowerPhrase = trim(lowerPhrase.substr(0, end));
+        const size_t space = lowerPhrase.rfind(' ');
+        const std::string_view word = space == std::string_view::npos ? lowerPhrase : lowerPhrase.substr(space + 1);
+
+        std::optional<EntityKind> kind;
+        for (const KindWord& kindWord : KIND_WORDS) {
+            if (kindWord.word == word && kindWord.plural != singular) {
+                kind = kindWord.kind;
+                break;
+            }
+        }
+        if (!kind) {
+            return false;
+        }
+
+        const std::vector<std::string_view> names = singular ? std::vector{stripArticle(subject)} : splitNames(subject);
+        for (const std::string_view name : names) {
+            if (makeId(name).empty()) {
+                skip();
+                continue;
+            }
+            batch.entities.push_back(ImportRecord{*kind, makeId(name), std::string(name), {}});
+        }
+        // Only a lone declaration takes the quoted sentence after it
+        if (names.size() == 1 && !batch.entities.empty() && batch.entities.back().name == names.front()) {
+            m_last = batch.entities.size() - 1;
+        }
+        return true;
+    }
+
+    bool InformImportParser::parseConnection(const std::string_view subject, const std::string_view predicate,
+                                             ImportBatch& batch) {
+        // The direction leads from the scene named after it to the other one
+        const auto direction = [](const std::string_view phrase) -> std::optional<std::string_view> {
+            const std::string lower = lowercase(phrase);
+            for (const std::string_view stand : {"above", "below"}) {
+                if (startsWithWord(lower, stand)) {
+                    return trim(phrase.substr(stand.size()));
+                }
+            }
+            for (const std::string_view name : DIRECTIONS) {
+                if (startsWithWord(lower, name) && lower.compare(name.size(), 4, " of ") == 0) {
+                    return trim(phrase.substr(name.size() + 4));
+                }
+            }
+            return std::nullopt;
+        };
+
+        std::string_view from;
+        std::string_view to;
+        if (const auto other = direction(predicate)) {
+            from = subject;
+            to = *other;
+        } else if (const auto other = direction(subject)) {
+            from = predicate;
+            to = *other;
+        } else {
+            return false;
+        }
+        // "north of the Kitchen and south of the Yard": only the first connection is read
+        to = cutAt(to, lowercase(to), {" and ", ","});
+
+        std::string fromId = makeId(stripArticle(from));
+        std::string toId = makeId(stripArticle(to));
+        if (fromId.empty() || toId.empty() || fromId == toId) {
+            return false;
+        }
+        batch.exits.emplace_back(fromId, toId);
+        batch.exits.emplace_back(std::move(toId), std::move(fromId));
+        return true;
+    }
+
+    bool InformImportParser::parseDescription(const std::string_view subject, const std::string_view predicate,
+                                              ImportBatch& batch) {
+        constexpr std::string_view PREFIX = "the description of ";
+        if (!lowercase(subject).starts_with(PREFIX)) {
+            return false;
+        }
+        if (predicate.size() < 2 || predicate.front() != '"' || predicate.back() != '"') {
+            return false;
+        }
+        // Descriptions of entities declared in an earlier batch are not patched back
+        const std::string id = makeId(stripArticle(subject.substr(PREFIX.size())));
+        for (auto record = batch.entities.rbegin(); record != batch.entities.rend(); ++record) {
+            if (record->id == id) {
+                record->description = predicate.substr(1, predicate.size() - 2);
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_INFORM_IMPORT_PARSER_H
+#define ADS_CORE_INFORM_IMPORT_PARSER_H
+
+/**
+ * @file InformImportParser.h
+ * @brief Entities from Inform 7 style source text
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "ImportParser.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Reads the world model out of Inform 7 style sentences
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Understands the assertions that declare the map and what is in it:
+     *
+     * @code
+     * The Kitchen is a room. "A warm kitchen."
+     * The Hall is north of the Kitchen.
+     * Bob is a man in the Kitchen.
+     * The lamp and the rope are things in the Hall.
+     * The description of the lamp is "Brass, and dented."
+     * @endcode
+     *
+     * Rooms become scenes; people, men, women and animals characters;
+     * things, containers, supporters, devices and vehicles items. A map
+     * connection links both scenes both ways, as Inform does, but only
+     * between rooms the source declares. A quoted sentence right after a
+     * declaration, in the same paragraph, describes what it declared.
+     * Locations, rules, comments in brackets and every other sentence are
+     * skipped. Ids are derived from the names with makeId(), without the
+     * leading article.
+     */
+    class InformImportParser : public ImportParser {
+    public:
+        explicit InformImportParser(std::istream& in);
+
+        bool read(ImportBatch& batch, size_t maxRecords = BATCH_RECORDS) override;
+
+    private:
+        static constexpr size_t NO_RECORD = static_cast<size_t>(-1);
+
+        /**
+         * @brief Read up to the end of the next sentence
+         *
+         * A sentence ends at a full stop outside quotes and comments, at
+         * a closing quote right after a stop, or at a blank line.
+         *
+         * @return bool False at the end of the source
+         * @throws Exceptions::project_format_exception if a sentence exceeds MAX_LINE_BYTES
+         */
+        bool readSentence();
+
+        /**
+         * @brief Turn the sentence in m_sentence into records
+         */
+        void parseSentence(ImportBatch& batch);
+
+        /**
+         * @brief Handle "X is/are a/an <kind> [in Y]"
+         *
+         * @return bool False if the sentence is not a declaration
+         */
+        bool parseDeclaration(std::string_view subject, std::string_view predicate, ImportBatch& batch);
+
+        /**
+         * @brief Handle "X is <direction> of Y" and "<direction> of Y is X"
+         *
+         * @return bool False if the sentence is not a map connection
+         */
+        bool parseConnection(std::string_view subject, std::string_view predicate, ImportBatch& batch);
+
+        /**
+         * @brief Handle "The description of X is "text""
+         *
+         * @return bool False if the sentence is not a description assertion
+         */
+        bool parseDescription(std::string_view subject, std::string_view predicate, ImportBatch& batch);
+
+        std::string m_line;                 ///< Line being split into sentences
+        size_t m_position = 0;              ///< Next character of m_line
+        bool m_lineLoaded = false;          ///< m_line holds unread text
+        bool m_paragraphStart = false;      ///< A blank line comes before the sentence read
+        bool m_paragraphEnded = false;      ///< The sentence read ended at a blank line
+        int m_commentDepth = 0;             ///< Open '[' brackets; comments may span lines
+        std::string m_sentence;             ///< Sentence being read
+        bool m_sentencePending = false;     ///< m_sentence was read but left for the next batch
+        size_t m_last = NO_RECORD;          ///< Entity of the current batch a following quoted sentence describes
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_INFORM_IMPORT_PARSER_H
@@ -0,0 +1,198 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file InputLog.cpp
+ * @brief Implementation of the InputLog class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "InputLog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+
+namespace ADS::Core {
+
+    namespace {
+        constexpr std::byte MAGIC[] = {std::byte{'A'}, std::byte{'D'}, std::byte{'S'}, std::byte{'I'}};
+        constexpr size_t HEADER_SIZE = sizeof(MAGIC) + 1 + sizeof(uint64_t);
+
+        /**
+         * @brief Read a varint
+         * @return bool False if the data ends first
+         */
+        bool readVarint(const std::vector<std::byte>& data, size_t& offset, uint64_t& value) {
+            value = 0;
+            for (unsigned shift = 0; shift < 64 && offset < data.size(); shift += 7) {
+                const auto byte = std::to_integer<uint64_t>(data[offset++]);
+                value |= (byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    bool InputLog::open(const std::filesystem::path& path, const uint64_t seed, const std::string_view state) {
+        close();
+        m_out.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_out) {
+            return false;
+        }
+        m_pending.assign(std::begin(MAGIC), std::end(MAGIC));
+        m_pending.push_back(std::byte{VERSION});
+        for (unsigned shift = 0; shift < 64; shift += 8) {
+            m_pending.push_back(static_cast<std::byte>(seed >> shift));
+        }
+        writeVarint(state.size());
+        const auto stateBytes = std::as_bytes(std::span(state));
+        m_pending.insert(m_pending.end(), stateBytes.begin(), stateBytes.end());
+        m_framesPending = 0;
+        flush();
+        return static_cast<bool>(m_out);
+    }
+
+    void InputLog::writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            m_pending.push_back(static_cast<std::byte>(value | 0x80));
+            value >>= 7;
+        }
+        m_pending.push_back(static_cast<std::byte>(value));
+    }
+
+    void InputLog::record(const uint32_t type, const std::span<const std::byte> payload) {
+        if (!m_out.is_open()) {
+            return;
+        }
+        writeVarint(type);
+        writeVarint(payload.size());
+        m_pending.insert(m_pending.end(), payload.begin(), payload.end());
+        m_pendingInput = true;
+    }
+
+    void InputLog::endFrame(const float deltaTime) {
+        if (!m_out.is_open()) {
+            return;
+        }
+        writeVarint(0);
+        writeVarint(static_cast<uint64_t>(std::lround(std::max(deltaTime, 0.0f) * 1e6f)));
+        if (m_pendingInput || ++m_framesPending >= FLUSH_FRAMES) {
+            flush();
+        }
+    }
+
+    void InputLog::flush() {
+        m_out.write(reinterpret_cast<const char*>(m_pending.data()), static_cast<std::streamsize>(m_pending.size()));
+        m_out.flush();
+        m_pending.clear();
+        m_framesPending = 0;
+        m_pendingInput = false;
+    }
+
+    void InputLog::close() {
+        if (m_out.is_open()) {
+            flush();
+            m_out.close();
+        }
+    }
+
+    bool InputLog::isRecording() const {
+        return m_out.is_open();
+    }
+
+    /**
+     * @brief Read a log to replay it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The records are decoded once, here; the events point into the
+     * loaded bytes, so replaying a frame copies nothing.
+     */
+    void InputLog::load(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (in) {
+            m_data.resize(static_cast<size_t>(in.tellg()));
+            in.seekg(0);
+            in.read(reinterpret_cast<char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+        }
+        if (!in) {
+            throw std::runtime_error(std::format("Cannot read input log {}", path.string()));
+        }
+        if (m_data.size() < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), m_data.begin()) ||
+            std::to_integer<uint8_t>(m_data[sizeof(MAGIC)]) != VERSION) {
+            throw std::runtime_error(std::format("{} is not an input log of version {}", path.string(), VERSION));
+        }
+        m_seed = 0;
+        for (size_t index = 0; index < sizeof(uint64_t); ++index) {
+            m_seed |= std::to_integer<uint64_t>(m_data[sizeof(MAGIC) + 1 + index]) << (8 * index);
+        }
+
+        size_t offset = HEADER_SIZE;
+        uint64_t stateSize = 0;
+        if (!readVarint(m_data, offset, stateSize) || stateSize > m_data.size() - offset) {
+            throw std::runtime_error(std::format("{} is cut short in its header", path.string()));
+        }
+        m_state = std::string_view(reinterpret_cast<const char*>(m_data.data()) + offset, stateSize);
+        offset += stateSize;
+
+        m_frames.clear();
+        m_events.clear();
+        size_t frameStart = 0;
+        uint64_t tag = 0;
+        uint64_t value = 0;
+        while (readVarint(m_data, offset, tag) && readVarint(m_data, offset, value)) {
+            if (tag == 0) {
+                m_frames.push_back({static_cast<float>(value) / 1e6f, static_cast<uint32_t>(frameStart),
+                                    static_cast<uint32_t>(m_events.size() - frameStart)});
+                frameStart = m_events.size();
+                continue;
+            }
+            if (value > m_data.size() - offset) {
+                break;
+            }
+            m_events.push_back({static_cast<uint32_t>(tag), std::span<const std::byte>(m_data).subspan(offset, value)});
+            offset += value;
+        }
+        // Events of a frame the recording did not finish are left out
+        m_events.resize(frameStart);
+    }
+
+    size_t InputLog::getFrameCount() const {
+        return m_frames.size();
+    }
+
+    uint64_t InputLog::getSeed() const {
+        return m_seed;
+    }
+
+    std::string_view InputLog::getState() const {
+        return m_state;
+    }
+
+    float InputLog::getDeltaTime(const size_t frame) const {
+        return m_frames[frame].deltaTime;
+    }
+
+    void InputLog::eventsFor(const size_t frame, std::vector<Event>& events) const {
+        const Frame& recorded = m_frames[frame];
+        events.assign(m_events.begin() + recorded.firstEvent,
+                      m_events.begin() + recorded.firstEvent + recorded.eventCount);
+    }
+}
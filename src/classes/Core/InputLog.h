@@ -0,0 +1,177 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_INPUT_LOG_H
+#define ADS_CORE_INPUT_LOG_H
+
+/**
+ * @file InputLog.h
+ * @brief Binary log of the input events of a session, frame by frame, to replay it
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * App::processEvents() records the events it handles and the time of
+ * each frame into the file INPUT_LOG names; `--replay <file>` feeds them
+ * back, one recorded frame per frame drawn, with the recorded frame times
+ * and seed, so a user's session runs again the same way on another
+ * machine or another build.
+ *
+ * @see ADS::Core::App::runBenchmark(), ADS::Core::FrameBenchmark
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Records input events into a compact file, or reads one back
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Events are opaque here: a type and the bytes of the event the App
+     * chose to keep, so the log knows nothing of SDL. The file is a
+     * header (the magic "ADSI", a version byte, the 8-byte seed, and the
+     * starting state as a varint size and its bytes), then one record per
+     * event and one per frame end, each starting with a varint:
+     *
+     *   <type> <size> <bytes>       Event, type > 0, size a varint
+     *   0 <microseconds>            End of a frame and its delta time, a varint
+     *
+     * An idle frame costs 3 or 4 bytes. Records are written as frames end
+     * and flushed at least once per FLUSH_FRAMES, and at once after a
+     * frame with events, so a crash loses no input; a log cut short is
+     * read up to its last complete frame.
+     *
+     * Not thread-safe; main thread only.
+     */
+    class InputLog {
+    public:
+        static constexpr uint8_t VERSION = 1;
+        static constexpr uint32_t FLUSH_FRAMES = 60;            ///< Frames without input written together
+
+        /**
+         * @brief A recorded event
+         */
+        struct Event {
+            uint32_t type;                          ///< Never 0
+            std::span<const std::byte> payload;     ///< Into the loaded log
+        };
+
+        /**
+         * @brief Start recording into a file, replacing it
+         *
+         * @param path  File to write
+         * @param seed  Seed the session's randomness was set up with
+         * @param state What else the session starts from that a replay must restore, e.g. the UI layout
+         * @return bool False if the file cannot be written
+         */
+        bool open(const std::filesystem::path& path, uint64_t seed, std::string_view state = {});
+
+        /**
+         * @brief Record an event of the current frame
+         *
+         * @param type    Event type; must not be 0
+         * @param payload Bytes needed to rebuild the event
+         */
+        void record(uint32_t type, std::span<const std::byte> payload);
+
+        /**
+         * @brief End the current frame
+         *
+         * @param deltaTime Time the frame advanced the UI by, in seconds
+         */
+        void endFrame(float deltaTime);
+
+        /**
+         * @brief Write what is pending and stop recording
+         */
+        void close();
+
+        [[nodiscard]] bool isRecording() const;
+
+        /**
+         * @brief Read a log to replay it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @throws std::runtime_error if the file cannot be read or is not an input log
+         */
+        void load(const std::filesystem::path& path);
+
+        /**
+         * @brief Get the complete frames of the loaded log
+         */
+        [[nodiscard]] size_t getFrameCount() const;
+
+        /**
+         * @brief Get the seed the loaded log was recorded with
+         */
+        [[nodiscard]] uint64_t getSeed() const;
+
+        /**
+         * @brief Get the starting state of the loaded log
+         */
+        [[nodiscard]] std::string_view getState() const;
+
+        /**
+         * @brief Get the delta time of a recorded frame, in seconds
+         */
+        [[nodiscard]] float getDeltaTime(size_t frame) const;
+
+        /**
+         * @brief Get the events of a recorded frame
+         *
+         * @param frame  Frame, from 0
+         * @param events Replaced by the events, in recorded order
+         */
+        void eventsFor(size_t frame, std::vector<Event>& events) const;
+
+    private:
+        /**
+         * @brief A loaded frame
+         */
+        struct Frame {
+            float deltaTime;
+            uint32_t firstEvent;                    ///< Into m_events
+            uint32_t eventCount;
+        };
+
+        std::ofstream m_out;
+        std::vector<std::byte> m_pending;           ///< Records not written yet
+        uint32_t m_framesPending = 0;
+        bool m_pendingInput = false;                ///< An event was recorded since the last write
+
+        uint64_t m_seed = 0;
+        std::string_view m_state;                   ///< Into m_data
+        std::vector<std::byte> m_data;              ///< The loaded file
+        std::vector<Frame> m_frames;
+        std::vector<Event> m_events;
+
+        void writeVarint(uint64_t value);
+
+        /**
+         * @brief Write the pending records to the file
+         */
+        void flush();
+    };
+}
+
+#endif // ADS_CORE_INPUT_LOG_H
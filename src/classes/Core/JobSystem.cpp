@@ -0,0 +1,436 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file JobSystem.cpp
+ * @brief Implementation of the shared worker pool
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <exception>
+
+#include <spdlog/spdlog.h>
+
+#include "TraceRecorder.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief A submitted job and what its observers and continuations need
+     */
+    struct JobSystem::Job {
+        std::function<void()> work;                         ///< Released once the job ends
+        Priority priority = Priority::Normal;
+        Lane lane = Lane::Worker;
+        CancellationToken token;
+        std::atomic<State> state{State::Pending};
+        std::string error;                                  ///< Written before state turns Failed
+        std::mutex mutex;                                   ///< Guards continuations and ended
+        std::vector<std::shared_ptr<Job>> continuations;    ///< Waiting for this job to end
+        bool ended = false;
+    };
+
+    namespace {
+        /**
+         * Pool and queue of the calling thread, so a job submitted by a
+         * worker goes to that worker's own queue
+         */
+        thread_local const JobSystem* currentPool = nullptr;
+        thread_local size_t currentWorker = 0;
+
+        const std::string noError;
+    }
+
+    // =========================================================================
+    // CancellationToken
+    // =========================================================================
+
+    CancellationToken::CancellationToken()
+        : m_cancelled(std::make_shared<std::atomic<bool>>(false)) {
+    }
+
+    void CancellationToken::cancel() const {
+        m_cancelled->store(true, std::memory_order_release);
+    }
+
+    bool CancellationToken::isCancelled() const {
+        return m_cancelled->load(std::memory_order_acquire);
+    }
+
+    // =========================================================================
+    // JobHandle
+    // =========================================================================
+
+    JobSystem::JobHandle::JobHandle(std::shared_ptr<Job> job)
+        : m_job(std::move(job)) {
+    }
+
+    bool JobSystem::JobHandle::isValid() const {
+        return m_job != nullptr;
+    }
+
+    bool JobSystem::JobHandle::isDone() const {
+        const State state = getState();
+        return state != State::Pending && state != State::Running;
+    }
+
+    JobSystem::State JobSystem::JobHandle::getState() const {
+        return m_job ? m_job->state.load(std::memory_order_acquire) : State::Cancelled;
+    }
+
+    const std::string& JobSystem::JobHandle::getError() const {
+        return getState() == State::Failed ? m_job->error : noError;
+    }
+
+    // =========================================================================
+    // JobSystem
+    // =========================================================================
+
+    JobSystem::JobSystem(size_t workers)
+        : m_mainPosted(nullptr),
+          m_queued(0),
+          m_stopping(false) {
+        if (workers == 0) {
+            workers = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+        }
+
+        // All queues exist before any worker may steal from them
+        m_queues.reserve(workers);
+        for (size_t index = 0; index < workers; ++index) {
+            m_queues.push_back(std::make_unique<Queue>());
+        }
+        m_workers.reserve(workers);
+        for (size_t index = 0; index < workers; ++index) {
+            m_workers.emplace_back(&JobSystem::workerLoop, this, index);
+        }
+        spdlog::info("JobSystem: started {} workers", workers);
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_stopping.store(true, std::memory_order_release);
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+
+        // Nobody runs the rest: end them so their observers see Cancelled
+        for (MainNode* node = m_mainPosted.exchange(nullptr, std::memory_order_acquire); node != nullptr;) {
+            MainNode* next = node->next;
+            m_mainBacklog[static_cast<size_t>(node->job->priority)].push_back(std::move(node->job));
+            delete node;
+            node = next;
+        }
+        for (auto& jobs : m_mainBacklog) {
+            for (const std::shared_ptr<Job>& job : jobs) {
+                finish(job, State::Cancelled);
+            }
+            jobs.clear();
+        }
+
+        std::vector<Queue*> queues{&m_injected};
+        for (const auto& queue : m_queues) {
+            queues.push_back(queue.get());
+        }
+        for (Queue* queue : queues) {
+            for (auto& jobs : queue->jobs) {
+                for (const std::shared_ptr<Job>& job : jobs) {
+                    finish(job, State::Cancelled);
+                }
+                jobs.clear();
+            }
+        }
+    }
+
+    JobSystem::JobHandle JobSystem::submit(std::function<void()> work, const Priority priority,
+                                           const Lane lane, CancellationToken token) {
+        auto job = std::make_shared<Job>();
+        job->work = std::move(work);
+        job->priority = priority;
+        job->lane = lane;
+        job->token = std::move(token);
+
+        enqueue(job);
+        return JobHandle(job);
+    }
+
+    JobSystem::JobHandle JobSystem::then(const JobHandle& parent, std::function<void()> work, const Lane lane,
+                                         const Priority priority, CancellationToken token) {
+        auto job = std::make_shared<Job>();
+        job->work = std::move(work);
+        job->priority = priority;
+        job->lane = lane;
+        job->token = std::move(token);
+
+        if (!parent.isValid()) {
+            finish(job, State::Cancelled);
+            return JobHandle(job);
+        }
+
+        {
+            std::lock_guard lock(parent.m_job->mutex);
+            if (!parent.m_job->ended) {
+                parent.m_job->continuations.push_back(job);
+                return JobHandle(job);
+            }
+        }
+
+        // The parent ended before the continuation was attached
+        if (parent.getState() == State::Completed) {
+            enqueue(job);
+        } else {
+            finish(job, State::Cancelled);
+        }
+        return JobHandle(job);
+    }
+
+    size_t JobSystem::runMainThreadJobs(const std::chrono::microseconds budget) {
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+
+        // The stack holds the newest job first: reverse it to posting order
+        MainNode* posted = m_mainPosted.exchange(nullptr, std::memory_order_acquire);
+        MainNode* oldest = nullptr;
+        while (posted != nullptr) {
+            MainNode* next = posted->next;
+            posted->next = oldest;
+            oldest = posted;
+            posted = next;
+        }
+        while (oldest != nullptr) {
+            MainNode* next = oldest->next;
+            m_mainBacklog[static_cast<size_t>(oldest->job->priority)].push_back(std::move(oldest->job));
+            delete oldest;
+            oldest = next;
+        }
+
+        size_t ran = 0;
+        for (auto& jobs : m_mainBacklog) {
+            while (!jobs.empty()) {
+                if (ran > 0 && std::chrono::steady_clock::now() >= deadline) {
+                    return ran;
+                }
+                std::shared_ptr<Job> job = std::move(jobs.front());
+                jobs.pop_front();
+                execute(job);
+                ++ran;
+            }
+        }
+        return ran;
+    }
+
+    bool JobSystem::hasMainThreadJobs() const {
+        if (m_mainPosted.load(std::memory_order_relaxed) != nullptr) {
+            return true;
+        }
+        return std::ranges::any_of(m_mainBacklog, [](const auto& jobs) { return !jobs.empty(); });
+    }
+
+    void JobSystem::wait(const JobHandle& job) {
+        if (!job.isValid()) {
+            return;
+        }
+
+        Queue* self = (currentPool == this) ? m_queues[currentWorker].get() : nullptr;
+        while (!job.isDone()) {
+            if (std::shared_ptr<Job> other = take(self)) {
+                execute(other);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::setMainThreadWakeup(std::function<void()> wakeup) {
+        std::lock_guard lock(m_wakeupMutex);
+        m_mainThreadWakeup = std::move(wakeup);
+    }
+
+    size_t JobSystem::getWorkerCount() const {
+        return m_workers.size();
+    }
+
+    size_t JobSystem::getQueuedCount() const {
+        return m_queued.load(std::memory_order_relaxed);
+    }
+
+    void JobSystem::workerLoop(const size_t index) {
+        currentPool = this;
+        currentWorker = index;
+        TraceRecorder::setThreadName("JobSystem worker");
+        Queue* self = m_queues[index].get();
+
+        while (true) {
+            if (std::shared_ptr<Job> job = take(self)) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock lock(m_sleepMutex);
+            m_wake.wait(lock, [this]() {
+                return m_stopping.load(std::memory_order_acquire) || m_queued.load(std::memory_order_acquire) > 0;
+            });
+            if (m_stopping.load(std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+    std::shared_ptr<JobSystem::Job> JobSystem::take(Queue* self) {
+        if (m_queued.load(std::memory_order_acquire) == 0) {
+            return nullptr;
+        }
+
+        auto popped = [this](std::shared_ptr<Job> job) {
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        };
+
+        const size_t workers = m_queues.size();
+        const size_t first = (self != nullptr) ? currentWorker + 1 : 0;
+
+        for (size_t priority = 0; priority < PRIORITIES; ++priority) {
+            // Own newest job: its data is most likely still in this core's cache
+            if (self != nullptr) {
+                std::lock_guard lock(self->mutex);
+                auto& jobs = self->jobs[priority];
+                if (!jobs.empty()) {
+                    std::shared_ptr<Job> job = std::move(jobs.back());
+                    jobs.pop_back();
+                    return popped(std::move(job));
+                }
+            }
+
+            {
+                std::lock_guard lock(m_injected.mutex);
+                auto& jobs = m_injected.jobs[priority];
+                if (!jobs.empty()) {
+                    std::shared_ptr<Job> job = std::move(jobs.front());
+                    jobs.pop_front();
+                    return popped(std::move(job));
+                }
+            }
+
+            // Steal the oldest job, starting after this worker so thieves spread out
+            for (size_t offset = 0; offset < workers; ++offset) {
+                Queue* victim = m_queues[(first + offset) % workers].get();
+                if (victim == self) {
+                    continue;
+                }
+                std::lock_guard lock(victim->mutex);
+                auto& jobs = victim->jobs[priority];
+                if (!jobs.empty()) {
+                    std::shared_ptr<Job> job = std::move(jobs.front());
+                    jobs.pop_front();
+                    return popped(std::move(job));
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::enqueue(const std::shared_ptr<Job>& job) {
+        const auto priority = static_cast<size_t>(job->priority);
+
+        if (job->lane == Lane::Main) {
+            // The node belongs to the main thread once published: keep the old head apart
+            auto* node = new MainNode{job, nullptr};
+            MainNode* previous = m_mainPosted.load(std::memory_order_relaxed);
+            do {
+                node->next = previous;
+            } while (!m_mainPosted.compare_exchange_weak(previous, node, std::memory_order_release,
+                                                         std::memory_order_relaxed));
+            if (previous != nullptr) {
+                // Not the first since the last drain: the main thread is awake already
+                return;
+            }
+
+            std::function<void()> wakeup;
+            {
+                std::lock_guard lock(m_wakeupMutex);
+                wakeup = m_mainThreadWakeup;
+            }
+            if (wakeup) {
+                wakeup();
+            }
+            return;
+        }
+
+        Queue* target = (currentPool == this) ? m_queues[currentWorker].get() : &m_injected;
+        // Counted first, so a worker never sleeps while the job is in a queue
+        m_queued.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard lock(target->mutex);
+            target->jobs[priority].push_back(job);
+        }
+
+        {
+            // Empty critical section: a worker between its check and its wait
+            // would otherwise miss the notification
+            std::lock_guard lock(m_sleepMutex);
+        }
+        m_wake.notify_one();
+    }
+
+    void JobSystem::execute(const std::shared_ptr<Job>& job) {
+        if (m_stopping.load(std::memory_order_acquire) || job->token.isCancelled()) {
+            finish(job, State::Cancelled);
+            return;
+        }
+
+        job->state.store(State::Running, std::memory_order_relaxed);
+        State end = State::Completed;
+        try {
+            job->work();
+        } catch (const std::exception& e) {
+            job->error = e.what();
+            end = State::Failed;
+        } catch (...) {
+            job->error = "unknown exception";
+            end = State::Failed;
+        }
+        if (end == State::Failed) {
+            spdlog::error("JobSystem: job failed — {}", job->error);
+        }
+
+        finish(job, end);
+    }
+
+    void JobSystem::finish(const std::shared_ptr<Job>& job, const State state) {
+        // Drop the captures now; handles may keep the job for a long time
+        job->work = nullptr;
+
+        std::vector<std::shared_ptr<Job>> continuations;
+        {
+            std::lock_guard lock(job->mutex);
+            job->ended = true;
+            job->state.store(state, std::memory_order_release);
+            continuations.swap(job->continuations);
+        }
+
+        for (const std::shared_ptr<Job>& next : continuations) {
+            if (state == State::Completed) {
+                enqueue(next);
+            } else {
+                finish(next, State::Cancelled);
+            }
+        }
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,350 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_JOB_SYSTEM_H
+#define ADS_CORE_JOB_SYSTEM_H
+
+/**
+ * @file JobSystem.h
+ * @brief Shared worker pool for background work
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * One pool, owned by App, runs the background work of every subsystem
+ * instead of each of them starting its own threads. Work that must touch
+ * ImGui, SDL or the live project is posted to the main-thread lane, which
+ * App::run() drains once per frame, so workers deliver results without
+ * locking the editor's data.
+ *
+ * @see ADS::Core::App::getJobSystem()
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Shared flag telling jobs to stop
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Copies share the flag, so the owner keeps one and gives copies to the
+     * jobs. A job whose token is cancelled before it starts is skipped;
+     * a running job polls isCancelled() at points where stopping is safe.
+     */
+    class CancellationToken {
+    public:
+        CancellationToken();
+
+        /**
+         * @brief Ask every job holding a copy to stop; safe from any thread
+         */
+        void cancel() const;
+
+        /**
+         * @brief Check whether cancel() was called on any copy
+         * @return bool True once cancelled
+         */
+        [[nodiscard]] bool isCancelled() const;
+
+    private:
+        std::shared_ptr<std::atomic<bool>> m_cancelled;
+    };
+
+    /**
+     * @brief Work-stealing pool with priorities, continuations and a main-thread lane
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Every worker owns a queue per priority. A worker takes its own newest
+     * job first, so a job and the jobs it submits stay on the same core;
+     * an idle worker takes the oldest job of the queues submitted from
+     * outside the pool and then steals the oldest job of another worker.
+     * Higher priorities are always looked for first, across all queues.
+     *
+     * Main-lane jobs run on the thread calling runMainThreadJobs(), which
+     * App::run() does once per frame. Posting to the main lane is lock-free:
+     * jobs are pushed onto an atomic stack that the main thread takes whole,
+     * and the post that finds the stack empty wakes the main thread through
+     * the callback given to setMainThreadWakeup().
+     *
+     * submit(), then() and wait() are safe from any thread; only the main
+     * thread calls runMainThreadJobs().
+     */
+    class JobSystem {
+        struct Job;
+
+    public:
+        /**
+         * @brief Order in which queued jobs are taken
+         */
+        enum class Priority : uint8_t {
+            High,       ///< Work the user is waiting for
+            Normal,     ///< Default
+            Low         ///< Caches, indexes and other work nobody waits for
+        };
+
+        /**
+         * @brief Thread a job runs on
+         */
+        enum class Lane : uint8_t {
+            Worker,     ///< Any thread of the pool
+            Main        ///< The thread calling runMainThreadJobs()
+        };
+
+        /**
+         * @brief Lifecycle of a job
+         */
+        enum class State : uint8_t {
+            Pending,    ///< Queued or waiting for its parent
+            Running,    ///< Being run
+            Completed,  ///< Returned normally
+            Cancelled,  ///< Skipped: token cancelled, parent not completed or pool stopped
+            Failed      ///< Threw; see JobHandle::getError()
+        };
+
+        /**
+         * @brief Observer of a submitted job
+         *
+         * Holding a handle keeps the job's result alive, not the job queued;
+         * dropping it does not cancel the job.
+         */
+        class JobHandle {
+        public:
+            JobHandle() = default;
+
+            /**
+             * @brief Check whether the handle refers to a job
+             * @return bool False for a default-constructed handle
+             */
+            [[nodiscard]] bool isValid() const;
+
+            /**
+             * @brief Check whether the job has finished, in any way
+             * @return bool True once Completed, Cancelled or Failed
+             */
+            [[nodiscard]] bool isDone() const;
+
+            /**
+             * @brief Get the state of the job
+             * @return State Current state; Cancelled for an invalid handle
+             */
+            [[nodiscard]] State getState() const;
+
+            /**
+             * @brief Get the failure reason
+             * @return const std::string& Exception message, empty unless Failed
+             */
+            [[nodiscard]] const std::string& getError() const;
+
+        private:
+            friend class JobSystem;
+
+            explicit JobHandle(std::shared_ptr<Job> job);
+
+            std::shared_ptr<Job> m_job;
+        };
+
+        /**
+         * @brief Start the pool
+         *
+         * @param workers Worker threads; 0 picks one per core but one, at least 1
+         */
+        explicit JobSystem(size_t workers = 0);
+
+        /**
+         * @brief Stop the pool
+         *
+         * Running jobs are finished and joined; queued ones end Cancelled
+         * without running, continuations included.
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Queue a job
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param work     Work to run; an exception it throws fails the job
+         * @param priority Order among queued jobs
+         * @param lane     Pool or main thread
+         * @param token    Skips the job if cancelled before it starts
+         * @return JobHandle Observer of the job
+         */
+        JobHandle submit(std::function<void()> work, Priority priority = Priority::Normal,
+                         Lane lane = Lane::Worker, CancellationToken token = {});
+
+        /**
+         * @brief Queue a job to run when another one completes
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The continuation is queued as soon as the parent completes, or now
+         * if it already has. If the parent is cancelled or fails instead,
+         * the continuation ends Cancelled without running, and so do its
+         * own continuations. A typical chain reads a file on the pool and
+         * applies the result on the main lane.
+         *
+         * @param parent   Job to wait for
+         * @param work     Work to run
+         * @param lane     Pool or main thread
+         * @param priority Order among queued jobs
+         * @param token    Skips the continuation if cancelled before it starts
+         * @return JobHandle Observer of the continuation
+         */
+        JobHandle then(const JobHandle& parent, std::function<void()> work, Lane lane = Lane::Worker,
+                       Priority priority = Priority::Normal, CancellationToken token = {});
+
+        /**
+         * @brief Run main-lane jobs for up to a time budget; main thread only
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Takes the jobs posted so far and runs them, higher priorities
+         * first and in posting order within one, until the budget is spent;
+         * at least one job runs per call. The rest, and the jobs these jobs
+         * post, wait for the next call, so a burst of results or a job that
+         * keeps reposting itself cannot stall the frame.
+         *
+         * @param budget Time after which no further job is started
+         * @return size_t Jobs run or skipped
+         * @see hasMainThreadJobs()
+         */
+        size_t runMainThreadJobs(std::chrono::microseconds budget);
+
+        /**
+         * @brief Check whether main-lane jobs are waiting; main thread only
+         *
+         * @return bool True if the next runMainThreadJobs() call has work
+         */
+        [[nodiscard]] bool hasMainThreadJobs() const;
+
+        /**
+         * @brief Block until a job is done, running pool jobs meanwhile
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The waiting thread takes worker-lane jobs instead of sleeping, so
+         * a job may wait for the jobs it submitted without deadlocking the
+         * pool. Main-lane jobs are not run here: waiting on the main thread
+         * for a job that continues on the main lane never returns.
+         *
+         * @param job Job to wait for
+         */
+        void wait(const JobHandle& job);
+
+        /**
+         * @brief Set how a main-lane job wakes the main thread
+         *
+         * @param wakeup Called from the posting thread, e.g. App::requestRedraw()
+         */
+        void setMainThreadWakeup(std::function<void()> wakeup);
+
+        /**
+         * @brief Get the number of pool threads
+         * @return size_t Worker count
+         */
+        [[nodiscard]] size_t getWorkerCount() const;
+
+        /**
+         * @brief Get the number of worker-lane jobs waiting to run
+         * @return size_t Queued jobs, not counting continuations of unfinished jobs
+         */
+        [[nodiscard]] size_t getQueuedCount() const;
+
+    private:
+        static constexpr size_t PRIORITIES = 3;
+
+        /**
+         * @brief Jobs of one owner, one deque per priority
+         */
+        struct Queue {
+            std::mutex mutex;
+            std::array<std::deque<std::shared_ptr<Job>>, PRIORITIES> jobs;
+        };
+
+        /**
+         * @brief Node of the main-lane stack
+         */
+        struct MainNode {
+            std::shared_ptr<Job> job;
+            MainNode* next;
+        };
+
+        /**
+         * @brief Worker body: run jobs until the pool stops
+         *
+         * @param index Worker number, also its queue in m_queues
+         */
+        void workerLoop(size_t index);
+
+        /**
+         * @brief Take the next worker-lane job for a thread
+         *
+         * @param self Queue of the calling worker, or nullptr outside the pool
+         * @return std::shared_ptr<Job> Job to run, nullptr if none is queued
+         */
+        std::shared_ptr<Job> take(Queue* self);
+
+        /**
+         * @brief Queue a job that is ready to run on its lane
+         */
+        void enqueue(const std::shared_ptr<Job>& job);
+
+        /**
+         * @brief Run or skip a job, then release its continuations
+         */
+        void execute(const std::shared_ptr<Job>& job);
+
+        /**
+         * @brief Set the end state of a job and queue or cancel its continuations
+         */
+        void finish(const std::shared_ptr<Job>& job, State state);
+
+        std::vector<std::unique_ptr<Queue>> m_queues;       ///< One per worker
+        Queue m_injected;                                   ///< Submitted from outside the pool
+        std::atomic<MainNode*> m_mainPosted;                ///< Main-lane jobs, newest first
+        std::array<std::deque<std::shared_ptr<Job>>, PRIORITIES> m_mainBacklog; ///< Taken, not run yet; main thread only
+        std::vector<std::thread> m_workers;                 ///< Pool threads
+        std::atomic<size_t> m_queued;                       ///< Worker-lane jobs in any queue
+        std::atomic<bool> m_stopping;                       ///< Set by the destructor
+        std::mutex m_sleepMutex;                            ///< Pairs with m_wake
+        std::condition_variable m_wake;                     ///< Idle workers wait here
+        std::mutex m_wakeupMutex;                           ///< Guards m_mainThreadWakeup
+        std::function<void()> m_mainThreadWakeup;          ///< See setMainThreadWakeup()
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_JOB_SYSTEM_H
@@ -0,0 +1,607 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file JsonProjectSerializer.cpp
+ * @brief Implementation of the streaming `.adsproj` serializer
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "JsonProjectSerializer.h"
+
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "filesystem/file_not_found_exception.h"
+#include "filesystem/file_not_open_exception.h"
+#include "json/json_parse_exception.h"
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Write a JSON string literal, escaping as required by RFC 8259
+     *
+     * Bytes >= 0x80 are copied verbatim, so UTF-8 input stays readable in
+     * the saved file. Unescaped runs are written in one call.
+     */
+    static void writeJsonString(std::ostream& out, std::string_view text) {
+        static constexpr char HEX[] = "0123456789abcdef";
+
+        out.put('"');
+        size_t runStart = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            out.write(text.data() + runStart, static_cast<std::streamsize>(i - runStart));
+            runStart = i + 1;
+            switch (c) {
+                case '"':  out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                case '\b': out << "\\b"; break;
+                case '\f': out << "\\f"; break;
+                default:
+                    out << "\\u00" << HEX[c >> 4] << HEX[c & 0x0F];
+                    break;
+            }
+        }
+        out.write(text.data() + runStart, static_cast<std::streamsize>(text.size() - runStart));
+        out.put('"');
+    }
+
+    /**
+     * @brief Write a float using the shortest round-trip representation
+     */
+    static void writeJsonFloat(std::ostream& out, float value) {
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.write(buffer, result.ptr - buffer);
+    }
+
+    /**
+     * @brief Write an RGBA colour as a four-element JSON array
+     */
+    static void writeJsonColor(std::ostream& out, const ImVec4& color) {
+        out.put('[');
+        writeJsonFloat(out, color.x);
+        out << ", ";
+        writeJsonFloat(out, color.y);
+        out << ", ";
+        writeJsonFloat(out, color.z);
+        out << ", ";
+        writeJsonFloat(out, color.w);
+        out.put(']');
+    }
+
+    /**
+     * @brief SAX consumer that builds entities directly inside a Project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Tracks the nesting depth to know whether a value belongs to the root
+     * object, to an entity object inside one of the three section arrays, or
+     * to a colour or exits array inside an entity. Fields are gathered in m_pending and
+     * the entity is created when its object closes, so key order inside an
+     * entity does not matter. String values are moved out of the parser's
+     * buffer. Any value under an unknown key is skipped as a whole.
+     *
+     * Exits may name scenes that appear later in the file, so they are kept
+     * as ids and linked by finish() once every scene exists.
+     */
+    class ProjectSaxHandler final : public nlohmann::json_sax<nlohmann::json> {
+    private:
+        enum class Section { None, Scenes, Characters, Items };
+
+        static constexpr int ROOT_DEPTH = 1;
+        static constexpr int SECTION_DEPTH = 2;
+        static constexpr int ENTITY_DEPTH = 3;
+        static constexpr int COLOR_DEPTH = 4;
+
+        /**
+         * @brief Entity fields collected until the entity object closes
+         */
+        struct PendingEntity {
+            std::string id;
+            std::string name;
+            std::string description;
+            std::optional<bool> primaryFlag;        ///< isStartScene / isPlayer / isPickable
+            std::optional<bool> secondaryFlag;      ///< isUsable
+            std::optional<int> firstNumber;         ///< width / health / quantity
+            std::optional<int> secondNumber;        ///< height / maxHealth / itemType
+            std::optional<ImVec4> color;            ///< backgroundColor / dialogColor
+            std::vector<std::string> exits;         ///< Target scene ids
+        };
+
+        Project& m_project;
+        const std::string& m_sourceName;
+        Section m_section = Section::None;
+        std::string m_key;
+        std::string m_entityKey;
+        int m_depth = 0;
+        int m_skipDepth = 0;
+        int m_version = 0;
+        bool m_formatSeen = false;
+        PendingEntity m_pending;
+        std::vector<std::pair<std::string, std::vector<std::string>>> m_pendingExits; ///< Scene id → exit target ids
+        float m_colorComponents[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        int m_colorIndex = 0;
+
+        [[nodiscard]] bool skipping() const {
+            return m_skipDepth != 0;
+        }
+
+        /**
+         * @brief Start skipping the object or array that was just opened
+         */
+        void beginSkip() {
+            m_skipDepth = m_depth;
+        }
+
+        [[nodiscard]] std::string keyPath() const {
+            switch (m_section) {
+                case Section::Scenes: return std::format("scenes.{}", m_entityKey);
+                case Section::Characters: return std::format("characters.{}", m_entityKey);
+                case Section::Items: return std::format("items.{}", m_entityKey);
+                default: return m_key;
+            }
+        }
+
+        /**
+         * @brief Route a scalar that belongs to the entity currently being read
+         */
+        void onEntityInteger(int64_t value) {
+            const int v = static_cast<int>(value);
+            switch (m_section) {
+                case Section::Scenes:
+                    if (m_entityKey == "width") m_pending.firstNumber = v;
+                    else if (m_entityKey == "height") m_pending.secondNumber = v;
+                    break;
+                case Section::Characters:
+                    if (m_entityKey == "health") m_pending.firstNumber = v;
+                    else if (m_entityKey == "maxHealth") m_pending.secondNumber = v;
+                    break;
+                case Section::Items:
+                    if (m_entityKey == "quantity") m_pending.firstNumber = v;
+                    else if (m_entityKey == "itemType") m_pending.secondNumber = v;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        void onEntityBoolean(bool value) {
+            switch (m_section) {
+                case Section::Scenes:
+                    if (m_entityKey == "isStartScene") m_pending.primaryFlag = value;
+                    break;
+                case Section::Characters:
+                    if (m_entityKey == "isPlayer") m_pending.primaryFlag = value;
+                    break;
+                case Section::Items:
+                    if (m_entityKey == "isPickable") m_pending.primaryFlag = value;
+                    else if (m_entityKey == "isUsable") m_pending.secondaryFlag = value;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        void onEntityString(std::string& value) {
+            if (m_entityKey == "id") m_pending.id = std::move(value);
+            else if (m_entityKey == "name") m_pending.name = std::move(value);
+            else if (m_entityKey == "description") m_pending.description = std::move(value);
+        }
+
+        void onNumber(double value) {
+            if (skipping()) {
+                return;
+            }
+            if (m_depth == COLOR_DEPTH) {
+                if (m_colorIndex < 4) {
+                    m_colorComponents[m_colorIndex] = static_cast<float>(value);
+                }
+                ++m_colorIndex;
+            }
+        }
+
+        [[nodiscard]] bool isExitsKey() const {
+            return m_section == Section::Scenes && m_entityKey == "exits";
+        }
+
+        [[nodiscard]] bool isColorKey() const {
+            return (m_section == Section::Scenes && m_entityKey == "backgroundColor")
+                || (m_section == Section::Characters && m_entityKey == "dialogColor");
+        }
+
+        /**
+         * @brief Create the entity described by m_pending and apply its fields
+         */
+        void commitEntity() {
+            if (m_pending.id.empty()) {
+                throw Exceptions::project_format_exception(
+                    std::format("{}: entity without an id in '{}'", m_sourceName, keyPath()));
+            }
+
+            switch (m_section) {
+                case Section::Scenes:
+                    if (Entities::Scene* scene = m_project.addScene(m_pending.id, m_pending.name)) {
+                        scene->shareDescription(m_project.getStringPool().intern(m_pending.description));
+                        if (m_pending.primaryFlag) scene->setStartScene(*m_pending.primaryFlag);
+                        if (m_pending.firstNumber) scene->setWidth(*m_pending.firstNumber);
+                        if (m_pending.secondNumber) scene->setHeight(*m_pending.secondNumber);
+                        if (m_pending.color) scene->setBackgroundColor(*m_pending.color);
+                        if (!m_pending.exits.empty()) {
+                            m_pendingExits.emplace_back(m_pending.id, std::move(m_pending.exits));
+                        }
+                    }
+                    break;
+                case Section::Characters:
+                    if (Entities::Character* character = m_project.addCharacter(m_pending.id, m_pending.name)) {
+                        character->shareDescription(m_project.getStringPool().intern(m_pending.description));
+                        if (m_pending.primaryFlag) character->setPlayer(*m_pending.primaryFlag);
+                        if (m_pending.secondNumber) character->setMaxHealth(*m_pending.secondNumber);
+                        if (m_pending.firstNumber) character->setHealth(*m_pending.firstNumber);
+                        if (m_pending.color) character->setDialogColor(*m_pending.color);
+                    }
+                    break;
+                case Section::Items:
+                    if (Entities::Item* item = m_project.addItem(m_pending.id, m_pending.name)) {
+                        item->shareDescription(m_project.getStringPool().intern(m_pending.description));
+                        if (m_pending.primaryFlag) item->setPickable(*m_pending.primaryFlag);
+                        if (m_pending.secondaryFlag) item->setUsable(*m_pending.secondaryFlag);
+                        if (m_pending.firstNumber) item->setQuantity(*m_pending.firstNumber);
+                        if (m_pending.secondNumber) item->setItemType(*m_pending.secondNumber);
+                    }
+                    break;
+                default:
+                    break;
+            }
+            m_pending = PendingEntity{};
+        }
+
+    public:
+        ProjectSaxHandler(Project& project, const std::string& sourceName)
+            : m_project(project), m_sourceName(sourceName) {
+        }
+
+        /**
+         * @brief Verify the document declared a supported format, then link scene exits
+         *
+         * Exits naming a scene that is not in the file are dropped.
+         */
+        void finish() {
+            if (!m_formatSeen) {
+                throw Exceptions::project_format_exception(
+                    std::format("{}: not an {} document", m_sourceName, JsonProjectSerializer::FORMAT_NAME));
+            }
+            for (const auto& [from, targets] : m_pendingExits) {
+                for (const std::string& to : targets) {
+                    m_project.addExit(from, to);
+                }
+            }
+        }
+
+        bool null() override {
+            return true;
+        }
+
+        bool boolean(bool val) override {
+            if (!skipping() && m_depth == ENTITY_DEPTH) {
+                onEntityBoolean(val);
+            }
+            return true;
+        }
+
+        bool number_integer(number_integer_t val) override {
+            if (!skipping() && m_depth == ENTITY_DEPTH) {
+                onEntityInteger(val);
+            } else if (!skipping() && m_depth == ROOT_DEPTH && m_key == "version") {
+                m_version = static_cast<int>(val);
+                if (m_version > JsonProjectSerializer::FORMAT_VERSION) {
+                    throw Exceptions::project_format_exception(
+                        std::format("{}: unsupported {} version {}", m_sourceName, JsonProjectSerializer::FORMAT_NAME, m_version));
+                }
+            } else {
+                onNumber(static_cast<double>(val));
+            }
+            return true;
+        }
+
+        bool number_unsigned(number_unsigned_t val) override {
+            return number_integer(static_cast<number_integer_t>(val));
+        }
+
+        bool number_float(number_float_t val, const string_t&) override {
+            onNumber(val);
+            return true;
+        }
+
+        bool string(string_t& val) override {
+            if (skipping()) {
+                return true;
+            }
+            if (m_depth == ENTITY_DEPTH) {
+                onEntityString(val);
+            } else if (m_depth == COLOR_DEPTH && isExitsKey()) {
+                m_pending.exits.push_back(std::move(val));
+            } else if (m_depth == ROOT_DEPTH) {
+                if (m_key == "name") {
+                    m_project.setName(val);
+                } else if (m_key == "format") {
+                    if (val != JsonProjectSerializer::FORMAT_NAME) {
+                        throw Exceptions::project_format_exception(
+                            std::format("{}: unexpected format '{}'", m_sourceName, val));
+                    }
+                    m_formatSeen = true;
+                }
+            }
+            return true;
+        }
+
+        bool binary(binary_t&) override {
+            return true;
+        }
+
+        bool start_object(std::size_t) override {
+            ++m_depth;
+            if (skipping()) {
+                return true;
+            }
+            // Only the root and the entities inside a known section are objects
+            if (m_depth != ROOT_DEPTH && !(m_depth == ENTITY_DEPTH && m_section != Section::None)) {
+                beginSkip();
+            }
+            return true;
+        }
+
+        bool key(string_t& val) override {
+            if (skipping()) {
+                return true;
+            }
+            if (m_depth == ROOT_DEPTH) {
+                m_key = std::move(val);
+            } else if (m_depth == ENTITY_DEPTH) {
+                m_entityKey = std::move(val);
+            }
+            return true;
+        }
+
+        bool end_object() override {
+            if (!skipping() && m_depth == ENTITY_DEPTH) {
+                commitEntity();
+            }
+            if (m_skipDepth == m_depth) {
+                m_skipDepth = 0;
+            }
+            --m_depth;
+            return true;
+        }
+
+        bool start_array(std::size_t) override {
+            ++m_depth;
+            if (skipping()) {
+                return true;
+            }
+            if (m_depth == SECTION_DEPTH) {
+                if (m_key == "scenes") m_section = Section::Scenes;
+                else if (m_key == "characters") m_section = Section::Characters;
+                else if (m_key == "items") m_section = Section::Items;
+                else beginSkip();
+            } else if (m_depth == COLOR_DEPTH && isColorKey()) {
+                m_colorIndex = 0;
+            } else if (m_depth == COLOR_DEPTH && isExitsKey()) {
+                m_pending.exits.clear();
+            } else {
+                beginSkip();
+            }
+            return true;
+        }
+
+        bool end_array() override {
+            if (!skipping()) {
+                if (m_depth == SECTION_DEPTH) {
+                    m_section = Section::None;
+                } else if (m_depth == COLOR_DEPTH && isColorKey() && m_colorIndex == 4) {
+                    m_pending.color = ImVec4(m_colorComponents[0], m_colorComponents[1],
+                                             m_colorComponents[2], m_colorComponents[3]);
+                }
+            }
+            if (m_skipDepth == m_depth) {
+                m_skipDepth = 0;
+            }
+            --m_depth;
+            return true;
+        }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::json::exception& ex) override {
+            throw Exceptions::json_parse_exception(m_sourceName, keyPath(), ex);
+        }
+    };
+
+    /**
+     * @brief Stream a project as JSON to an output stream
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Walks the three collections once and writes every field directly,
+     * two-space indented with one entity per object. Scene exits are
+     * written as an array of target ids.
+     *
+     * @param project  Project to serialise
+     * @param out      Destination stream
+     * @param progress Optional callback, invoked as entities are written
+     */
+    void JsonProjectSerializer::write(const Project& project, std::ostream& out, const ProgressCallback& progress) {
+        const size_t totalSteps = project.getScenes().size() + project.getCharacters().size()
+            + project.getItems().size();
+        size_t done = 0;
+
+        out << "{\n  \"format\": ";
+        writeJsonString(out, FORMAT_NAME);
+        out << ",\n  \"version\": " << FORMAT_VERSION << ",\n  \"name\": ";
+        writeJsonString(out, project.getName());
+
+        out << ",\n  \"scenes\": [";
+        const char* separator = "\n";
+        for (const auto& scene : project.getScenes()) {
+            out << separator << "    {\n      \"id\": ";
+            writeJsonString(out, scene->getId());
+            out << ",\n      \"name\": ";
+            writeJsonString(out, scene->getName());
+            out << ",\n      \"description\": ";
+            writeJsonString(out, *scene->getDescription());
+            out << ",\n      \"isStartScene\": " << (scene->isStartScene() ? "true" : "false");
+            out << ",\n      \"backgroundColor\": ";
+            writeJsonColor(out, scene->getBackgroundColor());
+            out << ",\n      \"width\": " << scene->getWidth();
+            out << ",\n      \"height\": " << scene->getHeight();
+            out << ",\n      \"exits\": [";
+            const char* exitSeparator = "";
+            for (const Entities::Scene* target : project.getExits(*scene)) {
+                out << exitSeparator;
+                writeJsonString(out, target->getId());
+                exitSeparator = ", ";
+            }
+            out.put(']');
+            out << "\n    }";
+            separator = ",\n";
+            reportProgress(progress, ++done, totalSteps);
+        }
+        out << (project.getScenes().empty() ? "]" : "\n  ]");
+
+        out << ",\n  \"characters\": [";
+        separator = "\n";
+        for (const auto& character : project.getCharacters()) {
+            out << separator << "    {\n      \"id\": ";
+            writeJsonString(out, character->getId());
+            out << ",\n      \"name\": ";
+            writeJsonString(out, character->getName());
+            out << ",\n      \"description\": ";
+            writeJsonString(out, *character->getDescription());
+            out << ",\n      \"health\": " << character->getHealth();
+            out << ",\n      \"maxHealth\": " << character->getMaxHealth();
+            out << ",\n      \"isPlayer\": " << (character->isPlayer() ? "true" : "false");
+            out << ",\n      \"dialogColor\": ";
+            writeJsonColor(out, character->getDialogColor());
+            out << "\n    }";
+            separator = ",\n";
+            reportProgress(progress, ++done, totalSteps);
+        }
+        out << (project.getCharacters().empty() ? "]" : "\n  ]");
+
+        out << ",\n  \"items\": [";
+        separator = "\n";
+        for (const auto& item : project.getItems()) {
+            out << separator << "    {\n      \"id\": ";
+            writeJsonString(out, item->getId());
+            out << ",\n      \"name\": ";
+            writeJsonString(out, item->getName());
+            out << ",\n      \"description\": ";
+            writeJsonString(out, *item->getDescription());
+            out << ",\n      \"isPickable\": " << (item->isPickable() ? "true" : "false");
+            out << ",\n      \"isUsable\": " << (item->isUsable() ? "true" : "false");
+            out << ",\n      \"quantity\": " << item->getQuantity();
+            out << ",\n      \"itemType\": " << item->getItemType();
+            out << "\n    }";
+            separator = ",\n";
+            reportProgress(progress, ++done, totalSteps);
+        }
+        out << (project.getItems().empty() ? "]" : "\n  ]");
+
+        out << "\n}\n";
+        reportProgress(progress, totalSteps, totalSteps);
+    }
+
+    /**
+     * @brief Save a project to a `.adsproj` file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param project  Project to serialise
+     * @param path     Destination file
+     * @param progress Optional callback, invoked as entities are written
+     */
+    void JsonProjectSerializer::write(const Project& project, const std::filesystem::path& path,
+                                      const ProgressCallback& progress) {
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                throw Exceptions::file_not_open_exception(std::format("Cannot write project file: {}", tempPath.string()));
+            }
+            write(project, out, progress);
+            if (!out.good()) {
+                throw Exceptions::file_not_open_exception(std::format("Failed while writing project file: {}", tempPath.string()));
+            }
+        }
+        std::filesystem::rename(tempPath, path);
+    }
+
+    /**
+     * @brief Build a project from a JSON input stream
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param in         Source stream
+     * @param sourceName Name used in error messages (usually the file path)
+     * @return std::unique_ptr<Project> Newly built project
+     */
+    std::unique_ptr<Project> JsonProjectSerializer::read(std::istream& in, const std::string& sourceName) {
+        auto project = std::make_unique<Project>("");
+        ProjectSaxHandler handler(*project, sourceName);
+        nlohmann::json::sax_parse(in, &handler);
+        handler.finish();
+        project->clearDirty();
+        return project;
+    }
+
+    /**
+     * @brief Load a project from a `.adsproj` file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param path Source file; stored on the project as its file path
+     * @return std::unique_ptr<Project> Newly built project
+     */
+    std::unique_ptr<Project> JsonProjectSerializer::read(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) {
+            throw Exceptions::file_not_found_exception(std::format("Project file not found: {}", path.string()));
+        }
+        auto project = read(in, path.string());
+        project->setFilePath(path);
+        return project;
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,129 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_JSON_PROJECT_SERIALIZER_H
+#define ADS_CORE_JSON_PROJECT_SERIALIZER_H
+
+/**
+ * @file JsonProjectSerializer.h
+ * @brief Streaming, human-readable `.adsproj` project format
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Text counterpart of BinaryProjectFile meant for version control and
+ * diffing. Both directions stream: saving writes each entity straight from
+ * the project to the output file, and loading drives nlohmann's SAX
+ * interface so entities are created as their objects close. A full
+ * nlohmann::json DOM is never built, which keeps peak memory close to the
+ * size of the project itself even with multi-megabyte descriptions.
+ *
+ * @see ADS::Core::BinaryProjectFile
+ */
+
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <string_view>
+
+#include "Project.h"
+#include "ProgressCallback.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Streaming reader and writer for `.adsproj` JSON projects
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Stateless utility class. The document layout is:
+     *
+     * @code
+     * {
+     *   "format": "adsproj", "version": 1, "name": "...",
+     *   "scenes":     [ { "id": "...", "name": "...", ... } ],
+     *   "characters": [ ... ],
+     *   "items":      [ ... ]
+     * }
+     * @endcode
+     *
+     * Keys are always written in the same order so saves diff cleanly.
+     * Unknown keys are skipped on load, allowing newer files to be opened.
+     */
+    class JsonProjectSerializer {
+    public:
+        static constexpr std::string_view FILE_EXTENSION = ".adsproj"; ///< Extension used to select this format
+        static constexpr std::string_view FORMAT_NAME = "adsproj";     ///< Value of the "format" key
+        static constexpr int FORMAT_VERSION = 1;                       ///< Highest version this reader understands
+
+        JsonProjectSerializer() = delete;
+
+        /**
+         * @brief Stream a project as JSON to an output stream
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param project  Project to serialise
+         * @param out      Destination stream
+         * @param progress Optional callback, invoked as entities are written
+         */
+        static void write(const Project& project, std::ostream& out, const ProgressCallback& progress = {});
+
+        /**
+         * @brief Save a project to a `.adsproj` file
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Streams to a sibling temporary file which is renamed over @p path
+         * once the write succeeds.
+         *
+         * @param project  Project to serialise
+         * @param path     Destination file
+         * @param progress Optional callback, invoked as entities are written
+         * @throws Exceptions::file_not_open_exception if the file cannot be written
+         */
+        static void write(const Project& project, const std::filesystem::path& path,
+                          const ProgressCallback& progress = {});
+
+        /**
+         * @brief Build a project from a JSON input stream
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param in         Source stream
+         * @param sourceName Name used in error messages (usually the file path)
+         * @return std::unique_ptr<Project> Newly built project
+         * @throws Exceptions::json_parse_exception on malformed JSON
+         * @throws Exceptions::project_format_exception on a foreign or newer document
+         */
+        static std::unique_ptr<Project> read(std::istream& in, const std::string& sourceName);
+
+        /**
+         * @brief Load a project from a `.adsproj` file
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param path Source file; stored on the project as its file path
+         * @return std::unique_ptr<Project> Newly built project
+         * @throws Exceptions::file_not_found_exception if the file does not exist
+         */
+        static std::unique_ptr<Project> read(const std::filesystem::path& path);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_JSON_PROJECT_SERIALIZER_H
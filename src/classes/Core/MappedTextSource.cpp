@@ -0,0 +1,121 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file MappedTextSource.cpp
+ * @brief Implementation of the LRU-cached mapped text source
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "MappedTextSource.h"
+
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace ADS::Core {
+
+    namespace {
+
+        /**
+         * @brief Every live source, so release() can find those over a file
+         */
+        struct Registry {
+            std::mutex mutex;
+            std::vector<MappedTextSource*> sources;
+        };
+
+        Registry& registry() {
+            // Leaked so sources destroyed by other statics still find it
+            static auto* instance = new Registry();
+            return *instance;
+        }
+    }
+
+    MappedTextSource::MappedTextSource(std::shared_ptr<const BinaryProjectFile> file, size_t budgetBytes)
+        : m_file(std::move(file)),
+          m_budgetBytes(budgetBytes),
+          m_cachedBytes(0) {
+        Registry& sources = registry();
+        const std::lock_guard lock(sources.mutex);
+        sources.sources.push_back(this);
+    }
+
+    MappedTextSource::~MappedTextSource() {
+        Registry& sources = registry();
+        const std::lock_guard lock(sources.mutex);
+        std::erase(sources.sources, this);
+    }
+
+    void MappedTextSource::release(const std::filesystem::path& path) {
+        Registry& sources = registry();
+        const std::lock_guard registryLock(sources.mutex);
+        for (MappedTextSource* source : sources.sources) {
+            const std::lock_guard lock(source->m_mutex);
+            std::error_code error;
+            if (source->m_file && std::filesystem::equivalent(source->m_file->getPath(), path, error)) {
+                source->m_strings = std::string(source->m_file->getStringTable());
+                source->m_file.reset();
+            }
+        }
+    }
+
+    bool MappedTextSource::isMapped() const {
+        const std::lock_guard lock(m_mutex);
+        return m_file != nullptr;
+    }
+
+    /**
+     * @brief Load a payload, serving it from the cache when possible
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The payload just loaded is never evicted by its own insertion, so a
+     * single description larger than the budget still round-trips. Evicted
+     * payloads are only freed once no entity or caller holds them anymore.
+     *
+     * @param key Packed string reference
+     * @return std::shared_ptr<const std::string> Payload copy
+     */
+    std::shared_ptr<const std::string> MappedTextSource::load(uint64_t key) {
+        const std::lock_guard lock(m_mutex);
+
+        if (const auto it = m_entries.find(key); it != m_entries.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            return it->second->text;
+        }
+
+        const BinaryFormat::StringRef ref = BinaryFormat::unpackStringRef(key);
+        auto text = std::make_shared<const std::string>(m_file ? m_file->getString(ref)
+                                                               : BinaryFormat::resolveString(m_strings, ref));
+        m_lru.push_front({key, text});
+        m_entries.emplace(key, m_lru.begin());
+        m_cachedBytes += text->size();
+
+        while (m_cachedBytes > m_budgetBytes && m_lru.size() > 1) {
+            const Entry& coldest = m_lru.back();
+            m_cachedBytes -= coldest.text->size();
+            m_entries.erase(coldest.key);
+            m_lru.pop_back();
+        }
+        return text;
+    }
+
+    size_t MappedTextSource::getCachedBytes() const {
+        const std::lock_guard lock(m_mutex);
+        return m_cachedBytes;
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,137 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_MAPPED_TEXT_SOURCE_H
+#define ADS_CORE_MAPPED_TEXT_SOURCE_H
+
+/**
+ * @file MappedTextSource.h
+ * @brief LRU-cached text payloads served from a mapped `.ads` file
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Lets a project opened from the binary container keep only ids, names and
+ * scalar fields resident. Large descriptions stay in the page cache until an
+ * entity asks for them, and the least recently used copies are dropped once
+ * the cache exceeds its byte budget.
+ *
+ * @see ADS::Entities::LazyText
+ * @see ADS::Core::BinaryProjectFile::toProject()
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "BinaryProjectFile.h"
+#include "Entities/LazyText.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Entities::TextSource over the string table of a BinaryProjectFile
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Keys are BinaryFormat::packStringRef() values. The source shares
+     * ownership of the file, so the mapping lives as long as any entity
+     * bound to it, or until release() swaps it for a copy of the string
+     * table. Loads are serialised by a mutex because a background save
+     * reads the same source from its worker thread.
+     */
+    class MappedTextSource final : public Entities::TextSource {
+    public:
+        static constexpr size_t DEFAULT_BUDGET_BYTES = 32 * 1024 * 1024; ///< Default cap on cached payload bytes
+
+        /**
+         * @brief Create a source for a mapped project file
+         *
+         * @param file        Mapped file whose string table backs the payloads
+         * @param budgetBytes Cached bytes above which cold payloads are evicted
+         */
+        explicit MappedTextSource(std::shared_ptr<const BinaryProjectFile> file,
+                                  size_t budgetBytes = DEFAULT_BUDGET_BYTES);
+
+        ~MappedTextSource() override;
+
+        // Non-copyable (registered by address)
+        MappedTextSource(const MappedTextSource&) = delete;
+        MappedTextSource& operator=(const MappedTextSource&) = delete;
+
+        /**
+         * @brief Stop every source reading a file through its mapping
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Each source over @p path copies the string table to memory and
+         * drops its share of the file, so the keys of the entities bound to
+         * it stay valid. Called before a new file replaces @p path, which
+         * Windows refuses while the old one is mapped. Descriptions stay in
+         * memory from then on, until the project is opened again.
+         *
+         * @param path File about to be replaced
+         */
+        static void release(const std::filesystem::path& path);
+
+        /**
+         * @brief Check whether the source still reads from the mapped file
+         * @return bool False once release() copied the string table
+         */
+        [[nodiscard]] bool isMapped() const;
+
+        /**
+         * @brief Load a payload, serving it from the cache when possible
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param key Packed string reference
+         * @return std::shared_ptr<const std::string> Payload copy
+         * @throws Exceptions::project_format_exception if the key is out of range
+         */
+        [[nodiscard]] std::shared_ptr<const std::string> load(uint64_t key) override;
+
+        /**
+         * @brief Get the number of payload bytes currently cached
+         * @return size_t Cached bytes
+         */
+        [[nodiscard]] size_t getCachedBytes() const;
+
+    private:
+        /**
+         * @brief One cached payload, most recently used first
+         */
+        struct Entry {
+            uint64_t key;
+            std::shared_ptr<const std::string> text;
+        };
+
+        std::shared_ptr<const BinaryProjectFile> m_file;    ///< Keeps the mapping alive; null once released
+        std::string m_strings;                              ///< String table copied by release()
+        size_t m_budgetBytes;                               ///< Eviction threshold
+        size_t m_cachedBytes;                               ///< Sum of cached payload sizes
+        std::list<Entry> m_lru;                             ///< Cached payloads, front is hottest
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> m_entries; ///< Key → position in m_lru
+        mutable std::mutex m_mutex;                         ///< Guards the cache state
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_MAPPED_TEXT_SOURCE_H
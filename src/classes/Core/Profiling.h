@@ -0,0 +1,82 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROFILING_H
+#define ADS_CORE_PROFILING_H
+
+/**
+ * @file Profiling.h
+ * @brief Zones, frame marks, plots and memory events for the Tracy profiler
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Only a build configured with ADS_ENABLE_TRACY defines ADS_ENABLE_TRACY
+ * and links the Tracy client; everywhere else every macro expands to
+ * nothing and its arguments are not evaluated, so a plot may count what
+ * it likes. TraceRecorder stays the recorder of shipped builds: it needs
+ * no server and writes a file the user can send.
+ *
+ * Names must be string literals: Tracy keeps the pointer.
+ */
+
+#ifdef ADS_ENABLE_TRACY
+
+#include <cstdint>
+
+#include <tracy/Tracy.hpp>
+
+#define ADS_PROFILE_CONCAT_INNER(a, b) a##b
+#define ADS_PROFILE_CONCAT(a, b) ADS_PROFILE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Record the rest of the enclosing block as a zone; several may share a block
+ */
+#define ADS_ZONE(name) ZoneNamedN(ADS_PROFILE_CONCAT(adsZone, __LINE__), name, true)
+
+/**
+ * @brief End the current frame
+ */
+#define ADS_FRAME_MARK() FrameMark
+
+/**
+ * @brief Add a sample to a plot
+ */
+#define ADS_PLOT(name, value) TracyPlot(name, static_cast<int64_t>(value))
+
+/**
+ * @brief Name the calling thread
+ */
+#define ADS_THREAD_NAME(name) tracy::SetThreadName(name)
+
+/**
+ * @brief Report a block allocated in a memory pool
+ */
+#define ADS_MEMORY_ALLOC(memory, size, pool) TracyAllocN(memory, size, pool)
+
+/**
+ * @brief Report a block of a memory pool freed; before the memory goes back
+ */
+#define ADS_MEMORY_FREE(memory, pool) TracyFreeN(memory, pool)
+
+#else
+
+#define ADS_ZONE(name)
+#define ADS_FRAME_MARK()
+#define ADS_PLOT(name, value)
+#define ADS_THREAD_NAME(name)
+#define ADS_MEMORY_ALLOC(memory, size, pool)
+#define ADS_MEMORY_FREE(memory, pool)
+
+#endif
+
+#endif // ADS_CORE_PROFILING_H
@@ -0,0 +1,55 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROGRESS_CALLBACK_H
+#define ADS_CORE_PROGRESS_CALLBACK_H
+
+/**
+ * @file ProgressCallback.h
+ * @brief Progress reporting hook for long-running project operations
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <cstddef>
+#include <functional>
+
+namespace ADS::Core {
+
+    /// Receives the completed fraction of an operation, in the range [0, 1]
+    using ProgressCallback = std::function<void(float fraction)>;
+
+    inline constexpr size_t PROGRESS_STRIDE = 256; ///< Entities processed between two progress reports
+
+    /**
+     * @brief Report progress every PROGRESS_STRIDE steps and at completion
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Does nothing when no callback is set, so writers can call it
+     * unconditionally from their inner loops.
+     *
+     * @param progress Optional callback
+     * @param done     Steps completed so far
+     * @param total    Total number of steps
+     */
+    inline void reportProgress(const ProgressCallback& progress, size_t done, size_t total) {
+        if (progress && (done % PROGRESS_STRIDE == 0 || done >= total)) {
+            progress(total == 0 ? 1.0f : static_cast<float>(done) / static_cast<float>(total));
+        }
+    }
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROGRESS_CALLBACK_H
@@ -20,7 +20,7 @@
 
 #include "Project.h"
 
-#include <algorithm>
+#include <cstddef>
 
 namespace ADS::Core {
 
@@ -31,12 +31,40 @@ namespace ADS::Core {
      * @version Feb 2026
      *
      * Initializes the project with an empty entity collection and stores
-     * the provided human-readable name.
+     * the provided human-readable name. The scene graph and the search
+     * index follow entity changes through project-wide subscriptions.
      *
      * @param name Human-readable display name for the project
      */
     Project::Project(const std::string& name)
         : m_name(name) {
+        m_subscriptions.add(EntityKind::Scene, "isStartScene", [this](EntityHandle handle, const Inspector::PropertyChangedEvent& event) {
+            if (const auto* isStart = std::get_if<bool>(&event.newValue)) {
+                m_sceneGraph.setStart(handle.index(), *isStart);
+            }
+        });
+
+        // Reindexing only needs the last value of a burst
+        const auto reindex = [this](SearchIndex::Field field) {
+            return [this, field](EntityHandle handle, const Inspector::PropertyChangedEvent& event) {
+                if (m_searchIndexed) {
+                    if (const auto* text = std::get_if<std::string>(&event.newValue)) {
+                        m_searchIndex.setField(handle, field, *text);
+                    }
+                }
+            };
+        };
+        for (size_t kind = 0; kind < ENTITY_KIND_COUNT; ++kind) {
+            m_subscriptions.add(static_cast<EntityKind>(kind), "name", reindex(SearchIndex::Field::Name),
+                                Inspector::DispatchMode::Deferred);
+            m_subscriptions.add(static_cast<EntityKind>(kind), "description", reindex(SearchIndex::Field::Description),
+                                Inspector::DispatchMode::Deferred);
+        }
+
+        // Schemas are per type, so a throwaway instance is enough to reach one
+        m_columns[static_cast<size_t>(EntityKind::Scene)].configure(Entities::Scene("", "").getPropertySchema());
+        m_columns[static_cast<size_t>(EntityKind::Character)].configure(Entities::Character("", "").getPropertySchema());
+        m_columns[static_cast<size_t>(EntityKind::Item)].configure(Entities::Item("", "").getPropertySchema());
     }
 
     // --- Project metadata ---
@@ -66,7 +94,11 @@ namespace ADS::Core {
      * @param name New human-readable display name
      */
     void Project::setName(const std::string& name) {
-        m_name = name;
+        if (m_name != name) {
+            m_name = name;
+            m_metadataDirty = true;
+            ++m_generation;
+        }
     }
 
     // --- File path ---
@@ -127,6 +159,399 @@ namespace ADS::Core {
         m_filePath.reset();
     }
 
+    // --- Change tracking ---
+
+    /**
+     * @brief Record an entity as changed since the last clearDirty()
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Called for every property event, so the common case (entity already
+     * dirty) is a flag test rather than a string hash.
+     *
+     * @param handle Handle of a live entity
+     */
+    void Project::markDirty(EntityHandle handle) {
+        ++m_generation;
+        HandleSlot& slot = m_handleSlots[static_cast<size_t>(handle.kind())][handle.index()];
+        if (!slot.dirty) {
+            slot.dirty = true;
+            m_dirtyIds[static_cast<size_t>(handle.kind())].emplace(slot.entity->getId());
+        }
+    }
+
+    /**
+     * @brief Issue a handle and subscribe to the entity's property events
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Reuses a released slot when one is available. Marks the entity dirty
+     * immediately, since a new entity is itself an unsaved change, and on
+     * every subsequent property change, which is also recorded in the undo
+     * journal. Every change is then routed to the project-wide
+     * subscriptions, immediate ones at once and deferred ones through
+     * flushEvents(). The caller bumps the generation, so a bulk add counts
+     * as a single change.
+     *
+     * @param kind   Collection the entity belongs to
+     * @param entity Newly added entity
+     */
+    void Project::trackEntity(EntityKind kind, Entities::BaseEntity& entity) {
+        std::vector<HandleSlot>& slots = m_handleSlots[static_cast<size_t>(kind)];
+        std::vector<uint32_t>& freeHandles = m_freeHandles[static_cast<size_t>(kind)];
+
+        uint32_t index;
+        if (!freeHandles.empty()) {
+            index = freeHandles.back();
+            freeHandles.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+        slots[index].entity = &entity;
+        slots[index].dirty = true;
+        entity.m_handle = EntityHandle(kind, index, slots[index].generation);
+        m_dirtyIds[static_cast<size_t>(kind)].emplace(entity.getId());
+
+        if (m_searchIndexed) {
+            indexForSearch(entity);
+        }
+        if (kind == EntityKind::Scene) {
+            m_sceneGraph.addNode(index, static_cast<const Entities::Scene&>(entity).isStartScene());
+        }
+        m_columns[static_cast<size_t>(kind)].insert(entity);
+
+        // Dirty tracking, undo and the property columns must see every change as it happens
+        Inspector::PropertyEventDispatcher& dispatcher = entity.getEventDispatcher();
+        dispatcher.setQueue(&m_eventQueue);
+        dispatcher.subscribe([this, handle = entity.m_handle](const Inspector::PropertyChangedEvent& event) {
+            markDirty(handle);
+            m_undoJournal.record(handle, event);
+            m_columns[static_cast<size_t>(handle.kind())].update(handle, event.propertyId, event.newValue);
+            m_subscriptions.dispatch(handle, event, Inspector::DispatchMode::Immediate);
+        });
+        dispatcher.subscribe([this, handle = entity.m_handle](const Inspector::PropertyChangedEvent& event) {
+            m_subscriptions.dispatch(handle, event, Inspector::DispatchMode::Deferred);
+        }, Inspector::DispatchMode::Deferred);
+
+        for (const auto& [membership, listener] : m_membershipListeners) {
+            listener(entity, true);
+        }
+    }
+
+    void Project::untrackEntity(const Entities::BaseEntity& entity) {
+        for (const auto& [membership, listener] : m_membershipListeners) {
+            listener(entity, false);
+        }
+
+        const EntityHandle handle = entity.getHandle();
+        const size_t kind = static_cast<size_t>(handle.kind());
+        m_dirtyIds[kind].erase(entity.getId());
+        m_removedIds[kind].emplace(entity.getId());
+        if (m_searchIndexed) {
+            m_searchIndex.remove(handle);
+        }
+        m_columns[kind].erase(handle);
+        if (handle.kind() == EntityKind::Scene) {
+            // Scenes that lost an exit have changed too
+            for (const uint32_t source : m_sceneGraph.removeNode(handle.index())) {
+                markDirty(m_handleSlots[kind][source].entity->getHandle());
+            }
+        }
+
+        HandleSlot& slot = m_handleSlots[kind][handle.index()];
+        slot.entity = nullptr;
+        slot.dirty = false;
+        if (slot.generation < EntityHandle::MAX_GENERATION) {
+            ++slot.generation;
+            m_freeHandles[kind].push_back(handle.index());
+        }
+    }
+
+    bool Project::isDirty() const {
+        if (m_metadataDirty) {
+            return true;
+        }
+        for (size_t kind = 0; kind < ENTITY_KIND_COUNT; ++kind) {
+            if (!m_dirtyIds[kind].empty() || !m_removedIds[kind].empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Project::isMetadataDirty() const {
+        return m_metadataDirty;
+    }
+
+    const Project::IdSet& Project::getDirtyIds(EntityKind kind) const {
+        return m_dirtyIds[static_cast<size_t>(kind)];
+    }
+
+    const Project::IdSet& Project::getRemovedIds(EntityKind kind) const {
+        return m_removedIds[static_cast<size_t>(kind)];
+    }
+
+    /**
+     * @brief Forget all tracked changes
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Empties the per-kind dirty and removed sets and resets the metadata
+     * flag and the per-slot dirty flags.
+     */
+    void Project::clearDirty() {
+        for (size_t kind = 0; kind < ENTITY_KIND_COUNT; ++kind) {
+            m_dirtyIds[kind].clear();
+            m_removedIds[kind].clear();
+            for (HandleSlot& slot : m_handleSlots[kind]) {
+                slot.dirty = false;
+            }
+        }
+        m_metadataDirty = false;
+    }
+
+    uint64_t Project::getGeneration() const {
+        return m_generation;
+    }
+
+    /**
+     * @brief Take a consistent, independent copy of the project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Collections are copied in the same order into the snapshot's own
+     * pools, and the handle table is copied and repointed at the copies, so
+     * handles of the original resolve in the snapshot too. Nothing is
+     * subscribed on the copies, hence a snapshot never records changes of
+     * its own. Every entity is cloned, whether it changed since the last
+     * snapshot or not.
+     *
+     * @return std::unique_ptr<Project> Snapshot owning its own entities
+     */
+    std::unique_ptr<Project> Project::snapshot() const {
+        auto copy = std::make_unique<Project>(m_name);
+        copy->m_filePath = m_filePath;
+        copy->m_generation = m_generation;
+
+        // Same handles in the snapshot, pointing at the copies
+        copy->m_handleSlots = m_handleSlots;
+        copy->m_freeHandles = m_freeHandles;
+        copy->m_sceneGraph = m_sceneGraph;
+        copy->m_columns = m_columns;
+        for (auto& slots : copy->m_handleSlots) {
+            for (HandleSlot& slot : slots) {
+                slot.dirty = false;
+            }
+        }
+        copy->copyInto(EntityKind::Scene, m_scenes, copy->m_scenes);
+        copy->copyInto(EntityKind::Character, m_characters, copy->m_characters);
+        copy->copyInto(EntityKind::Item, m_items, copy->m_items);
+        return copy;
+    }
+
+    // --- Search ---
+
+    std::shared_ptr<const std::string> Project::descriptionOf(EntityHandle handle) const {
+        switch (handle.kind()) {
+            case EntityKind::Scene:
+                if (const Entities::Scene* scene = findScene(handle)) return scene->getDescription();
+                break;
+            case EntityKind::Character:
+                if (const Entities::Character* character = findCharacter(handle)) return character->getDescription();
+                break;
+            case EntityKind::Item:
+                if (const Entities::Item* item = findItem(handle)) return item->getDescription();
+                break;
+        }
+        return nullptr;
+    }
+
+    void Project::indexForSearch(const Entities::BaseEntity& entity) const {
+        m_searchIndex.setField(entity.getHandle(), SearchIndex::Field::Name, entity.getName());
+        if (const auto description = descriptionOf(entity.getHandle())) {
+            m_searchIndex.setField(entity.getHandle(), SearchIndex::Field::Description, *description);
+        }
+    }
+
+    /**
+     * @brief Find the entities whose name or description contains a text
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Building the index reads every description once, including lazily
+     * loaded ones; the loaded text is not retained by the index.
+     *
+     * @param query Text to look for
+     * @return std::vector<EntityHandle> Matching entities
+     */
+    std::vector<EntityHandle> Project::search(std::string_view query) const {
+        flushEvents();
+        if (!m_searchIndexed) {
+            for (const auto& scene : m_scenes) {
+                indexForSearch(*scene);
+            }
+            for (const auto& character : m_characters) {
+                indexForSearch(*character);
+            }
+            for (const auto& item : m_items) {
+                indexForSearch(*item);
+            }
+            m_searchIndexed = true;
+        }
+        return m_searchIndex.search(query, [this](EntityHandle handle) { return descriptionOf(handle); });
+    }
+
+    // --- Shared text ---
+
+    StringPool& Project::getStringPool() {
+        return m_strings;
+    }
+
+    const StringPool& Project::getStringPool() const {
+        return m_strings;
+    }
+
+    // --- Column queries ---
+
+    ColumnQuery Project::query(const EntityKind kind) const {
+        return ColumnQuery(m_columns[static_cast<size_t>(kind)]);
+    }
+
+    const PropertyColumns& Project::getColumns(const EntityKind kind) const {
+        return m_columns[static_cast<size_t>(kind)];
+    }
+
+    void Project::flushEvents() const {
+        m_eventQueue.flush();
+    }
+
+    size_t Project::getPendingEventCount() const {
+        return m_eventQueue.size();
+    }
+
+    Inspector::SubscriptionHandle Project::subscribe(EntityKind kind, std::string propertyId,
+                                                     PropertySubscriptions::Listener listener,
+                                                     Inspector::DispatchMode mode) {
+        return m_subscriptions.add(kind, std::move(propertyId), std::move(listener), mode);
+    }
+
+    void Project::unsubscribe(Inspector::SubscriptionHandle handle) {
+        m_subscriptions.remove(handle);
+    }
+
+    Inspector::SubscriptionHandle Project::subscribeMembership(MembershipListener listener) {
+        const Inspector::SubscriptionHandle handle = m_nextMembershipHandle++;
+        m_membershipListeners.emplace_back(handle, std::move(listener));
+        return handle;
+    }
+
+    void Project::unsubscribeMembership(Inspector::SubscriptionHandle handle) {
+        std::erase_if(m_membershipListeners, [handle](const auto& entry) { return entry.first == handle; });
+    }
+
+    // --- Batch edits ---
+
+    /**
+     * @brief Set one property to the same value on many entities at once
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each entity still notifies its own subscribers; the project folds
+     * the notifications into one undo group and one generation bump. The
+     * value is validated against the compiled constraints of each schema
+     * met, before any entity of that schema is touched.
+     *
+     * @param handles    Entities to edit
+     * @param propertyId Property to set
+     * @param value      New value
+     * @return size_t Number of entities that accepted the value
+     */
+    size_t Project::setPropertyValues(std::span<const EntityHandle> handles, const std::string& propertyId,
+                                      const Inspector::PropertyValue& value) {
+        const uint64_t generation = m_generation;
+        size_t accepted = 0;
+
+        // Handles are usually all of one kind, so the check is normally made once
+        const Inspector::PropertySchema* checkedSchema = nullptr;
+        bool valid = false;
+
+        m_undoJournal.beginGroup();
+        for (const EntityHandle handle : handles) {
+            Entities::BaseEntity* entity = resolve(handle);
+            if (entity == nullptr) {
+                continue;
+            }
+            if (const Inspector::PropertySchema* schema = &entity->getPropertySchema(); schema != checkedSchema) {
+                checkedSchema = schema;
+                const std::optional<size_t> property = schema->indexOf(propertyId);
+                valid = property && !schema->getValidator().check(*property, value);
+            }
+            if (valid && entity->setPropertyValue(propertyId, value)) {
+                ++accepted;
+            }
+        }
+        m_undoJournal.endGroup();
+
+        if (m_generation != generation) {
+            m_generation = generation + 1;
+        }
+        return accepted;
+    }
+
+    // --- Undo / redo ---
+
+    bool Project::undo() {
+        const uint64_t generation = m_generation;
+        const bool undone = m_undoJournal.undo(*this);
+        if (m_generation != generation) {
+            m_generation = generation + 1;
+        }
+        return undone;
+    }
+
+    bool Project::redo() {
+        const uint64_t generation = m_generation;
+        const bool redone = m_undoJournal.redo(*this);
+        if (m_generation != generation) {
+            m_generation = generation + 1;
+        }
+        return redone;
+    }
+
+    UndoJournal& Project::getUndoJournal() {
+        return m_undoJournal;
+    }
+
+    // --- Handles ---
+
+    /**
+     * @brief Resolve a handle to its entity
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Bounds-checks kind and index, then compares generations: a removed
+     * entity's slot has moved on, so its old handles resolve to nullptr.
+     *
+     * @param handle Handle to resolve
+     * @return Entities::BaseEntity* Live entity, or nullptr
+     */
+    Entities::BaseEntity* Project::resolve(EntityHandle handle) const {
+        const size_t kind = static_cast<size_t>(handle.kind());
+        if (!handle.isValid() || kind >= ENTITY_KIND_COUNT || handle.index() >= m_handleSlots[kind].size()) {
+            return nullptr;
+        }
+        const HandleSlot& slot = m_handleSlots[kind][handle.index()];
+        return slot.generation == handle.generation() ? slot.entity : nullptr;
+    }
+
     // --- Scene CRUD ---
 
     /**
@@ -135,8 +560,9 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Constructs a Scene with the given id and name, takes ownership via
-     * unique_ptr, and appends it to the scene collection.
+     * Reserves the id in the scene index first, so the duplicate check and
+     * the insertion share a single hash lookup. On success constructs the
+     * Scene in its pool and appends it to the collection.
      *
      * @param id   Unique identifier for the scene
      * @param name Display name for the scene
@@ -144,11 +570,7 @@ namespace ADS::Core {
      *         or nullptr if a scene with the same id already exists
      */
     Entities::Scene* Project::addScene(const std::string& id, const std::string& name) {
-        if (findScene(id) != nullptr) {
-            return nullptr;
-        }
-        m_scenes.push_back(std::make_unique<Entities::Scene>(id, name));
-        return m_scenes.back().get();
+        return addEntity(EntityKind::Scene, m_scenes, id, name);
     }
 
     /**
@@ -157,19 +579,26 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Erases the scene whose id matches the argument from the collection.
-     * Does nothing if no matching scene is found.
+     * Erases the scene whose id matches the argument from the collection and
+     * drops it from the index, then refreshes the positions of the entries
+     * that followed it. Does nothing if no matching scene is found.
      *
      * @param id Unique identifier of the scene to remove
      */
-    void Project::removeScene(const std::string& id) {
-        m_scenes.erase(
-            std::remove_if(m_scenes.begin(), m_scenes.end(),
-                [&id](const std::unique_ptr<Entities::Scene>& s) {
-                    return s->getId() == id;
-                }),
-            m_scenes.end()
-        );
+    void Project::removeScene(std::string_view id) {
+        removeEntity(m_scenes, id);
+    }
+
+    size_t Project::addScenes(std::span<const NewEntity> entries) {
+        return addEntities(EntityKind::Scene, m_scenes, entries);
+    }
+
+    size_t Project::addScenes(std::span<const NewEntity> entries, const Initializer<Entities::Scene>& initialize) {
+        return addEntities(EntityKind::Scene, m_scenes, entries, initialize);
+    }
+
+    size_t Project::removeScenes(std::span<const std::string> ids) {
+        return removeEntities(m_scenes, ids);
     }
 
     /**
@@ -178,19 +607,21 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Performs a linear search through the scene collection for an entry
-     * whose id matches the argument.
+     * Looks the id up in the scene hash index and dereferences the stored
+     * position, giving O(1) lookups for any string-like key.
      *
      * @param id Unique identifier to search for
      * @return Entities::Scene* Non-owning pointer to the scene, or nullptr if not found
      */
-    Entities::Scene* Project::findScene(const std::string& id) const {
-        for (const auto& scene : m_scenes) {
-            if (scene->getId() == id) {
-                return scene.get();
-            }
+    Entities::Scene* Project::findScene(std::string_view id) const {
+        return m_scenes.find(id);
+    }
+
+    Entities::Scene* Project::findScene(EntityHandle handle) const {
+        if (handle.kind() != EntityKind::Scene) {
+            return nullptr;
         }
-        return nullptr;
+        return static_cast<Entities::Scene*>(resolve(handle));
     }
 
     /**
@@ -201,10 +632,104 @@ namespace ADS::Core {
      *
      * Provides read-only access to the owned scene vector for iteration.
      *
-     * @return const std::vector<std::unique_ptr<Entities::Scene>>& Owned scene vector
+     * @return const std::vector<ScenePtr>& Owned scene vector
      */
-    const std::vector<std::unique_ptr<Entities::Scene>>& Project::getScenes() const {
-        return m_scenes;
+    const std::vector<Project::ScenePtr>& Project::getScenes() const {
+        return m_scenes.getEntities();
+    }
+
+    // --- Scene exits ---
+
+    bool Project::addExit(std::string_view fromId, std::string_view toId) {
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Project);
+        const Entities::Scene* from = findScene(fromId);
+        const Entities::Scene* to = findScene(toId);
+        if (from == nullptr || to == nullptr || !m_sceneGraph.addEdge(from->getHandle().index(), to->getHandle().index())) {
+            return false;
+        }
+        markDirty(from->getHandle());
+        return true;
+    }
+
+    size_t Project::addExits(const std::span<const std::pair<std::string_view, std::string_view>> exits) {
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Project);
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        std::vector<EntityHandle> sources;
+        edges.reserve(exits.size());
+        sources.reserve(exits.size());
+        for (const auto& [fromId, toId] : exits) {
+            const Entities::Scene* from = findScene(fromId);
+            const Entities::Scene* to = findScene(toId);
+            if (from != nullptr && to != nullptr) {
+                edges.emplace_back(from->getHandle().index(), to->getHandle().index());
+                sources.push_back(from->getHandle());
+            }
+        }
+        const size_t added = m_sceneGraph.addEdges(edges);
+        if (added > 0) {
+            // Some of the sources only had exits repeated; marking them dirty too is harmless
+            for (const EntityHandle source : sources) {
+                markDirty(source);
+            }
+        }
+        return added;
+    }
+
+    bool Project::removeExit(std::string_view fromId, std::string_view toId) {
+        const Entities::Scene* from = findScene(fromId);
+        const Entities::Scene* to = findScene(toId);
+        if (from == nullptr || to == nullptr || !m_sceneGraph.removeEdge(from->getHandle().index(), to->getHandle().index())) {
+            return false;
+        }
+        markDirty(from->getHandle());
+        return true;
+    }
+
+    std::vector<Entities::Scene*> Project::scenesAt(std::span<const uint32_t> nodes) const {
+        const std::vector<HandleSlot>& slots = m_handleSlots[static_cast<size_t>(EntityKind::Scene)];
+        std::vector<Entities::Scene*> scenes;
+        scenes.reserve(nodes.size());
+        for (const uint32_t node : nodes) {
+            scenes.push_back(static_cast<Entities::Scene*>(slots[node].entity));
+        }
+        return scenes;
+    }
+
+    std::vector<Entities::Scene*> Project::getExits(const Entities::Scene& scene) const {
+        if (findScene(scene.getHandle()) != &scene) {
+            return {};
+        }
+        return scenesAt(m_sceneGraph.successors(scene.getHandle().index()));
+    }
+
+    Entities::Scene* Project::getNextSceneTowards(const Entities::Scene& from, const Entities::Scene& to) const {
+        if (findScene(from.getHandle()) != &from || findScene(to.getHandle()) != &to) {
+            return nullptr;
+        }
+        const uint32_t next = m_sceneGraph.nextHop(from.getHandle().index(), to.getHandle().index());
+        if (next == SceneGraph::NO_ROUTE) {
+            return nullptr;
+        }
+        return scenesAt({&next, 1}).front();
+    }
+
+    std::vector<Entities::Scene*> Project::getRoute(const Entities::Scene& from, const Entities::Scene& to) const {
+        if (findScene(from.getHandle()) != &from || findScene(to.getHandle()) != &to) {
+            return {};
+        }
+        return scenesAt(m_sceneGraph.route(from.getHandle().index(), to.getHandle().index()));
+    }
+
+    std::vector<Entities::Scene*> Project::getUnreachableScenes() const {
+        return scenesAt(m_sceneGraph.unreachable());
+    }
+
+    std::vector<Entities::Scene*> Project::getDeadEndScenes() const {
+        return scenesAt(m_sceneGraph.deadEnds());
+    }
+
+    std::vector<Entities::Scene*> Project::getOrphanScenes() const {
+        return scenesAt(m_sceneGraph.orphans());
     }
 
     // --- Character CRUD ---
@@ -215,8 +740,9 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Constructs a Character with the given id and name, takes ownership via
-     * unique_ptr, and appends it to the character collection.
+     * Reserves the id in the character index first, so the duplicate check and
+     * the insertion share a single hash lookup. On success constructs the
+     * Character in its pool and appends it to the collection.
      *
      * @param id   Unique identifier for the character
      * @param name Display name for the character
@@ -224,11 +750,7 @@ namespace ADS::Core {
      *         or nullptr if a character with the same id already exists
      */
     Entities::Character* Project::addCharacter(const std::string& id, const std::string& name) {
-        if (findCharacter(id) != nullptr) {
-            return nullptr;
-        }
-        m_characters.push_back(std::make_unique<Entities::Character>(id, name));
-        return m_characters.back().get();
+        return addEntity(EntityKind::Character, m_characters, id, name);
     }
 
     /**
@@ -237,19 +759,26 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Erases the character whose id matches the argument from the collection.
-     * Does nothing if no matching character is found.
+     * Erases the character whose id matches the argument from the collection and
+     * drops it from the index, then refreshes the positions of the entries
+     * that followed it. Does nothing if no matching character is found.
      *
      * @param id Unique identifier of the character to remove
      */
-    void Project::removeCharacter(const std::string& id) {
-        m_characters.erase(
-            std::remove_if(m_characters.begin(), m_characters.end(),
-                [&id](const std::unique_ptr<Entities::Character>& c) {
-                    return c->getId() == id;
-                }),
-            m_characters.end()
-        );
+    void Project::removeCharacter(std::string_view id) {
+        removeEntity(m_characters, id);
+    }
+
+    size_t Project::addCharacters(std::span<const NewEntity> entries) {
+        return addEntities(EntityKind::Character, m_characters, entries);
+    }
+
+    size_t Project::addCharacters(std::span<const NewEntity> entries, const Initializer<Entities::Character>& initialize) {
+        return addEntities(EntityKind::Character, m_characters, entries, initialize);
+    }
+
+    size_t Project::removeCharacters(std::span<const std::string> ids) {
+        return removeEntities(m_characters, ids);
     }
 
     /**
@@ -258,19 +787,21 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Performs a linear search through the character collection for an entry
-     * whose id matches the argument.
+     * Looks the id up in the character hash index and dereferences the stored
+     * position, giving O(1) lookups for any string-like key.
      *
      * @param id Unique identifier to search for
      * @return Entities::Character* Non-owning pointer to the character, or nullptr if not found
      */
-    Entities::Character* Project::findCharacter(const std::string& id) const {
-        for (const auto& character : m_characters) {
-            if (character->getId() == id) {
-                return character.get();
-            }
+    Entities::Character* Project::findCharacter(std::string_view id) const {
+        return m_characters.find(id);
+    }
+
+    Entities::Character* Project::findCharacter(EntityHandle handle) const {
+        if (handle.kind() != EntityKind::Character) {
+            return nullptr;
         }
-        return nullptr;
+        return static_cast<Entities::Character*>(resolve(handle));
     }
 
     /**
@@ -281,10 +812,10 @@ namespace ADS::Core {
      *
      * Provides read-only access to the owned character vector for iteration.
      *
-     * @return const std::vector<std::unique_ptr<Entities::Character>>& Owned character vector
+     * @return const std::vector<CharacterPtr>& Owned character vector
      */
-    const std::vector<std::unique_ptr<Entities::Character>>& Project::getCharacters() const {
-        return m_characters;
+    const std::vector<Project::CharacterPtr>& Project::getCharacters() const {
+        return m_characters.getEntities();
     }
 
     // --- Item CRUD ---
@@ -295,8 +826,9 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Constructs an Item with the given id and name, takes ownership via
-     * unique_ptr, and appends it to the item collection.
+     * Reserves the id in the item index first, so the duplicate check and
+     * the insertion share a single hash lookup. On success constructs the
+     * Item in its pool and appends it to the collection.
      *
      * @param id   Unique identifier for the item
      * @param name Display name for the item
@@ -304,11 +836,7 @@ namespace ADS::Core {
      *         or nullptr if an item with the same id already exists
      */
     Entities::Item* Project::addItem(const std::string& id, const std::string& name) {
-        if (findItem(id) != nullptr) {
-            return nullptr;
-        }
-        m_items.push_back(std::make_unique<Entities::Item>(id, name));
-        return m_items.back().get();
+        return addEntity(EntityKind::Item, m_items, id, name);
     }
 
     /**
@@ -317,19 +845,26 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Erases the item whose id matches the argument from the collection.
-     * Does nothing if no matching item is found.
+     * Erases the item whose id matches the argument from the collection and
+     * drops it from the index, then refreshes the positions of the entries
+     * that followed it. Does nothing if no matching item is found.
      *
      * @param id Unique identifier of the item to remove
      */
-    void Project::removeItem(const std::string& id) {
-        m_items.erase(
-            std::remove_if(m_items.begin(), m_items.end(),
-                [&id](const std::unique_ptr<Entities::Item>& i) {
-                    return i->getId() == id;
-                }),
-            m_items.end()
-        );
+    void Project::removeItem(std::string_view id) {
+        removeEntity(m_items, id);
+    }
+
+    size_t Project::addItems(std::span<const NewEntity> entries) {
+        return addEntities(EntityKind::Item, m_items, entries);
+    }
+
+    size_t Project::addItems(std::span<const NewEntity> entries, const Initializer<Entities::Item>& initialize) {
+        return addEntities(EntityKind::Item, m_items, entries, initialize);
+    }
+
+    size_t Project::removeItems(std::span<const std::string> ids) {
+        return removeEntities(m_items, ids);
     }
 
     /**
@@ -338,19 +873,21 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Performs a linear search through the item collection for an entry
-     * whose id matches the argument.
+     * Looks the id up in the item hash index and dereferences the stored
+     * position, giving O(1) lookups for any string-like key.
      *
      * @param id Unique identifier to search for
      * @return Entities::Item* Non-owning pointer to the item, or nullptr if not found
      */
-    Entities::Item* Project::findItem(const std::string& id) const {
-        for (const auto& item : m_items) {
-            if (item->getId() == id) {
-                return item.get();
-            }
+    Entities::Item* Project::findItem(std::string_view id) const {
+        return m_items.find(id);
+    }
+
+    Entities::Item* Project::findItem(EntityHandle handle) const {
+        if (handle.kind() != EntityKind::Item) {
+            return nullptr;
         }
-        return nullptr;
+        return static_cast<Entities::Item*>(resolve(handle));
     }
 
     /**
@@ -361,10 +898,10 @@ namespace ADS::Core {
      *
      * Provides read-only access to the owned item vector for iteration.
      *
-     * @return const std::vector<std::unique_ptr<Entities::Item>>& Owned item vector
+     * @return const std::vector<ItemPtr>& Owned item vector
      */
-    const std::vector<std::unique_ptr<Entities::Item>>& Project::getItems() const {
-        return m_items;
+    const std::vector<Project::ItemPtr>& Project::getItems() const {
+        return m_items.getEntities();
     }
 
 } // namespace ADS::Core
@@ -30,15 +30,34 @@
  * @see ADS::Entities::Item
  */
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "AllocationCounter.h"
+#include "ColumnQuery.h"
 #include "Entities/Scene.h"
 #include "Entities/Character.h"
 #include "Entities/Item.h"
+#include "EntityCollection.h"
+#include "EntityHandle.h"
+#include "PropertySubscriptions.h"
+#include "SceneGraph.h"
+#include "SearchIndex.h"
+#include "StringPool.h"
+#include "UndoJournal.h"
 
 namespace ADS::Core {
 
@@ -48,18 +67,234 @@ namespace ADS::Core {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Feb 2026
      *
-     * Project owns the collections of Scene, Character, and Item instances
-     * via std::unique_ptr. Accessors return raw (non-owning) pointers to
-     * individual entities. The class is non-copyable because it holds
-     * unique ownership of its entities.
+     * Project owns one EntityCollection each for Scene, Character, and Item
+     * instances. Each collection allocates from its own EntityPool, so
+     * entities of one kind sit in contiguous slabs and keep a stable address
+     * for their lifetime, and keeps an id index so lookups and duplicate
+     * checks are O(1). Accessors return raw (non-owning) pointers to
+     * individual entities. The class is non-copyable because it holds unique
+     * ownership of its entities.
+     *
+     * Change tracking stays here: the collections only store, while Project
+     * issues handles, records dirty and removed ids and bumps the generation
+     * around every collection operation.
+     *
+     * Every entity also receives an EntityHandle from a per-kind slot table.
+     * Handles resolve with two array lookups and no hashing, and stop
+     * resolving once their entity is removed, so holders can detect stale
+     * selections instead of dereferencing a dangling pointer.
      */
     class Project {
     private:
+        /**
+         * @brief Entry of the per-kind handle table
+         */
+        struct HandleSlot {
+            Entities::BaseEntity* entity = nullptr; ///< Live entity, nullptr while the slot is free
+            uint32_t generation = 1;                ///< Bumped every time the slot is released
+            bool dirty = false;                     ///< Entity is already in the dirty set
+        };
+
+    public:
+        /// Set of entity ids supporting std::string_view lookups
+        using IdSet = std::unordered_set<std::string, EntityIdHash, std::equal_to<>>;
+
+        using ScenePtr = EntityCollection<Entities::Scene>::Ptr;         ///< Owning pointer into the scene pool
+        using CharacterPtr = EntityCollection<Entities::Character>::Ptr; ///< Owning pointer into the character pool
+        using ItemPtr = EntityCollection<Entities::Item>::Ptr;           ///< Owning pointer into the item pool
+
+        using NewEntity = Core::NewEntity;  ///< Entry of a bulk add
+
+        /**
+         * @brief Sets the starting values of an entity of a bulk add, given its entry's position
+         */
+        template<typename T>
+        using Initializer = std::function<void(T& entity, size_t entry)>;
+
+        /**
+         * @brief Called when an entity joins the project (true) or is about to leave it (false)
+         */
+        using MembershipListener = std::function<void(const Entities::BaseEntity& entity, bool added)>;
+
+    private:
+
         std::string m_name;                                             ///< Project display name
         std::optional<std::filesystem::path> m_filePath;               ///< Path on disk — empty until first save
-        std::vector<std::unique_ptr<Entities::Scene>>     m_scenes;    ///< Owned scene collection
-        std::vector<std::unique_ptr<Entities::Character>> m_characters; ///< Owned character collection
-        std::vector<std::unique_ptr<Entities::Item>>      m_items;     ///< Owned item collection
+        mutable Inspector::PropertyEventQueue m_eventQueue;             ///< Deferred entity events; declared before the entities it outlives
+        PropertySubscriptions m_subscriptions;                          ///< Project-wide listeners, by kind and property
+        EntityCollection<Entities::Scene>     m_scenes;                ///< Owned scene collection
+        EntityCollection<Entities::Character> m_characters;            ///< Owned character collection
+        EntityCollection<Entities::Item>      m_items;                 ///< Owned item collection
+        std::array<IdSet, ENTITY_KIND_COUNT> m_dirtyIds;                ///< Added or modified since clearDirty(), per kind
+        std::array<IdSet, ENTITY_KIND_COUNT> m_removedIds;              ///< Removed since clearDirty(), per kind
+        bool m_metadataDirty = false;                                   ///< Project name changed since clearDirty()
+        std::array<std::vector<HandleSlot>, ENTITY_KIND_COUNT> m_handleSlots; ///< Handle index → entity, per kind
+        std::array<std::vector<uint32_t>, ENTITY_KIND_COUNT> m_freeHandles;   ///< Released slot indexes, per kind
+        uint64_t m_generation = 0;                                      ///< Bumped on every tracked change
+        UndoJournal m_undoJournal;                                      ///< Undo/redo history of property edits
+        mutable SearchIndex m_searchIndex;                              ///< Names and descriptions, built on first search
+        mutable bool m_searchIndexed = false;                           ///< m_searchIndex is built and kept current
+        SceneGraph m_sceneGraph;                                        ///< Scene exits, by scene handle index
+        std::array<PropertyColumns, ENTITY_KIND_COUNT> m_columns;       ///< Scalar properties by kind, see query()
+        StringPool m_strings;                                           ///< Shared entity text, see getStringPool()
+        std::vector<std::pair<Inspector::SubscriptionHandle, MembershipListener>> m_membershipListeners; ///< See subscribeMembership()
+        Inspector::SubscriptionHandle m_nextMembershipHandle = 1;      ///< Handle of the next membership listener
+
+        /**
+         * @brief Record an entity as changed since the last clearDirty()
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Only the first change after clearDirty() touches the id set; later
+         * changes are absorbed by the slot's dirty flag.
+         *
+         * @param handle Handle of a live entity
+         */
+        void markDirty(EntityHandle handle);
+
+        /**
+         * @brief Issue a handle and subscribe to the entity's property events
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The subscription captures the project and the handle; both are safe
+         * because the project owns the entity and outlives it.
+         *
+         * @param kind   Collection the entity belongs to
+         * @param entity Newly added entity
+         */
+        void trackEntity(EntityKind kind, Entities::BaseEntity& entity);
+
+        /**
+         * @brief Record a removal and retire the entity's handle
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Bumps the slot generation so outstanding handles stop resolving.
+         * A slot whose generation is exhausted is never reused.
+         *
+         * @param entity Entity about to be destroyed
+         */
+        void untrackEntity(const Entities::BaseEntity& entity);
+
+        /**
+         * @brief Map scene graph nodes back to their scenes
+         *
+         * @param nodes Scene handle indexes
+         * @return std::vector<Entities::Scene*> Live scenes, in the same order
+         */
+        [[nodiscard]] std::vector<Entities::Scene*> scenesAt(std::span<const uint32_t> nodes) const;
+
+        /**
+         * @brief Get an entity's description, whatever its kind
+         *
+         * @param handle Handle of the entity
+         * @return std::shared_ptr<const std::string> Description, or nullptr if the handle is stale
+         */
+        [[nodiscard]] std::shared_ptr<const std::string> descriptionOf(EntityHandle handle) const;
+
+        /**
+         * @brief Add the name and description of an entity to the search index
+         *
+         * @param entity Entity to index
+         */
+        void indexForSearch(const Entities::BaseEntity& entity) const;
+
+        /**
+         * @brief Add one entity to a collection and start tracking it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param kind       Kind of the collection
+         * @param collection Collection to add to
+         * @param id         Unique identifier within the collection
+         * @param name       Display name
+         * @return T* Non-owning pointer to the new entity, or nullptr if the id is taken
+         */
+        template<typename T>
+        T* addEntity(EntityKind kind, EntityCollection<T>& collection, const std::string& id, const std::string& name) {
+            AllocationCounter::Scope memory(AllocationCounter::Tag::Project);
+            T* entity = collection.add(id, name);
+            if (entity != nullptr) {
+                trackEntity(kind, *entity);
+                ++m_generation;
+            }
+            return entity;
+        }
+
+        /**
+         * @brief Remove one entity from a collection, recording the removal
+         *
+         * @param collection Collection to remove from
+         * @param id         Identifier of the entity to remove
+         */
+        template<typename T>
+        void removeEntity(EntityCollection<T>& collection, std::string_view id) {
+            if (collection.remove(id, [this](const T& entity) { untrackEntity(entity); })) {
+                ++m_generation;
+            }
+        }
+
+        /**
+         * @brief Bulk add to a collection, counted as a single change
+         *
+         * @param kind       Kind of the collection
+         * @param collection Collection to add to
+         * @param entries    Entities to create
+         * @param initialize Called on each new entity before it is tracked; may be empty
+         * @return size_t Number of entities added
+         */
+        template<typename T>
+        size_t addEntities(EntityKind kind, EntityCollection<T>& collection, std::span<const NewEntity> entries,
+                           const Initializer<T>& initialize = {}) {
+            AllocationCounter::Scope memory(AllocationCounter::Tag::Project);
+            const size_t added = collection.addAll(entries, [this, kind, &initialize](T& entity, const size_t entry) {
+                if (initialize) {
+                    initialize(entity, entry);
+                }
+                trackEntity(kind, entity);
+            });
+            if (added > 0) {
+                ++m_generation;
+            }
+            return added;
+        }
+
+        /**
+         * @brief Bulk remove from a collection, counted as a single change
+         *
+         * @param collection Collection to remove from
+         * @param ids        Ids to remove
+         * @return size_t Number of entities removed
+         */
+        template<typename T>
+        size_t removeEntities(EntityCollection<T>& collection, std::span<const std::string> ids) {
+            const size_t removed = collection.removeAll(ids, [this](const T& entity) { untrackEntity(entity); });
+            if (removed > 0) {
+                ++m_generation;
+            }
+            return removed;
+        }
+
+        /**
+         * @brief Copy a collection into a snapshot, sharing handles
+         *
+         * @param kind   Kind of the collection
+         * @param source Collection of the original project
+         * @param target Matching collection of the snapshot
+         */
+        template<typename T>
+        void copyInto(EntityKind kind, const EntityCollection<T>& source, EntityCollection<T>& target) {
+            target.reserve(source.size());
+            for (const auto& entity : source) {
+                T* copy = target.addCopy(*entity);
+                m_handleSlots[static_cast<size_t>(kind)][copy->getHandle().index()].entity = copy;
+            }
+        }
 
     public:
         /**
@@ -81,12 +316,12 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Default destructor. All entity collections are automatically released
-         * through their unique_ptr destructors.
+         * Default destructor. All entities are returned to their pools through
+         * the pool-aware unique_ptr deleters before the pools are released.
          */
         ~Project() = default;
 
-        // Non-copyable (owns unique_ptrs)
+        // Non-copyable (owns its entities and their pools)
         Project(const Project&) = delete;
         Project& operator=(const Project&) = delete;
 
@@ -178,6 +413,301 @@ namespace ADS::Core {
          */
         void clearFilePath();
 
+        // --- Change tracking ---
+
+        /**
+         * @brief Check whether anything changed since the last clearDirty()
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Entities are marked dirty when added and whenever they emit a
+         * PropertyChangedEvent; removals and project renames are tracked too.
+         *
+         * @return bool True if there are changes that have not been persisted
+         * @see clearDirty()
+         */
+        [[nodiscard]] bool isDirty() const;
+
+        /**
+         * @brief Check whether the project metadata (its name) changed
+         *
+         * @return bool True if setName() changed the name since clearDirty()
+         */
+        [[nodiscard]] bool isMetadataDirty() const;
+
+        /**
+         * @brief Get the ids of entities added or modified since clearDirty()
+         *
+         * @param kind Collection to query
+         * @return const IdSet& Ids of entities that still exist and changed
+         */
+        [[nodiscard]] const IdSet& getDirtyIds(EntityKind kind) const;
+
+        /**
+         * @brief Get the ids of entities removed since clearDirty()
+         *
+         * An id may appear in both sets when an entity was removed and then
+         * re-added; consumers must apply removals before upserts.
+         *
+         * @param kind Collection to query
+         * @return const IdSet& Ids of removed entities
+         */
+        [[nodiscard]] const IdSet& getRemovedIds(EntityKind kind) const;
+
+        /**
+         * @brief Forget all tracked changes
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Called by the persistence layer once the changes have been written,
+         * either to the project file or to its autosave journal.
+         */
+        void clearDirty();
+
+        /**
+         * @brief Get the change counter of the project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Incremented on every change that is also recorded in the dirty
+         * sets. Unlike the dirty sets it is never reset, so comparing two
+         * readings tells whether anything changed in between.
+         *
+         * @return uint64_t Current generation
+         */
+        [[nodiscard]] uint64_t getGeneration() const;
+
+        /**
+         * @brief Take a consistent, independent copy of the project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Entities are copied without their event subscribers and share their
+         * immutable description text with the original. The copy is eager,
+         * not copy-on-write: it costs O(entities) on the calling thread, and
+         * a project of a quarter of a million entities stalls the caller for
+         * well over a hundred milliseconds. Callers on the main thread should
+         * expect that pause on large projects. The snapshot has the same name,
+         * file path and contents, starts clean and may be handed to another
+         * thread while the original keeps being edited.
+         *
+         * @return std::unique_ptr<Project> Snapshot owning its own entities
+         */
+        [[nodiscard]] std::unique_ptr<Project> snapshot() const;
+
+        // --- Shared text ---
+
+        /**
+         * @brief Get the pool sharing one copy of each distinct entity text
+         *
+         * Loaders and paste set descriptions through it, so entities with
+         * the same description hold one payload between them:
+         *
+         *   item.shareDescription(project.getStringPool().intern(record.description));
+         *
+         * Snapshots start with an empty pool and keep the payloads their
+         * entities hold.
+         *
+         * @return StringPool& Pool owned by the project
+         */
+        [[nodiscard]] StringPool& getStringPool();
+        [[nodiscard]] const StringPool& getStringPool() const;
+
+        // --- Search ---
+
+        /**
+         * @brief Find the entities whose name or description contains a text
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The first search builds a trigram index over every entity; from
+         * then on the index follows adds, removes and name or description
+         * changes, so each later search only verifies a handful of
+         * candidates. Queries shorter than SearchIndex::MIN_INDEXED_QUERY
+         * match names only.
+         *
+         * @param query Text to look for, case-insensitive for ASCII
+         * @return std::vector<EntityHandle> Matching entities, in no particular
+         *         order; empty for an empty query
+         */
+        [[nodiscard]] std::vector<EntityHandle> search(std::string_view query) const;
+
+        /**
+         * @brief Deliver the entity events deferred since the last flush
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The project keeps its search index current from deferred
+         * subscriptions, so a burst of edits to one property reindexes it
+         * once. Call once per frame; search() flushes on its own first.
+         *
+         * @see Inspector::PropertyEventQueue
+         */
+        void flushEvents() const;
+
+        /**
+         * @brief Get the number of entity events waiting for flushEvents()
+         *
+         * @return size_t Deferred events not delivered yet
+         */
+        [[nodiscard]] size_t getPendingEventCount() const;
+
+        // --- Column queries ---
+
+        /**
+         * @brief Start a query over the scalar properties of every entity of a kind
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The project mirrors the bool, int, enum and float properties of its
+         * entities, computed ones aside, in PropertyColumns updated with
+         * every property event, so a query scans flat arrays instead of
+         * calling getPropertyValue() on each entity:
+         *
+         *   project.query(EntityKind::Item).where("quantity", Compare::Greater, 10).handles()
+         *
+         * The query reads the project's columns; do not edit the project
+         * while it is in use.
+         *
+         * @param kind Entity kind to query
+         * @return ColumnQuery Query selecting every entity of the kind
+         */
+        [[nodiscard]] ColumnQuery query(EntityKind kind) const;
+
+        /**
+         * @brief Get the scalar property columns of a kind
+         * @param kind Entity kind
+         * @return const PropertyColumns& Columns, current with the last edit
+         */
+        [[nodiscard]] const PropertyColumns& getColumns(EntityKind kind) const;
+
+        /**
+         * @brief Listen to a property of every entity of a kind
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Covers entities added after the call as well. Only the listeners
+         * of the changed property are called, so a panel following the
+         * names of all scenes pays nothing when an item's weight changes.
+         * Deferred listeners are called from flushEvents().
+         *
+         * @param kind       Entity kind to listen to
+         * @param propertyId Property to listen to; empty for all properties
+         * @param listener   Called with the entity's handle and the change
+         * @param mode       Immediate, or Deferred to flushEvents()
+         * @return Inspector::SubscriptionHandle Handle for unsubscribe()
+         */
+        Inspector::SubscriptionHandle subscribe(EntityKind kind, std::string propertyId,
+                                                PropertySubscriptions::Listener listener,
+                                                Inspector::DispatchMode mode = Inspector::DispatchMode::Immediate);
+
+        /**
+         * @brief Stop a listener registered with subscribe()
+         * @param handle Handle returned by subscribe(); unknown handles are ignored
+         */
+        void unsubscribe(Inspector::SubscriptionHandle handle);
+
+        /**
+         * @brief Listen to entities being added and removed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Property events only describe entities that already exist; this
+         * covers the rest. An added entity is reported once it is tracked,
+         * after a bulk add's initializer has set its starting values, and
+         * a removed one while it can still be read. Listeners must not
+         * subscribe or unsubscribe from the call.
+         *
+         * @param listener Called with the entity and whether it was added
+         * @return Inspector::SubscriptionHandle Handle for unsubscribeMembership()
+         */
+        Inspector::SubscriptionHandle subscribeMembership(MembershipListener listener);
+
+        /**
+         * @brief Stop a listener registered with subscribeMembership()
+         * @param handle Handle returned by subscribeMembership(); unknown handles are ignored
+         */
+        void unsubscribeMembership(Inspector::SubscriptionHandle handle);
+
+        // --- Batch edits ---
+
+        /**
+         * @brief Set one property to the same value on many entities at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The whole batch is a single change: it bumps the generation once
+         * and is recorded as one undo step, so undoing it restores every
+         * entity. Stale handles and entities that reject the value are
+         * skipped, as are entities whose schema's constraints the value
+         * breaks; the value is checked once per schema, not per entity.
+         *
+         * @param handles    Entities to edit
+         * @param propertyId Property to set
+         * @param value      New value
+         * @return size_t Number of entities that accepted the value
+         */
+        size_t setPropertyValues(std::span<const EntityHandle> handles, const std::string& propertyId,
+                                 const Inspector::PropertyValue& value);
+
+        // --- Undo / redo ---
+
+        /**
+         * @brief Revert the most recent property edit
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return bool True if an edit was reverted
+         * @see UndoJournal::undo()
+         */
+        bool undo();
+
+        /**
+         * @brief Re-apply the most recently reverted property edit
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return bool True if an edit was re-applied
+         * @see UndoJournal::redo()
+         */
+        bool redo();
+
+        /**
+         * @brief Get the undo/redo history of this project
+         *
+         * Every property change of every entity is recorded here. Snapshots
+         * start with an empty history.
+         *
+         * @return UndoJournal& The project's journal
+         */
+        [[nodiscard]] UndoJournal& getUndoJournal();
+
+        // --- Handles ---
+
+        /**
+         * @brief Resolve a handle to its entity
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param handle Handle obtained from BaseEntity::getHandle()
+         * @return Entities::BaseEntity* Non-owning pointer, or nullptr if the
+         *         handle is invalid, stale, or was issued by another project
+         */
+        [[nodiscard]] Entities::BaseEntity* resolve(EntityHandle handle) const;
+
         // --- Scene CRUD ---
 
         /**
@@ -186,8 +716,8 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Constructs a Scene with the given id and name, takes ownership via
-         * unique_ptr, and appends it to the scene collection.
+         * Constructs a Scene with the given id and name inside the scene pool
+         * and appends it to the scene collection.
          *
          * @param id   Unique identifier for the scene
          * @param name Display name for the scene
@@ -207,7 +737,51 @@ namespace ADS::Core {
          *
          * @param id Unique identifier of the scene to remove
          */
-        void removeScene(const std::string& id);
+        void removeScene(std::string_view id);
+
+        /**
+         * @brief Create several scenes at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling addScene() for each entry, but reserves storage
+         * once and counts as a single project change.
+         *
+         * @param entries Ids and names of the scenes to create
+         * @return size_t Number of scenes added; ids already in use are skipped
+         */
+        size_t addScenes(std::span<const NewEntity> entries);
+
+        /**
+         * @brief Create several scenes at once, with their starting values
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @p initialize runs on each new scene before the project starts
+         * tracking it, so what it sets is the scene's starting state: no
+         * property event is raised and nothing reaches the undo journal.
+         *
+         * @param entries    Ids and names of the scenes to create
+         * @param initialize Called with each new scene and the position of its entry
+         * @return size_t Number of scenes added; ids already in use are skipped
+         */
+        size_t addScenes(std::span<const NewEntity> entries, const Initializer<Entities::Scene>& initialize);
+
+        /**
+         * @brief Remove several scenes at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling removeScene() for each id, but compacts the
+         * collection once and counts as a single project change.
+         *
+         * @param ids Ids of the scenes to remove; unknown ids are ignored
+         * @return size_t Number of scenes removed
+         */
+        size_t removeScenes(std::span<const std::string> ids);
 
         /**
          * @brief Find a scene by id
@@ -215,14 +789,23 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Performs a linear search through the scene collection for an entry
-         * whose id matches the argument.
+         * Resolves the id through the scene hash index in constant time.
+         * Accepts any string-like key without allocating a temporary.
          *
          * @param id Unique identifier to search for
          * @return Entities::Scene* Non-owning pointer to the scene,
          *         or nullptr if not found
          */
-        [[nodiscard]] Entities::Scene* findScene(const std::string& id) const;
+        [[nodiscard]] Entities::Scene* findScene(std::string_view id) const;
+
+        /**
+         * @brief Find a scene by handle
+         *
+         * @param handle Handle of the scene
+         * @return Entities::Scene* Non-owning pointer to the scene, or nullptr
+         *         if the handle is stale or belongs to another kind
+         */
+        [[nodiscard]] Entities::Scene* findScene(EntityHandle handle) const;
 
         /**
          * @brief Get the full scene collection (read-only)
@@ -232,10 +815,115 @@ namespace ADS::Core {
          *
          * Provides read-only access to the owned scene vector for iteration.
          *
-         * @return const std::vector<std::unique_ptr<Entities::Scene>>&
-         *         Reference to the owned scene collection
+         * @return const std::vector<ScenePtr>& Reference to the owned scene collection
+         */
+        [[nodiscard]] const std::vector<ScenePtr>& getScenes() const;
+
+        // --- Scene exits ---
+
+        /**
+         * @brief Add an exit from one scene to another
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Exits are part of the source scene, so a new exit marks that scene
+         * dirty. A scene may lead to itself.
+         *
+         * @param fromId Id of the source scene
+         * @param toId   Id of the target scene
+         * @return bool False if either scene does not exist or the exit already exists
+         */
+        bool addExit(std::string_view fromId, std::string_view toId);
+
+        /**
+         * @brief Add several exits at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling addExit() for each pair, but merges them
+         * into the scene graph in one pass, which keeps loading and
+         * generating large projects linear.
+         *
+         * @param exits Ids of the source and target scene of each exit
+         * @return size_t Number of exits added; missing scenes and existing exits are skipped
          */
-        [[nodiscard]] const std::vector<std::unique_ptr<Entities::Scene>>& getScenes() const;
+        size_t addExits(std::span<const std::pair<std::string_view, std::string_view>> exits);
+
+        /**
+         * @brief Remove an exit from one scene to another
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param fromId Id of the source scene
+         * @param toId   Id of the target scene
+         * @return bool False if there was no such exit
+         */
+        bool removeExit(std::string_view fromId, std::string_view toId);
+
+        /**
+         * @brief Get the scenes a scene leads to
+         *
+         * Removing a scene also removes every exit leading to it and marks
+         * the scenes that had one dirty.
+         *
+         * @param scene Source scene
+         * @return std::vector<Entities::Scene*> Target scenes, in handle order
+         */
+        [[nodiscard]] std::vector<Entities::Scene*> getExits(const Entities::Scene& scene) const;
+
+        /**
+         * @brief Get the scene to go to next on a shortest route between two scenes
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * For hints and characters walking the map. Routes between every
+         * two scenes are computed on the first query and kept current as
+         * exits change, so each query is a table lookup.
+         *
+         * @param from Scene to start at
+         * @param to   Scene to reach
+         * @return Entities::Scene* Exit of @p from to take, or nullptr if @p to cannot be reached or is @p from
+         */
+        [[nodiscard]] Entities::Scene* getNextSceneTowards(const Entities::Scene& from, const Entities::Scene& to) const;
+
+        /**
+         * @brief Get a shortest route between two scenes
+         *
+         * @param from Scene to start at
+         * @param to   Scene to reach
+         * @return std::vector<Entities::Scene*> Scenes after @p from, ending with @p to; empty if unreachable
+         */
+        [[nodiscard]] std::vector<Entities::Scene*> getRoute(const Entities::Scene& from, const Entities::Scene& to) const;
+
+        /**
+         * @brief Get the scenes no start scene leads to
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reachability is cached and kept current as exits are added; only
+         * removals and start scene changes force a fresh walk, once, on the
+         * next query. With no start scene every scene is unreachable.
+         *
+         * @return std::vector<Entities::Scene*> Unreachable scenes, in handle order
+         */
+        [[nodiscard]] std::vector<Entities::Scene*> getUnreachableScenes() const;
+
+        /**
+         * @brief Get the scenes without any exit
+         * @return std::vector<Entities::Scene*> Dead-end scenes, in handle order
+         */
+        [[nodiscard]] std::vector<Entities::Scene*> getDeadEndScenes() const;
+
+        /**
+         * @brief Get the scenes without any entrance that are not start scenes
+         * @return std::vector<Entities::Scene*> Orphan scenes, in handle order
+         */
+        [[nodiscard]] std::vector<Entities::Scene*> getOrphanScenes() const;
 
         // --- Character CRUD ---
 
@@ -245,8 +933,8 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Constructs a Character with the given id and name, takes ownership via
-         * unique_ptr, and appends it to the character collection.
+         * Constructs a Character with the given id and name inside the character pool
+         * and appends it to the character collection.
          *
          * @param id   Unique identifier for the character
          * @param name Display name for the character
@@ -266,7 +954,44 @@ namespace ADS::Core {
          *
          * @param id Unique identifier of the character to remove
          */
-        void removeCharacter(const std::string& id);
+        void removeCharacter(std::string_view id);
+
+        /**
+         * @brief Create several characters at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling addCharacter() for each entry, but reserves storage
+         * once and counts as a single project change.
+         *
+         * @param entries Ids and names of the characters to create
+         * @return size_t Number of characters added; ids already in use are skipped
+         */
+        size_t addCharacters(std::span<const NewEntity> entries);
+
+        /**
+         * @brief Create several characters at once, with their starting values
+         *
+         * @param entries    Ids and names of the characters to create
+         * @param initialize Called with each new character before it is tracked, as for addScenes()
+         * @return size_t Number of characters added; ids already in use are skipped
+         */
+        size_t addCharacters(std::span<const NewEntity> entries, const Initializer<Entities::Character>& initialize);
+
+        /**
+         * @brief Remove several characters at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling removeCharacter() for each id, but compacts the
+         * collection once and counts as a single project change.
+         *
+         * @param ids Ids of the characters to remove; unknown ids are ignored
+         * @return size_t Number of characters removed
+         */
+        size_t removeCharacters(std::span<const std::string> ids);
 
         /**
          * @brief Find a character by id
@@ -274,14 +999,23 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Performs a linear search through the character collection for an entry
-         * whose id matches the argument.
+         * Resolves the id through the character hash index in constant time.
+         * Accepts any string-like key without allocating a temporary.
          *
          * @param id Unique identifier to search for
          * @return Entities::Character* Non-owning pointer to the character,
          *         or nullptr if not found
          */
-        [[nodiscard]] Entities::Character* findCharacter(const std::string& id) const;
+        [[nodiscard]] Entities::Character* findCharacter(std::string_view id) const;
+
+        /**
+         * @brief Find a character by handle
+         *
+         * @param handle Handle of the character
+         * @return Entities::Character* Non-owning pointer to the character, or nullptr
+         *         if the handle is stale or belongs to another kind
+         */
+        [[nodiscard]] Entities::Character* findCharacter(EntityHandle handle) const;
 
         /**
          * @brief Get the full character collection (read-only)
@@ -291,10 +1025,9 @@ namespace ADS::Core {
          *
          * Provides read-only access to the owned character vector for iteration.
          *
-         * @return const std::vector<std::unique_ptr<Entities::Character>>&
-         *         Reference to the owned character collection
+         * @return const std::vector<CharacterPtr>& Reference to the owned character collection
          */
-        [[nodiscard]] const std::vector<std::unique_ptr<Entities::Character>>& getCharacters() const;
+        [[nodiscard]] const std::vector<CharacterPtr>& getCharacters() const;
 
         // --- Item CRUD ---
 
@@ -304,8 +1037,8 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Constructs an Item with the given id and name, takes ownership via
-         * unique_ptr, and appends it to the item collection.
+         * Constructs an Item with the given id and name inside the item pool
+         * and appends it to the item collection.
          *
          * @param id   Unique identifier for the item
          * @param name Display name for the item
@@ -325,7 +1058,44 @@ namespace ADS::Core {
          *
          * @param id Unique identifier of the item to remove
          */
-        void removeItem(const std::string& id);
+        void removeItem(std::string_view id);
+
+        /**
+         * @brief Create several items at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling addItem() for each entry, but reserves storage
+         * once and counts as a single project change.
+         *
+         * @param entries Ids and names of the items to create
+         * @return size_t Number of items added; ids already in use are skipped
+         */
+        size_t addItems(std::span<const NewEntity> entries);
+
+        /**
+         * @brief Create several items at once, with their starting values
+         *
+         * @param entries    Ids and names of the items to create
+         * @param initialize Called with each new item before it is tracked, as for addScenes()
+         * @return size_t Number of items added; ids already in use are skipped
+         */
+        size_t addItems(std::span<const NewEntity> entries, const Initializer<Entities::Item>& initialize);
+
+        /**
+         * @brief Remove several items at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Equivalent to calling removeItem() for each id, but compacts the
+         * collection once and counts as a single project change.
+         *
+         * @param ids Ids of the items to remove; unknown ids are ignored
+         * @return size_t Number of items removed
+         */
+        size_t removeItems(std::span<const std::string> ids);
 
         /**
          * @brief Find an item by id
@@ -333,14 +1103,23 @@ namespace ADS::Core {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Feb 2026
          *
-         * Performs a linear search through the item collection for an entry
-         * whose id matches the argument.
+         * Resolves the id through the item hash index in constant time.
+         * Accepts any string-like key without allocating a temporary.
          *
          * @param id Unique identifier to search for
          * @return Entities::Item* Non-owning pointer to the item,
          *         or nullptr if not found
          */
-        [[nodiscard]] Entities::Item* findItem(const std::string& id) const;
+        [[nodiscard]] Entities::Item* findItem(std::string_view id) const;
+
+        /**
+         * @brief Find a item by handle
+         *
+         * @param handle Handle of the item
+         * @return Entities::Item* Non-owning pointer to the item, or nullptr
+         *         if the handle is stale or belongs to another kind
+         */
+        [[nodiscard]] Entities::Item* findItem(EntityHandle handle) const;
 
         /**
          * @brief Get the full item collection (read-only)
@@ -350,10 +1129,9 @@ namespace ADS::Core {
          *
          * Provides read-only access to the owned item vector for iteration.
          *
-         * @return const std::vector<std::unique_ptr<Entities::Item>>&
-         *         Reference to the owned item collection
+         * @return const std::vector<ItemPtr>& Reference to the owned item collection
          */
-        [[nodiscard]] const std::vector<std::unique_ptr<Entities::Item>>& getItems() const;
+        [[nodiscard]] const std::vector<ItemPtr>& getItems() const;
     };
 
 } // namespace ADS::Core
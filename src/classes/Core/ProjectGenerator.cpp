@@ -0,0 +1,284 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ProjectGenerator.cpp
+ * @brief Implementation of the ProjectGenerator class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ProjectGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "Entities/LazyText.h"
+#include "JobSystem.h"
+#include "TraceRecorder.h"
+
+namespace ADS::Core {
+
+    namespace {
+        constexpr std::array<std::string_view, 16> SCENE_ADJECTIVES = {
+            "Misty", "Dark", "Sunken", "Forgotten", "Golden", "Silent", "Burning", "Frozen",
+            "Hidden", "Ancient", "Crumbling", "Moonlit", "Hollow", "Shattered", "Verdant", "Windswept"
+        };
+        constexpr std::array<std::string_view, 16> SCENE_PLACES = {
+            "Forest", "Cave", "Harbour", "Tower", "Library", "Crypt", "Market", "Bridge",
+            "Garden", "Mine", "Chapel", "Tavern", "Swamp", "Courtyard", "Lighthouse", "Vault"
+        };
+        constexpr std::array<std::string_view, 16> CHARACTER_NAMES = {
+            "Ada", "Bram", "Cora", "Dorian", "Elsa", "Finn", "Greta", "Hugo",
+            "Iris", "Jonas", "Kira", "Leon", "Mara", "Nils", "Odette", "Piet"
+        };
+        constexpr std::array<std::string_view, 16> CHARACTER_TITLES = {
+            "the Merchant", "the Guard", "the Scholar", "the Thief", "the Smith", "the Sailor", "the Witch", "the Knight",
+            "the Baker", "the Hermit", "the Bard", "the Miner", "the Priest", "the Hunter", "the Alchemist", "the Innkeeper"
+        };
+        constexpr std::array<std::string_view, 16> ITEM_ADJECTIVES = {
+            "Rusty", "Silver", "Cursed", "Tiny", "Heavy", "Glowing", "Broken", "Enchanted",
+            "Wooden", "Crystal", "Bent", "Ornate", "Dusty", "Sealed", "Bloodied", "Gilded"
+        };
+        constexpr std::array<std::string_view, 16> ITEM_NOUNS = {
+            "Key", "Sword", "Lantern", "Map", "Coin", "Potion", "Rope", "Amulet",
+            "Book", "Shovel", "Ring", "Scroll", "Compass", "Dagger", "Bottle", "Feather"
+        };
+        constexpr std::array<std::string_view, 32> WORDS = {
+            "the", "a", "old", "door", "light", "shadow", "wind", "stone", "path", "water",
+            "north", "south", "beyond", "under", "quiet", "cold", "smell", "of", "smoke", "and",
+            "dust", "you", "see", "hear", "far", "wall", "rain", "fire", "glimmer", "echo",
+            "leads", "waits"
+        };
+
+        /**
+         * @brief Splitmix64: small, fast, and the same on every platform, unlike the std distributions
+         */
+        class Random {
+        public:
+            explicit Random(const uint64_t seed) : m_state(seed) {}
+
+            uint64_t next() {
+                uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                return z ^ (z >> 31);
+            }
+
+            size_t below(const size_t bound) {
+                return static_cast<size_t>(next() % bound);
+            }
+
+            template<size_t N>
+            std::string_view pick(const std::array<std::string_view, N>& words) {
+                return words[below(N)];
+            }
+
+        private:
+            uint64_t m_state;
+        };
+
+        /**
+         * @brief Descriptions of a generated project, shared by it and its snapshots
+         */
+        class GeneratedText final : public Entities::TextSource {
+        public:
+            explicit GeneratedText(std::vector<std::shared_ptr<const std::string>> texts) : m_texts(std::move(texts)) {}
+
+            std::shared_ptr<const std::string> load(const uint64_t key) override {
+                return m_texts[key];
+            }
+
+        private:
+            std::vector<std::shared_ptr<const std::string>> m_texts;
+        };
+
+        /**
+         * @brief Sentences of random words, between half and one and a half times the mean length
+         */
+        std::string makeDescription(Random& random, const size_t meanLength) {
+            const size_t length = meanLength / 2 + random.below(meanLength + 1);
+            std::string text;
+            text.reserve(length + 16);
+            size_t sentenceWords = 0;
+            while (text.size() < length) {
+                const std::string_view word = random.pick(WORDS);
+                if (sentenceWords == 0) {
+                    if (!text.empty()) {
+                        text += ' ';
+                    }
+                    text += static_cast<char>(word[0] - 'a' + 'A');
+                    text += word.substr(1);
+                } else {
+                    text += ' ';
+                    text += word;
+                }
+                if (++sentenceWords >= 6 + random.below(10)) {
+                    text += '.';
+                    sentenceWords = 0;
+                }
+            }
+            if (sentenceWords != 0) {
+                text += '.';
+            }
+            return text;
+        }
+
+        /**
+         * @brief Run work(chunk) for every chunk, on the pool if there is one
+         */
+        template<typename Work>
+        void runChunks(JobSystem* jobs, const size_t chunks, const Work& work) {
+            if (jobs == nullptr || chunks < 2) {
+                for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                    work(chunk);
+                }
+                return;
+            }
+            std::vector<JobSystem::JobHandle> handles;
+            handles.reserve(chunks);
+            for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                handles.push_back(jobs->submit([&work, chunk] { work(chunk); }));
+            }
+            for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                jobs->wait(handles[chunk]);
+                // A stopped pool cancels the job; generate the chunk here
+                if (handles[chunk].getState() != JobSystem::State::Completed) {
+                    work(chunk);
+                }
+            }
+        }
+    }
+
+    ProjectGenerator::Options ProjectGenerator::forEntities(const size_t entities, const uint64_t seed) {
+        Options options;
+        options.scenes = std::max<size_t>(entities / 2, 1);
+        options.characters = (entities - std::min(entities, options.scenes)) / 2;
+        options.items = entities - std::min(entities, options.scenes + options.characters);
+        options.exits = options.scenes * 2;
+        options.seed = seed;
+        return options;
+    }
+
+    /**
+     * @brief Generate a project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Entities are numbered scenes first, then characters, then items; a
+     * chunk of that numbering, or of the random exits after it, is one job
+     * with its own generator, seeded from the options' seed and the chunk.
+     */
+    std::unique_ptr<Project> ProjectGenerator::generate(const Options& options, JobSystem* jobs) {
+        TraceRecorder::Scope trace("ProjectGenerator::generate");
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Project);
+
+        const size_t scenes = options.scenes;
+        const size_t characters = options.characters;
+        const size_t entities = scenes + characters + options.items;
+        const size_t chainExits = std::min(options.exits, scenes > 0 ? scenes - 1 : 0);
+        const size_t randomExits = scenes > 1 ? options.exits - chainExits : 0;
+        const size_t entityChunks = (entities + CHUNK - 1) / CHUNK;
+        const size_t exitChunks = (randomExits + CHUNK - 1) / CHUNK;
+
+        std::vector<NewEntity> entries(entities);
+        std::vector<std::shared_ptr<const std::string>> texts(options.descriptionLength > 0 ? entities : 0);
+        std::vector<std::pair<uint32_t, uint32_t>> exits(randomExits);
+
+        runChunks(jobs, entityChunks + exitChunks, [&](const size_t chunk) {
+            AllocationCounter::Scope chunkMemory(AllocationCounter::Tag::Project);
+            Random random(options.seed ^ Random(chunk).next());
+            if (chunk >= entityChunks) {
+                const size_t first = (chunk - entityChunks) * CHUNK;
+                for (size_t index = first; index < std::min(first + CHUNK, randomExits); ++index) {
+                    const size_t from = random.below(scenes);
+                    size_t to = random.below(scenes - 1);
+                    to += to >= from ? 1 : 0;
+                    exits[index] = {static_cast<uint32_t>(from), static_cast<uint32_t>(to)};
+                }
+                return;
+            }
+
+            const size_t first = chunk * CHUNK;
+            for (size_t index = first; index < std::min(first + CHUNK, entities); ++index) {
+                NewEntity& entry = entries[index];
+                if (index < scenes) {
+                    entry.id = std::format("scene_{}", index);
+                    entry.name = std::format("{} {} {}", random.pick(SCENE_ADJECTIVES), random.pick(SCENE_PLACES), index);
+                } else if (index < scenes + characters) {
+                    const size_t local = index - scenes;
+                    entry.id = std::format("char_{}", local);
+                    entry.name = std::format("{} {} {}", random.pick(CHARACTER_NAMES), random.pick(CHARACTER_TITLES), local);
+                } else {
+                    const size_t local = index - scenes - characters;
+                    entry.id = std::format("item_{}", local);
+                    entry.name = std::format("{} {} {}", random.pick(ITEM_ADJECTIVES), random.pick(ITEM_NOUNS), local);
+                }
+                if (!texts.empty()) {
+                    texts[index] = std::make_shared<const std::string>(makeDescription(random, options.descriptionLength));
+                }
+            }
+        });
+
+        const std::string name = options.name.empty()
+            ? std::format("Generated {} scenes, {} characters, {} items", scenes, characters, options.items)
+            : options.name;
+        auto project = std::make_unique<Project>(name);
+        const std::span<const NewEntity> all(entries);
+        project->addScenes(all.first(scenes));
+        project->addCharacters(all.subspan(scenes, characters));
+        project->addItems(all.subspan(scenes + characters));
+
+        const auto& sceneList = project->getScenes();
+        if (!texts.empty()) {
+            const auto source = std::make_shared<GeneratedText>(std::move(texts));
+            for (size_t index = 0; index < sceneList.size(); ++index) {
+                sceneList[index]->bindDescription(source, index);
+            }
+            const auto& characterList = project->getCharacters();
+            for (size_t index = 0; index < characterList.size(); ++index) {
+                characterList[index]->bindDescription(source, scenes + index);
+            }
+            const auto& itemList = project->getItems();
+            for (size_t index = 0; index < itemList.size(); ++index) {
+                itemList[index]->bindDescription(source, scenes + characters + index);
+            }
+        }
+
+        std::vector<std::pair<std::string_view, std::string_view>> exitIds;
+        exitIds.reserve(chainExits + exits.size());
+        for (size_t index = 0; index < chainExits; ++index) {
+            exitIds.emplace_back(sceneList[index]->getId(), sceneList[index + 1]->getId());
+        }
+        for (const auto& [from, to] : exits) {
+            exitIds.emplace_back(sceneList[from]->getId(), sceneList[to]->getId());
+        }
+        project->addExits(exitIds);
+        if (!sceneList.empty()) {
+            sceneList.front()->setStartScene(true);
+        }
+
+        // Starts as a loaded project does: nothing to save or undo
+        project->flushEvents();
+        project->getUndoJournal().clear();
+        project->clearDirty();
+        return project;
+    }
+}
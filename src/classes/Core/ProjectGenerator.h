@@ -0,0 +1,103 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROJECT_GENERATOR_H
+#define ADS_CORE_PROJECT_GENERATOR_H
+
+/**
+ * @file ProjectGenerator.h
+ * @brief Reproducible synthetic projects of any size, for stress tests
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Used by the `ads_generate_project` tool and by View > Generate Test
+ * Project, to see how the panels and the serializers scale.
+ *
+ * @see ADS::Core::FrameBenchmark::makeSyntheticProject()
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Project.h"
+
+namespace ADS::Core {
+
+    class JobSystem;
+
+    /**
+     * @brief Builds projects from counts and a seed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Names, descriptions and exits are drawn from a generator seeded per
+     * chunk of CHUNK entities, so the same options give the same project
+     * whatever the number of workers. The chunks are generated on the
+     * JobSystem; only adding the entities to the project is serial.
+     *
+     * Descriptions are bound to a text source owned by the project rather
+     * than set, so they raise no events and the project starts clean, with
+     * no undo history, as a loaded one does.
+     */
+    class ProjectGenerator {
+    public:
+        static constexpr size_t CHUNK = 4096;      ///< Entities or exits generated per job
+
+        /**
+         * @brief What to generate
+         */
+        struct Options {
+            std::string name;                       ///< Project name; empty for one giving the counts
+            size_t scenes = 500;
+            size_t characters = 250;
+            size_t items = 250;
+            size_t exits = 1000;                    ///< The first chain the scenes in order, the rest join random scenes
+            size_t descriptionLength = 200;         ///< Mean characters per description, spread over half to one and a half times; 0 for none
+            uint64_t seed = 1;
+        };
+
+        ProjectGenerator() = delete;
+
+        /**
+         * @brief Options for a total number of entities
+         *
+         * Half are scenes, a quarter characters and a quarter items, with
+         * two exits per scene, as in FrameBenchmark::makeSyntheticProject().
+         *
+         * @param entities Entities in total
+         * @param seed     Seed of the project
+         */
+        [[nodiscard]] static Options forEntities(size_t entities, uint64_t seed = 1);
+
+        /**
+         * @brief Generate a project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Exits that would repeat one already made are skipped, so a graph
+         * denser than the scenes allow ends with fewer exits than asked.
+         *
+         * @param options What to generate
+         * @param jobs    Pool to generate the chunks on, the calling thread helping; nullptr generates them here
+         * @return std::unique_ptr<Project> New project, clean and without a file
+         */
+        [[nodiscard]] static std::unique_ptr<Project> generate(const Options& options, JobSystem* jobs = nullptr);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROJECT_GENERATOR_H
@@ -0,0 +1,360 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ProjectImporter.cpp
+ * @brief Implementation of the streaming project importer
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ProjectImporter.h"
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <unordered_set>
+
+#include "IdGenerator.h"
+#include "Profiling.h"
+#include "TraceRecorder.h"
+#include "filesystem/file_not_open_exception.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Source and batch queue shared by the importer and its parsing job
+     *
+     * Only the thread that set @c parsing, under the mutex, touches the
+     * parser and the file until it clears the flag again.
+     */
+    struct ProjectImporter::Stream {
+        std::ifstream file;
+        std::unique_ptr<ImportParser> parser;
+        uint64_t fileBytes = 0;
+        CancellationToken token;
+        std::atomic<float> progress = 0.0f;
+
+        std::mutex mutex;
+        std::deque<ImportBatch> ready;      ///< Parsed batches, oldest first
+        bool parsing = false;               ///< A job or poll() is reading the source
+        bool exhausted = false;             ///< The source ended or failed
+        std::string error;                  ///< Parser error, set with exhausted
+        size_t skipped = 0;                 ///< Parser's skipped count, set with exhausted
+    };
+
+    namespace {
+        /**
+         * @brief Give records their final ids: the source one if free, else a fresh one
+         *
+         * @return size_t Number of records renamed
+         */
+        template<typename Taken>
+        size_t assignIds(const std::vector<const ImportRecord*>& records, std::string_view prefix, Taken taken,
+                         std::vector<NewEntity>& entries) {
+            size_t renamed = 0;
+            std::unordered_set<std::string_view> used;
+            entries.reserve(records.size());
+            for (const ImportRecord* record : records) {
+                NewEntity& entry = entries.emplace_back(NewEntity{record->id, record->name});
+                if (entry.id.empty() || taken(entry.id) || used.contains(entry.id)) {
+                    entry.id = IdGenerator::makeEntityId(prefix);
+                    ++renamed;
+                }
+                used.insert(entry.id);
+            }
+            return renamed;
+        }
+
+        template<typename T>
+        Project::Initializer<T> describe(const std::vector<const ImportRecord*>& records, StringPool& pool) {
+            return [&records, &pool](T& entity, const size_t entry) {
+                if (!records[entry]->description.empty()) {
+                    entity.shareDescription(pool.intern(records[entry]->description));
+                }
+            };
+        }
+    }
+
+    ProjectImporter::ProjectImporter()
+        : m_state(State::Idle),
+          m_jobs(nullptr) {
+    }
+
+    ProjectImporter::~ProjectImporter() {
+        cancel();
+    }
+
+    /**
+     * @brief Open a source and begin importing it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Nothing is parsed here, so the call returns at once whatever the
+     * size of the source; the first poll() gets parsing going.
+     *
+     * @param path Source file; its extension chooses the parser
+     * @param jobs Pool that parses the source, nullptr to parse a batch inside each poll()
+     * @return bool False if an import is already in progress
+     */
+    bool ProjectImporter::start(const std::filesystem::path& path, JobSystem* jobs) {
+        if (isBusy()) {
+            return false;
+        }
+
+        auto stream = std::make_shared<Stream>();
+        stream->file.open(path, std::ios::binary);
+        if (!stream->file) {
+            throw Exceptions::file_not_open_exception(std::format("Cannot open import source: {}", path.string()));
+        }
+        stream->parser = ImportParser::create(path, stream->file);
+        std::error_code error;
+        stream->fileBytes = std::filesystem::file_size(path, error);
+        if (error) {
+            stream->fileBytes = 0;
+        }
+
+        m_stream = std::move(stream);
+        m_jobs = jobs;
+        m_path = path;
+        m_error.clear();
+        m_summary = {};
+        m_sceneIds.clear();
+        m_pendingExits.clear();
+        m_state = State::Importing;
+        return true;
+    }
+
+    /**
+     * @brief Insert the next parsed batch into a project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Inserts at most one batch, so a frame never spends longer than one
+     * batch's worth of insertion on the import.
+     *
+     * @param project Project receiving the entities
+     * @return bool True exactly once per import, on the call that finished it
+     */
+    bool ProjectImporter::poll(Project& project) {
+        if (m_state != State::Importing) {
+            return false;
+        }
+        TraceRecorder::Scope trace("ProjectImporter::poll");
+        ADS_ZONE("ProjectImporter::poll");
+        Stream& stream = *m_stream;
+        if (stream.token.isCancelled()) {
+            finish(project, State::Cancelled);
+            return true;
+        }
+
+        schedule();
+
+        std::optional<ImportBatch> batch;
+        bool done = false;
+        {
+            std::scoped_lock lock(stream.mutex);
+            if (!stream.ready.empty()) {
+                batch = std::move(stream.ready.front());
+                stream.ready.pop_front();
+            }
+            done = stream.exhausted && stream.ready.empty();
+            if (done) {
+                m_error = stream.error;
+                m_summary.skipped += stream.skipped;
+            }
+        }
+        if (batch) {
+            insert(project, *batch);
+        }
+        if (done) {
+            finish(project, m_error.empty() ? State::Succeeded : State::Failed);
+            return true;
+        }
+        return false;
+    }
+
+    void ProjectImporter::parse(Stream& stream, const size_t limit) {
+        TraceRecorder::Scope trace("ProjectImporter::parse");
+        ADS_ZONE("ProjectImporter::parse");
+        for (;;) {
+            if (stream.token.isCancelled()) {
+                break;
+            }
+            ImportBatch batch;
+            bool more = false;
+            std::string error;
+            try {
+                more = stream.parser->read(batch);
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+            if (stream.fileBytes > 0) {
+                stream.progress.store(static_cast<float>(stream.parser->getBytesRead()) / static_cast<float>(stream.fileBytes),
+                                      std::memory_order_relaxed);
+            }
+
+            std::scoped_lock lock(stream.mutex);
+            if (batch.size() > 0 && error.empty()) {
+                stream.ready.push_back(std::move(batch));
+            }
+            if (!more || !error.empty()) {
+                stream.exhausted = true;
+                stream.error = std::move(error);
+                stream.skipped = stream.parser->getSkipped();
+                stream.progress.store(1.0f, std::memory_order_relaxed);
+                stream.parsing = false;
+                return;
+            }
+            if (stream.ready.size() >= limit) {
+                stream.parsing = false;
+                return;
+            }
+        }
+        std::scoped_lock lock(stream.mutex);
+        stream.parsing = false;
+    }
+
+    void ProjectImporter::schedule() {
+        Stream& stream = *m_stream;
+        {
+            std::scoped_lock lock(stream.mutex);
+            if (stream.parsing || stream.exhausted || stream.ready.size() >= MAX_READY_BATCHES) {
+                return;
+            }
+            stream.parsing = true;
+        }
+        if (m_jobs == nullptr) {
+            parse(stream, 1);
+            return;
+        }
+        // No token on the job: a skipped job would leave the stream marked as parsing
+        m_jobs->submit([stream = m_stream]() { parse(*stream, MAX_READY_BATCHES); },
+                       JobSystem::Priority::Normal, JobSystem::Lane::Worker);
+    }
+
+    void ProjectImporter::insert(Project& project, ImportBatch& batch) {
+        TraceRecorder::Scope trace("ProjectImporter::insert");
+        ADS_ZONE("ProjectImporter::insert");
+        std::vector<const ImportRecord*> scenes;
+        std::vector<const ImportRecord*> characters;
+        std::vector<const ImportRecord*> items;
+        for (const ImportRecord& record : batch.entities) {
+            switch (record.kind) {
+                case EntityKind::Scene:
+                    scenes.push_back(&record);
+                    break;
+                case EntityKind::Character:
+                    characters.push_back(&record);
+                    break;
+                case EntityKind::Item:
+                    items.push_back(&record);
+                    break;
+            }
+        }
+
+        std::vector<NewEntity> sceneEntries;
+        std::vector<NewEntity> characterEntries;
+        std::vector<NewEntity> itemEntries;
+        m_summary.renamed += assignIds(scenes, "scene",
+            [&project](std::string_view id) { return project.findScene(id) != nullptr; }, sceneEntries);
+        m_summary.renamed += assignIds(characters, "char",
+            [&project](std::string_view id) { return project.findCharacter(id) != nullptr; }, characterEntries);
+        m_summary.renamed += assignIds(items, "item",
+            [&project](std::string_view id) { return project.findItem(id) != nullptr; }, itemEntries);
+
+        m_summary.entities += project.addScenes(sceneEntries, describe<Entities::Scene>(scenes, project.getStringPool()));
+        m_summary.entities += project.addCharacters(characterEntries, describe<Entities::Character>(characters, project.getStringPool()));
+        m_summary.entities += project.addItems(itemEntries, describe<Entities::Item>(items, project.getStringPool()));
+
+        // The first scene with a source id keeps it for exits
+        for (size_t i = 0; i < scenes.size(); ++i) {
+            if (!scenes[i]->id.empty()) {
+                m_sceneIds.try_emplace(scenes[i]->id, sceneEntries[i].id);
+            }
+        }
+
+        std::vector<std::pair<std::string_view, std::string_view>> exits;
+        for (auto& [from, to] : batch.exits) {
+            const auto source = m_sceneIds.find(from);
+            const auto target = m_sceneIds.find(to);
+            if (source != m_sceneIds.end() && target != m_sceneIds.end()) {
+                exits.emplace_back(source->second, target->second);
+            } else {
+                m_pendingExits.emplace_back(std::move(from), std::move(to));
+            }
+        }
+        m_summary.exits += project.addExits(exits);
+    }
+
+    void ProjectImporter::finish(Project& project, const State state) {
+        if (state != State::Cancelled) {
+            std::vector<std::pair<std::string_view, std::string_view>> exits;
+            for (const auto& [from, to] : m_pendingExits) {
+                const auto source = m_sceneIds.find(from);
+                const auto target = m_sceneIds.find(to);
+                if (source != m_sceneIds.end() && target != m_sceneIds.end()) {
+                    exits.emplace_back(source->second, target->second);
+                } else {
+                    ++m_summary.skipped;
+                }
+            }
+            m_summary.exits += project.addExits(exits);
+        }
+        m_pendingExits.clear();
+        m_pendingExits.shrink_to_fit();
+        m_sceneIds.clear();
+        m_stream->token.cancel();
+        m_stream.reset();
+        m_state = state;
+    }
+
+    void ProjectImporter::cancel() {
+        if (m_stream) {
+            m_stream->token.cancel();
+        }
+    }
+
+    bool ProjectImporter::isBusy() const {
+        return m_state == State::Importing;
+    }
+
+    ProjectImporter::State ProjectImporter::getState() const {
+        return m_state;
+    }
+
+    float ProjectImporter::getProgress() const {
+        return m_stream ? m_stream->progress.load(std::memory_order_relaxed) : 0.0f;
+    }
+
+    const ImportSummary& ProjectImporter::getSummary() const {
+        return m_summary;
+    }
+
+    const std::filesystem::path& ProjectImporter::getPath() const {
+        return m_path;
+    }
+
+    const std::string& ProjectImporter::getError() const {
+        return m_error;
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,204 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROJECT_IMPORTER_H
+#define ADS_CORE_PROJECT_IMPORTER_H
+
+/**
+ * @file ProjectImporter.h
+ * @brief Imports entities from foreign sources into a project, chunk by chunk
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The source is parsed on the job system's workers into ImportBatch
+ * chunks, at most MAX_READY_BATCHES ahead of the main thread, which
+ * inserts one batch per poll(). Neither side ever holds the whole source,
+ * so memory stays bounded however large the import is.
+ *
+ * @see ADS::Core::ImportParser
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ImportParser.h"
+#include "JobSystem.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Counts of what an import did
+     */
+    struct ImportSummary {
+        size_t entities = 0;    ///< Entities added to the project
+        size_t renamed = 0;     ///< Entities given a new id because theirs was taken
+        size_t exits = 0;       ///< Exits linked between imported scenes
+        size_t skipped = 0;     ///< Rows, sentences and exits that could not be imported
+    };
+
+    /**
+     * @brief Runs one streaming import at a time
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * All public methods must be called from the main thread. Entities keep
+     * the id the source gives them unless the project or an earlier record
+     * already uses it, in which case they get a fresh one from IdGenerator;
+     * exits are resolved through the final ids, and an exit naming a scene
+     * that comes later in the source is linked once that scene is inserted.
+     * Entities are created with the bulk Project APIs, their descriptions
+     * set before they are tracked, and the import is not an undo step.
+     * Cancelling stops parsing; what was already inserted stays.
+     */
+    class ProjectImporter {
+    public:
+        /**
+         * @brief Lifecycle of the most recent import
+         */
+        enum class State : uint8_t {
+            Idle,       ///< No import has been started yet
+            Importing,  ///< Batches are being parsed and inserted
+            Succeeded,  ///< Last import read its whole source
+            Cancelled,  ///< Last import was cancelled
+            Failed      ///< Last import stopped on a malformed source; see getError()
+        };
+
+        /// Batches parsed ahead of the main thread
+        static constexpr size_t MAX_READY_BATCHES = 4;
+
+        ProjectImporter();
+
+        /**
+         * @brief Cancel a running import
+         *
+         * A worker still parsing keeps the source open until it notices.
+         */
+        ~ProjectImporter();
+
+        ProjectImporter(const ProjectImporter&) = delete;
+        ProjectImporter& operator=(const ProjectImporter&) = delete;
+
+        /**
+         * @brief Open a source and begin importing it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param path Source file; its extension chooses the parser
+         * @param jobs Pool that parses the source, nullptr to parse a batch inside each poll()
+         * @return bool False if an import is already in progress
+         * @throws Exceptions::file_not_open_exception if the file cannot be opened
+         * @throws Exceptions::project_format_exception if its format is not supported
+         */
+        bool start(const std::filesystem::path& path, JobSystem* jobs);
+
+        /**
+         * @brief Insert the next parsed batch into a project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Call once per frame with the same project until it returns true.
+         *
+         * @param project Project receiving the entities
+         * @return bool True exactly once per import, on the call that finished it
+         */
+        bool poll(Project& project);
+
+        /**
+         * @brief Stop the running import; the next poll() finishes it as Cancelled
+         */
+        void cancel();
+
+        /**
+         * @brief Check whether an import is in progress
+         *
+         * @return bool True from start() until the poll() that finishes it
+         */
+        [[nodiscard]] bool isBusy() const;
+
+        /**
+         * @brief Get the state of the most recent import
+         * @return State Current state
+         */
+        [[nodiscard]] State getState() const;
+
+        /**
+         * @brief Get the fraction of the source parsed so far
+         * @return float Value in [0, 1]
+         */
+        [[nodiscard]] float getProgress() const;
+
+        /**
+         * @brief Get what the most recent import did so far
+         * @return const ImportSummary& Counts
+         */
+        [[nodiscard]] const ImportSummary& getSummary() const;
+
+        /**
+         * @brief Get the source of the most recent import
+         * @return const std::filesystem::path& Source path
+         */
+        [[nodiscard]] const std::filesystem::path& getPath() const;
+
+        /**
+         * @brief Get the failure reason of the most recent import
+         * @return const std::string& Exception message, empty unless Failed
+         */
+        [[nodiscard]] const std::string& getError() const;
+
+    private:
+        struct Stream;
+
+        /**
+         * @brief Parse batches until @p limit are queued, the source ends or the import is cancelled
+         *
+         * Runs on a worker, or inside poll() when there is no job system.
+         */
+        static void parse(Stream& stream, size_t limit);
+
+        /**
+         * @brief Let the source be parsed further if the queue has room
+         */
+        void schedule();
+
+        /**
+         * @brief Add a batch's entities and the exits it makes resolvable
+         */
+        void insert(Project& project, ImportBatch& batch);
+
+        /**
+         * @brief Link or drop the exits still waiting for their scenes, then settle the state
+         */
+        void finish(Project& project, State state);
+
+        State m_state;                                              ///< Main-thread view of the import lifecycle
+        std::shared_ptr<Stream> m_stream;                           ///< Source and queue, shared with the parsing job
+        JobSystem* m_jobs;                                          ///< Pool parsing the source, nullptr to parse inline
+        std::filesystem::path m_path;                               ///< Source file
+        std::string m_error;                                        ///< Parser error, set when Failed
+        ImportSummary m_summary;                                    ///< Counts so far
+        std::unordered_map<std::string, std::string> m_sceneIds;    ///< Source id → final id of each imported scene
+        std::vector<std::pair<std::string, std::string>> m_pendingExits; ///< Source ids of exits waiting for a scene
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROJECT_IMPORTER_H
@@ -0,0 +1,364 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ProjectJournal.cpp
+ * @brief Implementation of the autosave journal
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ProjectJournal.h"
+
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinaryProjectFile.h"
+#include "filesystem/file_not_open_exception.h"
+#include "project/project_format_exception.h"
+
+namespace ADS::Core {
+    using namespace BinaryFormat;
+
+    /**
+     * @brief Header written once at the start of a journal file
+     */
+    struct JournalHeader {
+        char magic[4];
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t byteOrderMark;
+        uint32_t reserved2;
+    };
+
+    /**
+     * @brief Prefix of every journal entry
+     */
+    struct EntryHeader {
+        ProjectJournal::Operation operation;
+        EntityKind kind;
+        uint16_t reserved;
+        uint32_t payloadSize;
+    };
+
+    static_assert(sizeof(JournalHeader) == 16, "JournalHeader layout changed");
+    static_assert(sizeof(EntryHeader) == 8, "EntryHeader layout changed");
+
+    static constexpr char JOURNAL_MAGIC[4] = {'A', 'D', 'S', 'J'};
+    static constexpr uint16_t JOURNAL_VERSION = 1;
+
+    /**
+     * @brief Append one entry to an in-memory buffer
+     */
+    static void appendEntry(std::string& buffer, ProjectJournal::Operation operation, EntityKind kind,
+                            std::string_view first, std::string_view second = {}) {
+        const EntryHeader header{operation, kind, 0, static_cast<uint32_t>(first.size() + second.size())};
+        buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        buffer.append(first);
+        buffer.append(second);
+    }
+
+    /**
+     * @brief Append an upsert entry: the fixed record followed by its strings
+     */
+    template<typename Entity>
+    static void appendUpsert(std::string& buffer, EntityKind kind, const Entity& entity) {
+        StringTableBuilder strings;
+        const auto record = encode(entity, strings);
+        appendEntry(buffer, ProjectJournal::Operation::Upsert, kind,
+                    std::string_view(reinterpret_cast<const char*>(&record), sizeof(record)), strings.data());
+    }
+
+    /**
+     * @brief Append a length-prefixed id to an exits payload
+     */
+    static void appendId(std::string& payload, std::string_view id) {
+        const auto length = static_cast<uint32_t>(id.size());
+        payload.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        payload.append(id);
+    }
+
+    /**
+     * @brief Append an exits entry: the source scene id, then every target id
+     */
+    static void appendExits(std::string& buffer, const Project& project, const Entities::Scene& scene) {
+        std::string payload;
+        appendId(payload, scene.getId());
+        for (const Entities::Scene* target : project.getExits(scene)) {
+            appendId(payload, target->getId());
+        }
+        appendEntry(buffer, ProjectJournal::Operation::Exits, EntityKind::Scene, payload);
+    }
+
+    /**
+     * @brief Split an exits payload back into its ids
+     *
+     * @return bool False when an id runs past the end of the payload
+     */
+    static bool readIds(std::string_view payload, std::vector<std::string_view>& ids) {
+        while (!payload.empty()) {
+            uint32_t length = 0;
+            if (payload.size() < sizeof(length)) {
+                return false;
+            }
+            std::memcpy(&length, payload.data(), sizeof(length));
+            payload.remove_prefix(sizeof(length));
+            if (length > payload.size()) {
+                return false;
+            }
+            ids.push_back(payload.substr(0, length));
+            payload.remove_prefix(length);
+        }
+        return !ids.empty();
+    }
+
+    /**
+     * @brief Replace the exits of a scene with the ones of an exits payload
+     *
+     * @return bool False when the payload is malformed
+     */
+    static bool applyExits(Project& project, std::string_view payload) {
+        std::vector<std::string_view> ids;
+        if (!readIds(payload, ids)) {
+            return false;
+        }
+        if (const Entities::Scene* scene = project.findScene(ids.front())) {
+            for (const Entities::Scene* target : project.getExits(*scene)) {
+                project.removeExit(scene->getId(), target->getId());
+            }
+            for (size_t i = 1; i < ids.size(); ++i) {
+                project.addExit(ids.front(), ids[i]);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Decode an upsert payload and apply it through the given callbacks
+     *
+     * @return bool False when the payload is too short for the record type
+     */
+    template<typename Record, typename Find, typename Add>
+    static bool applyUpsert(std::string_view payload, StringPool& pool, Find find, Add add) {
+        if (payload.size() < sizeof(Record)) {
+            return false;
+        }
+        Record record;
+        std::memcpy(&record, payload.data(), sizeof(Record));
+        const std::string_view strings = payload.substr(sizeof(Record));
+        const std::string_view id = resolveString(strings, record.id);
+
+        auto* entity = find(id);
+        if (entity == nullptr) {
+            entity = add(std::string(id), std::string(resolveString(strings, record.name)));
+        }
+        if (entity != nullptr) {
+            apply(record, strings, *entity, nullptr, &pool);
+        }
+        return true;
+    }
+
+    std::filesystem::path ProjectJournal::pathFor(const std::filesystem::path& projectPath) {
+        std::filesystem::path journalPath = projectPath;
+        journalPath += ".journal";
+        return journalPath;
+    }
+
+    /**
+     * @brief Append every pending change of a project to its journal
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * All entries are assembled in memory and written with a single call,
+     * so the file only ever grows by whole batches except on a crash.
+     *
+     * @param project     Project whose dirty set is drained
+     * @param journalPath Journal file, created with a header if missing
+     * @return size_t Number of entries appended
+     */
+    size_t ProjectJournal::append(Project& project, const std::filesystem::path& journalPath) {
+        if (!project.isDirty()) {
+            return 0;
+        }
+
+        std::string buffer;
+        size_t entries = 0;
+
+        if (project.isMetadataDirty()) {
+            appendEntry(buffer, Operation::Rename, EntityKind::Scene, project.getName());
+            ++entries;
+        }
+
+        for (const auto& id : project.getRemovedIds(EntityKind::Scene)) {
+            appendEntry(buffer, Operation::Remove, EntityKind::Scene, id);
+            ++entries;
+        }
+        for (const auto& id : project.getDirtyIds(EntityKind::Scene)) {
+            if (const Entities::Scene* scene = project.findScene(id)) {
+                appendUpsert(buffer, EntityKind::Scene, *scene);
+                ++entries;
+            }
+        }
+
+        // Exits may point at scenes upserted above
+        for (const auto& id : project.getDirtyIds(EntityKind::Scene)) {
+            if (const Entities::Scene* scene = project.findScene(id)) {
+                appendExits(buffer, project, *scene);
+                ++entries;
+            }
+        }
+
+        for (const auto& id : project.getRemovedIds(EntityKind::Character)) {
+            appendEntry(buffer, Operation::Remove, EntityKind::Character, id);
+            ++entries;
+        }
+        for (const auto& id : project.getDirtyIds(EntityKind::Character)) {
+            if (const Entities::Character* character = project.findCharacter(id)) {
+                appendUpsert(buffer, EntityKind::Character, *character);
+                ++entries;
+            }
+        }
+
+        for (const auto& id : project.getRemovedIds(EntityKind::Item)) {
+            appendEntry(buffer, Operation::Remove, EntityKind::Item, id);
+            ++entries;
+        }
+        for (const auto& id : project.getDirtyIds(EntityKind::Item)) {
+            if (const Entities::Item* item = project.findItem(id)) {
+                appendUpsert(buffer, EntityKind::Item, *item);
+                ++entries;
+            }
+        }
+
+        const bool isNew = !std::filesystem::exists(journalPath) || std::filesystem::file_size(journalPath) == 0;
+        std::ofstream out(journalPath, std::ios::binary | std::ios::app);
+        if (!out.is_open()) {
+            throw Exceptions::file_not_open_exception(std::format("Cannot open autosave journal: {}", journalPath.string()));
+        }
+        if (isNew) {
+            JournalHeader header{};
+            std::memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+            header.version = JOURNAL_VERSION;
+            header.byteOrderMark = BYTE_ORDER_MARK;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        out.flush();
+        if (!out.good()) {
+            throw Exceptions::file_not_open_exception(std::format("Failed while writing autosave journal: {}", journalPath.string()));
+        }
+
+        project.clearDirty();
+        return entries;
+    }
+
+    /**
+     * @brief Re-apply a journal on top of a freshly loaded project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Journals are small relative to the project (they are compacted by
+     * ProjectStorage), so the file is read in one go and walked in memory.
+     *
+     * @param project     Project loaded from the base file
+     * @param journalPath Journal file; a missing file is not an error
+     * @return size_t Number of entries applied
+     */
+    size_t ProjectJournal::replay(Project& project, const std::filesystem::path& journalPath) {
+        std::ifstream in(journalPath, std::ios::binary);
+        if (!in.is_open()) {
+            return 0;
+        }
+        const std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (data.empty()) {
+            return 0;
+        }
+
+        JournalHeader header{};
+        if (data.size() < sizeof(header)) {
+            throw Exceptions::project_format_exception(std::format("Autosave journal is truncated: {}", journalPath.string()));
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (std::memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0
+            || header.byteOrderMark != BYTE_ORDER_MARK
+            || header.version != JOURNAL_VERSION) {
+            throw Exceptions::project_format_exception(std::format("Unsupported autosave journal: {}", journalPath.string()));
+        }
+
+        size_t entries = 0;
+        size_t offset = sizeof(header);
+        while (data.size() - offset >= sizeof(EntryHeader)) {
+            EntryHeader entry{};
+            std::memcpy(&entry, data.data() + offset, sizeof(entry));
+            offset += sizeof(entry);
+            if (entry.payloadSize > data.size() - offset) {
+                break;  // Torn tail entry
+            }
+            const std::string_view payload(data.data() + offset, entry.payloadSize);
+            offset += entry.payloadSize;
+
+            bool applied = true;
+            switch (entry.operation) {
+                case Operation::Rename:
+                    project.setName(std::string(payload));
+                    break;
+                case Operation::Remove:
+                    switch (entry.kind) {
+                        case EntityKind::Scene: project.removeScene(payload); break;
+                        case EntityKind::Character: project.removeCharacter(payload); break;
+                        case EntityKind::Item: project.removeItem(payload); break;
+                    }
+                    break;
+                case Operation::Upsert:
+                    switch (entry.kind) {
+                        case EntityKind::Scene:
+                            applied = applyUpsert<SceneRecord>(payload, project.getStringPool(),
+                                [&project](std::string_view id) { return project.findScene(id); },
+                                [&project](const std::string& id, const std::string& name) { return project.addScene(id, name); });
+                            break;
+                        case EntityKind::Character:
+                            applied = applyUpsert<CharacterRecord>(payload, project.getStringPool(),
+                                [&project](std::string_view id) { return project.findCharacter(id); },
+                                [&project](const std::string& id, const std::string& name) { return project.addCharacter(id, name); });
+                            break;
+                        case EntityKind::Item:
+                            applied = applyUpsert<ItemRecord>(payload, project.getStringPool(),
+                                [&project](std::string_view id) { return project.findItem(id); },
+                                [&project](const std::string& id, const std::string& name) { return project.addItem(id, name); });
+                            break;
+                    }
+                    break;
+                case Operation::Exits:
+                    applied = applyExits(project, payload);
+                    break;
+                default:
+                    applied = false;    // Unknown operation from a newer writer
+                    break;
+            }
+            if (applied) {
+                ++entries;
+            }
+        }
+
+        project.clearDirty();
+        return entries;
+    }
+
+} // namespace ADS::Core
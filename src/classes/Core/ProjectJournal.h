@@ -0,0 +1,111 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROJECT_JOURNAL_H
+#define ADS_CORE_PROJECT_JOURNAL_H
+
+/**
+ * @file ProjectJournal.h
+ * @brief Append-only autosave journal of entity changes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The journal sits next to the project file (`<project>.journal`) and holds
+ * a sequence of self-contained entries: upserts carry a full binary record
+ * plus its strings, removals carry only the id, and exit entries carry a
+ * scene id followed by the ids of every scene it leads to. Autosave appends the entities
+ * reported dirty by Core::Project instead of rewriting the project, and
+ * loading replays the journal on top of the base file. Entries are
+ * idempotent, and a torn entry at the tail (crash mid-append) is ignored.
+ *
+ * @see ADS::Core::ProjectStorage
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Reader and writer for the autosave journal
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Stateless utility class. The entry layout reuses the BinaryFormat
+     * records, so the journal stays in lock-step with the `.ads` container.
+     */
+    class ProjectJournal {
+    public:
+        /**
+         * @brief Operation stored in a journal entry
+         */
+        enum class Operation : uint8_t {
+            Upsert = 1,     ///< Create or overwrite an entity
+            Remove = 2,     ///< Delete an entity by id
+            Rename = 3,     ///< Change the project display name
+            Exits  = 4      ///< Replace the exits of a scene
+        };
+
+        ProjectJournal() = delete;
+
+        /**
+         * @brief Get the journal path paired with a project file
+         *
+         * @param projectPath Path of the base project file
+         * @return std::filesystem::path `<projectPath>.journal`
+         */
+        [[nodiscard]] static std::filesystem::path pathFor(const std::filesystem::path& projectPath);
+
+        /**
+         * @brief Append every pending change of a project to its journal
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Writes removals before upserts for each kind, then the exits of
+         * every dirty scene once all scenes exist, flushes, and then
+         * calls Project::clearDirty(). Nothing is written when the project is
+         * clean.
+         *
+         * @param project     Project whose dirty set is drained
+         * @param journalPath Journal file, created with a header if missing
+         * @return size_t Number of entries appended
+         * @throws Exceptions::file_not_open_exception if the journal cannot be written
+         */
+        static size_t append(Project& project, const std::filesystem::path& journalPath);
+
+        /**
+         * @brief Re-apply a journal on top of a freshly loaded project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Applies entries in order and stops at the first truncated entry.
+         * The project is marked clean afterwards, since its state now matches
+         * base file plus journal.
+         *
+         * @param project     Project loaded from the base file
+         * @param journalPath Journal file; a missing file is not an error
+         * @return size_t Number of entries applied
+         * @throws Exceptions::project_format_exception on a foreign journal header
+         */
+        static size_t replay(Project& project, const std::filesystem::path& journalPath);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROJECT_JOURNAL_H
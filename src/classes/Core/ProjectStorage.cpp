@@ -0,0 +1,126 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ProjectStorage.cpp
+ * @brief Implementation of the project persistence facade
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ProjectStorage.h"
+
+#include <algorithm>
+
+#include "AllocationCounter.h"
+#include "BinaryProjectFile.h"
+#include "JsonProjectSerializer.h"
+#include "MappedTextSource.h"
+#include "ProjectJournal.h"
+#include "TraceRecorder.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Check whether a path selects the JSON format
+     */
+    static bool isJsonPath(const std::filesystem::path& path) {
+        return path.extension() == JsonProjectSerializer::FILE_EXTENSION;
+    }
+
+    std::unique_ptr<Project> ProjectStorage::load(const std::filesystem::path& path) {
+        TraceRecorder::Scope trace("ProjectStorage::load");
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Project);
+        std::unique_ptr<Project> project;
+        if (isJsonPath(path)) {
+            project = JsonProjectSerializer::read(path);
+        } else {
+            // Large descriptions stay in the mapping until first accessed
+            auto file = std::make_shared<const BinaryProjectFile>(path);
+            project = file->toProject(path, std::make_shared<MappedTextSource>(file));
+        }
+        ProjectJournal::replay(*project, ProjectJournal::pathFor(path));
+        // Building the project from disk is not an edit the user can undo
+        project->getUndoJournal().clear();
+        return project;
+    }
+
+    void ProjectStorage::save(Project& project, const std::filesystem::path& path) {
+        write(project, path);
+        markSaved(project, path);
+    }
+
+    void ProjectStorage::write(const Project& project, const std::filesystem::path& path,
+                               const ProgressCallback& progress) {
+        TraceRecorder::Scope trace("ProjectStorage::write");
+        if (isJsonPath(path)) {
+            JsonProjectSerializer::write(project, path, progress);
+        } else {
+            BinaryProjectFile::write(project, path, progress);
+        }
+    }
+
+    void ProjectStorage::markSaved(Project& project, const std::filesystem::path& path, bool clearChanges) {
+        std::error_code error;
+        std::filesystem::remove(ProjectJournal::pathFor(path), error);
+        if (project.isSaved() && project.getFilePath() != path) {
+            // Save As: the old location's journal no longer describes this project
+            std::filesystem::remove(ProjectJournal::pathFor(project.getFilePath()), error);
+        }
+
+        project.setFilePath(path);
+        if (clearChanges) {
+            project.clearDirty();
+        }
+    }
+
+    /**
+     * @brief Persist pending changes incrementally
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The compaction check runs before appending, so a large journal is
+     * folded into the base file together with the current changes. A
+     * missing base file is rebuilt the same way.
+     *
+     * @param project Project to autosave
+     * @return bool True if anything was written
+     */
+    bool ProjectStorage::autosave(Project& project) {
+        TraceRecorder::Scope trace("ProjectStorage::autosave");
+        if (!project.isSaved() || !project.isDirty()) {
+            return false;
+        }
+
+        const std::filesystem::path path = project.getFilePath();
+        const std::filesystem::path journalPath = ProjectJournal::pathFor(path);
+
+        std::error_code baseError;
+        std::error_code journalError;
+        const uintmax_t baseSize = std::filesystem::file_size(path, baseError);
+        const uintmax_t journalSize = std::filesystem::file_size(journalPath, journalError);
+
+        // A journal is meaningless without its base file, so rebuild it
+        const bool baseMissing = static_cast<bool>(baseError);
+        const bool journalTooLarge = !journalError
+            && journalSize > std::max(COMPACTION_MIN_BYTES, baseSize / COMPACTION_RATIO);
+        if (baseMissing || journalTooLarge) {
+            save(project, path);
+            return true;
+        }
+
+        return ProjectJournal::append(project, journalPath) > 0;
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,139 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROJECT_STORAGE_H
+#define ADS_CORE_PROJECT_STORAGE_H
+
+/**
+ * @file ProjectStorage.h
+ * @brief Single entry point for opening, saving and autosaving projects
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Picks the on-disk format from the file extension (`.adsproj` for JSON,
+ * anything else for the binary container) and layers the autosave journal
+ * on top of whichever base format is in use.
+ *
+ * @see ADS::Core::BinaryProjectFile
+ * @see ADS::Core::JsonProjectSerializer
+ * @see ADS::Core::ProjectJournal
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include "Project.h"
+#include "ProgressCallback.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Format-agnostic persistence facade for Core::Project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Stateless utility class used by the IDE layer so that it never needs
+     * to know which serializer backs a given path.
+     */
+    class ProjectStorage {
+    public:
+        static constexpr uintmax_t COMPACTION_MIN_BYTES = 1024 * 1024; ///< Journals below this size are never compacted
+        static constexpr uintmax_t COMPACTION_RATIO = 2;               ///< Compact once journal > base size / ratio
+
+        ProjectStorage() = delete;
+
+        /**
+         * @brief Open a project and replay its autosave journal
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Binary projects keep their file mapped and load large descriptions
+         * on first access through a MappedTextSource; JSON projects are read
+         * fully into memory.
+         *
+         * @param path Project file (`.ads` or `.adsproj`)
+         * @return std::unique_ptr<Project> Loaded project, marked clean and
+         *         with an empty undo history
+         */
+        [[nodiscard]] static std::unique_ptr<Project> load(const std::filesystem::path& path);
+
+        /**
+         * @brief Write the whole project and discard its journal
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * After a successful write the journal is deleted, the project's
+         * file path is updated and its dirty set cleared.
+         *
+         * @param project Project to save
+         * @param path    Destination file (`.ads` or `.adsproj`)
+         */
+        static void save(Project& project, const std::filesystem::path& path);
+
+        /**
+         * @brief Write the whole project without touching its state
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Only reads the project, so it can run on a worker thread against a
+         * Project::snapshot(). Pair it with markSaved() on the live project.
+         *
+         * @param project  Project to serialise
+         * @param path     Destination file (`.ads` or `.adsproj`)
+         * @param progress Optional progress callback
+         */
+        static void write(const Project& project, const std::filesystem::path& path,
+                          const ProgressCallback& progress = {});
+
+        /**
+         * @brief Record that a project has been written to a path
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Deletes the journals superseded by the new base file and updates
+         * the file path. When the project changed after it was written, pass
+         * @p clearChanges as false: the remaining dirty set is then a superset
+         * of what the file lacks, which the next autosave appends safely.
+         *
+         * @param project      Live project that was saved
+         * @param path         File that was just written
+         * @param clearChanges Whether the file holds every tracked change
+         */
+        static void markSaved(Project& project, const std::filesystem::path& path, bool clearChanges = true);
+
+        /**
+         * @brief Persist pending changes incrementally
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Appends the dirty entities to the journal. When the journal has
+         * grown past COMPACTION_MIN_BYTES and past a fraction of the base
+         * file, the project is compacted with a full save() instead.
+         * Projects that were never saved have no base file and are skipped.
+         *
+         * @param project Project to autosave
+         * @return bool True if anything was written
+         */
+        static bool autosave(Project& project);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROJECT_STORAGE_H
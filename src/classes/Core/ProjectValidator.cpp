@@ -0,0 +1,315 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ProjectValidator.cpp
+ * @brief Implementation of the parallel project validator
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ProjectValidator.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace ADS::Core {
+
+    using Severity = ValidationIssue::Severity;
+
+    /**
+     * @brief Numeric bounds declared by one property descriptor
+     */
+    struct PropertyRange {
+        std::string id;
+        std::string label;
+        float minValue;
+        float maxValue;
+    };
+
+    /**
+     * @brief Collect the numeric bounds declared by a type's descriptors
+     *
+     * Schemas are per type, so a throwaway instance is enough to reach one,
+     * and rules do not look the bounds up per entity.
+     */
+    static std::vector<PropertyRange> rangesOf(const Entities::BaseEntity& prototype) {
+        std::vector<PropertyRange> ranges;
+        for (const Inspector::PropertyDescriptor& descriptor : prototype.getPropertySchema().getDescriptors()) {
+            const Inspector::PropertyConstraints& constraints = descriptor.getConstraints();
+            const Inspector::PropertyType type = descriptor.getType();
+            if ((type == Inspector::PropertyType::Int || type == Inspector::PropertyType::Float)
+                && constraints.hasNumericConstraints()) {
+                ranges.push_back({descriptor.getId(), descriptor.getDisplayName(),
+                                  constraints.minValue.value_or(std::numeric_limits<float>::lowest()),
+                                  constraints.maxValue.value_or(std::numeric_limits<float>::max())});
+            }
+        }
+        return ranges;
+    }
+
+    /**
+     * @brief Build the `entity.range` check for one type
+     *
+     * Each bound is one column scan; only the entities out of range are
+     * read back, for their messages.
+     */
+    static ProjectValidator::ProjectCheck rangeCheck(EntityKind kind, std::vector<PropertyRange> ranges) {
+        return [kind, ranges = std::move(ranges)](const Project& project, ProjectValidator::Issues& issues) {
+            for (const PropertyRange& range : ranges) {
+                for (const Compare outside : {Compare::Less, Compare::Greater}) {
+                    const float bound = outside == Compare::Less ? range.minValue : range.maxValue;
+                    for (const EntityHandle handle : project.query(kind).where(range.id, outside, bound).handles()) {
+                        const Entities::BaseEntity* entity = project.resolve(handle);
+                        const Inspector::PropertyValue value = entity->getPropertyValue(range.id);
+                        float number;
+                        if (const auto* i = std::get_if<int>(&value)) {
+                            number = static_cast<float>(*i);
+                        } else if (const auto* f = std::get_if<float>(&value)) {
+                            number = *f;
+                        } else {
+                            continue;
+                        }
+                        issues.push_back({Severity::Error, handle, {},
+                            std::format("{} '{}': {} {} is outside [{}, {}]", entity->getTypeName(), entity->getName(),
+                                        range.label, number, range.minValue, range.maxValue)});
+                    }
+                }
+            }
+        };
+    }
+
+    ProjectValidator::ProjectValidator()
+        : m_nextShard(0),
+          m_doneShards(0),
+          m_cancelled(false),
+          m_busy(false) {
+        addRule("scene.start", [](const Project& project, Issues& issues) {
+            const std::vector<EntityHandle> starts = project.query(EntityKind::Scene).where("isStartScene", true).handles();
+            if (starts.empty() && !project.getScenes().empty()) {
+                issues.push_back({Severity::Error, {}, {}, "The project has no start scene"});
+            }
+            for (size_t i = 1; i < starts.size(); ++i) {
+                issues.push_back({Severity::Error, starts[i], {},
+                    std::format("Scene '{}' is one of {} start scenes", project.findScene(starts[i])->getName(), starts.size())});
+            }
+        });
+
+        addRule("scene.unreachable", [](const Project& project, Issues& issues) {
+            if (project.query(EntityKind::Scene).where("isStartScene", true).count() == 0) {
+                return;     // Already reported by scene.start
+            }
+            for (const Entities::Scene* scene : project.getUnreachableScenes()) {
+                issues.push_back({Severity::Warning, scene->getHandle(), {},
+                    std::format("Scene '{}' cannot be reached from the start scene", scene->getName())});
+            }
+        });
+
+        addRule("character.health", [](const Project& project, Issues& issues) {
+            const ColumnQuery overHealed = project.query(EntityKind::Character).whereColumns("health", Compare::Greater, "maxHealth");
+            for (const EntityHandle handle : overHealed.handles()) {
+                const Entities::Character* character = project.findCharacter(handle);
+                issues.push_back({Severity::Error, handle, {},
+                    std::format("Character '{}': health {} exceeds maximum health {}", character->getName(),
+                                character->getHealth(), character->getMaxHealth())});
+            }
+        });
+
+        const EntityCheck nameCheck = [](const Entities::BaseEntity& entity, Issues& issues) {
+            if (entity.getName().empty()) {
+                issues.push_back({Severity::Warning, entity.getHandle(), {},
+                    std::format("{} '{}' has no name", entity.getTypeName(), entity.getId())});
+            }
+        };
+        addRule(EntityKind::Scene, "entity.name", nameCheck);
+        addRule(EntityKind::Character, "entity.name", nameCheck);
+        addRule(EntityKind::Item, "entity.name", nameCheck);
+
+        addRule("entity.range", rangeCheck(EntityKind::Scene, rangesOf(Entities::Scene("", ""))));
+        addRule("entity.range", rangeCheck(EntityKind::Character, rangesOf(Entities::Character("", ""))));
+        addRule("entity.range", rangeCheck(EntityKind::Item, rangesOf(Entities::Item("", ""))));
+    }
+
+    ProjectValidator::~ProjectValidator() {
+        cancel();
+    }
+
+    void ProjectValidator::addRule(EntityKind kind, std::string id, EntityCheck check) {
+        m_entityRules.push_back({kind, std::move(id), std::move(check)});
+    }
+
+    void ProjectValidator::addRule(std::string id, ProjectCheck check) {
+        m_projectRules.push_back({std::move(id), std::move(check)});
+    }
+
+    /**
+     * @brief Snapshot a project and begin validating it in the background
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Project rules come first in the work list, so the slower whole-graph
+     * checks overlap with the entity shards instead of trailing them.
+     * Workers are capped by the number of shards.
+     *
+     * @param project Project to validate; only read during this call
+     * @return bool False if a pass is already running
+     */
+    bool ProjectValidator::start(const Project& project) {
+        if (m_busy) {
+            return false;
+        }
+
+        m_snapshot = project.snapshot();
+        m_shards.clear();
+        for (size_t rule = 0; rule < m_projectRules.size(); ++rule) {
+            m_shards.push_back({EntityKind::Scene, 0, 0, static_cast<int>(rule)});
+        }
+        const size_t sizes[ENTITY_KIND_COUNT] = {
+            m_snapshot->getScenes().size(), m_snapshot->getCharacters().size(), m_snapshot->getItems().size()
+        };
+        for (size_t kind = 0; kind < ENTITY_KIND_COUNT; ++kind) {
+            for (size_t begin = 0; begin < sizes[kind]; begin += SHARD_SIZE) {
+                m_shards.push_back({static_cast<EntityKind>(kind), begin, std::min(sizes[kind], begin + SHARD_SIZE), -1});
+            }
+        }
+
+        {
+            std::lock_guard lock(m_pendingMutex);
+            m_pending.clear();
+        }
+        m_nextShard.store(0, std::memory_order_relaxed);
+        m_doneShards.store(0, std::memory_order_relaxed);
+        m_cancelled.store(false, std::memory_order_relaxed);
+        m_busy = true;
+
+        const size_t workers = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(1, m_shards.size()));
+        for (size_t i = 0; i < workers; ++i) {
+            m_workers.emplace_back(&ProjectValidator::run, this);
+        }
+        return true;
+    }
+
+    void ProjectValidator::run() {
+        Issues issues;
+        while (!m_cancelled.load(std::memory_order_relaxed)) {
+            const size_t index = m_nextShard.fetch_add(1, std::memory_order_relaxed);
+            if (index >= m_shards.size()) {
+                break;
+            }
+            check(m_shards[index], issues);
+            if (!issues.empty()) {
+                std::lock_guard lock(m_pendingMutex);
+                std::move(issues.begin(), issues.end(), std::back_inserter(m_pending));
+                issues.clear();
+            }
+            m_doneShards.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Run every matching rule over one shard
+     *
+     * Only the issues a rule appends are stamped with its id, so rules do
+     * not need to know their own id.
+     */
+    void ProjectValidator::check(const Shard& shard, Issues& issues) const {
+        if (shard.projectRule >= 0) {
+            const ProjectRule& rule = m_projectRules[static_cast<size_t>(shard.projectRule)];
+            const size_t first = issues.size();
+            rule.check(*m_snapshot, issues);
+            for (size_t i = first; i < issues.size(); ++i) {
+                issues[i].rule = rule.id;
+            }
+            return;
+        }
+
+        for (const EntityRule& rule : m_entityRules) {
+            if (rule.kind != shard.kind) {
+                continue;
+            }
+            const size_t first = issues.size();
+            for (size_t i = shard.begin; i < shard.end; ++i) {
+                switch (shard.kind) {
+                    case EntityKind::Scene: rule.check(*m_snapshot->getScenes()[i], issues); break;
+                    case EntityKind::Character: rule.check(*m_snapshot->getCharacters()[i], issues); break;
+                    case EntityKind::Item: rule.check(*m_snapshot->getItems()[i], issues); break;
+                }
+            }
+            for (size_t i = first; i < issues.size(); ++i) {
+                issues[i].rule = rule.id;
+            }
+        }
+    }
+
+    /**
+     * @brief Collect the issues reported since the previous call
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The finished check happens before the last drain, so issues of the
+     * final shard are never left behind.
+     *
+     * @param out Receives the new issues, appended at the end
+     * @return bool True exactly once per pass, on the call that finished it
+     */
+    bool ProjectValidator::poll(Issues& out) {
+        if (!m_busy) {
+            return false;
+        }
+        const bool finished = m_doneShards.load(std::memory_order_acquire) == m_shards.size();
+        {
+            std::lock_guard lock(m_pendingMutex);
+            std::move(m_pending.begin(), m_pending.end(), std::back_inserter(out));
+            m_pending.clear();
+        }
+        if (!finished) {
+            return false;
+        }
+        join();
+        m_busy = false;
+        return true;
+    }
+
+    void ProjectValidator::cancel() {
+        m_cancelled.store(true, std::memory_order_relaxed);
+        join();
+        m_busy = false;
+        std::lock_guard lock(m_pendingMutex);
+        m_pending.clear();
+    }
+
+    void ProjectValidator::join() {
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+        m_snapshot.reset();
+    }
+
+    bool ProjectValidator::isBusy() const {
+        return m_busy;
+    }
+
+    float ProjectValidator::getProgress() const {
+        if (m_shards.empty()) {
+            return 1.0f;
+        }
+        return static_cast<float>(m_doneShards.load(std::memory_order_relaxed)) / static_cast<float>(m_shards.size());
+    }
+
+} // namespace ADS::Core
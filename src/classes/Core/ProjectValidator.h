@@ -0,0 +1,238 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROJECT_VALIDATOR_H
+#define ADS_CORE_PROJECT_VALIDATOR_H
+
+/**
+ * @file ProjectValidator.h
+ * @brief Rule-based project checks run in parallel before compiling or exporting
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A rule either inspects one entity of a given kind at a time, or the
+ * project as a whole. Entity rules are run over shards of each collection
+ * on every core; each finished shard hands its issues over at once, so a
+ * panel can list the first problems long before a large project is done.
+ *
+ * As with BackgroundSaver, the workers read a Project::snapshot() taken
+ * by start(); since snapshots share handles with their original, every
+ * reported handle resolves in the live project too.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EntityHandle.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief One problem found by a validation rule
+     */
+    struct ValidationIssue {
+        /**
+         * @brief How much the problem matters
+         */
+        enum class Severity : uint8_t {
+            Warning,    ///< Suspicious, but the project can still be exported
+            Error       ///< Must be fixed before exporting
+        };
+
+        Severity severity;      ///< Weight of the problem
+        EntityHandle entity;    ///< Offending entity; invalid for project-wide issues
+        std::string rule;       ///< Id of the rule that reported it, filled in by the validator
+        std::string message;    ///< Human-readable description
+    };
+
+    /**
+     * @brief Runs one validation pass at a time off the main thread
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * All public methods must be called from the main thread, and rules
+     * must not be added while a pass is running. Rules are called
+     * concurrently on different entities, so they must not share mutable
+     * state. The built-in rules are registered by the constructor.
+     */
+    class ProjectValidator {
+    public:
+        using Issues = std::vector<ValidationIssue>;    ///< Issues collected by a rule
+
+        /// Checks one entity, appending any issue found
+        using EntityCheck = std::function<void(const Entities::BaseEntity&, Issues&)>;
+
+        /// Checks the project as a whole, appending any issue found
+        using ProjectCheck = std::function<void(const Project&, Issues&)>;
+
+        static constexpr size_t SHARD_SIZE = 2048; ///< Entities checked per unit of work
+
+        /**
+         * @brief Create a validator with the built-in rules
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Built-in rules:
+         * - `scene.start`: exactly one start scene
+         * - `scene.unreachable`: every scene can be reached from the start scene
+         * - `character.health`: health does not exceed maximum health
+         * - `entity.name`: every entity has a name
+         * - `entity.range`: numeric properties lie within their declared constraints,
+         *   e.g. an item's quantity
+         *
+         * All but `entity.name` are project rules scanning the snapshot's
+         * property columns, see Project::query().
+         */
+        ProjectValidator();
+
+        /**
+         * @brief Wait for a running pass before destruction
+         */
+        ~ProjectValidator();
+
+        ProjectValidator(const ProjectValidator&) = delete;
+        ProjectValidator& operator=(const ProjectValidator&) = delete;
+
+        /**
+         * @brief Register a rule applied to every entity of a kind
+         *
+         * @param kind  Collection the rule applies to
+         * @param id    Rule id stamped on its issues
+         * @param check Rule body
+         */
+        void addRule(EntityKind kind, std::string id, EntityCheck check);
+
+        /**
+         * @brief Register a rule applied once to the whole project
+         *
+         * @param id    Rule id stamped on its issues
+         * @param check Rule body
+         */
+        void addRule(std::string id, ProjectCheck check);
+
+        /**
+         * @brief Snapshot a project and begin validating it in the background
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Blocks for the O(entities) copy made by Project::snapshot().
+         *
+         * @param project Project to validate; only read during this call
+         * @return bool False if a pass is already running
+         */
+        bool start(const Project& project);
+
+        /**
+         * @brief Collect the issues reported since the previous call
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Issues arrive shard by shard, in no particular order.
+         *
+         * @param out Receives the new issues, appended at the end
+         * @return bool True exactly once per pass, on the call that finished it
+         */
+        bool poll(Issues& out);
+
+        /**
+         * @brief Abandon a running pass and wait for the workers
+         *
+         * Issues not yet collected by poll() are discarded.
+         */
+        void cancel();
+
+        /**
+         * @brief Check whether a pass is in progress
+         * @return bool True from start() until the poll() that finishes it
+         */
+        [[nodiscard]] bool isBusy() const;
+
+        /**
+         * @brief Get the completed fraction of the running pass
+         * @return float Value in [0, 1]
+         */
+        [[nodiscard]] float getProgress() const;
+
+    private:
+        /**
+         * @brief Registered entity rule
+         */
+        struct EntityRule {
+            EntityKind kind;
+            std::string id;
+            EntityCheck check;
+        };
+
+        /**
+         * @brief Registered project rule
+         */
+        struct ProjectRule {
+            std::string id;
+            ProjectCheck check;
+        };
+
+        /**
+         * @brief Unit of work: one project rule, or a range of one collection
+         */
+        struct Shard {
+            EntityKind kind;        ///< Collection of the range
+            size_t begin;           ///< First entity of the range
+            size_t end;             ///< One past the last entity
+            int projectRule;        ///< Index into m_projectRules, or -1 for an entity range
+        };
+
+        /**
+         * @brief Worker body: take shards until none are left
+         */
+        void run();
+
+        /**
+         * @brief Run every matching rule over one shard
+         */
+        void check(const Shard& shard, Issues& issues) const;
+
+        /**
+         * @brief Join the workers and drop the snapshot
+         */
+        void join();
+
+        std::vector<EntityRule> m_entityRules;              ///< Per-entity rules
+        std::vector<ProjectRule> m_projectRules;            ///< Whole-project rules
+
+        std::unique_ptr<Project> m_snapshot;                ///< Copy read by the workers
+        std::vector<Shard> m_shards;                        ///< Work of the current pass
+        std::vector<std::thread> m_workers;                 ///< Threads taking shards
+        std::atomic<size_t> m_nextShard;                    ///< Next shard to take
+        std::atomic<size_t> m_doneShards;                   ///< Shards finished
+        std::atomic<bool> m_cancelled;                      ///< Set by cancel()
+        bool m_busy;                                        ///< Main-thread view of the pass
+
+        std::mutex m_pendingMutex;                          ///< Guards m_pending
+        Issues m_pending;                                   ///< Issues not yet collected by poll()
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROJECT_VALIDATOR_H
@@ -0,0 +1,148 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file PropertyColumns.cpp
+ * @brief Implementation of the PropertyColumns class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "PropertyColumns.h"
+
+#include "Entities/BaseEntity.h"
+
+namespace ADS::Core {
+
+    void PropertyColumns::configure(const Inspector::PropertySchema& schema) {
+        m_schema = &schema;
+        m_columns.clear();
+        m_columnOf.assign(schema.getDescriptors().size(), NO_COLUMN);
+        for (size_t i = 0; i < schema.getDescriptors().size(); ++i) {
+            const Inspector::PropertyDescriptor& descriptor = schema.getDescriptors()[i];
+            if (descriptor.isComputed()) {
+                continue;
+            }
+            switch (descriptor.getType()) {
+                case Inspector::PropertyType::Bool:
+                case Inspector::PropertyType::Int:
+                case Inspector::PropertyType::Enum:
+                case Inspector::PropertyType::Float:
+                    m_columnOf[i] = static_cast<uint32_t>(m_columns.size());
+                    m_columns.push_back({descriptor.getId(), descriptor.getType() == Inspector::PropertyType::Float, {}, {}});
+                    break;
+                default:
+                    break;
+            }
+        }
+        m_handles.clear();
+        m_live.clear();
+        m_liveCount = 0;
+    }
+
+    void PropertyColumns::insert(const Entities::BaseEntity& entity) {
+        const size_t row = entity.getHandle().index();
+        if (row >= m_handles.size()) {
+            m_handles.resize(row + 1);
+            m_live.resize(row + 1, 0);
+            for (Column& column : m_columns) {
+                if (column.isFloat) {
+                    column.floats.resize(row + 1, 0.0f);
+                } else {
+                    column.ints.resize(row + 1, 0);
+                }
+            }
+        }
+        for (Column& column : m_columns) {
+            write(column, row, entity.getPropertyValue(column.property));
+        }
+        if (!m_live[row]) {
+            m_live[row] = 1;
+            ++m_liveCount;
+        }
+        m_handles[row] = entity.getHandle();
+    }
+
+    void PropertyColumns::update(const EntityHandle handle, const std::string_view propertyId,
+                                 const Inspector::PropertyValue& value) {
+        const size_t row = handle.index();
+        if (m_schema == nullptr || row >= m_live.size() || m_handles[row] != handle) {
+            return;
+        }
+        const std::optional<size_t> descriptor = m_schema->indexOf(propertyId);
+        if (descriptor && m_columnOf[*descriptor] != NO_COLUMN) {
+            write(m_columns[m_columnOf[*descriptor]], row, value);
+        }
+    }
+
+    void PropertyColumns::erase(const EntityHandle handle) {
+        const size_t row = handle.index();
+        if (row < m_live.size() && m_live[row] && m_handles[row] == handle) {
+            m_live[row] = 0;
+            m_handles[row] = EntityHandle();
+            --m_liveCount;
+        }
+    }
+
+    const PropertyColumns::Column* PropertyColumns::findColumn(const std::string_view propertyId) const {
+        for (const Column& column : m_columns) {
+            if (column.property == propertyId) {
+                return &column;
+            }
+        }
+        return nullptr;
+    }
+
+    std::span<const PropertyColumns::Column> PropertyColumns::getColumns() const {
+        return m_columns;
+    }
+
+    std::span<const uint8_t> PropertyColumns::getLiveRows() const {
+        return m_live;
+    }
+
+    std::span<const EntityHandle> PropertyColumns::getHandles() const {
+        return m_handles;
+    }
+
+    size_t PropertyColumns::getRowCount() const {
+        return m_live.size();
+    }
+
+    size_t PropertyColumns::getLiveCount() const {
+        return m_liveCount;
+    }
+
+    void PropertyColumns::write(Column& column, const size_t row, const Inspector::PropertyValue& value) {
+        if (column.isFloat) {
+            if (const auto* f = std::get_if<float>(&value)) {
+                column.floats[row] = *f;
+            } else if (const auto* i = std::get_if<int>(&value)) {
+                column.floats[row] = static_cast<float>(*i);
+            } else {
+                column.floats[row] = 0.0f;
+            }
+            return;
+        }
+        if (const auto* i = std::get_if<int>(&value)) {
+            column.ints[row] = *i;
+        } else if (const auto* b = std::get_if<bool>(&value)) {
+            column.ints[row] = *b ? 1 : 0;
+        } else if (const auto* e = std::get_if<Inspector::EnumValue>(&value)) {
+            column.ints[row] = e->selectedIndex;
+        } else {
+            column.ints[row] = 0;
+        }
+    }
+
+}
@@ -0,0 +1,159 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROPERTY_COLUMNS_H
+#define ADS_CORE_PROPERTY_COLUMNS_H
+
+/**
+ * @file PropertyColumns.h
+ * @brief Column-per-property mirror of the scalar properties of one entity kind
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Entities keep their properties behind a virtual getPropertyValue(), one
+ * variant at a time. Questions about all the entities of a kind ("items
+ * with quantity above 10", "characters whose health exceeds their maximum")
+ * read one or two properties of every entity instead, so the project also
+ * keeps those properties as flat arrays, one per property, indexed by
+ * entity handle index. ColumnQuery scans them.
+ *
+ * @see ADS::Core::ColumnQuery
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "EntityHandle.h"
+#include "Inspector/PropertySchema.h"
+#include "Inspector/PropertyValue.h"
+
+namespace ADS::Entities {
+    class BaseEntity;
+}
+
+namespace ADS::Core {
+
+    /**
+     * @brief Scalar properties of every entity of a kind, one array per property
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Bool, Int and Enum properties are stored as int32 (false/true as 0/1,
+     * enums as the selected index) and Float properties as float; text,
+     * colours and vectors are left out, and so are computed properties,
+     * which reading at every add would make each entity fill its cache of
+     * computed values. Rows are entity handle indexes; the rows of removed
+     * entities stay in place, cleared from the live mask, until the handle
+     * index is reused.
+     *
+     * Owned and kept current by Project; not thread-safe.
+     */
+    class PropertyColumns {
+    public:
+        /**
+         * @brief Values of one property for every row
+         */
+        struct Column {
+            std::string property;           ///< Property id
+            bool isFloat = false;           ///< Values are in floats rather than ints
+            std::vector<int32_t> ints;      ///< Bool, Int and Enum values
+            std::vector<float> floats;      ///< Float values
+        };
+
+        /**
+         * @brief Pick the columns from a kind's schema
+         *
+         * @param schema Schema shared by every entity of the kind; must outlive the columns
+         */
+        void configure(const Inspector::PropertySchema& schema);
+
+        /**
+         * @brief Add a row for an entity, reading its current values
+         * @param entity Tracked entity whose handle is already issued
+         */
+        void insert(const Entities::BaseEntity& entity);
+
+        /**
+         * @brief Follow a property change of a tracked entity
+         *
+         * Changes of properties without a column are ignored.
+         *
+         * @param handle     Entity that changed
+         * @param propertyId Changed property
+         * @param value      New value
+         */
+        void update(EntityHandle handle, std::string_view propertyId, const Inspector::PropertyValue& value);
+
+        /**
+         * @brief Drop the row of an entity about to be removed
+         * @param handle Handle of the entity
+         */
+        void erase(EntityHandle handle);
+
+        /**
+         * @brief Find the column of a property
+         * @param propertyId Property id
+         * @return const Column* The column, or nullptr if the property has none
+         */
+        [[nodiscard]] const Column* findColumn(std::string_view propertyId) const;
+
+        /**
+         * @brief Get every column, in schema order
+         */
+        [[nodiscard]] std::span<const Column> getColumns() const;
+
+        /**
+         * @brief Get the live mask: 1 for rows holding an entity, 0 otherwise
+         */
+        [[nodiscard]] std::span<const uint8_t> getLiveRows() const;
+
+        /**
+         * @brief Get the handle of each row; invalid for rows not holding an entity
+         */
+        [[nodiscard]] std::span<const EntityHandle> getHandles() const;
+
+        /**
+         * @brief Get the number of rows, live or not
+         */
+        [[nodiscard]] size_t getRowCount() const;
+
+        /**
+         * @brief Get the number of rows holding an entity
+         */
+        [[nodiscard]] size_t getLiveCount() const;
+
+    private:
+        static constexpr uint32_t NO_COLUMN = UINT32_MAX;
+
+        /**
+         * @brief Store a value into a row of a column, converted to the column's type
+         */
+        static void write(Column& column, size_t row, const Inspector::PropertyValue& value);
+
+        const Inspector::PropertySchema* m_schema = nullptr;
+        std::vector<Column> m_columns;
+        std::vector<uint32_t> m_columnOf;      ///< Schema descriptor index → column index, NO_COLUMN if none
+        std::vector<EntityHandle> m_handles;
+        std::vector<uint8_t> m_live;
+        size_t m_liveCount = 0;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROPERTY_COLUMNS_H
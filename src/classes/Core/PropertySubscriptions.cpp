@@ -0,0 +1,158 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file PropertySubscriptions.cpp
+ * @brief Implementation of the PropertySubscriptions class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "PropertySubscriptions.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace ADS::Core {
+
+    size_t PropertySubscriptions::bucketOf(EntityKind kind, Inspector::DispatchMode mode) {
+        return static_cast<size_t>(kind) * MODE_COUNT + static_cast<size_t>(mode);
+    }
+
+    /**
+     * @brief Register a listener
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * During a dispatch the entry is parked until the outermost dispatch
+     * returns, so the lists being walked never grow under the walk.
+     */
+    Inspector::SubscriptionHandle PropertySubscriptions::add(EntityKind kind, std::string propertyId, Listener listener,
+                                                             Inspector::DispatchMode mode) {
+        const Inspector::SubscriptionHandle handle = m_nextHandle++;
+        Location location{bucketOf(kind, mode), std::move(propertyId)};
+        if (m_dispatchDepth > 0) {
+            m_pendingAdds.emplace_back(std::move(location), Entry{handle, std::move(listener), false});
+            m_needsCompaction = true;
+            return handle;
+        }
+        m_buckets[location.bucket][location.propertyId].push_back({handle, std::move(listener), false});
+        m_locations.emplace(handle, std::move(location));
+        return handle;
+    }
+
+    /**
+     * @brief Unregister a listener
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * During a dispatch the entry is only flagged, so it is skipped from
+     * then on, and erased by compact(); the listener may be the one
+     * running.
+     */
+    void PropertySubscriptions::remove(Inspector::SubscriptionHandle handle) {
+        if (const auto pending = std::ranges::find(m_pendingAdds, handle, [](const auto& add) { return add.second.handle; });
+            pending != m_pendingAdds.end()) {
+            m_pendingAdds.erase(pending);
+            return;
+        }
+
+        const auto location = m_locations.find(handle);
+        if (location == m_locations.end()) {
+            return;
+        }
+        ListenerMap& listeners = m_buckets[location->second.bucket];
+        const auto list = listeners.find(location->second.propertyId);
+        if (m_dispatchDepth > 0) {
+            for (Entry& entry : list->second) {
+                if (entry.handle == handle) {
+                    entry.removed = true;
+                }
+            }
+            m_needsCompaction = true;
+        } else {
+            std::erase_if(list->second, [handle](const Entry& entry) { return entry.handle == handle; });
+            if (list->second.empty()) {
+                listeners.erase(list);
+            }
+        }
+        m_locations.erase(location);
+    }
+
+    void PropertySubscriptions::call(const ListenerMap& listeners, std::string_view propertyId, EntityHandle entity,
+                                     const Inspector::PropertyChangedEvent& event) const {
+        const auto list = listeners.find(propertyId);
+        if (list == listeners.end()) {
+            return;
+        }
+        for (const Entry& entry : list->second) {
+            if (!entry.removed) {
+                entry.listener(entity, event);
+            }
+        }
+    }
+
+    /**
+     * @brief Call the listeners registered for an event
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Listeners of the property are called before listeners of every
+     * property, each in registration order.
+     *
+     * @param entity Entity that raised the event
+     * @param event  Property change
+     * @param mode   Which set of listeners to call
+     */
+    void PropertySubscriptions::dispatch(EntityHandle entity, const Inspector::PropertyChangedEvent& event,
+                                         Inspector::DispatchMode mode) {
+        const ListenerMap& listeners = m_buckets[bucketOf(entity.kind(), mode)];
+        if (listeners.empty()) {
+            return;
+        }
+
+        ++m_dispatchDepth;
+        call(listeners, event.propertyId, entity, event);
+        if (!event.propertyId.empty()) {
+            call(listeners, std::string_view(), entity, event);
+        }
+        if (--m_dispatchDepth == 0 && m_needsCompaction) {
+            compact();
+        }
+    }
+
+    size_t PropertySubscriptions::size() const {
+        return m_locations.size() + m_pendingAdds.size();
+    }
+
+    void PropertySubscriptions::compact() {
+        m_needsCompaction = false;
+        for (ListenerMap& listeners : m_buckets) {
+            for (auto list = listeners.begin(); list != listeners.end();) {
+                std::erase_if(list->second, [](const Entry& entry) { return entry.removed; });
+                list = list->second.empty() ? listeners.erase(list) : std::next(list);
+            }
+        }
+
+        std::vector<std::pair<Location, Entry>> pending;
+        pending.swap(m_pendingAdds);
+        for (auto& [location, entry] : pending) {
+            m_buckets[location.bucket][location.propertyId].push_back(std::move(entry));
+            m_locations.emplace(entry.handle, std::move(location));
+        }
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,151 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_PROPERTY_SUBSCRIPTIONS_H
+#define ADS_CORE_PROPERTY_SUBSCRIPTIONS_H
+
+/**
+ * @file PropertySubscriptions.h
+ * @brief Project-wide property listeners indexed by entity kind and property
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A listener interested in, say, the name of every scene registers once
+ * here instead of subscribing to the dispatcher of each scene and
+ * discarding the events of other properties. The project routes every
+ * entity event through dispatch(), which looks up the listeners of the
+ * entity's kind and the event's property and calls only those.
+ */
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "EntityCollection.h"
+#include "EntityHandle.h"
+#include "Inspector/PropertyEvent.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Index of listeners by (entity kind, property id, dispatch mode)
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * An empty property id listens to every property of the kind.
+     * Listeners may add or remove subscriptions while being called; a
+     * listener removed during a dispatch is not called again, one added
+     * is called from the next event on.
+     *
+     * Not thread-safe, like the Project that owns it: subscribe and
+     * dispatch from the thread that edits the project.
+     */
+    class PropertySubscriptions {
+    public:
+        /// Listener called with the changed entity and the change
+        using Listener = std::function<void(EntityHandle, const Inspector::PropertyChangedEvent&)>;
+
+        /**
+         * @brief Register a listener
+         *
+         * @param kind       Entity kind to listen to
+         * @param propertyId Property to listen to; empty for all properties
+         * @param listener   Function to call
+         * @param mode       Immediate, or Deferred to the project's event queue
+         * @return Inspector::SubscriptionHandle Handle for remove()
+         */
+        Inspector::SubscriptionHandle add(EntityKind kind, std::string propertyId, Listener listener,
+                                          Inspector::DispatchMode mode = Inspector::DispatchMode::Immediate);
+
+        /**
+         * @brief Unregister a listener
+         *
+         * @param handle Handle returned by add(); unknown handles are ignored
+         */
+        void remove(Inspector::SubscriptionHandle handle);
+
+        /**
+         * @brief Call the listeners registered for an event
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Costs two hash lookups when nobody listens to the property.
+         *
+         * @param entity Entity that raised the event
+         * @param event  Property change
+         * @param mode   Which set of listeners to call
+         */
+        void dispatch(EntityHandle entity, const Inspector::PropertyChangedEvent& event, Inspector::DispatchMode mode);
+
+        /**
+         * @brief Get the number of registered listeners
+         * @return size_t Listener count
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        static constexpr size_t MODE_COUNT = 2;     ///< Number of DispatchMode values
+
+        /**
+         * @brief One registered listener
+         */
+        struct Entry {
+            Inspector::SubscriptionHandle handle;
+            Listener listener;
+            bool removed = false;                   ///< Removed during a dispatch, erased after it
+        };
+
+        using ListenerMap = std::unordered_map<std::string, std::vector<Entry>, EntityIdHash, std::equal_to<>>;
+
+        /**
+         * @brief Where a handle's entry lives
+         */
+        struct Location {
+            size_t bucket;                          ///< Index into m_buckets
+            std::string propertyId;
+        };
+
+        std::array<ListenerMap, ENTITY_KIND_COUNT * MODE_COUNT> m_buckets;   ///< Listeners by kind and mode, then property
+        std::unordered_map<Inspector::SubscriptionHandle, Location> m_locations;
+        Inspector::SubscriptionHandle m_nextHandle = 1;
+        std::vector<std::pair<Location, Entry>> m_pendingAdds;  ///< Added during a dispatch, inserted after it
+        size_t m_dispatchDepth = 0;                 ///< Nested dispatch() calls in progress
+        bool m_needsCompaction = false;             ///< Entries were removed or added during a dispatch
+
+        /**
+         * @brief Index of the bucket of a kind and mode
+         */
+        [[nodiscard]] static size_t bucketOf(EntityKind kind, Inspector::DispatchMode mode);
+
+        /**
+         * @brief Call the live entries listening to one property
+         */
+        void call(const ListenerMap& listeners, std::string_view propertyId, EntityHandle entity,
+                  const Inspector::PropertyChangedEvent& event) const;
+
+        /**
+         * @brief Erase the entries removed during a dispatch and insert the ones added
+         */
+        void compact();
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_PROPERTY_SUBSCRIPTIONS_H
@@ -0,0 +1,451 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file SceneGraph.cpp
+ * @brief Implementation of the CSR scene graph
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "SceneGraph.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace ADS::Core {
+
+    namespace {
+        constexpr uint16_t UNREACHABLE = UINT16_MAX;
+    }
+
+    /**
+     * @brief Distances and first steps between every two node slots
+     *
+     * Row-major, from × to, over a stride left with spare slots so most new
+     * scenes fit without a rebuild. Sixteen bits each: a route never takes
+     * more exits than there are nodes, and MAX_ROUTED_NODES caps those.
+     */
+    struct SceneGraph::Routes {
+        size_t stride = 0;
+        std::vector<uint16_t> distance;     ///< UNREACHABLE if no route
+        std::vector<uint16_t> firstStep;    ///< Meaningless where distance is 0 or UNREACHABLE
+        std::vector<uint32_t> frontier;     ///< Scratch of walkRoutes()
+    };
+
+    void SceneGraph::ensureNode(uint32_t node) {
+        if (node < nodeCount()) {
+            return;
+        }
+        const size_t count = static_cast<size_t>(node) + 1;
+        m_offsets.resize(count + 1, m_offsets.back());
+        m_inDegree.resize(count, 0);
+        m_live.resize(count, 0);
+        m_start.resize(count, 0);
+        m_reachable.resize(count, 0);
+    }
+
+    void SceneGraph::addNode(uint32_t node, bool isStart) {
+        ensureNode(node);
+        m_live[node] = 1;
+        m_start[node] = 0;
+        m_reachable[node] = 0;
+        setStart(node, isStart);
+
+        // A new node has no exits yet: its row and column reach nothing but itself
+        if (Routes* table = editableRoutes()) {
+            if (node >= table->stride) {
+                m_routes.reset();
+            } else {
+                for (size_t other = 0; other < table->stride; ++other) {
+                    table->distance[node * table->stride + other] = UNREACHABLE;
+                    table->distance[other * table->stride + node] = UNREACHABLE;
+                }
+                table->distance[node * table->stride + node] = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Drop a node together with its exits and the exits leading to it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Entrances are found by scanning every row, so the cost is linear in
+     * the number of exits; the row offsets are rewritten in the same pass.
+     *
+     * @param node Scene slot index
+     * @return std::vector<uint32_t> Nodes that lost an exit to @p node
+     */
+    std::vector<uint32_t> SceneGraph::removeNode(uint32_t node) {
+        std::vector<uint32_t> sources;
+        if (!isLive(node)) {
+            return sources;
+        }
+
+        for (const uint32_t target : successors(node)) {
+            --m_inDegree[target];
+        }
+
+        size_t write = 0;
+        for (uint32_t row = 0; row < nodeCount(); ++row) {
+            const uint32_t begin = m_offsets[row];
+            const uint32_t end = m_offsets[row + 1];
+            m_offsets[row] = static_cast<uint32_t>(write);
+            if (row == node) {
+                continue;
+            }
+            for (uint32_t i = begin; i < end; ++i) {
+                if (m_targets[i] == node) {
+                    sources.push_back(row);
+                } else {
+                    m_targets[write++] = m_targets[i];
+                }
+            }
+        }
+        m_offsets.back() = static_cast<uint32_t>(write);
+        m_targets.resize(write);
+
+        m_inDegree[node] = 0;
+        m_live[node] = 0;
+        m_start[node] = 0;
+        m_reachable[node] = 0;
+        m_reachabilityStale = true;
+        // Every route through the node breaks; removing scenes is rare enough to walk everything again
+        m_routes.reset();
+        return sources;
+    }
+
+    void SceneGraph::setStart(uint32_t node, bool isStart) {
+        if (!isLive(node) || (m_start[node] != 0) == isStart) {
+            return;
+        }
+        m_start[node] = isStart ? 1 : 0;
+        if (isStart) {
+            if (!m_reachabilityStale) {
+                spread(node);
+            }
+        } else {
+            m_reachabilityStale = true;
+        }
+    }
+
+    bool SceneGraph::addEdge(uint32_t from, uint32_t to) {
+        if (!isLive(from) || !isLive(to)) {
+            return false;
+        }
+        const auto rowBegin = m_targets.begin() + m_offsets[from];
+        const auto rowEnd = m_targets.begin() + m_offsets[from + 1];
+        const auto position = std::lower_bound(rowBegin, rowEnd, to);
+        if (position != rowEnd && *position == to) {
+            return false;
+        }
+
+        m_targets.insert(position, to);
+        for (size_t row = from + 1; row < m_offsets.size(); ++row) {
+            ++m_offsets[row];
+        }
+        ++m_inDegree[to];
+
+        if (!m_reachabilityStale && m_reachable[from] != 0) {
+            spread(to);
+        }
+
+        // Routes s → from → to → t shorter than the known s → t; the row of `to` cannot improve through itself
+        if (Routes* table = editableRoutes()) {
+            const size_t stride = table->stride;
+            const uint16_t* toRow = &table->distance[to * stride];
+            for (size_t source = 0; source < stride; ++source) {
+                const uint16_t toFrom = table->distance[source * stride + from];
+                if (toFrom == UNREACHABLE || source == to) {
+                    continue;
+                }
+                const uint16_t step = source == from ? static_cast<uint16_t>(to) : table->firstStep[source * stride + from];
+                uint16_t* row = &table->distance[source * stride];
+                uint16_t* steps = &table->firstStep[source * stride];
+                for (size_t target = 0; target < stride; ++target) {
+                    if (toRow[target] == UNREACHABLE) {
+                        continue;
+                    }
+                    const uint32_t length = toFrom + 1u + toRow[target];
+                    if (length < row[target]) {
+                        row[target] = static_cast<uint16_t>(length);
+                        steps[target] = step;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    size_t SceneGraph::addEdges(const std::span<const std::pair<uint32_t, uint32_t>> edges) {
+        std::vector<std::pair<uint32_t, uint32_t>> sorted;
+        sorted.reserve(edges.size());
+        for (const auto& edge : edges) {
+            if (isLive(edge.first) && isLive(edge.second)) {
+                sorted.push_back(edge);
+            }
+        }
+        std::ranges::sort(sorted);
+        const auto repeated = std::ranges::unique(sorted);
+        sorted.erase(repeated.begin(), repeated.end());
+
+        std::vector<uint32_t> targets;
+        targets.reserve(m_targets.size() + sorted.size());
+        size_t next = 0;
+        size_t added = 0;
+        uint32_t rowBegin = 0;
+        for (uint32_t node = 0; node < nodeCount(); ++node) {
+            uint32_t existing = rowBegin;
+            const uint32_t rowEnd = m_offsets[node + 1];
+            for (; next < sorted.size() && sorted[next].first == node; ++next) {
+                const uint32_t to = sorted[next].second;
+                while (existing < rowEnd && m_targets[existing] < to) {
+                    targets.push_back(m_targets[existing++]);
+                }
+                if (existing < rowEnd && m_targets[existing] == to) {
+                    continue;
+                }
+                targets.push_back(to);
+                ++m_inDegree[to];
+                ++added;
+            }
+            targets.insert(targets.end(), m_targets.begin() + existing, m_targets.begin() + rowEnd);
+            rowBegin = rowEnd;
+            m_offsets[node + 1] = static_cast<uint32_t>(targets.size());
+        }
+        m_targets = std::move(targets);
+
+        if (added > 0) {
+            m_reachabilityStale = true;
+            m_routes.reset();
+        }
+        return added;
+    }
+
+    bool SceneGraph::removeEdge(uint32_t from, uint32_t to) {
+        if (!isLive(from)) {
+            return false;
+        }
+        const auto rowBegin = m_targets.begin() + m_offsets[from];
+        const auto rowEnd = m_targets.begin() + m_offsets[from + 1];
+        const auto position = std::lower_bound(rowBegin, rowEnd, to);
+        if (position == rowEnd || *position != to) {
+            return false;
+        }
+
+        m_targets.erase(position);
+        for (size_t row = from + 1; row < m_offsets.size(); ++row) {
+            --m_offsets[row];
+        }
+        --m_inDegree[to];
+
+        if (m_reachable[from] != 0) {
+            m_reachabilityStale = true;
+        }
+
+        // A source's distances all hold if another entrance of `to` is as close as `from` was, and
+        // then its first steps do too, being exits it still has; only the other sources walk again
+        if (Routes* table = editableRoutes()) {
+            const size_t stride = table->stride;
+            std::vector<uint32_t> entrances;
+            for (uint32_t row = 0; row < nodeCount(); ++row) {
+                if (row != from && std::ranges::binary_search(successors(row), to)) {
+                    entrances.push_back(row);
+                }
+            }
+            for (uint32_t source = 0; source < stride; ++source) {
+                const uint16_t* row = &table->distance[source * stride];
+                if (source != from && (row[from] == UNREACHABLE || row[to] != row[from] + 1
+                    || std::ranges::any_of(entrances, [row, to](const uint32_t entrance) {
+                           return row[entrance] != UNREACHABLE && row[entrance] + 1 == row[to];
+                       }))) {
+                    continue;
+                }
+                walkRoutes(*table, source);
+            }
+        }
+        return true;
+    }
+
+    std::span<const uint32_t> SceneGraph::successors(uint32_t node) const {
+        if (node >= nodeCount()) {
+            return {};
+        }
+        return std::span<const uint32_t>(m_targets).subspan(m_offsets[node], m_offsets[node + 1] - m_offsets[node]);
+    }
+
+    /**
+     * @brief Mark everything reachable from a node, stopping at already marked nodes
+     *
+     * Iterative breadth-first walk, so deep chains of scenes cannot
+     * overflow the stack.
+     */
+    void SceneGraph::spread(uint32_t node) const {
+        if (m_reachable[node] != 0) {
+            return;
+        }
+        std::vector<uint32_t> frontier{node};
+        m_reachable[node] = 1;
+        for (size_t i = 0; i < frontier.size(); ++i) {
+            for (const uint32_t next : successors(frontier[i])) {
+                if (m_reachable[next] == 0) {
+                    m_reachable[next] = 1;
+                    frontier.push_back(next);
+                }
+            }
+        }
+    }
+
+    void SceneGraph::refreshReachability() const {
+        if (!m_reachabilityStale) {
+            return;
+        }
+        std::fill(m_reachable.begin(), m_reachable.end(), 0);
+        for (uint32_t node = 0; node < nodeCount(); ++node) {
+            if (m_start[node] != 0) {
+                spread(node);
+            }
+        }
+        m_reachabilityStale = false;
+    }
+
+    bool SceneGraph::isReachable(uint32_t node) const {
+        if (!isLive(node)) {
+            return false;
+        }
+        refreshReachability();
+        return m_reachable[node] != 0;
+    }
+
+    std::vector<uint32_t> SceneGraph::unreachable() const {
+        refreshReachability();
+        std::vector<uint32_t> nodes;
+        for (uint32_t node = 0; node < nodeCount(); ++node) {
+            if (m_live[node] != 0 && m_reachable[node] == 0) {
+                nodes.push_back(node);
+            }
+        }
+        return nodes;
+    }
+
+    std::vector<uint32_t> SceneGraph::deadEnds() const {
+        std::vector<uint32_t> nodes;
+        for (uint32_t node = 0; node < nodeCount(); ++node) {
+            if (m_live[node] != 0 && m_offsets[node] == m_offsets[node + 1]) {
+                nodes.push_back(node);
+            }
+        }
+        return nodes;
+    }
+
+    std::vector<uint32_t> SceneGraph::orphans() const {
+        std::vector<uint32_t> nodes;
+        for (uint32_t node = 0; node < nodeCount(); ++node) {
+            if (m_live[node] != 0 && m_start[node] == 0 && m_inDegree[node] == 0) {
+                nodes.push_back(node);
+            }
+        }
+        return nodes;
+    }
+
+    size_t SceneGraph::edgeCount() const {
+        return m_targets.size();
+    }
+
+    void SceneGraph::walkRoutes(Routes& table, const uint32_t from) const {
+        const size_t stride = table.stride;
+        uint16_t* distance = &table.distance[from * stride];
+        uint16_t* firstStep = &table.firstStep[from * stride];
+        std::fill(distance, distance + stride, UNREACHABLE);
+        if (!isLive(from)) {
+            return;
+        }
+        distance[from] = 0;
+        std::vector<uint32_t>& frontier = table.frontier;
+        frontier.assign(1, from);
+        for (size_t i = 0; i < frontier.size(); ++i) {
+            const uint32_t node = frontier[i];
+            for (const uint32_t next : successors(node)) {
+                if (distance[next] == UNREACHABLE) {
+                    distance[next] = static_cast<uint16_t>(distance[node] + 1);
+                    firstStep[next] = node == from ? static_cast<uint16_t>(next) : firstStep[node];
+                    frontier.push_back(next);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get the routes, building them if there are none
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * One walk per node: nodes × (nodes + exits). The stride leaves room
+     * for a quarter more nodes, so adding scenes in the editor seldom
+     * forces another build.
+     */
+    const SceneGraph::Routes* SceneGraph::routes() const {
+        if (m_routes) {
+            return m_routes.get();
+        }
+        if (nodeCount() > MAX_ROUTED_NODES) {
+            return nullptr;
+        }
+        auto table = std::make_shared<Routes>();
+        table->stride = std::min<size_t>(nodeCount() + nodeCount() / 4 + 16, MAX_ROUTED_NODES);
+        table->distance.resize(table->stride * table->stride);
+        table->firstStep.resize(table->stride * table->stride, 0);
+        for (uint32_t node = 0; node < table->stride; ++node) {
+            walkRoutes(*table, node);
+        }
+        m_routes = std::move(table);
+        return m_routes.get();
+    }
+
+    SceneGraph::Routes* SceneGraph::editableRoutes() {
+        if (m_routes && m_routes.use_count() > 1) {
+            m_routes.reset();
+        }
+        return m_routes.get();
+    }
+
+    uint32_t SceneGraph::nextHop(const uint32_t from, const uint32_t to) const {
+        const Routes* table = routes();
+        if (table == nullptr || from >= table->stride || to >= table->stride) {
+            return NO_ROUTE;
+        }
+        const uint16_t length = table->distance[from * table->stride + to];
+        return length == UNREACHABLE || length == 0 ? NO_ROUTE : table->firstStep[from * table->stride + to];
+    }
+
+    uint32_t SceneGraph::distance(const uint32_t from, const uint32_t to) const {
+        const Routes* table = routes();
+        if (table == nullptr || from >= table->stride || to >= table->stride) {
+            return NO_ROUTE;
+        }
+        const uint16_t length = table->distance[from * table->stride + to];
+        return length == UNREACHABLE ? NO_ROUTE : length;
+    }
+
+    std::vector<uint32_t> SceneGraph::route(const uint32_t from, const uint32_t to) const {
+        std::vector<uint32_t> nodes;
+        for (uint32_t node = nextHop(from, to); node != NO_ROUTE; node = nextHop(node, to)) {
+            nodes.push_back(node);
+        }
+        return nodes;
+    }
+
+} // namespace ADS::Core
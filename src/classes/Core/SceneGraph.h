@@ -0,0 +1,255 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_SCENE_GRAPH_H
+#define ADS_CORE_SCENE_GRAPH_H
+
+/**
+ * @file SceneGraph.h
+ * @brief Scene → scene exits stored as compressed sparse rows
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Nodes are scene handle slot indexes, so the graph needs no id lookups
+ * and a node number stays valid for as long as its scene lives. Exits of
+ * node n are m_targets[m_offsets[n] .. m_offsets[n + 1]), kept sorted, so
+ * walking the whole graph touches two flat arrays.
+ *
+ * Queries answer the questions the graph view needs live: which scenes
+ * cannot be reached from a start scene, which have no exit, and which have
+ * no entrance; and, for hints and characters walking the map, the shortest
+ * route between any two scenes.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Directed scene graph with cached reachability
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Edits shift the target array, which is a single memmove over the
+     * exits stored after the edited row; adding an exit extends the cached
+     * reachable set in place, from the new target only. Removing an exit,
+     * a node or a start flag can shrink the set, so the cache is marked
+     * stale and rebuilt by one breadth-first pass on the next query.
+     *
+     * The graph is a plain value type and is copied with project snapshots.
+     *
+     * Routes are an all-pairs table of distances and first steps, built by
+     * one breadth-first pass per scene on the first route query, so a
+     * query is a lookup. Adding an exit relaxes the table in place;
+     * removing one walks again only from the scenes whose shortest routes
+     * may have used it. Copies share the table until one of them is
+     * edited, which then drops its reference and rebuilds on its next
+     * query.
+     */
+    class SceneGraph {
+    public:
+        static constexpr uint32_t NO_ROUTE = UINT32_MAX;
+        static constexpr uint32_t MAX_ROUTED_NODES = 65535;    ///< Beyond this many slots, route queries find nothing
+
+        /**
+         * @brief Register a live node
+         *
+         * @param node    Scene slot index
+         * @param isStart Whether the scene is a start scene
+         */
+        void addNode(uint32_t node, bool isStart);
+
+        /**
+         * @brief Drop a node together with its exits and the exits leading to it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param node Scene slot index
+         * @return std::vector<uint32_t> Nodes that lost an exit to @p node
+         */
+        std::vector<uint32_t> removeNode(uint32_t node);
+
+        /**
+         * @brief Set or clear the start flag of a node
+         *
+         * @param node    Scene slot index
+         * @param isStart Whether the scene is a start scene
+         */
+        void setStart(uint32_t node, bool isStart);
+
+        /**
+         * @brief Add an exit between two live nodes
+         *
+         * @param from Source scene slot index
+         * @param to   Target scene slot index
+         * @return bool False if either node is not live or the exit already exists
+         */
+        bool addEdge(uint32_t from, uint32_t to);
+
+        /**
+         * @brief Add many exits at once
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Merges the exits into the target array in one pass instead of
+         * shifting it once per exit, and leaves reachability and routes to
+         * be rebuilt by the next query.
+         *
+         * @param edges Source and target slot indexes; exits between nodes that are not live, and repeated ones, are skipped
+         * @return size_t Exits added
+         */
+        size_t addEdges(std::span<const std::pair<uint32_t, uint32_t>> edges);
+
+        /**
+         * @brief Remove an exit
+         *
+         * @param from Source scene slot index
+         * @param to   Target scene slot index
+         * @return bool False if there was no such exit
+         */
+        bool removeEdge(uint32_t from, uint32_t to);
+
+        /**
+         * @brief Get the exits of a node
+         *
+         * @param node Scene slot index
+         * @return std::span<const uint32_t> Sorted targets; empty for unknown nodes
+         */
+        [[nodiscard]] std::span<const uint32_t> successors(uint32_t node) const;
+
+        /**
+         * @brief Check whether a node can be reached from a start scene
+         *
+         * Start scenes are reachable from themselves.
+         *
+         * @param node Scene slot index
+         * @return bool True if reachable
+         */
+        [[nodiscard]] bool isReachable(uint32_t node) const;
+
+        /**
+         * @brief Get the live nodes no start scene leads to
+         * @return std::vector<uint32_t> Node indexes, ascending
+         */
+        [[nodiscard]] std::vector<uint32_t> unreachable() const;
+
+        /**
+         * @brief Get the live nodes without any exit
+         * @return std::vector<uint32_t> Node indexes, ascending
+         */
+        [[nodiscard]] std::vector<uint32_t> deadEnds() const;
+
+        /**
+         * @brief Get the live non-start nodes without any entrance
+         * @return std::vector<uint32_t> Node indexes, ascending
+         */
+        [[nodiscard]] std::vector<uint32_t> orphans() const;
+
+        /**
+         * @brief Get the number of exits
+         * @return size_t Edge count
+         */
+        [[nodiscard]] size_t edgeCount() const;
+
+        /**
+         * @brief Get the first step of a shortest route between two nodes
+         *
+         * @param from Scene slot index to start at
+         * @param to   Scene slot index to reach
+         * @return uint32_t Node to go to next, or NO_ROUTE if @p to cannot be reached or is @p from
+         */
+        [[nodiscard]] uint32_t nextHop(uint32_t from, uint32_t to) const;
+
+        /**
+         * @brief Get the exits taken by a shortest route between two nodes
+         *
+         * @param from Scene slot index to start at
+         * @param to   Scene slot index to reach
+         * @return uint32_t Exits taken; 0 from a node to itself, NO_ROUTE if unreachable
+         */
+        [[nodiscard]] uint32_t distance(uint32_t from, uint32_t to) const;
+
+        /**
+         * @brief Get a shortest route between two nodes
+         *
+         * @param from Scene slot index to start at
+         * @param to   Scene slot index to reach
+         * @return std::vector<uint32_t> Nodes after @p from, ending with @p to; empty if unreachable or the same node
+         */
+        [[nodiscard]] std::vector<uint32_t> route(uint32_t from, uint32_t to) const;
+
+    private:
+        struct Routes;
+
+        mutable std::shared_ptr<Routes> m_routes;   ///< All-pairs routes, built on the first query; shared by copies
+        std::vector<uint32_t> m_offsets{0};         ///< Row starts into m_targets; one more than the node count
+        std::vector<uint32_t> m_targets;            ///< Concatenated, per-row sorted exit targets
+        std::vector<uint32_t> m_inDegree;           ///< Entrances per node
+        std::vector<uint8_t> m_live;                ///< Node is a live scene
+        std::vector<uint8_t> m_start;               ///< Node is a start scene
+        mutable std::vector<uint8_t> m_reachable;   ///< Cached reachability from the start scenes
+        mutable bool m_reachabilityStale = false;   ///< m_reachable must be rebuilt before use
+
+        [[nodiscard]] size_t nodeCount() const {
+            return m_offsets.size() - 1;
+        }
+
+        [[nodiscard]] bool isLive(uint32_t node) const {
+            return node < nodeCount() && m_live[node] != 0;
+        }
+
+        /**
+         * @brief Grow every per-node array to cover a node index
+         */
+        void ensureNode(uint32_t node);
+
+        /**
+         * @brief Mark everything reachable from a node, stopping at already marked nodes
+         */
+        void spread(uint32_t node) const;
+
+        /**
+         * @brief Rebuild the reachable set if it is stale
+         */
+        void refreshReachability() const;
+
+        /**
+         * @brief Get the routes, building them if there are none
+         * @return const Routes* The routes, or nullptr beyond MAX_ROUTED_NODES
+         */
+        const Routes* routes() const;
+
+        /**
+         * @brief Get the routes for an edit to update, or nullptr if the edit need not
+         *
+         * Drops the routes instead when a copy shares them.
+         */
+        Routes* editableRoutes();
+
+        /**
+         * @brief Fill the row of one node with a breadth-first walk from it
+         */
+        void walkRoutes(Routes& table, uint32_t from) const;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_SCENE_GRAPH_H
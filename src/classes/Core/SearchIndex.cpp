@@ -0,0 +1,207 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file SearchIndex.cpp
+ * @brief Implementation of the trigram search index
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "SearchIndex.h"
+
+#include <algorithm>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Lower-case an ASCII byte, leaving every other byte unchanged
+     */
+    static unsigned char foldByte(char c) {
+        const auto byte = static_cast<unsigned char>(c);
+        return (byte >= 'A' && byte <= 'Z') ? static_cast<unsigned char>(byte + ('a' - 'A')) : byte;
+    }
+
+    /**
+     * @brief Lower-case a text with foldByte()
+     */
+    static std::string foldText(std::string_view text) {
+        std::string folded(text.size(), '\0');
+        std::transform(text.begin(), text.end(), folded.begin(),
+                       [](char c) { return static_cast<char>(foldByte(c)); });
+        return folded;
+    }
+
+    /**
+     * @brief Case-insensitive substring test against an already folded needle
+     */
+    static bool containsFolded(std::string_view haystack, std::string_view foldedNeedle) {
+        return std::search(haystack.begin(), haystack.end(), foldedNeedle.begin(), foldedNeedle.end(),
+                           [](char a, char b) { return foldByte(a) == static_cast<unsigned char>(b); })
+               != haystack.end();
+    }
+
+    std::vector<uint32_t> SearchIndex::trigramsOf(std::string_view text) {
+        std::vector<uint32_t> grams;
+        if (text.size() < 3) {
+            return grams;
+        }
+        grams.reserve(text.size() - 2);
+        for (size_t i = 0; i + 2 < text.size(); ++i) {
+            grams.push_back(static_cast<uint32_t>(foldByte(text[i])) << 16
+                            | static_cast<uint32_t>(foldByte(text[i + 1])) << 8
+                            | static_cast<uint32_t>(foldByte(text[i + 2])));
+        }
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        return grams;
+    }
+
+    bool SearchIndex::hasGram(const Document& document, uint32_t gram) {
+        return std::binary_search(document.nameGrams.begin(), document.nameGrams.end(), gram)
+               || std::binary_search(document.descriptionGrams.begin(), document.descriptionGrams.end(), gram);
+    }
+
+    /**
+     * @brief Set the text of one field, creating the document if needed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Walks the old and new sorted trigram sets in step. A trigram leaves
+     * the posting list only if the other field does not contain it either,
+     * and joins it only if the document was not already listed.
+     *
+     * @param entity Document key
+     * @param field  Field being replaced
+     * @param text   New text of the field
+     */
+    void SearchIndex::setField(EntityHandle entity, Field field, std::string_view text) {
+        const uint64_t key = entity.value();
+        Document& document = m_documents[key];
+        std::vector<uint32_t>& grams = field == Field::Name ? document.nameGrams : document.descriptionGrams;
+        const std::vector<uint32_t>& other = field == Field::Name ? document.descriptionGrams : document.nameGrams;
+        std::vector<uint32_t> updated = trigramsOf(text);
+
+        const auto inOther = [&other](uint32_t gram) {
+            return std::binary_search(other.begin(), other.end(), gram);
+        };
+
+        auto before = grams.begin();
+        auto after = updated.begin();
+        while (before != grams.end() || after != updated.end()) {
+            if (after == updated.end() || (before != grams.end() && *before < *after)) {
+                if (!inOther(*before)) {
+                    std::vector<uint64_t>& posting = m_postings[*before];
+                    const auto it = std::find(posting.begin(), posting.end(), key);
+                    *it = posting.back();
+                    posting.pop_back();
+                    if (posting.empty()) {
+                        m_postings.erase(*before);
+                    }
+                }
+                ++before;
+            } else if (before == grams.end() || *after < *before) {
+                if (!inOther(*after)) {
+                    m_postings[*after].push_back(key);
+                }
+                ++after;
+            } else {
+                ++before;
+                ++after;
+            }
+        }
+
+        grams = std::move(updated);
+        if (field == Field::Name) {
+            document.name = foldText(text);
+        }
+    }
+
+    void SearchIndex::remove(EntityHandle entity) {
+        if (!m_documents.contains(entity.value())) {
+            return;
+        }
+        setField(entity, Field::Name, {});
+        setField(entity, Field::Description, {});
+        m_documents.erase(entity.value());
+    }
+
+    void SearchIndex::clear() {
+        m_documents.clear();
+        m_postings.clear();
+    }
+
+    /**
+     * @brief Find the documents whose name or description contains a query
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Starts from the shortest posting list among the query's trigrams,
+     * discards documents lacking any other query trigram with a binary
+     * search per trigram, then confirms the substring on the survivors:
+     * first in the stored name, then in the description.
+     *
+     * @param query       Text to look for
+     * @param description Fetches a candidate's description for verification
+     * @return std::vector<EntityHandle> Matching documents
+     */
+    std::vector<EntityHandle> SearchIndex::search(std::string_view query, const DescriptionLookup& description) const {
+        std::vector<EntityHandle> matches;
+        if (query.empty()) {
+            return matches;
+        }
+        const std::string needle = foldText(query);
+
+        if (needle.size() < MIN_INDEXED_QUERY) {
+            for (const auto& [key, document] : m_documents) {
+                if (document.name.find(needle) != std::string::npos) {
+                    matches.push_back(EntityHandle::fromValue(key));
+                }
+            }
+            return matches;
+        }
+
+        const std::vector<uint32_t> grams = trigramsOf(needle);
+        const std::vector<uint64_t>* shortest = nullptr;
+        for (const uint32_t gram : grams) {
+            const auto it = m_postings.find(gram);
+            if (it == m_postings.end()) {
+                return matches;
+            }
+            if (shortest == nullptr || it->second.size() < shortest->size()) {
+                shortest = &it->second;
+            }
+        }
+
+        for (const uint64_t key : *shortest) {
+            const Document& document = m_documents.at(key);
+            if (!std::all_of(grams.begin(), grams.end(), [&document](uint32_t gram) { return hasGram(document, gram); })) {
+                continue;
+            }
+            const EntityHandle entity = EntityHandle::fromValue(key);
+            if (document.name.find(needle) != std::string::npos) {
+                matches.push_back(entity);
+            } else if (const auto text = description(entity); text && containsFolded(*text, needle)) {
+                matches.push_back(entity);
+            }
+        }
+        return matches;
+    }
+
+    size_t SearchIndex::size() const {
+        return m_documents.size();
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,145 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_SEARCH_INDEX_H
+#define ADS_CORE_SEARCH_INDEX_H
+
+/**
+ * @file SearchIndex.h
+ * @brief Trigram index for substring search over entity names and descriptions
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Backs the search bar of the project tree. Every indexed text is broken
+ * into its overlapping three-byte sequences; a query can only occur in a
+ * document that contains all of the query's trigrams, so a search only
+ * has to verify the few documents on the shortest matching posting list
+ * instead of scanning every entity.
+ *
+ * Matching ignores ASCII case. Other bytes, including UTF-8 sequences,
+ * are compared as they are.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityHandle.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Incrementally maintained trigram index keyed by EntityHandle
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each document has a name and a description field. Only lower-cased
+     * names are kept in the index; descriptions are represented by their
+     * trigrams alone and are fetched through a callback when a candidate
+     * has to be verified, so lazily loaded text is not duplicated here.
+     */
+    class SearchIndex {
+    public:
+        /**
+         * @brief Indexed text fields of a document
+         */
+        enum class Field : uint8_t {
+            Name,
+            Description
+        };
+
+        /// Returns the current description of an entity, or nullptr if unavailable
+        using DescriptionLookup = std::function<std::shared_ptr<const std::string>(EntityHandle)>;
+
+        static constexpr size_t MIN_INDEXED_QUERY = 3; ///< Shorter queries only match names
+
+        /**
+         * @brief Set the text of one field, creating the document if needed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Only the trigrams that appear or disappear are touched, so a small
+         * edit to a long description costs a few posting-list updates.
+         *
+         * @param entity Document key
+         * @param field  Field being replaced
+         * @param text   New text of the field
+         */
+        void setField(EntityHandle entity, Field field, std::string_view text);
+
+        /**
+         * @brief Drop a document and its postings
+         * @param entity Document key
+         */
+        void remove(EntityHandle entity);
+
+        /**
+         * @brief Drop every document
+         */
+        void clear();
+
+        /**
+         * @brief Find the documents whose name or description contains a query
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Queries shorter than MIN_INDEXED_QUERY cannot use the trigram
+         * postings and are matched against names only.
+         *
+         * @param query       Text to look for; case-insensitive for ASCII
+         * @param description Fetches a candidate's description for verification
+         * @return std::vector<EntityHandle> Matching documents, in no particular order;
+         *         empty for an empty query
+         */
+        [[nodiscard]] std::vector<EntityHandle> search(std::string_view query, const DescriptionLookup& description) const;
+
+        /**
+         * @brief Get the number of indexed documents
+         * @return size_t Document count
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        /**
+         * @brief Per-entity index state
+         */
+        struct Document {
+            std::string name;                       ///< Lower-cased name, for verification
+            std::vector<uint32_t> nameGrams;        ///< Sorted, unique trigrams of the name
+            std::vector<uint32_t> descriptionGrams; ///< Sorted, unique trigrams of the description
+        };
+
+        std::unordered_map<uint64_t, Document> m_documents;                 ///< Handle value → document
+        std::unordered_map<uint32_t, std::vector<uint64_t>> m_postings;     ///< Trigram → documents containing it
+
+        /**
+         * @brief Extract the sorted, unique trigrams of a text, ignoring ASCII case
+         */
+        static std::vector<uint32_t> trigramsOf(std::string_view text);
+
+        /**
+         * @brief Check whether a document has a trigram in either field
+         */
+        static bool hasGram(const Document& document, uint32_t gram);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_SEARCH_INDEX_H
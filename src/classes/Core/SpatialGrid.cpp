@@ -0,0 +1,180 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file SpatialGrid.cpp
+ * @brief Implementation of the SpatialGrid class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ADS::Core {
+
+    SpatialGrid::SpatialGrid(const float width, const float height, const float cellSize)
+        : m_cellSize(cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE),
+          m_columns(0),
+          m_rows(0),
+          m_nextOrder(0),
+          m_stamp(0) {
+        reset(width, height);
+    }
+
+    void SpatialGrid::reset(const float width, const float height) {
+        m_columns = std::max(1, static_cast<int>(std::ceil(width / m_cellSize)));
+        m_rows = std::max(1, static_cast<int>(std::ceil(height / m_cellSize)));
+        m_entries.clear();
+        m_byObject.clear();
+        m_cells.assign(static_cast<size_t>(m_columns) * static_cast<size_t>(m_rows), {});
+        m_visited.clear();
+        m_nextOrder = 0;
+    }
+
+    void SpatialGrid::resize(const float width, const float height) {
+        m_columns = std::max(1, static_cast<int>(std::ceil(width / m_cellSize)));
+        m_rows = std::max(1, static_cast<int>(std::ceil(height / m_cellSize)));
+        m_cells.assign(static_cast<size_t>(m_columns) * static_cast<size_t>(m_rows), {});
+        for (uint32_t index = 0; index < m_entries.size(); ++index) {
+            link(cellsOf(m_entries[index].bounds), index);
+        }
+    }
+
+    void SpatialGrid::insert(const EntityHandle object, const Bounds& bounds) {
+        const CellRange range = cellsOf(bounds);
+        if (const auto it = m_byObject.find(object.value()); it != m_byObject.end()) {
+            Entry& entry = m_entries[it->second];
+            const CellRange old = cellsOf(entry.bounds);
+            entry.bounds = bounds;
+            if (old.firstColumn != range.firstColumn || old.firstRow != range.firstRow ||
+                old.lastColumn != range.lastColumn || old.lastRow != range.lastRow) {
+                unlink(old, it->second);
+                link(range, it->second);
+            }
+            return;
+        }
+
+        const auto index = static_cast<uint32_t>(m_entries.size());
+        m_entries.push_back({object, bounds, m_nextOrder++});
+        m_visited.push_back(0);
+        m_byObject.emplace(object.value(), index);
+        link(range, index);
+    }
+
+    bool SpatialGrid::remove(const EntityHandle object) {
+        const auto it = m_byObject.find(object.value());
+        if (it == m_byObject.end()) {
+            return false;
+        }
+        const uint32_t index = it->second;
+        m_byObject.erase(it);
+        unlink(cellsOf(m_entries[index].bounds), index);
+
+        // The last entry fills the hole, so its cells must point at its new index
+        const auto last = static_cast<uint32_t>(m_entries.size() - 1);
+        if (index != last) {
+            const CellRange range = cellsOf(m_entries[last].bounds);
+            unlink(range, last);
+            m_entries[index] = m_entries[last];
+            link(range, index);
+            m_byObject[m_entries[index].object.value()] = index;
+        }
+        m_entries.pop_back();
+        m_visited.pop_back();
+        return true;
+    }
+
+    const Bounds* SpatialGrid::find(const EntityHandle object) const {
+        const auto it = m_byObject.find(object.value());
+        return it != m_byObject.end() ? &m_entries[it->second].bounds : nullptr;
+    }
+
+    void SpatialGrid::query(const Bounds& area, std::vector<EntityHandle>& objects) const {
+        objects.clear();
+        const CellRange range = cellsOf(area);
+        const uint32_t stamp = nextStamp();
+        std::vector<uint32_t> found;
+        for (int row = range.firstRow; row <= range.lastRow; ++row) {
+            for (int column = range.firstColumn; column <= range.lastColumn; ++column) {
+                for (const uint32_t index : m_cells[static_cast<size_t>(row) * m_columns + column]) {
+                    if (m_visited[index] != stamp && m_entries[index].bounds.intersects(area)) {
+                        m_visited[index] = stamp;
+                        found.push_back(index);
+                    }
+                }
+            }
+        }
+
+        std::ranges::sort(found, {}, [this](const uint32_t index) { return m_entries[index].order; });
+        objects.reserve(found.size());
+        for (const uint32_t index : found) {
+            objects.push_back(m_entries[index].object);
+        }
+    }
+
+    EntityHandle SpatialGrid::pick(const float x, const float y) const {
+        const CellRange range = cellsOf(Bounds{x, y, x, y});
+        const Entry* top = nullptr;
+        for (const uint32_t index : m_cells[static_cast<size_t>(range.firstRow) * m_columns + range.firstColumn]) {
+            const Entry& entry = m_entries[index];
+            if (entry.bounds.contains(x, y) && (top == nullptr || entry.order > top->order)) {
+                top = &entry;
+            }
+        }
+        return top != nullptr ? top->object : EntityHandle();
+    }
+
+    size_t SpatialGrid::size() const {
+        return m_entries.size();
+    }
+
+    SpatialGrid::CellRange SpatialGrid::cellsOf(const Bounds& bounds) const {
+        const auto cell = [this](const float coordinate, const int count) {
+            return std::clamp(static_cast<int>(std::floor(coordinate / m_cellSize)), 0, count - 1);
+        };
+        return {cell(bounds.minX, m_columns), cell(bounds.minY, m_rows),
+                cell(std::max(bounds.minX, bounds.maxX), m_columns), cell(std::max(bounds.minY, bounds.maxY), m_rows)};
+    }
+
+    void SpatialGrid::link(const CellRange& range, const uint32_t entry) {
+        for (int row = range.firstRow; row <= range.lastRow; ++row) {
+            for (int column = range.firstColumn; column <= range.lastColumn; ++column) {
+                m_cells[static_cast<size_t>(row) * m_columns + column].push_back(entry);
+            }
+        }
+    }
+
+    void SpatialGrid::unlink(const CellRange& range, const uint32_t entry) {
+        for (int row = range.firstRow; row <= range.lastRow; ++row) {
+            for (int column = range.firstColumn; column <= range.lastColumn; ++column) {
+                std::vector<uint32_t>& cell = m_cells[static_cast<size_t>(row) * m_columns + column];
+                if (const auto it = std::ranges::find(cell, entry); it != cell.end()) {
+                    *it = cell.back();
+                    cell.pop_back();
+                }
+            }
+        }
+    }
+
+    uint32_t SpatialGrid::nextStamp() const {
+        if (++m_stamp == 0) {
+            // Wrapped around: old stamps could match again
+            std::ranges::fill(m_visited, 0);
+            m_stamp = 1;
+        }
+        return m_stamp;
+    }
+}
@@ -0,0 +1,193 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_SPATIAL_GRID_H
+#define ADS_CORE_SPATIAL_GRID_H
+
+/**
+ * @file SpatialGrid.h
+ * @brief Uniform grid over the objects of a scene, for picking and culling
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A scene canvas is bounded, at most 4096 pixels a side, and its objects
+ * are of similar sizes, so a flat grid of fixed cells answers point and
+ * rectangle queries as well as a quadtree with none of its rebalancing.
+ * Each object is listed in every cell its bounds touch; a query visits
+ * only the cells it overlaps and tests the bounds of the objects there.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityHandle.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Axis-aligned rectangle in scene pixels, maximum exclusive
+     */
+    struct Bounds {
+        float minX = 0.0f;
+        float minY = 0.0f;
+        float maxX = 0.0f;
+        float maxY = 0.0f;
+
+        [[nodiscard]] constexpr bool contains(const float x, const float y) const {
+            return x >= minX && x < maxX && y >= minY && y < maxY;
+        }
+
+        [[nodiscard]] constexpr bool intersects(const Bounds& other) const {
+            return minX < other.maxX && other.minX < maxX && minY < other.maxY && other.minY < maxY;
+        }
+    };
+
+    /**
+     * @brief Objects of one scene indexed by the cells their bounds cover
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Moving an object touches only the cells of its old and new bounds.
+     * Objects partly or wholly outside the scene are kept in the border
+     * cells, so they can still be picked. Later insertions are on top of
+     * earlier ones for pick().
+     */
+    class SpatialGrid {
+    public:
+        static constexpr float DEFAULT_CELL_SIZE = 128.0f;     ///< Cell side in scene pixels
+
+        /**
+         * @brief Create an empty grid over a scene
+         *
+         * @param width    Scene width in pixels
+         * @param height   Scene height in pixels
+         * @param cellSize Cell side in pixels
+         */
+        explicit SpatialGrid(float width = 0.0f, float height = 0.0f, float cellSize = DEFAULT_CELL_SIZE);
+
+        /**
+         * @brief Drop every object and cover a scene of another size
+         */
+        void reset(float width, float height);
+
+        /**
+         * @brief Cover a scene of another size, keeping the objects
+         */
+        void resize(float width, float height);
+
+        /**
+         * @brief Add an object, or move it if it is already there
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A moved object keeps its place in the stacking order.
+         *
+         * @param object Entity of the object
+         * @param bounds Its bounds in scene pixels
+         */
+        void insert(EntityHandle object, const Bounds& bounds);
+
+        /**
+         * @brief Drop an object
+         * @return bool False if the object was not in the grid
+         */
+        bool remove(EntityHandle object);
+
+        /**
+         * @brief Get the bounds of an object
+         * @return const Bounds* The bounds, or nullptr if the object is not in the grid
+         */
+        [[nodiscard]] const Bounds* find(EntityHandle object) const;
+
+        /**
+         * @brief Find the objects overlapping a rectangle
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * For culling to the visible part of the canvas and for marquee
+         * selection. Each object is reported once, in stacking order.
+         *
+         * @param area    Rectangle in scene pixels
+         * @param objects Replaced by the objects found
+         */
+        void query(const Bounds& area, std::vector<EntityHandle>& objects) const;
+
+        /**
+         * @brief Find the topmost object under a point
+         *
+         * @param x Scene x in pixels
+         * @param y Scene y in pixels
+         * @return EntityHandle The object, or an invalid handle if there is none
+         */
+        [[nodiscard]] EntityHandle pick(float x, float y) const;
+
+        /**
+         * @brief Get the number of objects
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        /**
+         * @brief One indexed object
+         */
+        struct Entry {
+            EntityHandle object;
+            Bounds bounds;
+            uint64_t order;                 ///< Stacking order, higher on top
+        };
+
+        /**
+         * @brief Range of cells covered by some bounds, inclusive
+         */
+        struct CellRange {
+            int firstColumn;
+            int firstRow;
+            int lastColumn;
+            int lastRow;
+        };
+
+        float m_cellSize;
+        int m_columns;
+        int m_rows;
+        std::vector<Entry> m_entries;
+        std::unordered_map<uint64_t, uint32_t> m_byObject;         ///< Entry index by EntityHandle::value()
+        std::vector<std::vector<uint32_t>> m_cells;                 ///< Entry indexes, row by row
+        uint64_t m_nextOrder;
+        mutable std::vector<uint32_t> m_visited;                    ///< Query stamp of each entry, to report it once
+        mutable uint32_t m_stamp;
+
+        /**
+         * @brief Get the cells covered by some bounds, clamped to the grid
+         */
+        [[nodiscard]] CellRange cellsOf(const Bounds& bounds) const;
+
+        /**
+         * @brief Add or remove an entry index in the cells of a range
+         */
+        void link(const CellRange& range, uint32_t entry);
+        void unlink(const CellRange& range, uint32_t entry);
+
+        /**
+         * @brief Start a query, so every entry counts as not yet reported
+         */
+        uint32_t nextStamp() const;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_SPATIAL_GRID_H
@@ -0,0 +1,82 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file StartupTimer.cpp
+ * @brief Implementation of the StartupTimer class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "StartupTimer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace ADS::Core {
+    namespace {
+        /**
+         * Reference point of the timings; statics are initialised by the main thread before main()
+         */
+        const std::chrono::steady_clock::time_point processStart = std::chrono::steady_clock::now();
+        const std::thread::id mainThread = std::this_thread::get_id();
+
+        std::mutex phasesMutex;
+        std::vector<StartupTimer::Record> phases;
+        std::atomic<bool> firstFrameMarked{false};
+        std::atomic<double> firstFrameMs{0.0};
+
+        double millisecondsSinceStart(const std::chrono::steady_clock::time_point time) {
+            return std::chrono::duration<double, std::milli>(time - processStart).count();
+        }
+    }
+
+    StartupTimer::Phase::Phase(const char* name)
+        : m_name(name), m_start(std::chrono::steady_clock::now()), m_trace(name) {}
+
+    StartupTimer::Phase::~Phase() {
+        const auto end = std::chrono::steady_clock::now();
+        const Record record{m_name, std::this_thread::get_id() == mainThread, millisecondsSinceStart(m_start),
+                            std::chrono::duration<double, std::milli>(end - m_start).count()};
+        std::lock_guard lock(phasesMutex);
+        phases.push_back(record);
+    }
+
+    double StartupTimer::getElapsedMs() {
+        return millisecondsSinceStart(std::chrono::steady_clock::now());
+    }
+
+    std::vector<StartupTimer::Record> StartupTimer::getPhases() {
+        std::vector<Record> started;
+        {
+            std::lock_guard lock(phasesMutex);
+            started = phases;
+        }
+        std::ranges::stable_sort(started, {}, &Record::startMs);
+        return started;
+    }
+
+    bool StartupTimer::markFirstFrame() {
+        if (firstFrameMarked.exchange(true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        firstFrameMs.store(getElapsedMs(), std::memory_order_release);
+        return true;
+    }
+
+    double StartupTimer::getFirstFrameMs() {
+        return firstFrameMs.load(std::memory_order_acquire);
+    }
+}
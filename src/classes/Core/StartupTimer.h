@@ -0,0 +1,115 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_STARTUP_TIMER_H
+#define ADS_CORE_STARTUP_TIMER_H
+
+/**
+ * @file StartupTimer.h
+ * @brief Wall-clock timings of the startup phases, up to the first frame
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <chrono>
+#include <vector>
+
+#include "TraceRecorder.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Records how long each startup phase took, and on which thread
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Times are taken from the static initialisation of the program, which
+     * stands in for the process start. Phases may run on any thread and
+     * overlap; each one is also a TraceRecorder span, so a trace started
+     * with TRACE_FILE shows the startup graph as it ran. App logs the
+     * phases once the first frame is presented, see markFirstFrame().
+     */
+    class StartupTimer {
+    public:
+        /**
+         * @brief Records the enclosing block as a startup phase
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         */
+        class Phase {
+        public:
+            /**
+             * @param name Phase name; a string literal
+             */
+            explicit Phase(const char* name);
+            ~Phase();
+
+            Phase(const Phase&) = delete;
+            Phase& operator=(const Phase&) = delete;
+
+        private:
+            const char* m_name;
+            std::chrono::steady_clock::time_point m_start;
+            TraceRecorder::Scope m_trace;
+        };
+
+        /**
+         * @brief One finished phase
+         */
+        struct Record {
+            const char* name;
+            bool mainThread;        ///< Run on the thread that started the program
+            double startMs;         ///< Since the program started
+            double durationMs;
+        };
+
+        StartupTimer() = delete;
+
+        /**
+         * @brief Get the time since the program started
+         *
+         * @return double Milliseconds
+         */
+        [[nodiscard]] static double getElapsedMs();
+
+        /**
+         * @brief Get the phases finished so far, in the order they started
+         */
+        [[nodiscard]] static std::vector<Record> getPhases();
+
+        /**
+         * @brief Note that the first frame was presented
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Only the first call counts; it fixes getFirstFrameMs(). Safe to
+         * call from any thread.
+         *
+         * @return bool True for the first call, which should report the phases
+         */
+        static bool markFirstFrame();
+
+        /**
+         * @brief Get the time to the first frame
+         *
+         * @return double Milliseconds since the program started; 0 until markFirstFrame()
+         */
+        [[nodiscard]] static double getFirstFrameMs();
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_STARTUP_TIMER_H
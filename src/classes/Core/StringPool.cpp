@@ -0,0 +1,66 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file StringPool.cpp
+ * @brief Implementation of the StringPool class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "StringPool.h"
+
+#include <algorithm>
+
+namespace ADS::Core {
+
+    StringPool::Text StringPool::intern(const std::string_view text) {
+        if (const auto it = m_strings.find(text); it != m_strings.end()) {
+            return it->second;
+        }
+        if (m_strings.size() >= m_sweepAt) {
+            purge();
+            m_sweepAt = std::max(MIN_SWEEP_SIZE, 2 * m_strings.size());
+        }
+        Text payload = std::make_shared<const std::string>(text);
+        m_strings.emplace(*payload, payload);
+        m_bytes += payload->size();
+        return payload;
+    }
+
+    size_t StringPool::purge() {
+        // Only the pool can hand out new references, so a count of one cannot go back up
+        return std::erase_if(m_strings, [this](const auto& entry) {
+            if (entry.second.use_count() != 1) {
+                return false;
+            }
+            m_bytes -= entry.second->size();
+            return true;
+        });
+    }
+
+    void StringPool::clear() {
+        m_strings.clear();
+        m_bytes = 0;
+        m_sweepAt = MIN_SWEEP_SIZE;
+    }
+
+    size_t StringPool::size() const {
+        return m_strings.size();
+    }
+
+    size_t StringPool::getBytes() const {
+        return m_bytes;
+    }
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_STRING_POOL_H
+#define ADS_CORE_STRING_POOL_H
+
+/**
+ * @file StringPool.h
+ * @brief Shares one copy of each distinct text among the entities of a project
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Imported and pasted entities often repeat the same description word for
+ * word. Entity text is already an immutable, refcounted payload (see
+ * LazyText), so equal texts can point at the same payload: the first one
+ * allocates it and every later one only takes a reference. Two texts from
+ * the same pool are equal exactly when they are the same pointer.
+ *
+ * @see ADS::Entities::LazyText
+ */
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Pool of shared, immutable strings
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The pool holds a reference to every string it hands out, and drops
+     * the strings nobody else holds any more whenever it has doubled in
+     * size since the last sweep, or on purge(). Payloads are plain
+     * std::shared_ptr, so they stay valid after the pool is gone and may be
+     * released from any thread; intern() and purge() are main-thread only.
+     */
+    class StringPool {
+    public:
+        using Text = std::shared_ptr<const std::string>;
+
+        /// Entries below which intern() never sweeps
+        static constexpr size_t MIN_SWEEP_SIZE = 1024;
+
+        /**
+         * @brief Get the shared copy of a text, making it if the pool has none
+         * @param text Text to share
+         * @return Text Payload equal to @p text, never null
+         */
+        [[nodiscard]] Text intern(std::string_view text);
+
+        /**
+         * @brief Drop the strings held by nothing but the pool
+         * @return size_t Number of strings dropped
+         */
+        size_t purge();
+
+        /**
+         * @brief Drop every string; payloads handed out stay valid
+         */
+        void clear();
+
+        /**
+         * @brief Get the number of strings in the pool, including unused ones not swept yet
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Get the characters held by the strings in the pool
+         */
+        [[nodiscard]] size_t getBytes() const;
+
+    private:
+        std::unordered_map<std::string_view, Text> m_strings;  ///< Keys view their own payload
+        size_t m_bytes = 0;
+        size_t m_sweepAt = MIN_SWEEP_SIZE;                      ///< Size at which intern() sweeps next
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_STRING_POOL_H
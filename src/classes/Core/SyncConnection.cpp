@@ -0,0 +1,319 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file SyncConnection.cpp
+ * @brief Implementation of the SyncConnection class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "SyncConnection.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include <boost/asio.hpp>
+
+namespace ADS::Core {
+
+    namespace asio = boost::asio;
+    using asio::ip::tcp;
+
+    namespace {
+        constexpr size_t FRAME_HEADER_BYTES = 4;
+
+        std::shared_ptr<const std::string> makeFrame(std::string_view payload) {
+            auto frame = std::make_shared<std::string>();
+            frame->reserve(FRAME_HEADER_BYTES + payload.size());
+            const auto size = static_cast<uint32_t>(payload.size());
+            for (int shift = 0; shift < 32; shift += 8) {
+                frame->push_back(static_cast<char>(size >> shift));
+            }
+            frame->append(payload);
+            return frame;
+        }
+    }
+
+    /**
+     * @brief State shared with the network thread
+     */
+    struct SyncConnection::Impl {
+        asio::io_context io;
+        asio::executor_work_guard<asio::io_context::executor_type> work{io.get_executor()};
+        tcp::resolver resolver{io};
+        std::optional<tcp::acceptor> acceptor;                  ///< Set while hosting
+        std::vector<std::shared_ptr<Peer>> peers;               ///< Network thread only
+        std::vector<std::shared_ptr<const std::string>> backlog; ///< Frames sent before a join completed
+        bool connected = false;                                 ///< Network thread only
+        Notify onFrames;
+        std::atomic<size_t> peerCount{0};
+        std::atomic<uint16_t> port{0};
+
+        mutable std::mutex mutex;                               ///< Guards inbound and error
+        std::vector<std::string> inbound;
+        std::string error;
+
+        std::thread thread;
+
+        void start() {
+            thread = std::thread([this] { io.run(); });
+        }
+
+        void setError(const std::string& message) {
+            const std::lock_guard lock(mutex);
+            error = message;
+        }
+
+        void accept();
+        void add(tcp::socket socket);
+        void remove(const Peer* peer);
+        void deliver(const Peer* from, std::string payload);
+    };
+
+    /**
+     * @brief One open connection; owned by the handlers in flight on it
+     */
+    struct SyncConnection::Peer : std::enable_shared_from_this<Peer> {
+        Impl& impl;
+        tcp::socket socket;
+        std::array<unsigned char, FRAME_HEADER_BYTES> header{};
+        std::string body;
+        std::deque<std::shared_ptr<const std::string>> outbox;
+
+        Peer(Impl& owner, tcp::socket connected) : impl(owner), socket(std::move(connected)) {}
+
+        void readHeader() {
+            asio::async_read(socket, asio::buffer(header),
+                [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+                    if (ec) {
+                        self->fail(ec);
+                        return;
+                    }
+                    uint32_t size = 0;
+                    for (size_t i = 0; i < FRAME_HEADER_BYTES; ++i) {
+                        size |= static_cast<uint32_t>(self->header[i]) << (8 * i);
+                    }
+                    if (size > MAX_FRAME_BYTES) {
+                        self->impl.setError("peer sent an oversized frame");
+                        self->close();
+                        return;
+                    }
+                    self->body.resize(size);
+                    self->readBody();
+                });
+        }
+
+        void readBody() {
+            asio::async_read(socket, asio::buffer(body),
+                [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+                    if (ec) {
+                        self->fail(ec);
+                        return;
+                    }
+                    self->impl.deliver(self.get(), std::move(self->body));
+                    self->body.clear();
+                    self->readHeader();
+                });
+        }
+
+        void write(std::shared_ptr<const std::string> frame) {
+            outbox.push_back(std::move(frame));
+            if (outbox.size() == 1) {
+                writeNext();
+            }
+        }
+
+        void writeNext() {
+            asio::async_write(socket, asio::buffer(*outbox.front()),
+                [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+                    if (ec) {
+                        self->fail(ec);
+                        return;
+                    }
+                    self->outbox.pop_front();
+                    if (!self->outbox.empty()) {
+                        self->writeNext();
+                    }
+                });
+        }
+
+        void fail(const boost::system::error_code& ec) {
+            if (ec != asio::error::operation_aborted && ec != asio::error::eof) {
+                impl.setError(ec.message());
+            }
+            close();
+        }
+
+        void close() {
+            boost::system::error_code ignored;
+            socket.close(ignored);
+            impl.remove(this);
+        }
+    };
+
+    void SyncConnection::Impl::accept() {
+        acceptor->async_accept([this](const boost::system::error_code& ec, tcp::socket socket) {
+            if (ec) {
+                if (ec != asio::error::operation_aborted) {
+                    setError(ec.message());
+                }
+                return;
+            }
+            add(std::move(socket));
+            accept();
+        });
+    }
+
+    void SyncConnection::Impl::add(tcp::socket socket) {
+        boost::system::error_code ignored;
+        socket.set_option(tcp::no_delay(true), ignored);
+        auto peer = std::make_shared<Peer>(*this, std::move(socket));
+        peers.push_back(peer);
+        peerCount = peers.size();
+        peer->readHeader();
+
+        if (!connected) {
+            connected = true;
+            for (auto& frame : backlog) {
+                peer->write(std::move(frame));
+            }
+            backlog.clear();
+        }
+    }
+
+    void SyncConnection::Impl::remove(const Peer* peer) {
+        std::erase_if(peers, [peer](const std::shared_ptr<Peer>& open) {
+            return open.get() == peer;
+        });
+        peerCount = peers.size();
+    }
+
+    void SyncConnection::Impl::deliver(const Peer* from, std::string payload) {
+        if (acceptor) {
+            const auto frame = makeFrame(payload);
+            for (const auto& peer : peers) {
+                if (peer.get() != from) {
+                    peer->write(frame);
+                }
+            }
+        }
+        {
+            const std::lock_guard lock(mutex);
+            inbound.push_back(std::move(payload));
+        }
+        if (onFrames) {
+            onFrames();
+        }
+    }
+
+    SyncConnection::SyncConnection() : m_impl(std::make_unique<Impl>()) {
+    }
+
+    SyncConnection::~SyncConnection() {
+        close();
+    }
+
+    void SyncConnection::host(uint16_t port, Notify onFrames) {
+        Impl& impl = *m_impl;
+        impl.onFrames = std::move(onFrames);
+        impl.acceptor.emplace(impl.io, tcp::endpoint(tcp::v4(), port));
+        impl.port = impl.acceptor->local_endpoint().port();
+        impl.connected = true;
+        impl.accept();
+        impl.start();
+    }
+
+    void SyncConnection::join(const std::string& address, uint16_t port, Notify onFrames) {
+        Impl& impl = *m_impl;
+        impl.onFrames = std::move(onFrames);
+        impl.resolver.async_resolve(address, std::to_string(port),
+            [&impl](const boost::system::error_code& ec, const tcp::resolver::results_type& endpoints) {
+                if (ec) {
+                    impl.setError(ec.message());
+                    return;
+                }
+                auto socket = std::make_shared<tcp::socket>(impl.io);
+                asio::async_connect(*socket, endpoints,
+                    [&impl, socket](const boost::system::error_code& connectError, const tcp::endpoint&) {
+                        if (connectError) {
+                            impl.setError(connectError.message());
+                            return;
+                        }
+                        impl.add(std::move(*socket));
+                    });
+            });
+        impl.start();
+    }
+
+    void SyncConnection::close() {
+        Impl& impl = *m_impl;
+        if (!impl.thread.joinable()) {
+            return;
+        }
+        asio::post(impl.io, [&impl] {
+            boost::system::error_code ignored;
+            if (impl.acceptor) {
+                impl.acceptor->close(ignored);
+            }
+            impl.resolver.cancel();
+            for (const auto& peer : std::vector(impl.peers)) {
+                peer->socket.close(ignored);
+            }
+            impl.peers.clear();
+            impl.peerCount = 0;
+        });
+        impl.work.reset();
+        impl.thread.join();
+    }
+
+    void SyncConnection::send(std::string payload) {
+        asio::post(m_impl->io, [&impl = *m_impl, frame = makeFrame(payload)] {
+            if (!impl.connected) {
+                impl.backlog.push_back(frame);
+                return;
+            }
+            for (const auto& peer : impl.peers) {
+                peer->write(frame);
+            }
+        });
+    }
+
+    size_t SyncConnection::receive(std::vector<std::string>& payloads) {
+        const std::lock_guard lock(m_impl->mutex);
+        const size_t count = m_impl->inbound.size();
+        std::move(m_impl->inbound.begin(), m_impl->inbound.end(), std::back_inserter(payloads));
+        m_impl->inbound.clear();
+        return count;
+    }
+
+    uint16_t SyncConnection::getPort() const {
+        return m_impl->port;
+    }
+
+    size_t SyncConnection::getPeerCount() const {
+        return m_impl->peerCount;
+    }
+
+    std::string SyncConnection::getError() const {
+        const std::lock_guard lock(m_impl->mutex);
+        return m_impl->error;
+    }
+
+}
@@ -0,0 +1,130 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_SYNC_CONNECTION_H
+#define ADS_CORE_SYNC_CONNECTION_H
+
+/**
+ * @file SyncConnection.h
+ * @brief TCP transport of delta stream payloads between designers
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * One designer hosts and the others join. Payloads travel as frames:
+ *
+ *   [size u32, little-endian][payload]
+ *
+ * The host relays every frame it receives to the other peers, so each
+ * site sees the edits of all the others without a mesh of connections.
+ *
+ * @see ADS::Core::SyncSession
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Sends and receives delta stream payloads over TCP
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Networking runs on a thread owned by the connection; send() and
+     * receive() may be called from any thread. Errors do not throw once
+     * connected: a peer that fails is dropped, and getError() tells why.
+     */
+    class SyncConnection {
+    public:
+        /// Called on the network thread after frames arrive
+        using Notify = std::function<void()>;
+
+        /// Largest frame accepted; a peer sending more is dropped
+        static constexpr size_t MAX_FRAME_BYTES = 64u << 20;
+
+        SyncConnection();
+        ~SyncConnection();
+
+        SyncConnection(const SyncConnection&) = delete;
+        SyncConnection& operator=(const SyncConnection&) = delete;
+
+        /**
+         * @brief Accept peers on a port and relay their frames
+         *
+         * @param port     TCP port; 0 picks a free one, see getPort()
+         * @param onFrames Called when frames are waiting for receive()
+         * @throws std::runtime_error if the port cannot be bound
+         */
+        void host(uint16_t port, Notify onFrames = {});
+
+        /**
+         * @brief Connect to a host
+         *
+         * Returns at once; the connection completes, or fails with
+         * getError() set, on the network thread.
+         *
+         * @param address  Host name or address
+         * @param port     TCP port the host listens on
+         * @param onFrames Called when frames are waiting for receive()
+         */
+        void join(const std::string& address, uint16_t port, Notify onFrames = {});
+
+        /**
+         * @brief Close every connection and stop the network thread
+         */
+        void close();
+
+        /**
+         * @brief Queue a payload for every peer
+         * @param payload Frame contents
+         */
+        void send(std::string payload);
+
+        /**
+         * @brief Take the frames received since the last call
+         *
+         * @param payloads Receives the frame contents, in arrival order
+         * @return size_t Number of frames appended
+         */
+        size_t receive(std::vector<std::string>& payloads);
+
+        /**
+         * @brief Get the local port while hosting, 0 otherwise
+         */
+        [[nodiscard]] uint16_t getPort() const;
+
+        /**
+         * @brief Get the number of open connections
+         */
+        [[nodiscard]] size_t getPeerCount() const;
+
+        /**
+         * @brief Get the last network error, empty if none
+         */
+        [[nodiscard]] std::string getError() const;
+
+    private:
+        struct Impl;
+        struct Peer;
+
+        std::unique_ptr<Impl> m_impl;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_SYNC_CONNECTION_H
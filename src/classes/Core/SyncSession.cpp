@@ -0,0 +1,449 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file SyncSession.cpp
+ * @brief Implementation of the SyncSession class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "SyncSession.h"
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <utility>
+
+#include "Profiling.h"
+#include "TraceRecorder.h"
+
+namespace ADS::Core {
+
+    namespace {
+        constexpr EntityKind ALL_KINDS[] = {EntityKind::Scene, EntityKind::Character, EntityKind::Item};
+
+        std::string makeEntityKey(EntityKind kind, std::string_view id) {
+            std::string key;
+            key.reserve(id.size() + 1);
+            key.push_back(static_cast<char>('0' + static_cast<int>(kind)));
+            key.append(id);
+            return key;
+        }
+
+        std::string makeRegisterKey(const std::string& entityKey, std::string_view property) {
+            std::string key;
+            key.reserve(entityKey.size() + property.size() + 1);
+            key.append(entityKey);
+            key.push_back('\0');
+            key.append(property);
+            return key;
+        }
+
+        std::string makeConflictKey(const std::string& entityKey, uint64_t site) {
+            std::string key = entityKey;
+            key.push_back('\0');
+            key.append(std::to_string(site));
+            return key;
+        }
+
+        /**
+         * @brief Draw a non-zero site id
+         *
+         * Random rather than time-based, so peers that start together still differ.
+         */
+        uint64_t randomSite() {
+            std::random_device device;
+            uint64_t site = 0;
+            while (site == 0) {
+                site = static_cast<uint64_t>(device()) << 32 | device();
+            }
+            return site;
+        }
+
+        /**
+         * @brief Give a received enumeration value the options of the local property
+         */
+        Inspector::PropertyValue localise(const Entities::BaseEntity& entity, const std::string& property,
+                                          const Inspector::PropertyValue& value) {
+            const auto* selection = std::get_if<Inspector::EnumValue>(&value);
+            if (selection == nullptr) {
+                return value;
+            }
+            const Inspector::PropertyValue current = entity.getPropertyValue(property);
+            const auto* local = std::get_if<Inspector::EnumValue>(&current);
+            return Inspector::EnumValue(selection->selectedIndex, local != nullptr ? local->options : nullptr);
+        }
+
+        void setStartingValues(Entities::BaseEntity& entity, const DeltaOp& op) {
+            for (const auto& [property, value] : op.properties) {
+                if (property != "name") {
+                    entity.setPropertyValue(property, localise(entity, property, value));
+                }
+            }
+        }
+
+        /**
+         * @brief Pause a project's undo journal and flag remote application for a scope
+         */
+        class ApplyScope {
+        public:
+            ApplyScope(UndoJournal& journal, bool& applying) : m_journal(journal), m_applying(applying) {
+                m_journal.setPaused(true);
+                m_applying = true;
+            }
+
+            ~ApplyScope() {
+                m_applying = false;
+                m_journal.setPaused(false);
+            }
+
+            ApplyScope(const ApplyScope&) = delete;
+            ApplyScope& operator=(const ApplyScope&) = delete;
+
+        private:
+            UndoJournal& m_journal;
+            bool& m_applying;
+        };
+    }
+
+    SyncSession::SyncSession(uint64_t site)
+        : m_site(site != 0 ? site : randomSite()) {
+    }
+
+    SyncSession::~SyncSession() {
+        detach();
+    }
+
+    void SyncSession::attach(Project& project) {
+        detach();
+        m_project = &project;
+        for (EntityKind kind : ALL_KINDS) {
+            m_subscriptions.push_back(project.subscribe(kind, "",
+                [this](EntityHandle handle, const Inspector::PropertyChangedEvent& event) {
+                    onPropertyChanged(handle, event);
+                }));
+        }
+        m_membershipSubscription = project.subscribeMembership(
+            [this](const Entities::BaseEntity& entity, bool added) {
+                onMembershipChanged(entity, added);
+            });
+    }
+
+    void SyncSession::detach() {
+        if (m_project != nullptr) {
+            for (Inspector::SubscriptionHandle handle : m_subscriptions) {
+                m_project->unsubscribe(handle);
+            }
+            m_project->unsubscribeMembership(m_membershipSubscription);
+        }
+        m_project = nullptr;
+        m_subscriptions.clear();
+        m_membershipSubscription = 0;
+        m_outgoing.clear();
+        m_outgoingIndex.clear();
+        m_inbound.clear();
+        m_pendingRemoteOps = 0;
+        m_versions.clear();
+        m_presence.clear();
+        m_conflicts.clear();
+    }
+
+    bool SyncSession::isAttached() const {
+        return m_project != nullptr;
+    }
+
+    uint64_t SyncSession::getSite() const {
+        return m_site;
+    }
+
+    void SyncSession::onPropertyChanged(EntityHandle handle, const Inspector::PropertyChangedEvent& event) {
+        if (m_applying) {
+            return;
+        }
+        const Entities::BaseEntity* entity = m_project->resolve(handle);
+        if (entity == nullptr) {
+            return;
+        }
+        DeltaOp op;
+        op.type = DeltaOp::Type::Set;
+        op.kind = handle.kind();
+        op.entity = entity->getId();
+        op.clock = ++m_clock;
+        op.property = event.propertyId;
+        op.value = event.newValue;
+        m_versions[makeRegisterKey(makeEntityKey(op.kind, op.entity), op.property)] = {op.clock, m_site};
+        queue(std::move(op));
+    }
+
+    void SyncSession::onMembershipChanged(const Entities::BaseEntity& entity, bool added) {
+        if (m_applying) {
+            return;
+        }
+        DeltaOp op;
+        op.type = added ? DeltaOp::Type::Create : DeltaOp::Type::Remove;
+        op.kind = entity.getHandle().kind();
+        op.entity = entity.getId();
+        op.clock = ++m_clock;
+        if (added) {
+            for (const Inspector::PropertyDescriptor& descriptor : entity.getPropertySchema().getDescriptors()) {
+                if (!descriptor.isReadOnly() && !descriptor.isComputed()) {
+                    op.properties.emplace_back(descriptor.getId(), entity.getPropertyValue(descriptor.getId()));
+                }
+            }
+        }
+        m_presence[makeEntityKey(op.kind, op.entity)] = {{op.clock, m_site}, !added};
+        queue(std::move(op));
+    }
+
+    void SyncSession::queue(DeltaOp op) {
+        if (m_outgoing.empty()) {
+            m_firstOutgoing = Clock::now();
+        }
+        const std::string entityKey = makeEntityKey(op.kind, op.entity);
+        if (op.type == DeltaOp::Type::Set) {
+            std::string key = makeRegisterKey(entityKey, op.property);
+            const auto membership = m_outgoingIndex.find(entityKey);
+            const auto it = m_outgoingIndex.find(key);
+            // Only merge into an edit made since the entity was last added or removed
+            if (it != m_outgoingIndex.end()
+                && (membership == m_outgoingIndex.end() || membership->second < it->second)) {
+                DeltaOp& queued = m_outgoing[it->second];
+                queued.value = std::move(op.value);
+                queued.clock = op.clock;
+                return;
+            }
+            m_outgoingIndex[std::move(key)] = m_outgoing.size();
+        } else {
+            m_outgoingIndex[entityKey] = m_outgoing.size();
+        }
+        m_outgoing.push_back(std::move(op));
+    }
+
+    std::string SyncSession::takeOutgoing(Clock::time_point now) {
+        if (m_outgoing.empty()
+            || (m_outgoing.size() < MAX_BATCH_OPS && now - m_firstOutgoing < FLUSH_INTERVAL)) {
+            return {};
+        }
+        TraceRecorder::Scope trace("SyncSession::takeOutgoing");
+        ADS_ZONE("SyncSession::takeOutgoing");
+
+        // Edits of an entity removed later in the batch are dead; walk backwards to drop them
+        DeltaBatch batch;
+        batch.site = m_site;
+        batch.ops.reserve(m_outgoing.size());
+        std::unordered_set<std::string> removed;
+        for (auto op = m_outgoing.rbegin(); op != m_outgoing.rend(); ++op) {
+            std::string entityKey = makeEntityKey(op->kind, op->entity);
+            if (op->type == DeltaOp::Type::Remove) {
+                removed.insert(std::move(entityKey));
+            } else if (removed.contains(entityKey)) {
+                continue;
+            }
+            batch.ops.push_back(std::move(*op));
+        }
+        std::reverse(batch.ops.begin(), batch.ops.end());
+        m_outgoing.clear();
+        m_outgoingIndex.clear();
+
+        std::string payload = DeltaStream::encode(batch);
+        m_stats.sentOps += batch.ops.size();
+        m_stats.sentBytes += payload.size();
+        return payload;
+    }
+
+    bool SyncSession::hasOutgoing() const {
+        return !m_outgoing.empty();
+    }
+
+    void SyncSession::receive(std::string_view payload) {
+        DeltaBatch batch = DeltaStream::decode(payload);
+        m_stats.receivedBytes += payload.size();
+        if (batch.site == m_site || batch.ops.empty()) {
+            return;
+        }
+        m_pendingRemoteOps += batch.ops.size();
+        m_inbound.push_back({std::move(batch), 0});
+    }
+
+    size_t SyncSession::applyRemote(size_t maxOps) {
+        if (m_project == nullptr || m_inbound.empty()) {
+            return 0;
+        }
+        TraceRecorder::Scope trace("SyncSession::applyRemote");
+        ADS_ZONE("SyncSession::applyRemote");
+        ApplyScope scope(m_project->getUndoJournal(), m_applying);
+
+        size_t done = 0;
+        while (done < maxOps && !m_inbound.empty()) {
+            Inbound& inbound = m_inbound.front();
+            const std::vector<DeltaOp>& ops = inbound.batch.ops;
+            const DeltaOp& first = ops[inbound.next];
+
+            // A run of creations or removals of one kind goes through one bulk call
+            size_t end = inbound.next + 1;
+            if (first.type != DeltaOp::Type::Set) {
+                const size_t limit = std::min(ops.size(), inbound.next + (maxOps - done));
+                while (end < limit && ops[end].type == first.type && ops[end].kind == first.kind) {
+                    ++end;
+                }
+            }
+            for (size_t i = inbound.next; i < end; ++i) {
+                m_clock = std::max(m_clock, ops[i].clock);
+            }
+
+            const std::span<const DeltaOp> run(ops.data() + inbound.next, end - inbound.next);
+            switch (first.type) {
+                case DeltaOp::Type::Create: applyCreates(run, inbound.batch.site); break;
+                case DeltaOp::Type::Remove: applyRemoves(run, inbound.batch.site); break;
+                case DeltaOp::Type::Set:    applySet(first, inbound.batch.site); break;
+            }
+
+            done += run.size();
+            m_pendingRemoteOps -= run.size();
+            inbound.next = end;
+            if (inbound.next == ops.size()) {
+                m_inbound.pop_front();
+            }
+        }
+        return done;
+    }
+
+    void SyncSession::applyCreates(std::span<const DeltaOp> ops, uint64_t site) {
+        std::vector<NewEntity> entries;
+        std::vector<const DeltaOp*> created;
+        for (const DeltaOp& op : ops) {
+            const Version version{op.clock, site};
+            const std::string entityKey = makeEntityKey(op.kind, op.entity);
+            Presence& presence = m_presence[entityKey];
+            if (find(op.kind, op.entity) != nullptr) {
+                if (presence.version.site == site) {
+                    // Delivered twice; the entity is this site's already
+                    ++m_stats.discardedOps;
+                } else {
+                    // A different entity under the same id: keep ours, and leave theirs out with its edits
+                    m_conflicts.insert(makeConflictKey(entityKey, site));
+                    ++m_stats.conflicts;
+                }
+                continue;
+            }
+            if (presence.version > version) {
+                ++m_stats.discardedOps;
+                continue;
+            }
+            presence = {version, false};
+
+            std::string name;
+            for (const auto& [property, value] : op.properties) {
+                if (property == "name") {
+                    name = Inspector::getValueOr<std::string>(value, {});
+                }
+            }
+            entries.push_back({op.entity, std::move(name)});
+            created.push_back(&op);
+        }
+        if (entries.empty()) {
+            return;
+        }
+
+        const auto initialize = [&created](Entities::BaseEntity& entity, size_t entry) {
+            setStartingValues(entity, *created[entry]);
+        };
+        size_t added = 0;
+        switch (ops.front().kind) {
+            case EntityKind::Scene:     added = m_project->addScenes(entries, initialize); break;
+            case EntityKind::Character: added = m_project->addCharacters(entries, initialize); break;
+            case EntityKind::Item:      added = m_project->addItems(entries, initialize); break;
+        }
+        m_stats.appliedOps += added;
+        m_stats.addedEntities += added;
+        m_stats.discardedOps += entries.size() - added;
+    }
+
+    void SyncSession::applyRemoves(std::span<const DeltaOp> ops, uint64_t site) {
+        std::vector<std::string> ids;
+        for (const DeltaOp& op : ops) {
+            const Version version{op.clock, site};
+            const std::string entityKey = makeEntityKey(op.kind, op.entity);
+            if (isConflicting(entityKey, site)) {
+                ++m_stats.discardedOps;
+                continue;
+            }
+            Presence& presence = m_presence[entityKey];
+            if (presence.version > version) {
+                ++m_stats.discardedOps;
+                continue;
+            }
+            presence = {version, true};
+            ids.push_back(op.entity);
+        }
+
+        size_t removed = 0;
+        switch (ops.front().kind) {
+            case EntityKind::Scene:     removed = m_project->removeScenes(ids); break;
+            case EntityKind::Character: removed = m_project->removeCharacters(ids); break;
+            case EntityKind::Item:      removed = m_project->removeItems(ids); break;
+        }
+        m_stats.appliedOps += removed;
+        m_stats.discardedOps += ids.size() - removed;
+    }
+
+    void SyncSession::applySet(const DeltaOp& op, uint64_t site) {
+        const std::string entityKey = makeEntityKey(op.kind, op.entity);
+        Entities::BaseEntity* entity = find(op.kind, op.entity);
+        if (entity == nullptr || isConflicting(entityKey, site)
+            || !accept(makeRegisterKey(entityKey, op.property), entityKey, {op.clock, site})) {
+            ++m_stats.discardedOps;
+            return;
+        }
+        entity->setPropertyValue(op.property, localise(*entity, op.property, op.value));
+        ++m_stats.appliedOps;
+    }
+
+    bool SyncSession::accept(const std::string& key, const std::string& entityKey, Version version) {
+        const auto presence = m_presence.find(entityKey);
+        if (presence != m_presence.end() && presence->second.removed && presence->second.version > version) {
+            return false;
+        }
+        auto [it, inserted] = m_versions.try_emplace(key, version);
+        if (!inserted) {
+            if (it->second > version) {
+                return false;
+            }
+            it->second = version;
+        }
+        return true;
+    }
+
+    bool SyncSession::isConflicting(const std::string& entityKey, uint64_t site) const {
+        return !m_conflicts.empty() && m_conflicts.contains(makeConflictKey(entityKey, site));
+    }
+
+    Entities::BaseEntity* SyncSession::find(EntityKind kind, std::string_view id) const {
+        switch (kind) {
+            case EntityKind::Scene:     return m_project->findScene(id);
+            case EntityKind::Character: return m_project->findCharacter(id);
+            case EntityKind::Item:      return m_project->findItem(id);
+        }
+        return nullptr;
+    }
+
+    size_t SyncSession::getPendingRemoteOps() const {
+        return m_pendingRemoteOps;
+    }
+
+    const SyncStats& SyncSession::getStats() const {
+        return m_stats;
+    }
+
+}
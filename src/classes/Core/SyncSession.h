@@ -0,0 +1,260 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_SYNC_SESSION_H
+#define ADS_CORE_SYNC_SESSION_H
+
+/**
+ * @file SyncSession.h
+ * @brief Merges the edits of several designers working on one project
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Every site edits its own copy of the same project. A session turns the
+ * local property events and entity additions and removals into DeltaStream
+ * batches, and applies the batches of the other sites. Each property of
+ * each entity is a last-writer-wins register ordered by (Lamport clock,
+ * site id), and a removal is a tombstone that beats every older edit of
+ * the entity, so all sites converge on the same values whatever order the
+ * batches arrive in. Nothing is ever sent or applied for entities that
+ * were not edited.
+ *
+ * An entity created on another site with the id of a different entity
+ * here is a conflict: its creation and later edits are rejected and
+ * counted, and each site keeps the entity it made.
+ *
+ * @see ADS::Core::DeltaStream
+ * @see ADS::Core::SyncConnection
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "DeltaStream.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Counters of a sync session
+     */
+    struct SyncStats {
+        size_t sentOps = 0;         ///< Local edits sent, after coalescing
+        size_t sentBytes = 0;       ///< Size of the payloads sent
+        size_t receivedBytes = 0;   ///< Size of the payloads received
+        size_t appliedOps = 0;      ///< Remote edits applied to the project
+        size_t addedEntities = 0;   ///< Entities created by remote edits
+        size_t discardedOps = 0;    ///< Remote edits older than what the project holds
+        size_t conflicts = 0;       ///< Remote creations rejected for an id that names another entity here
+    };
+
+    /**
+     * @brief Sends local edits of a project and applies remote ones
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Main-thread only. Local edits are queued as they happen; repeated
+     * edits of the same property before a flush travel as one. Remote
+     * batches are queued by receive() and applied by applyRemote() a
+     * budget at a time, so a large batch spreads over several frames. A
+     * remote edit changes the project through its ordinary setters and
+     * bulk APIs, so panels update as for a local edit, but it is not
+     * recorded in the undo journal and is not sent back out.
+     *
+     * Peers are expected to start from the same saved project; exits and
+     * project settings are not synchronised.
+     */
+    class SyncSession {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /// Longest a local edit waits before it is sent
+        static constexpr std::chrono::milliseconds FLUSH_INTERVAL{50};
+
+        /// Queued local edits that trigger a flush without waiting
+        static constexpr size_t MAX_BATCH_OPS = 4096;
+
+        /// Remote edits applied per applyRemote() call by default
+        static constexpr size_t APPLY_BUDGET_OPS = 2048;
+
+        /**
+         * @param site Id of this site; 0 to draw a random one
+         */
+        explicit SyncSession(uint64_t site = 0);
+        ~SyncSession();
+
+        SyncSession(const SyncSession&) = delete;
+        SyncSession& operator=(const SyncSession&) = delete;
+
+        /**
+         * @brief Start following a project
+         *
+         * Detaches from the previous project and forgets its queues and
+         * versions.
+         *
+         * @param project Project to follow; must outlive the session or be detached first
+         */
+        void attach(Project& project);
+
+        /**
+         * @brief Stop following the project; queued edits are dropped
+         */
+        void detach();
+
+        /**
+         * @brief Check whether a project is attached
+         */
+        [[nodiscard]] bool isAttached() const;
+
+        /**
+         * @brief Get the id of this site
+         */
+        [[nodiscard]] uint64_t getSite() const;
+
+        /**
+         * @brief Take the local edits due to be sent
+         *
+         * @param now Current time; edits are held until FLUSH_INTERVAL has passed since the first
+         *            of them, or until MAX_BATCH_OPS are queued
+         * @return std::string DeltaStream payload; empty if nothing is due
+         */
+        [[nodiscard]] std::string takeOutgoing(Clock::time_point now = Clock::now());
+
+        /**
+         * @brief Check whether local edits are waiting to be sent
+         */
+        [[nodiscard]] bool hasOutgoing() const;
+
+        /**
+         * @brief Queue a batch of another site
+         *
+         * @param payload DeltaStream payload
+         * @throws Exceptions::project_format_exception if the payload is malformed
+         */
+        void receive(std::string_view payload);
+
+        /**
+         * @brief Apply queued remote edits to the project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Consecutive creations and removals of one kind go through the
+         * project's bulk APIs. Does nothing while no project is attached.
+         *
+         * @param maxOps Edits to look at before returning
+         * @return size_t Edits looked at, applied or discarded
+         */
+        size_t applyRemote(size_t maxOps = APPLY_BUDGET_OPS);
+
+        /**
+         * @brief Get the number of remote edits waiting for applyRemote()
+         */
+        [[nodiscard]] size_t getPendingRemoteOps() const;
+
+        /**
+         * @brief Get the counters since the session was created
+         */
+        [[nodiscard]] const SyncStats& getStats() const;
+
+    private:
+        /**
+         * @brief Order of the edits to one register; later wins
+         */
+        struct Version {
+            uint64_t clock = 0;
+            uint64_t site = 0;
+
+            auto operator<=>(const Version&) const = default;
+        };
+
+        /**
+         * @brief Latest addition or removal of an entity
+         */
+        struct Presence {
+            Version version;
+            bool removed = false;
+        };
+
+        /**
+         * @brief A received batch, consumed from the front
+         */
+        struct Inbound {
+            DeltaBatch batch;
+            size_t next = 0;    ///< First op not applied yet
+        };
+
+        /**
+         * @brief Record a local edit, merging it into a queued edit of the same register
+         */
+        void queue(DeltaOp op);
+
+        void onPropertyChanged(EntityHandle handle, const Inspector::PropertyChangedEvent& event);
+        void onMembershipChanged(const Entities::BaseEntity& entity, bool added);
+
+        /**
+         * @brief Apply a run of consecutive creations of one kind
+         */
+        void applyCreates(std::span<const DeltaOp> ops, uint64_t site);
+
+        /**
+         * @brief Apply a run of consecutive removals of one kind
+         */
+        void applyRemoves(std::span<const DeltaOp> ops, uint64_t site);
+
+        void applySet(const DeltaOp& op, uint64_t site);
+
+        /**
+         * @brief Check a remote edit against the entity's latest removal and register version
+         * @return bool True if the edit is the newest and was recorded as such
+         */
+        bool accept(const std::string& key, const std::string& entityKey, Version version);
+
+        /**
+         * @brief Check whether a site's entity was rejected for clashing with one here
+         */
+        [[nodiscard]] bool isConflicting(const std::string& entityKey, uint64_t site) const;
+
+        Entities::BaseEntity* find(EntityKind kind, std::string_view id) const;
+
+        Project* m_project = nullptr;
+        uint64_t m_site;
+        uint64_t m_clock = 0;                                       ///< Lamport clock
+        bool m_applying = false;                                    ///< Set while remote edits reach the project
+        std::vector<Inspector::SubscriptionHandle> m_subscriptions;
+        Inspector::SubscriptionHandle m_membershipSubscription = 0;
+
+        std::vector<DeltaOp> m_outgoing;                            ///< Local edits not sent yet
+        std::unordered_map<std::string, size_t> m_outgoingIndex;    ///< Register key → position in m_outgoing
+        Clock::time_point m_firstOutgoing;                          ///< When the oldest of m_outgoing was made
+
+        std::deque<Inbound> m_inbound;
+        size_t m_pendingRemoteOps = 0;
+
+        std::unordered_map<std::string, Version> m_versions;        ///< Register key → latest edit seen
+        std::unordered_map<std::string, Presence> m_presence;       ///< Entity key → latest addition or removal seen
+        std::unordered_set<std::string> m_conflicts;                ///< Conflict keys of rejected remote creations
+        SyncStats m_stats;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_SYNC_SESSION_H
@@ -0,0 +1,355 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file TextBuffer.cpp
+ * @brief Implementation of the piece-table text buffer
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "TextBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace ADS::Core {
+
+    namespace {
+        template<typename NodeT>
+        size_t lengthOf(const std::shared_ptr<const NodeT>& node) {
+            return node ? node->length : 0;
+        }
+
+        template<typename NodeT>
+        size_t breaksOf(const std::shared_ptr<const NodeT>& node) {
+            return node ? node->breaks : 0;
+        }
+
+        template<typename NodeT>
+        size_t countOf(const std::shared_ptr<const NodeT>& node) {
+            return node ? node->count : 0;
+        }
+
+        std::atomic<uint64_t> bufferSeed{0};        ///< See TextBuffer::setSeed()
+        std::atomic<uint64_t> buffersSeeded{0};     ///< Buffers created since, so each gets its own seed
+
+        uint64_t nextBufferSeed() {
+            const uint64_t seed = bufferSeed.load(std::memory_order_relaxed);
+            if (seed == 0) {
+                return std::random_device{}();
+            }
+            return seed + buffersSeeded.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B97F4A7C15ull;
+        }
+    }
+
+    void TextBuffer::setSeed(const uint64_t seed) {
+        bufferSeed.store(seed, std::memory_order_relaxed);
+        buffersSeeded.store(0, std::memory_order_relaxed);
+    }
+
+    TextBuffer::Snapshot::Snapshot(NodePtr root)
+        : m_root(std::move(root)) {
+    }
+
+    void TextBuffer::Store::append(const std::string_view data) {
+        const size_t base = text.size();
+        text.append(data);
+        for (size_t index = 0; index < data.size(); ++index) {
+            if (data[index] == '\n') {
+                breaks.push_back(base + index);
+            }
+        }
+    }
+
+    TextBuffer::TextBuffer()
+        : m_random(static_cast<std::minstd_rand::result_type>(nextBufferSeed())) {
+    }
+
+    TextBuffer::TextBuffer(std::string text)
+        : TextBuffer() {
+        m_original.append(text);
+        if (!text.empty()) {
+            m_root = make(nullptr, makePiece(false, 0, text.size()), nullptr, m_random());
+        }
+    }
+
+    void TextBuffer::assign(std::string text) {
+        // Pieces of old snapshots may point anywhere in the buffers: keep them
+        const size_t start = m_added.text.size();
+        m_added.append(text);
+        m_root = text.empty() ? nullptr : make(nullptr, makePiece(true, start, text.size()), nullptr, m_random());
+    }
+
+    void TextBuffer::insert(size_t offset, const std::string_view text) {
+        if (text.empty()) {
+            return;
+        }
+        offset = std::min(offset, getLength());
+
+        const size_t start = m_added.text.size();
+        const size_t breaksBefore = m_added.breaks.size();
+        m_added.append(text);
+        const size_t breaks = m_added.breaks.size() - breaksBefore;
+
+        auto [left, right] = split(m_root, offset);
+
+        // Typing continues the previous insertion when it ends where the added buffer did
+        const Node* last = left.get();
+        while (last != nullptr && last->right) {
+            last = last->right.get();
+        }
+        if (last != nullptr && last->piece.added && last->piece.start + last->piece.length == start) {
+            m_root = merge(extendLast(left, text.size(), breaks), right);
+            return;
+        }
+
+        const Piece piece{true, start, text.size(), breaks};
+        m_root = merge(merge(left, make(nullptr, piece, nullptr, m_random())), right);
+    }
+
+    void TextBuffer::erase(size_t offset, size_t count) {
+        const size_t length = getLength();
+        offset = std::min(offset, length);
+        count = std::min(count, length - offset);
+        if (count == 0) {
+            return;
+        }
+
+        auto [left, rest] = split(m_root, offset);
+        auto [removed, right] = split(rest, count);
+        m_root = merge(left, right);
+    }
+
+    size_t TextBuffer::getLength() const {
+        return lengthOf(m_root);
+    }
+
+    size_t TextBuffer::getLineCount() const {
+        return breaksOf(m_root) + 1;
+    }
+
+    size_t TextBuffer::getLineStart(size_t line) const {
+        line = std::min(line, getLineCount() - 1);
+        if (line == 0) {
+            return 0;
+        }
+
+        // Find the line-th break; the line starts right after it
+        size_t wanted = line;
+        size_t base = 0;
+        const Node* node = m_root.get();
+        while (node != nullptr) {
+            const size_t leftBreaks = breaksOf(node->left);
+            if (wanted <= leftBreaks) {
+                node = node->left.get();
+                continue;
+            }
+            wanted -= leftBreaks;
+            base += lengthOf(node->left);
+
+            const Piece& piece = node->piece;
+            if (wanted <= piece.breaks) {
+                const std::vector<size_t>& breaks = storeOf(piece).breaks;
+                const auto first = std::lower_bound(breaks.begin(), breaks.end(), piece.start);
+                return base + (*(first + static_cast<std::ptrdiff_t>(wanted - 1)) - piece.start) + 1;
+            }
+            wanted -= piece.breaks;
+            base += piece.length;
+            node = node->right.get();
+        }
+
+        return getLength();
+    }
+
+    size_t TextBuffer::getLineEnd(size_t line) const {
+        line = std::min(line, getLineCount() - 1);
+        return (line + 1 < getLineCount()) ? getLineStart(line + 1) - 1 : getLength();
+    }
+
+    size_t TextBuffer::getLineOf(size_t offset) const {
+        offset = std::min(offset, getLength());
+
+        // Count the breaks before offset
+        size_t line = 0;
+        const Node* node = m_root.get();
+        while (node != nullptr) {
+            const size_t leftLength = lengthOf(node->left);
+            if (offset < leftLength) {
+                node = node->left.get();
+                continue;
+            }
+            offset -= leftLength;
+            line += breaksOf(node->left);
+
+            const Piece& piece = node->piece;
+            if (offset < piece.length) {
+                const std::vector<size_t>& breaks = storeOf(piece).breaks;
+                return line + static_cast<size_t>(
+                    std::lower_bound(breaks.begin(), breaks.end(), piece.start + offset) -
+                    std::lower_bound(breaks.begin(), breaks.end(), piece.start));
+            }
+            offset -= piece.length;
+            line += piece.breaks;
+            node = node->right.get();
+        }
+
+        return line;
+    }
+
+    char TextBuffer::at(size_t offset) const {
+        const Node* node = m_root.get();
+        while (node != nullptr) {
+            const size_t leftLength = lengthOf(node->left);
+            if (offset < leftLength) {
+                node = node->left.get();
+                continue;
+            }
+            offset -= leftLength;
+            if (offset < node->piece.length) {
+                return storeOf(node->piece).text[node->piece.start + offset];
+            }
+            offset -= node->piece.length;
+            node = node->right.get();
+        }
+
+        return '\0';
+    }
+
+    void TextBuffer::copyTo(const size_t offset, const size_t count, std::string& out) const {
+        const size_t length = getLength();
+        if (offset >= length || count == 0) {
+            return;
+        }
+        out.reserve(out.size() + std::min(count, length - offset));
+        copyRange(m_root.get(), offset, offset + std::min(count, length - offset), out);
+    }
+
+    std::string TextBuffer::toString() const {
+        std::string text;
+        copyTo(0, getLength(), text);
+        return text;
+    }
+
+    size_t TextBuffer::getPieceCount() const {
+        return countOf(m_root);
+    }
+
+    TextBuffer::Snapshot TextBuffer::snapshot() const {
+        return Snapshot(m_root);
+    }
+
+    void TextBuffer::restore(const Snapshot& state) {
+        m_root = state.m_root;
+    }
+
+    const TextBuffer::Store& TextBuffer::storeOf(const Piece& piece) const {
+        return piece.added ? m_added : m_original;
+    }
+
+    TextBuffer::Piece TextBuffer::makePiece(const bool added, const size_t start, const size_t length) const {
+        const std::vector<size_t>& breaks = (added ? m_added : m_original).breaks;
+        const auto first = std::lower_bound(breaks.begin(), breaks.end(), start);
+        const auto last = std::lower_bound(first, breaks.end(), start + length);
+        return {added, start, length, static_cast<size_t>(last - first)};
+    }
+
+    TextBuffer::NodePtr TextBuffer::make(NodePtr left, const Piece& piece, NodePtr right,
+                                         const uint32_t priority) const {
+        auto node = std::make_shared<Node>();
+        node->length = lengthOf(left) + piece.length + lengthOf(right);
+        node->breaks = breaksOf(left) + piece.breaks + breaksOf(right);
+        node->count = countOf(left) + 1 + countOf(right);
+        node->left = std::move(left);
+        node->right = std::move(right);
+        node->piece = piece;
+        node->priority = priority;
+        return node;
+    }
+
+    std::pair<TextBuffer::NodePtr, TextBuffer::NodePtr> TextBuffer::split(const NodePtr& node,
+                                                                          const size_t offset) const {
+        if (!node) {
+            return {nullptr, nullptr};
+        }
+
+        const size_t leftLength = lengthOf(node->left);
+        const Piece& piece = node->piece;
+
+        if (offset <= leftLength) {
+            auto [left, right] = split(node->left, offset);
+            return {left, make(right, piece, node->right, node->priority)};
+        }
+        if (offset >= leftLength + piece.length) {
+            auto [left, right] = split(node->right, offset - leftLength - piece.length);
+            return {make(node->left, piece, left, node->priority), right};
+        }
+
+        // The cut falls inside this piece: each half keeps one side of the subtree
+        const size_t cut = offset - leftLength;
+        const Piece head = makePiece(piece.added, piece.start, cut);
+        const Piece tail{piece.added, piece.start + cut, piece.length - cut, piece.breaks - head.breaks};
+        return {make(node->left, head, nullptr, node->priority), make(nullptr, tail, node->right, node->priority)};
+    }
+
+    TextBuffer::NodePtr TextBuffer::merge(const NodePtr& left, const NodePtr& right) const {
+        if (!left) {
+            return right;
+        }
+        if (!right) {
+            return left;
+        }
+
+        if (left->priority > right->priority) {
+            return make(left->left, left->piece, merge(left->right, right), left->priority);
+        }
+        return make(merge(left, right->left), right->piece, right->right, right->priority);
+    }
+
+    TextBuffer::NodePtr TextBuffer::extendLast(const NodePtr& node, const size_t extra,
+                                               const size_t extraBreaks) const {
+        if (node->right) {
+            return make(node->left, node->piece, extendLast(node->right, extra, extraBreaks), node->priority);
+        }
+
+        Piece piece = node->piece;
+        piece.length += extra;
+        piece.breaks += extraBreaks;
+        return make(node->left, piece, nullptr, node->priority);
+    }
+
+    void TextBuffer::copyRange(const Node* node, size_t from, size_t to, std::string& out) const {
+        while (node != nullptr && from < to) {
+            const size_t leftLength = lengthOf(node->left);
+            if (from < leftLength) {
+                copyRange(node->left.get(), from, std::min(to, leftLength), out);
+            }
+
+            const size_t pieceEnd = leftLength + node->piece.length;
+            if (from < pieceEnd && to > leftLength) {
+                const size_t begin = std::max(from, leftLength) - leftLength;
+                const size_t end = std::min(to, pieceEnd) - leftLength;
+                out.append(storeOf(node->piece).text, node->piece.start + begin, end - begin);
+            }
+
+            if (to <= pieceEnd) {
+                return;
+            }
+            // Continue in the right subtree without recursing
+            from = (from > pieceEnd) ? from - pieceEnd : 0;
+            to -= pieceEnd;
+            node = node->right.get();
+        }
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,252 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_TEXT_BUFFER_H
+#define ADS_CORE_TEXT_BUFFER_H
+
+/**
+ * @file TextBuffer.h
+ * @brief Piece-table document model for the script editor
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Editable text stored as a piece table
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The text is never moved once stored: the loaded text stays in the
+     * original buffer, typed text is appended to the added buffer, and the
+     * document is the sequence of pieces (ranges of either buffer) kept in
+     * a treap ordered by position. Every node knows the length and line
+     * breaks of its subtree, so edits and the position and line lookups
+     * are O(log n) whatever the size of the script.
+     *
+     * Nodes are immutable and shared: an edit copies only the path it
+     * changes, so snapshot() is a pointer copy and an undo history keeps
+     * just the nodes that differ between its states.
+     *
+     * Offsets are in bytes of UTF-8 text; lines are split at '\n'.
+     *
+     * @note Not thread-safe; snapshots are restored into the buffer they came from
+     */
+    class TextBuffer {
+        struct Node;
+        using NodePtr = std::shared_ptr<const Node>;
+
+    public:
+        /**
+         * @brief Saved state of the document, for undo
+         */
+        class Snapshot {
+        public:
+            Snapshot() = default;
+
+        private:
+            friend class TextBuffer;
+
+            explicit Snapshot(NodePtr root);
+
+            NodePtr m_root;
+        };
+
+        TextBuffer();
+
+        /**
+         * @brief Create a document holding a text
+         *
+         * @param text Initial content; kept as a single piece
+         */
+        explicit TextBuffer(std::string text);
+
+        /**
+         * @brief Seed the tree shapes of the buffers created from now on
+         *
+         * Node priorities are random, so the same edits give a tree of
+         * another shape, and another cost, on every run. A replayed
+         * session sets the seed it was recorded with to repeat them.
+         *
+         * @param seed Seed; 0 for a random one per buffer, the default
+         */
+        static void setSeed(uint64_t seed);
+
+        /**
+         * @brief Insert text
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Text typed right after the previous insertion extends that piece
+         * instead of adding one, so typing does not grow the tree.
+         *
+         * @param offset Position, clamped to the length
+         * @param text   Text to insert
+         */
+        void insert(size_t offset, std::string_view text);
+
+        /**
+         * @brief Remove text
+         *
+         * @param offset Start of the removed range, clamped to the length
+         * @param count  Bytes to remove, clamped to the end of the text
+         */
+        void erase(size_t offset, size_t count);
+
+        /**
+         * @brief Replace the whole text
+         *
+         * @param text New content; old snapshots stay restorable
+         */
+        void assign(std::string text);
+
+        /**
+         * @brief Get the length of the text
+         * @return size_t Bytes
+         */
+        [[nodiscard]] size_t getLength() const;
+
+        /**
+         * @brief Get the number of lines
+         * @return size_t Line breaks plus one
+         */
+        [[nodiscard]] size_t getLineCount() const;
+
+        /**
+         * @brief Get the offset where a line starts
+         *
+         * @param line Line index, clamped to the last line
+         * @return size_t Offset of its first byte
+         */
+        [[nodiscard]] size_t getLineStart(size_t line) const;
+
+        /**
+         * @brief Get the offset where a line ends
+         *
+         * @param line Line index, clamped to the last line
+         * @return size_t Offset of its '\n', or the length for the last line
+         */
+        [[nodiscard]] size_t getLineEnd(size_t line) const;
+
+        /**
+         * @brief Get the line holding an offset
+         *
+         * @param offset Position, clamped to the length
+         * @return size_t Line index
+         */
+        [[nodiscard]] size_t getLineOf(size_t offset) const;
+
+        /**
+         * @brief Get one byte of the text
+         *
+         * @param offset Position, less than the length
+         * @return char Byte at offset, '\0' past the end
+         */
+        [[nodiscard]] char at(size_t offset) const;
+
+        /**
+         * @brief Append a range of the text to a string
+         *
+         * @param offset Start of the range
+         * @param count  Bytes to copy, clamped to the end of the text
+         * @param out    String the bytes are appended to
+         */
+        void copyTo(size_t offset, size_t count, std::string& out) const;
+
+        /**
+         * @brief Get the whole text
+         * @return std::string Copy of the document
+         */
+        [[nodiscard]] std::string toString() const;
+
+        /**
+         * @brief Get the number of pieces
+         * @return size_t Nodes in the tree
+         */
+        [[nodiscard]] size_t getPieceCount() const;
+
+        /**
+         * @brief Save the current state; O(1)
+         * @return Snapshot State to give to restore()
+         */
+        [[nodiscard]] Snapshot snapshot() const;
+
+        /**
+         * @brief Go back to a saved state; O(1)
+         *
+         * @param state Snapshot taken from this buffer
+         */
+        void restore(const Snapshot& state);
+
+    private:
+        /**
+         * @brief Range of one of the two buffers
+         */
+        struct Piece {
+            bool added;         ///< In m_added, otherwise in m_original
+            size_t start;
+            size_t length;
+            size_t breaks;      ///< Line breaks in the range
+        };
+
+        /**
+         * @brief Treap node: a piece and the totals of its subtree
+         */
+        struct Node {
+            NodePtr left;
+            NodePtr right;
+            Piece piece;
+            uint32_t priority;
+            size_t length;      ///< Bytes in the subtree
+            size_t breaks;      ///< Line breaks in the subtree
+            size_t count;       ///< Pieces in the subtree
+        };
+
+        /**
+         * @brief Text and line-break positions of one buffer
+         */
+        struct Store {
+            std::string text;
+            std::vector<size_t> breaks;     ///< Offsets of every '\n', ascending
+
+            void append(std::string_view data);
+        };
+
+        Store m_original;
+        Store m_added;
+        NodePtr m_root;
+        std::minstd_rand m_random;
+
+        [[nodiscard]] const Store& storeOf(const Piece& piece) const;
+        [[nodiscard]] Piece makePiece(bool added, size_t start, size_t length) const;
+        NodePtr make(NodePtr left, const Piece& piece, NodePtr right, uint32_t priority) const;
+        std::pair<NodePtr, NodePtr> split(const NodePtr& node, size_t offset) const;
+        NodePtr merge(const NodePtr& left, const NodePtr& right) const;
+        NodePtr extendLast(const NodePtr& node, size_t extra, size_t extraBreaks) const;
+        void copyRange(const Node* node, size_t from, size_t to, std::string& out) const;
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_TEXT_BUFFER_H
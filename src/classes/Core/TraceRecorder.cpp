@@ -0,0 +1,243 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file TraceRecorder.cpp
+ * @brief Implementation of the TraceRecorder class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "Profiling.h"
+
+namespace ADS::Core {
+    namespace {
+        std::atomic<bool> recording{false};
+
+        /**
+         * Reference point of the timestamps
+         */
+        const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+        uint64_t now() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - epoch).count());
+        }
+    }
+
+    /**
+     * @brief Every ring ever created, in thread creation order
+     */
+    struct TraceRecorder::Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        std::vector<ThreadBuffer*> released;        ///< Rings of threads that exited, reused by new threads
+    };
+
+    thread_local TraceRecorder::ThreadBuffer* TraceRecorder::m_buffer = nullptr;
+    thread_local const char* TraceRecorder::m_threadName = nullptr;
+
+    TraceRecorder::Registry& TraceRecorder::registry() {
+        // Never destroyed: threads still running while the program exits
+        // may record after static destructors have run
+        static Registry* instance = new Registry();
+        return *instance;
+    }
+
+    TraceRecorder::Scope::Scope(const char* name)
+        : m_name(nullptr) {
+        if (isEnabled()) {
+            m_name = name;
+            record(EventType::Begin, name, 0);
+        }
+    }
+
+    TraceRecorder::Scope::~Scope() {
+        if (m_name != nullptr) {
+            record(EventType::End, m_name, 0);
+        }
+    }
+
+    void TraceRecorder::setEnabled(const bool enabled) {
+        recording.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool TraceRecorder::isEnabled() {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    void TraceRecorder::begin(const char* name) {
+        if (isEnabled()) {
+            record(EventType::Begin, name, 0);
+        }
+    }
+
+    void TraceRecorder::end(const char* name) {
+        if (isEnabled()) {
+            record(EventType::End, name, 0);
+        }
+    }
+
+    void TraceRecorder::counter(const char* name, const int64_t value) {
+        ADS_PLOT(name, value);
+        if (isEnabled()) {
+            record(EventType::Counter, name, value);
+        }
+    }
+
+    void TraceRecorder::setThreadName(const char* name) {
+        ADS_THREAD_NAME(name);
+        // Threads that never record get no ring
+        m_threadName = name;
+        if (m_buffer != nullptr) {
+            m_buffer->name.store(name, std::memory_order_relaxed);
+        }
+    }
+
+    TraceRecorder::ThreadBuffer& TraceRecorder::threadBuffer() {
+        if (m_buffer == nullptr) {
+            // Hands the ring over to a later thread when this one exits, so short-lived
+            // threads such as background saves do not each keep one
+            struct Release {
+                ~Release() {
+                    Registry& all = registry();
+                    std::lock_guard lock(all.mutex);
+                    all.released.push_back(m_buffer);
+                    m_buffer = nullptr;
+                }
+            };
+
+            Registry& all = registry();
+            std::unique_lock lock(all.mutex);
+            if (!all.released.empty()) {
+                // Its events stay, under the same thread id
+                m_buffer = all.released.back();
+                all.released.pop_back();
+            } else {
+                auto created = std::make_unique<ThreadBuffer>();
+                created->id = static_cast<uint32_t>(all.buffers.size());
+                created->head.store(0, std::memory_order_relaxed);
+                m_buffer = created.get();
+                all.buffers.push_back(std::move(created));
+            }
+            m_buffer->name.store(m_threadName, std::memory_order_relaxed);
+            lock.unlock();
+            thread_local Release release;
+        }
+        return *m_buffer;
+    }
+
+    void TraceRecorder::record(const EventType type, const char* name, const int64_t value) {
+        ThreadBuffer& buffer = threadBuffer();
+        const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        Event& event = buffer.events[head % EVENTS_PER_THREAD];
+        event.timestamp.store(now(), std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        event.value.store(value, std::memory_order_relaxed);
+        event.type.store(type, std::memory_order_relaxed);
+        // Publishes the event to a concurrent writeChromeTrace()
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void TraceRecorder::writeChromeTrace(std::ostream& out) {
+        Registry& all = registry();
+        std::lock_guard lock(all.mutex);
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        bool first = true;
+        const auto separator = [&]() -> std::ostream& {
+            out << (first ? "" : ",\n");
+            first = false;
+            return out;
+        };
+
+        // Event as copied out of a ring
+        struct Snapshot {
+            uint64_t timestamp;
+            const char* name;
+            int64_t value;
+            EventType type;
+        };
+        std::vector<Snapshot> events;
+        for (const std::unique_ptr<ThreadBuffer>& buffer : all.buffers) {
+            if (const char* name = buffer->name.load(std::memory_order_relaxed)) {
+                separator() << std::format(R"({{"ph":"M","name":"thread_name","pid":1,"tid":{},"args":{{"name":{}}}}})",
+                                           buffer->id, nlohmann::json(name).dump());
+            }
+
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+            const uint64_t start = head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0;
+            events.clear();
+            for (uint64_t index = start; index < head; ++index) {
+                const Event& event = buffer->events[index % EVENTS_PER_THREAD];
+                events.push_back({event.timestamp.load(std::memory_order_relaxed),
+                                  event.name.load(std::memory_order_relaxed),
+                                  event.value.load(std::memory_order_relaxed),
+                                  event.type.load(std::memory_order_relaxed)});
+            }
+
+            // The writer may have lapped the oldest events while they were copied;
+            // the one at index `after` may be half written over index `after - size`
+            const uint64_t after = buffer->head.load(std::memory_order_acquire);
+            const uint64_t valid = after >= EVENTS_PER_THREAD ? after - EVENTS_PER_THREAD + 1 : 0;
+            const size_t skip = valid > start ? static_cast<size_t>(std::min(valid - start, head - start)) : 0;
+
+            size_t depth = 0;
+            for (size_t index = skip; index < events.size(); ++index) {
+                const Snapshot& event = events[index];
+                const double microseconds = static_cast<double>(event.timestamp) / 1000.0;
+                const std::string name = nlohmann::json(event.name).dump();
+                switch (event.type) {
+                    case EventType::Begin:
+                        ++depth;
+                        separator() << std::format(R"({{"ph":"B","name":{},"pid":1,"tid":{},"ts":{:.3f}}})",
+                                                   name, buffer->id, microseconds);
+                        break;
+                    case EventType::End:
+                        // Its begin was overwritten
+                        if (depth == 0) {
+                            break;
+                        }
+                        --depth;
+                        separator() << std::format(R"({{"ph":"E","name":{},"pid":1,"tid":{},"ts":{:.3f}}})",
+                                                   name, buffer->id, microseconds);
+                        break;
+                    case EventType::Counter:
+                        separator() << std::format(R"({{"ph":"C","name":{},"pid":1,"tid":{},"ts":{:.3f},"args":{{"value":{}}}}})",
+                                                   name, buffer->id, microseconds, event.value);
+                        break;
+                }
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    bool TraceRecorder::writeChromeTrace(const std::filesystem::path& path) {
+        std::ofstream out(path, std::ios::trunc);
+        writeChromeTrace(out);
+        return static_cast<bool>(out);
+    }
+}
@@ -0,0 +1,197 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_TRACE_RECORDER_H
+#define ADS_CORE_TRACE_RECORDER_H
+
+/**
+ * @file TraceRecorder.h
+ * @brief Binary per-thread event trace, written out as Chrome trace JSON
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+
+namespace ADS::Core {
+
+    /**
+     * @brief Records begin/end events and counters of the hot paths
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each thread writes fixed-size binary events into a ring buffer of its
+     * own, so recording takes no lock and formats nothing: a timestamp, a
+     * pointer to a static name and a value. Once a ring is full the oldest
+     * events are overwritten. writeChromeTrace() turns what the rings hold
+     * into the Chrome trace event format, which chrome://tracing and
+     * Perfetto open, and can be called at any time while threads record.
+     *
+     * Off by default; while off, a Scope costs one relaxed atomic load.
+     *
+     * @note Names are stored as pointers and must be string literals or
+     *       otherwise live until the trace is written
+     */
+    class TraceRecorder {
+    public:
+        static constexpr size_t EVENTS_PER_THREAD = 16384;     ///< Ring size; 512 KiB per recording thread
+
+        /**
+         * @brief Records the enclosing block as a begin/end pair
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The end is recorded only if the begin was, so switching the
+         * recorder on or off inside a scope leaves no half pair.
+         */
+        class Scope {
+        public:
+            /**
+             * @param name Event name; a string literal
+             */
+            explicit Scope(const char* name);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            const char* m_name;     ///< nullptr if the begin was not recorded
+        };
+
+        /**
+         * @brief Start or stop recording
+         *
+         * Events already recorded are kept.
+         */
+        static void setEnabled(bool enabled);
+
+        /**
+         * @brief Check whether events are being recorded
+         */
+        [[nodiscard]] static bool isEnabled();
+
+        /**
+         * @brief Record the start of a span on the calling thread
+         */
+        static void begin(const char* name);
+
+        /**
+         * @brief Record the end of the span opened last on the calling thread
+         */
+        static void end(const char* name);
+
+        /**
+         * @brief Record the value of a counter
+         *
+         * Also a Tracy plot in ADS_ENABLE_TRACY builds, recording or not.
+         *
+         * @param name  Counter name; a string literal
+         * @param value Value from now on, until the next sample
+         */
+        static void counter(const char* name, int64_t value);
+
+        /**
+         * @brief Name the calling thread in the trace
+         *
+         * And in Tracy, in ADS_ENABLE_TRACY builds.
+         *
+         * @param name Thread name; a string literal
+         */
+        static void setThreadName(const char* name);
+
+        /**
+         * @brief Write the recorded events as Chrome trace JSON
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Events overwritten while the rings are read are left out, as are
+         * ends whose begin was already overwritten.
+         *
+         * @param out Stream written to
+         */
+        static void writeChromeTrace(std::ostream& out);
+
+        /**
+         * @brief Write the recorded events to a Chrome trace file
+         *
+         * @param path File to create or replace
+         * @return bool False if the file could not be written
+         */
+        static bool writeChromeTrace(const std::filesystem::path& path);
+
+    private:
+        /**
+         * @brief Kind of a recorded event
+         */
+        enum class EventType : uint8_t {
+            Begin,
+            End,
+            Counter
+        };
+
+        /**
+         * @brief One recorded event; atomic fields so a concurrent dump reads no torn value
+         */
+        struct Event {
+            std::atomic<uint64_t> timestamp;    ///< Nanoseconds since the program started
+            std::atomic<const char*> name;
+            std::atomic<int64_t> value;         ///< Counter value, 0 otherwise
+            std::atomic<EventType> type;
+        };
+
+        /**
+         * @brief Events of one thread
+         */
+        struct ThreadBuffer {
+            uint32_t id;                                    ///< Thread id in the trace
+            std::atomic<const char*> name;                  ///< nullptr until setThreadName()
+            std::atomic<uint64_t> head;                     ///< Events written so far; the next goes to head % EVENTS_PER_THREAD
+            std::array<Event, EVENTS_PER_THREAD> events;
+        };
+
+        /**
+         * @brief Every ring created so far, see TraceRecorder.cpp
+         */
+        struct Registry;
+
+        static thread_local ThreadBuffer* m_buffer;         ///< Ring of this thread, nullptr until it records
+        static thread_local const char* m_threadName;       ///< Name given before the ring existed
+
+        /**
+         * @brief Get the registry of rings
+         */
+        static Registry& registry();
+
+        /**
+         * @brief Get the ring of the calling thread, creating it on first use
+         */
+        static ThreadBuffer& threadBuffer();
+
+        /**
+         * @brief Append an event to the ring of the calling thread
+         */
+        static void record(EventType type, const char* name, int64_t value);
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_TRACE_RECORDER_H
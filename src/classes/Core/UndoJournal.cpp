@@ -0,0 +1,509 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file UndoJournal.cpp
+ * @brief Implementation of the delta-encoded undo/redo journal
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "UndoJournal.h"
+
+#include <algorithm>
+
+#include "AllocationCounter.h"
+#include "Project.h"
+
+namespace ADS::Core {
+
+    /**
+     * @brief Store a vector value in the first two inline floats
+     */
+    static void storeVector2(float (&out)[4], const ImVec2& value) {
+        out[0] = value.x;
+        out[1] = value.y;
+    }
+
+    /**
+     * @brief Store a colour value in the four inline floats
+     */
+    static void storeColor(float (&out)[4], const ImVec4& value) {
+        out[0] = value.x;
+        out[1] = value.y;
+        out[2] = value.z;
+        out[3] = value.w;
+    }
+
+    UndoJournal::UndoJournal(size_t budgetBytes)
+        : m_budgetBytes(budgetBytes) {
+    }
+
+    uint16_t UndoJournal::intern(const std::string_view propertyId) {
+        if (const auto it = m_propertyIndex.find(propertyId); it != m_propertyIndex.end()) {
+            return it->second;
+        }
+        const auto index = static_cast<uint16_t>(m_propertyNames.size());
+        m_propertyNames.emplace_back(propertyId);
+        m_propertyIndex.emplace(propertyId, index);
+        return index;
+    }
+
+    /**
+     * @brief Encode a value pair into step, appending text to the arena
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Both values must hold the same alternative. Text is reduced to the
+     * part between the longest common prefix and the longest common suffix
+     * that do not overlap.
+     *
+     * @param step     Step whose type and payload are filled in
+     * @param oldValue Value before the change
+     * @param newValue Value after the change
+     * @return bool False if the values are of an unsupported type
+     */
+    bool UndoJournal::encode(Step& step, const Inspector::PropertyValue& oldValue, const Inspector::PropertyValue& newValue) {
+        if (oldValue.index() != newValue.index()) {
+            return false;
+        }
+
+        if (const auto* oldText = std::get_if<std::string>(&oldValue)) {
+            const std::string& newText = std::get<std::string>(newValue);
+            const size_t shorter = std::min(oldText->size(), newText.size());
+
+            size_t prefix = 0;
+            while (prefix < shorter && (*oldText)[prefix] == newText[prefix]) {
+                ++prefix;
+            }
+            size_t suffix = 0;
+            while (suffix < shorter - prefix
+                   && (*oldText)[oldText->size() - 1 - suffix] == newText[newText.size() - 1 - suffix]) {
+                ++suffix;
+            }
+
+            step.type = ValueType::Text;
+            step.text.offset = static_cast<uint32_t>(m_arena.size());
+            step.text.prefix = static_cast<uint32_t>(prefix);
+            step.text.oldLength = static_cast<uint32_t>(oldText->size() - prefix - suffix);
+            step.text.newLength = static_cast<uint32_t>(newText.size() - prefix - suffix);
+            m_arena.append(*oldText, prefix, step.text.oldLength);
+            m_arena.append(newText, prefix, step.text.newLength);
+            return true;
+        }
+
+        return std::visit([&step](const auto& before, const auto& after) -> bool {
+            using T = std::decay_t<decltype(before)>;
+            using U = std::decay_t<decltype(after)>;
+            if constexpr (!std::is_same_v<T, U>) {
+                return false;
+            } else if constexpr (std::is_same_v<T, bool>) {
+                step.type = ValueType::Bool;
+                step.scalar.oldValue.b = before;
+                step.scalar.newValue.b = after;
+                return true;
+            } else if constexpr (std::is_same_v<T, int>) {
+                step.type = ValueType::Int;
+                step.scalar.oldValue.i = before;
+                step.scalar.newValue.i = after;
+                return true;
+            } else if constexpr (std::is_same_v<T, float>) {
+                step.type = ValueType::Float;
+                step.scalar.oldValue.f[0] = before;
+                step.scalar.newValue.f[0] = after;
+                return true;
+            } else if constexpr (std::is_same_v<T, ImVec2>) {
+                step.type = ValueType::Vector2;
+                storeVector2(step.scalar.oldValue.f, before);
+                storeVector2(step.scalar.newValue.f, after);
+                return true;
+            } else if constexpr (std::is_same_v<T, ImVec4>) {
+                step.type = ValueType::Color;
+                storeColor(step.scalar.oldValue.f, before);
+                storeColor(step.scalar.newValue.f, after);
+                return true;
+            } else if constexpr (std::is_same_v<T, Inspector::EnumValue>) {
+                // Options are static per property; only the selection changes
+                step.type = ValueType::Enum;
+                step.scalar.oldValue.i = before.selectedIndex;
+                step.scalar.newValue.i = after.selectedIndex;
+                return true;
+            } else {
+                return false;
+            }
+        }, oldValue, newValue);
+    }
+
+    Inspector::PropertyValue UndoJournal::decode(const Step& step, const Inspector::PropertyValue& current, bool old) const {
+        const InlineValue& value = old ? step.scalar.oldValue : step.scalar.newValue;
+        switch (step.type) {
+            case ValueType::Bool:
+                return value.b;
+            case ValueType::Int:
+                return value.i;
+            case ValueType::Float:
+                return value.f[0];
+            case ValueType::Vector2:
+                return ImVec2(value.f[0], value.f[1]);
+            case ValueType::Color:
+                return ImVec4(value.f[0], value.f[1], value.f[2], value.f[3]);
+            case ValueType::Enum: {
+                const auto* options = std::get_if<Inspector::EnumValue>(&current);
+                return Inspector::EnumValue(value.i, options ? options->options : nullptr);
+            }
+            case ValueType::Text: {
+                // Undo swaps the new middle for the old one, redo the reverse
+                const auto* text = std::get_if<std::string>(&current);
+                const uint32_t replaced = old ? step.text.newLength : step.text.oldLength;
+                if (text == nullptr || text->size() < step.text.prefix + replaced) {
+                    return std::monostate{};
+                }
+                const std::string_view middle = old
+                    ? std::string_view(m_arena).substr(step.text.offset, step.text.oldLength)
+                    : std::string_view(m_arena).substr(step.text.offset + step.text.oldLength, step.text.newLength);
+                std::string result = *text;
+                result.replace(step.text.prefix, replaced, middle);
+                return result;
+            }
+            case ValueType::Action:
+                break;
+        }
+        return std::monostate{};
+    }
+
+    bool UndoJournal::apply(Project& project, const Step& step, bool old) {
+        if (step.type == ValueType::Action) {
+            const Action& action = m_actions[step.action];
+            m_applying = true;
+            (old ? action.undo : action.redo)(project);
+            m_applying = false;
+            return true;
+        }
+
+        Entities::BaseEntity* entity = project.resolve(step.entity);
+        if (entity == nullptr) {
+            return false;
+        }
+        const std::string& propertyId = m_propertyNames[step.property];
+        const Inspector::PropertyValue value = decode(step, entity->getPropertyValue(propertyId), old);
+        if (std::holds_alternative<std::monostate>(value)) {
+            return false;
+        }
+
+        m_applying = true;
+        const bool applied = entity->setPropertyValue(propertyId, value);
+        m_applying = false;
+        return applied;
+    }
+
+    /**
+     * @brief Record a property change as a new step, or merge it into the last one
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A change merges into the last step when it targets the same entity
+     * and property, arrives within MERGE_WINDOW of the previous change and
+     * breakMerge() was not called in between. Bool and enum changes never
+     * merge, since each click is a deliberate step. Merging text rebuilds
+     * the original value from the step's delta and re-encodes it against
+     * the latest value. Inside a group nothing merges; each change becomes
+     * a step joined to the previous one.
+     *
+     * @param entity Handle of the entity that raised the event
+     * @param event  Property change to record
+     * @param now    Time of the change
+     */
+    void UndoJournal::record(EntityHandle entity, const Inspector::PropertyChangedEvent& event, Clock::time_point now) {
+        if (m_applying || m_paused) {
+            return;
+        }
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Undo);
+        truncateRedo();
+        m_groupMergeOpen = m_grouping && m_groupMergeOpen;
+
+        const uint16_t property = intern(event.propertyId);
+        if (!m_grouping && m_mergeOpen && !m_steps.empty() && now - m_lastChange <= MERGE_WINDOW) {
+            Step& last = m_steps.back();
+            if (last.entity == entity && last.property == property) {
+                Step merged = last;
+                if (last.type == ValueType::Text) {
+                    const Inspector::PropertyValue original = decode(last, event.oldValue, true);
+                    if (!std::holds_alternative<std::monostate>(original)
+                        && std::holds_alternative<std::string>(event.newValue)) {
+                        m_arena.resize(last.text.offset);
+                        encode(merged, original, event.newValue);
+                        last = merged;
+                        m_lastChange = now;
+                        trim();
+                        return;
+                    }
+                } else if (last.type != ValueType::Bool && last.type != ValueType::Enum
+                           && encode(merged, event.oldValue, event.newValue) && merged.type == last.type) {
+                    last.scalar.newValue = merged.scalar.newValue;
+                    m_lastChange = now;
+                    return;
+                }
+            }
+        }
+
+        Step step{};
+        step.entity = entity;
+        step.property = property;
+        step.joined = m_grouping && m_groupSize > 0;
+        const size_t arenaSize = m_arena.size();
+        if (!encode(step, event.oldValue, event.newValue)) {
+            m_arena.resize(arenaSize);
+            m_mergeOpen = false;
+            return;
+        }
+        m_steps.push_back(step);
+        m_cursor = m_steps.size();
+        m_mergeOpen = !m_grouping;
+        m_lastChange = now;
+        if (m_grouping) {
+            ++m_groupSize;
+        }
+        trim();
+    }
+
+    void UndoJournal::recordAction(Action action) {
+        if (m_applying || m_paused) {
+            return;
+        }
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Undo);
+        truncateRedo();
+        m_groupMergeOpen = false;
+
+        Step step{};
+        step.type = ValueType::Action;
+        step.joined = m_grouping && m_groupSize > 0;
+        step.action = static_cast<uint32_t>(m_actions.size());
+        m_actionBytes += action.bytes;
+        m_actions.push_back(std::move(action));
+        m_steps.push_back(step);
+        m_cursor = m_steps.size();
+        m_mergeOpen = false;
+        if (m_grouping) {
+            ++m_groupSize;
+        }
+        trim();
+    }
+
+    void UndoJournal::beginGroup() {
+        m_grouping = true;
+        m_groupSize = 0;
+        m_mergeOpen = false;
+    }
+
+    void UndoJournal::endGroup(Clock::time_point now) {
+        if (!m_grouping) {
+            return;
+        }
+        AllocationCounter::Scope memory(AllocationCounter::Tag::Undo);
+        m_grouping = false;
+        if (m_groupSize == 0) {
+            return;
+        }
+        if (!mergeGroup(now)) {
+            m_previousGroup = m_steps.size() - m_groupSize;
+        }
+        m_groupMergeOpen = true;
+        m_lastChange = now;
+    }
+
+    /**
+     * @brief Fold the group just closed into the one before it, if it repeats it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The two groups must be adjacent and hold the same entities and
+     * property in the same order, so merging only has to carry the new
+     * values over.
+     *
+     * @param now Time the group closed
+     * @return bool True if the group was merged away
+     */
+    bool UndoJournal::mergeGroup(Clock::time_point now) {
+        const size_t groupStart = m_steps.size() - m_groupSize;
+        if (!m_groupMergeOpen || now - m_lastChange > MERGE_WINDOW
+            || m_previousGroup + m_groupSize != groupStart) {
+            return false;
+        }
+        for (size_t i = 0; i < m_groupSize; ++i) {
+            const Step& previous = m_steps[m_previousGroup + i];
+            const Step& step = m_steps[groupStart + i];
+            if (previous.entity != step.entity || previous.property != step.property || previous.type != step.type
+                || step.type == ValueType::Bool || step.type == ValueType::Enum || step.type == ValueType::Text
+                || step.type == ValueType::Action) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < m_groupSize; ++i) {
+            m_steps[m_previousGroup + i].scalar.newValue = m_steps[groupStart + i].scalar.newValue;
+        }
+        m_steps.resize(groupStart);
+        m_cursor = m_steps.size();
+        return true;
+    }
+
+    bool UndoJournal::undo(Project& project) {
+        m_mergeOpen = false;
+        m_groupMergeOpen = false;
+        while (m_cursor > 0) {
+            bool applied = false;
+            do {
+                --m_cursor;
+                applied = apply(project, m_steps[m_cursor], true) || applied;
+            } while (m_cursor > 0 && m_steps[m_cursor].joined);
+            if (applied) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool UndoJournal::redo(Project& project) {
+        m_mergeOpen = false;
+        m_groupMergeOpen = false;
+        while (m_cursor < m_steps.size()) {
+            bool applied = false;
+            do {
+                applied = apply(project, m_steps[m_cursor++], false) || applied;
+            } while (m_cursor < m_steps.size() && m_steps[m_cursor].joined);
+            if (applied) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void UndoJournal::breakMerge() {
+        m_mergeOpen = false;
+        m_groupMergeOpen = false;
+    }
+
+    void UndoJournal::clear() {
+        m_steps.clear();
+        m_arena.clear();
+        m_actions.clear();
+        m_actionBytes = 0;
+        m_cursor = 0;
+        m_mergeOpen = false;
+        m_groupMergeOpen = false;
+        m_groupSize = 0;
+    }
+
+    void UndoJournal::setPaused(const bool paused) {
+        m_paused = paused;
+        // A change made after the pause must not merge into a step from before it
+        m_mergeOpen = false;
+    }
+
+    bool UndoJournal::isPaused() const {
+        return m_paused;
+    }
+
+    bool UndoJournal::canUndo() const {
+        return m_cursor > 0;
+    }
+
+    bool UndoJournal::canRedo() const {
+        return m_cursor < m_steps.size();
+    }
+
+    size_t UndoJournal::size() const {
+        return m_steps.size();
+    }
+
+    size_t UndoJournal::getMemoryBytes() const {
+        return m_steps.size() * sizeof(Step) + m_arena.size() + m_actionBytes;
+    }
+
+    void UndoJournal::truncateRedo() {
+        if (m_cursor == m_steps.size()) {
+            return;
+        }
+        for (size_t i = m_cursor; i < m_steps.size(); ++i) {
+            if (m_steps[i].type == ValueType::Text) {
+                m_arena.resize(m_steps[i].text.offset);
+                break;
+            }
+        }
+        for (size_t i = m_cursor; i < m_steps.size(); ++i) {
+            if (m_steps[i].type == ValueType::Action) {
+                for (size_t action = m_steps[i].action; action < m_actions.size(); ++action) {
+                    m_actionBytes -= m_actions[action].bytes;
+                }
+                m_actions.resize(m_steps[i].action);
+                break;
+            }
+        }
+        m_steps.resize(m_cursor);
+        m_mergeOpen = false;
+        m_groupMergeOpen = false;
+    }
+
+    /**
+     * @brief Discard the oldest steps until the history fits its budget
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Trims down to half the budget so the arena compaction that follows
+     * is amortised over many recorded changes. Groups are dropped whole.
+     * The newest step is always kept, even if it alone exceeds the budget;
+     * the open group loses its oldest steps in that case.
+     */
+    void UndoJournal::trim() {
+        if (getMemoryBytes() <= m_budgetBytes) {
+            return;
+        }
+
+        size_t bytes = getMemoryBytes();
+        size_t dropped = 0;
+        size_t droppedActions = 0;
+        while (dropped + 1 < m_steps.size() && (bytes > m_budgetBytes / 2 || m_steps[dropped].joined)) {
+            const Step& step = m_steps[dropped++];
+            bytes -= sizeof(Step);
+            if (step.type == ValueType::Text) {
+                bytes -= step.text.oldLength + step.text.newLength;
+            } else if (step.type == ValueType::Action) {
+                bytes -= m_actions[step.action].bytes;
+                m_actionBytes -= m_actions[step.action].bytes;
+                ++droppedActions;
+            }
+        }
+        m_actions.erase(m_actions.begin(), m_actions.begin() + static_cast<std::ptrdiff_t>(droppedActions));
+        m_steps.erase(m_steps.begin(), m_steps.begin() + static_cast<std::ptrdiff_t>(dropped));
+        m_cursor -= std::min(m_cursor, dropped);
+        m_steps.front().joined = false;
+        m_groupSize = std::min(m_groupSize, m_steps.size());
+        m_groupMergeOpen = false;
+
+        std::string arena;
+        arena.reserve(bytes - m_actionBytes);
+        for (Step& step : m_steps) {
+            if (step.type == ValueType::Text) {
+                arena.append(m_arena, step.text.offset, step.text.oldLength + step.text.newLength);
+                step.text.offset = static_cast<uint32_t>(arena.size() - step.text.oldLength - step.text.newLength);
+            } else if (step.type == ValueType::Action) {
+                step.action -= static_cast<uint32_t>(droppedActions);
+            }
+        }
+        m_arena = std::move(arena);
+    }
+
+} // namespace ADS::Core
@@ -0,0 +1,340 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_CORE_UNDO_JOURNAL_H
+#define ADS_CORE_UNDO_JOURNAL_H
+
+/**
+ * @file UndoJournal.h
+ * @brief Compact undo/redo history of entity property changes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Every PropertyChangedEvent raised by a project entity is recorded as a
+ * delta rather than as a pair of full PropertyValue copies:
+ *
+ * - property ids are interned into a 16-bit index;
+ * - bool, int, float, vector, colour and enum values are stored inline
+ *   in a fixed-size entry;
+ * - text values keep only the common prefix and suffix lengths and the
+ *   two differing middles, packed into a shared byte arena, so editing a
+ *   word in a long description costs a few bytes instead of two copies.
+ *
+ * A burst of changes to the same property of the same entity, such as a
+ * slider drag or typing into a field, collapses into a single step.
+ * Changes recorded between beginGroup() and endGroup(), such as one edit
+ * applied to a multi-selection, are undone and redone together.
+ *
+ * Changes that are not property edits, such as pasting a set of entities,
+ * are recorded as an Action: a pair of callbacks that undo and redo it.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityCollection.h"
+#include "EntityHandle.h"
+#include "Inspector/PropertyEvent.h"
+
+namespace ADS::Core {
+    class Project;
+
+    /**
+     * @brief Linear undo/redo history fed by entity property events
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Project records into its journal from the same subscription that
+     * drives dirty tracking. undo() and redo() write values back through
+     * IInspectable::setPropertyValue(), so entities, dirty tracking and the
+     * inspector react exactly as they do to a user edit; the events raised
+     * while a step is applied are not recorded again.
+     *
+     * Steps whose entity has been removed since are skipped. When the
+     * history exceeds its byte budget the oldest steps are discarded.
+     */
+    class UndoJournal {
+    public:
+        static constexpr size_t DEFAULT_BUDGET_BYTES = 16 * 1024 * 1024;              ///< Default cap on history memory
+        static constexpr std::chrono::milliseconds MERGE_WINDOW{750};                 ///< Max pause between merged changes
+
+        /// Clock used to decide whether consecutive changes merge
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief A change the journal cannot rebuild from property events
+         *
+         * Both callbacks run with recording suspended, so the property
+         * events they raise are not recorded again.
+         */
+        struct Action {
+            std::function<void(Project&)> undo;     ///< Reverts the change
+            std::function<void(Project&)> redo;     ///< Makes the change again
+            size_t bytes = 0;                       ///< Memory held by the callbacks, charged to the budget
+        };
+
+        /**
+         * @brief Create an empty journal
+         *
+         * @param budgetBytes Memory above which the oldest steps are discarded
+         */
+        explicit UndoJournal(size_t budgetBytes = DEFAULT_BUDGET_BYTES);
+
+        /**
+         * @brief Record a property change as a new step, or merge it into the last one
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Discards any steps that were undone and not redone. Does nothing
+         * while a step is being applied, or for values it cannot encode.
+         *
+         * @param entity Handle of the entity that raised the event
+         * @param event  Property change to record
+         * @param now    Time of the change, used for merging
+         */
+        void record(EntityHandle entity, const Inspector::PropertyChangedEvent& event, Clock::time_point now = Clock::now());
+
+        /**
+         * @brief Record a structural change as a new step
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Discards any steps that were undone and not redone. The step
+         * never merges with another, but joins the open group like any
+         * other change. Does nothing while a step is being applied.
+         *
+         * @param action Callbacks that undo and redo the change
+         */
+        void recordAction(Action action);
+
+        /**
+         * @brief Revert the most recent step that still applies
+         *
+         * @param project Project the recorded handles belong to
+         * @return bool True if a step was reverted
+         */
+        bool undo(Project& project);
+
+        /**
+         * @brief Re-apply the most recently undone step that still applies
+         *
+         * @param project Project the recorded handles belong to
+         * @return bool True if a step was re-applied
+         */
+        bool redo(Project& project);
+
+        /**
+         * @brief Start collecting changes into one undoable step
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Until endGroup(), every recorded change joins the same step; no
+         * change merges into a step recorded before the group.
+         */
+        void beginGroup();
+
+        /**
+         * @brief Close the group opened by beginGroup()
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A group that repeats the previous group's property on the same
+         * entities within MERGE_WINDOW, as dragging a slider over a
+         * multi-selection does, merges into it. Text, bool and enum groups
+         * never merge.
+         *
+         * @param now Time the group closed, used for merging
+         */
+        void endGroup(Clock::time_point now = Clock::now());
+
+        /**
+         * @brief Stop the next change from merging into the last step
+         *
+         * Call when an edit gesture ends, e.g. when a widget loses focus.
+         */
+        void breakMerge();
+
+        /**
+         * @brief Drop the whole history
+         */
+        void clear();
+
+        /**
+         * @brief Stop or resume recording changes
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Changes made while paused are not undoable, e.g. edits another
+         * user made that SyncSession applies. The history is kept.
+         *
+         * @param paused True to stop recording, false to resume
+         */
+        void setPaused(bool paused);
+
+        /**
+         * @brief Check whether recording is paused
+         * @return bool True between setPaused(true) and setPaused(false)
+         */
+        [[nodiscard]] bool isPaused() const;
+
+        [[nodiscard]] bool canUndo() const;
+        [[nodiscard]] bool canRedo() const;
+
+        /**
+         * @brief Get the number of recorded steps, undone ones included
+         * @return size_t Step count
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Get the memory used by the history
+         * @return size_t Bytes held by steps, text deltas and actions
+         */
+        [[nodiscard]] size_t getMemoryBytes() const;
+
+    private:
+        /**
+         * @brief Encoding of a step's values
+         */
+        enum class ValueType : uint8_t {
+            Bool,
+            Int,
+            Float,
+            Vector2,
+            Color,
+            Enum,
+            Text,
+            Action      ///< Entry of m_actions
+        };
+
+        /**
+         * @brief Inline storage for a non-text value
+         */
+        union InlineValue {
+            bool b;
+            int i;
+            float f[4];
+        };
+
+        /**
+         * @brief Text change, minus what old and new value have in common
+         *
+         * The arena holds the old middle followed by the new middle at
+         * offset. The full texts are old = prefix + oldMiddle + suffix and
+         * new = prefix + newMiddle + suffix.
+         */
+        struct TextDelta {
+            uint32_t offset;        ///< Position of the middles in m_arena
+            uint32_t prefix;        ///< Length of the common prefix
+            uint32_t oldLength;     ///< Length of the old middle
+            uint32_t newLength;     ///< Length of the new middle
+        };
+
+        /**
+         * @brief One undoable step
+         */
+        struct Step {
+            EntityHandle entity;    ///< Entity the change applies to
+            uint16_t property;      ///< Interned property id
+            ValueType type;         ///< Selects the active payload member
+            bool joined;            ///< Undone and redone together with the previous step
+            union {
+                struct {
+                    InlineValue oldValue;
+                    InlineValue newValue;
+                } scalar;
+                TextDelta text;
+                uint32_t action;    ///< Position in m_actions
+            };
+        };
+
+        std::vector<Step> m_steps;                  ///< History, oldest first; a group is a run of joined steps
+        size_t m_cursor = 0;                        ///< Steps currently applied; the rest are redoable
+        std::string m_arena;                        ///< Text middles of the Text steps, in step order
+        std::vector<Action> m_actions;              ///< Callbacks of the Action steps, in step order
+        size_t m_actionBytes = 0;                   ///< Sum of the bytes of m_actions
+        std::vector<std::string> m_propertyNames;   ///< Interned property ids
+        std::unordered_map<std::string, uint16_t, EntityIdHash, std::equal_to<>> m_propertyIndex; ///< Property id → interned index
+        size_t m_budgetBytes;                       ///< Trim threshold
+        bool m_applying = false;                    ///< A step is being written back
+        bool m_paused = false;                      ///< Changes are not recorded, see setPaused()
+        bool m_mergeOpen = false;                   ///< The last step may absorb the next change
+        Clock::time_point m_lastChange;             ///< Time of the last recorded change
+        bool m_grouping = false;                    ///< Between beginGroup() and endGroup()
+        size_t m_groupSize = 0;                     ///< Steps recorded in the open group
+        size_t m_previousGroup = 0;                 ///< First step of the group closed last
+        bool m_groupMergeOpen = false;              ///< The last group may absorb the next one
+
+        /**
+         * @brief Intern a property id
+         *
+         * @return uint16_t Index into m_propertyNames
+         */
+        uint16_t intern(std::string_view propertyId);
+
+        /**
+         * @brief Encode a value pair into step, appending text to the arena
+         *
+         * @return bool False if the values are of an unsupported type
+         */
+        bool encode(Step& step, const Inspector::PropertyValue& oldValue, const Inspector::PropertyValue& newValue);
+
+        /**
+         * @brief Rebuild the old or new value of a step
+         *
+         * @param step    Step to decode
+         * @param current Current value of the property; text deltas apply to it
+         * @param old     True for the value before the change, false for after
+         */
+        [[nodiscard]] Inspector::PropertyValue decode(const Step& step, const Inspector::PropertyValue& current, bool old) const;
+
+        /**
+         * @brief Write one side of a step back into its entity
+         *
+         * @return bool False if the entity no longer exists
+         */
+        bool apply(Project& project, const Step& step, bool old);
+
+        /**
+         * @brief Fold the group just closed into the one before it, if it repeats it
+         *
+         * @return bool True if the group was merged away
+         */
+        bool mergeGroup(Clock::time_point now);
+
+        /**
+         * @brief Drop the undone steps, their arena bytes and their actions
+         */
+        void truncateRedo();
+
+        /**
+         * @brief Discard the oldest steps until the history fits its budget
+         */
+        void trim();
+    };
+
+} // namespace ADS::Core
+
+#endif // ADS_CORE_UNDO_JOURNAL_H
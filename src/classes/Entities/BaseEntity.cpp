@@ -25,15 +25,29 @@ namespace ADS::Entities {
         : m_id(id), m_name(name) {
     }
 
+    BaseEntity::BaseEntity(const BaseEntity& other)
+        : Inspector::IInspectable(other), m_id(other.m_id), m_name(other.m_name), m_handle(other.m_handle) {
+    }
+
     void BaseEntity::notifyPropertyChanged(
-        const std::string& propertyId,
+        const std::string_view propertyId,
         const Inspector::PropertyValue& oldValue,
         const Inspector::PropertyValue& newValue
     ) {
-        Inspector::PropertyChangedEvent event(propertyId, oldValue, newValue, this);
+        m_computedValues.invalidate(getPropertySchema(), propertyId);
+        const Inspector::PropertyChangedEvent event(propertyId, oldValue, newValue, this);
         m_eventDispatcher.dispatch(event);
     }
 
+    void BaseEntity::notifyPropertyChanged(
+        const std::string_view propertyId,
+        const std::string& oldValue,
+        const std::string& newValue
+    ) {
+        const Inspector::TextChangePayload payload(oldValue, newValue);
+        notifyPropertyChanged(propertyId, payload.getOldValue(), payload.getNewValue());
+    }
+
     std::string BaseEntity::getDisplayName() const {
         return m_name;
     }
@@ -46,11 +60,20 @@ namespace ADS::Entities {
         return m_id;
     }
 
+    const std::string& BaseEntity::getName() const {
+        return m_name;
+    }
+
     void BaseEntity::setName(const std::string& name) {
         if (m_name != name) {
-            std::string oldName = m_name;
+            // The payload keeps the old name, so m_name is assigned in place
+            const Inspector::TextChangePayload payload(m_name, name);
             m_name = name;
-            notifyPropertyChanged("name", oldName, m_name);
+            notifyPropertyChanged("name", payload.getOldValue(), payload.getNewValue());
         }
     }
+
+    Core::EntityHandle BaseEntity::getHandle() const {
+        return m_handle;
+    }
 }
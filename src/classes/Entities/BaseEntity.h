@@ -14,8 +14,16 @@
 #define ADS_BASE_ENTITY_H
 
 #include <string>
+#include <string_view>
+#include <utility>
+#include "Inspector/ComputedValues.h"
 #include "Inspector/IInspectable.h"
 #include "Inspector/PropertyEvent.h"
+#include "Core/EntityHandle.h"
+
+namespace ADS::Core {
+    class Project;
+}
 
 namespace ADS::Entities {
     /**
@@ -32,10 +40,14 @@ namespace ADS::Entities {
     protected:
         std::string m_id;       ///< Unique entity identifier
         std::string m_name;     ///< Display name
+        Core::EntityHandle m_handle; ///< Runtime identity, assigned by the owning Core::Project
 
         /// Event dispatcher for property changes
         Inspector::PropertyEventDispatcher m_eventDispatcher;
 
+        /// Cached values of the computed properties, invalidated by notifyPropertyChanged()
+        mutable Inspector::ComputedValues m_computedValues;
+
         /**
          * @brief Notify subscribers of a property change
          *
@@ -43,17 +55,73 @@ namespace ADS::Entities {
          * @version Jan 2026
          *
          * Helper method for derived classes to fire property change events.
+         * Computed properties derived from the property are marked stale
+         * before the subscribers run, so they read the new values.
          *
-         * @param propertyId The ID of the changed property
+         * @param propertyId The ID of the changed property; a literal or interned
          * @param oldValue The previous value
          * @param newValue The new value
          */
         void notifyPropertyChanged(
-            const std::string& propertyId,
+            std::string_view propertyId,
             const Inspector::PropertyValue& oldValue,
             const Inspector::PropertyValue& newValue
         );
 
+        /**
+         * @brief Notify subscribers of a text property change
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The texts reach the event through recycled values instead of
+         * PropertyValue copies, so editing text allocates nothing here.
+         *
+         * @param propertyId The ID of the changed property; a literal or interned
+         * @param oldValue The previous text
+         * @param newValue The new text
+         *
+         * @see Inspector::TextChangePayload
+         */
+        void notifyPropertyChanged(
+            std::string_view propertyId,
+            const std::string& oldValue,
+            const std::string& newValue
+        );
+
+        /**
+         * @brief Get a computed property, recomputing it if an input changed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param propertyId Id of a computed descriptor of this entity's schema
+         * @param compute    Returns the value from the current inputs
+         * @return const Inspector::PropertyValue& The value
+         */
+        template <class Compute>
+        const Inspector::PropertyValue& computedValue(std::string_view propertyId, Compute&& compute) const {
+            return m_computedValues.get(*getPropertySchema().indexOf(propertyId), std::forward<Compute>(compute));
+        }
+
+        /**
+         * @brief Copy the identity of another entity without its subscribers
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Subscriptions belong to an instance, so the copy starts with an
+         * empty dispatcher, and computes its computed properties afresh. The handle is kept, so a snapshot entity answers
+         * to the same handle as its original. Derived entities get property-wise copies from
+         * their implicit copy constructors, which is what project snapshots
+         * rely on.
+         *
+         * @param other Entity to copy
+         */
+        BaseEntity(const BaseEntity& other);
+
+        BaseEntity& operator=(const BaseEntity&) = delete;
+
     public:
         /**
          * @brief Construct a new BaseEntity
@@ -78,11 +146,30 @@ namespace ADS::Entities {
          */
         const std::string& getId() const;
 
+        /**
+         * @brief Get the display name without copying it
+         * @return const std::string& Entity name
+         */
+        const std::string& getName() const;
+
         /**
          * @brief Set the display name
          * @param name New name
          */
         void setName(const std::string& name);
+
+        /**
+         * @brief Get the runtime handle of this entity
+         *
+         * Prefer the handle over getId() for selection, lookups and any
+         * other identity check that happens every frame.
+         *
+         * @return Core::EntityHandle Handle issued by the owning project,
+         *         or an invalid handle if the entity is not in a project
+         */
+        Core::EntityHandle getHandle() const;
+
+        friend class Core::Project;
     };
 }
 
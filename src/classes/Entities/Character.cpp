@@ -19,8 +19,23 @@
  */
 
 #include "Character.h"
+#include "Inspector/PropertyTable.h"
 
 namespace ADS::Entities {
+    using CharacterProperty = Inspector::PropertyBinding<Character>;
+
+    /// Accessors behind getPropertyValue() and setPropertyValue()
+    static constexpr Inspector::PropertyTable CHARACTER_PROPERTIES({
+        CharacterProperty::of<&Character::getName, &Character::setName>("name"),
+        CharacterProperty::of<&Character::getDescription, &Character::setDescription>("description"),
+        CharacterProperty::of<&Character::isPlayer, &Character::setPlayer>("isPlayer"),
+        CharacterProperty::of<&Character::getHealth, &Character::setHealth>("health"),
+        CharacterProperty::of<&Character::getMaxHealth, &Character::setMaxHealth>("maxHealth"),
+        CharacterProperty::of<&Character::getHealthPercent>("healthPercent"),
+        CharacterProperty::of<&Character::getDialogColor, &Character::setDialogColor>("dialogColor"),
+        CharacterProperty::of<&Character::getId>("id"),
+    });
+
     Character::Character(const std::string& id, const std::string& name)
         : BaseEntity(id, name),
           m_health(100),
@@ -33,10 +48,10 @@ namespace ADS::Entities {
         return "Character";
     }
 
-    std::vector<Inspector::PropertyDescriptor> Character::getPropertyDescriptors() const {
+    const Inspector::PropertySchema& Character::getPropertySchema() const {
         using namespace Inspector;
 
-        return {
+        static const PropertySchema schema({
             // General category
             PropertyDescriptor("name", "Name", PropertyType::String)
                 .setCategory("General")
@@ -45,7 +60,8 @@ namespace ADS::Entities {
 
             PropertyDescriptor("description", "Description", PropertyType::String)
                 .setCategory("General")
-                .setDescription("Character backstory and description"),
+                .setDescription("Character backstory and description")
+                .setConstraints(PropertyConstraints::multilineString()),
 
             PropertyDescriptor("isPlayer", "Player Character", PropertyType::Bool)
                 .setCategory("General")
@@ -62,6 +78,11 @@ namespace ADS::Entities {
                 .setDescription("Maximum health points")
                 .setConstraints(PropertyConstraints::numeric(1, 9999, 1)),
 
+            PropertyDescriptor("healthPercent", "Health %", PropertyType::Float)
+                .setCategory("Stats")
+                .setDescription("Current health as a percentage of the maximum")
+                .setComputed({"health", "maxHealth"}),
+
             // Appearance category
             PropertyDescriptor("dialogColor", "Dialog Color", PropertyType::Color)
                 .setCategory("Appearance")
@@ -72,77 +93,46 @@ namespace ADS::Entities {
                 .setCategory("Info")
                 .setDescription("Unique character identifier")
                 .setReadOnly()
-        };
+        });
+        return schema;
     }
 
     Inspector::PropertyValue Character::getPropertyValue(const std::string& propertyId) const {
-        if (propertyId == "name") return m_name;
-        if (propertyId == "description") return m_description;
-        if (propertyId == "isPlayer") return m_isPlayer;
-        if (propertyId == "health") return m_health;
-        if (propertyId == "maxHealth") return m_maxHealth;
-        if (propertyId == "dialogColor") return m_dialogColor;
-        if (propertyId == "id") return m_id;
-
-        return std::monostate{};
+        return CHARACTER_PROPERTIES.get(*this, propertyId);
     }
 
     bool Character::setPropertyValue(
         const std::string& propertyId,
         const Inspector::PropertyValue& value
     ) {
-        if (propertyId == "name") {
-            if (auto* str = std::get_if<std::string>(&value)) {
-                setName(*str);
-                return true;
-            }
-        }
-        else if (propertyId == "description") {
-            if (auto* str = std::get_if<std::string>(&value)) {
-                setDescription(*str);
-                return true;
-            }
-        }
-        else if (propertyId == "isPlayer") {
-            if (auto* b = std::get_if<bool>(&value)) {
-                setPlayer(*b);
-                return true;
-            }
-        }
-        else if (propertyId == "health") {
-            if (auto* i = std::get_if<int>(&value)) {
-                setHealth(*i);
-                return true;
-            }
-        }
-        else if (propertyId == "maxHealth") {
-            if (auto* i = std::get_if<int>(&value)) {
-                setMaxHealth(*i);
-                return true;
-            }
-        }
-        else if (propertyId == "dialogColor") {
-            if (auto* color = std::get_if<ImVec4>(&value)) {
-                setDialogColor(*color);
-                return true;
-            }
-        }
-
-        return false;
+        return CHARACTER_PROPERTIES.set(*this, propertyId, value);
     }
 
-    const std::string& Character::getDescription() const {
-        return m_description;
+    std::shared_ptr<const std::string> Character::getDescription() const {
+        return m_description.get();
     }
 
     void Character::setDescription(const std::string& desc) {
-        if (m_description != desc) {
-            std::string oldDesc = m_description;
-            m_description = desc;
-            notifyPropertyChanged("description", oldDesc, m_description);
+        const std::shared_ptr<const std::string> oldDesc = m_description.get();
+        if (*oldDesc != desc) {
+            // Replace rather than mutate: snapshots may still hold the old text
+            m_description.set(desc);
+            notifyPropertyChanged("description", *oldDesc, desc);
+        }
+    }
+
+    void Character::shareDescription(std::shared_ptr<const std::string> desc) {
+        const std::shared_ptr<const std::string> oldDesc = m_description.get();
+        if (oldDesc != desc && *oldDesc != *desc) {
+            m_description.set(desc);
+            notifyPropertyChanged("description", *oldDesc, *desc);
         }
     }
 
+    void Character::bindDescription(std::shared_ptr<TextSource> source, uint64_t key) {
+        m_description.bind(std::move(source), key);
+    }
+
     int Character::getHealth() const {
         return m_health;
     }
@@ -167,6 +157,12 @@ namespace ADS::Entities {
         }
     }
 
+    float Character::getHealthPercent() const {
+        return Inspector::getValueOr(computedValue("healthPercent", [this] {
+            return Inspector::PropertyValue(m_maxHealth > 0 ? 100.0f * static_cast<float>(m_health) / static_cast<float>(m_maxHealth) : 0.0f);
+        }), 0.0f);
+    }
+
     bool Character::isPlayer() const {
         return m_isPlayer;
     }
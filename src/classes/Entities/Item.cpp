@@ -19,6 +19,7 @@
  */
 
 #include "Item.h"
+#include "Inspector/PropertyTable.h"
 
 namespace ADS::Entities {
     const std::vector<std::string>& Item::getItemTypes() {
@@ -35,6 +36,36 @@ namespace ADS::Entities {
         return types;
     }
 
+    const Inspector::EnumOptions* Item::getItemTypeOptions() {
+        static const Inspector::EnumOptions* options = Inspector::EnumOptions::intern(getItemTypes());
+        return options;
+    }
+
+    using ItemProperty = Inspector::PropertyBinding<Item>;
+
+    /// Accessors behind getPropertyValue() and setPropertyValue()
+    static constexpr Inspector::PropertyTable ITEM_PROPERTIES({
+        ItemProperty::of<&Item::getName, &Item::setName>("name"),
+        ItemProperty::of<&Item::getDescription, &Item::setDescription>("description"),
+        ItemProperty::of<&Item::isPickable, &Item::setPickable>("isPickable"),
+        ItemProperty::of<&Item::isUsable, &Item::setUsable>("isUsable"),
+        ItemProperty::of<&Item::getQuantity, &Item::setQuantity>("quantity"),
+        ItemProperty::of<&Item::getId>("id"),
+        {
+            "itemType",
+            [](const Item& item) -> Inspector::PropertyValue {
+                return Inspector::EnumValue(item.getItemType(), Item::getItemTypeOptions());
+            },
+            [](Item& item, const Inspector::PropertyValue& value) {
+                const auto* selection = std::get_if<Inspector::EnumValue>(&value);
+                if (selection != nullptr) {
+                    item.setItemType(selection->selectedIndex);
+                }
+                return selection != nullptr;
+            }
+        },
+    });
+
     Item::Item(const std::string& id, const std::string& name)
         : BaseEntity(id, name),
           m_isPickable(true),
@@ -47,10 +78,10 @@ namespace ADS::Entities {
         return "Item";
     }
 
-    std::vector<Inspector::PropertyDescriptor> Item::getPropertyDescriptors() const {
+    const Inspector::PropertySchema& Item::getPropertySchema() const {
         using namespace Inspector;
 
-        return {
+        static const PropertySchema schema({
             // General category
             PropertyDescriptor("name", "Name", PropertyType::String)
                 .setCategory("General")
@@ -59,7 +90,8 @@ namespace ADS::Entities {
 
             PropertyDescriptor("description", "Description", PropertyType::String)
                 .setCategory("General")
-                .setDescription("Item description shown to the player"),
+                .setDescription("Item description shown to the player")
+                .setConstraints(PropertyConstraints::multilineString()),
 
             PropertyDescriptor("itemType", "Type", PropertyType::Enum)
                 .setCategory("General")
@@ -85,79 +117,46 @@ namespace ADS::Entities {
                 .setCategory("Info")
                 .setDescription("Unique item identifier")
                 .setReadOnly()
-        };
+        });
+        return schema;
     }
 
     Inspector::PropertyValue Item::getPropertyValue(const std::string& propertyId) const {
-        if (propertyId == "name") return m_name;
-        if (propertyId == "description") return m_description;
-        if (propertyId == "isPickable") return m_isPickable;
-        if (propertyId == "isUsable") return m_isUsable;
-        if (propertyId == "quantity") return m_quantity;
-        if (propertyId == "id") return m_id;
-        if (propertyId == "itemType") {
-            return Inspector::EnumValue(m_itemType, getItemTypes());
-        }
-
-        return std::monostate{};
+        return ITEM_PROPERTIES.get(*this, propertyId);
     }
 
     bool Item::setPropertyValue(
         const std::string& propertyId,
         const Inspector::PropertyValue& value
     ) {
-        if (propertyId == "name") {
-            if (auto* str = std::get_if<std::string>(&value)) {
-                setName(*str);
-                return true;
-            }
-        }
-        else if (propertyId == "description") {
-            if (auto* str = std::get_if<std::string>(&value)) {
-                setDescription(*str);
-                return true;
-            }
-        }
-        else if (propertyId == "isPickable") {
-            if (auto* b = std::get_if<bool>(&value)) {
-                setPickable(*b);
-                return true;
-            }
-        }
-        else if (propertyId == "isUsable") {
-            if (auto* b = std::get_if<bool>(&value)) {
-                setUsable(*b);
-                return true;
-            }
-        }
-        else if (propertyId == "quantity") {
-            if (auto* i = std::get_if<int>(&value)) {
-                setQuantity(*i);
-                return true;
-            }
-        }
-        else if (propertyId == "itemType") {
-            if (auto* ev = std::get_if<Inspector::EnumValue>(&value)) {
-                setItemType(ev->selectedIndex);
-                return true;
-            }
-        }
-
-        return false;
+        return ITEM_PROPERTIES.set(*this, propertyId, value);
     }
 
-    const std::string& Item::getDescription() const {
-        return m_description;
+    std::shared_ptr<const std::string> Item::getDescription() const {
+        return m_description.get();
     }
 
     void Item::setDescription(const std::string& desc) {
-        if (m_description != desc) {
-            std::string oldDesc = m_description;
-            m_description = desc;
-            notifyPropertyChanged("description", oldDesc, m_description);
+        const std::shared_ptr<const std::string> oldDesc = m_description.get();
+        if (*oldDesc != desc) {
+            // Replace rather than mutate: snapshots may still hold the old text
+            m_description.set(desc);
+            notifyPropertyChanged("description", *oldDesc, desc);
         }
     }
 
+    void Item::shareDescription(std::shared_ptr<const std::string> desc) {
+        const std::shared_ptr<const std::string> oldDesc = m_description.get();
+        if (oldDesc != desc && *oldDesc != *desc) {
+            m_description.set(desc);
+            notifyPropertyChanged("description", *oldDesc, *desc);
+        }
+    }
+
+    void Item::bindDescription(std::shared_ptr<TextSource> source, uint64_t key) {
+        m_description.bind(std::move(source), key);
+    }
+
     bool Item::isPickable() const {
         return m_isPickable;
     }
@@ -203,8 +202,8 @@ namespace ADS::Entities {
             int oldType = m_itemType;
             m_itemType = type;
             notifyPropertyChanged("itemType",
-                Inspector::EnumValue(oldType, getItemTypes()),
-                Inspector::EnumValue(m_itemType, getItemTypes()));
+                Inspector::EnumValue(oldType, getItemTypeOptions()),
+                Inspector::EnumValue(m_itemType, getItemTypeOptions()));
         }
     }
 
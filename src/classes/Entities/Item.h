@@ -13,7 +13,10 @@
 #ifndef ADS_ITEM_ENTITY_H
 #define ADS_ITEM_ENTITY_H
 
+#include <memory>
+
 #include "BaseEntity.h"
+#include "LazyText.h"
 
 namespace ADS::Entities {
     /**
@@ -27,7 +30,7 @@ namespace ADS::Entities {
      */
     class Item : public BaseEntity {
     private:
-        std::string m_description;      ///< Item description
+        LazyText m_description;         ///< Item description, shared with snapshots
         bool m_isPickable;              ///< Whether the item can be picked up
         bool m_isUsable;                ///< Whether the item can be used
         int m_quantity;                 ///< Stack quantity
@@ -37,6 +40,9 @@ namespace ADS::Entities {
         /// Available item types
         static const std::vector<std::string>& getItemTypes();
 
+        /// Available item types, as the shared option table of itemType values
+        static const Inspector::EnumOptions* getItemTypeOptions();
+
         /**
          * @brief Construct a new Item
          *
@@ -45,9 +51,10 @@ namespace ADS::Entities {
          */
         Item(const std::string& id, const std::string& name);
 
+
         // IInspectable interface
         std::string getTypeName() const override;
-        std::vector<Inspector::PropertyDescriptor> getPropertyDescriptors() const override;
+        const Inspector::PropertySchema& getPropertySchema() const override;
         Inspector::PropertyValue getPropertyValue(const std::string& propertyId) const override;
         bool setPropertyValue(
             const std::string& propertyId,
@@ -55,9 +62,38 @@ namespace ADS::Entities {
         ) override;
 
         // Item-specific getters/setters
-        const std::string& getDescription() const;
+        /**
+         * @brief Get the description, loading it on first access
+         *
+         * Returned as a shared pointer so the text stays valid while held,
+         * even if its source evicts it in the meantime.
+         *
+         * @return std::shared_ptr<const std::string> Description, never null
+         */
+        std::shared_ptr<const std::string> getDescription() const;
         void setDescription(const std::string& desc);
 
+        /**
+         * @brief Set the description by sharing a payload instead of copying it
+         *
+         * Used with StringPool so entities with the same description hold
+         * one copy of it.
+         *
+         * @param desc New description, not null
+         */
+        void shareDescription(std::shared_ptr<const std::string> desc);
+
+        /**
+         * @brief Defer the description to a payload source
+         *
+         * Used by loaders; does not notify subscribers since the value is
+         * unchanged, only not resident yet.
+         *
+         * @param source Provider that will load the text
+         * @param key    Identifier of the text inside @p source
+         */
+        void bindDescription(std::shared_ptr<TextSource> source, uint64_t key);
+
         bool isPickable() const;
         void setPickable(bool pickable);
 
@@ -0,0 +1,70 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file LazyText.cpp
+ * @brief Implementation of the LazyText class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "LazyText.h"
+
+#include <utility>
+
+namespace ADS::Entities {
+    /**
+     * @brief Shared empty payload, so default-constructed text never allocates
+     */
+    static const std::shared_ptr<const std::string>& emptyText() {
+        static const auto empty = std::make_shared<const std::string>();
+        return empty;
+    }
+
+    LazyText::LazyText()
+        : m_value(emptyText()), m_key(0) {
+    }
+
+    std::shared_ptr<const std::string> LazyText::get() const {
+        if (m_value) {
+            return m_value;
+        }
+        if (auto cached = m_cached.lock()) {
+            return cached;
+        }
+        auto loaded = m_source->load(m_key);
+        m_cached = loaded;
+        return loaded;
+    }
+
+    void LazyText::set(std::string text) {
+        m_value = text.empty() ? emptyText() : std::make_shared<const std::string>(std::move(text));
+        m_source.reset();
+        m_cached.reset();
+        m_key = 0;
+    }
+
+    void LazyText::set(std::shared_ptr<const std::string> text) {
+        m_value = text->empty() ? emptyText() : std::move(text);
+        m_source.reset();
+        m_cached.reset();
+        m_key = 0;
+    }
+
+    void LazyText::bind(std::shared_ptr<TextSource> source, uint64_t key) {
+        m_value.reset();
+        m_source = std::move(source);
+        m_key = key;
+        m_cached.reset();
+    }
+}
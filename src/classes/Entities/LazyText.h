@@ -0,0 +1,100 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_LAZY_TEXT_H
+#define ADS_LAZY_TEXT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ADS::Entities {
+    /**
+     * @brief Provider of text payloads that are loaded on demand
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Implemented by the persistence layer. A source may cache what it
+     * loads and drop cold payloads at any time; callers keep a payload
+     * alive only for as long as they hold the returned pointer. Sources are
+     * shared by a project and its snapshots, so load() must be thread-safe.
+     */
+    class TextSource {
+    public:
+        virtual ~TextSource() = default;
+
+        /**
+         * @brief Load the payload identified by a source-specific key
+         *
+         * @param key Value given to LazyText::bind()
+         * @return std::shared_ptr<const std::string> Loaded text, never null
+         */
+        [[nodiscard]] virtual std::shared_ptr<const std::string> load(uint64_t key) = 0;
+    };
+
+    /**
+     * @brief Immutable text that is either resident or loaded on first use
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Text assigned with set() is owned and always resident. Text bound to
+     * a TextSource is only referenced weakly, so it stays in memory while
+     * the source caches it or a caller holds it, and is reloaded otherwise.
+     * Copies share the same payload, which keeps project snapshots cheap.
+     */
+    class LazyText {
+    private:
+        std::shared_ptr<const std::string> m_value;     ///< Owned text, null while bound to a source
+        std::shared_ptr<TextSource> m_source;           ///< Provider of bound text
+        uint64_t m_key;                                 ///< Key of the bound text inside m_source
+        mutable std::weak_ptr<const std::string> m_cached; ///< Last payload loaded from m_source
+
+    public:
+        /**
+         * @brief Construct an empty, resident text
+         */
+        LazyText();
+
+        /**
+         * @brief Get the text, loading it if needed
+         *
+         * Holding the returned pointer pins the payload, which is what makes
+         * it safe to use while another thread may make the source evict it.
+         *
+         * @return std::shared_ptr<const std::string> Current text, never null
+         */
+        [[nodiscard]] std::shared_ptr<const std::string> get() const;
+
+        /**
+         * @brief Replace the text with an owned value
+         * @param text New text; detaches from any source
+         */
+        void set(std::string text);
+
+        /**
+         * @brief Replace the text with a payload shared with other owners
+         * @param text New text, not null; detaches from any source
+         */
+        void set(std::shared_ptr<const std::string> text);
+
+        /**
+         * @brief Defer the text to a source
+         * @param source Provider that will load the text
+         * @param key    Identifier of the text inside @p source
+         */
+        void bind(std::shared_ptr<TextSource> source, uint64_t key);
+    };
+}
+
+#endif //ADS_LAZY_TEXT_H
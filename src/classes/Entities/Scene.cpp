@@ -19,8 +19,23 @@
  */
 
 #include "Scene.h"
+#include "Inspector/PropertyTable.h"
 
 namespace ADS::Entities {
+    using SceneProperty = Inspector::PropertyBinding<Scene>;
+
+    /// Accessors behind getPropertyValue() and setPropertyValue()
+    static constexpr Inspector::PropertyTable SCENE_PROPERTIES({
+        SceneProperty::of<&Scene::getName, &Scene::setName>("name"),
+        SceneProperty::of<&Scene::getDescription, &Scene::setDescription>("description"),
+        SceneProperty::of<&Scene::isStartScene, &Scene::setStartScene>("isStartScene"),
+        SceneProperty::of<&Scene::getBackgroundColor, &Scene::setBackgroundColor>("backgroundColor"),
+        SceneProperty::of<&Scene::getWidth, &Scene::setWidth>("width"),
+        SceneProperty::of<&Scene::getHeight, &Scene::setHeight>("height"),
+        SceneProperty::of<&Scene::getAspectRatio>("aspectRatio"),
+        SceneProperty::of<&Scene::getId>("id"),
+    });
+
     Scene::Scene(const std::string& id, const std::string& name)
         : BaseEntity(id, name),
           m_isStartScene(false),
@@ -33,10 +48,10 @@ namespace ADS::Entities {
         return "Scene";
     }
 
-    std::vector<Inspector::PropertyDescriptor> Scene::getPropertyDescriptors() const {
+    const Inspector::PropertySchema& Scene::getPropertySchema() const {
         using namespace Inspector;
 
-        return {
+        static const PropertySchema schema({
             // General category
             PropertyDescriptor("name", "Name", PropertyType::String)
                 .setCategory("General")
@@ -45,7 +60,8 @@ namespace ADS::Entities {
 
             PropertyDescriptor("description", "Description", PropertyType::String)
                 .setCategory("General")
-                .setDescription("Detailed description of the scene"),
+                .setDescription("Detailed description of the scene")
+                .setConstraints(PropertyConstraints::multilineString()),
 
             PropertyDescriptor("isStartScene", "Start Scene", PropertyType::Bool)
                 .setCategory("General")
@@ -67,84 +83,56 @@ namespace ADS::Entities {
                 .setDescription("Scene height in pixels")
                 .setConstraints(PropertyConstraints::numeric(1, 4096, 1)),
 
+            PropertyDescriptor("aspectRatio", "Aspect Ratio", PropertyType::Float)
+                .setCategory("Dimensions")
+                .setDescription("Width divided by height")
+                .setComputed({"width", "height"}),
+
             // Info category (read-only)
             PropertyDescriptor("id", "ID", PropertyType::String)
                 .setCategory("Info")
                 .setDescription("Unique scene identifier")
                 .setReadOnly()
-        };
+        });
+        return schema;
     }
 
     Inspector::PropertyValue Scene::getPropertyValue(const std::string& propertyId) const {
-        if (propertyId == "name") return m_name;
-        if (propertyId == "description") return m_description;
-        if (propertyId == "isStartScene") return m_isStartScene;
-        if (propertyId == "backgroundColor") return m_backgroundColor;
-        if (propertyId == "width") return m_width;
-        if (propertyId == "height") return m_height;
-        if (propertyId == "id") return m_id;
-
-        return std::monostate{};
+        return SCENE_PROPERTIES.get(*this, propertyId);
     }
 
     bool Scene::setPropertyValue(
         const std::string& propertyId,
         const Inspector::PropertyValue& value
     ) {
-        using namespace Inspector;
-
-        if (propertyId == "name") {
-            if (auto* str = std::get_if<std::string>(&value)) {
-                setName(*str);
-                return true;
-            }
-        }
-        else if (propertyId == "description") {
-            if (auto* str = std::get_if<std::string>(&value)) {
-                setDescription(*str);
-                return true;
-            }
-        }
-        else if (propertyId == "isStartScene") {
-            if (auto* b = std::get_if<bool>(&value)) {
-                setStartScene(*b);
-                return true;
-            }
-        }
-        else if (propertyId == "backgroundColor") {
-            if (auto* color = std::get_if<ImVec4>(&value)) {
-                setBackgroundColor(*color);
-                return true;
-            }
-        }
-        else if (propertyId == "width") {
-            if (auto* i = std::get_if<int>(&value)) {
-                setWidth(*i);
-                return true;
-            }
-        }
-        else if (propertyId == "height") {
-            if (auto* i = std::get_if<int>(&value)) {
-                setHeight(*i);
-                return true;
-            }
-        }
-
-        return false;
+        return SCENE_PROPERTIES.set(*this, propertyId, value);
     }
 
-    const std::string& Scene::getDescription() const {
-        return m_description;
+    std::shared_ptr<const std::string> Scene::getDescription() const {
+        return m_description.get();
     }
 
     void Scene::setDescription(const std::string& desc) {
-        if (m_description != desc) {
-            std::string oldDesc = m_description;
-            m_description = desc;
-            notifyPropertyChanged("description", oldDesc, m_description);
+        const std::shared_ptr<const std::string> oldDesc = m_description.get();
+        if (*oldDesc != desc) {
+            // Replace rather than mutate: snapshots may still hold the old text
+            m_description.set(desc);
+            notifyPropertyChanged("description", *oldDesc, desc);
+        }
+    }
+
+    void Scene::shareDescription(std::shared_ptr<const std::string> desc) {
+        const std::shared_ptr<const std::string> oldDesc = m_description.get();
+        if (oldDesc != desc && *oldDesc != *desc) {
+            m_description.set(desc);
+            notifyPropertyChanged("description", *oldDesc, *desc);
         }
     }
 
+    void Scene::bindDescription(std::shared_ptr<TextSource> source, uint64_t key) {
+        m_description.bind(std::move(source), key);
+    }
+
     bool Scene::isStartScene() const {
         return m_isStartScene;
     }
@@ -195,4 +183,10 @@ namespace ADS::Entities {
             notifyPropertyChanged("height", oldHeight, m_height);
         }
     }
+
+    float Scene::getAspectRatio() const {
+        return Inspector::getValueOr(computedValue("aspectRatio", [this] {
+            return Inspector::PropertyValue(m_height > 0 ? static_cast<float>(m_width) / static_cast<float>(m_height) : 0.0f);
+        }), 0.0f);
+    }
 }
@@ -13,7 +13,10 @@
 #ifndef ADS_SCENE_ENTITY_H
 #define ADS_SCENE_ENTITY_H
 
+#include <memory>
+
 #include "BaseEntity.h"
+#include "LazyText.h"
 #include "imgui.h"
 
 namespace ADS::Entities {
@@ -28,7 +31,7 @@ namespace ADS::Entities {
      */
     class Scene : public BaseEntity {
     private:
-        std::string m_description;      ///< Scene description text
+        LazyText m_description;         ///< Scene description text, shared with snapshots
         bool m_isStartScene;            ///< Whether this is the starting scene
         ImVec4 m_backgroundColor;       ///< Background color for the scene
         int m_width;                    ///< Scene width in pixels
@@ -43,9 +46,10 @@ namespace ADS::Entities {
          */
         Scene(const std::string& id, const std::string& name);
 
+
         // IInspectable interface
         std::string getTypeName() const override;
-        std::vector<Inspector::PropertyDescriptor> getPropertyDescriptors() const override;
+        const Inspector::PropertySchema& getPropertySchema() const override;
         Inspector::PropertyValue getPropertyValue(const std::string& propertyId) const override;
         bool setPropertyValue(
             const std::string& propertyId,
@@ -53,9 +57,38 @@ namespace ADS::Entities {
         ) override;
 
         // Scene-specific getters/setters
-        const std::string& getDescription() const;
+        /**
+         * @brief Get the description, loading it on first access
+         *
+         * Returned as a shared pointer so the text stays valid while held,
+         * even if its source evicts it in the meantime.
+         *
+         * @return std::shared_ptr<const std::string> Description, never null
+         */
+        std::shared_ptr<const std::string> getDescription() const;
         void setDescription(const std::string& desc);
 
+        /**
+         * @brief Set the description by sharing a payload instead of copying it
+         *
+         * Used with StringPool so entities with the same description hold
+         * one copy of it.
+         *
+         * @param desc New description, not null
+         */
+        void shareDescription(std::shared_ptr<const std::string> desc);
+
+        /**
+         * @brief Defer the description to a payload source
+         *
+         * Used by loaders; does not notify subscribers since the value is
+         * unchanged, only not resident yet.
+         *
+         * @param source Provider that will load the text
+         * @param key    Identifier of the text inside @p source
+         */
+        void bindDescription(std::shared_ptr<TextSource> source, uint64_t key);
+
         bool isStartScene() const;
         void setStartScene(bool isStart);
 
@@ -67,6 +100,12 @@ namespace ADS::Entities {
 
         int getHeight() const;
         void setHeight(int height);
+
+        /**
+         * @brief Get the width-to-height ratio
+         * @return float Computed from width and height
+         */
+        float getAspectRatio() const;
     };
 }
 
@@ -0,0 +1,121 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file DocumentManager.cpp
+ * @brief Implementation of the DocumentManager class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "DocumentManager.h"
+#include <fstream>
+#include <spdlog/spdlog.h>
+#include "Logger/logger.h"
+
+namespace ADS::IDE {
+    DocumentManager::DocumentManager()
+        : m_nextId(1)
+    {
+    }
+
+    size_t DocumentManager::open(const std::filesystem::path& path)
+    {
+        m_documents.push_back({m_nextId++, path.filename().string(), path, nullptr, {}, true, 0.0});
+        return m_documents.size() - 1;
+    }
+
+    size_t DocumentManager::create(std::string title, std::string text)
+    {
+        m_documents.push_back({m_nextId++, std::move(title), {}, nullptr, std::move(text), false, 0.0});
+        return m_documents.size() - 1;
+    }
+
+    void DocumentManager::close(const size_t index)
+    {
+        m_documents.erase(m_documents.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    size_t DocumentManager::getCount() const
+    {
+        return m_documents.size();
+    }
+
+    const std::string& DocumentManager::getTitle(const size_t index) const
+    {
+        return m_documents[index].title;
+    }
+
+    uint32_t DocumentManager::getId(const size_t index) const
+    {
+        return m_documents[index].id;
+    }
+
+    bool DocumentManager::isLoaded(const size_t index) const
+    {
+        return m_documents[index].editor != nullptr;
+    }
+
+    ScriptEditor& DocumentManager::activate(const size_t index, const double now)
+    {
+        Document& document = m_documents[index];
+        document.lastActive = now;
+        if (!document.editor) {
+            document.editor = std::make_unique<ScriptEditor>();
+            document.editor->setText(document.matchesFile ? readFile(document.path) : std::move(document.text));
+            // The editor owns the text now
+            document.text = std::string();
+        }
+        return *document.editor;
+    }
+
+    size_t DocumentManager::parkIdle(const double now, const double idleSeconds)
+    {
+        size_t parked = 0;
+        for (Document& document : m_documents) {
+            if (!document.editor || now - document.lastActive < idleSeconds) {
+                continue;
+            }
+
+            // An unedited file is read again on activation; anything else keeps its text
+            if (document.editor->isModified() || !document.matchesFile) {
+                document.text = document.editor->getText();
+                document.matchesFile = false;
+            }
+            document.editor.reset();
+            ++parked;
+        }
+
+        if (parked > 0) {
+            ADS_LOG_DEBUG(Io, "DocumentManager: parked {} idle document(s)", parked);
+        }
+        return parked;
+    }
+
+    std::string DocumentManager::readFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            ADS_LOG_ERROR(Io, "DocumentManager: cannot open {}", path.string());
+            return {};
+        }
+
+        std::string text(static_cast<size_t>(in.tellg()), '\0');
+        in.seekg(0);
+        if (!in.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+            ADS_LOG_ERROR(Io, "DocumentManager: cannot read {}", path.string());
+            return {};
+        }
+        return text;
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#ifndef ADS_DOCUMENT_MANAGER_H
+#define ADS_DOCUMENT_MANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ScriptEditor.h"
+
+namespace ADS::IDE {
+    /**
+     * @brief Documents open in the working area, loaded only while in use
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A document is only a title and where its text comes from until its
+     * tab is first shown: activate() creates the ScriptEditor then, reading
+     * the file if there is one. A document left in the background for a
+     * while is parked by parkIdle(): its editor, with the piece table,
+     * undo history and highlighter cache, is dropped and only the plain
+     * text is kept, or nothing at all if it still matches its file. Opening
+     * hundreds of scripts in a session then costs the text of the edited
+     * ones rather than an editor each.
+     *
+     * @note Parking forgets the undo history of the document
+     */
+    class DocumentManager
+    {
+    public:
+        DocumentManager();
+
+        /**
+         * @brief Add a document read from a file when first activated
+         *
+         * @param path Script file
+         * @return size_t Index of the document
+         */
+        size_t open(const std::filesystem::path& path);
+
+        /**
+         * @brief Add a document with no file
+         *
+         * @param title Tab title
+         * @param text  Initial content
+         * @return size_t Index of the document
+         */
+        size_t create(std::string title, std::string text);
+
+        /**
+         * @brief Remove a document, discarding its text
+         *
+         * @param index Document index; later documents move down by one
+         */
+        void close(size_t index);
+
+        /**
+         * @brief Get the number of documents
+         * @return size_t Open documents, loaded or not
+         */
+        [[nodiscard]] size_t getCount() const;
+
+        /**
+         * @brief Get the tab title of a document
+         */
+        [[nodiscard]] const std::string& getTitle(size_t index) const;
+
+        /**
+         * @brief Get an id that stays with a document while indices change
+         */
+        [[nodiscard]] uint32_t getId(size_t index) const;
+
+        /**
+         * @brief Check whether a document has an editor at the moment
+         */
+        [[nodiscard]] bool isLoaded(size_t index) const;
+
+        /**
+         * @brief Get the editor of a document, loading it if needed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param index Document index
+         * @param now   Current time in seconds, to know when it was last used
+         * @return ScriptEditor& Editor, valid until the document is parked or closed
+         */
+        ScriptEditor& activate(size_t index, double now);
+
+        /**
+         * @brief Park the documents not activated for a while
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param now         Current time in seconds
+         * @param idleSeconds Time since the last activation before a document is parked
+         * @return size_t Documents parked by this call
+         */
+        size_t parkIdle(double now, double idleSeconds);
+
+    private:
+        /**
+         * @brief One open document
+         */
+        struct Document
+        {
+            uint32_t id;
+            std::string title;
+            std::filesystem::path path;             ///< Empty for documents with no file
+            std::unique_ptr<ScriptEditor> editor;   ///< Null until activated and after parking
+            std::string text;                       ///< Content while unloaded, unless read from path
+            bool matchesFile;                       ///< Content is still that of path
+            double lastActive;
+        };
+
+        std::vector<Document> m_documents;
+        uint32_t m_nextId;
+
+        /**
+         * @brief Read a whole script file
+         * @return std::string Its content; empty, with an error logged, if it cannot be read
+         */
+        static std::string readFile(const std::filesystem::path& path);
+    };
+}
+
+#endif //ADS_DOCUMENT_MANAGER_H
@@ -0,0 +1,225 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file FrameProfiler.cpp
+ * @brief Implementation of the FrameProfiler class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "FrameProfiler.h"
+#include "imgui.h"
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+namespace ADS::IDE {
+    namespace {
+        double toMs(const std::chrono::steady_clock::duration duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+
+        /**
+         * Stable color per scope name, so a panel keeps its color between frames
+         */
+        ImU32 colorOf(const char* name)
+        {
+            const size_t hash = std::hash<std::string_view>{}(name);
+            const float hue = static_cast<float>(hash % 360) / 360.0f;
+            float r, g, b;
+            ImGui::ColorConvertHSVtoRGB(hue, 0.55f, 0.80f, r, g, b);
+            return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+        }
+    }
+
+    FrameProfiler::Scope::Scope(FrameProfiler& profiler, const char* name)
+        : m_profiler(profiler), m_start(Clock::now())
+    {
+        m_index = m_profiler.enter(name, m_start);
+    }
+
+    FrameProfiler::Scope::~Scope()
+    {
+        m_profiler.leave(m_index, m_start, Clock::now());
+    }
+
+    FrameProfiler::FrameProfiler()
+        : m_frameStart(Clock::now()), m_cursor(0), m_frames(0), m_lastFrameMs(0.0)
+    {
+    }
+
+    void FrameProfiler::beginFrame()
+    {
+        m_frameStart = Clock::now();
+        m_open.clear();
+    }
+
+    void FrameProfiler::endFrame()
+    {
+        m_lastFrameMs = toMs(Clock::now() - m_frameStart);
+
+        for (Entry& entry : m_entries) {
+            entry.samples[m_cursor] = static_cast<float>(entry.frameMs);
+            entry.lastStartMs = std::max(entry.startMs, 0.0);
+            entry.frameMs = 0.0;
+            entry.startMs = -1.0;
+        }
+        m_cursor = (m_cursor + 1) % HISTORY;
+        m_frames = std::min(m_frames + 1, HISTORY);
+    }
+
+    uint32_t FrameProfiler::enter(const char* name, const Clock::time_point now)
+    {
+        const uint32_t parent = m_open.empty() ? NO_PARENT : m_open.back();
+
+        // A handful of scopes per frame: a linear search beats hashing
+        auto found = std::ranges::find_if(m_entries, [name, parent](const Entry& entry) {
+            return entry.name == name && entry.parent == parent;
+        });
+        uint32_t index = static_cast<uint32_t>(found - m_entries.begin());
+        if (found == m_entries.end()) {
+            Entry& entry = m_entries.emplace_back();
+            entry.name = name;
+            entry.parent = parent;
+            entry.depth = (parent == NO_PARENT) ? 0 : m_entries[parent].depth + 1;
+        }
+
+        Entry& entry = m_entries[index];
+        if (entry.startMs < 0.0) {
+            entry.startMs = toMs(now - m_frameStart);
+        }
+        m_open.push_back(index);
+
+        return index;
+    }
+
+    void FrameProfiler::leave(const uint32_t index, const Clock::time_point start, const Clock::time_point now)
+    {
+        m_entries[index].frameMs += toMs(now - start);
+        if (!m_open.empty() && m_open.back() == index) {
+            m_open.pop_back();
+        }
+    }
+
+    std::vector<FrameProfiler::Stats> FrameProfiler::getStats() const
+    {
+        std::vector<Stats> stats;
+        stats.reserve(m_entries.size());
+        std::vector<float> history;
+        history.reserve(HISTORY);
+
+        // Scopes are numbered as first seen; list each one right after its parent
+        std::function<void(uint32_t)> addChildren = [&](const uint32_t parent) {
+            for (uint32_t index = 0; index < m_entries.size(); ++index) {
+                const Entry& entry = m_entries[index];
+                if (entry.parent != parent) {
+                    continue;
+                }
+
+                const size_t last = (m_cursor + HISTORY - 1) % HISTORY;
+                history.assign(entry.samples.begin(), entry.samples.begin() + static_cast<std::ptrdiff_t>(m_frames));
+                double p50 = 0.0;
+                double p99 = 0.0;
+                if (!history.empty()) {
+                    const size_t median = (history.size() - 1) / 2;
+                    const size_t tail = (history.size() - 1) * 99 / 100;
+                    std::ranges::nth_element(history, history.begin() + static_cast<std::ptrdiff_t>(median));
+                    p50 = history[median];
+                    std::ranges::nth_element(history, history.begin() + static_cast<std::ptrdiff_t>(tail));
+                    p99 = history[tail];
+                }
+
+                stats.push_back({entry.name, entry.depth, entry.samples[last], entry.lastStartMs, p50, p99});
+                addChildren(index);
+            }
+        };
+        addChildren(NO_PARENT);
+
+        return stats;
+    }
+
+    double FrameProfiler::getFrameMs() const
+    {
+        return m_lastFrameMs;
+    }
+
+    void FrameProfiler::renderOverlay(const char* title, bool* open) const
+    {
+        ImGui::SetNextWindowSize(ImVec2(520.0f, 360.0f), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin(title, open)) {
+            ImGui::End();
+            return;
+        }
+
+        const std::vector<Stats> stats = getStats();
+        ImGui::Text("Frame: %.2f ms", m_lastFrameMs);
+
+        // Flame graph of the last frame: x is time from the frame start, y the depth
+        uint32_t depths = 0;
+        for (const Stats& scope : stats) {
+            depths = std::max(depths, scope.depth + 1);
+        }
+        const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+        const float width = ImGui::GetContentRegionAvail().x;
+        const float scale = (m_lastFrameMs > 0.0) ? width / static_cast<float>(m_lastFrameMs) : 0.0f;
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        const char* hovered = nullptr;
+        double hoveredMs = 0.0;
+
+        for (const Stats& scope : stats) {
+            const ImVec2 min(origin.x + static_cast<float>(scope.startMs) * scale,
+                             origin.y + static_cast<float>(scope.depth) * rowHeight);
+            const ImVec2 max(min.x + std::max(static_cast<float>(scope.lastMs) * scale, 1.0f),
+                             min.y + rowHeight - 1.0f);
+            drawList->AddRectFilled(min, max, colorOf(scope.name));
+            drawList->PushClipRect(min, max, true);
+            drawList->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32_BLACK, scope.name);
+            drawList->PopClipRect();
+            if (ImGui::IsMouseHoveringRect(min, max)) {
+                hovered = scope.name;
+                hoveredMs = scope.lastMs;
+            }
+        }
+        ImGui::Dummy(ImVec2(width, static_cast<float>(depths) * rowHeight));
+        if (hovered != nullptr && ImGui::IsWindowHovered()) {
+            ImGui::SetTooltip("%s: %.3f ms", hovered, hoveredMs);
+        }
+
+        ImGui::Separator();
+        if (ImGui::BeginTable("##scopes", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_ScrollY)) {
+            ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Last", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableHeadersRow();
+
+            for (const Stats& scope : stats) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%*s%s", static_cast<int>(scope.depth) * 2, "", scope.name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.lastMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.p50Ms);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.p99Ms);
+            }
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }
+}
@@ -0,0 +1,181 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#ifndef ADS_FRAME_PROFILER_H
+#define ADS_FRAME_PROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ADS::IDE {
+    /**
+     * @brief CPU time of named scopes over the last frames
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Scopes are timed with the RAII Scope helper between beginFrame() and
+     * endFrame(). A scope opened inside another one is its child, so the
+     * same name under two parents is two scopes. Each scope keeps its time
+     * of the last HISTORY frames in a ring buffer, from which the overlay
+     * shows a flame-style breakdown of the last frame and the p50 and p99
+     * of every scope.
+     *
+     * Timing costs two steady_clock reads per scope and no allocation once
+     * every scope has been seen, so it stays on in release builds.
+     *
+     * @note Not thread-safe: scopes must be opened on the UI thread
+     */
+    class FrameProfiler
+    {
+    public:
+        /**
+         * Frames kept per scope.
+         */
+        static constexpr size_t HISTORY = 256;
+
+        /**
+         * @brief Times the enclosing block as a scope of the profiler
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         */
+        class Scope
+        {
+        public:
+            /**
+             * @param profiler Profiler the time is added to
+             * @param name Scope label; must outlive the profiler (a string literal)
+             */
+            Scope(FrameProfiler& profiler, const char* name);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            FrameProfiler& m_profiler;
+            uint32_t m_index;
+            std::chrono::steady_clock::time_point m_start;
+        };
+
+        /**
+         * @brief Timing of one scope, as shown by the overlay
+         */
+        struct Stats
+        {
+            const char* name;
+            uint32_t depth;         ///< 0 for top-level scopes
+            double lastMs;          ///< Time in the last frame
+            double startMs;         ///< First entry in the last frame, from the frame start
+            double p50Ms;
+            double p99Ms;
+        };
+
+        FrameProfiler();
+
+        /**
+         * @brief Start timing a frame
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         */
+        void beginFrame();
+
+        /**
+         * @brief Store the time of every scope for the frame just finished
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Scopes not entered during the frame store 0, so the percentiles of
+         * a hidden panel drop instead of showing stale times.
+         */
+        void endFrame();
+
+        /**
+         * @brief Timing of every scope, parents before their children
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Sorts a copy of each history, so call it only when the numbers are
+         * shown.
+         *
+         * @return std::vector<Stats> One entry per scope, depth-first
+         */
+        [[nodiscard]] std::vector<Stats> getStats() const;
+
+        /**
+         * @brief Length of the last frame
+         * @return double Milliseconds from beginFrame() to endFrame()
+         */
+        [[nodiscard]] double getFrameMs() const;
+
+        /**
+         * @brief Draw the profiler window
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Shows the last frame as a flame graph, one row per depth with the
+         * children under their parent, and below it a table with the last,
+         * p50 and p99 time of every scope.
+         *
+         * @param title Window title
+         * @param open Cleared when the user closes the window
+         */
+        void renderOverlay(const char* title, bool* open) const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+        /**
+         * @brief One named scope under one parent
+         */
+        struct Entry
+        {
+            const char* name;
+            uint32_t parent;
+            uint32_t depth;
+            std::array<float, HISTORY> samples{};   ///< Milliseconds per frame, ring buffer
+            double frameMs = 0.0;                   ///< Accumulated in the current frame
+            double startMs = -1.0;                  ///< First entry in the current frame, -1 if not entered
+            double lastStartMs = 0.0;
+        };
+
+        std::vector<Entry> m_entries;
+        std::vector<uint32_t> m_open;               ///< Scopes entered and not left yet
+        Clock::time_point m_frameStart;
+        size_t m_cursor;                            ///< Next sample written in every ring
+        size_t m_frames;                            ///< Frames recorded, up to HISTORY
+        double m_lastFrameMs;
+
+        /**
+         * @brief Find or add the scope for a name under the innermost open scope
+         */
+        uint32_t enter(const char* name, Clock::time_point now);
+
+        /**
+         * @brief Add the time spent in a scope to the current frame
+         */
+        void leave(uint32_t index, Clock::time_point start, Clock::time_point now);
+    };
+}
+
+#endif //ADS_FRAME_PROFILER_H
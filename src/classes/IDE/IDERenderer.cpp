@@ -12,8 +12,19 @@
 
 
 #include "IDERenderer.h"
+#include "app.h"
+#include "MemoryMonitor.h"
+#include "Core/EntityClipboard.h"
+#include "Core/IdGenerator.h"
+#include "Core/Profiling.h"
+#include "Core/ProjectGenerator.h"
+#include "Core/ProjectStorage.h"
 #include "imgui.h"
 #include "spdlog/spdlog.h"
+#include "Logger/logger.h"
+#include <algorithm>
+#include <string_view>
+#include <variant>
 
 namespace ADS::IDE {
     IDERenderer::IDERenderer() : IDEBase(),
@@ -24,7 +35,14 @@ namespace ADS::IDE {
         m_entitiesPanel(nullptr),
         m_inspectorPanel(nullptr),
         m_workingAreaPanel(nullptr),
-        m_project(nullptr)
+        m_validationPanel(nullptr),
+        m_watchPanel(nullptr),
+        m_project(nullptr),
+        m_autosaveElapsed(0.0f),
+        m_syncAddedEntities(0),
+        m_showProfiler(false),
+        m_showMemory(false),
+        m_projectGlyphsPending(false)
     {
         initializePanels();
     }
@@ -35,9 +53,12 @@ namespace ADS::IDE {
         delete m_entitiesPanel;
         delete m_inspectorPanel;
         delete m_workingAreaPanel;
+        delete m_validationPanel;
+        delete m_watchPanel;
         delete m_toolBarRenderer;
         delete m_menuBarRenderer;
         delete m_layoutManager;
+        m_syncSession.detach();
         delete m_project;
     }
 
@@ -53,20 +74,40 @@ namespace ADS::IDE {
         m_entitiesPanel = new Panels::EntitiesPanel();
         m_inspectorPanel = new Panels::InspectorPanel();
         m_workingAreaPanel = new Panels::WorkingAreaPanel();
+        m_validationPanel = new Panels::ValidationPanel();
+        m_watchPanel = new Panels::WatchPanel();
 
         // Create project with demo entities
         m_project = new Core::Project("Demo Project");
-        m_project->addScene("scene_1", "Forest Entrance");
-        m_project->addScene("scene_2", "Dark Cave");
-        m_project->addCharacter("char_1", "Hero");
-        m_project->addCharacter("char_2", "Merchant");
-        m_project->addItem("item_1", "Magic Sword");
-        m_project->addItem("item_2", "Health Potion");
+        m_project->addScene(Core::IdGenerator::makeEntityId("scene"), "Forest Entrance");
+        m_project->addScene(Core::IdGenerator::makeEntityId("scene"), "Dark Cave");
+        m_project->addCharacter(Core::IdGenerator::makeEntityId("char"), "Hero");
+        m_project->addCharacter(Core::IdGenerator::makeEntityId("char"), "Merchant");
+        m_project->addItem(Core::IdGenerator::makeEntityId("item"), "Magic Sword");
+        m_project->addItem(Core::IdGenerator::makeEntityId("item"), "Health Potion");
+
+        watchProjectGlyphs();
 
         // Wire panels: entity click → inspector update
         m_entitiesPanel->setProject(m_project);
-        m_entitiesPanel->setSelectionCallback([this](Inspector::IInspectable* entity) {
-            m_inspectorPanel->setSelectedObject(entity);
+        m_entitiesPanel->setSelectionCallback([this](std::span<const Core::EntityHandle> handles) {
+            selectEntities(handles);
+        });
+
+        // Wire panels: canvas pick or marquee → inspector update
+        m_workingAreaPanel->setSelectionCallback([this](std::span<const Core::EntityHandle> handles) {
+            selectEntities(handles);
+        });
+
+        // Wire panels: issue click → inspector update
+        m_validationPanel->setProject(m_project);
+        m_validationPanel->setSelectionCallback([this](Core::EntityHandle handle) {
+            selectEntities({&handle, 1});
+        });
+
+        // Wire panels: multi-selection edit → one batched project change
+        m_inspectorPanel->setBatchEditCallback([this](const std::string& propertyId, const Inspector::PropertyValue& value) {
+            if (m_project) m_project->setPropertyValues(m_selectedHandles, propertyId, value);
         });
 
         // Wire navigation: File > New checks project state and can create a new one
@@ -78,16 +119,58 @@ namespace ADS::IDE {
         // Wire file I/O: receive paths selected by the native OS dialogs
         m_menuBarRenderer->setFileCallbacks(
             [this](const std::string& path) {
-                // TODO: implement project deserialisation from path
-                spdlog::info("IDERenderer: open project requested — {}", path);
-                m_project->setFilePath(path);
+                ADS_LOG_INFO(Project, "IDERenderer: open project requested — {}", path);
+                try {
+                    setActiveProject(Core::ProjectStorage::load(path).release());
+                } catch (const std::exception& e) {
+                    ADS_LOG_ERROR(Project, "IDERenderer: cannot open project — {}", e.what());
+                }
             },
             [this](const std::string& path) {
-                // TODO: implement project serialisation to path
-                spdlog::info("IDERenderer: save project requested — {}", path);
-                m_project->setFilePath(path);
+                ADS_LOG_INFO(Project, "IDERenderer: save project requested — {}", path);
+                if (!m_backgroundSaver.start(*m_project, path)) {
+                    ADS_LOG_WARN(Project, "IDERenderer: a save is already in progress — {}", m_backgroundSaver.getPath().string());
+                }
             }
         );
+
+        // Wire File > Import: parsed on the pool, inserted by update(), cancelled from the status bar
+        m_menuBarRenderer->setImportCallback([this](const std::string& path) { this->importFile(path); });
+        m_statusBarPanel->setImportCancelCallback([this]() { m_importer.cancel(); });
+
+        // Wire Edit > Undo / Redo to the active project's history
+        m_menuBarRenderer->setEditCallbacks(
+            [this]() { if (m_project && m_project->undo()) m_inspectorPanel->refresh(); },
+            [this]() { if (m_project && m_project->redo()) m_inspectorPanel->refresh(); }
+        );
+
+        // Wire Edit > Copy / Paste: entity sets, binary within the IDE and JSON outside it
+        m_menuBarRenderer->setClipboardCallbacks(
+            [this]() { this->copySelection(); },
+            [this]() { this->pasteClipboard(); }
+        );
+        m_menuBarRenderer->setProfilerVisibility(&m_showProfiler);
+        m_menuBarRenderer->setMemoryVisibility(&m_showMemory);
+
+        // Wire View > Generate Test Project: built on the pool, installed on the main thread
+        m_menuBarRenderer->setGeneratorCallback([this](const size_t entities) {
+            ADS_LOG_INFO(Project, "IDERenderer: generating a test project — {} entities", entities);
+            Core::JobSystem* jobs = Core::App::getJobSystem();
+            if (jobs == nullptr) {
+                setActiveProject(Core::ProjectGenerator::generate(Core::ProjectGenerator::forEntities(entities)).release());
+                return;
+            }
+            auto generated = std::make_shared<std::unique_ptr<Core::Project>>();
+            const auto job = jobs->submit([generated, entities, jobs]() {
+                *generated = Core::ProjectGenerator::generate(Core::ProjectGenerator::forEntities(entities), jobs);
+            });
+            jobs->then(job, [this, generated]() {
+                if (*generated) setActiveProject(generated->release());
+            }, Core::JobSystem::Lane::Main);
+        });
+
+        m_syncSession.attach(*m_project);
+        startSync();
     }
 
     void IDERenderer::renderMainWindow()
@@ -159,11 +242,11 @@ namespace ADS::IDE {
      * @brief Execute any deferred native file dialogs
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Feb 2026
+     * @version Oct 2026
      *
      * Delegates to MenuBarRenderer::processPendingDialogs(). Called by App::run()
-     * after render() (i.e. after SDL_RenderPresent) so the compositor has a clean
-     * frame before the blocking NFD call freezes the main thread.
+     * after render() (i.e. after SDL_RenderPresent) on every loop iteration,
+     * so the answer of a closed dialog is delivered on the next one.
      *
      * @see MenuBarRenderer::processPendingDialogs()
      */
@@ -173,30 +256,380 @@ namespace ADS::IDE {
     }
 
     void IDERenderer::newProject()
+    {
+        // New project starts with no file path
+        setActiveProject(new Core::Project("New Project"));
+    }
+
+    /**
+     * @brief Replace the active project with the given instance
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Clears the inspector selection before the old project (and the entities
+     * the inspector may reference) is deleted, then points the entities panel
+     * at the new data source.
+     *
+     * @param project Newly allocated project; ownership is transferred
+     */
+    void IDERenderer::setActiveProject(Core::Project* project)
     {
         // Clear inspector before destroying the entities it might reference
         m_inspectorPanel->clearSelection();
+        m_selectedHandles.clear();
+
+        // A save still running for the old project must not touch it once deleted
+        m_backgroundSaver.detach();
+
+        // An import only ever fills the project it started on
+        m_importer.cancel();
+
+        // Stop a validation pass and drop its issues, whose handles belong to the old project
+        m_validationPanel->setProject(project);
+
+        // The scene preview listens to the old project
+        m_workingAreaPanel->showScene(nullptr, Core::EntityHandle());
+
+        // Remote edits only make sense against the project they were made on
+        m_syncSession.detach();
 
-        // Replace the project (new project starts with no file path)
         delete m_project;
-        m_project = new Core::Project("New Project");
+        m_project = project;
+        watchProjectGlyphs();
+        if (m_project != nullptr) {
+            m_syncSession.attach(*m_project);
+        }
 
-        // Refresh the entities panel with the empty project
+        // Refresh the entities panel with the new project
         m_entitiesPanel->setProject(m_project);
     }
 
+    /**
+     * @brief Have the fonts follow the text of the active project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The subscriptions of the previous project went away with it, so the
+     * handles are only dropped. The font manager is looked up when text
+     * arrives, since it is set after the IDE is created.
+     */
+    void IDERenderer::watchProjectGlyphs()
+    {
+        m_glyphSubscriptions.clear();
+        m_projectGlyphsPending = m_project != nullptr;
+        if (!m_project) {
+            return;
+        }
+
+        const auto addText = [this](Core::EntityHandle, const Inspector::PropertyChangedEvent& event) {
+            const auto* text = std::get_if<std::string>(&event.newValue);
+            if (UI::Fonts* fonts = getFontManager(); text != nullptr && fonts != nullptr) {
+                fonts->addGlyphs(*text);
+            }
+        };
+        for (const Core::EntityKind kind : {Core::EntityKind::Scene, Core::EntityKind::Character, Core::EntityKind::Item}) {
+            m_glyphSubscriptions.push_back(m_project->subscribe(kind, "", addText, Inspector::DispatchMode::Deferred));
+        }
+    }
+
+    void IDERenderer::selectEntities(std::span<const Core::EntityHandle> handles)
+    {
+        m_selectedHandles.clear();
+        std::vector<Inspector::IInspectable*> objects;
+        for (const Core::EntityHandle handle : handles) {
+            if (Entities::BaseEntity* entity = m_project ? m_project->resolve(handle) : nullptr) {
+                m_selectedHandles.push_back(handle);
+                objects.push_back(entity);
+            }
+        }
+        m_inspectorPanel->setSelectedObjects(objects);
+
+        // A single selected scene is previewed; other selections leave the preview as it is
+        if (m_selectedHandles.size() == 1 && m_selectedHandles.front().kind() == Core::EntityKind::Scene) {
+            m_workingAreaPanel->showScene(m_project, m_selectedHandles.front());
+        }
+    }
+
+    void IDERenderer::copySelection()
+    {
+        if (m_project == nullptr || m_selectedHandles.empty()) {
+            return;
+        }
+        m_clipboardPayload = Core::EntityClipboard::copy(*m_project, m_selectedHandles);
+        m_clipboardText = Core::EntityClipboard::toJson(m_clipboardPayload);
+        ImGui::SetClipboardText(m_clipboardText.c_str());
+        ADS_LOG_INFO(Project, "IDERenderer: copied {} entities — {} bytes", m_selectedHandles.size(), m_clipboardPayload.size());
+    }
+
+    void IDERenderer::pasteClipboard()
+    {
+        if (m_project == nullptr) {
+            return;
+        }
+        const char* text = ImGui::GetClipboardText();
+        const std::string_view clipboard = text != nullptr ? text : "";
+        const bool ours = !m_clipboardPayload.empty() && clipboard == m_clipboardText;
+        if (!ours && clipboard.empty()) {
+            return;
+        }
+        try {
+            const Core::PasteResult result = Core::EntityClipboard::paste(*m_project, ours ? m_clipboardPayload : clipboard);
+            ADS_LOG_INFO(Project, "IDERenderer: pasted {} entities — {} renamed, {} exits",
+                         result.entities.size(), result.renamed, result.exits);
+            selectEntities(result.entities);
+        } catch (const std::exception& e) {
+            ADS_LOG_WARN(Project, "IDERenderer: cannot paste the clipboard — {}", e.what());
+        }
+    }
+
+    void IDERenderer::importFile(const std::string& path)
+    {
+        if (m_importer.isBusy()) {
+            ADS_LOG_WARN(Project, "IDERenderer: an import is already in progress — {}", m_importer.getPath().string());
+            return;
+        }
+        if (m_project == nullptr) {
+            newProject();
+        }
+        try {
+            m_importer.start(path, Core::App::getJobSystem());
+            ADS_LOG_INFO(Project, "IDERenderer: importing — {}", path);
+        } catch (const std::exception& e) {
+            ADS_LOG_ERROR(Project, "IDERenderer: cannot import — {}", e.what());
+            m_statusBarPanel->showMessage(std::string(getTranslationManager()->_t(i18n::Key::STATUS_IMPORT_FAILED)));
+        }
+    }
+
+    void IDERenderer::startSync()
+    {
+        const std::shared_ptr<const Config> settings = getEnvironment()->getConfig();
+        const Config& config = *settings;
+        if (config.syncPort == 0) {
+            return;
+        }
+
+        // Frames arrive on the network thread; wake the loop so pollSync() applies them
+        m_syncConnection = std::make_unique<Core::SyncConnection>();
+        try {
+            if (config.syncHost.empty()) {
+                m_syncConnection->host(config.syncPort, []() { Core::App::requestRedraw(); });
+                ADS_LOG_INFO(Io, "IDERenderer: hosting collaborative session on port {}", m_syncConnection->getPort());
+            } else {
+                m_syncConnection->join(config.syncHost, config.syncPort, []() { Core::App::requestRedraw(); });
+                ADS_LOG_INFO(Io, "IDERenderer: joining collaborative session at {}:{}", config.syncHost, config.syncPort);
+            }
+        } catch (const std::exception& e) {
+            ADS_LOG_ERROR(Io, "IDERenderer: cannot start collaborative session — {}", e.what());
+            m_syncConnection.reset();
+        }
+    }
+
+    void IDERenderer::pollSync()
+    {
+        if (!m_syncConnection || !m_syncSession.isAttached()) {
+            return;
+        }
+
+        std::vector<std::string> payloads;
+        m_syncConnection->receive(payloads);
+        for (const std::string& payload : payloads) {
+            try {
+                m_syncSession.receive(payload);
+            } catch (const std::exception& e) {
+                ADS_LOG_WARN(Io, "IDERenderer: dropped a malformed sync batch — {}", e.what());
+            }
+        }
+        m_syncSession.applyRemote();
+
+        // Bulk adds raise no property events, so the glyph subscriptions did not see the new names
+        const size_t added = m_syncSession.getStats().addedEntities;
+        if (added != m_syncAddedEntities) {
+            m_syncAddedEntities = added;
+            m_projectGlyphsPending = true;
+        }
+
+        if (std::string outgoing = m_syncSession.takeOutgoing(); !outgoing.empty()) {
+            m_syncConnection->send(std::move(outgoing));
+        }
+    }
+
+    /**
+     * @brief Advance time-based IDE state
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Adds the entity names of a newly active project to the font glyphs
+     * once the font manager exists. Finishes a background save once its
+     * worker is done and mirrors its progress in the status bar, and
+     * inserts the next batch of a running import the same way. Then drives the autosave timer: when the
+     * interval elapses the pending changes of the active project are
+     * appended to its journal; this only touches the entities that changed,
+     * so it is cheap enough to keep on. Autosave waits while a full save is
+     * running, since that save discards the journal when it completes.
+     *
+     * @param deltaSeconds Time elapsed since the previous frame
+     * @see Core::BackgroundSaver::poll(), Core::ProjectStorage::autosave()
+     */
+    void IDERenderer::update(float deltaSeconds)
+    {
+        if (m_project != nullptr) {
+            ADS_PLOT("Entities", m_project->getScenes().size() + m_project->getCharacters().size() +
+                                 m_project->getItems().size());
+            ADS_PLOT("Queued events", m_project->getPendingEventCount());
+        }
+
+        if (m_projectGlyphsPending) {
+            if (UI::Fonts* fonts = getFontManager()) {
+                for (const auto& scene : m_project->getScenes()) {
+                    fonts->addGlyphs(scene->getName());
+                }
+                for (const auto& character : m_project->getCharacters()) {
+                    fonts->addGlyphs(character->getName());
+                }
+                for (const auto& item : m_project->getItems()) {
+                    fonts->addGlyphs(item->getName());
+                }
+                m_projectGlyphsPending = false;
+            }
+        }
+
+        if (m_backgroundSaver.poll()) {
+            if (m_backgroundSaver.getState() == Core::BackgroundSaver::State::Succeeded) {
+                ADS_LOG_INFO(Project, "IDERenderer: saved project — {}", m_backgroundSaver.getPath().string());
+                m_statusBarPanel->showMessage(std::string(getTranslationManager()->_t(i18n::Key::STATUS_SAVED)));
+            } else {
+                ADS_LOG_ERROR(Project, "IDERenderer: cannot save project — {}", m_backgroundSaver.getError());
+                m_statusBarPanel->showMessage(std::string(getTranslationManager()->_t(i18n::Key::STATUS_SAVE_FAILED)));
+            }
+        }
+        m_statusBarPanel->setSaveProgress(m_backgroundSaver.isBusy()
+            ? std::optional<float>(m_backgroundSaver.getProgress())
+            : std::nullopt);
+
+        if (m_project != nullptr && m_importer.poll(*m_project)) {
+            const Core::ImportSummary& summary = m_importer.getSummary();
+            std::string text;
+            switch (m_importer.getState()) {
+                case Core::ProjectImporter::State::Succeeded:
+                    ADS_LOG_INFO(Project, "IDERenderer: imported {} entities — {} renamed, {} exits, {} skipped — {}",
+                                 summary.entities, summary.renamed, summary.exits, summary.skipped, m_importer.getPath().string());
+                    m_statusBarPanel->showMessage(std::string(getTranslationManager()->formatTo(text, i18n::Key::STATUS_IMPORTED,
+                        i18n::arg("count", summary.entities))));
+                    break;
+                case Core::ProjectImporter::State::Cancelled:
+                    ADS_LOG_INFO(Project, "IDERenderer: import cancelled after {} entities — {}", summary.entities, m_importer.getPath().string());
+                    m_statusBarPanel->showMessage(std::string(getTranslationManager()->_t(i18n::Key::STATUS_IMPORT_CANCELLED)));
+                    break;
+                default:
+                    ADS_LOG_ERROR(Project, "IDERenderer: cannot import — {}", m_importer.getError());
+                    m_statusBarPanel->showMessage(std::string(getTranslationManager()->_t(i18n::Key::STATUS_IMPORT_FAILED)));
+                    break;
+            }
+            // Bulk adds raise no property events, so the glyph subscriptions did not see the new names
+            m_projectGlyphsPending = true;
+        }
+        m_statusBarPanel->setImportProgress(m_importer.isBusy()
+            ? std::optional<float>(m_importer.getProgress())
+            : std::nullopt);
+
+        pollSync();
+
+        // Autosave interval in seconds; 0 disables autosave. Read every frame so a reloaded .env applies at once
+        const float autosaveInterval = getEnvironment()->getConfig()->autosaveInterval;
+        if (autosaveInterval <= 0.0f || m_project == nullptr || m_backgroundSaver.isBusy()) {
+            return;
+        }
+
+        m_autosaveElapsed += deltaSeconds;
+        if (m_autosaveElapsed < autosaveInterval) {
+            return;
+        }
+        m_autosaveElapsed = 0.0f;
+
+        try {
+            if (Core::ProjectStorage::autosave(*m_project)) {
+                ADS_LOG_INFO(Project, "IDERenderer: autosaved project — {}", m_project->getFilePath().string());
+            }
+        } catch (const std::exception& e) {
+            ADS_LOG_ERROR(Project, "IDERenderer: autosave failed — {}", e.what());
+        }
+    }
+
+    /**
+     * @brief Check whether the IDE changes from frame to frame by itself
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return bool True while a background save or an import runs, or sync edits are waiting
+     */
+    bool IDERenderer::needsContinuousRendering() const
+    {
+        return m_backgroundSaver.isBusy() || m_importer.isBusy()
+            || (m_syncConnection && (m_syncSession.hasOutgoing() || m_syncSession.getPendingRemoteOps() > 0));
+    }
+
     void IDERenderer::render()
     {
+        // Drop removed entities from the inspector selection
+        if (std::ranges::any_of(m_selectedHandles, [this](Core::EntityHandle handle) {
+                return m_project == nullptr || m_project->resolve(handle) == nullptr;
+            })) {
+            const std::vector<Core::EntityHandle> remaining = m_selectedHandles;
+            selectEntities(remaining);
+        }
+
+        FrameProfiler::Scope scope(m_profiler, "IDERenderer::render");
+
         // Render main dockspace window (with menu bar and toolbar)
-        renderMainWindow();
+        {
+            FrameProfiler::Scope panel(m_profiler, "MainWindow");
+            renderMainWindow();
+        }
 
         // Render status bar at the bottom
-        m_statusBarPanel->render();
+        {
+            FrameProfiler::Scope panel(m_profiler, "StatusBarPanel");
+            m_statusBarPanel->render();
+        }
 
         // Render all dockable panels
-        m_entitiesPanel->render();
-        m_inspectorPanel->render();
-        m_workingAreaPanel->render();
+        {
+            FrameProfiler::Scope panel(m_profiler, "EntitiesPanel");
+            m_entitiesPanel->render();
+        }
+        {
+            FrameProfiler::Scope panel(m_profiler, "InspectorPanel");
+            m_inspectorPanel->render();
+        }
+        {
+            FrameProfiler::Scope panel(m_profiler, "WorkingAreaPanel");
+            m_workingAreaPanel->render();
+        }
+        {
+            FrameProfiler::Scope panel(m_profiler, "ValidationPanel");
+            m_validationPanel->render();
+        }
+        {
+            FrameProfiler::Scope panel(m_profiler, "WatchPanel");
+            m_watchPanel->render();
+        }
+
+        // Deliver the frame's coalesced entity events to deferred listeners
+        if (m_project) {
+            FrameProfiler::Scope events(m_profiler, "Project::flushEvents");
+            m_project->flushEvents();
+        }
+
+        if (m_showProfiler) {
+            m_profiler.renderOverlay(getTranslationManager()->_t(i18n::Key::MENU_VIEW_PROFILER).data(), &m_showProfiler);
+        }
+        if (m_showMemory) {
+            MemoryMonitor::renderOverlay(getTranslationManager()->_t(i18n::Key::MENU_VIEW_MEMORY).data(), &m_showMemory);
+        }
     }
 
     Panels::StatusBarPanel *IDERenderer::getStatusBar() const
@@ -214,8 +647,23 @@ namespace ADS::IDE {
         return m_inspectorPanel;
     }
 
+    Panels::ValidationPanel *IDERenderer::getValidationPanel() const
+    {
+        return m_validationPanel;
+    }
+
+    Panels::WatchPanel *IDERenderer::getWatchPanel() const
+    {
+        return m_watchPanel;
+    }
+
     Panels::WorkingAreaPanel *IDERenderer::getWorkingAreaPanel() const
     {
         return m_workingAreaPanel;
     }
+
+    FrameProfiler &IDERenderer::getProfiler()
+    {
+        return m_profiler;
+    }
 }
@@ -15,6 +15,7 @@
 #define ADS_IDE_RENDERER_H
 
 #include "IDEBase.h"
+#include "FrameProfiler.h"
 #include "LayoutManager.h"
 #include "navigation/MenuBarRenderer.h"
 #include "navigation/ToolBarRenderer.h"
@@ -22,7 +23,17 @@
 #include "panels/EntitiesPanel.h"
 #include "panels/InspectorPanel.h"
 #include "panels/WorkingAreaPanel.h"
+#include "panels/ValidationPanel.h"
+#include "panels/WatchPanel.h"
+#include "Core/BackgroundSaver.h"
 #include "Core/Project.h"
+#include "Core/ProjectImporter.h"
+#include "Core/SyncConnection.h"
+#include "Core/SyncSession.h"
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
 
 namespace ADS::IDE {
     /**
@@ -73,11 +84,91 @@ namespace ADS::IDE {
          */
         Panels::WorkingAreaPanel *m_workingAreaPanel;
 
+        /**
+         * Validation panel below the working area
+         */
+        Panels::ValidationPanel *m_validationPanel;
+
+        /**
+         * Watch panel next to the validation panel, fed by whoever runs the game
+         */
+        Panels::WatchPanel *m_watchPanel;
+
         /**
          * Owning pointer to the active project (created in initializePanels)
          */
         Core::Project *m_project;
 
+        /**
+         * @brief Handles of the entities shown in the inspector
+         */
+        std::vector<Core::EntityHandle> m_selectedHandles;
+
+        /**
+         * @brief Binary payload of the last Edit > Copy
+         */
+        std::string m_clipboardPayload;
+
+        /**
+         * @brief JSON put on the system clipboard by the last Edit > Copy
+         */
+        std::string m_clipboardText;
+
+        /**
+         * @brief Seconds accumulated since the last autosave
+         */
+        float m_autosaveElapsed;
+
+        /**
+         * @brief Writes File > Save requests on a worker thread
+         */
+        Core::BackgroundSaver m_backgroundSaver;
+
+        /**
+         * @brief Streams File > Import sources into the active project
+         */
+        Core::ProjectImporter m_importer;
+
+        /**
+         * @brief Link to the other designers of the project, null unless SYNC_PORT is set
+         */
+        std::unique_ptr<Core::SyncConnection> m_syncConnection;
+
+        /**
+         * @brief Exchanges the edits of the active project over m_syncConnection
+         */
+        Core::SyncSession m_syncSession;
+
+        /**
+         * @brief SyncStats::addedEntities when update() last looked
+         */
+        size_t m_syncAddedEntities;
+
+        /**
+         * @brief CPU time of the IDE, its panels and App::render() per frame
+         */
+        FrameProfiler m_profiler;
+
+        /**
+         * @brief Whether the profiler window is shown, toggled from View
+         */
+        bool m_showProfiler;
+
+        /**
+         * @brief Whether the memory window is shown, toggled from View
+         */
+        bool m_showMemory;
+
+        /**
+         * @brief Listeners adding edited project text to the font glyphs
+         */
+        std::vector<Inspector::SubscriptionHandle> m_glyphSubscriptions;
+
+        /**
+         * @brief The entity names of the project have not been added to the font glyphs yet
+         */
+        bool m_projectGlyphsPending;
+
         /**
          * @brief Initialize all panels
          *
@@ -112,6 +203,86 @@ namespace ADS::IDE {
          */
         void newProject();
 
+        /**
+         * @brief Have the fonts follow the text of the active project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Every text property set on an entity is added to the font glyphs
+         * when the project's deferred events are flushed, and the names of
+         * all entities are added by the next update(). Descriptions are
+         * loaded lazily, so only edited ones are read.
+         */
+        void watchProjectGlyphs();
+
+        /**
+         * @brief Show the given entities in the inspector
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Handles that no longer resolve are dropped. A single scene is
+         * also shown in the working area's scene preview.
+         *
+         * @param handles Entities of the active project
+         */
+        void selectEntities(std::span<const Core::EntityHandle> handles);
+
+        /**
+         * @brief Copy the selected entities to the clipboard
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Keeps the binary payload for pastes within the IDE and puts its
+         * JSON form on the system clipboard for other tools.
+         */
+        void copySelection();
+
+        /**
+         * @brief Paste the clipboard into the active project and select the result
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Uses the binary payload while the system clipboard still holds
+         * the JSON of the last copy, and the clipboard text otherwise.
+         */
+        void pasteClipboard();
+
+        /**
+         * @brief Start importing a spreadsheet or Inform source into the active project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Creates an empty project first when none is open. The source is
+         * parsed on the job system and inserted batch by batch from update().
+         *
+         * @param path Source picked in the File > Import dialog
+         */
+        void importFile(const std::string& path);
+
+        /**
+         * @brief Host or join a collaborative session as SYNC_HOST and SYNC_PORT say
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Does nothing when SYNC_PORT is 0. Every designer must start from
+         * the same saved project, since only later edits are exchanged.
+         */
+        void startSync();
+
+        /**
+         * @brief Send the local edits that are due and apply a budget of remote ones
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         */
+        void pollSync();
+
         /**
          * @brief Render the main dockspace window
          *
@@ -184,19 +355,48 @@ namespace ADS::IDE {
          */
         void render();
 
+        /**
+         * @brief Advance time-based IDE state
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Called once per frame from App::update(). Completes background
+         * saves and runs the incremental autosave of the active project every
+         * AUTOSAVE_INTERVAL seconds.
+         *
+         * @param deltaSeconds Time elapsed since the previous frame
+         */
+        void update(float deltaSeconds);
+
+        /**
+         * @brief Check whether the IDE changes from frame to frame by itself
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * True while a background save or an import runs, since their
+         * progress is shown in the status bar, and while edits of a
+         * collaborative session wait to be sent or applied. App::run() keeps
+         * rendering continuously meanwhile.
+         *
+         * @return bool True while frames must be drawn without input
+         */
+        [[nodiscard]] bool needsContinuousRendering() const;
+
         /**
          * @brief Execute any deferred native file dialogs
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Feb 2026
+         * @version Oct 2026
          *
          * Delegates to MenuBarRenderer::processPendingDialogs(). Must be called
          * by App::run() immediately after render() returns (i.e. after
          * SDL_RenderPresent) and before the next processEvents() call.
          *
-         * This ordering guarantees that the compositor already holds a clean
-         * rendered frame when the blocking NFD dialog is shown, preventing the
-         * gray-window artifact caused by freezing the render loop mid-frame.
+         * Starts requested NFD dialogs on a worker thread and delivers the
+         * paths of closed ones, so it returns at once and the editor keeps
+         * rendering while a dialog is open.
          *
          * @see MenuBarRenderer::processPendingDialogs()
          * @see App::run()
@@ -248,6 +448,32 @@ namespace ADS::IDE {
          */
         Panels::InspectorPanel *getInspectorPanel() const;
 
+        /**
+         * @brief Get the validation panel
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return Panels::ValidationPanel* Pointer to the validation panel instance
+         *
+         * @note The returned pointer remains valid for the lifetime of the IDERenderer
+         */
+        Panels::ValidationPanel *getValidationPanel() const;
+
+        /**
+         * @brief Get the watch panel
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Whoever runs the game hands it the session's Runtime::WatchList.
+         *
+         * @return Panels::WatchPanel* Pointer to the watch panel instance
+         *
+         * @note The returned pointer remains valid for the lifetime of the IDERenderer
+         */
+        Panels::WatchPanel *getWatchPanel() const;
+
         /**
          * @brief Get the working area panel
          *
@@ -263,6 +489,33 @@ namespace ADS::IDE {
          * @note The returned pointer remains valid for the lifetime of the IDERenderer
          */
         Panels::WorkingAreaPanel *getWorkingAreaPanel() const;
+
+        /**
+         * @brief Get the frame profiler
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * App::render() frames it and times the ImGui draw calls with it;
+         * render() adds the IDE and one scope per panel.
+         *
+         * @return FrameProfiler& The profiler, valid for the lifetime of the IDERenderer
+         */
+        FrameProfiler &getProfiler();
+
+        /**
+         * @brief Replace the active project with the given instance
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Shared by newProject(), the File > Open callback and the frame
+         * benchmark. Clears the inspector, deletes the previous project and
+         * rewires the entities panel to the new one.
+         *
+         * @param project Newly allocated project; ownership is transferred
+         */
+        void setActiveProject(Core::Project* project);
     };
 }
 
@@ -12,11 +12,13 @@
 
 
 #include "LayoutManager.h"
+#include "System.h"
 #include "imgui.h"
 #include "imgui_internal.h"
 #include <iostream>
 
 #include "spdlog/spdlog.h"
+#include "Logger/logger.h"
 
 namespace ADS::IDE {
     LayoutManager::LayoutManager(): IDEBase(),
@@ -29,7 +31,7 @@ namespace ADS::IDE {
     }
 
     void LayoutManager::createDefaultLayout() {
-        spdlog::info("No saved layout found, creating default layout...");
+        ADS_LOG_INFO(Ui, "No saved layout found, creating default layout...");
         // std::cout << "No saved layout found, creating default layout..." << std::endl;
 
         // Clear any existing layout
@@ -37,16 +39,19 @@ namespace ADS::IDE {
         ImGui::DockBuilderAddNode(m_dockSpaceId, ImGuiDockNodeFlags_DockSpace);
         ImGui::DockBuilderSetNodeSize(m_dockSpaceId, ImGui::GetMainViewport()->Size);
 
-        // Split the dockspace into left, center, and right
+        // Split the dockspace into left, center, right, and bottom
         ImGuiID dock_main_id = m_dockSpaceId;
-        ImGuiID dock_left_id  = ImGui::DockBuilderSplitNode(dock_main_id, ImGuiDir_Left,  0.20f, nullptr, &dock_main_id);
-        ImGuiID dock_right_id = ImGui::DockBuilderSplitNode(dock_main_id, ImGuiDir_Right, 0.25f, nullptr, &dock_main_id);
-
-        // Dock windows to their respective areas using the same translated titles the panels use
-        auto* tm = getTranslationManager();
-        ImGui::DockBuilderDockWindow(tm->_t("ENTITIES").c_str(),     dock_left_id);
-        ImGui::DockBuilderDockWindow(tm->_t("INSPECTOR").c_str(),    dock_right_id);
-        ImGui::DockBuilderDockWindow(tm->_t("WORKING_AREA").c_str(), dock_main_id);
+        ImGuiID dock_left_id   = ImGui::DockBuilderSplitNode(dock_main_id, ImGuiDir_Left,  0.20f, nullptr, &dock_main_id);
+        ImGuiID dock_right_id  = ImGui::DockBuilderSplitNode(dock_main_id, ImGuiDir_Right, 0.25f, nullptr, &dock_main_id);
+        ImGuiID dock_bottom_id = ImGui::DockBuilderSplitNode(dock_main_id, ImGuiDir_Down,  0.25f, nullptr, &dock_main_id);
+
+        // Dock windows by the "###" ids the panel labels end with: "###id" hashes like
+        // "Any title###id", so the layout does not depend on the language
+        ImGui::DockBuilderDockWindow(Constants::System::ENTITIES_WINDOW_ID,     dock_left_id);
+        ImGui::DockBuilderDockWindow(Constants::System::INSPECTOR_WINDOW_ID,    dock_right_id);
+        ImGui::DockBuilderDockWindow(Constants::System::WORKING_AREA_WINDOW_ID, dock_main_id);
+        ImGui::DockBuilderDockWindow(Constants::System::VALIDATION_WINDOW_ID,   dock_bottom_id);
+        ImGui::DockBuilderDockWindow(Constants::System::WATCH_WINDOW_ID,        dock_bottom_id);
 
         // Finalize the docking layout
         ImGui::DockBuilderFinish(m_dockSpaceId);
@@ -62,7 +67,7 @@ namespace ADS::IDE {
 
         // Check if there's an existing layout
         if (hasSavedLayout()) {
-            spdlog::info("Found saved layout, using it...");
+            ADS_LOG_INFO(Ui, "Found saved layout, using it...");
             return;
         }
 
@@ -45,7 +45,7 @@ namespace ADS::IDE {
          * @brief Create the default docking layout
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
          * Creates a split layout with predefined panel positions and sizes.
          * Removes any existing layout and builds a new docking configuration from scratch.
@@ -55,7 +55,8 @@ namespace ADS::IDE {
          * - Right (25% width): Properties panel (top 50%) and Inspector panel (bottom 50%)
          *
          * Uses ImGui DockBuilder API to construct the layout programmatically and
-         * finalizes it for immediate use.
+         * finalizes it for immediate use. Windows are docked by their stable
+         * ids, so the layout saved in imgui.ini survives a language change.
          *
          * @note This is a private method called by setupDockingLayout()
          * @see setupDockingLayout(), hasSavedLayout()
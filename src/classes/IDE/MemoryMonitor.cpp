@@ -0,0 +1,122 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file MemoryMonitor.cpp
+ * @brief Implementation of the memory window
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "MemoryMonitor.h"
+#include "app.h"
+#include "Core/AllocationCounter.h"
+#include "imgui.h"
+#include <array>
+#include <format>
+
+namespace ADS::IDE::MemoryMonitor {
+    namespace AllocationCounter = Core::AllocationCounter;
+
+    std::string formatBytes(const uint64_t bytes)
+    {
+        constexpr std::array<const char*, 4> UNITS = {"KiB", "MiB", "GiB", "TiB"};
+        if (bytes < 1024) {
+            return std::format("{} B", bytes);
+        }
+        double value = static_cast<double>(bytes) / 1024.0;
+        size_t unit = 0;
+        while (value >= 1024.0 && unit + 1 < UNITS.size()) {
+            value /= 1024.0;
+            ++unit;
+        }
+        return std::format("{:.1f} {}", value, UNITS[unit]);
+    }
+
+    void renderTooltip()
+    {
+        if (!ImGui::BeginTooltip()) {
+            return;
+        }
+        const auto stats = AllocationCounter::getAllTagStats();
+        for (size_t index = 0; index < stats.size(); ++index) {
+            ImGui::Text("%-10s %s", AllocationCounter::getTagName(static_cast<AllocationCounter::Tag>(index)),
+                        formatBytes(stats[index].bytes).c_str());
+        }
+        ImGui::EndTooltip();
+    }
+
+    void renderOverlay(const char* title, bool* open)
+    {
+        ImGui::SetNextWindowSize(ImVec2(440.0f, 300.0f), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin(title, open)) {
+            ImGui::End();
+            return;
+        }
+
+        if (!AllocationCounter::isEnabled()) {
+            ImGui::TextWrapped("Heap accounting is off. Configure with -DADS_COUNT_ALLOCATIONS=ON to count "
+                               "the memory of each subsystem.");
+        } else {
+            if (ImGui::Button("Reset peaks")) {
+                AllocationCounter::resetPeaks();
+            }
+
+            const auto stats = AllocationCounter::getAllTagStats();
+            if (ImGui::BeginTable("##tags", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+                ImGui::TableSetupColumn("Tag", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Live", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("Blocks", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("Peak", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableHeadersRow();
+
+                AllocationCounter::TagStats total;
+                for (size_t index = 0; index < stats.size(); ++index) {
+                    const AllocationCounter::TagStats& tag = stats[index];
+                    total.bytes += tag.bytes;
+                    total.allocations += tag.allocations;
+                    total.peakBytes += tag.peakBytes;
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(AllocationCounter::getTagName(static_cast<AllocationCounter::Tag>(index)));
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(formatBytes(tag.bytes).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(tag.allocations));
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(formatBytes(tag.peakBytes).c_str());
+                }
+
+                // Peaks of different tags are not simultaneous; their sum is an upper bound
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Total");
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(formatBytes(total.bytes).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(total.allocations));
+                ImGui::TableNextColumn();
+                ImGui::Text("<= %s", formatBytes(total.peakBytes).c_str());
+                ImGui::EndTable();
+            }
+        }
+
+        if (const UI::AssetManager* assets = Core::App::getAssetManager()) {
+            ImGui::Separator();
+            ImGui::Text("Textures resident: %s", formatBytes(assets->getResidentBytes()).c_str());
+        }
+
+        ImGui::End();
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#ifndef ADS_MEMORY_MONITOR_H
+#define ADS_MEMORY_MONITOR_H
+
+#include <cstdint>
+#include <string>
+
+namespace ADS::IDE::MemoryMonitor {
+    /**
+     * @brief Format a byte count with a binary unit, e.g. "12.3 MiB"
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param bytes Byte count
+     * @return std::string Count with one decimal, or exact below 1 KiB
+     */
+    [[nodiscard]] std::string formatBytes(uint64_t bytes);
+
+    /**
+     * @brief Show the memory held by each allocation tag as a tooltip
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Used by the status bar when its memory figure is hovered.
+     */
+    void renderTooltip();
+
+    /**
+     * @brief Draw the memory window
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Shows a table with the live bytes, live blocks and high-water mark
+     * of every Core::AllocationCounter tag, their total, and the texture
+     * bytes resident in the asset manager, which live outside the heap.
+     * Without ADS_COUNT_ALLOCATIONS it says how to enable the counters.
+     *
+     * @param title Window title
+     * @param open Cleared when the user closes the window
+     */
+    void renderOverlay(const char* title, bool* open);
+}
+
+#endif //ADS_MEMORY_MONITOR_H
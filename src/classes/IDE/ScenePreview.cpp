@@ -0,0 +1,316 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ScenePreview.cpp
+ * @brief Implementation of the ScenePreview class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ScenePreview.h"
+#include <algorithm>
+#include <format>
+#include <string>
+#include <utility>
+#include <spdlog/spdlog.h>
+#include "Logger/logger.h"
+#include "app.h"
+
+namespace ADS::IDE {
+    ScenePreview::ScenePreview()
+        : m_project(nullptr),
+          m_subscription(0),
+          m_texture(0),
+          m_width(0),
+          m_height(0),
+          m_dirty{0, 0, 0, 0},
+          m_marqueeActive(false)
+    {
+    }
+
+    ScenePreview::~ScenePreview()
+    {
+        setScene(nullptr, Core::EntityHandle());
+    }
+
+    void ScenePreview::setScene(Core::Project* project, const Core::EntityHandle scene)
+    {
+        if (project == m_project && scene == m_scene) {
+            return;
+        }
+
+        if (m_project != nullptr) {
+            m_project->unsubscribe(m_subscription);
+        }
+        releaseTexture();
+        m_width = 0;
+        m_height = 0;
+        m_dirty = SDL_Rect{0, 0, 0, 0};
+        m_objects.reset(0.0f, 0.0f);
+        m_found.clear();
+        m_marqueeActive = false;
+
+        m_project = project;
+        m_scene = (project != nullptr) ? scene : Core::EntityHandle();
+        m_subscription = 0;
+        if (m_project != nullptr) {
+            m_subscription = m_project->subscribe(
+                Core::EntityKind::Scene, "",
+                [this](const Core::EntityHandle entity, const Inspector::PropertyChangedEvent& event) {
+                    onPropertyChanged(entity, event);
+                });
+        }
+    }
+
+    Core::EntityHandle ScenePreview::getScene() const
+    {
+        return m_scene;
+    }
+
+    Entities::Scene* ScenePreview::findScene() const
+    {
+        return (m_project != nullptr) ? m_project->findScene(m_scene) : nullptr;
+    }
+
+    void ScenePreview::invalidate(const SDL_Rect& area)
+    {
+        const SDL_Rect canvas{0, 0, m_width, m_height};
+        SDL_Rect clipped;
+        if (SDL_IntersectRect(&area, &canvas, &clipped)) {
+            SDL_UnionRect(&m_dirty, &clipped, &m_dirty);
+        }
+    }
+
+    void ScenePreview::invalidate()
+    {
+        invalidate(SDL_Rect{0, 0, m_width, m_height});
+    }
+
+    void ScenePreview::placeObject(const Core::EntityHandle object, const Core::Bounds& bounds)
+    {
+        m_objects.insert(object, bounds);
+    }
+
+    void ScenePreview::removeObject(const Core::EntityHandle object)
+    {
+        m_objects.remove(object);
+    }
+
+    void ScenePreview::setSelectionCallback(std::function<void(std::span<const Core::EntityHandle>)> callback)
+    {
+        m_selectionCallback = std::move(callback);
+    }
+
+    void ScenePreview::onPropertyChanged(const Core::EntityHandle entity, const Inspector::PropertyChangedEvent& event)
+    {
+        // A new width or height is picked up by compose(), which reallocates the canvas
+        if (entity == m_scene && event.propertyId == "backgroundColor") {
+            invalidate();
+        }
+    }
+
+    void ScenePreview::render()
+    {
+        const Entities::Scene* scene = findScene();
+        if (scene == nullptr) {
+            setScene(nullptr, Core::EntityHandle());
+            return;
+        }
+        compose(*scene);
+
+        const ImVec2 available = ImGui::GetContentRegionAvail();
+        const float scale = std::min({1.0f,
+                                      available.x / static_cast<float>(m_width),
+                                      available.y / static_cast<float>(m_height)});
+        if (scale <= 0.0f) {
+            return;
+        }
+
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const ImVec2 size(static_cast<float>(m_width) * scale, static_cast<float>(m_height) * scale);
+        const ImVec2 end(origin.x + size.x, origin.y + size.y);
+        ImGui::InvisibleButton("##sceneCanvas", size);
+
+        // Overlays change with every edit and cost a few vertices, so they are not cached
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        if (m_texture != 0) {
+            drawList->AddImage(m_texture, origin, end);
+        }
+        renderObjects(drawList, origin, scale);
+        drawList->AddRect(origin, end, ImGui::GetColorU32(ImGuiCol_Border));
+
+        const std::string label = std::format("{}  {} x {}", scene->getName(), scene->getWidth(), scene->getHeight());
+        const ImVec2 padding = ImGui::GetStyle().FramePadding;
+        const ImVec2 textSize = ImGui::CalcTextSize(label.c_str());
+        const ImVec2 textPosition(origin.x + padding.x, origin.y + padding.y);
+        drawList->AddRectFilled(origin,
+                                ImVec2(textPosition.x + textSize.x + padding.x, textPosition.y + textSize.y + padding.y),
+                                ImGui::GetColorU32(ImGuiCol_WindowBg, 0.75f));
+        drawList->AddText(textPosition, ImGui::GetColorU32(ImGuiCol_Text), label.c_str());
+    }
+
+    void ScenePreview::renderObjects(ImDrawList* drawList, const ImVec2& origin, const float scale)
+    {
+        const auto toScene = [&](const ImVec2& point) {
+            return ImVec2((point.x - origin.x) / scale, (point.y - origin.y) / scale);
+        };
+        const auto toScreen = [&](const float x, const float y) {
+            return ImVec2(origin.x + x * scale, origin.y + y * scale);
+        };
+
+        // Outlines of the objects in the visible part of the canvas only
+        const ImVec2 clipMin = toScene(drawList->GetClipRectMin());
+        const ImVec2 clipMax = toScene(drawList->GetClipRectMax());
+        m_objects.query(Core::Bounds{clipMin.x, clipMin.y, clipMax.x, clipMax.y}, m_found);
+        const ImU32 outline = ImGui::GetColorU32(ImGuiCol_Border);
+        for (const Core::EntityHandle object : m_found) {
+            const Core::Bounds* bounds = m_objects.find(object);
+            drawList->AddRect(toScreen(bounds->minX, bounds->minY), toScreen(bounds->maxX, bounds->maxY), outline);
+        }
+
+        const ImVec2 pointer = toScene(ImGui::GetIO().MousePos);
+        const Core::EntityHandle hovered = ImGui::IsItemHovered() ? m_objects.pick(pointer.x, pointer.y)
+                                                                  : Core::EntityHandle();
+        if (hovered.isValid()) {
+            const Core::Bounds* bounds = m_objects.find(hovered);
+            drawList->AddRect(toScreen(bounds->minX, bounds->minY), toScreen(bounds->maxX, bounds->maxY),
+                              ImGui::GetColorU32(ImGuiCol_ButtonHovered), 0.0f, 0, 2.0f);
+        }
+
+        if (ImGui::IsItemActivated()) {
+            m_marqueeStart = pointer;
+            m_marqueeActive = false;
+        }
+        if (ImGui::IsItemActive() && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+            m_marqueeActive = true;
+        }
+        const Core::Bounds marquee{std::min(m_marqueeStart.x, pointer.x), std::min(m_marqueeStart.y, pointer.y),
+                                   std::max(m_marqueeStart.x, pointer.x), std::max(m_marqueeStart.y, pointer.y)};
+        if (ImGui::IsItemActive() && m_marqueeActive) {
+            drawList->AddRectFilled(toScreen(marquee.minX, marquee.minY), toScreen(marquee.maxX, marquee.maxY),
+                                    ImGui::GetColorU32(ImGuiCol_TextSelectedBg));
+            drawList->AddRect(toScreen(marquee.minX, marquee.minY), toScreen(marquee.maxX, marquee.maxY),
+                              ImGui::GetColorU32(ImGuiCol_ButtonActive));
+        }
+
+        if (!ImGui::IsItemDeactivated() || !m_selectionCallback) {
+            return;
+        }
+        if (m_marqueeActive) {
+            m_objects.query(marquee, m_found);
+        } else {
+            m_found.clear();
+            if (hovered.isValid()) {
+                m_found.push_back(hovered);
+            }
+        }
+        m_marqueeActive = false;
+        dropRemovedObjects();
+        if (m_found.empty()) {
+            m_found.push_back(m_scene);
+        }
+        m_selectionCallback(m_found);
+    }
+
+    void ScenePreview::dropRemovedObjects()
+    {
+        // Objects deleted without a removeObject() call are taken off the canvas here
+        std::erase_if(m_found, [this](const Core::EntityHandle object) {
+            if (m_project->resolve(object) != nullptr) {
+                return false;
+            }
+            m_objects.remove(object);
+            return true;
+        });
+    }
+
+    void ScenePreview::compose(const Entities::Scene& scene)
+    {
+        UI::RenderBackend* backend = Core::App::getRenderBackend();
+        if (backend == nullptr) {
+            return;
+        }
+
+        const int width = std::clamp(scene.getWidth(), 1, MAX_SIZE);
+        const int height = std::clamp(scene.getHeight(), 1, MAX_SIZE);
+        if (width != m_width || height != m_height) {
+            releaseTexture();
+            m_width = width;
+            m_height = height;
+            m_objects.resize(static_cast<float>(m_width), static_cast<float>(m_height));
+            m_dirty = SDL_Rect{0, 0, m_width, m_height};
+        }
+        if (SDL_RectEmpty(&m_dirty)) {
+            return;
+        }
+
+        // A canvas that failed to upload is painted whole the next time it is invalidated
+        const SDL_Rect area = (m_texture == 0) ? SDL_Rect{0, 0, m_width, m_height} : m_dirty;
+        m_dirty = SDL_Rect{0, 0, 0, 0};
+
+        SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, area.w, area.h, 32, SDL_PIXELFORMAT_RGBA32);
+        if (surface == nullptr) {
+            ADS_LOG_WARN(Ui, "Scene preview: cannot allocate {}x{} pixels: {}", area.w, area.h, SDL_GetError());
+            return;
+        }
+        paint(surface, area, scene);
+
+        if (m_texture == 0) {
+            m_texture = backend->createTexture(surface);
+            if (m_texture == 0) {
+                ADS_LOG_WARN(Ui, "Scene preview: cannot create a {}x{} texture: {}", area.w, area.h, SDL_GetError());
+            }
+        } else if (!backend->updateTexture(m_texture, area, surface)) {
+            ADS_LOG_WARN(Ui, "Scene preview: cannot update the texture: {}", SDL_GetError());
+        }
+        SDL_FreeSurface(surface);
+    }
+
+    void ScenePreview::paint(SDL_Surface* surface, const SDL_Rect& area, const Entities::Scene& scene)
+    {
+        const auto channel = [](const float value) {
+            return static_cast<Uint8>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        };
+
+        const ImVec4& background = scene.getBackgroundColor();
+        SDL_FillRect(surface, nullptr,
+                     SDL_MapRGBA(surface->format, channel(background.x), channel(background.y), channel(background.z), 255));
+
+        // Grid lines a shade lighter on dark backgrounds and darker on light ones
+        const float luminance = 0.299f * background.x + 0.587f * background.y + 0.114f * background.z;
+        const float shift = (luminance < 0.5f) ? 0.12f : -0.12f;
+        const Uint32 grid = SDL_MapRGBA(surface->format, channel(background.x + shift), channel(background.y + shift),
+                                        channel(background.z + shift), 255);
+
+        for (int x = (area.x + GRID_SPACING - 1) / GRID_SPACING * GRID_SPACING; x < area.x + area.w; x += GRID_SPACING) {
+            const SDL_Rect line{x - area.x, 0, 1, area.h};
+            SDL_FillRect(surface, &line, grid);
+        }
+        for (int y = (area.y + GRID_SPACING - 1) / GRID_SPACING * GRID_SPACING; y < area.y + area.h; y += GRID_SPACING) {
+            const SDL_Rect line{0, y - area.y, area.w, 1};
+            SDL_FillRect(surface, &line, grid);
+        }
+    }
+
+    void ScenePreview::releaseTexture()
+    {
+        if (m_texture != 0) {
+            // After shutdown the texture went away with the renderer
+            if (UI::RenderBackend* backend = Core::App::getRenderBackend()) {
+                backend->destroyTexture(m_texture);
+            }
+            m_texture = 0;
+        }
+    }
+}
@@ -0,0 +1,258 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#ifndef ADS_SCENE_PREVIEW_H
+#define ADS_SCENE_PREVIEW_H
+
+#include <functional>
+#include <span>
+#include <vector>
+
+#include <SDL.h>
+
+#include "imgui.h"
+#include "Core/Project.h"
+#include "Core/SpatialGrid.h"
+
+namespace ADS::IDE {
+    /**
+     * @brief Retained canvas of a scene for the working area
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The static layers of the scene, its background and the grid, are
+     * painted once into a texture the size of the scene and kept there.
+     * A frame then costs one textured quad plus the overlays drawn on top
+     * of it, whatever the size of the scene. Only the region invalidated
+     * since the last frame is repainted and uploaded; the scene's own
+     * property events invalidate it, so the canvas stays in step with the
+     * inspector and with undo.
+     *
+     * Objects placed on the canvas are kept in a spatial grid, so hover,
+     * click and marquee selection, and the culling of their outlines, only
+     * look at the objects near the pointer or the visible area. Clicking
+     * the empty canvas selects the scene itself.
+     *
+     * Scenes larger than MAX_SIZE on a side are shown cropped.
+     */
+    class ScenePreview
+    {
+    public:
+        /**
+         * Largest canvas side in pixels, the common texture size limit
+         */
+        static constexpr int MAX_SIZE = 4096;
+
+        /**
+         * Distance between grid lines, in scene pixels
+         */
+        static constexpr int GRID_SPACING = 64;
+
+        ScenePreview();
+
+        /**
+         * @brief Release the canvas texture and the project subscription
+         */
+        ~ScenePreview();
+
+        ScenePreview(const ScenePreview&) = delete;
+        ScenePreview& operator=(const ScenePreview&) = delete;
+
+        /**
+         * @brief Show a scene, or nothing
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Must be called with nullptr before the project that was shown is
+         * deleted, so its subscription can be removed.
+         *
+         * @param project Project the scene belongs to, or nullptr to show nothing
+         * @param scene   Handle of the scene in @p project
+         */
+        void setScene(Core::Project* project, Core::EntityHandle scene);
+
+        /**
+         * @brief Get the scene shown
+         * @return Core::EntityHandle The scene, invalid if none
+         */
+        [[nodiscard]] Core::EntityHandle getScene() const;
+
+        /**
+         * @brief Look the scene shown up in its project
+         * @return Entities::Scene* The scene, or nullptr if none is shown or it was removed
+         */
+        [[nodiscard]] Entities::Scene* findScene() const;
+
+        /**
+         * @brief Repaint part of the canvas on the next render()
+         *
+         * @param area Region in scene pixels; clipped to the canvas
+         */
+        void invalidate(const SDL_Rect& area);
+
+        /**
+         * @brief Repaint the whole canvas on the next render()
+         */
+        void invalidate();
+
+        /**
+         * @brief Place an object on the canvas, or move it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Called from the property events that move or resize the object.
+         *
+         * @param object Entity drawn on the scene
+         * @param bounds Its bounds in scene pixels
+         */
+        void placeObject(Core::EntityHandle object, const Core::Bounds& bounds);
+
+        /**
+         * @brief Take an object off the canvas
+         */
+        void removeObject(Core::EntityHandle object);
+
+        /**
+         * @brief Set the function called when objects are selected on the canvas
+         *
+         * @param callback Called with the objects clicked or enclosed by a marquee,
+         *                 or with the scene when the empty canvas is clicked
+         */
+        void setSelectionCallback(std::function<void(std::span<const Core::EntityHandle>)> callback);
+
+        /**
+         * @brief Draw the scene scaled to fit the available space
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Brings the canvas up to date first, then draws it as one image
+         * with the scene name and size overlaid. Shows nothing once the
+         * scene has been removed from the project.
+         */
+        void render();
+
+    private:
+        /**
+         * Project of the scene, nullptr while nothing is shown
+         */
+        Core::Project* m_project;
+
+        /**
+         * Scene shown
+         */
+        Core::EntityHandle m_scene;
+
+        /**
+         * Listener of the scene properties in m_project
+         */
+        Inspector::SubscriptionHandle m_subscription;
+
+        /**
+         * Canvas of the static layers, 0 until first painted
+         */
+        ImTextureID m_texture;
+
+        /**
+         * Canvas size in pixels, the scene size clamped to MAX_SIZE
+         */
+        int m_width;
+        int m_height;
+
+        /**
+         * Region to repaint, empty when the canvas is up to date
+         */
+        SDL_Rect m_dirty;
+
+        /**
+         * Bounds of the objects placed on the scene
+         */
+        Core::SpatialGrid m_objects;
+
+        /**
+         * Objects found by the last grid query, reused between frames
+         */
+        std::vector<Core::EntityHandle> m_found;
+
+        /**
+         * Scene position where the current marquee started
+         */
+        ImVec2 m_marqueeStart;
+
+        /**
+         * Whether the pointer was dragged since the canvas was pressed
+         */
+        bool m_marqueeActive;
+
+        /**
+         * Receiver of canvas selections
+         */
+        std::function<void(std::span<const Core::EntityHandle>)> m_selectionCallback;
+
+        /**
+         * @brief React to a property change of a scene
+         *
+         * The background repaints the canvas; the size is compared by
+         * compose() and the other properties only appear in the overlays.
+         */
+        void onPropertyChanged(Core::EntityHandle entity, const Inspector::PropertyChangedEvent& event);
+
+        /**
+         * @brief Repaint and upload the invalidated region
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reallocates the canvas first if the scene size changed.
+         */
+        void compose(const Entities::Scene& scene);
+
+        /**
+         * @brief Paint the static layers of a region
+         *
+         * @param surface Pixels of @p area, the same size
+         * @param area    Region of the scene in scene pixels
+         * @param scene   Scene painted
+         */
+        static void paint(SDL_Surface* surface, const SDL_Rect& area, const Entities::Scene& scene);
+
+        /**
+         * @brief Draw the object outlines and handle picking and marquee selection
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Called right after the canvas item, whose hover and activation it reads.
+         *
+         * @param drawList Draw list of the canvas window
+         * @param origin   Screen position of the canvas
+         * @param scale    Screen pixels per scene pixel
+         */
+        void renderObjects(ImDrawList* drawList, const ImVec2& origin, float scale);
+
+        /**
+         * @brief Drop the objects of m_found that are no longer in the project
+         */
+        void dropRemovedObjects();
+
+        /**
+         * @brief Give the canvas texture back to the render backend
+         */
+        void releaseTexture();
+    };
+}
+
+#endif //ADS_SCENE_PREVIEW_H
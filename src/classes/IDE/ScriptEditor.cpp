@@ -0,0 +1,509 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ScriptEditor.cpp
+ * @brief Implementation of the ScriptEditor class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ScriptEditor.h"
+#include "imgui_internal.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ADS::IDE {
+    namespace {
+        constexpr std::string_view INDENT = "    ";
+
+        bool isContinuation(const char byte)
+        {
+            return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+        }
+
+        /**
+         * @brief Colour of a token; mid tones, readable on the dark and the light theme
+         */
+        ImU32 tokenColor(const ScriptHighlighter::Token token, const ImU32 textColor)
+        {
+            switch (token) {
+                case ScriptHighlighter::Token::Keyword:
+                    return IM_COL32(86, 136, 230, 255);
+                case ScriptHighlighter::Token::Label:
+                    return IM_COL32(38, 166, 154, 255);
+                case ScriptHighlighter::Token::String:
+                    return IM_COL32(214, 120, 64, 255);
+                case ScriptHighlighter::Token::Number:
+                    return IM_COL32(170, 120, 220, 255);
+                case ScriptHighlighter::Token::Comment:
+                    return IM_COL32(120, 150, 100, 255);
+                case ScriptHighlighter::Token::Variable:
+                    return IM_COL32(200, 160, 40, 255);
+                default:
+                    return textColor;
+            }
+        }
+    }
+
+    ScriptEditor::ScriptEditor()
+        : m_cursor(0), m_anchor(0), m_preferredX(-1.0f), m_lastEdit(EditKind::None), m_lastEditCursor(0),
+          m_scrollToCursor(false), m_selecting(false), m_modified(false), m_contentWidth(0.0f)
+    {
+    }
+
+    void ScriptEditor::setText(std::string text)
+    {
+        m_buffer = Core::TextBuffer(std::move(text));
+        m_cursor = 0;
+        m_anchor = 0;
+        m_preferredX = -1.0f;
+        m_undo.clear();
+        m_redo.clear();
+        m_lastEdit = EditKind::None;
+        m_contentWidth = 0.0f;
+        m_modified = false;
+        m_highlighter.reset(m_buffer.getLineCount());
+    }
+
+    std::string ScriptEditor::getText() const
+    {
+        return m_buffer.toString();
+    }
+
+    const Core::TextBuffer& ScriptEditor::getBuffer() const
+    {
+        return m_buffer;
+    }
+
+    bool ScriptEditor::isModified() const
+    {
+        return m_modified;
+    }
+
+    void ScriptEditor::render(const char* id, const ImVec2& size)
+    {
+        ImGui::BeginChild(id, size, ImGuiChildFlags_Borders,
+                          ImGuiWindowFlags_HorizontalScrollbar | ImGuiWindowFlags_NoNavInputs);
+
+        const float lineHeight = ImGui::GetTextLineHeight();
+        const size_t visibleLines = static_cast<size_t>(std::max(2.0f, std::floor(ImGui::GetWindowHeight() / lineHeight))) - 1;
+        const bool focused = ImGui::IsWindowFocused();
+        if (focused) {
+            handleKeyboard(visibleLines);
+        }
+
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const float contentTop = ImGui::GetCursorPosY();
+        handleMouse(origin, lineHeight);
+
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        const ImU32 textColor = ImGui::GetColorU32(ImGuiCol_Text);
+        const ImU32 selectionColor = ImGui::GetColorU32(ImGuiCol_TextSelectedBg);
+        const float spaceWidth = ImGui::CalcTextSize(" ").x;
+        const size_t cursorLine = m_buffer.getLineOf(m_cursor);
+        const size_t selectedFrom = selectionStart();
+        const size_t selectedTo = selectionEnd();
+
+        // Lines are exactly lineHeight apart, so line N is at origin + N * lineHeight
+        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_buffer.getLineCount()), lineHeight);
+        while (clipper.Step()) {
+            if (clipper.DisplayEnd > clipper.DisplayStart) {
+                m_highlighter.update(m_buffer, static_cast<size_t>(clipper.DisplayEnd - 1));
+            }
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                const auto line = static_cast<size_t>(row);
+                const size_t start = m_buffer.getLineStart(line);
+                const size_t end = m_buffer.getLineEnd(line);
+                m_line.clear();
+                m_buffer.copyTo(start, end - start, m_line);
+
+                const ImVec2 position = ImGui::GetCursorScreenPos();
+                const char* text = m_line.data();
+                const float width = ImGui::CalcTextSize(text, text + m_line.size()).x;
+
+                if (selectedFrom < selectedTo && selectedFrom <= end && selectedTo > start) {
+                    const size_t from = std::max(selectedFrom, start) - start;
+                    const size_t to = std::min(selectedTo, end) - start;
+                    const float left = ImGui::CalcTextSize(text, text + from).x;
+                    // A selected line break shows as a space-wide block
+                    const float right = ImGui::CalcTextSize(text, text + to).x + (selectedTo > end ? spaceWidth : 0.0f);
+                    drawList->AddRectFilled(ImVec2(position.x + left, position.y),
+                                            ImVec2(position.x + right, position.y + lineHeight), selectionColor);
+                }
+
+                m_highlighter.tokenize(m_line, line, m_spans);
+                float x = position.x;
+                for (const ScriptHighlighter::Span& span : m_spans) {
+                    const char* first = text + span.start;
+                    const char* last = first + span.length;
+                    drawList->AddText(ImVec2(x, position.y), tokenColor(span.token, textColor), first, last);
+                    x += ImGui::CalcTextSize(first, last).x;
+                }
+
+                if (focused && line == cursorLine &&
+                    std::fmod(ImGui::GetTime(), 1.2) < 0.8) {
+                    const float x = position.x + ImGui::CalcTextSize(text, text + (m_cursor - start)).x;
+                    drawList->AddLine(ImVec2(x, position.y), ImVec2(x, position.y + lineHeight), textColor);
+                }
+
+                m_contentWidth = std::max(m_contentWidth, width + spaceWidth);
+                ImGui::Dummy(ImVec2(m_contentWidth, lineHeight));
+            }
+        }
+        clipper.End();
+        ImGui::PopStyleVar();
+
+        if (m_scrollToCursor) {
+            m_scrollToCursor = false;
+            const float top = contentTop + static_cast<float>(cursorLine) * lineHeight;
+            if (top < ImGui::GetScrollY()) {
+                ImGui::SetScrollY(top);
+            } else if (top + lineHeight > ImGui::GetScrollY() + ImGui::GetWindowHeight() - lineHeight) {
+                ImGui::SetScrollY(top + 2.0f * lineHeight - ImGui::GetWindowHeight());
+            }
+
+            const float x = columnX(m_cursor);
+            if (x < ImGui::GetScrollX()) {
+                ImGui::SetScrollX(x);
+            } else if (x + spaceWidth > ImGui::GetScrollX() + ImGui::GetWindowWidth() - 2.0f * spaceWidth) {
+                ImGui::SetScrollX(x + 3.0f * spaceWidth - ImGui::GetWindowWidth());
+            }
+        }
+
+        if (focused) {
+            // Keep the keys and characters from the rest of the UI and the IME open
+            ImGuiIO& io = ImGui::GetIO();
+            io.WantCaptureKeyboard = true;
+            io.WantTextInput = true;
+        }
+
+        ImGui::EndChild();
+    }
+
+    bool ScriptEditor::undo()
+    {
+        if (m_undo.empty()) {
+            return false;
+        }
+
+        restore(m_undo, m_redo);
+        return true;
+    }
+
+    bool ScriptEditor::redo()
+    {
+        if (m_redo.empty()) {
+            return false;
+        }
+
+        restore(m_redo, m_undo);
+        return true;
+    }
+
+    void ScriptEditor::handleKeyboard(const size_t visibleLines)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        const bool shift = io.KeyShift;
+        const bool command = io.ConfigMacOSXBehaviors ? io.KeySuper : io.KeyCtrl;
+
+        if (command && ImGui::IsKeyPressed(ImGuiKey_Z)) {
+            shift ? redo() : undo();
+        } else if (command && ImGui::IsKeyPressed(ImGuiKey_Y)) {
+            redo();
+        } else if (command && ImGui::IsKeyPressed(ImGuiKey_A)) {
+            m_anchor = 0;
+            m_cursor = m_buffer.getLength();
+        } else if (command && (ImGui::IsKeyPressed(ImGuiKey_C) || ImGui::IsKeyPressed(ImGuiKey_X))) {
+            if (hasSelection()) {
+                m_line.clear();
+                m_buffer.copyTo(selectionStart(), selectionEnd() - selectionStart(), m_line);
+                ImGui::SetClipboardText(m_line.c_str());
+                if (ImGui::IsKeyPressed(ImGuiKey_X)) {
+                    beginEdit(EditKind::Other);
+                    eraseSelection();
+                }
+            }
+        } else if (command && ImGui::IsKeyPressed(ImGuiKey_V)) {
+            if (const char* clipboard = ImGui::GetClipboardText()) {
+                insertText(clipboard, EditKind::Other);
+            }
+        } else if (ImGui::IsKeyPressed(ImGuiKey_LeftArrow)) {
+            const bool collapse = hasSelection() && !shift;
+            moveCursor(collapse ? selectionStart() : previousChar(m_cursor), shift);
+        } else if (ImGui::IsKeyPressed(ImGuiKey_RightArrow)) {
+            const bool collapse = hasSelection() && !shift;
+            moveCursor(collapse ? selectionEnd() : nextChar(m_cursor), shift);
+        } else if (ImGui::IsKeyPressed(ImGuiKey_UpArrow) || ImGui::IsKeyPressed(ImGuiKey_DownArrow) ||
+                   ImGui::IsKeyPressed(ImGuiKey_PageUp) || ImGui::IsKeyPressed(ImGuiKey_PageDown)) {
+            const size_t line = m_buffer.getLineOf(m_cursor);
+            const size_t step = (ImGui::IsKeyPressed(ImGuiKey_PageUp) || ImGui::IsKeyPressed(ImGuiKey_PageDown))
+                                    ? visibleLines : 1;
+            const bool up = ImGui::IsKeyPressed(ImGuiKey_UpArrow) || ImGui::IsKeyPressed(ImGuiKey_PageUp);
+            const size_t target = up ? line - std::min(line, step)
+                                     : std::min(line + step, m_buffer.getLineCount() - 1);
+            const float x = (m_preferredX >= 0.0f) ? m_preferredX : columnX(m_cursor);
+            moveCursor(offsetAt(target, x), shift);
+            m_preferredX = x;
+        } else if (ImGui::IsKeyPressed(ImGuiKey_Home)) {
+            moveCursor(command ? 0 : m_buffer.getLineStart(m_buffer.getLineOf(m_cursor)), shift);
+        } else if (ImGui::IsKeyPressed(ImGuiKey_End)) {
+            moveCursor(command ? m_buffer.getLength() : m_buffer.getLineEnd(m_buffer.getLineOf(m_cursor)), shift);
+        } else if (ImGui::IsKeyPressed(ImGuiKey_Enter) || ImGui::IsKeyPressed(ImGuiKey_KeypadEnter)) {
+            // Keep the indentation of the current line
+            const size_t start = m_buffer.getLineStart(m_buffer.getLineOf(selectionStart()));
+            std::string text = "\n";
+            for (size_t offset = start; offset < selectionStart() && m_buffer.at(offset) == ' '; ++offset) {
+                text += ' ';
+            }
+            insertText(text, EditKind::Other);
+        } else if (ImGui::IsKeyPressed(ImGuiKey_Tab)) {
+            insertText(INDENT, EditKind::Typing);
+        } else if (ImGui::IsKeyPressed(ImGuiKey_Backspace)) {
+            beginEdit(EditKind::Deleting);
+            if (!eraseSelection() && m_cursor > 0) {
+                const size_t from = previousChar(m_cursor);
+                replace(from, m_cursor - from, {});
+                m_cursor = m_anchor = from;
+            }
+            m_lastEditCursor = m_cursor;
+            m_scrollToCursor = true;
+        } else if (ImGui::IsKeyPressed(ImGuiKey_Delete)) {
+            beginEdit(EditKind::Deleting);
+            if (!eraseSelection() && m_cursor < m_buffer.getLength()) {
+                replace(m_cursor, nextChar(m_cursor) - m_cursor, {});
+            }
+            m_lastEditCursor = m_cursor;
+            m_scrollToCursor = true;
+        }
+
+        // Characters typed this frame; Ctrl shortcuts queue none
+        if (!io.InputQueueCharacters.empty()) {
+            std::string typed;
+            for (const ImWchar character : io.InputQueueCharacters) {
+                if (character >= 0x20 && character != 0x7F) {
+                    char encoded[5];
+                    typed += ImTextCharToUtf8(encoded, character);
+                }
+            }
+            io.InputQueueCharacters.resize(0);
+            insertText(typed, EditKind::Typing);
+        }
+    }
+
+    void ScriptEditor::handleMouse(const ImVec2& origin, const float lineHeight)
+    {
+        if (!ImGui::IsMouseDown(ImGuiMouseButton_Left)) {
+            m_selecting = false;
+        }
+
+        // Not over the scrollbars
+        const bool hovered = ImGui::IsWindowHovered() &&
+                             ImGui::GetCurrentWindow()->InnerClipRect.Contains(ImGui::GetMousePos());
+        if (hovered) {
+            ImGui::SetMouseCursor(ImGuiMouseCursor_TextInput);
+        }
+
+        const bool clicked = hovered && ImGui::IsMouseClicked(ImGuiMouseButton_Left);
+        if (!clicked && !m_selecting) {
+            return;
+        }
+        m_selecting = true;
+
+        const ImVec2 mouse = ImGui::GetMousePos();
+        const float row = std::max(0.0f, std::floor((mouse.y - origin.y) / lineHeight));
+        const size_t line = std::min(static_cast<size_t>(row), m_buffer.getLineCount() - 1);
+        const size_t offset = offsetAt(line, mouse.x - origin.x);
+        moveCursor(offset, !clicked || ImGui::GetIO().KeyShift);
+        m_scrollToCursor = !clicked;
+    }
+
+    void ScriptEditor::beginEdit(const EditKind kind)
+    {
+        if (kind == EditKind::Other || kind != m_lastEdit || m_cursor != m_lastEditCursor || hasSelection()) {
+            m_undo.push_back({m_buffer.snapshot(), m_cursor, m_anchor, {}});
+            if (m_undo.size() > UNDO_LIMIT) {
+                m_undo.erase(m_undo.begin());
+            }
+        }
+        m_redo.clear();
+        m_lastEdit = kind;
+        m_preferredX = -1.0f;
+    }
+
+    void ScriptEditor::insertText(const std::string_view text, const EditKind kind)
+    {
+        if (text.empty()) {
+            return;
+        }
+
+        beginEdit(kind);
+        eraseSelection();
+        replace(m_cursor, 0, text);
+        m_cursor += text.size();
+        m_anchor = m_cursor;
+        m_lastEditCursor = m_cursor;
+        m_scrollToCursor = true;
+    }
+
+    void ScriptEditor::replace(const size_t offset, const size_t count, const std::string_view text)
+    {
+        const size_t line = m_buffer.getLineOf(offset);
+        const size_t removedBreaks = m_buffer.getLineOf(offset + count) - line;
+        m_buffer.erase(offset, count);
+        m_buffer.insert(offset, text);
+        m_modified = true;
+        m_highlighter.edited(line, removedBreaks, static_cast<size_t>(std::count(text.begin(), text.end(), '\n')));
+
+        // Grow the range the current undo state covers to take this edit in
+        if (m_undo.empty()) {
+            return;
+        }
+        Damage& damage = m_undo.back().damage;
+        if (damage.from == std::string::npos) {
+            damage = {offset, offset + text.size(), count};
+            return;
+        }
+        const size_t from = std::min(damage.from, offset);
+        const size_t to = std::max(damage.to, offset + count);
+        damage.oldLength += (damage.from - from) + (to - damage.to);
+        damage.from = from;
+        damage.to = to - count + text.size();
+    }
+
+    void ScriptEditor::restore(std::vector<UndoState>& from, std::vector<UndoState>& to)
+    {
+        UndoState state = std::move(from.back());
+        from.pop_back();
+
+        // The state pushed on the other stack changes the same range back
+        const Damage& damage = state.damage;
+        UndoState current{m_buffer.snapshot(), m_cursor, m_anchor, {}};
+        if (damage.from == std::string::npos) {
+            m_buffer.restore(state.text);
+        } else {
+            const size_t line = m_buffer.getLineOf(damage.from);
+            const size_t removedBreaks = m_buffer.getLineOf(damage.to) - line;
+            m_buffer.restore(state.text);
+            const size_t insertedBreaks = m_buffer.getLineOf(damage.from + damage.oldLength) - line;
+            m_highlighter.edited(line, removedBreaks, insertedBreaks);
+            current.damage = {damage.from, damage.from + damage.oldLength, damage.to - damage.from};
+        }
+        to.push_back(std::move(current));
+
+        m_cursor = state.cursor;
+        m_anchor = state.anchor;
+        m_lastEdit = EditKind::None;
+        m_scrollToCursor = true;
+    }
+
+    bool ScriptEditor::eraseSelection()
+    {
+        if (!hasSelection()) {
+            return false;
+        }
+
+        const size_t start = selectionStart();
+        replace(start, selectionEnd() - start, {});
+        m_cursor = m_anchor = start;
+        return true;
+    }
+
+    void ScriptEditor::moveCursor(const size_t offset, const bool select)
+    {
+        m_cursor = offset;
+        if (!select) {
+            m_anchor = offset;
+        }
+        m_preferredX = -1.0f;
+        m_lastEdit = EditKind::None;
+        m_scrollToCursor = true;
+    }
+
+    bool ScriptEditor::hasSelection() const
+    {
+        return m_cursor != m_anchor;
+    }
+
+    size_t ScriptEditor::selectionStart() const
+    {
+        return std::min(m_cursor, m_anchor);
+    }
+
+    size_t ScriptEditor::selectionEnd() const
+    {
+        return std::max(m_cursor, m_anchor);
+    }
+
+    size_t ScriptEditor::previousChar(size_t offset) const
+    {
+        if (offset == 0) {
+            return 0;
+        }
+        --offset;
+        while (offset > 0 && isContinuation(m_buffer.at(offset))) {
+            --offset;
+        }
+        return offset;
+    }
+
+    size_t ScriptEditor::nextChar(size_t offset) const
+    {
+        const size_t length = m_buffer.getLength();
+        if (offset >= length) {
+            return length;
+        }
+        ++offset;
+        while (offset < length && isContinuation(m_buffer.at(offset))) {
+            ++offset;
+        }
+        return offset;
+    }
+
+    float ScriptEditor::columnX(const size_t offset)
+    {
+        const size_t start = m_buffer.getLineStart(m_buffer.getLineOf(offset));
+        m_line.clear();
+        m_buffer.copyTo(start, offset - start, m_line);
+        return ImGui::CalcTextSize(m_line.data(), m_line.data() + m_line.size()).x;
+    }
+
+    size_t ScriptEditor::offsetAt(const size_t line, const float x)
+    {
+        const size_t start = m_buffer.getLineStart(line);
+        const size_t end = m_buffer.getLineEnd(line);
+        m_line.clear();
+        m_buffer.copyTo(start, end - start, m_line);
+
+        // Walk the characters until the position passes the middle of one
+        const char* text = m_line.data();
+        const char* last = text + m_line.size();
+        const char* character = text;
+        float left = 0.0f;
+        while (character < last) {
+            const char* next = character + 1;
+            while (next < last && isContinuation(*next)) {
+                ++next;
+            }
+            const float width = ImGui::CalcTextSize(character, next).x;
+            if (left + width * 0.5f > x) {
+                break;
+            }
+            left += width;
+            character = next;
+        }
+        return start + static_cast<size_t>(character - text);
+    }
+}
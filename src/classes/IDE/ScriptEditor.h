@@ -0,0 +1,236 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#ifndef ADS_SCRIPT_EDITOR_H
+#define ADS_SCRIPT_EDITOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "imgui.h"
+#include "Core/TextBuffer.h"
+#include "ScriptHighlighter.h"
+
+namespace ADS::IDE {
+    /**
+     * @brief Multi-line text editor drawing only the visible lines of a TextBuffer
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Replaces ImGui::InputTextMultiline, which needs the whole text in one
+     * fixed char array and moves its tail on every keystroke. The text lives
+     * in a Core::TextBuffer, and each frame copies out only the lines the
+     * list clipper shows, so a 50k-line generated script scrolls and edits
+     * like a short one.
+     *
+     * Handles the caret and a selection (mouse and Shift+keys), typing,
+     * Enter with the indentation of the line, Tab as four spaces, Backspace
+     * and Delete, clipboard, and undo/redo. Undo states are buffer
+     * snapshots, so each costs a pointer and the cursor; consecutive typing
+     * or deleting shares one state.
+     *
+     * Lines are coloured by a ScriptHighlighter, told about every edit so
+     * that it re-lexes only the lines the edit damaged.
+     *
+     * @note Lines are drawn unwrapped; a tab character shows as nothing
+     */
+    class ScriptEditor
+    {
+    public:
+        /**
+         * Undo states kept; older ones are dropped.
+         */
+        static constexpr size_t UNDO_LIMIT = 1000;
+
+        ScriptEditor();
+
+        /**
+         * @brief Replace the text and forget the undo history
+         *
+         * @param text New content
+         */
+        void setText(std::string text);
+
+        /**
+         * @brief Get the whole text
+         * @return std::string Copy of the document
+         */
+        [[nodiscard]] std::string getText() const;
+
+        /**
+         * @brief Get the document
+         * @return const Core::TextBuffer& Text being edited
+         */
+        [[nodiscard]] const Core::TextBuffer& getBuffer() const;
+
+        /**
+         * @brief Check whether the text was edited since setText()
+         * @return bool True after any edit, even one undone since
+         */
+        [[nodiscard]] bool isModified() const;
+
+        /**
+         * @brief Draw the editor and apply the input it has focus for
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param id   Child window id
+         * @param size Child window size, as for ImGui::BeginChild()
+         */
+        void render(const char* id, const ImVec2& size);
+
+        /**
+         * @brief Go back to the state before the last edit
+         * @return bool False if there is nothing to undo
+         */
+        bool undo();
+
+        /**
+         * @brief Reapply the last undone edit
+         * @return bool False if there is nothing to redo
+         */
+        bool redo();
+
+    private:
+        /**
+         * @brief Edits grouped into one undo state while they follow each other
+         */
+        enum class EditKind : uint8_t {
+            None,
+            Typing,
+            Deleting,
+            Other       ///< Never grouped: paste, cut, Enter
+        };
+
+        /**
+         * @brief Range an undo state changes, so going back re-lexes only that
+         *
+         * [from, to) in the current text was [from, from + oldLength) in the
+         * saved one. from is npos while nothing has been changed.
+         */
+        struct Damage
+        {
+            size_t from = std::string::npos;
+            size_t to = 0;
+            size_t oldLength = 0;
+        };
+
+        /**
+         * @brief Text and caret to go back to
+         */
+        struct UndoState
+        {
+            Core::TextBuffer::Snapshot text;
+            size_t cursor;
+            size_t anchor;
+            Damage damage;
+        };
+
+        Core::TextBuffer m_buffer;
+        size_t m_cursor;                    ///< Caret offset, on a UTF-8 boundary
+        size_t m_anchor;                    ///< Other end of the selection; equal to m_cursor when none
+        float m_preferredX;                 ///< Column kept by Up/Down across short lines, -1 if unset
+        std::vector<UndoState> m_undo;
+        std::vector<UndoState> m_redo;
+        EditKind m_lastEdit;
+        size_t m_lastEditCursor;            ///< Caret after the last edit, to tell typing from a jump
+        bool m_scrollToCursor;
+        bool m_selecting;                   ///< Mouse drag started inside the editor
+        bool m_modified;                    ///< See isModified()
+        float m_contentWidth;               ///< Widest line drawn so far, for the horizontal scrollbar
+        std::string m_line;                 ///< Scratch copy of the line being drawn or measured
+        ScriptHighlighter m_highlighter;
+        std::vector<ScriptHighlighter::Span> m_spans;   ///< Tokens of the line being drawn
+
+        /**
+         * @brief Apply the keys and characters of this frame
+         *
+         * @param visibleLines Lines a PageUp/PageDown moves by
+         */
+        void handleKeyboard(size_t visibleLines);
+
+        /**
+         * @brief Place the caret or extend the selection from the mouse
+         *
+         * @param origin     Screen position of the first line
+         * @param lineHeight Height of a line
+         */
+        void handleMouse(const ImVec2& origin, float lineHeight);
+
+        /**
+         * @brief Save an undo state unless the edit continues the previous one
+         */
+        void beginEdit(EditKind kind);
+
+        /**
+         * @brief Replace the selection with text and put the caret after it
+         */
+        void insertText(std::string_view text, EditKind kind);
+
+        /**
+         * @brief Replace a range of the text, telling the highlighter and the undo state
+         *
+         * @param offset Start of the range
+         * @param count  Bytes replaced
+         * @param text   New text
+         */
+        void replace(size_t offset, size_t count, std::string_view text);
+
+        /**
+         * @brief Go to the state on top of one stack, saving the current one on the other
+         */
+        void restore(std::vector<UndoState>& from, std::vector<UndoState>& to);
+
+        /**
+         * @brief Remove the selected text
+         * @return bool False if nothing is selected
+         */
+        bool eraseSelection();
+
+        /**
+         * @brief Move the caret, keeping or dropping the selection
+         */
+        void moveCursor(size_t offset, bool select);
+
+        [[nodiscard]] bool hasSelection() const;
+        [[nodiscard]] size_t selectionStart() const;
+        [[nodiscard]] size_t selectionEnd() const;
+
+        /**
+         * @brief Offset of the previous UTF-8 character
+         */
+        [[nodiscard]] size_t previousChar(size_t offset) const;
+
+        /**
+         * @brief Offset of the next UTF-8 character
+         */
+        [[nodiscard]] size_t nextChar(size_t offset) const;
+
+        /**
+         * @brief Horizontal position of an offset within its line
+         */
+        float columnX(size_t offset);
+
+        /**
+         * @brief Offset in a line closest to a horizontal position
+         */
+        size_t offsetAt(size_t line, float x);
+    };
+}
+
+#endif //ADS_SCRIPT_EDITOR_H
@@ -0,0 +1,251 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ScriptHighlighter.cpp
+ * @brief Implementation of the ScriptHighlighter class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ScriptHighlighter.h"
+#include <algorithm>
+#include <array>
+
+namespace ADS::IDE {
+    namespace {
+        constexpr std::array<std::string_view, 22> KEYWORDS = {
+            "and", "ask", "else", "end", "false", "give", "goto", "has", "hide", "if", "in",
+            "item", "not", "or", "say", "scene", "set", "show", "take", "then", "true", "when"
+        };
+
+        bool isWordStart(const char character)
+        {
+            return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+                   character == '_';
+        }
+
+        bool isDigit(const char character)
+        {
+            return character >= '0' && character <= '9';
+        }
+
+        bool isWordChar(const char character)
+        {
+            return isWordStart(character) || isDigit(character);
+        }
+
+        bool isOperator(const char character)
+        {
+            return std::string_view("=<>!+-*/%&|(){}[],;:.?").find(character) != std::string_view::npos;
+        }
+
+        /**
+         * @brief Find the end of a string body
+         * @return size_t Offset after the closing quote, or npos if the line ends first
+         */
+        size_t stringEnd(const std::string_view text, size_t offset, const char quote)
+        {
+            while (offset < text.size()) {
+                if (text[offset] == '\\') {
+                    offset += 2;
+                } else if (text[offset++] == quote) {
+                    return offset;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+        void addSpan(std::vector<ScriptHighlighter::Span>* spans, const size_t from, const size_t to,
+                     const ScriptHighlighter::Token token)
+        {
+            if (spans == nullptr || to <= from) {
+                return;
+            }
+            // Neighbours of one kind are drawn as one piece of text
+            if (!spans->empty() && spans->back().token == token && spans->back().start + spans->back().length == from) {
+                spans->back().length += to - from;
+                return;
+            }
+            spans->push_back({from, to - from, token});
+        }
+    }
+
+    ScriptHighlighter::ScriptHighlighter()
+        : m_firstDirty(0)
+    {
+        reset(1);
+    }
+
+    void ScriptHighlighter::reset(const size_t lineCount)
+    {
+        m_states.assign(lineCount, static_cast<uint8_t>(State::Normal) | DIRTY);
+        m_firstDirty = 0;
+    }
+
+    void ScriptHighlighter::edited(const size_t line, size_t removedBreaks, const size_t insertedBreaks)
+    {
+        if (line >= m_states.size()) {
+            return;
+        }
+
+        // Lines after the first touched one are replaced; their states are rebuilt by update()
+        removedBreaks = std::min(removedBreaks, m_states.size() - line - 1);
+        const auto next = m_states.begin() + static_cast<std::ptrdiff_t>(line + 1);
+        if (removedBreaks > insertedBreaks) {
+            m_states.erase(next, next + static_cast<std::ptrdiff_t>(removedBreaks - insertedBreaks));
+        } else if (insertedBreaks > removedBreaks) {
+            m_states.insert(next, insertedBreaks - removedBreaks, static_cast<uint8_t>(State::Normal));
+        }
+        for (size_t index = line; index <= line + insertedBreaks; ++index) {
+            m_states[index] |= DIRTY;
+        }
+        m_firstDirty = std::min(m_firstDirty, line);
+    }
+
+    void ScriptHighlighter::update(const Core::TextBuffer& buffer, size_t lastLine)
+    {
+        const size_t lineCount = buffer.getLineCount();
+        if (m_states.size() != lineCount) {
+            // An edit was not reported: start again rather than show stale colours
+            reset(lineCount);
+        }
+        lastLine = std::min(lastLine, lineCount - 1);
+
+        size_t line = m_firstDirty;
+        for (; line <= lastLine; ++line) {
+            if ((m_states[line] & DIRTY) == 0) {
+                continue;
+            }
+            m_states[line] &= static_cast<uint8_t>(~DIRTY);
+
+            const size_t start = buffer.getLineStart(line);
+            m_line.clear();
+            buffer.copyTo(start, buffer.getLineEnd(line) - start, m_line);
+            const auto end = static_cast<uint8_t>(lexLine(m_line, static_cast<State>(m_states[line]), nullptr));
+
+            // The next line is only lexed again if it now starts differently
+            if (line + 1 < lineCount && (m_states[line + 1] & static_cast<uint8_t>(~DIRTY)) != end) {
+                m_states[line + 1] = end | DIRTY;
+            }
+        }
+        m_firstDirty = std::max(m_firstDirty, line);
+    }
+
+    void ScriptHighlighter::tokenize(const std::string_view text, const size_t line, std::vector<Span>& spans) const
+    {
+        spans.clear();
+        const State state = (line < m_states.size())
+                                ? static_cast<State>(m_states[line] & static_cast<uint8_t>(~DIRTY))
+                                : State::Normal;
+        lexLine(text, state, &spans);
+    }
+
+    ScriptHighlighter::State ScriptHighlighter::lexLine(const std::string_view text, State state,
+                                                        std::vector<Span>* spans)
+    {
+        const size_t length = text.size();
+        size_t offset = 0;
+
+        // Finish what the previous line left open
+        if (state == State::Comment) {
+            const size_t close = text.find("*/");
+            if (close == std::string_view::npos) {
+                addSpan(spans, 0, length, Token::Comment);
+                return State::Comment;
+            }
+            offset = close + 2;
+            addSpan(spans, 0, offset, Token::Comment);
+        } else if (state == State::String) {
+            const size_t close = stringEnd(text, 0, '"');
+            if (close == std::string_view::npos) {
+                addSpan(spans, 0, length, Token::String);
+                return State::String;
+            }
+            offset = close;
+            addSpan(spans, 0, offset, Token::String);
+        }
+
+        bool firstWord = true;
+        while (offset < length) {
+            const char character = text[offset];
+            const char following = (offset + 1 < length) ? text[offset + 1] : '\0';
+            size_t end = offset + 1;
+
+            if (character == ' ' || character == '\t') {
+                while (end < length && (text[end] == ' ' || text[end] == '\t')) {
+                    ++end;
+                }
+                addSpan(spans, offset, end, Token::Text);
+            } else if (character == '/' && following == '/') {
+                addSpan(spans, offset, length, Token::Comment);
+                return State::Normal;
+            } else if (character == '/' && following == '*') {
+                const size_t close = text.find("*/", offset + 2);
+                if (close == std::string_view::npos) {
+                    addSpan(spans, offset, length, Token::Comment);
+                    return State::Comment;
+                }
+                end = close + 2;
+                addSpan(spans, offset, end, Token::Comment);
+            } else if (character == '"') {
+                end = stringEnd(text, offset + 1, '"');
+                if (end == std::string_view::npos) {
+                    addSpan(spans, offset, length, Token::String);
+                    return State::String;
+                }
+                addSpan(spans, offset, end, Token::String);
+                firstWord = false;
+            } else if (character == '\'' && (offset == 0 || !isWordChar(text[offset - 1]))) {
+                // Dialog quotes close on their line; an apostrophe inside a word is text
+                end = std::min(stringEnd(text, offset + 1, '\''), length);
+                addSpan(spans, offset, end, Token::String);
+                firstWord = false;
+            } else if (isDigit(character)) {
+                while (end < length && (isDigit(text[end]) || text[end] == '.')) {
+                    ++end;
+                }
+                addSpan(spans, offset, end, Token::Number);
+                firstWord = false;
+            } else if ((character == '$' || character == '@') && isWordStart(following)) {
+                while (end < length && isWordChar(text[end])) {
+                    ++end;
+                }
+                addSpan(spans, offset, end, Token::Variable);
+                firstWord = false;
+            } else if (isWordStart(character)) {
+                while (end < length && isWordChar(text[end])) {
+                    ++end;
+                }
+                const std::string_view word = text.substr(offset, end - offset);
+                if (firstWord && end < length && text[end] == ':') {
+                    ++end;
+                    addSpan(spans, offset, end, Token::Label);
+                } else if (std::find(KEYWORDS.begin(), KEYWORDS.end(), word) != KEYWORDS.end()) {
+                    addSpan(spans, offset, end, Token::Keyword);
+                } else {
+                    addSpan(spans, offset, end, Token::Text);
+                }
+                firstWord = false;
+            } else if (isOperator(character)) {
+                addSpan(spans, offset, end, Token::Operator);
+            } else {
+                // Icons and other UTF-8 text, which may come before a label
+                addSpan(spans, offset, end, Token::Text);
+            }
+            offset = end;
+        }
+
+        return State::Normal;
+    }
+}
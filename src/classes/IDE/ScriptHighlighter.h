@@ -0,0 +1,146 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#ifndef ADS_SCRIPT_HIGHLIGHTER_H
+#define ADS_SCRIPT_HIGHLIGHTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/TextBuffer.h"
+
+namespace ADS::IDE {
+    /**
+     * @brief Incremental tokenizer for adventure scripts
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Keeps the lexer state at the start of every line: the only thing a
+     * line needs from the lines above it is whether it begins inside a
+     * block comment or a double-quoted string. An edit marks the lines it
+     * touched; update() re-lexes them and carries on down only while the
+     * state at the end of a line differs from the one cached for the next,
+     * so typing inside a line re-lexes that line and nothing else. Lines
+     * below the visible ones are left until they are scrolled to.
+     *
+     * Tokens themselves are not cached: tokenize() lexes one visible line
+     * from its cached state when it is drawn.
+     *
+     * The grammar: `label:` as the first word of a line, keywords,
+     * `$variables` and `@references`, numbers, "strings" that may span
+     * lines, 'dialog' strings, `//` line comments and C-style block comments.
+     */
+    class ScriptHighlighter
+    {
+    public:
+        /**
+         * @brief Kind of a highlighted range
+         */
+        enum class Token : uint8_t {
+            Text,
+            Keyword,
+            Label,
+            String,
+            Number,
+            Comment,
+            Variable,
+            Operator
+        };
+
+        /**
+         * @brief Range of a line with one token kind
+         */
+        struct Span
+        {
+            size_t start;       ///< Byte offset in the line
+            size_t length;
+            Token token;
+        };
+
+        ScriptHighlighter();
+
+        /**
+         * @brief Forget every cached state, for a new document
+         *
+         * @param lineCount Lines of the document
+         */
+        void reset(size_t lineCount);
+
+        /**
+         * @brief Record an edit, before update() is called again
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param line           First line the edit touched
+         * @param removedBreaks  Line breaks in the replaced text
+         * @param insertedBreaks Line breaks in the new text
+         */
+        void edited(size_t line, size_t removedBreaks, size_t insertedBreaks);
+
+        /**
+         * @brief Re-lex the damaged lines up to a line
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param buffer   Document the edits were made to
+         * @param lastLine Last line that is going to be tokenized
+         */
+        void update(const Core::TextBuffer& buffer, size_t lastLine);
+
+        /**
+         * @brief Split a line into spans
+         *
+         * @param text  Text of the line, without its '\n'
+         * @param line  Line index; update() must have reached it
+         * @param spans Replaced by the spans, in order and covering the text
+         */
+        void tokenize(std::string_view text, size_t line, std::vector<Span>& spans) const;
+
+    private:
+        /**
+         * @brief What a line starts inside of
+         */
+        enum class State : uint8_t {
+            Normal,
+            Comment,    ///< Block comment
+            String      ///< Double-quoted string
+        };
+
+        /**
+         * Flag of m_states: the line changed, or the state it starts with did
+         */
+        static constexpr uint8_t DIRTY = 0x80;
+
+        std::vector<uint8_t> m_states;      ///< State at the start of each line, plus DIRTY
+        size_t m_firstDirty;                ///< No line before this one is dirty
+        std::string m_line;                 ///< Scratch copy of the line being lexed
+
+        /**
+         * @brief Lex a line
+         *
+         * @param text  Text of the line
+         * @param state State at its start
+         * @param spans Spans are appended here unless null
+         * @return State State at its end
+         */
+        static State lexLine(std::string_view text, State state, std::vector<Span>* spans);
+    };
+}
+
+#endif //ADS_SCRIPT_HIGHLIGHTER_H
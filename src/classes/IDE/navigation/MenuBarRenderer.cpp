@@ -14,8 +14,7 @@
 #include "MenuBarRenderer.h"
 #include "imgui.h"
 #include <SDL.h>
-#include "../themes/DarkTheme.h"
-#include "../themes/LightTheme.h"
+#include "app.h"
 
 namespace ADS::IDE {
     /**
@@ -52,6 +51,7 @@ namespace ADS::IDE {
      * Displays the File menu containing file operations. Creates menu items for:
      * - New (Ctrl+N): Creates a new file via NavigationService
      * - Open (Ctrl+O): Opens an existing file via NavigationService
+     * - Import: Imports entities from a spreadsheet or Inform source via NavigationService
      * - Save (Ctrl+S): Saves the current file (placeholder implementation)
      * - Exit (Alt+F4): Closes the application via handleExit()
      *
@@ -64,18 +64,21 @@ namespace ADS::IDE {
      */
     void MenuBarRenderer::renderFileMenu()
     {
-        if (ImGui::BeginMenu(m_translationManager->_t("MENU.FILE_HEADER").data())) {
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.FILE_NEW").data(), "Ctrl+N")) {
+        if (ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_FILE_HEADER).data())) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_FILE_NEW).data(), "Ctrl+N")) {
                 this->m_navigationService->fileNewHandler();
             }
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.FILE_OPEN").data(), "Ctrl+O")) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_FILE_OPEN).data(), "Ctrl+O")) {
                 this->m_navigationService->fileOpenHandler();
             }
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.FILE_SAVE").data(), "Ctrl+S")) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_FILE_IMPORT).data())) {
+                this->m_navigationService->fileImportHandler();
+            }
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_FILE_SAVE).data(), "Ctrl+S")) {
                 // Handle save
             }
             ImGui::Separator();
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.FILE_EXIT").data(), "Alt+F4")) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_FILE_EXIT).data(), "Alt+F4")) {
                 handleExit();
             }
             ImGui::EndMenu();
@@ -89,39 +92,39 @@ namespace ADS::IDE {
      * @version Jan 2026
      *
      * Displays the Edit menu containing standard editing operations. Creates menu items for:
-     * - Undo (Ctrl+Z): Undo last action (placeholder implementation)
-     * - Redo (Shift+Ctrl+Z): Redo previously undone action (placeholder implementation)
-     * - Copy (Ctrl+C): Copy selection to clipboard (placeholder implementation)
+     * - Undo (Ctrl+Z): Undo the last property edit, via setEditCallbacks()
+     * - Redo (Shift+Ctrl+Z): Redo the last undone edit, via setEditCallbacks()
+     * - Copy (Ctrl+C): Copy the selected entities to the clipboard, via setClipboardCallbacks()
      * - Cut (Ctrl+X): Cut selection to clipboard (placeholder implementation)
-     * - Paste (Ctrl+V): Paste from clipboard (placeholder implementation)
+     * - Paste (Ctrl+V): Paste entities from the clipboard, via setClipboardCallbacks()
      *
      * All menu labels are retrieved from the translation manager for i18n support.
      *
      * @note Should be called within an active ImGui menu bar context
-     * @note All edit operations currently contain placeholder implementations
+     * @note Cut currently contains a placeholder implementation
      */
     void MenuBarRenderer::renderEditMenu()
     {
-        if (ImGui::BeginMenu(m_translationManager->_t("MENU.EDIT_HEADER").data())) {
-
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.EDIT_UNDO").data(), "Ctrl+Z")) {
+        if (ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_EDIT_HEADER).data())) {
 
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_EDIT_UNDO).data(), "Ctrl+Z") && m_onUndo) {
+                m_onUndo();
             }
 
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.EDIT_REDO").data(), "Shift+Ctrl+Z")) {
-
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_EDIT_REDO).data(), "Shift+Ctrl+Z") && m_onRedo) {
+                m_onRedo();
             }
             ImGui::Separator();
 
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.EDIT_COPY").data(), "Ctrl+C")) {
-
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_EDIT_COPY).data(), "Ctrl+C") && m_onCopy) {
+                m_onCopy();
             }
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.EDIT_CUT").data(), "Ctrl+X")) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_EDIT_CUT).data(), "Ctrl+X")) {
 
             }
 
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.EDIT_PASTE").data(), "Ctrl+V")) {
-
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_EDIT_PASTE).data(), "Ctrl+V") && m_onPaste) {
+                m_onPaste();
             }
             ImGui::EndMenu();
         }
@@ -137,6 +140,10 @@ namespace ADS::IDE {
      * - Zoom In (Ctrl++): Increase view zoom level (placeholder implementation)
      * - Zoom Out (Ctrl+-): Decrease view zoom level (placeholder implementation)
      * - Reset Layout: Restores the default IDE layout via LayoutManager
+     * - Frame Profiler: Shows or hides the per-panel timings, via setProfilerVisibility()
+     * - Memory: Shows or hides the heap bytes per subsystem, via setMemoryVisibility()
+     * - Generate Test Project: Replaces the project with a synthetic one of 10k, 100k
+     *   or 1M entities, via setGeneratorCallback()
      *
      * All menu labels are retrieved from the translation manager for i18n support.
      *
@@ -145,18 +152,36 @@ namespace ADS::IDE {
      */
     void MenuBarRenderer::renderViewMenu()
     {
-        if (ImGui::BeginMenu(m_translationManager->_t("MENU.VIEW_HEADER").data())) {
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.VIEW_ZOOM_IN").data(), "Ctrl++")) {
+        if (ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_VIEW_HEADER).data())) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_ZOOM_IN).data(), "Ctrl++")) {
 
             }
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.VIEW_ZOOM_OUT").data(), "Ctrl+-")) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_ZOOM_OUT).data(), "Ctrl+-")) {
 
             }
 
             ImGui::Separator();
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.VIEW_RESET_LAYOUT").data())) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_RESET_LAYOUT).data())) {
                 m_layoutManager->resetLayout();
             }
+            if (m_profilerVisible != nullptr) {
+                ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_PROFILER).data(), nullptr, m_profilerVisible);
+            }
+            if (m_memoryVisible != nullptr) {
+                ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_MEMORY).data(), nullptr, m_memoryVisible);
+            }
+            if (m_onGenerate && ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_VIEW_GENERATE_PROJECT).data())) {
+                if (ImGui::MenuItem("10k")) {
+                    m_onGenerate(10000);
+                }
+                if (ImGui::MenuItem("100k")) {
+                    m_onGenerate(100000);
+                }
+                if (ImGui::MenuItem("1M")) {
+                    m_onGenerate(1000000);
+                }
+                ImGui::EndMenu();
+            }
             ImGui::EndMenu();
         }
     }
@@ -180,17 +205,17 @@ namespace ADS::IDE {
      */
     void MenuBarRenderer::renderOptionsMenu()
     {
-        if (ImGui::BeginMenu(m_translationManager->_t("MENU.OPTIONS_HEADER").data())) {
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.OPTIONS_LANGUAGE_SELECTOR").data())) {
+        if (ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_OPTIONS_HEADER).data())) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_OPTIONS_LANGUAGE_SELECTOR).data())) {
 
             }
             ImGui::Separator();
             ImGui::Separator();
-            if (ImGui::BeginMenu(m_translationManager->_t("MENU.VIEW_THEME").data())) {
-                if (ImGui::MenuItem(m_translationManager->_t("MENU.VIEW_DARK_THEME").data())) {
+            if (ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_VIEW_THEME).data())) {
+                if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_DARK_THEME).data())) {
                     handleThemeChange(true);
                 }
-                if (ImGui::MenuItem(m_translationManager->_t("MENU.VIEW_LIGHT_THEME").data())) {
+                if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_VIEW_LIGHT_THEME).data())) {
                     handleThemeChange(false);
                 }
                 ImGui::EndMenu();
@@ -215,8 +240,8 @@ namespace ADS::IDE {
      */
     void MenuBarRenderer::renderHelpMenu()
     {
-        if (ImGui::BeginMenu(m_translationManager->_t("MENU.HELP_HEADER").data())) {
-            if (ImGui::MenuItem(m_translationManager->_t("MENU.HELP_ABOUT").data())) {
+        if (ImGui::BeginMenu(m_translationManager->_t(i18n::Key::MENU_HELP_HEADER).data())) {
+            if (ImGui::MenuItem(m_translationManager->_t(i18n::Key::MENU_HELP_ABOUT).data())) {
                 // Show about dialog
             }
             ImGui::EndMenu();
@@ -250,25 +275,26 @@ namespace ADS::IDE {
      * @brief Handle theme change
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
-     * Applies the specified theme to the ImGui interface. Creates an instance of
-     * either DarkTheme or LightTheme based on the parameter and calls its apply()
-     * method to update the ImGui style colors.
+     * Applies the specified theme to the ImGui interface through the App's
+     * ImGuiManager, which copies the style it built at startup.
      *
      * @param darkTheme True to apply dark theme, false to apply light theme
      *
-     * @see DarkTheme::apply()
-     * @see LightTheme::apply()
+     * @see UI::ImGuiManager::setDarkTheme()
+     * @see UI::ImGuiManager::setLightTheme()
      */
     void MenuBarRenderer::handleThemeChange(bool darkTheme)
     {
+        UI::ImGuiManager* imgui = Core::App::getImGuiManager();
+        if (imgui == nullptr) {
+            return;
+        }
         if (darkTheme) {
-            DarkTheme theme;
-            theme.apply();
+            imgui->setDarkTheme();
         } else {
-            LightTheme theme;
-            theme.apply();
+            imgui->setLightTheme();
         }
     }
 
@@ -319,6 +345,75 @@ namespace ADS::IDE {
         );
     }
 
+    void MenuBarRenderer::setImportCallback(std::function<void(const std::string&)> onImport)
+    {
+        m_navigationService->setImportCallback(std::move(onImport));
+    }
+
+    void MenuBarRenderer::setEditCallbacks(
+        std::function<void()> onUndo,
+        std::function<void()> onRedo)
+    {
+        m_onUndo = std::move(onUndo);
+        m_onRedo = std::move(onRedo);
+    }
+
+    /**
+     * @brief Register the Edit > Copy and Edit > Paste actions
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param onCopy  Callable invoked when Copy is selected
+     * @param onPaste Callable invoked when Paste is selected
+     */
+    void MenuBarRenderer::setClipboardCallbacks(
+        std::function<void()> onCopy,
+        std::function<void()> onPaste)
+    {
+        m_onCopy = std::move(onCopy);
+        m_onPaste = std::move(onPaste);
+    }
+
+    /**
+     * @brief Register the flag toggled by View > Frame Profiler
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param visible Flag owned by the caller; the item is hidden while nullptr
+     */
+    void MenuBarRenderer::setProfilerVisibility(bool* visible)
+    {
+        m_profilerVisible = visible;
+    }
+
+    /**
+     * @brief Register the flag toggled by View > Memory
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param visible Flag owned by the caller; the item is hidden while nullptr
+     */
+    void MenuBarRenderer::setMemoryVisibility(bool* visible)
+    {
+        m_memoryVisible = visible;
+    }
+
+    /**
+     * @brief Register the action of View > Generate Test Project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param onGenerate Callable receiving the entities to generate; the menu is hidden while empty
+     */
+    void MenuBarRenderer::setGeneratorCallback(std::function<void(size_t)> onGenerate)
+    {
+        m_onGenerate = std::move(onGenerate);
+    }
+
     /**
      * @brief Render any pending modal dialogs from the NavigationService
      *
@@ -340,11 +435,11 @@ namespace ADS::IDE {
      * @brief Execute any deferred native file dialogs
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Feb 2026
+     * @version Oct 2026
      *
      * Delegates to NavigationService::processPendingDialogs(). Called by
-     * IDERenderer after SDL_RenderPresent so that blocking NFD calls do not
-     * freeze the render loop mid-frame.
+     * IDERenderer after SDL_RenderPresent to start requested NFD dialogs and
+     * deliver the answers of closed ones.
      *
      * @see NavigationService::processPendingDialogs()
      */
@@ -57,6 +57,41 @@ namespace ADS::IDE {
          */
         i18n::i18n* m_translationManager;
 
+        /**
+         * @brief Invoked by Edit > Undo; set via setEditCallbacks()
+         */
+        std::function<void()> m_onUndo;
+
+        /**
+         * @brief Invoked by Edit > Redo; set via setEditCallbacks()
+         */
+        std::function<void()> m_onRedo;
+
+        /**
+         * @brief Invoked by Edit > Copy; set via setClipboardCallbacks()
+         */
+        std::function<void()> m_onCopy;
+
+        /**
+         * @brief Invoked by Edit > Paste; set via setClipboardCallbacks()
+         */
+        std::function<void()> m_onPaste;
+
+        /**
+         * @brief Flag toggled by View > Frame Profiler; set via setProfilerVisibility()
+         */
+        bool* m_profilerVisible = nullptr;
+
+        /**
+         * @brief Flag toggled by View > Memory; set via setMemoryVisibility()
+         */
+        bool* m_memoryVisible = nullptr;
+
+        /**
+         * @brief Invoked by View > Generate Test Project with the entity count; set via setGeneratorCallback()
+         */
+        std::function<void(size_t)> m_onGenerate;
+
         /**
          * @brief Render the File menu
          *
@@ -81,7 +116,7 @@ namespace ADS::IDE {
          *
          * Displays the Edit menu containing standard editing operations including
          * Undo (Ctrl+Z), Redo (Shift+Ctrl+Z), Copy (Ctrl+C), Cut (Ctrl+X), and
-         * Paste (Ctrl+V). Currently contains placeholder implementations.
+         * Paste (Ctrl+V). Cut is still a placeholder.
          *
          * @note Should be called within an active ImGui menu bar context
          */
@@ -150,16 +185,15 @@ namespace ADS::IDE {
          * @brief Handle theme change
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * Applies the specified theme to the ImGui interface by creating
-         * and applying either a DarkTheme or LightTheme instance based on
-         * the parameter value.
+         * Applies the specified theme to the ImGui interface through the App's
+         * ImGuiManager, which copies the style it built at startup.
          *
          * @param darkTheme True to apply dark theme, false to apply light theme
          *
-         * @see DarkTheme::apply()
-         * @see LightTheme::apply()
+         * @see UI::ImGuiManager::setDarkTheme()
+         * @see UI::ImGuiManager::setLightTheme()
          */
         void handleThemeChange(bool darkTheme);
 
@@ -231,6 +265,75 @@ namespace ADS::IDE {
             std::function<void(const std::string&)> onSave
         );
 
+        /**
+         * @brief Register the callback receiving the source picked by File > Import
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param onImport Callable receiving the absolute path from the Import dialog
+         * @see NavigationService::setImportCallback()
+         */
+        void setImportCallback(std::function<void(const std::string&)> onImport);
+
+        /**
+         * @brief Register the Edit > Undo and Edit > Redo actions
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param onUndo Callable invoked when Undo is selected
+         * @param onRedo Callable invoked when Redo is selected
+         */
+        void setEditCallbacks(
+            std::function<void()> onUndo,
+            std::function<void()> onRedo
+        );
+
+        /**
+         * @brief Register the Edit > Copy and Edit > Paste actions
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param onCopy  Callable invoked when Copy is selected
+         * @param onPaste Callable invoked when Paste is selected
+         */
+        void setClipboardCallbacks(
+            std::function<void()> onCopy,
+            std::function<void()> onPaste
+        );
+
+        /**
+         * @brief Register the flag toggled by View > Frame Profiler
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param visible Flag owned by the caller; the item is hidden while nullptr
+         */
+        void setProfilerVisibility(bool* visible);
+
+        /**
+         * @brief Register the flag toggled by View > Memory
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param visible Flag owned by the caller; the item is hidden while nullptr
+         */
+        void setMemoryVisibility(bool* visible);
+
+        /**
+         * @brief Register the action of View > Generate Test Project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param onGenerate Callable receiving the entities to generate; the menu is hidden while empty
+         */
+        void setGeneratorCallback(std::function<void(size_t)> onGenerate);
+
         /**
          * @brief Render any pending modal dialogs from the NavigationService
          *
@@ -249,12 +352,11 @@ namespace ADS::IDE {
          * @brief Execute any deferred native file dialogs
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Feb 2026
+         * @version Oct 2026
          *
          * Delegates to NavigationService::processPendingDialogs(). Must be
-         * called after SDL_RenderPresent and before the next ImGui::NewFrame()
-         * to ensure the compositor has a clean frame while the blocking NFD
-         * call is in progress.
+         * called after SDL_RenderPresent and before the next ImGui::NewFrame(),
+         * so open and save callbacks never run in the middle of a frame.
          *
          * @see NavigationService::processPendingDialogs()
          */
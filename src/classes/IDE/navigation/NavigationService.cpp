@@ -12,9 +12,12 @@
 
 
 #include "NavigationService.h"
+#include "app.h"
 #include "imgui.h"
 #include "spdlog/spdlog.h"
+#include "Logger/logger.h"
 #include <nfd.hpp>
+#include <thread>
 
 namespace ADS::IDE {
 
@@ -60,6 +63,11 @@ namespace ADS::IDE {
         m_onSaveProject = std::move(onSave);
     }
 
+    void NavigationService::setImportCallback(std::function<void(const std::string&)> onImport)
+    {
+        m_onImport = std::move(onImport);
+    }
+
     /**
      * @brief Handle the File Open action
      *
@@ -82,12 +90,24 @@ namespace ADS::IDE {
      */
     void NavigationService::fileOpenHandler()
     {
-        spdlog::info("Call NavigationService::fileOpenHandler");
+        ADS_LOG_INFO(Ui, "Call NavigationService::fileOpenHandler");
+        if (isDialogOpen()) {
+            return;
+        }
         // Defer the NFD call to processPendingDialogs() so it runs after
         // SDL_RenderPresent, preventing the gray-window artifact.
         m_pendingOpenDialog = true;
     }
 
+    void NavigationService::fileImportHandler()
+    {
+        ADS_LOG_INFO(Ui, "Call NavigationService::fileImportHandler");
+        if (isDialogOpen()) {
+            return;
+        }
+        m_pendingImportDialog = true;
+    }
+
     /**
      * @brief Handle the File New action
      *
@@ -105,7 +125,7 @@ namespace ADS::IDE {
      */
     void NavigationService::fileNewHandler()
     {
-        spdlog::info("Call NavigationService::fileNewHandler");
+        ADS_LOG_INFO(Ui, "Call NavigationService::fileNewHandler");
 
         if (m_hasActiveProject && m_hasActiveProject()) {
             // A project is open — ask the user before discarding it
@@ -155,10 +175,12 @@ namespace ADS::IDE {
 
             if (ImGui::Button("Save", ImVec2(90, 0))) {
                 // Defer the NFD save dialog to processPendingDialogs().
-                // The confirm modal closes now so the compositor gets a clean
-                // frame before the blocking call.
-                m_pendingSaveDialog  = true;
-                m_pendingSaveAndNew  = true;
+                // The confirm modal closes now so it is gone before the
+                // dialog opens.
+                if (!isDialogOpen()) {
+                    m_pendingSaveDialog  = true;
+                    m_pendingSaveAndNew  = true;
+                }
                 ImGui::CloseCurrentPopup();
             }
             ImGui::SameLine();
@@ -178,16 +200,17 @@ namespace ADS::IDE {
     }
 
     /**
-     * @brief Execute any deferred native file dialogs
+     * @brief Start deferred native file dialogs and deliver their answers
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Feb 2026
+     * @version Oct 2026
      *
-     * Checks m_pendingOpenDialog and m_pendingSaveDialog. For each flag that
-     * is set it opens the corresponding NFD dialog synchronously, forwards the
-     * result to the registered callback, and resets the flag. Because this
-     * method is called after SDL_RenderPresent the compositor already holds a
-     * clean frame, so blocking the thread here does not produce a gray window.
+     * First delivers the answer of a dialog the user has closed, then, if no
+     * dialog is open, starts the one flagged by m_pendingOpenDialog,
+     * m_pendingImportDialog or m_pendingSaveDialog, in that order. The dialog runs on a detached thread
+     * that shares only the DialogJob with this service, and wakes the render
+     * loop through App::requestRedraw() when the user closes it, so its
+     * answer is delivered on the next frame.
      *
      * If a save dialog was triggered by the "New project" confirmation modal
      * (m_pendingSaveAndNew is set) and the user confirms a path, m_onNewProject
@@ -196,45 +219,105 @@ namespace ADS::IDE {
      */
     void NavigationService::processPendingDialogs()
     {
-        nfdfilteritem_t filters[] = { { "ADS Project", "ads" } };
+        if (m_dialogJob && m_dialogJob->finished.load(std::memory_order_acquire)) {
+            const std::shared_ptr<DialogJob> job = std::move(m_dialogJob);
+            finishDialog(*job);
+        }
+
+        if (m_dialogJob || (!m_pendingOpenDialog && !m_pendingImportDialog && !m_pendingSaveDialog)) {
+            return;
+        }
 
+        auto job = std::make_shared<DialogJob>();
         if (m_pendingOpenDialog) {
             m_pendingOpenDialog = false;
+        } else if (m_pendingImportDialog) {
+            job->import = true;
+            m_pendingImportDialog = false;
+        } else {
+            job->save = true;
+            job->saveAndNew = m_pendingSaveAndNew;
+            m_pendingSaveDialog = false;
+            m_pendingSaveAndNew = false;
+        }
 
-            NFD::Guard guard;
-            NFD::UniquePath outPath;
-            nfdresult_t result = NFD::OpenDialog(outPath, filters, 1);
+#ifdef __APPLE__
+        // Cocoa panels must run on the main thread
+        runDialog(*job);
+        finishDialog(*job);
+#else
+        m_dialogJob = job;
+        std::thread([job]() {
+            runDialog(*job);
+            job->finished.store(true, std::memory_order_release);
+            Core::App::requestRedraw();
+        }).detach();
+#endif
+    }
 
-            if (result == NFD_OKAY) {
-                spdlog::info("NavigationService: open path selected — {}",
-                             outPath.get());
-                if (m_onOpenProject) m_onOpenProject(outPath.get());
-            } else if (result == NFD_ERROR) {
-                spdlog::error("NavigationService: NFD error — {}", NFD::GetError());
-            }
-            // NFD_CANCEL: user dismissed the dialog — nothing to do
+    bool NavigationService::isDialogOpen() const
+    {
+        return m_dialogJob != nullptr;
+    }
+
+    void NavigationService::runDialog(DialogJob &job)
+    {
+        nfdfilteritem_t filters[] = {
+            { "ADS Project", "ads" },
+            { "ADS Project (JSON)", "adsproj" }
+        };
+        constexpr nfdfiltersize_t filterCount = sizeof(filters) / sizeof(filters[0]);
+        nfdfilteritem_t importFilters[] = {
+            { "Spreadsheet", "csv,tsv,tab" },
+            { "Inform source", "ni,i7,txt" }
+        };
+        constexpr nfdfiltersize_t importFilterCount = sizeof(importFilters) / sizeof(importFilters[0]);
+
+        NFD::Guard guard;
+        NFD::UniquePath path;
+        nfdresult_t result;
+        if (job.save) {
+            result = NFD::SaveDialog(path, filters, filterCount, nullptr, "project.ads");
+        } else if (job.import) {
+            result = NFD::OpenDialog(path, importFilters, importFilterCount);
+        } else {
+            result = NFD::OpenDialog(path, filters, filterCount);
         }
 
-        if (m_pendingSaveDialog) {
-            m_pendingSaveDialog = false;
-            bool saveAndNew     = m_pendingSaveAndNew;
-            m_pendingSaveAndNew = false;
+        if (result == NFD_OKAY) {
+            job.chosen = true;
+            job.path = path.get();
+        } else if (result == NFD_ERROR) {
+            job.error = NFD::GetError();
+        }
+        // NFD_CANCEL: user dismissed the dialog — nothing to report
+    }
 
-            NFD::Guard guard;
-            NFD::UniquePath savePath;
-            nfdresult_t result = NFD::SaveDialog(
-                savePath, filters, 1, nullptr, "project.ads");
-
-            if (result == NFD_OKAY) {
-                spdlog::info("NavigationService: save path selected — {}",
-                             savePath.get());
-                if (m_onSaveProject) m_onSaveProject(savePath.get());
-                if (saveAndNew && m_onNewProject) m_onNewProject();
-            } else if (result == NFD_ERROR) {
-                spdlog::error("NavigationService: NFD error — {}", NFD::GetError());
-            }
-            // NFD_CANCEL: user cancelled — neither save nor new-project proceeds
+    void NavigationService::finishDialog(const DialogJob &job)
+    {
+        if (!job.error.empty()) {
+            ADS_LOG_ERROR(Ui, "NavigationService: NFD error — {}", job.error);
+            return;
+        }
+        if (!job.chosen) {
+            // Cancelled: neither open, save nor new-project proceeds
+            return;
         }
+
+        if (job.save) {
+            ADS_LOG_INFO(Ui, "NavigationService: save path selected — {}", job.path);
+            if (m_onSaveProject) m_onSaveProject(job.path);
+            if (job.saveAndNew && m_onNewProject) m_onNewProject();
+        } else if (job.import) {
+            ADS_LOG_INFO(Ui, "NavigationService: import path selected — {}", job.path);
+            if (m_onImport) m_onImport(job.path);
+        } else {
+            ADS_LOG_INFO(Ui, "NavigationService: open path selected — {}", job.path);
+            if (m_onOpenProject) m_onOpenProject(job.path);
+        }
+
+        // Callbacks run after this frame was presented; show their result now
+        Core::App::requestRedraw();
     }
 
 } // ADS::IDE
\ No newline at end of file
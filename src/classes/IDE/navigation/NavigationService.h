@@ -14,7 +14,9 @@
 #ifndef ADS_NAVIGATION_SERVICE_H
 #define ADS_NAVIGATION_SERVICE_H
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <string>
 
 namespace ADS::IDE {
@@ -70,6 +72,14 @@ namespace ADS::IDE {
          */
         std::function<void(const std::string&)> m_onSaveProject;
 
+        /**
+         * @brief Callback invoked when the user selects a file to import
+         *
+         * Receives the absolute path chosen by the user in the import dialog.
+         * Set via setImportCallback(). If nullptr the path is only logged.
+         */
+        std::function<void(const std::string&)> m_onImport;
+
         /**
          * @brief Pending-dialog flag for the ImGui "New project" confirmation modal
          *
@@ -96,6 +106,14 @@ namespace ADS::IDE {
          */
         bool m_pendingSaveDialog = false;
 
+        /**
+         * @brief Deferred import-dialog flag
+         *
+         * Set by fileImportHandler(). Consumed by processPendingDialogs()
+         * after the next SDL_RenderPresent.
+         */
+        bool m_pendingImportDialog = false;
+
         /**
          * @brief Whether a pending save should also trigger a new project
          *
@@ -105,6 +123,47 @@ namespace ADS::IDE {
          */
         bool m_pendingSaveAndNew = false;
 
+        /**
+         * @brief A native file dialog shown off the UI thread, and its answer
+         *
+         * Shared by the service and the dialog thread, so the thread never
+         * touches the service and may outlive it. Every field but finished is
+         * written by the dialog thread before it sets finished.
+         */
+        struct DialogJob {
+            bool save = false;                  ///< Save dialog, otherwise Open
+            bool import = false;                ///< Open dialog for a source to import
+            bool saveAndNew = false;            ///< Create a new project after saving
+            bool chosen = false;                ///< The user picked a path
+            std::string path;                   ///< Picked path, if chosen
+            std::string error;                  ///< NFD error, empty on success or cancel
+            std::atomic<bool> finished{false};
+        };
+
+        /**
+         * @brief Dialog currently open, nullptr when none
+         *
+         * Started by processPendingDialogs() and answered by it on the first
+         * call after the user closes the dialog.
+         */
+        std::shared_ptr<DialogJob> m_dialogJob;
+
+        /**
+         * @brief Show a native dialog and store the answer in the job
+         *
+         * Blocks until the user closes the dialog.
+         *
+         * @param job Dialog to show
+         */
+        static void runDialog(DialogJob &job);
+
+        /**
+         * @brief Forward the answer of a closed dialog to the file callbacks
+         *
+         * @param job Finished dialog
+         */
+        void finishDialog(const DialogJob &job);
+
         /** ImGui popup identifier used for the "new project" confirmation modal */
         static constexpr const char* NEW_PROJECT_POPUP_ID = "New project##ads_confirm_new";
 
@@ -160,6 +219,17 @@ namespace ADS::IDE {
             std::function<void(const std::string&)> onSave
         );
 
+        /**
+         * @brief Register the callback receiving the file picked in the import dialog
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param onImport Callable receiving the absolute path the user selected
+         *                 in the Import dialog; called only on NFD_OKAY
+         */
+        void setImportCallback(std::function<void(const std::string&)> onImport);
+
         /**
          * @brief Handle the File Open action
          *
@@ -167,15 +237,29 @@ namespace ADS::IDE {
          * @version Feb 2026
          *
          * Schedules a native OS file picker by setting an internal pending flag.
-         * The actual NFD call is deferred to processPendingDialogs(), which must
-         * be called after SDL_RenderPresent to avoid the gray-window artifact that
-         * occurs when the render loop is blocked mid-frame.
+         * The actual NFD call is deferred to processPendingDialogs(), which
+         * shows it without blocking the render loop. Ignored while another
+         * dialog is open.
          *
          * @note Does not block; the dialog opens on the next processPendingDialogs() call
          * @see processPendingDialogs(), setFileCallbacks()
          */
         void fileOpenHandler();
 
+        /**
+         * @brief Handle the File Import action
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Schedules a native file picker filtered to the formats
+         * Core::ImportParser reads, like fileOpenHandler(). Ignored while
+         * another dialog is open.
+         *
+         * @see processPendingDialogs(), setImportCallback()
+         */
+        void fileImportHandler();
+
         /**
          * @brief Handle the File New action
          *
@@ -215,24 +299,33 @@ namespace ADS::IDE {
         void renderDialogs();
 
         /**
-         * @brief Execute any deferred native file dialogs
+         * @brief Start deferred native file dialogs and deliver their answers
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Feb 2026
+         * @version Oct 2026
          *
-         * Must be called **after** SDL_RenderPresent (i.e. after render() returns)
-         * and **before** the next ImGui::NewFrame(). At that point the compositor
-         * already holds a clean frame so blocking the main thread with a native
-         * dialog does not produce a gray window.
+         * Call once per loop iteration on the UI thread, after SDL_RenderPresent.
+         * A requested dialog is shown on its own thread, so the editor keeps
+         * rendering while it is open; when the user closes it, the next call
+         * forwards the chosen path to m_onOpenProject or m_onSaveProject on
+         * the UI thread. One dialog is open at a time.
          *
-         * Consumes m_pendingOpenDialog and m_pendingSaveDialog. For each flag that
-         * is set it opens the corresponding NFD dialog, forwards the result to the
-         * registered callback, and resets the flag.
+         * On macOS native dialogs must run on the main thread, so there the
+         * dialog is still shown from this call and blocks until it closes.
          *
-         * @note This method is a no-op when no dialog is pending
-         * @see fileOpenHandler(), renderDialogs()
+         * Consumes m_pendingOpenDialog, m_pendingImportDialog and m_pendingSaveDialog.
+         *
+         * @note This method is a no-op when no dialog is pending or open
+         * @see fileOpenHandler(), renderDialogs(), isDialogOpen()
          */
         void processPendingDialogs();
+
+        /**
+         * @brief Check whether a native file dialog is open
+         *
+         * @return bool True from the dialog being shown until its answer is delivered
+         */
+        [[nodiscard]] bool isDialogOpen() const;
     };
 } // ADS::IDE
 #endif //ADS_NAVIGATION_SERVICE_H
\ No newline at end of file
@@ -14,8 +14,7 @@
 #include "ToolBarRenderer.h"
 #include "imgui.h"
 #include "IconsFontAwesome4.h"
-#include "../themes/DarkTheme.h"
-#include "../themes/LightTheme.h"
+#include "app.h"
 
 namespace ADS::IDE {
     /**
@@ -48,12 +47,14 @@ namespace ADS::IDE {
      * @brief Render a toolbar button with an icon
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
-     * Creates and renders an icon button using FontAwesome icons. Retrieves the
-     * icon font from the font manager (inherited from IDEBase) and temporarily
-     * pushes it for button rendering. If the icon font is unavailable, uses the
-     * default font. Displays a tooltip when the user hovers over the button.
+     * Draws the FontAwesome icon as an image cut from the font atlas,
+     * centred in a button sized like the icon laid out as text. Icons share
+     * the font texture with the text, so the whole toolbar stays in one draw
+     * command and no font is pushed per button. Falls back to the icon as
+     * button text when the icon font is unavailable. Displays a tooltip
+     * when the user hovers over the button.
      *
      * @param icon FontAwesome icon character constant (e.g., ICON_FA_FILE_O)
      * @param tooltip Tooltip text to display on hover
@@ -61,24 +62,29 @@ namespace ADS::IDE {
      * @return true if the button was clicked, false otherwise
      *
      * @note The icon font must be loaded in the font manager for proper rendering
-     * @see UI::Fonts::getFont()
+     * @see UI::Fonts::findIcon()
      * @see IDEBase::getFontManager()
      */
     bool ToolBarRenderer::renderIconButton(const char *icon, const char *tooltip)
     {
-        // Get the icon font from the font manager (inherited from IDEBase)
         UI::Fonts* fontManager = this->getFontManager();
-        ImFont* iconFont = fontManager != nullptr ? fontManager->getFont("icons") : nullptr;
-
-        // Push the icon font if available, otherwise use default
-        if (iconFont != nullptr) {
-            ImGui::PushFont(iconFont);
-        }
+        UI::Fonts::IconImage image{};
+        bool clicked;
 
-        bool clicked = ImGui::Button(icon);
+        if (fontManager != nullptr && fontManager->findIcon(icon, image)) {
+            const ImVec2 padding = ImGui::GetStyle().FramePadding;
+            ImGui::PushID(icon);
+            clicked = ImGui::Button("##icon", ImVec2(image.cell.x + padding.x * 2.0f, image.cell.y + padding.y * 2.0f));
+            ImGui::PopID();
 
-        if (iconFont != nullptr) {
-            ImGui::PopFont();
+            const ImVec2 origin = ImGui::GetItemRectMin();
+            ImGui::GetWindowDrawList()->AddImage(
+                image.texture,
+                ImVec2(origin.x + padding.x + image.min.x, origin.y + padding.y + image.min.y),
+                ImVec2(origin.x + padding.x + image.max.x, origin.y + padding.y + image.max.y),
+                image.uv0, image.uv1, ImGui::GetColorU32(ImGuiCol_Text));
+        } else {
+            clicked = ImGui::Button(icon);
         }
 
         if (ImGui::IsItemHovered()) {
@@ -107,17 +113,17 @@ namespace ADS::IDE {
      */
     void ToolBarRenderer::renderFileButtons()
     {
-        if (renderIconButton(ICON_FA_FILE_O, m_translationManager->_t("MENU.FILE_NEW").data())) {
+        if (renderIconButton(ICON_FA_FILE_O, m_translationManager->_t(i18n::Key::MENU_FILE_NEW).data())) {
             this->m_navigationService->fileNewHandler();
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_FOLDER_OPEN_O, m_translationManager->_t("MENU.FILE_OPEN").data())) {
+        if (renderIconButton(ICON_FA_FOLDER_OPEN_O, m_translationManager->_t(i18n::Key::MENU_FILE_OPEN).data())) {
             this->m_navigationService->fileOpenHandler();
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_FLOPPY_O, m_translationManager->_t("MENU.FILE_SAVE").data())) {
+        if (renderIconButton(ICON_FA_FLOPPY_O, m_translationManager->_t(i18n::Key::MENU_FILE_SAVE).data())) {
             // Handle save file
         }
     }
@@ -147,12 +153,12 @@ namespace ADS::IDE {
         ImGui::Separator();
         ImGui::SameLine();
 
-        if (renderIconButton(ICON_FA_UNDO, m_translationManager->_t("MENU.EDIT_UNDO").data())) {
+        if (renderIconButton(ICON_FA_UNDO, m_translationManager->_t(i18n::Key::MENU_EDIT_UNDO).data())) {
             // Handle undo
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_REPEAT, m_translationManager->_t("MENU.EDIT_REDO").data())) {
+        if (renderIconButton(ICON_FA_REPEAT, m_translationManager->_t(i18n::Key::MENU_EDIT_REDO).data())) {
             // Handle redo
         }
 
@@ -160,17 +166,17 @@ namespace ADS::IDE {
         ImGui::Separator();
         ImGui::SameLine();
 
-        if (renderIconButton(ICON_FA_SCISSORS, m_translationManager->_t("MENU.EDIT_CUT").data())) {
+        if (renderIconButton(ICON_FA_SCISSORS, m_translationManager->_t(i18n::Key::MENU_EDIT_CUT).data())) {
             // Handle cut
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_FILES_O, m_translationManager->_t("MENU.EDIT_COPY").data())) {
+        if (renderIconButton(ICON_FA_FILES_O, m_translationManager->_t(i18n::Key::MENU_EDIT_COPY).data())) {
             // Handle copy
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_CLIPBOARD, m_translationManager->_t("MENU.EDIT_PASTE").data())) {
+        if (renderIconButton(ICON_FA_CLIPBOARD, m_translationManager->_t(i18n::Key::MENU_EDIT_PASTE).data())) {
             // Handle paste
         }
     }
@@ -197,17 +203,17 @@ namespace ADS::IDE {
         ImGui::Separator();
         ImGui::SameLine();
 
-        if (renderIconButton(ICON_FA_SEARCH_PLUS, m_translationManager->_t("MENU.VIEW_ZOOM_IN").data())) {
+        if (renderIconButton(ICON_FA_SEARCH_PLUS, m_translationManager->_t(i18n::Key::MENU_VIEW_ZOOM_IN).data())) {
             // Handle zoom in
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_SEARCH_MINUS, m_translationManager->_t("MENU.VIEW_ZOOM_OUT").data())) {
+        if (renderIconButton(ICON_FA_SEARCH_MINUS, m_translationManager->_t(i18n::Key::MENU_VIEW_ZOOM_OUT).data())) {
             // Handle zoom out
         }
 
         ImGui::SameLine();
-        if (renderIconButton(ICON_FA_REFRESH, m_translationManager->_t("MENU.VIEW_RESET_LAYOUT").data())) {
+        if (renderIconButton(ICON_FA_REFRESH, m_translationManager->_t(i18n::Key::MENU_VIEW_RESET_LAYOUT).data())) {
             m_layoutManager->resetLayout();
         }
     }
@@ -216,25 +222,26 @@ namespace ADS::IDE {
      * @brief Handle theme change
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
-     * Applies the specified theme to the ImGui interface. Creates an instance of
-     * either DarkTheme or LightTheme based on the parameter and calls its apply()
-     * method to update the ImGui style colors and visual appearance.
+     * Applies the specified theme to the ImGui interface through the App's
+     * ImGuiManager, which copies the style it built at startup.
      *
      * @param darkTheme True to apply dark theme, false to apply light theme
      *
-     * @see DarkTheme::apply()
-     * @see LightTheme::apply()
+     * @see UI::ImGuiManager::setDarkTheme()
+     * @see UI::ImGuiManager::setLightTheme()
      */
     void ToolBarRenderer::handleThemeChange(bool darkTheme)
     {
+        UI::ImGuiManager* imgui = Core::App::getImGuiManager();
+        if (imgui == nullptr) {
+            return;
+        }
         if (darkTheme) {
-            DarkTheme theme;
-            theme.apply();
+            imgui->setDarkTheme();
         } else {
-            LightTheme theme;
-            theme.apply();
+            imgui->setLightTheme();
         }
     }
 
@@ -79,12 +79,12 @@ namespace ADS::IDE {
          * @brief Render a toolbar button with an icon
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * Creates and renders an icon button using FontAwesome icons. The button
-         * uses the icon font from the font manager if available, otherwise falls
-         * back to the default font. Displays a tooltip when the user hovers over
-         * the button.
+         * Creates and renders an icon button using FontAwesome icons. The icon
+         * is drawn as an image from the font atlas, so no font is pushed; if
+         * the icon font is unavailable the icon is the button text instead.
+         * Displays a tooltip when the user hovers over the button.
          *
          * @param icon FontAwesome icon character constant (e.g., ICON_FA_FILE_O)
          * @param tooltip Tooltip text to display on hover
@@ -92,7 +92,7 @@ namespace ADS::IDE {
          * @return true if the button was clicked, false otherwise
          *
          * @note The icon font must be loaded in the font manager
-         * @see UI::Fonts::getFont()
+         * @see UI::Fonts::findIcon()
          */
         bool renderIconButton(const char *icon, const char *tooltip);
 
@@ -146,16 +146,15 @@ namespace ADS::IDE {
          * @brief Handle theme change
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * Applies the specified theme to the ImGui interface. Creates an instance of
-         * either DarkTheme or LightTheme based on the parameter and calls its apply()
-         * method to update the ImGui style colors.
+         * Applies the specified theme to the ImGui interface through the App's
+         * ImGuiManager, which copies the style it built at startup.
          *
          * @param darkTheme True to apply dark theme, false to apply light theme
          *
-         * @see DarkTheme::apply()
-         * @see LightTheme::apply()
+         * @see UI::ImGuiManager::setDarkTheme()
+         * @see UI::ImGuiManager::setLightTheme()
          */
         void handleThemeChange(bool darkTheme);
 
@@ -37,7 +37,7 @@ namespace ADS::IDE::Panels {
      * @param name Window name for the panel
      */
     BasePanel::BasePanel(const std::string& name)
-        : m_windowName(name), m_windowTitle(name), m_isVisible(true) {
+        : m_windowName(name), m_windowTitle(name), m_labelRevision(0), m_isVisible(true) {
         this->m_environment = Core::App::getEnv();
         this->m_translationsManager = Core::App::getTranslationsManager();
     }
@@ -105,8 +105,40 @@ namespace ADS::IDE::Panels {
         return this->m_translationsManager;
     };
 
-    std::string BasePanel::getImGuiLabel() const {
-        return m_windowTitle;
+    /**
+     * @brief Title the window with a translation
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param key Translation key of the title
+     */
+    void BasePanel::setTitle(const i18n::Key key) {
+        m_titleKey = key;
+        m_imguiLabel.clear();
+    }
+
+    /**
+     * @brief Get the ImGui window label combining title and stable ID
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return const std::string& ImGui label; the window name if it has no ### id
+     */
+    const std::string& BasePanel::getImGuiLabel() const {
+        const uint64_t revision = m_translationsManager ? m_translationsManager->getRevision() : 0;
+        if (!m_imguiLabel.empty() && revision == m_labelRevision) {
+            return m_imguiLabel;
+        }
+
+        if (m_titleKey && m_translationsManager) {
+            m_windowTitle = m_translationsManager->_t(*m_titleKey);
+        }
+        // Only a "###" name separates the identity from the title shown
+        m_imguiLabel = m_windowName.starts_with("###") ? m_windowTitle + m_windowName : m_windowTitle;
+        m_labelRevision = revision;
+        return m_imguiLabel;
     }
 
 }
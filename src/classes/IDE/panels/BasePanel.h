@@ -14,6 +14,8 @@
 #ifndef ADS_BASE_PANEL_H
 #define ADS_BASE_PANEL_H
 
+#include <cstdint>
+#include <optional>
 #include <string>
 
 #include "env/env.h"
@@ -49,15 +51,44 @@ namespace ADS::IDE::Panels {
         std::string m_windowName;
 
         /**
-         * Translated display title shown in the window title bar
+         * Translated display title shown in the window title bar; follows
+         * m_titleKey when one is set
          */
-        std::string m_windowTitle;
+        mutable std::string m_windowTitle;
+
+        /**
+         * Translation key of the title, set by setTitle()
+         */
+        std::optional<i18n::Key> m_titleKey;
+
+        /**
+         * Label passed to ImGui::Begin(), cached by getImGuiLabel()
+         */
+        mutable std::string m_imguiLabel;
+
+        /**
+         * Translations revision m_imguiLabel was built for
+         */
+        mutable uint64_t m_labelRevision;
 
         /**
          * Panel visibility state
          */
         bool m_isVisible;
 
+        /**
+         * @brief Title the window with a translation
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The title is translated again when the locale changes; the window
+         * keeps its identity, which comes from the window name only.
+         *
+         * @param key Translation key of the title
+         */
+        void setTitle(i18n::Key key);
+
     public:
         /**
          * @brief Construct a new BasePanel object
@@ -143,13 +174,17 @@ namespace ADS::IDE::Panels {
         /**
          * @brief Get the ImGui window label combining title and stable ID
          *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
          * Returns a string in the form "Translated Title###stable_id" so that
          * ImGui uses the stable ID for docking/identity while displaying the
-         * translated title in the title bar.
+         * translated title in the title bar. The label is built once and
+         * again only when the translations change, not every frame.
          *
-         * @return std::string ImGui label with ### separator
+         * @return const std::string& ImGui label; the window name if it has no ### id
          */
-        std::string getImGuiLabel() const;
+        const std::string& getImGuiLabel() const;
 
         /**
          * @brief Get the translations manager
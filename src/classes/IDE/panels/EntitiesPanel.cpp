@@ -19,9 +19,61 @@
  */
 
 #include "EntitiesPanel.h"
+#include "System.h"
+#include "Core/Profiling.h"
 #include "imgui.h"
+#include "IconsFontAwesome4.h"
+#include <algorithm>
+#include <array>
+#include <string_view>
 
 namespace ADS::IDE::Panels {
+    namespace {
+        // Badge text colors from DESIGN.md §3.5
+        const ImU32 BADGE_GREEN = IM_COL32(89, 196, 161, 255);
+        const ImU32 BADGE_BLUE = IM_COL32(110, 196, 232, 255);
+        const ImU32 BADGE_ORANGE = IM_COL32(232, 163, 74, 255);
+
+        // Indexed by Item::getItemType(), in the order of Item::getItemTypes()
+        constexpr std::array<const char*, 8> ITEM_ICONS = {
+            ICON_FA_CUBE,           // Generic
+            ICON_FA_KEY,            // Key
+            ICON_FA_GAVEL,          // Weapon
+            ICON_FA_SHIELD,         // Armor
+            ICON_FA_FLASK,          // Consumable
+            ICON_FA_STAR,           // Quest Item
+            ICON_FA_FILE_TEXT_O,    // Document
+            ICON_FA_ARCHIVE         // Container
+        };
+        constexpr int QUEST_ITEM_TYPE = 5;
+
+        std::string composeLabel(const char* icon, const Entities::BaseEntity& entity) {
+            std::string label;
+            label.reserve(entity.getName().size() + 24);
+            label.append(icon).append(" ").append(entity.getName()).append("##");
+            label.append(std::to_string(entity.getHandle().value()));
+            return label;
+        }
+
+        /**
+         * Pill after the last item, as in DESIGN.md §3.5, with its background
+         * the text color at low alpha
+         */
+        void renderBadge(const std::string_view text, const ImU32 color) {
+            ImGui::SameLine();
+            const ImVec2 position = ImGui::GetCursorScreenPos();
+            const ImVec2 textSize = ImGui::CalcTextSize(text.data(), text.data() + text.size());
+            const float padX = 4.0f;
+            const float padY = 1.0f;
+            const ImVec2 max(position.x + textSize.x + padX * 2, position.y + textSize.y + padY * 2);
+
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+            drawList->AddRectFilled(position, max, (color & ~IM_COL32_A_MASK) | IM_COL32(0, 0, 0, 38), 7.0f);
+            drawList->AddText(ImVec2(position.x + padX, position.y + padY), color, text.data(), text.data() + text.size());
+            ImGui::Dummy(ImVec2(max.x - position.x, max.y - position.y));
+        }
+    }
+
     /**
      * @brief Construct a new EntitiesPanel object
      *
@@ -31,8 +83,97 @@ namespace ADS::IDE::Panels {
      * Initializes the entities panel with name "Entities".
      */
     EntitiesPanel::EntitiesPanel()
-        : BasePanel("hEntities") {
-        m_windowTitle = this->getTranslationsManager()->_t("ENTITIES");
+        : BasePanel(Constants::System::ENTITIES_WINDOW_ID) {
+        setTitle(i18n::Key::ENTITIES);
+    }
+
+    EntitiesPanel::~EntitiesPanel() {
+        if (m_project) {
+            for (const Inspector::SubscriptionHandle handle : m_labelSubscriptions) {
+                m_project->unsubscribe(handle);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the cached label of an entity, building it on first use
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Only rows in view reach this, so a large project builds the labels
+     * it scrolls through, once each.
+     */
+    template<typename Entity>
+    const EntitiesPanel::RowLabel& EntitiesPanel::labelOf(const Entity& entity) {
+        auto [label, added] = m_labels.try_emplace(entity.getHandle().value());
+        if (added) {
+            label->second = buildLabel(entity);
+        }
+        return label->second;
+    }
+
+    EntitiesPanel::RowLabel EntitiesPanel::buildLabel(const Entities::Scene& scene) {
+        RowLabel label;
+        label.text = composeLabel(ICON_FA_MAP_MARKER, scene);
+        if (scene.isStartScene()) {
+            label.badge = i18n::Key::TREE_BADGE_START;
+            label.badgeColor = BADGE_GREEN;
+        }
+        return label;
+    }
+
+    EntitiesPanel::RowLabel EntitiesPanel::buildLabel(const Entities::Character& character) {
+        RowLabel label;
+        label.text = composeLabel(ICON_FA_USER, character);
+        if (character.isPlayer()) {
+            label.badge = i18n::Key::TREE_BADGE_PLAYER;
+            label.badgeColor = BADGE_BLUE;
+        }
+        return label;
+    }
+
+    EntitiesPanel::RowLabel EntitiesPanel::buildLabel(const Entities::Item& item) {
+        const int type = item.getItemType();
+        const bool known = type >= 0 && static_cast<size_t>(type) < ITEM_ICONS.size();
+        RowLabel label;
+        label.text = composeLabel(known ? ITEM_ICONS[static_cast<size_t>(type)] : ICON_FA_CUBE, item);
+        if (type == QUEST_ITEM_TYPE) {
+            label.badge = i18n::Key::TREE_BADGE_QUEST;
+            label.badgeColor = BADGE_ORANGE;
+        }
+        return label;
+    }
+
+    /**
+     * @brief Listen to the properties shown in the labels of the current project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Listeners are immediate, so a rename made by the inspector in this
+     * frame shows in the tree in the same frame.
+     */
+    void EntitiesPanel::watchLabels() {
+        m_labels.clear();
+        if (!m_project) {
+            return;
+        }
+
+        const auto forget = [this](const Core::EntityHandle handle, const Inspector::PropertyChangedEvent&) {
+            m_labels.erase(handle.value());
+        };
+        const std::array<std::pair<Core::EntityKind, const char*>, 6> watched = {{
+            {Core::EntityKind::Scene, "name"},
+            {Core::EntityKind::Scene, "isStartScene"},
+            {Core::EntityKind::Character, "name"},
+            {Core::EntityKind::Character, "isPlayer"},
+            {Core::EntityKind::Item, "name"},
+            {Core::EntityKind::Item, "itemType"},
+        }};
+        for (const auto& [kind, property] : watched) {
+            m_labelSubscriptions.push_back(m_project->subscribe(kind, property, forget));
+        }
     }
 
     /**
@@ -43,22 +184,238 @@ namespace ADS::IDE::Panels {
      *
      * Displays a collapsible tree node containing all scene entities
      * from the active project. Each scene is rendered as a selectable row;
-     * clicking one updates m_selectedEntity and fires m_onSelectionChanged.
+     * clicking one updates the selection and fires m_onSelectionChanged.
      *
      * @note Returns immediately if no project has been set via setProject()
      * @see setProject(), setSelectionCallback()
      */
     void EntitiesPanel::renderSceneTree() {
         if (!m_project) return;
-        if (ImGui::TreeNode(this->getTranslationsManager()->_t("TREE_NODE_SCENE").c_str())) {
-            for (const auto& scene : m_project->getScenes()) {
-                bool selected = (m_selectedEntity == scene.get());
-                if (ImGui::Selectable(scene->getDisplayName().c_str(), selected)) {
-                    m_selectedEntity = scene.get();
-                    if (m_onSelectionChanged) m_onSelectionChanged(m_selectedEntity);
+        if (ImGui::TreeNode(this->getTranslationsManager()->_t(i18n::Key::TREE_NODE_SCENE).data())) {
+            renderEntityRows(m_project->getScenes(), m_sceneRows);
+            ImGui::TreePop();
+        }
+    }
+
+    /**
+     * @brief Render the search bar filtering the entity trees
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Matches are cached per query and project generation, so typing costs
+     * one indexed search per keystroke and idle frames cost nothing.
+     *
+     * @see Core::Project::search()
+     */
+    void EntitiesPanel::renderSearchBar() {
+        ImGui::SetNextItemWidth(-1);
+        ImGui::InputTextWithHint("##search",
+                                 this->getTranslationsManager()->_t(i18n::Key::ENTITIES_SEARCH_HINT).data(),
+                                 m_searchBuffer, sizeof(m_searchBuffer));
+
+        const std::string_view query(m_searchBuffer);
+        if (!m_project || query.empty()) {
+            if (!m_searchQuery.empty()) {
+                m_searchQuery.clear();
+                m_rowsStale = true;
+            }
+            return;
+        }
+        if (query != m_searchQuery || m_project->getGeneration() != m_searchGeneration) {
+            m_searchQuery = query;
+            m_searchGeneration = m_project->getGeneration();
+            collectMatches(query);
+            m_rowsStale = true;
+        }
+    }
+
+    /**
+     * @brief Fill m_searchMatches for a search bar query
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Terms naming a scalar property, such as `quantity>10` or `!isPlayer`,
+     * filter through the project's property columns and keep only the
+     * kinds that have every property named; the other terms are searched
+     * for as text among what the filters left.
+     */
+    void EntitiesPanel::collectMatches(std::string_view query) {
+        ADS_ZONE("EntitiesPanel::collectMatches");
+        const auto isColumn = [this](const std::string& property) {
+            for (size_t kind = 0; kind < Core::ENTITY_KIND_COUNT; ++kind) {
+                if (m_project->getColumns(static_cast<Core::EntityKind>(kind)).findColumn(property) != nullptr) {
+                    return true;
                 }
             }
-            ImGui::TreePop();
+            return false;
+        };
+
+        std::vector<Core::ColumnFilter> filters;
+        std::string text;
+        while (!query.empty()) {
+            const size_t space = query.find(' ');
+            const std::string_view term = query.substr(0, space);
+            query.remove_prefix(space == std::string_view::npos ? query.size() : space + 1);
+            if (term.empty()) {
+                continue;
+            }
+            if (auto filter = Core::ColumnFilter::parse(term); filter && isColumn(filter->property)) {
+                filters.push_back(std::move(*filter));
+            } else {
+                text.append(text.empty() ? "" : " ").append(term);
+            }
+        }
+
+        m_searchMatches.clear();
+        if (filters.empty()) {
+            for (const Core::EntityHandle handle : m_project->search(text)) {
+                m_searchMatches.insert(handle.value());
+            }
+            return;
+        }
+
+        for (size_t kind = 0; kind < Core::ENTITY_KIND_COUNT; ++kind) {
+            const Core::PropertyColumns& columns = m_project->getColumns(static_cast<Core::EntityKind>(kind));
+            if (std::ranges::any_of(filters, [&columns](const Core::ColumnFilter& filter) {
+                    return columns.findColumn(filter.property) == nullptr;
+                })) {
+                continue;
+            }
+            Core::ColumnQuery filtered = m_project->query(static_cast<Core::EntityKind>(kind));
+            for (const Core::ColumnFilter& filter : filters) {
+                filtered.where(filter);
+            }
+            for (const Core::EntityHandle handle : filtered.handles()) {
+                m_searchMatches.insert(handle.value());
+            }
+        }
+        if (!text.empty()) {
+            std::unordered_set<uint64_t> filtered;
+            for (const Core::EntityHandle handle : m_project->search(text)) {
+                if (m_searchMatches.contains(handle.value())) {
+                    filtered.insert(handle.value());
+                }
+            }
+            m_searchMatches = std::move(filtered);
+        }
+    }
+
+    bool EntitiesPanel::passesFilter(const Entities::BaseEntity& entity) const {
+        return m_searchQuery.empty() || m_searchMatches.contains(entity.getHandle().value());
+    }
+
+    /**
+     * @brief Rebuild the visible rows of every tree if the project or the filter changed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The project generation covers entities added, removed or renamed;
+     * renderSearchBar() marks the rows stale when the matches change.
+     */
+    void EntitiesPanel::refreshRows() {
+        if (!m_project) {
+            m_sceneRows.clear();
+            m_characterRows.clear();
+            m_itemRows.clear();
+            m_rowsStale = true;
+            return;
+        }
+        if (!m_rowsStale && m_project->getGeneration() == m_rowsGeneration) {
+            return;
+        }
+
+        collectRows(m_project->getScenes(), m_sceneRows);
+        collectRows(m_project->getCharacters(), m_characterRows);
+        collectRows(m_project->getItems(), m_itemRows);
+        m_rowsGeneration = m_project->getGeneration();
+        m_rowsStale = false;
+
+        // Labels of removed entities are never looked up again
+        if (m_labels.size() > m_project->getScenes().size() + m_project->getCharacters().size() +
+                               m_project->getItems().size()) {
+            m_labels.clear();
+        }
+    }
+
+    template<typename Ptr>
+    void EntitiesPanel::collectRows(const std::vector<Ptr>& entities, std::vector<uint32_t>& rows) const {
+        rows.clear();
+        for (size_t position = 0; position < entities.size(); ++position) {
+            if (passesFilter(*entities[position])) {
+                rows.push_back(static_cast<uint32_t>(position));
+            }
+        }
+    }
+
+    /**
+     * @brief Render one selectable row per visible entity
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Rows are identified by the handle suffix of their cached label, since
+     * several entities may share a display name. A Shift+click whose anchor is not
+     * among the visible rows of this tree selects the clicked row alone.
+     *
+     * @param entities Collection of one tree, in display order
+     * @param rows Positions in entities passing the filter, from refreshRows()
+     */
+    template<typename Ptr>
+    void EntitiesPanel::renderEntityRows(const std::vector<Ptr>& entities, const std::vector<uint32_t>& rows) {
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+        while (clipper.Step()) {
+            for (int display = clipper.DisplayStart; display < clipper.DisplayEnd; ++display) {
+                const size_t visible = static_cast<size_t>(display);
+                const size_t row = rows[visible];
+                const auto& entity = *entities[row];
+                const RowLabel& label = labelOf(entity);
+
+                const bool selected = m_selectedValues.contains(entity.getHandle().value());
+                if (ImGui::Selectable(label.text.c_str(), selected)) {
+                    const ImGuiIO& io = ImGui::GetIO();
+                    const auto anchor = std::ranges::find_if(rows, [this, &entities](const uint32_t candidate) {
+                        return entities[candidate]->getHandle() == m_selectionAnchor;
+                    });
+
+                    if (io.KeyShift && anchor != rows.end()) {
+                        const size_t anchorVisible = static_cast<size_t>(anchor - rows.begin());
+                        std::vector<Core::EntityHandle> range;
+                        for (size_t i = std::min(visible, anchorVisible); i <= std::max(visible, anchorVisible); ++i) {
+                            range.push_back(entities[rows[i]]->getHandle());
+                        }
+                        select(range);
+                    } else if (io.KeyCtrl) {
+                        std::vector<Core::EntityHandle> toggled = m_selection;
+                        if (selected) {
+                            std::erase(toggled, entity.getHandle());
+                        } else {
+                            toggled.push_back(entity.getHandle());
+                        }
+                        select(toggled);
+                        m_selectionAnchor = entity.getHandle();
+                    } else {
+                        const Core::EntityHandle handle = entity.getHandle();
+                        select({&handle, 1});
+                        m_selectionAnchor = handle;
+                    }
+                    if (m_onSelectionChanged) m_onSelectionChanged(m_selection);
+                }
+                if (label.badge) {
+                    renderBadge(this->getTranslationsManager()->_t(*label.badge), label.badgeColor);
+                }
+            }
+        }
+    }
+
+    void EntitiesPanel::select(std::span<const Core::EntityHandle> handles) {
+        m_selection.assign(handles.begin(), handles.end());
+        m_selectedValues.clear();
+        for (const Core::EntityHandle handle : m_selection) {
+            m_selectedValues.insert(handle.value());
         }
     }
 
@@ -70,21 +427,15 @@ namespace ADS::IDE::Panels {
      *
      * Displays a collapsible tree node containing all character entities
      * from the active project. Each character is rendered as a selectable row;
-     * clicking one updates m_selectedEntity and fires m_onSelectionChanged.
+     * clicking one updates the selection and fires m_onSelectionChanged.
      *
      * @note Returns immediately if no project has been set via setProject()
      * @see setProject(), setSelectionCallback()
      */
     void EntitiesPanel::renderCharacterTree() {
         if (!m_project) return;
-        if (ImGui::TreeNode(this->getTranslationsManager()->_t("TREE_NODE_CHARACTERS").c_str())) {
-            for (const auto& character : m_project->getCharacters()) {
-                bool selected = (m_selectedEntity == character.get());
-                if (ImGui::Selectable(character->getDisplayName().c_str(), selected)) {
-                    m_selectedEntity = character.get();
-                    if (m_onSelectionChanged) m_onSelectionChanged(m_selectedEntity);
-                }
-            }
+        if (ImGui::TreeNode(this->getTranslationsManager()->_t(i18n::Key::TREE_NODE_CHARACTERS).data())) {
+            renderEntityRows(m_project->getCharacters(), m_characterRows);
             ImGui::TreePop();
         }
     }
@@ -97,21 +448,15 @@ namespace ADS::IDE::Panels {
      *
      * Displays a collapsible tree node containing all item entities
      * from the active project. Each item is rendered as a selectable row;
-     * clicking one updates m_selectedEntity and fires m_onSelectionChanged.
+     * clicking one updates the selection and fires m_onSelectionChanged.
      *
      * @note Returns immediately if no project has been set via setProject()
      * @see setProject(), setSelectionCallback()
      */
     void EntitiesPanel::renderItemTree() {
         if (!m_project) return;
-        if (ImGui::TreeNode(this->getTranslationsManager()->_t("TREE_NODE_ITEMS").c_str())) {
-            for (const auto& item : m_project->getItems()) {
-                bool selected = (m_selectedEntity == item.get());
-                if (ImGui::Selectable(item->getDisplayName().c_str(), selected)) {
-                    m_selectedEntity = item.get();
-                    if (m_onSelectionChanged) m_onSelectionChanged(m_selectedEntity);
-                }
-            }
+        if (ImGui::TreeNode(this->getTranslationsManager()->_t(i18n::Key::TREE_NODE_ITEMS).data())) {
+            renderEntityRows(m_project->getItems(), m_itemRows);
             ImGui::TreePop();
         }
     }
@@ -131,24 +476,36 @@ namespace ADS::IDE::Panels {
      * @see renderSceneTree(), renderCharacterTree(), renderItemTree()
      */
     void EntitiesPanel::setProject(Core::Project* project) {
+        if (m_project) {
+            for (const Inspector::SubscriptionHandle handle : m_labelSubscriptions) {
+                m_project->unsubscribe(handle);
+            }
+        }
+        m_labelSubscriptions.clear();
         m_project = project;
-        m_selectedEntity = nullptr;
+        watchLabels();
+        select({});
+        m_selectionAnchor = {};
+        m_searchQuery.clear();
+        m_rowsStale = true;
     }
 
     /**
-     * @brief Set the callback invoked when the user selects an entity
+     * @brief Set the callback invoked when the selection changes
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Feb 2026
+     * @version Oct 2026
      *
-     * The callback receives a non-owning pointer to the selected IInspectable.
+     * The callback receives the handles of the selected entities; the
+     * receiver resolves them through the project when it needs the
+     * entities themselves.
      * IDERenderer uses this to forward selection events to InspectorPanel
      * without creating a direct dependency between the two panels.
      * Passing an empty function clears any previously registered callback.
      *
-     * @param callback Function called with the newly selected IInspectable*
+     * @param callback Function called with the handles of the whole selection
      */
-    void EntitiesPanel::setSelectionCallback(std::function<void(Inspector::IInspectable*)> callback) {
+    void EntitiesPanel::setSelectionCallback(std::function<void(std::span<const Core::EntityHandle>)> callback) {
         m_onSelectionChanged = std::move(callback);
     }
 
@@ -173,29 +530,33 @@ namespace ADS::IDE::Panels {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Jan 2026
      *
-     * Displays the entity hierarchy tree with scenes, characters,
-     * and items, along with an add entity button. The panel provides
+     * Displays a search bar and the entity hierarchy tree with scenes,
+     * characters, and items, along with an add entity button. The panel provides
      * a structured view of all game entities organized by type.
      *
      * @note Returns early if panel is not visible
      * @see renderSceneTree(), renderCharacterTree(), renderItemTree()
      */
     void EntitiesPanel::render() {
+        ADS_ZONE("EntitiesPanel::render");
         if (!m_isVisible) {
             return;
         }
 
         ImGui::Begin(getImGuiLabel().c_str());
 
-        ImGui::Text("%s", this->getTranslationsManager()->_t("ENTITIES_LIST").c_str());
+        ImGui::Text("%s", this->getTranslationsManager()->_t(i18n::Key::ENTITIES_LIST).data());
         ImGui::Separator();
 
+        renderSearchBar();
+        refreshRows();
+
         renderSceneTree();
         renderCharacterTree();
         renderItemTree();
 
         ImGui::Separator();
-        if (ImGui::Button(this->getTranslationsManager()->_t("CLICK_TO_ADD_NEW_SCRIPT").c_str())) {
+        if (ImGui::Button(this->getTranslationsManager()->_t(i18n::Key::CLICK_TO_ADD_NEW_SCRIPT).data())) {
             handleAddEntity();
         }
 
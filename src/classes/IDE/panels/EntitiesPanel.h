@@ -16,7 +16,13 @@
 
 #include "BasePanel.h"
 #include <functional>
-#include "Inspector/IInspectable.h"
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "Core/Project.h"
 
 
@@ -29,13 +35,151 @@ namespace ADS::IDE::Panels {
      *
      * Renders a hierarchical tree view of game entities including scenes,
      * characters, and items. Provides functionality to add new entities.
+     *
+     * Clicking a row selects it alone, Ctrl+click toggles it in the
+     * selection and Shift+click selects the rows between it and the last
+     * clicked row of the same tree.
+     *
+     * Each tree keeps the positions of its entities passing the search
+     * filter, rebuilt only when the project or the filter changes, and
+     * submits only the rows in view, so large projects stay cheap to draw.
+     * Row labels (icon, name and badge, DESIGN.md §3.2–3.5) are built once
+     * per entity and rebuilt only when a property they show changes.
      */
     class EntitiesPanel : public BasePanel {
     private:
+        /**
+         * @brief Ready-to-draw label of one entity row
+         */
+        struct RowLabel {
+            std::string text;                               ///< Icon, name and a ##handle suffix for a unique ImGui ID
+            std::optional<i18n::Key> badge;                 ///< Pill drawn after the name, translated when drawn
+            uint32_t badgeColor = 0;                        ///< Text color of the pill, ImU32
+        };
 
-        Inspector::IInspectable* m_selectedEntity = nullptr;
+        std::vector<Core::EntityHandle> m_selection;        ///< Selected entities, in the order they were selected
+        std::unordered_set<uint64_t> m_selectedValues;      ///< Handle values of m_selection, for per-row lookups
+        Core::EntityHandle m_selectionAnchor;               ///< Last row clicked without Shift
         Core::Project* m_project = nullptr;
-        std::function<void(Inspector::IInspectable*)> m_onSelectionChanged;
+        std::function<void(std::span<const Core::EntityHandle>)> m_onSelectionChanged;
+        char m_searchBuffer[128] = {};                      ///< Search bar text
+        std::string m_searchQuery;                          ///< Query m_searchMatches was computed for
+        uint64_t m_searchGeneration = 0;                    ///< Project generation m_searchMatches was computed at
+        std::unordered_set<uint64_t> m_searchMatches;       ///< Handle values of the entities matching the query
+        std::vector<uint32_t> m_sceneRows;                  ///< Positions in getScenes() passing the filter
+        std::vector<uint32_t> m_characterRows;              ///< Positions in getCharacters() passing the filter
+        std::vector<uint32_t> m_itemRows;                   ///< Positions in getItems() passing the filter
+        uint64_t m_rowsGeneration = 0;                      ///< Project generation the rows were built at
+        bool m_rowsStale = true;                            ///< Project or filter changed since the rows were built
+        std::unordered_map<uint64_t, RowLabel> m_labels;    ///< Labels of the rows drawn so far, by handle value
+        std::vector<Inspector::SubscriptionHandle> m_labelSubscriptions; ///< Project listeners dropping stale labels
+
+        /**
+         * @brief Render the search bar filtering the entity trees
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Re-runs the project search only when the query or the project
+         * changed since the last frame.
+         */
+        void renderSearchBar();
+
+        /**
+         * @brief Compute the entities matching a search bar query
+         *
+         * @param query Text typed, mixing property filters and words to search for
+         */
+        void collectMatches(std::string_view query);
+
+        /**
+         * @brief Check whether an entity passes the current search filter
+         *
+         * @param entity Entity about to be listed
+         * @return bool True if the search bar is empty or the entity matches
+         */
+        [[nodiscard]] bool passesFilter(const Entities::BaseEntity& entity) const;
+
+        /**
+         * @brief Rebuild the visible rows of every tree if the project or the filter changed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Filtering walks every entity, so it runs once per change instead
+         * of once per frame.
+         */
+        void refreshRows();
+
+        /**
+         * @brief Get the cached label of an entity, building it on first use
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param entity Entity about to be drawn
+         * @return const RowLabel& Label valid until the entity's name or badge changes
+         */
+        template<typename Entity>
+        const RowLabel& labelOf(const Entity& entity);
+
+        /**
+         * @brief Build the label of a scene: map marker, and a start badge for the start scene
+         */
+        static RowLabel buildLabel(const Entities::Scene& scene);
+
+        /**
+         * @brief Build the label of a character: user icon, and a badge for the player
+         */
+        static RowLabel buildLabel(const Entities::Character& character);
+
+        /**
+         * @brief Build the label of an item: icon of its type, and a badge for quest items
+         */
+        static RowLabel buildLabel(const Entities::Item& item);
+
+        /**
+         * @brief Listen to the properties shown in the labels of the current project
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Drops the listeners of the previous project and every cached label.
+         */
+        void watchLabels();
+
+        /**
+         * @brief Collect the positions of the entities passing the filter
+         *
+         * @param entities Collection of one tree, in display order
+         * @param rows Receives the positions, in display order
+         */
+        template<typename Ptr>
+        void collectRows(const std::vector<Ptr>& entities, std::vector<uint32_t>& rows) const;
+
+        /**
+         * @brief Render one selectable row per visible entity
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Only the rows in view are submitted to ImGui, so the cost does not
+         * grow with the size of the project. Applies the click to the
+         * selection according to the held modifiers and fires
+         * m_onSelectionChanged.
+         *
+         * @param entities Collection of one tree, in display order
+         * @param rows Positions in entities passing the filter, from refreshRows()
+         */
+        template<typename Ptr>
+        void renderEntityRows(const std::vector<Ptr>& entities, const std::vector<uint32_t>& rows);
+
+        /**
+         * @brief Replace the selection
+         *
+         * @param handles Entities to select
+         */
+        void select(std::span<const Core::EntityHandle> handles);
 
         /**
          * @brief Render the scenes tree node
@@ -105,11 +249,11 @@ namespace ADS::IDE::Panels {
          * @brief Destroy the EntitiesPanel object
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * Default destructor. No special cleanup required for this class.
+         * Stops listening to the project's label properties.
          */
-        ~EntitiesPanel() override = default;
+        ~EntitiesPanel() override;
 
         /**
          * @brief Render the entities panel
@@ -141,18 +285,19 @@ namespace ADS::IDE::Panels {
         void setProject(Core::Project* project);
 
         /**
-         * @brief Set the callback invoked when the user selects an entity
+         * @brief Set the callback invoked when the selection changes
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Feb 2026
+         * @version Oct 2026
          *
-         * The callback receives a non-owning pointer to the selected entity.
+         * The callback receives the handles of the selected entities rather
+         * than pointers, so the receiver can detect when one is removed.
          * IDERenderer uses this to forward selection events to InspectorPanel
          * without creating a direct dependency between the two panels.
          *
-         * @param callback Function called with the newly selected IInspectable*
+         * @param callback Function called with the handles of the whole selection
          */
-        void setSelectionCallback(std::function<void(Inspector::IInspectable*)> callback);
+        void setSelectionCallback(std::function<void(std::span<const Core::EntityHandle>)> callback);
     };
 }
 
@@ -19,98 +19,295 @@
  */
 
 #include "InspectorPanel.h"
+#include "System.h"
+#include "Core/AllocationCounter.h"
+#include "Core/Profiling.h"
 #include "imgui.h"
+#include "imgui_internal.h"
+#include <algorithm>
 
 namespace ADS::IDE::Panels {
 
     InspectorPanel::InspectorPanel()
-        : BasePanel("hInspector"),
-          m_selectedObject(nullptr),
+        : BasePanel(Constants::System::INSPECTOR_WINDOW_ID),
+          m_schema(nullptr),
           m_needsRefresh(false) {
-        m_windowTitle = this->getTranslationsManager()->_t("INSPECTOR");
+        setTitle(i18n::Key::INSPECTOR);
     }
 
-    void InspectorPanel::renderObjectHeader() {
-        if (!m_selectedObject) return;
+    InspectorPanel::~InspectorPanel() {
+        observe(nullptr);
+    }
 
-        // Type badge
-        ImGui::TextColored(
-            ImVec4(0.4f, 0.7f, 1.0f, 1.0f),
-            "[%s]",
-            m_selectedObject->getTypeName().c_str()
-        );
-        ImGui::SameLine();
+    void InspectorPanel::renderObjectHeader() {
+        if (m_selectedObjects.empty()) return;
+
+        // Type badge, unless the selection mixes types
+        if (!m_commonSchema) {
+            ImGui::TextColored(
+                ImVec4(0.4f, 0.7f, 1.0f, 1.0f),
+                "[%s]",
+                m_selectedObjects.front()->getTypeName().c_str()
+            );
+            ImGui::SameLine();
+        }
 
-        // Object name
-        ImGui::Text("%s", m_selectedObject->getDisplayName().c_str());
+        // Object name, or the selection size
+        if (m_selectedObjects.size() > 1) {
+            m_textBuffer.clear();
+            ImGui::TextUnformatted(this->getTranslationsManager()->formatTo(m_textBuffer, i18n::Key::INSPECTOR_MULTIPLE_SELECTED,
+                i18n::arg("count", m_selectedObjects.size())
+            ).data());
+        } else {
+            ImGui::Text("%s", m_selectedObjects.front()->getDisplayName().c_str());
+        }
     }
 
-    void InspectorPanel::renderCategory(
-        const std::string& category,
-        const std::vector<Inspector::PropertyDescriptor>& properties
-    ) {
+    void InspectorPanel::renderCategory(const Inspector::PropertySchema::Category& category) {
         // Use collapsing header for category grouping
         ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_DefaultOpen;
-        if (ImGui::CollapsingHeader(category.c_str(), flags)) {
+        if (ImGui::CollapsingHeader(category.name.c_str(), flags)) {
             ImGui::Indent(10.0f);
 
-            for (const auto& descriptor : properties) {
-                // Check visibility condition
-                if (!descriptor.isVisible(m_selectedObject)) {
+            // Rows below the clip rectangle, or above it, are skipped as one block of space
+            const ImRect& clip = ImGui::GetCurrentWindow()->ClipRect;
+            const float spacing = ImGui::GetStyle().ItemSpacing.y;
+            float skipped = 0.0f;
+
+            // The category's descriptors are a contiguous run of the schema's
+            const size_t first = static_cast<size_t>(category.properties.data() - m_schema->getDescriptors().data());
+            for (size_t i = 0; i < category.properties.size(); ++i) {
+                const Inspector::PropertyDescriptor& descriptor = category.properties[i];
+                // Check visibility condition against the first selected object
+                if (!isRowVisible(first + i, descriptor)) {
                     continue;
                 }
 
-                renderProperty(descriptor);
+                Inspector::Editors::IPropertyEditor* editor = m_editors[first + i];
+                const auto height = m_rowHeights.find(editor);
+                if (height != m_rowHeights.end()) {
+                    const float top = ImGui::GetCursorScreenPos().y + skipped;
+                    if (top + height->second < clip.Min.y || top > clip.Max.y) {
+                        skipped += height->second;
+                        continue;
+                    }
+                }
+
+                if (skipped > 0.0f) {
+                    ImGui::Dummy(ImVec2(0.0f, skipped - spacing));
+                    skipped = 0.0f;
+                }
+                const float before = ImGui::GetCursorPosY();
+                renderProperty(descriptor, editor);
+                m_rowHeights[editor] = ImGui::GetCursorPosY() - before;
+            }
+            if (skipped > 0.0f) {
+                ImGui::Dummy(ImVec2(0.0f, skipped - spacing));
             }
 
             ImGui::Unindent(10.0f);
         }
     }
 
-    void InspectorPanel::renderProperty(const Inspector::PropertyDescriptor& descriptor) {
-        // Get current value
-        Inspector::PropertyValue currentValue =
-            m_selectedObject->getPropertyValue(descriptor.getId());
-
-        // Get appropriate editor
-        Inspector::Editors::IPropertyEditor* editor =
-            m_editorRegistry.getEditorForProperty(descriptor);
-
+    /**
+     * @brief Render a single property using the appropriate editor
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A mixed property shows the first selected object's value, dimmed
+     * and flagged as mixed, until an edit makes all values equal.
+     *
+     * @param descriptor Property metadata
+     * @param editor     Editor for the property, or nullptr if there is none
+     */
+    void InspectorPanel::renderProperty(const Inspector::PropertyDescriptor& descriptor,
+                                        Inspector::Editors::IPropertyEditor* editor) {
         if (!editor) {
             // No editor available, show read-only text
             ImGui::TextDisabled("%s: (no editor)", descriptor.getDisplayName().c_str());
             return;
         }
 
+        // Get current value
+        const Inspector::PropertyValue& currentValue = getCachedValue(descriptor);
+        const bool mixed = m_mixedProperties.contains(descriptor.getId());
+
         // Render editor and handle value changes
+        if (mixed) {
+            ImGui::PushItemFlag(ImGuiItemFlags_MixedValue, true);
+            ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+        }
         Inspector::Editors::EditResult result = editor->render(
             descriptor,
             currentValue,
             descriptor.isReadOnly()
         );
+        if (mixed) {
+            ImGui::PopStyleColor();
+            ImGui::PopItemFlag();
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("%s", this->getTranslationsManager()->_t(i18n::Key::INSPECTOR_MIXED_VALUES).data());
+            }
+        }
 
         // Apply change if value was modified
         if (result.changed) {
-            m_selectedObject->setPropertyValue(descriptor.getId(), result.newValue);
+            if (m_selectedObjects.size() > 1 && m_onBatchEdit) {
+                m_onBatchEdit(descriptor.getId(), result.newValue);
+            } else {
+                for (Inspector::IInspectable* object : m_selectedObjects) {
+                    object->setPropertyValue(descriptor.getId(), result.newValue);
+                }
+            }
+            m_mixedProperties.erase(descriptor.getId());
+        }
+    }
+
+    /**
+     * @brief Refresh the category cache from the selected objects
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A selection of one type uses that type's static schema. A selection
+     * mixing types gets a schema of the descriptors present, with the same
+     * type, in every one of them. Values are compared once here rather
+     * than every frame; edits made through the panel clear the mixed flag
+     * themselves and other changes go through refresh().
+     */
+    /**
+     * @brief Get a property of the first selected object through the value cache
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A hit is a lookup by the descriptor's own id string, so steady-state
+     * frames neither build variants nor allocate.
+     *
+     * @param descriptor Property to read
+     * @return const Inspector::PropertyValue& Cached value, valid until the next change event
+     */
+    const Inspector::PropertyValue& InspectorPanel::getCachedValue(const Inspector::PropertyDescriptor& descriptor) {
+        auto it = m_valueCache.find(descriptor.getId());
+        if (it == m_valueCache.end()) {
+            Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Inspector);
+            it = m_valueCache.emplace(descriptor.getId(), m_selectedObjects.front()->getPropertyValue(descriptor.getId())).first;
+        }
+        return it->second;
+    }
+
+    bool InspectorPanel::isRowVisible(size_t index, const Inspector::PropertyDescriptor& descriptor) {
+        switch (m_visibility[index]) {
+            case Visibility::Shown:
+                return true;
+            case Visibility::Hidden:
+                return false;
+            case Visibility::Stale: {
+                const bool visible = descriptor.isVisible(m_selectedObjects.front());
+                m_visibility[index] = visible ? Visibility::Shown : Visibility::Hidden;
+                return visible;
+            }
+            case Visibility::Uncached:
+                break;
+        }
+        return descriptor.isVisible(m_selectedObjects.front());
+    }
+
+    void InspectorPanel::invalidate(const std::string_view propertyId) {
+        if (const auto cached = m_valueCache.find(propertyId); cached != m_valueCache.end()) {
+            m_valueCache.erase(cached);
+        }
+        if (const auto dependents = m_visibilityDependents.find(propertyId); dependents != m_visibilityDependents.end()) {
+            for (const size_t index : dependents->second) {
+                m_visibility[index] = Visibility::Stale;
+            }
+        }
+    }
+
+    void InspectorPanel::observe(Inspector::IInspectable* object) {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Inspector);
+        if (m_observedObject != nullptr && !m_observedLifetime.expired()) {
+            m_observedObject->getEventDispatcher().unsubscribe(m_observerSubscription);
+        }
+        m_valueCache.clear();
+        m_observedObject = object;
+        m_observedLifetime.reset();
+        if (object != nullptr) {
+            m_observedLifetime = object->getEventDispatcher().getLifetime();
+            const Inspector::PropertySchema* schema = &object->getPropertySchema();
+            m_observerSubscription = object->getEventDispatcher().subscribe([this, schema](const Inspector::PropertyChangedEvent& event) {
+                invalidate(event.propertyId);
+                // Computed properties raise no events; their inputs' events stand for them
+                for (const size_t index : schema->getDependents(event.propertyId)) {
+                    invalidate(schema->getDescriptors()[index].getId());
+                }
+            });
         }
     }
 
     void InspectorPanel::refreshCategoryCache() {
-        m_categorizedProperties.clear();
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Inspector);
+        m_commonSchema.reset();
+        m_mixedProperties.clear();
+        m_editors.clear();
+        m_visibility.clear();
+        m_visibilityDependents.clear();
+        if (m_selectedObjects.empty()) {
+            m_schema = nullptr;
+            return;
+        }
 
-        if (!m_selectedObject) return;
+        m_schema = &m_selectedObjects.front()->getPropertySchema();
+        std::vector<const Inspector::PropertySchema*> otherSchemas;
+        for (const Inspector::IInspectable* object : m_selectedObjects) {
+            const Inspector::PropertySchema* schema = &object->getPropertySchema();
+            if (schema != m_schema && std::ranges::find(otherSchemas, schema) == otherSchemas.end()) {
+                otherSchemas.push_back(schema);
+            }
+        }
 
-        // Get all property descriptors
-        std::vector<Inspector::PropertyDescriptor> descriptors =
-            m_selectedObject->getPropertyDescriptors();
+        if (!otherSchemas.empty()) {
+            std::vector<Inspector::PropertyDescriptor> common;
+            for (const Inspector::PropertyDescriptor& descriptor : m_schema->getDescriptors()) {
+                const bool shared = std::ranges::all_of(otherSchemas, [&descriptor](const Inspector::PropertySchema* schema) {
+                    return std::ranges::any_of(schema->getDescriptors(), [&descriptor](const Inspector::PropertyDescriptor& other) {
+                        return other.getId() == descriptor.getId() && other.getType() == descriptor.getType();
+                    });
+                });
+                if (shared) {
+                    common.push_back(descriptor);
+                }
+            }
+            m_commonSchema = std::make_unique<Inspector::PropertySchema>(std::move(common));
+            m_schema = m_commonSchema.get();
+        }
+        m_editors = m_editorRegistry.resolveEditors(*m_schema);
 
-        // Group by category
-        for (const auto& descriptor : descriptors) {
-            std::string category = descriptor.getCategory();
-            if (category.empty()) {
-                category = "General";  // Default category
+        const std::span<const Inspector::PropertyDescriptor> descriptors = m_schema->getDescriptors();
+        m_visibility.assign(descriptors.size(), Visibility::Shown);
+        for (size_t i = 0; i < descriptors.size(); ++i) {
+            if (!descriptors[i].hasVisibilityCondition()) {
+                continue;
+            }
+            if (descriptors[i].getVisibilityDependencies().empty()) {
+                m_visibility[i] = Visibility::Uncached;
+                continue;
+            }
+            m_visibility[i] = Visibility::Stale;
+            for (const std::string& dependency : descriptors[i].getVisibilityDependencies()) {
+                m_visibilityDependents[dependency].push_back(i);
+            }
+        }
+
+        for (const Inspector::PropertyDescriptor& descriptor : m_schema->getDescriptors()) {
+            const Inspector::PropertyValue first = m_selectedObjects.front()->getPropertyValue(descriptor.getId());
+            for (size_t i = 1; i < m_selectedObjects.size(); ++i) {
+                if (!Inspector::isSameValue(first, m_selectedObjects[i]->getPropertyValue(descriptor.getId()))) {
+                    m_mixedProperties.insert(descriptor.getId());
+                    break;
+                }
             }
-            m_categorizedProperties[category].push_back(descriptor);
         }
     }
 
@@ -122,13 +319,14 @@ namespace ADS::IDE::Panels {
     }
 
     void InspectorPanel::render() {
+        ADS_ZONE("InspectorPanel::render");
         if (!m_isVisible) {
             return;
         }
 
         ImGui::Begin(getImGuiLabel().c_str());
 
-        if (!m_selectedObject) {
+        if (m_selectedObjects.empty()) {
             renderNoSelection();
             ImGui::End();
             return;
@@ -146,8 +344,8 @@ namespace ADS::IDE::Panels {
         ImGui::Spacing();
 
         // Render properties by category
-        for (const auto& [category, properties] : m_categorizedProperties) {
-            renderCategory(category, properties);
+        for (const auto& category : m_schema->getCategories()) {
+            renderCategory(category);
             ImGui::Spacing();
         }
 
@@ -155,15 +353,32 @@ namespace ADS::IDE::Panels {
     }
 
     void InspectorPanel::setSelectedObject(Inspector::IInspectable* object) {
-        if (m_selectedObject != object) {
-            m_selectedObject = object;
+        if (object != nullptr) {
+            setSelectedObjects({&object, 1});
+        } else {
+            setSelectedObjects({});
+        }
+    }
+
+    void InspectorPanel::setSelectedObjects(std::span<Inspector::IInspectable* const> objects) {
+        if (!std::ranges::equal(m_selectedObjects, objects)) {
+            m_selectedObjects.assign(objects.begin(), objects.end());
+            observe(m_selectedObjects.empty() ? nullptr : m_selectedObjects.front());
             m_needsRefresh = true;
             refreshCategoryCache();  // Refresh immediately
         }
     }
 
     Inspector::IInspectable* InspectorPanel::getSelectedObject() const {
-        return m_selectedObject;
+        return m_selectedObjects.empty() ? nullptr : m_selectedObjects.front();
+    }
+
+    std::span<Inspector::IInspectable* const> InspectorPanel::getSelectedObjects() const {
+        return m_selectedObjects;
+    }
+
+    void InspectorPanel::setBatchEditCallback(std::function<void(const std::string&, const Inspector::PropertyValue&)> callback) {
+        m_onBatchEdit = std::move(callback);
     }
 
     void InspectorPanel::clearSelection() {
@@ -171,6 +386,7 @@ namespace ADS::IDE::Panels {
     }
 
     void InspectorPanel::refresh() {
+        m_valueCache.clear();
         m_needsRefresh = true;
     }
 }
@@ -14,11 +14,17 @@
 #ifndef ADS_INSPECTOR_PANEL_H
 #define ADS_INSPECTOR_PANEL_H
 
-#include <map>
-#include <vector>
 #include "BasePanel.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "Inspector/IInspectable.h"
-#include "Inspector/PropertyDescriptor.h"
+#include "Inspector/PropertySchema.h"
 #include "Inspector/PropertyEditorRegistry.h"
 
 namespace ADS::IDE::Panels {
@@ -31,21 +37,110 @@ namespace ADS::IDE::Panels {
      * Shows detailed information about the currently selected entity
      * including its type, and all editable properties organized by
      * category. Uses a Visual Basic-like property grid interface.
+     *
+     * With several entities selected the grid shows the properties they
+     * all have, drawing those whose values differ as mixed. An edit is
+     * applied to every selected entity through the batch edit callback,
+     * so the owner can record it as a single change.
      */
     class InspectorPanel : public BasePanel {
     private:
-        /// Currently selected inspectable object
-        Inspector::IInspectable* m_selectedObject;
+        /// Currently selected inspectable objects; the first one is shown in the header
+        std::vector<Inspector::IInspectable*> m_selectedObjects;
+
+        /// Reused to format translated text
+        std::string m_textBuffer;
 
         /// Registry of property editors
         Inspector::PropertyEditorRegistry m_editorRegistry;
 
-        /// Cached property descriptors grouped by category
-        std::map<std::string, std::vector<Inspector::PropertyDescriptor>> m_categorizedProperties;
+        /// Schema shown: the selection's own type schema, or m_commonSchema
+        const Inspector::PropertySchema* m_schema;
+
+        /// Editor of each descriptor of m_schema, in getDescriptors() order
+        std::vector<Inspector::Editors::IPropertyEditor*> m_editors;
+
+        /**
+         * @brief Cached result of a descriptor's visibility condition
+         */
+        enum class Visibility : uint8_t {
+            Shown,      ///< No condition, or the condition held when last evaluated
+            Hidden,     ///< The condition failed when last evaluated
+            Stale,      ///< A property the condition reads has changed
+            Uncached    ///< The condition declares no dependencies; evaluated every frame
+        };
+
+        /// Visibility of each descriptor of m_schema for the first selected object
+        std::vector<Visibility> m_visibility;
+
+        /// Indexes of the descriptors whose visibility condition reads each property
+        std::unordered_map<std::string, std::vector<size_t>, Inspector::PropertyIdHash, std::equal_to<>> m_visibilityDependents;
+
+        /// Descriptors every selected object has, when their types differ
+        std::unique_ptr<Inspector::PropertySchema> m_commonSchema;
+
+        /// Ids of the properties whose value differs between the selected objects
+        std::unordered_set<std::string> m_mixedProperties;
+
+        /// Applies an edit to the whole multi-selection
+        std::function<void(const std::string&, const Inspector::PropertyValue&)> m_onBatchEdit;
+
+        /// Values of the first selected object, by property id; entries are dropped when it reports a change
+        std::unordered_map<std::string, Inspector::PropertyValue, Inspector::PropertyIdHash, std::equal_to<>> m_valueCache;
+
+        /// Object whose events invalidate m_valueCache
+        Inspector::IInspectable* m_observedObject = nullptr;
+
+        /// Subscription to m_observedObject's dispatcher
+        Inspector::SubscriptionHandle m_observerSubscription = 0;
+
+        /// Expires when m_observedObject's dispatcher is destroyed
+        std::weak_ptr<const bool> m_observedLifetime;
+
+        /**
+         * @brief Get a property of the first selected object through the value cache
+         *
+         * @param descriptor Property to read
+         * @return const Inspector::PropertyValue& Cached value, valid until the next change event
+         */
+        const Inspector::PropertyValue& getCachedValue(const Inspector::PropertyDescriptor& descriptor);
+
+        /**
+         * @brief Check whether a row is shown, through the visibility cache
+         *
+         * @param index      Index of the descriptor in m_schema
+         * @param descriptor The descriptor
+         * @return true if the property should be displayed
+         */
+        bool isRowVisible(size_t index, const Inspector::PropertyDescriptor& descriptor);
+
+        /**
+         * @brief Drop the cached value of a property and the visibility of the rows reading it
+         *
+         * @param propertyId Id of a changed property
+         */
+        void invalidate(std::string_view propertyId);
+
+        /**
+         * @brief Move the value cache subscription to another object
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Empties the cache. Each change event invalidates the property
+         * and the computed properties derived from it. The previous object is
+         * only unsubscribed from if it still exists.
+         *
+         * @param object Object to observe, or nullptr
+         */
+        void observe(Inspector::IInspectable* object);
 
         /// Flag indicating if category cache needs refresh
         bool m_needsRefresh;
 
+        /// Height of the last row drawn by each editor, item spacing included
+        std::unordered_map<const Inspector::Editors::IPropertyEditor*, float> m_rowHeights;
+
         /**
          * @brief Render the object header (type and name)
          *
@@ -58,15 +153,15 @@ namespace ADS::IDE::Panels {
          * @brief Render properties for a category
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * @param category Category name
-         * @param properties Properties in this category
+         * Only rows inside the window's clip rectangle run their editor;
+         * the others are replaced by empty space of their editor's last
+         * measured height, so scrolling stays stable.
+         *
+         * @param category Category name and its properties
          */
-        void renderCategory(
-            const std::string& category,
-            const std::vector<Inspector::PropertyDescriptor>& properties
-        );
+        void renderCategory(const Inspector::PropertySchema::Category& category);
 
         /**
          * @brief Render a single property using the appropriate editor
@@ -75,14 +170,19 @@ namespace ADS::IDE::Panels {
          * @version Jan 2026
          *
          * @param descriptor Property metadata
+         * @param editor     Editor for the property, or nullptr if there is none
          */
-        void renderProperty(const Inspector::PropertyDescriptor& descriptor);
+        void renderProperty(const Inspector::PropertyDescriptor& descriptor, Inspector::Editors::IPropertyEditor* editor);
 
         /**
-         * @brief Refresh the category cache from the selected object
+         * @brief Refresh the category cache from the selected objects
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
+         *
+         * Points at the type's static schema when every selected object
+         * shares it, resolves its editors and rebuilds the mixed-value set
+         * and the visibility cache.
          */
         void refreshCategoryCache();
 
@@ -109,11 +209,11 @@ namespace ADS::IDE::Panels {
          * @brief Destroy the InspectorPanel object
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * Default destructor. No special cleanup required for this class.
+         * Unsubscribes from the observed object, if it still exists.
          */
-        ~InspectorPanel() override = default;
+        ~InspectorPanel() override;
 
         /**
          * @brief Render the inspector panel
@@ -139,13 +239,43 @@ namespace ADS::IDE::Panels {
          */
         void setSelectedObject(Inspector::IInspectable* object);
 
+        /**
+         * @brief Set the currently selected objects
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param objects The inspectable objects to display (may be empty)
+         */
+        void setSelectedObjects(std::span<Inspector::IInspectable* const> objects);
+
         /**
          * @brief Get the currently selected object
          *
-         * @return Inspector::IInspectable* Pointer to selected object, or nullptr
+         * @return Inspector::IInspectable* Pointer to the first selected object, or nullptr
          */
         Inspector::IInspectable* getSelectedObject() const;
 
+        /**
+         * @brief Get all currently selected objects
+         *
+         * @return std::span<Inspector::IInspectable* const> Selected objects, in selection order
+         */
+        [[nodiscard]] std::span<Inspector::IInspectable* const> getSelectedObjects() const;
+
+        /**
+         * @brief Set the callback that applies an edit to a multi-selection
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Without a callback, or with a single object selected, edits are
+         * written through each object's setPropertyValue().
+         *
+         * @param callback Function called with the property id and the new value
+         */
+        void setBatchEditCallback(std::function<void(const std::string&, const Inspector::PropertyValue&)> callback);
+
         /**
          * @brief Clear the current selection
          *
@@ -161,7 +291,9 @@ namespace ADS::IDE::Panels {
          * @version Jan 2026
          *
          * Call this after the selected object's properties have changed
-         * externally (e.g., via undo/redo).
+         * externally (e.g., via undo/redo). Values changed through
+         * setPropertyValue() are picked up without it, through the object's
+         * events.
          */
         void refresh();
     };
@@ -21,6 +21,9 @@
 #include "StatusBarPanel.h"
 
 #include "System.h"
+#include "Core/AllocationCounter.h"
+#include "Core/Profiling.h"
+#include "../MemoryMonitor.h"
 #include "imgui.h"
 
 namespace ADS::IDE::Panels {
@@ -35,7 +38,7 @@ namespace ADS::IDE::Panels {
      * dynamically during rendering.
      */
     StatusBarPanel::StatusBarPanel()
-        : BasePanel("Status Bar"), m_height(0.0f) {
+        : BasePanel("Status Bar"), m_height(0.0f), m_messageExpiry(0.0) {
     }
 
     /**
@@ -63,12 +66,14 @@ namespace ADS::IDE::Panels {
      * Displays the status bar at the bottom of the viewport with
      * status information, cursor position, and FPS counter. The bar
      * is positioned as a fixed window at the bottom with no title bar,
-     * borders, or docking capabilities.
+     * borders, or docking capabilities. Built with ADS_COUNT_ALLOCATIONS
+     * it also shows the live heap bytes, split by subsystem on hover.
      *
      * @note Returns early if panel is not visible
      * @see calculateHeight()
      */
     void StatusBarPanel::render() {
+        ADS_ZONE("StatusBarPanel::render");
         if (!m_isVisible) {
             return;
         }
@@ -94,16 +99,49 @@ namespace ADS::IDE::Panels {
         ImGui::Begin(getImGuiLabel().c_str(), nullptr, statusBarFlags);
         ImGui::PopStyleVar(2);
 
-        ImGui::Text(this->getTranslationsManager()->_t("STATUS_BAR_DEFAULT").c_str(), ImGui::GetIO().Framerate);
+        ImGui::Text(this->getTranslationsManager()->_t(i18n::Key::STATUS_BAR_DEFAULT).data(), ImGui::GetIO().Framerate);
+
+        if (Core::AllocationCounter::isEnabled()) {
+            ImGui::SameLine();
+            ImGui::TextUnformatted("|");
+            ImGui::SameLine();
+            ImGui::Text(this->getTranslationsManager()->_t(i18n::Key::STATUS_MEMORY).data(),
+                        MemoryMonitor::formatBytes(Core::AllocationCounter::getLiveBytes()).c_str());
+            if (ImGui::IsItemHovered()) {
+                MemoryMonitor::renderTooltip();
+            }
+        }
 
-        const std::string message = this->getTranslationsManager()->_t("APP_TITLE");
+        if (m_saveProgress.has_value()) {
+            ImGui::SameLine();
+            ImGui::Text("| %s", this->getTranslationsManager()->_t(i18n::Key::STATUS_SAVING).data());
+            ImGui::SameLine();
+            ImGui::ProgressBar(*m_saveProgress, ImVec2(Constants::System::STATUS_PROGRESS_WIDTH, 0.0f));
+        }
+        if (m_importProgress.has_value()) {
+            ImGui::SameLine();
+            ImGui::Text("| %s", this->getTranslationsManager()->_t(i18n::Key::STATUS_IMPORTING).data());
+            ImGui::SameLine();
+            ImGui::ProgressBar(*m_importProgress, ImVec2(Constants::System::STATUS_PROGRESS_WIDTH, 0.0f));
+            ImGui::SameLine();
+            if (ImGui::SmallButton(this->getTranslationsManager()->_t(i18n::Key::STATUS_IMPORT_CANCEL).data()) && m_onImportCancel) {
+                m_onImportCancel();
+            }
+        }
+        if (!m_saveProgress.has_value() && !m_importProgress.has_value()
+            && !m_message.empty() && ImGui::GetTime() < m_messageExpiry) {
+            ImGui::SameLine();
+            ImGui::Text("| %s", m_message.c_str());
+        }
+
+        const std::string_view message = this->getTranslationsManager()->_t(i18n::Key::APP_TITLE);
         // This is the way to calculate the string width (in pixesls).
-        ImVec2 textSize = ImGui::CalcTextSize(message.c_str());
+        ImVec2 textSize = ImGui::CalcTextSize(message.data(), message.data() + message.size());
         float textWidth = textSize.x;
         // float textHeight = textSize.y;
 
         ImGui::SameLine(ImGui::GetWindowWidth() - (textWidth + Constants::System::DEFULT_TEXT_SPACER));
-        ImGui::Text("%s", message.c_str());
+        ImGui::TextUnformatted(message.data(), message.data() + message.size());
         ImGui::End();
     }
 
@@ -123,4 +161,45 @@ namespace ADS::IDE::Panels {
     float StatusBarPanel::getHeight() const {
         return m_height;
     }
+
+    /**
+     * @brief Show or hide the save progress bar
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param progress Completed fraction in [0, 1], or std::nullopt to hide
+     */
+    void StatusBarPanel::setSaveProgress(std::optional<float> progress) {
+        m_saveProgress = progress;
+    }
+
+    /**
+     * @brief Show or hide the import progress bar and its Cancel button
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param progress Parsed fraction of the source in [0, 1], or std::nullopt to hide
+     */
+    void StatusBarPanel::setImportProgress(std::optional<float> progress) {
+        m_importProgress = progress;
+    }
+
+    void StatusBarPanel::setImportCancelCallback(std::function<void()> onCancel) {
+        m_onImportCancel = std::move(onCancel);
+    }
+
+    /**
+     * @brief Show a message for Constants::System::STATUS_MESSAGE_SECONDS
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param message Already translated text
+     */
+    void StatusBarPanel::showMessage(const std::string& message) {
+        m_message = message;
+        m_messageExpiry = ImGui::GetTime() + Constants::System::STATUS_MESSAGE_SECONDS;
+    }
 }
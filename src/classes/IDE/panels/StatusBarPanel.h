@@ -14,6 +14,10 @@
 #ifndef ADS_STATUS_BAR_PANEL_H
 #define ADS_STATUS_BAR_PANEL_H
 
+#include <functional>
+#include <optional>
+#include <string>
+
 #include "BasePanel.h"
 
 namespace ADS::IDE::Panels {
@@ -34,6 +38,31 @@ namespace ADS::IDE::Panels {
          */
         float m_height;
 
+        /**
+         * Fraction of the running save, empty when no save is in progress
+         */
+        std::optional<float> m_saveProgress;
+
+        /**
+         * Fraction of the running import, empty when no import is in progress
+         */
+        std::optional<float> m_importProgress;
+
+        /**
+         * Invoked by the Cancel button next to the import progress bar
+         */
+        std::function<void()> m_onImportCancel;
+
+        /**
+         * Transient message shown next to the default status text
+         */
+        std::string m_message;
+
+        /**
+         * ImGui time at which m_message stops being shown
+         */
+        double m_messageExpiry;
+
         /**
          * @brief Calculate the height of the status bar
          *
@@ -80,7 +109,8 @@ namespace ADS::IDE::Panels {
          * Displays the status bar at the bottom of the viewport with
          * status information, cursor position, and FPS counter. The bar
          * is positioned as a fixed window at the bottom with no title bar,
-         * borders, or docking capabilities.
+         * borders, or docking capabilities. Built with ADS_COUNT_ALLOCATIONS
+         * it also shows the live heap bytes, split by subsystem on hover.
          *
          * @note Returns early if panel is not visible
          * @see calculateHeight()
@@ -101,6 +131,49 @@ namespace ADS::IDE::Panels {
          * @note The height is calculated during each render() call
          */
         float getHeight() const;
+
+        /**
+         * @brief Show or hide the save progress bar
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param progress Completed fraction in [0, 1], or std::nullopt to hide
+         */
+        void setSaveProgress(std::optional<float> progress);
+
+        /**
+         * @brief Show or hide the import progress bar and its Cancel button
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param progress Parsed fraction of the source in [0, 1], or std::nullopt to hide
+         */
+        void setImportProgress(std::optional<float> progress);
+
+        /**
+         * @brief Register the action of the import Cancel button
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param onCancel Callable invoked when Cancel is clicked
+         */
+        void setImportCancelCallback(std::function<void()> onCancel);
+
+        /**
+         * @brief Show a message for Constants::System::STATUS_MESSAGE_SECONDS
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Replaces any message still on screen. The save and import progress
+         * bars take precedence while they are visible.
+         *
+         * @param message Already translated text
+         */
+        void showMessage(const std::string& message);
     };
 }
 
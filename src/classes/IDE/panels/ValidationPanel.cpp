@@ -0,0 +1,167 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ValidationPanel.cpp
+ * @brief Implementation of the ValidationPanel class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ValidationPanel.h"
+#include "System.h"
+#include "Core/Profiling.h"
+#include "imgui.h"
+#include "IconsFontAwesome4.h"
+#include <format>
+#include <string>
+
+namespace ADS::IDE::Panels {
+    /**
+     * @brief Construct a new ValidationPanel object
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The translation rule runs on the validator's worker thread, so it
+     * reads the coverage of the last published translation snapshot.
+     */
+    ValidationPanel::ValidationPanel()
+        : BasePanel(Constants::System::VALIDATION_WINDOW_ID) {
+        setTitle(i18n::Key::VALIDATION);
+
+        const i18n::i18n* translations = this->getTranslationsManager();
+        m_validator.addRule("translation.missing", [translations](const Core::Project&, Core::ProjectValidator::Issues& issues) {
+            const auto snapshot = translations->snapshot();
+            for (const std::string& language : snapshot->getLanguages()) {
+                const size_t missing = snapshot->getCoverage(language).missing();
+                if (missing > 0) {
+                    issues.push_back({Core::ValidationIssue::Severity::Warning, {}, {},
+                        std::format("Language '{}' is missing {} translations", language, missing)});
+                }
+            }
+        });
+    }
+
+    void ValidationPanel::startValidation() {
+        if (m_project == nullptr || !m_validator.start(*m_project)) {
+            return;
+        }
+        m_issues.clear();
+        m_errorCount = 0;
+        m_countedIssues = 0;
+        m_hasResult = false;
+    }
+
+    void ValidationPanel::setProject(Core::Project* project) {
+        m_validator.cancel();
+        m_project = project;
+        m_issues.clear();
+        m_errorCount = 0;
+        m_countedIssues = 0;
+        m_hasResult = false;
+    }
+
+    void ValidationPanel::setSelectionCallback(std::function<void(Core::EntityHandle)> callback) {
+        m_onSelectionChanged = std::move(callback);
+    }
+
+    void ValidationPanel::pollValidator() {
+        if (m_validator.poll(m_issues)) {
+            m_hasResult = true;
+        }
+        for (; m_countedIssues < m_issues.size(); ++m_countedIssues) {
+            if (m_issues[m_countedIssues].severity == Core::ValidationIssue::Severity::Error) {
+                ++m_errorCount;
+            }
+        }
+    }
+
+    /**
+     * @brief Render the issue list, clipped to the visible rows
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Project-wide issues have no entity and are listed but not selectable.
+     */
+    void ValidationPanel::renderIssues() {
+        ImGui::BeginChild("##issues");
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_issues.size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                const Core::ValidationIssue& issue = m_issues[static_cast<size_t>(row)];
+                const bool isError = issue.severity == Core::ValidationIssue::Severity::Error;
+                const std::string label = std::format("{} {}##{}",
+                    isError ? ICON_FA_TIMES_CIRCLE : ICON_FA_EXCLAMATION_TRIANGLE, issue.message, row);
+
+                ImGui::BeginDisabled(!issue.entity.isValid());
+                if (ImGui::Selectable(label.c_str()) && m_onSelectionChanged) {
+                    m_onSelectionChanged(issue.entity);
+                }
+                ImGui::EndDisabled();
+                if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
+                    ImGui::SetTooltip("%s", issue.rule.c_str());
+                }
+            }
+        }
+        ImGui::EndChild();
+    }
+
+    /**
+     * @brief Render the validation panel
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Results are collected every frame, even while the panel is hidden,
+     * so a pass started from elsewhere still completes.
+     */
+    void ValidationPanel::render() {
+        ADS_ZONE("ValidationPanel::render");
+        pollValidator();
+
+        if (!m_isVisible) {
+            return;
+        }
+
+        ImGui::Begin(getImGuiLabel().c_str());
+
+        ImGui::BeginDisabled(m_project == nullptr || m_validator.isBusy());
+        if (ImGui::Button(this->getTranslationsManager()->_t(i18n::Key::VALIDATION_RUN).data())) {
+            startValidation();
+        }
+        ImGui::EndDisabled();
+
+        ImGui::SameLine();
+        if (m_validator.isBusy()) {
+            ImGui::ProgressBar(m_validator.getProgress(), ImVec2(-1.0f, 0.0f));
+        } else if (m_hasResult && m_issues.empty()) {
+            ImGui::Text("%s %s", ICON_FA_CHECK, this->getTranslationsManager()->_t(i18n::Key::VALIDATION_NO_ISSUES).data());
+        }
+
+        if (!m_issues.empty()) {
+            m_textBuffer.clear();
+            ImGui::TextUnformatted(this->getTranslationsManager()->formatTo(m_textBuffer, i18n::Key::VALIDATION_SUMMARY,
+                i18n::arg("errors", m_errorCount),
+                i18n::arg("warnings", m_issues.size() - m_errorCount)
+            ).data());
+        }
+        ImGui::Separator();
+
+        renderIssues();
+
+        ImGui::End();
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_VALIDATION_PANEL_H
+#define ADS_VALIDATION_PANEL_H
+
+#include "BasePanel.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include "Core/Project.h"
+#include "Core/ProjectValidator.h"
+
+namespace ADS::IDE::Panels {
+    /**
+     * @brief Validation panel listing the problems found in the active project
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Runs a Core::ProjectValidator pass on demand and lists its issues as
+     * they arrive, so the first problems of a large project show up while
+     * the rest is still being checked. Clicking an issue selects its entity.
+     *
+     * On top of the built-in rules the panel registers `translation.missing`,
+     * which reports every loaded UI language lacking keys of the fallback
+     * language.
+     */
+    class ValidationPanel : public BasePanel {
+    private:
+        Core::Project* m_project = nullptr;
+        Core::ProjectValidator m_validator;
+        Core::ProjectValidator::Issues m_issues;                    ///< Issues of the current or last pass
+        size_t m_errorCount = 0;                                    ///< Errors in m_issues
+        size_t m_countedIssues = 0;                                 ///< Issues already added to the counts
+        bool m_hasResult = false;                                   ///< A pass has finished since the last reset
+        std::string m_textBuffer;                                   ///< Reused to format translated text
+        std::function<void(Core::EntityHandle)> m_onSelectionChanged;
+
+        /**
+         * @brief Collect the issues the running pass reported since the last frame
+         */
+        void pollValidator();
+
+        /**
+         * @brief Render the issue list, clipped to the visible rows
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Large projects can report thousands of issues, so only the rows
+         * in view are submitted to ImGui.
+         */
+        void renderIssues();
+
+    public:
+        /**
+         * @brief Construct a new ValidationPanel object
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Initializes the panel with name "Validation" and registers the
+         * translation completeness rule.
+         */
+        ValidationPanel();
+
+        /**
+         * @brief Destroy the ValidationPanel object
+         *
+         * Cancels a running pass through the validator's destructor.
+         */
+        ~ValidationPanel() override = default;
+
+        /**
+         * @brief Render the validation panel
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Shows the validate button, the progress of a running pass, the
+         * error and warning counts, and the issue list.
+         *
+         * @note Returns early if panel is not visible
+         */
+        void render() override;
+
+        /**
+         * @brief Start a validation pass over the active project
+         *
+         * Clears the previous results. Does nothing without a project or
+         * while a pass is already running.
+         */
+        void startValidation();
+
+        /**
+         * @brief Set the project data source for the validation panel
+         *
+         * Cancels a running pass and clears the results, since their handles
+         * belong to the previous project.
+         *
+         * @param project Non-owning pointer to the project (may be nullptr to clear)
+         */
+        void setProject(Core::Project* project);
+
+        /**
+         * @brief Set the callback invoked when the user clicks an issue
+         *
+         * @param callback Function called with the handle of the issue's entity
+         */
+        void setSelectionCallback(std::function<void(Core::EntityHandle)> callback);
+    };
+}
+
+#endif //ADS_VALIDATION_PANEL_H
@@ -0,0 +1,163 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file WatchPanel.cpp
+ * @brief Implementation of the WatchPanel class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "WatchPanel.h"
+#include "System.h"
+#include "Core/Profiling.h"
+#include "imgui.h"
+#include <format>
+#include <iterator>
+#include <string_view>
+
+namespace ADS::IDE::Panels {
+    WatchPanel::WatchPanel()
+        : BasePanel(Constants::System::WATCH_WINDOW_ID) {
+        setTitle(i18n::Key::WATCH);
+    }
+
+    void WatchPanel::setWatchList(const Runtime::WatchList* watchList, const Runtime::Program* program) {
+        m_watchList = watchList;
+        m_program = program;
+        m_rows.clear();
+        m_rowsBuiltFor = 0;
+    }
+
+    void WatchPanel::refreshRows() {
+        const std::string_view filter(m_filterBuffer);
+        if (filter == m_filter && m_rowsBuiltFor == m_watchList->size()) {
+            return;
+        }
+        m_filter = filter;
+        m_rowsBuiltFor = m_watchList->size();
+        m_rows.clear();
+        for (size_t index = 0; index < m_watchList->size(); ++index) {
+            if (filter.empty() || m_watchList->getName(index).find(filter) != std::string::npos) {
+                m_rows.push_back(index);
+            }
+        }
+    }
+
+    const char* WatchPanel::formatValue(const Runtime::Value value) {
+        m_textBuffer.clear();
+        switch (value.type()) {
+            case Runtime::Value::Type::Nil:
+                m_textBuffer = "nil";
+                break;
+            case Runtime::Value::Type::Bool:
+                m_textBuffer = value.asBool() ? "true" : "false";
+                break;
+            case Runtime::Value::Type::Number:
+                std::format_to(std::back_inserter(m_textBuffer), "{}", value.asNumber());
+                break;
+            case Runtime::Value::Type::String:
+                if (m_program != nullptr && value.asIndex() < m_program->strings.size()) {
+                    std::format_to(std::back_inserter(m_textBuffer), "\"{}\"", m_program->strings[value.asIndex()]);
+                } else {
+                    std::format_to(std::back_inserter(m_textBuffer), "string #{}", value.asIndex());
+                }
+                break;
+            case Runtime::Value::Type::Entity:
+                std::format_to(std::back_inserter(m_textBuffer), "entity #{}", value.asIndex());
+                break;
+        }
+        return m_textBuffer.c_str();
+    }
+
+    void WatchPanel::renderChanges(const size_t index) {
+        ImGui::BeginTooltip();
+        ImGui::TextUnformatted(m_watchList->getName(index).c_str());
+        ImGui::Separator();
+        for (size_t age = 0; age < m_watchList->getChangeCount(index); ++age) {
+            const Runtime::WatchList::Change& change = m_watchList->getChange(index, age);
+            ImGui::Text("%llu", static_cast<unsigned long long>(change.tick));
+            ImGui::SameLine(120.0f);
+            ImGui::TextUnformatted(formatValue(change.value));
+        }
+        ImGui::EndTooltip();
+    }
+
+    /**
+     * @brief Render the variables, clipped to the visible rows
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Sparklines plot straight from the list's rings, so a row costs no
+     * copy of its samples.
+     */
+    void WatchPanel::renderVariables() {
+        if (!ImGui::BeginTable("##variables", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_ScrollY)) {
+            return;
+        }
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Variable", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthFixed, 160.0f);
+        ImGui::TableHeadersRow();
+
+        const int sampleCount = static_cast<int>(m_watchList->getSampleCount());
+        const int sampleOffset = static_cast<int>(m_watchList->getSampleOffset());
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_rows.size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                const size_t index = m_rows[static_cast<size_t>(row)];
+                ImGui::PushID(row);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Selectable(m_watchList->getName(index).c_str(), false, ImGuiSelectableFlags_SpanAllColumns);
+                if (ImGui::IsItemHovered()) {
+                    renderChanges(index);
+                }
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(formatValue(m_watchList->getValue(index)));
+                ImGui::TableNextColumn();
+                ImGui::PlotLines("##samples", m_watchList->getSamples(index).data(), sampleCount, sampleOffset,
+                                 nullptr, FLT_MAX, FLT_MAX, ImVec2(-1.0f, ImGui::GetTextLineHeight()));
+                ImGui::PopID();
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    void WatchPanel::render() {
+        ADS_ZONE("WatchPanel::render");
+        if (!m_isVisible) {
+            return;
+        }
+
+        ImGui::Begin(getImGuiLabel().c_str());
+
+        if (m_watchList == nullptr || m_watchList->size() == 0) {
+            ImGui::TextDisabled("%s", this->getTranslationsManager()->_t(i18n::Key::WATCH_EMPTY).data());
+            ImGui::End();
+            return;
+        }
+
+        ImGui::SetNextItemWidth(-1);
+        ImGui::InputTextWithHint("##filter",
+                                 this->getTranslationsManager()->_t(i18n::Key::WATCH_FILTER_HINT).data(),
+                                 m_filterBuffer, sizeof(m_filterBuffer));
+        refreshRows();
+        renderVariables();
+
+        ImGui::End();
+    }
+}
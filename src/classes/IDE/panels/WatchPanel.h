@@ -0,0 +1,104 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_WATCH_PANEL_H
+#define ADS_WATCH_PANEL_H
+
+#include "BasePanel.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Runtime/Program.h"
+#include "Runtime/WatchList.h"
+
+namespace ADS::IDE::Panels {
+    /**
+     * @brief Watch panel showing the recent history of the game variables
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Lists the variables of a Runtime::WatchList with their current value
+     * and a sparkline of their last samples; hovering a row shows its
+     * latest changes. The list is sampled by the running game, not by the
+     * panel, so the panel only reads it once per frame.
+     */
+    class WatchPanel : public BasePanel {
+    private:
+        const Runtime::WatchList* m_watchList = nullptr;
+        const Runtime::Program* m_program = nullptr;
+        char m_filterBuffer[128] = {};                  ///< Filter bar text
+        std::string m_filter;                           ///< Filter the rows were built for
+        std::vector<size_t> m_rows;                     ///< Variables passing the filter
+        size_t m_rowsBuiltFor = 0;                      ///< Size of the list the rows were built for
+        std::string m_textBuffer;                       ///< Reused to format values
+
+        /**
+         * @brief Rebuild the rows if the filter or the number of variables changed
+         */
+        void refreshRows();
+
+        /**
+         * @brief Format a value for display, into m_textBuffer
+         */
+        const char* formatValue(Runtime::Value value);
+
+        /**
+         * @brief Render the variables, clipped to the visible rows
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A game may watch thousands of variables, so only the rows in
+         * view are submitted to ImGui.
+         */
+        void renderVariables();
+
+        /**
+         * @brief Render the latest changes of a variable as a tooltip
+         */
+        void renderChanges(size_t index);
+
+    public:
+        /**
+         * @brief Construct a new WatchPanel object
+         *
+         * Initializes the panel with name "Watch".
+         */
+        WatchPanel();
+
+        ~WatchPanel() override = default;
+
+        /**
+         * @brief Render the watch panel
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Shows the filter bar and the variable list, or a hint while no
+         * game is being watched.
+         *
+         * @note Returns early if panel is not visible
+         */
+        void render() override;
+
+        /**
+         * @brief Set the variables to show
+         *
+         * @param watchList Non-owning pointer to the list (may be nullptr to clear)
+         * @param program   Program the values belong to, to show string values; may be nullptr
+         */
+        void setWatchList(const Runtime::WatchList* watchList, const Runtime::Program* program);
+    };
+}
+
+#endif //ADS_WATCH_PANEL_H
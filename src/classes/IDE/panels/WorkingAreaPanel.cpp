@@ -21,8 +21,13 @@
 #include "WorkingAreaPanel.h"
 #include "imgui.h"
 #include "IconsFontAwesome4.h"
+#include "app.h"
+#include "System.h"
+#include "Core/Profiling.h"
+#include <algorithm>
+#include <optional>
 #include <string>
-#include <cstring>
+#include <utility>
 
 namespace ADS::IDE::Panels {
     /**
@@ -36,50 +41,77 @@ namespace ADS::IDE::Panels {
      * description, dialog, and FontAwesome icons.
      */
     WorkingAreaPanel::WorkingAreaPanel()
-        : BasePanel("hWorkingArea") {
-        m_windowTitle = this->getTranslationsManager()->_t("WORKING_AREA");
+        : BasePanel(Constants::System::WORKING_AREA_WINDOW_ID), m_nextScriptNumber(2), m_selectDocument(0) {
+        setTitle(i18n::Key::WORKING_AREA);
         // Initialize script text with default content
-        std::strcpy(m_scriptText,
-                    ICON_FA_TREE " Forest Entrance\n"
-                    ICON_FA_BOOK " Description: You stand at the edge of a dark forest...\n"
-                    ICON_FA_COMMENT " Dialog: 'Welcome, traveler...'\n");
+        m_documents.create(std::string(ICON_FA_CARET_UP) + " Script 1",
+                           ICON_FA_TREE " Forest Entrance\n"
+                           ICON_FA_BOOK " Description: You stand at the edge of a dark forest...\n"
+                           ICON_FA_COMMENT " Dialog: 'Welcome, traveler...'\n");
+    }
+
+    WorkingAreaPanel::~WorkingAreaPanel() {
+        if (UI::AssetManager* assets = Core::App::getAssetManager()) {
+            assets->release(m_logo);
+        }
     }
 
     /**
      * @brief Render the tab bar
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
      * Displays a tabbed interface for managing multiple open documents.
-     * Shows tabs for each open script and provides a "+" tab for creating
-     * new scripts. Each tab can contain different content.
+     * Shows the preview of the selected scene first, a closable tab for
+     * each document and a trailing "+" button for creating new scripts.
+     * Only the selected tab is activated, so documents never shown are
+     * never loaded.
      *
-     * @note Currently displays placeholder tabs: Script 1, Script 2, and +
      * @see renderScriptEditor()
      */
     void WorkingAreaPanel::renderTabBar() {
-        if (ImGui::BeginTabBar("DocumentTabs")) {
-            // Script 1 tab
-            std::string tabLabel = std::string(ICON_FA_CARET_UP) + " Script 1";
-            if (ImGui::BeginTabItem(tabLabel.c_str())) {
-                renderScriptEditor();
-                ImGui::EndTabItem();
+        if (ImGui::BeginTabBar("DocumentTabs", ImGuiTabBarFlags_Reorderable | ImGuiTabBarFlags_FittingPolicyScroll)) {
+            if (const Entities::Scene* scene = m_scenePreview.findScene()) {
+                const std::string tabLabel = std::string(ICON_FA_PICTURE_O " ") + scene->getName() + "###scenePreview";
+                bool open = true;
+                if (ImGui::BeginTabItem(tabLabel.c_str(), &open, ImGuiTabItemFlags_Leading)) {
+                    m_scenePreview.render();
+                    ImGui::EndTabItem();
+                }
+                if (!open) {
+                    m_scenePreview.setScene(nullptr, Core::EntityHandle());
+                }
             }
 
-            // Script 2 tab
-            if (ImGui::BeginTabItem("Script 2")) {
-                ImGui::Text("%s", this->getTranslationsManager()->_t("CONTENT_OF_SCRIPT").c_str());
-                ImGui::EndTabItem();
+            std::optional<size_t> closed;
+            for (size_t index = 0; index < m_documents.getCount(); ++index) {
+                // The id keeps the tab state when titles repeat or documents close
+                const uint32_t id = m_documents.getId(index);
+                const std::string tabLabel = m_documents.getTitle(index) + "###document" + std::to_string(id);
+                const ImGuiTabItemFlags flags = (id == m_selectDocument) ? ImGuiTabItemFlags_SetSelected
+                                                                         : ImGuiTabItemFlags_None;
+                bool open = true;
+                if (ImGui::BeginTabItem(tabLabel.c_str(), &open, flags)) {
+                    renderScriptEditor(index);
+                    ImGui::EndTabItem();
+                }
+                if (!open) {
+                    closed = index;
+                }
             }
+            m_selectDocument = 0;
 
             // Add new tab button
-            if (ImGui::BeginTabItem("+")) {
-                ImGui::Text("%s", this->getTranslationsManager()->_t("MAIN_CONTENT_AREA").c_str());
-                ImGui::EndTabItem();
+            if (ImGui::TabItemButton("+", ImGuiTabItemFlags_Trailing | ImGuiTabItemFlags_NoTooltip)) {
+                handleNewTab();
             }
 
             ImGui::EndTabBar();
+
+            if (closed) {
+                m_documents.close(*closed);
+            }
         }
     }
 
@@ -87,56 +119,98 @@ namespace ADS::IDE::Panels {
      * @brief Render the script editor
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
      * Displays a multi-line text editor for editing script content.
      * The editor fills the available space in the tab and allows
      * free-form text input with FontAwesome icons support.
      *
-     * @note Currently edits the m_scriptText buffer
+     * @param index Document shown in the selected tab
      */
-    void WorkingAreaPanel::renderScriptEditor() {
-        ImGui::InputTextMultiline("##script", m_scriptText, IM_ARRAYSIZE(m_scriptText), ImVec2(-1, -1));
+    void WorkingAreaPanel::renderScriptEditor(const size_t index) {
+        m_documents.activate(index, ImGui::GetTime()).render("##script", ImVec2(-1, -1));
     }
 
     /**
      * @brief Handle new tab creation
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
-     *
-     * Handles the user action when the "+" tab is clicked.
-     * This method will be responsible for creating new script tabs
-     * in the working area.
+     * @version Oct 2026
      *
-     * @note Currently a placeholder implementation
+     * Handles the user action when the "+" tab is clicked: adds an
+     * empty "Script N" document and selects its tab.
      */
     void WorkingAreaPanel::handleNewTab() {
-        // Handle new tab creation
+        const size_t index = m_documents.create("Script " + std::to_string(m_nextScriptNumber++), {});
+        m_selectDocument = m_documents.getId(index);
     }
 
     /**
      * @brief Render the working area panel
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
      * Displays a tabbed interface for editing scripts with
      * multi-line text editors. The panel provides the main content
-     * editing area with support for multiple open documents.
+     * editing area with support for multiple open documents, and
+     * shows the logo instead while there is none. Documents left in
+     * the background are parked here.
+     *
+     * The logo is requested from the asset manager on the first frame and
+     * drawn once it has been uploaded; until then the panel simply omits it.
      *
-     * @note Returns early if panel is not visible
+     * @note Returns early if panel is not visible, once idle documents are parked
      * @see renderTabBar(), renderScriptEditor()
      */
     void WorkingAreaPanel::render() {
+        ADS_ZONE("WorkingAreaPanel::render");
+        // A hidden panel leaves every document in the background
+        m_documents.parkIdle(ImGui::GetTime(), Constants::System::DOCUMENT_PARK_SECONDS);
         if (!m_isVisible) {
             return;
         }
 
         ImGui::Begin(getImGuiLabel().c_str());
-        ImGui::Text("%s", this->getTranslationsManager()->_t("MAIN_CONTENT_AREA").c_str());
+        ImGui::Text("%s", this->getTranslationsManager()->_t(i18n::Key::MAIN_CONTENT_AREA).data());
         ImGui::Separator();
+        renderTabBar();
+
+        if (m_documents.getCount() > 0 || m_scenePreview.findScene() != nullptr) {
+            ImGui::End();
+            return;
+        }
+
+        if (UI::AssetManager* assets = Core::App::getAssetManager()) {
+            if (!m_logo.isValid()) {
+                m_logo = assets->acquire("logo.png");
+            }
+            if (const ImTextureID texture = assets->getTexture(m_logo)) {
+                int width, height;
+                assets->getSize(m_logo, width, height);
+                const float scale = std::min(1.0f, ImGui::GetContentRegionAvail().x / static_cast<float>(width));
+                ImGui::Image(texture,
+                             ImVec2(static_cast<float>(width) * scale, static_cast<float>(height) * scale));
+            }
+        }
 
         ImGui::End();
     }
+
+    /**
+     * @brief Show a scene in the preview tab, or close the tab
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param project Project the scene belongs to, or nullptr to close the tab
+     * @param scene   Handle of the scene in @p project
+     */
+    void WorkingAreaPanel::showScene(Core::Project* project, const Core::EntityHandle scene) {
+        m_scenePreview.setScene(project, scene);
+    }
+
+    void WorkingAreaPanel::setSelectionCallback(std::function<void(std::span<const Core::EntityHandle>)> callback) {
+        m_scenePreview.setSelectionCallback(std::move(callback));
+    }
 }
@@ -16,6 +16,9 @@
 
 #include "BasePanel.h"
 #include <string>
+#include "UI/AssetManager.h"
+#include "IDE/DocumentManager.h"
+#include "IDE/ScenePreview.h"
 
 namespace ADS::IDE::Panels {
     /**
@@ -25,26 +28,49 @@ namespace ADS::IDE::Panels {
      * @version Dec 2025
      *
      * Provides a tabbed interface for editing multiple scripts and documents
-     * with multi-line text editors and tab management.
+     * with multi-line text editors and tab management. Documents are
+     * kept by a DocumentManager, so a tab only gets an editor once it is
+     * shown and loses it again after a while in the background.
      */
     class WorkingAreaPanel : public BasePanel {
     private:
         /**
-         * Script text buffer for Script 1
+         * Documents shown as tabs
          */
-        char m_scriptText[4096];
+        DocumentManager m_documents;
+
+        /**
+         * Number given to the title of the next new script
+         */
+        int m_nextScriptNumber;
+
+        /**
+         * Id of a document whose tab is selected on the next frame, 0 if none
+         */
+        uint32_t m_selectDocument;
+
+        /**
+         * Application logo shown while no document is open
+         */
+        UI::TextureHandle m_logo;
+
+        /**
+         * Canvas of the selected scene, shown in the first tab
+         */
+        ScenePreview m_scenePreview;
 
         /**
          * @brief Render the tab bar
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
          * Displays a tabbed interface for managing multiple open documents.
-         * Shows tabs for each open script and provides a "+" tab for creating
-         * new scripts. Each tab can contain different content.
+         * Shows the preview of the selected scene first, a closable tab for
+         * each document and a trailing "+" button for creating new scripts.
+         * Only the selected tab is activated, so documents never shown are
+         * never loaded.
          *
-         * @note Currently displays placeholder tabs: Script 1, Script 2, and +
          * @see renderScriptEditor()
          */
         void renderTabBar();
@@ -53,27 +79,24 @@ namespace ADS::IDE::Panels {
          * @brief Render the script editor
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
          * Displays a multi-line text editor for editing script content.
          * The editor fills the available space in the tab and allows
          * free-form text input with FontAwesome icons support.
          *
-         * @note Currently edits the m_scriptText buffer
+         * @param index Document shown in the selected tab
          */
-        void renderScriptEditor();
+        void renderScriptEditor(size_t index);
 
         /**
          * @brief Handle new tab creation
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
-         *
-         * Handles the user action when the "+" tab is clicked.
-         * This method will be responsible for creating new script tabs
-         * in the working area.
+         * @version Oct 2026
          *
-         * @note Currently a placeholder implementation
+         * Handles the user action when the "+" tab is clicked: adds an
+         * empty "Script N" document and selects its tab.
          */
         void handleNewTab();
 
@@ -96,24 +119,46 @@ namespace ADS::IDE::Panels {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Jan 2026
          *
-         * Default destructor. No special cleanup required for this class.
+         * Gives the logo texture back to the asset manager, if it still exists.
          */
-        ~WorkingAreaPanel() override = default;
+        ~WorkingAreaPanel() override;
 
         /**
          * @brief Render the working area panel
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
          * Displays a tabbed interface for editing scripts with
          * multi-line text editors. The panel provides the main content
-         * editing area with support for multiple open documents.
+         * editing area with support for multiple open documents, and
+         * shows the logo instead while there is none. Documents left in
+         * the background are parked here.
          *
          * @note Returns early if panel is not visible
          * @see renderTabBar(), renderScriptEditor()
          */
         void render() override;
+
+        /**
+         * @brief Show a scene in the preview tab, or close the tab
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Must be called with nullptr before the shown project is deleted.
+         *
+         * @param project Project the scene belongs to, or nullptr to close the tab
+         * @param scene   Handle of the scene in @p project
+         * @see ScenePreview::setScene()
+         */
+        void showScene(Core::Project* project, Core::EntityHandle scene);
+
+        /**
+         * @brief Set the function called when objects are picked on the scene canvas
+         * @see ScenePreview::setSelectionCallback()
+         */
+        void setSelectionCallback(std::function<void(std::span<const Core::EntityHandle>)> callback);
     };
 }
 
@@ -11,30 +11,62 @@
  */
 
 #include "DarkTheme.h"
+#include "Palette.h"
 
 namespace ADS::IDE {
     /**
-     * @brief Apply dark theme to ImGui style
+     * @brief Set the dark theme colours
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
-     * Applies ImGui's default dark color scheme and applies any
-     * custom color overrides for the IDE interface including
-     * menu dropdown backgrounds and other UI elements.
+     * Starts from ImGui's dark colour scheme and replaces the
+     * backgrounds, borders, text and accents with the palette of
+     * DESIGN.md.
      */
-    void DarkTheme::apply() {
-        // Apply ImGui's default dark theme
-        ImGui::StyleColorsDark();
+    void DarkTheme::setColors(ImGuiStyle& style) const {
+        ImGui::StyleColorsDark(&style);
+        ImVec4* colors = style.Colors;
+
+        // Backgrounds: base behind panels, hover and active selection above them
+        colors[ImGuiCol_WindowBg] = Palette::BG1;
+        colors[ImGuiCol_PopupBg] = Palette::BG0;
+        colors[ImGuiCol_MenuBarBg] = Palette::BG0;
+        colors[ImGuiCol_TitleBg] = Palette::BG0;
+        colors[ImGuiCol_TitleBgActive] = Palette::BG1;
+        colors[ImGuiCol_TitleBgCollapsed] = Palette::BG0;
+        colors[ImGuiCol_DockingEmptyBg] = Palette::BG0;
+        colors[ImGuiCol_FrameBg] = Palette::BG0;
+        colors[ImGuiCol_FrameBgHovered] = Palette::BG2;
+        colors[ImGuiCol_FrameBgActive] = Palette::BG3;
+        colors[ImGuiCol_Button] = Palette::BG2;
+        colors[ImGuiCol_ButtonHovered] = Palette::BG3;
+        colors[ImGuiCol_ButtonActive] = Palette::BORDER_HI;
+        colors[ImGuiCol_Header] = Palette::BG3;
+        colors[ImGuiCol_HeaderHovered] = Palette::BG2;
+        colors[ImGuiCol_HeaderActive] = Palette::BG3;
+        colors[ImGuiCol_Tab] = Palette::BG0;
+        colors[ImGuiCol_TabHovered] = Palette::BG2;
+        colors[ImGuiCol_TabSelected] = Palette::BG1;
+        colors[ImGuiCol_TabDimmed] = Palette::BG0;
+        colors[ImGuiCol_TabDimmedSelected] = Palette::BG1;
 
-        // Get style reference for customization
-        ImGuiStyle& style = ImGui::GetStyle();
+        // Borders
+        colors[ImGuiCol_Border] = Palette::BORDER;
+        colors[ImGuiCol_Separator] = Palette::BORDER;
+        colors[ImGuiCol_SeparatorHovered] = Palette::BORDER_HI;
+        colors[ImGuiCol_SeparatorActive] = Palette::BORDER_HI;
 
-        // Customize menu dropdown background
-        style.Colors[ImGuiCol_PopupBg] = ImVec4(0.15f, 0.15f, 0.18f, 1.0f);
+        // Text
+        colors[ImGuiCol_Text] = Palette::TEXT0;
+        colors[ImGuiCol_TextDisabled] = Palette::TEXT2;
 
-        // Additional customizations can be added here
-        // Example: style.Colors[ImGuiCol_MenuBarBg] = ImVec4(0.14f, 0.14f, 0.14f, 1.0f);
+        // Accents
+        colors[ImGuiCol_CheckMark] = Palette::C_SCENE;
+        colors[ImGuiCol_SliderGrab] = Palette::C_SCENE;
+        colors[ImGuiCol_SliderGrabActive] = Palette::C_SCENE;
+        colors[ImGuiCol_TabSelectedOverline] = Palette::C_SCENE;
+        colors[ImGuiCol_TextSelectedBg] = ImVec4(Palette::C_SCENE.x, Palette::C_SCENE.y, Palette::C_SCENE.z, 0.35f);
     }
 
     /**
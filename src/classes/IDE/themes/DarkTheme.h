@@ -21,34 +21,35 @@ namespace ADS::IDE {
      * @brief Dark color scheme for the IDE
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
      * Implements a dark theme using ImGui's built-in dark color scheme
-     * as the foundation. Can be extended to customize specific colors
-     * for menu dropdowns, panels, and other UI elements.
+     * as the foundation, coloured with the palette of DESIGN.md.
      */
     class DarkTheme : public Theme {
     public:
         /**
-         * @brief Apply dark theme to ImGui style
+         * @brief Get the theme name
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Dec 2025
          *
-         * Applies ImGui's default dark color scheme and applies any
-         * custom color overrides for the IDE interface.
+         * @return const char* Returns "Dark"
          */
-        void apply() override;
+        const char* getName() const override;
 
+    protected:
         /**
-         * @brief Get the theme name
+         * @brief Set the dark theme colours
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Dec 2025
+         * @version Oct 2026
          *
-         * @return const char* Returns "Dark"
+         * Starts from ImGui's dark colour scheme and replaces the
+         * backgrounds, borders, text and accents with the palette of
+         * DESIGN.md.
          */
-        const char* getName() const override;
+        void setColors(ImGuiStyle& style) const override;
     };
 }
 
@@ -14,27 +14,19 @@
 
 namespace ADS::IDE {
     /**
-     * @brief Apply light theme to ImGui style
+     * @brief Set the light theme colours
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
-     * Applies ImGui's default light color scheme and applies any
-     * custom color overrides for the IDE interface including
-     * menu dropdown backgrounds and other UI elements.
+     * Starts from ImGui's light colour scheme, with a lighter menu
+     * dropdown background.
      */
-    void LightTheme::apply() {
-        // Apply ImGui's default light theme
-        ImGui::StyleColorsLight();
-
-        // Get style reference for customization
-        ImGuiStyle& style = ImGui::GetStyle();
+    void LightTheme::setColors(ImGuiStyle& style) const {
+        ImGui::StyleColorsLight(&style);
 
         // Customize menu dropdown background
         style.Colors[ImGuiCol_PopupBg] = ImVec4(0.95f, 0.95f, 0.95f, 1.0f);
-
-        // Additional customizations can be added here
-        // Example: style.Colors[ImGuiCol_MenuBarBg] = ImVec4(0.90f, 0.90f, 0.90f, 1.0f);
     }
 
     /**
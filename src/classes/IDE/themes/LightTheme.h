@@ -30,25 +30,26 @@ namespace ADS::IDE {
     class LightTheme : public Theme {
     public:
         /**
-         * @brief Apply light theme to ImGui style
+         * @brief Get the theme name
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Dec 2025
          *
-         * Applies ImGui's default light color scheme and applies any
-         * custom color overrides for the IDE interface.
+         * @return const char* Returns "Light"
          */
-        void apply() override;
+        const char* getName() const override;
 
+    protected:
         /**
-         * @brief Get the theme name
+         * @brief Set the light theme colours
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Dec 2025
+         * @version Oct 2026
          *
-         * @return const char* Returns "Light"
+         * Starts from ImGui's light colour scheme, with a lighter menu
+         * dropdown background.
          */
-        const char* getName() const override;
+        void setColors(ImGuiStyle& style) const override;
     };
 }
 
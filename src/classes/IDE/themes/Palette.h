@@ -0,0 +1,55 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_PALETTE_H
+#define ADS_PALETTE_H
+
+#include "imgui.h"
+
+/**
+ * @file Palette.h
+ * @brief Colours of the IDE, as listed in DESIGN.md section 2
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+namespace ADS::IDE::Palette {
+    // Backgrounds
+    constexpr ImVec4 BG0 = {0.059f, 0.067f, 0.090f, 1.0f};        ///< #0f1117, base background
+    constexpr ImVec4 BG1 = {0.086f, 0.106f, 0.141f, 1.0f};        ///< #161b24, panels
+    constexpr ImVec4 BG2 = {0.118f, 0.145f, 0.200f, 1.0f};        ///< #1e2533, hover
+    constexpr ImVec4 BG3 = {0.145f, 0.176f, 0.243f, 1.0f};        ///< #252d3e, active selection
+
+    // Borders
+    constexpr ImVec4 BORDER = {0.180f, 0.227f, 0.314f, 1.0f};     ///< #2e3a50
+    constexpr ImVec4 BORDER_HI = {0.239f, 0.310f, 0.431f, 1.0f};  ///< #3d4f6e
+
+    // Text
+    constexpr ImVec4 TEXT0 = {0.910f, 0.902f, 0.875f, 1.0f};      ///< #e8e6df, primary
+    constexpr ImVec4 TEXT1 = {0.722f, 0.706f, 0.659f, 1.0f};      ///< #b8b4a8, secondary
+    constexpr ImVec4 TEXT2 = {0.353f, 0.384f, 0.459f, 1.0f};      ///< #5a6275, muted and labels
+
+    // Accents by element type
+    constexpr ImVec4 C_SCENE = {0.482f, 0.616f, 1.000f, 1.0f};    ///< #7b9dff
+    constexpr ImVec4 C_NPC = {0.831f, 0.400f, 0.478f, 1.0f};      ///< #d4667a
+    constexpr ImVec4 C_ITEM = {0.357f, 0.769f, 0.627f, 1.0f};     ///< #5bc4a0
+    constexpr ImVec4 C_PUZZLE = {0.910f, 0.643f, 0.290f, 1.0f};   ///< #e8a44a
+    constexpr ImVec4 C_VAR = {0.690f, 0.486f, 1.000f, 1.0f};      ///< #b07cff
+    constexpr ImVec4 C_AUDIO = {0.941f, 0.541f, 0.365f, 1.0f};    ///< #f08a5d
+
+    // States
+    constexpr ImVec4 C_ERROR = {0.878f, 0.322f, 0.322f, 1.0f};    ///< #e05252
+    constexpr ImVec4 C_WARN = C_PUZZLE;                           ///< #e8a44a
+    constexpr ImVec4 C_OK = C_ITEM;                               ///< #5bc4a0
+}
+
+#endif // ADS_PALETTE_H
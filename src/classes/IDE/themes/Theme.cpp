@@ -13,5 +13,40 @@
 #include "Theme.h"
 
 namespace ADS::IDE {
-    // No implementation needed for abstract base class
-}
\ No newline at end of file
+    /**
+     * @brief Build the style of the theme
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param base  Style holding the settings to keep, unscaled
+     * @param scale DPI scale of the sizes and paddings
+     */
+    void Theme::build(const ImGuiStyle& base, const float scale) {
+        m_style = base;
+        setColors(m_style);
+
+        // Platform windows are opaque and square, as the OS draws their frame
+        if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
+            m_style.WindowRounding = 0.0f;
+            m_style.Colors[ImGuiCol_WindowBg].w = 1.0f;
+        }
+        if (scale != 1.0f) {
+            m_style.ScaleAllSizes(scale);
+        }
+    }
+
+    /**
+     * @brief Apply the theme to ImGui style
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     */
+    void Theme::apply() const {
+        ImGui::GetStyle() = m_style;
+    }
+
+    const ImGuiStyle& Theme::getStyle() const {
+        return m_style;
+    }
+}
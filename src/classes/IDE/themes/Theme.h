@@ -21,27 +21,53 @@ namespace ADS::IDE {
      * @brief Base class for IDE theme configuration
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
      * Abstract base class that defines the interface for applying
      * theme configurations to the ImGui style system. Concrete
      * implementations provide specific color schemes and styling.
+     *
+     * The whole ImGuiStyle of a theme is built once by build(), so
+     * applying it is a single copy into ImGui::GetStyle(), with no colour
+     * computation or allocation.
      */
     class Theme {
     public:
         virtual ~Theme() = default;
 
+        /**
+         * @brief Build the style of the theme
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Starts from a base style, so settings the themes do not own,
+         * such as the tooltip delay, are kept, then sets this theme's
+         * colours, the adjustments multi-viewport platform windows need,
+         * and scales the sizes for the display.
+         *
+         * @param base  Style holding the settings to keep, unscaled
+         * @param scale DPI scale of the sizes and paddings
+         */
+        void build(const ImGuiStyle& base, float scale);
+
         /**
          * @brief Apply the theme to ImGui style
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Dec 2025
+         * @version Oct 2026
          *
-         * Applies this theme's color scheme and style settings to the
-         * ImGui global style. This method should be called during
-         * initialization or when switching themes.
+         * Copies the style made by build() into the ImGui global style.
+         * This method should be called during initialization or when
+         * switching themes.
          */
-        virtual void apply() = 0;
+        void apply() const;
+
+        /**
+         * @brief Get the built style
+         * @return const ImGuiStyle& Style apply() copies
+         */
+        [[nodiscard]] const ImGuiStyle& getStyle() const;
 
         /**
          * @brief Get the theme name
@@ -54,7 +80,18 @@ namespace ADS::IDE {
          * @return const char* Theme name string
          */
         virtual const char* getName() const = 0;
+
+    protected:
+        /**
+         * @brief Set the colours of the theme
+         *
+         * @param style Style being built, before it is scaled
+         */
+        virtual void setColors(ImGuiStyle& style) const = 0;
+
+    private:
+        ImGuiStyle m_style;
     };
 }
 
-#endif // ADS_THEME_H
\ No newline at end of file
+#endif // ADS_THEME_H
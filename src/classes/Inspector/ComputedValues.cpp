@@ -0,0 +1,36 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ComputedValues.cpp
+ * @brief Implementation of the ComputedValues class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ComputedValues.h"
+
+namespace ADS::Inspector {
+
+    void ComputedValues::invalidate(const PropertySchema& schema, std::string_view propertyId) {
+        for (const size_t index : schema.getDependents(propertyId)) {
+            if (index < m_valid.size()) {
+                m_valid[index] = false;
+            }
+        }
+    }
+
+    void ComputedValues::clear() {
+        m_valid.assign(m_valid.size(), false);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_COMPUTED_VALUES_H
+#define ADS_COMPUTED_VALUES_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "PropertySchema.h"
+#include "PropertyValue.h"
+
+namespace ADS::Inspector {
+    /**
+     * @brief Lazily recomputed values of an object's computed properties
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The owner calls invalidate() for every property change; only the
+     * computed properties that depend on the changed one, as listed by
+     * the schema, are marked stale, and each is recomputed on its next
+     * read. A value nobody reads is never recomputed.
+     *
+     * Reads fill the cache, so they must not run concurrently with each
+     * other or with changes.
+     */
+    class ComputedValues {
+    private:
+        std::vector<PropertyValue> m_values;    ///< By descriptor index
+        std::vector<bool> m_valid;              ///< m_values[i] is current
+
+    public:
+        /**
+         * @brief Mark the values derived from a property as stale
+         *
+         * @param schema     Schema of the owner
+         * @param propertyId Id of the changed property
+         */
+        void invalidate(const PropertySchema& schema, std::string_view propertyId);
+
+        /**
+         * @brief Mark every value as stale
+         */
+        void clear();
+
+        /**
+         * @brief Get a computed value, recomputing it if it is stale
+         *
+         * @tparam Compute Callable returning the value
+         * @param index   Index of the descriptor in the owner's schema
+         * @param compute Called when the value is stale; may read other computed values
+         * @return const PropertyValue& The value, valid until the next read of another value
+         */
+        template <class Compute>
+        const PropertyValue& get(size_t index, Compute&& compute) {
+            if (index >= m_valid.size()) {
+                m_values.resize(index + 1);
+                m_valid.resize(index + 1, false);
+            }
+            if (!m_valid[index]) {
+                PropertyValue value = std::forward<Compute>(compute)();
+                m_values[index] = std::move(value);
+                m_valid[index] = true;
+            }
+            return m_values[index];
+        }
+    };
+}
+
+#endif //ADS_COMPUTED_VALUES_H
@@ -58,9 +58,9 @@ namespace ADS::Inspector::Editors {
         EnumValue enumVal = getValueOr<EnumValue>(currentValue, EnumValue());
 
         // Get options from value or constraints
-        std::vector<std::string> options = enumVal.options;
-        if (options.empty() && descriptor.getConstraints().hasEnumConstraints()) {
-            options = descriptor.getConstraints().enumValues;
+        const EnumOptions* options = enumVal.options;
+        if ((options == nullptr || options->size() == 0) && descriptor.getConstraints().hasEnumConstraints()) {
+            options = descriptor.getConstraints().enumOptions;
         }
 
         ImGui::PushID(descriptor.getId().c_str());
@@ -79,7 +79,7 @@ namespace ADS::Inspector::Editors {
         ImGui::NextColumn();
 
         // Widget column
-        if (options.empty()) {
+        if (options == nullptr || options->size() == 0) {
             ImGui::TextDisabled("No options available");
             ImGui::Columns(1);
             ImGui::PopID();
@@ -90,7 +90,7 @@ namespace ADS::Inspector::Editors {
         int originalIndex = selectedIndex;
 
         // Clamp index to valid range
-        if (selectedIndex < 0 || selectedIndex >= static_cast<int>(options.size())) {
+        if (selectedIndex < 0 || selectedIndex >= static_cast<int>(options->size())) {
             selectedIndex = 0;
         }
 
@@ -98,19 +98,12 @@ namespace ADS::Inspector::Editors {
             ImGui::BeginDisabled();
         }
 
-        // Build items string for combo (null-separated)
-        std::string itemsStr;
-        for (const auto& opt : options) {
-            itemsStr += opt;
-            itemsStr += '\0';
-        }
-        itemsStr += '\0';
-
+        // Items string is prebuilt by the option table (null-separated)
         ImGui::SetNextItemWidth(-1);
         ImGui::Combo(
             "##value",
             &selectedIndex,
-            itemsStr.c_str()
+            options->getComboItems().c_str()
         );
 
         if (readOnly) {
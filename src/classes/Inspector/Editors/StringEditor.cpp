@@ -20,16 +20,28 @@
 
 #include "StringEditor.h"
 #include "imgui.h"
-#include <cstring>
 #include <algorithm>
+#include <cstring>
 
 namespace ADS::Inspector::Editors {
+    namespace {
+        /**
+         * @brief Grow the std::string behind an input field as ImGui asks
+         */
+        int resizeCallback(ImGuiInputTextCallbackData* data) {
+            if (data->EventFlag == ImGuiInputTextFlags_CallbackResize) {
+                auto* text = static_cast<std::string*>(data->UserData);
+                text->resize(static_cast<size_t>(data->BufTextLen));
+                data->Buf = text->data();
+            }
+            return 0;
+        }
+    }
+
     /**
      * @brief Construct a new StringEditor
      */
-    StringEditor::StringEditor() {
-        std::memset(m_buffer, 0, sizeof(m_buffer));
-    }
+    StringEditor::StringEditor() = default;
 
     /**
      * @brief Get the property types this editor can handle
@@ -47,11 +59,16 @@ namespace ADS::Inspector::Editors {
      * @brief Render the editor for a property
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
      * Renders a text input field for editing string properties.
      * Respects maxLength constraints if specified.
      *
+     * An idle field is bound read-only to the current value, so drawing it
+     * copies nothing. The frame the field is activated, the value is copied
+     * into m_editText, which later frames edit in place. The edit is
+     * returned once, when the field is deactivated after a change.
+     *
      * @param descriptor Property metadata
      * @param currentValue Current property value
      * @param readOnly True if the property cannot be edited
@@ -62,21 +79,10 @@ namespace ADS::Inspector::Editors {
         const PropertyValue& currentValue,
         bool readOnly
     ) {
-        // Get current string value
-        std::string currentStr = getValueOr<std::string>(currentValue, "");
-
-        // Determine buffer size based on constraints
-        size_t maxLen = DEFAULT_BUFFER_SIZE - 1;
-        if (descriptor.getConstraints().hasStringConstraints()) {
-            maxLen = std::min(
-                descriptor.getConstraints().maxLength.value(),
-                DEFAULT_BUFFER_SIZE - 1
-            );
-        }
-
-        // Copy current value to buffer
-        std::strncpy(m_buffer, currentStr.c_str(), maxLen);
-        m_buffer[maxLen] = '\0';
+        static const std::string EMPTY;
+        const auto* current = std::get_if<std::string>(&currentValue);
+        const std::string& currentStr = current != nullptr ? *current : EMPTY;
+        const PropertyConstraints& constraints = descriptor.getConstraints();
 
         // Generate unique ID for ImGui
         ImGui::PushID(descriptor.getId().c_str());
@@ -95,25 +101,44 @@ namespace ADS::Inspector::Editors {
         ImGui::NextColumn();
 
         // Widget column
-        bool changed = false;
         if (readOnly) {
             ImGui::BeginDisabled();
         }
 
+        const ImGuiID id = ImGui::GetID("##value");
+        const bool editing = m_editingId == id;
+
+        // Idle fields never write: ImGui copies the text on activation
+        char* buffer = const_cast<char*>(currentStr.c_str());
+        size_t bufferSize = currentStr.size() + 1;
+        ImGuiInputTextFlags flags = ImGuiInputTextFlags_ReadOnly;
+        void* userData = nullptr;
+        if (editing) {
+            buffer = m_editText.data();
+            bufferSize = m_editText.size() + 1;
+            flags = constraints.hasStringConstraints() ? ImGuiInputTextFlags_None : ImGuiInputTextFlags_CallbackResize;
+            userData = &m_editText;
+        }
+
         ImGui::SetNextItemWidth(-1);
-        // Render input field
-        if (ImGui::InputText(
-            "##value",
-            m_buffer,
-            maxLen + 1,
-            ImGuiInputTextFlags_EnterReturnsTrue
-        )) {
-            changed = true;
+        if (constraints.multiline) {
+            const float height = ImGui::GetTextLineHeight() * 4.0f + ImGui::GetStyle().FramePadding.y * 2.0f;
+            ImGui::InputTextMultiline("##value", buffer, bufferSize, ImVec2(-1.0f, height), flags, resizeCallback, userData);
+        } else {
+            ImGui::InputText("##value", buffer, bufferSize, flags, resizeCallback, userData);
         }
 
-        // Also check for deactivation (user finished editing)
-        if (ImGui::IsItemDeactivatedAfterEdit()) {
-            changed = true;
+        bool changed = false;
+        if (!editing && ImGui::IsItemActivated()) {
+            // A maxLength field edits in a fixed buffer that ImGui fills up to the limit
+            m_editText = currentStr;
+            if (constraints.hasStringConstraints()) {
+                m_editText.resize(std::max(constraints.maxLength.value(), currentStr.size()), '\0');
+            }
+            m_editingId = id;
+        } else if (editing && !ImGui::IsItemActive()) {
+            changed = ImGui::IsItemDeactivatedAfterEdit();
+            m_editingId = 0;
         }
 
         if (readOnly) {
@@ -128,8 +153,11 @@ namespace ADS::Inspector::Editors {
         ImGui::Columns(1);
         ImGui::PopID();
 
-        if (changed && std::string(m_buffer) != currentStr) {
-            return EditResult::modified(std::string(m_buffer));
+        if (changed) {
+            m_editText.resize(std::strlen(m_editText.c_str()));
+            if (m_editText != currentStr) {
+                return EditResult::modified(std::move(m_editText));
+            }
         }
 
         return EditResult::unchanged();
@@ -13,6 +13,8 @@
 #ifndef ADS_STRING_EDITOR_H
 #define ADS_STRING_EDITOR_H
 
+#include <cstdint>
+#include <string>
 #include "IPropertyEditor.h"
 
 namespace ADS::Inspector::Editors {
@@ -23,12 +25,18 @@ namespace ADS::Inspector::Editors {
      * @version Jan 2026
      *
      * Renders a text input field for editing string properties.
-     * Respects maxLength constraints if specified.
+     * Respects maxLength constraints if specified, and shows a multi-line
+     * box for properties with the multiline constraint.
+     *
+     * While idle the field displays the property's own string. Clicking
+     * it copies the value once into the edit text, which grows as needed
+     * when no maxLength is set, and the result is committed when the field
+     * loses focus.
      */
     class StringEditor : public IPropertyEditor {
     private:
-        static constexpr size_t DEFAULT_BUFFER_SIZE = 1024;
-        char m_buffer[DEFAULT_BUFFER_SIZE];
+        std::string m_editText;         ///< Text of the field being edited
+        uint32_t m_editingId = 0;       ///< ImGui ID of the field being edited, 0 when idle
 
     public:
         /**
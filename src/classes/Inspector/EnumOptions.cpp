@@ -0,0 +1,76 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file EnumOptions.cpp
+ * @brief Implementation of the EnumOptions class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "EnumOptions.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ADS::Inspector {
+
+    EnumOptions::EnumOptions(std::vector<std::string> options, std::string comboItems)
+        : m_options(std::move(options)), m_comboItems(std::move(comboItems)) {
+    }
+
+    /**
+     * @brief Get the shared table holding the given options
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The combo string identifies the list, since no option name can
+     * contain the '\0' that separates them. The registry is deliberately
+     * leaked so tables outlive any static that still refers to them.
+     *
+     * @param options Option names, in index order
+     * @return const EnumOptions* Table that is never destroyed
+     */
+    const EnumOptions* EnumOptions::intern(std::vector<std::string> options) {
+        static std::mutex mutex;
+        static auto* registry = new std::unordered_map<std::string, std::unique_ptr<EnumOptions>>();
+
+        std::string comboItems;
+        for (const std::string& option : options) {
+            comboItems += option;
+            comboItems += '\0';
+        }
+        comboItems += '\0';
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& table = (*registry)[comboItems];
+        if (!table) {
+            table.reset(new EnumOptions(std::move(options), comboItems));
+        }
+        return table.get();
+    }
+
+    const std::vector<std::string>& EnumOptions::getOptions() const {
+        return m_options;
+    }
+
+    const std::string& EnumOptions::getComboItems() const {
+        return m_comboItems;
+    }
+
+    size_t EnumOptions::size() const {
+        return m_options.size();
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_ENUM_OPTIONS_H
+#define ADS_ENUM_OPTIONS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ADS::Inspector {
+    /**
+     * @brief Interned, immutable list of the options of an enum property
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Enum values refer to their options by pointer, so reading or
+     * copying one never copies the option names. intern() returns the
+     * same table for equal option lists, tables live until the program
+     * exits, and intern() may be called from any thread.
+     */
+    class EnumOptions {
+    private:
+        std::vector<std::string> m_options;
+        std::string m_comboItems;       ///< Options separated and terminated by '\0', as ImGui::Combo() takes them
+
+        explicit EnumOptions(std::vector<std::string> options, std::string comboItems);
+
+    public:
+        EnumOptions(const EnumOptions&) = delete;
+        EnumOptions& operator=(const EnumOptions&) = delete;
+
+        /**
+         * @brief Get the shared table holding the given options
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Call once per option list and keep the pointer; each call looks
+         * the list up under a lock.
+         *
+         * @param options Option names, in index order
+         * @return const EnumOptions* Table that is never destroyed
+         */
+        static const EnumOptions* intern(std::vector<std::string> options);
+
+        /**
+         * @brief Get the option names
+         * @return const std::vector<std::string>& Options, in index order
+         */
+        [[nodiscard]] const std::vector<std::string>& getOptions() const;
+
+        /**
+         * @brief Get the options in the format of ImGui::Combo()
+         * @return const std::string& Options separated and terminated by '\0'
+         */
+        [[nodiscard]] const std::string& getComboItems() const;
+
+        /**
+         * @brief Get the number of options
+         * @return size_t Option count
+         */
+        [[nodiscard]] size_t size() const;
+    };
+}
+
+#endif //ADS_ENUM_OPTIONS_H
@@ -15,7 +15,7 @@
 
 #include <string>
 #include <vector>
-#include "PropertyDescriptor.h"
+#include "PropertySchema.h"
 #include "PropertyValue.h"
 #include "PropertyEvent.h"
 
@@ -65,18 +65,20 @@ namespace ADS::Inspector {
         virtual std::string getDisplayName() const = 0;
 
         /**
-         * @brief Get all property descriptors for this object
+         * @brief Get the property schema of this object's type
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jan 2026
+         * @version Oct 2026
          *
-         * Returns a list of all properties that can be inspected and
-         * edited for this object. The descriptors contain metadata
-         * about each property including type, constraints, and display info.
+         * Returns all properties that can be inspected and edited for
+         * this object, grouped by category. The descriptors contain
+         * metadata about each property including type, constraints, and
+         * display info.
          *
-         * @return std::vector<PropertyDescriptor> List of property descriptors
+         * @return const PropertySchema& Schema shared by all instances of the type,
+         *         valid for the lifetime of the program
          */
-        virtual std::vector<PropertyDescriptor> getPropertyDescriptors() const = 0;
+        virtual const PropertySchema& getPropertySchema() const = 0;
 
         /**
          * @brief Get the value of a property
@@ -55,6 +55,20 @@ namespace ADS::Inspector {
         return constraints;
     }
 
+    /**
+     * @brief Create constraints for text of any length, edited over several lines
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return PropertyConstraints Configured constraints
+     */
+    PropertyConstraints PropertyConstraints::multilineString() {
+        PropertyConstraints constraints;
+        constraints.multiline = true;
+        return constraints;
+    }
+
     /**
      * @brief Create constraints for enum types
      *
@@ -66,7 +80,7 @@ namespace ADS::Inspector {
      */
     PropertyConstraints PropertyConstraints::enumeration(std::vector<std::string> values) {
         PropertyConstraints constraints;
-        constraints.enumValues = std::move(values);
+        constraints.enumOptions = EnumOptions::intern(std::move(values));
         return constraints;
     }
 
@@ -91,9 +105,9 @@ namespace ADS::Inspector {
     /**
      * @brief Check if enum constraints are defined
      *
-     * @return true if enumValues is not empty
+     * @return true if enumOptions holds at least one option
      */
     bool PropertyConstraints::hasEnumConstraints() const {
-        return !enumValues.empty();
+        return enumOptions != nullptr && enumOptions->size() > 0;
     }
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <optional>
 #include <string>
 #include <vector>
+#include "EnumOptions.h"
 
 namespace ADS::Inspector {
     /**
@@ -27,8 +28,8 @@ namespace ADS::Inspector {
      * Defines validation and display constraints for property values.
      * Different constraint types apply to different property types:
      * - Numeric constraints (min, max, step) for Int and Float
-     * - String constraints (maxLength) for String
-     * - Enum constraints (enumValues) for Enum
+     * - String constraints (maxLength, multiline) for String
+     * - Enum constraints (enumOptions) for Enum
      */
     struct PropertyConstraints {
         // Numeric constraints (for Int and Float types)
@@ -38,9 +39,10 @@ namespace ADS::Inspector {
 
         // String constraints
         std::optional<size_t> maxLength;    ///< Maximum string length
+        bool multiline = false;             ///< Edit in a multi-line text box
 
         // Enum constraints
-        std::vector<std::string> enumValues; ///< Available enum options
+        const EnumOptions* enumOptions = nullptr; ///< Available enum options, interned
 
         /**
          * @brief Default constructor
@@ -71,6 +73,16 @@ namespace ADS::Inspector {
          */
         static PropertyConstraints string(size_t maxLen);
 
+        /**
+         * @brief Create constraints for text of any length, edited over several lines
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return PropertyConstraints Configured constraints
+         */
+        static PropertyConstraints multilineString();
+
         /**
          * @brief Create constraints for enum types
          *
@@ -99,7 +111,7 @@ namespace ADS::Inspector {
         /**
          * @brief Check if enum constraints are defined
          *
-         * @return true if enumValues is not empty
+         * @return true if enumOptions holds at least one option
          */
         bool hasEnumConstraints() const;
     };
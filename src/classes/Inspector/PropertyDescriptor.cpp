@@ -135,6 +135,23 @@ namespace ADS::Inspector {
         return *this;
     }
 
+    /**
+     * @brief Mark the property as computed from other properties
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param inputs Ids of the properties the value is derived from
+     * @return PropertyDescriptor& Reference for chaining
+     */
+    PropertyDescriptor &PropertyDescriptor::setComputed(std::vector<std::string> inputs)
+    {
+        m_computedInputs = std::move(inputs);
+        m_readOnly = true;
+
+        return *this;
+    }
+
     /**
      * @brief Set visibility condition callback - lvalue version
      *
@@ -152,6 +169,7 @@ namespace ADS::Inspector {
             )
     {
         m_visibilityCondition = condition;
+        m_visibilityDependencies.clear();
 
         return *this;
     }
@@ -173,6 +191,28 @@ namespace ADS::Inspector {
             )
     {
         m_visibilityCondition = std::move(condition);
+        m_visibilityDependencies.clear();
+
+        return *this;
+    }
+
+    /**
+     * @brief Set a visibility condition that only reads the given properties
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param condition Function that returns true if property should be visible
+     * @param dependsOn Ids of the properties the condition reads
+     * @return PropertyDescriptor& Reference for chaining
+     */
+    PropertyDescriptor &PropertyDescriptor::setVisibilityCondition(
+            std::function<bool(const IInspectable *)> condition,
+            std::vector<std::string> dependsOn
+            )
+    {
+        m_visibilityCondition = std::move(condition);
+        m_visibilityDependencies = std::move(dependsOn);
 
         return *this;
     }
@@ -259,4 +299,24 @@ namespace ADS::Inspector {
         }
         return m_visibilityCondition(target);
     }
+
+    bool PropertyDescriptor::hasVisibilityCondition() const
+    {
+        return static_cast<bool>(m_visibilityCondition);
+    }
+
+    std::span<const std::string> PropertyDescriptor::getVisibilityDependencies() const
+    {
+        return m_visibilityDependencies;
+    }
+
+    bool PropertyDescriptor::isComputed() const
+    {
+        return !m_computedInputs.empty();
+    }
+
+    std::span<const std::string> PropertyDescriptor::getComputedInputs() const
+    {
+        return m_computedInputs;
+    }
 }
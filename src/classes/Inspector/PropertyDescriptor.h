@@ -15,6 +15,9 @@
 
 #include <string>
 #include <functional>
+#include <span>
+#include <string_view>
+#include <vector>
 #include "PropertyType.h"
 #include "PropertyConstraints.h"
 
@@ -22,6 +25,23 @@ namespace ADS::Inspector {
     // Forward declaration
     class IInspectable;
 
+    /**
+     * @brief Transparent hash for containers keyed by property id
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Paired with std::equal_to<> it lets the string_view id of an event
+     * be looked up without building a std::string for it.
+     */
+    struct PropertyIdHash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view id) const noexcept {
+            return std::hash<std::string_view>{}(id);
+        }
+    };
+
     /**
      * @brief Metadata descriptor for a property
      *
@@ -45,6 +65,12 @@ namespace ADS::Inspector {
         /// Optional visibility condition callback
         std::function<bool(const IInspectable*)> m_visibilityCondition;
 
+        /// Properties the visibility condition reads; empty if undeclared
+        std::vector<std::string> m_visibilityDependencies;
+
+        /// Properties a computed property is derived from; empty for stored properties
+        std::vector<std::string> m_computedInputs;
+
     public:
         /**
          * @brief Construct a new PropertyDescriptor
@@ -118,6 +144,23 @@ namespace ADS::Inspector {
          */
         PropertyDescriptor& setReadOnly(bool readOnly = true);
 
+        /**
+         * @brief Mark the property as computed from other properties
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A computed property is read-only and raises no events of its
+         * own: the entity recomputes it on the first read after one of its
+         * inputs changes, and observers learn of the change through the
+         * input's event and PropertySchema::getDependents(). Inputs may be
+         * computed properties themselves.
+         *
+         * @param inputs Ids of the properties the value is derived from
+         * @return PropertyDescriptor& Reference for chaining
+         */
+        PropertyDescriptor& setComputed(std::vector<std::string> inputs);
+
         /**
          * @brief Set visibility condition callback - lvalue version
          *
@@ -150,6 +193,27 @@ namespace ADS::Inspector {
             std::function<bool(const IInspectable*)>&& condition
         );
 
+        /**
+         * @brief Set a visibility condition that only reads the given properties
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Declaring the dependencies lets the inspector keep the result
+         * until one of those properties of the inspected object changes,
+         * instead of calling the condition every frame. A condition that
+         * reads other entities should list the properties of the inspected
+         * object that select them, e.g. the id of a referenced item.
+         *
+         * @param condition Function that returns true if property should be visible
+         * @param dependsOn Ids of the properties the condition reads
+         * @return PropertyDescriptor& Reference for chaining
+         */
+        PropertyDescriptor& setVisibilityCondition(
+            std::function<bool(const IInspectable*)> condition,
+            std::vector<std::string> dependsOn
+        );
+
         // Getters
 
         /**
@@ -207,6 +271,31 @@ namespace ADS::Inspector {
          * @return true if property should be displayed
          */
         bool isVisible(const IInspectable* target) const;
+
+        /**
+         * @brief Check if the property is computed from other properties
+         * @return true if setComputed() was called
+         */
+        [[nodiscard]] bool isComputed() const;
+
+        /**
+         * @brief Get the properties a computed property is derived from
+         * @return std::span<const std::string> Input property ids; empty for stored properties
+         */
+        [[nodiscard]] std::span<const std::string> getComputedInputs() const;
+
+        /**
+         * @brief Check if a visibility condition is set
+         * @return true if isVisible() may return false
+         */
+        [[nodiscard]] bool hasVisibilityCondition() const;
+
+        /**
+         * @brief Get the properties the visibility condition reads
+         * @return std::span<const std::string> Property ids; empty if the condition
+         *         did not declare them and must be evaluated every time
+         */
+        [[nodiscard]] std::span<const std::string> getVisibilityDependencies() const;
     };
 }
 
@@ -50,7 +50,9 @@ namespace ADS::Inspector {
         PropertyType type,
         std::unique_ptr<Editors::IPropertyEditor> editor
     ) {
-        m_typeEditors[type] = std::move(editor);
+        if (static_cast<size_t>(type) < m_typeEditors.size()) {
+            m_typeEditors[static_cast<size_t>(type)] = std::move(editor);
+        }
     }
 
     /**
@@ -96,9 +98,8 @@ namespace ADS::Inspector {
      * @return Editors::IPropertyEditor* Pointer to editor, or nullptr if not found
      */
     Editors::IPropertyEditor* PropertyEditorRegistry::getEditor(PropertyType type) const {
-        auto it = m_typeEditors.find(type);
-        if (it != m_typeEditors.end()) {
-            return it->second.get();
+        if (static_cast<size_t>(type) < m_typeEditors.size()) {
+            return m_typeEditors[static_cast<size_t>(type)].get();
         }
         return nullptr;
     }
@@ -128,6 +129,26 @@ namespace ADS::Inspector {
         return getEditor(descriptor.getType());
     }
 
+    /**
+     * @brief Get the editor of every descriptor of a schema
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The override map is only consulted when there are overrides.
+     *
+     * @param schema Schema to resolve
+     * @return std::vector<Editors::IPropertyEditor*> Editor of each descriptor
+     */
+    std::vector<Editors::IPropertyEditor*> PropertyEditorRegistry::resolveEditors(const PropertySchema& schema) const {
+        std::vector<Editors::IPropertyEditor*> editors;
+        editors.reserve(schema.getDescriptors().size());
+        for (const PropertyDescriptor& descriptor : schema.getDescriptors()) {
+            editors.push_back(m_propertyEditors.empty() ? getEditor(descriptor.getType()) : getEditorForProperty(descriptor));
+        }
+        return editors;
+    }
+
     /**
      * @brief Register all default editors
      *
@@ -153,6 +174,6 @@ namespace ADS::Inspector {
      * @return true if an editor is registered
      */
     bool PropertyEditorRegistry::hasEditor(PropertyType type) const {
-        return m_typeEditors.find(type) != m_typeEditors.end();
+        return getEditor(type) != nullptr;
     }
 }
@@ -13,11 +13,14 @@
 #ifndef ADS_PROPERTY_EDITOR_REGISTRY_H
 #define ADS_PROPERTY_EDITOR_REGISTRY_H
 
+#include <array>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include "PropertyType.h"
 #include "PropertyDescriptor.h"
+#include "PropertySchema.h"
 #include "Editors/IPropertyEditor.h"
 
 namespace ADS::Inspector {
@@ -30,11 +33,15 @@ namespace ADS::Inspector {
      * Manages the mapping between property types and their editors.
      * Supports both type-based and property-ID-based editor lookup
      * for custom editor overrides.
+     *
+     * Type editors are indexed by type directly. Overrides by property ID
+     * are meant to be resolved once per schema with resolveEditors(), so
+     * rendering a row needs no lookup at all.
      */
     class PropertyEditorRegistry {
     private:
-        /// Map of property type to editor
-        std::unordered_map<PropertyType, std::unique_ptr<Editors::IPropertyEditor>> m_typeEditors;
+        /// Editor of each property type, indexed by the type's value
+        std::array<std::unique_ptr<Editors::IPropertyEditor>, PROPERTY_TYPE_COUNT> m_typeEditors;
 
         /// Map of property ID to custom editor (for overrides)
         std::unordered_map<std::string, std::unique_ptr<Editors::IPropertyEditor>> m_propertyEditors;
@@ -130,6 +137,22 @@ namespace ADS::Inspector {
             const PropertyDescriptor& descriptor
         ) const;
 
+        /**
+         * @brief Get the editor of every descriptor of a schema
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Applies the same precedence as getEditorForProperty(). The result
+         * is not updated by later registrations; resolve again after
+         * registering an editor.
+         *
+         * @param schema Schema to resolve
+         * @return std::vector<Editors::IPropertyEditor*> Editor of each descriptor, in
+         *         getDescriptors() order; nullptr where none is registered
+         */
+        [[nodiscard]] std::vector<Editors::IPropertyEditor*> resolveEditors(const PropertySchema& schema) const;
+
         /**
          * @brief Register all default editors
          *
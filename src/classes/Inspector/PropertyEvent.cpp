@@ -20,20 +20,99 @@
 
 #include "PropertyEvent.h"
 
+#include <unordered_set>
+
+#include "PropertyDescriptor.h"
+#include "Core/Profiling.h"
+#include "Core/TraceRecorder.h"
+
 namespace ADS::Inspector {
+    namespace {
+        /**
+         * @brief Drop the buffer of a recycled text value if it grew past the kept capacity
+         */
+        void trimRecycled(PropertyValue& value) {
+            if (auto* text = std::get_if<std::string>(&value);
+                text != nullptr && text->capacity() > TextChangePayload::RECYCLED_TEXT_CAPACITY) {
+                std::string().swap(*text);
+            }
+        }
+    }
+
+    /**
+     * @brief Get a copy of a property id that lives as long as the program
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The set's nodes never move, so views of their strings stay valid.
+     *
+     * @param propertyId Property id
+     * @return std::string_view The interned copy
+     */
+    std::string_view internPropertyId(const std::string_view propertyId) {
+        static std::mutex mutex;
+        static std::unordered_set<std::string, PropertyIdHash, std::equal_to<>> ids;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = ids.find(propertyId);
+        if (it == ids.end()) {
+            it = ids.emplace(propertyId).first;
+        }
+        return *it;
+    }
+
+    thread_local std::vector<std::unique_ptr<TextChangePayload::Slot>> TextChangePayload::s_slots;
+    thread_local size_t TextChangePayload::s_depth = 0;
+
+    /**
+     * @brief Copy a text change into this thread's next free pair
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The pairs always hold text, so assigning keeps their buffers. Each
+     * pair is allocated once, on the first event raised at its depth.
+     *
+     * @param oldText Text before the change
+     * @param newText Text after the change
+     */
+    TextChangePayload::TextChangePayload(const std::string_view oldText, const std::string_view newText) {
+        if (s_depth == s_slots.size()) {
+            s_slots.push_back(std::make_unique<Slot>());
+        }
+        m_slot = s_slots[s_depth++].get();
+        std::get<std::string>(m_slot->oldValue).assign(oldText);
+        std::get<std::string>(m_slot->newValue).assign(newText);
+    }
+
+    TextChangePayload::~TextChangePayload() {
+        trimRecycled(m_slot->oldValue);
+        trimRecycled(m_slot->newValue);
+        --s_depth;
+    }
+
+    const PropertyValue& TextChangePayload::getOldValue() const {
+        return m_slot->oldValue;
+    }
+
+    const PropertyValue& TextChangePayload::getNewValue() const {
+        return m_slot->newValue;
+    }
     /**
      * @brief Construct a new PropertyEventDispatcher
      */
     PropertyEventDispatcher::PropertyEventDispatcher()
-        : m_nextHandle(1) {
+        : m_nextHandle(1),
+          m_queue(nullptr) {
     }
 
     /**
      * @brief Destroy the PropertyEventDispatcher
      *
-     * Clears all subscriptions.
+     * Clears all subscriptions and drops the events still queued for them.
      */
     PropertyEventDispatcher::~PropertyEventDispatcher() {
+        setQueue(nullptr);
         clear();
     }
 
@@ -44,13 +123,11 @@ namespace ADS::Inspector {
      * @version Jan 2026
      *
      * @param callback Function to call when a property changes
+     * @param mode     Whether to call it from dispatch() or from the queue
      * @return SubscriptionHandle Handle for unsubscribing
      */
-    SubscriptionHandle PropertyEventDispatcher::subscribe(const PropertyChangedCallback& callback) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        SubscriptionHandle handle = m_nextHandle++;
-        m_subscribers[handle] = callback;
-        return handle;
+    SubscriptionHandle PropertyEventDispatcher::subscribe(const PropertyChangedCallback& callback, DispatchMode mode) {
+        return subscribe(PropertyChangedCallback(callback), mode);
     }
 
     /**
@@ -59,13 +136,24 @@ namespace ADS::Inspector {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Jan 2026
      *
+     * Copies the current list with the new subscriber appended and
+     * publishes the copy.
+     *
      * @param callback Function to call when a property changes
+     * @param mode     Whether to call it from dispatch() or from the queue
      * @return SubscriptionHandle Handle for unsubscribing
      */
-    SubscriptionHandle PropertyEventDispatcher::subscribe(PropertyChangedCallback&& callback) {
+    SubscriptionHandle PropertyEventDispatcher::subscribe(PropertyChangedCallback&& callback, DispatchMode mode) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        SubscriptionHandle handle = m_nextHandle++;
-        m_subscribers[handle] = std::move(callback);
+        const SubscriptionHandle handle = m_nextHandle++;
+        const std::shared_ptr<const SubscriberList> current = m_subscribers.load(std::memory_order_acquire);
+        auto updated = std::make_shared<SubscriberList>();
+        if (current) {
+            updated->reserve(current->size() + 1);
+            *updated = *current;
+        }
+        updated->push_back({handle, std::move(callback), mode});
+        m_subscribers.store(std::move(updated), std::memory_order_release);
         return handle;
     }
 
@@ -79,7 +167,21 @@ namespace ADS::Inspector {
      */
     void PropertyEventDispatcher::unsubscribe(SubscriptionHandle handle) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        m_subscribers.erase(handle);
+        const std::shared_ptr<const SubscriberList> current = m_subscribers.load(std::memory_order_acquire);
+        if (!current) {
+            return;
+        }
+        auto updated = std::make_shared<SubscriberList>();
+        updated->reserve(current->size());
+        for (const Subscriber& subscriber : *current) {
+            if (subscriber.handle != handle) {
+                updated->push_back(subscriber);
+            }
+        }
+        if (updated->size() == current->size()) {
+            return;
+        }
+        m_subscribers.store(updated->empty() ? nullptr : std::move(updated), std::memory_order_release);
     }
 
     /**
@@ -88,20 +190,49 @@ namespace ADS::Inspector {
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
      * @version Jan 2026
      *
+     * Takes no lock and copies nothing: the loaded list stays alive for
+     * the walk even if a callback subscribes or unsubscribes meanwhile.
+     * Immediate subscribers are called in place; if any subscriber is
+     * deferred, the event is queued once for all of them.
+     *
      * @param event The event to dispatch
      */
     void PropertyEventDispatcher::dispatch(const PropertyChangedEvent& event) {
-        // Copy subscribers to avoid holding lock during callback execution
-        std::unordered_map<SubscriptionHandle, PropertyChangedCallback> subscribersCopy;
-        {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            subscribersCopy = m_subscribers;
+        Core::TraceRecorder::Scope trace("PropertyEventDispatcher::dispatch");
+        ADS_ZONE("PropertyEventDispatcher::dispatch");
+        const std::shared_ptr<const SubscriberList> subscribers = m_subscribers.load(std::memory_order_acquire);
+        if (!subscribers) {
+            return;
         }
 
-        // Dispatch to all subscribers
-        for (const auto& [handle, callback] : subscribersCopy) {
-            if (callback) {
-                callback(event);
+        PropertyEventQueue* queue = m_queue.load(std::memory_order_acquire);
+        bool deferred = false;
+        for (const Subscriber& subscriber : *subscribers) {
+            if (!subscriber.callback) {
+                continue;
+            }
+            if (subscriber.mode == DispatchMode::Deferred && queue != nullptr) {
+                deferred = true;
+            } else {
+                subscriber.callback(event);
+            }
+        }
+        if (deferred) {
+            queue->push(*this, event);
+        }
+    }
+
+    void PropertyEventDispatcher::dispatchDeferred(const PropertyChangedEvent& event) const {
+        Core::TraceRecorder::Scope trace("PropertyEventDispatcher::dispatchDeferred");
+        ADS_ZONE("PropertyEventDispatcher::dispatchDeferred");
+        const std::shared_ptr<const SubscriberList> subscribers = m_subscribers.load(std::memory_order_acquire);
+        if (!subscribers) {
+            return;
+        }
+
+        for (const Subscriber& subscriber : *subscribers) {
+            if (subscriber.mode == DispatchMode::Deferred && subscriber.callback) {
+                subscriber.callback(event);
             }
         }
     }
@@ -112,8 +243,8 @@ namespace ADS::Inspector {
      * @return size_t Number of subscribers
      */
     size_t PropertyEventDispatcher::getSubscriberCount() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_subscribers.size();
+        const std::shared_ptr<const SubscriberList> subscribers = m_subscribers.load(std::memory_order_acquire);
+        return subscribers ? subscribers->size() : 0;
     }
 
     /**
@@ -121,6 +252,135 @@ namespace ADS::Inspector {
      */
     void PropertyEventDispatcher::clear() {
         std::lock_guard<std::mutex> lock(m_mutex);
-        m_subscribers.clear();
+        m_subscribers.store(nullptr, std::memory_order_release);
+    }
+
+    std::weak_ptr<const bool> PropertyEventDispatcher::getLifetime() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_lifetime) {
+            m_lifetime = std::make_shared<const bool>(true);
+        }
+        return m_lifetime;
+    }
+
+    void PropertyEventDispatcher::setQueue(PropertyEventQueue* queue) {
+        PropertyEventQueue* previous = m_queue.exchange(queue, std::memory_order_acq_rel);
+        if (previous != nullptr && previous != queue) {
+            previous->discard(*this);
+        }
+    }
+
+    /**
+     * @brief Queue an event, or fold it into the pending one for the same property
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A burst touches few properties, so a backwards scan finds the
+     * pending entry sooner than hashing the id would. A new entry reuses
+     * a spare one, whose values take the copies into their own buffers
+     * when they hold the same kind of value.
+     *
+     * @param dispatcher Dispatcher whose deferred subscribers get the event
+     * @param event      Change to deliver
+     */
+    void PropertyEventQueue::push(PropertyEventDispatcher& dispatcher, const PropertyChangedEvent& event) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = m_pendingCount; i-- > 0;) {
+            Pending& pending = m_pending[i];
+            if (pending.dispatcher == &dispatcher && pending.propertyId == event.propertyId) {
+                pending.newValue = event.newValue;
+                pending.source = event.source;
+                return;
+            }
+        }
+        if (m_pendingCount == m_pending.size()) {
+            m_pending.emplace_back();
+        }
+        Pending& pending = m_pending[m_pendingCount++];
+        pending.dispatcher = &dispatcher;
+        if (pending.propertyId != event.propertyId) {
+            pending.propertyId = internPropertyId(event.propertyId);
+        }
+        pending.oldValue = event.oldValue;
+        pending.newValue = event.newValue;
+        pending.source = event.source;
+    }
+
+    void PropertyEventQueue::discard(const PropertyEventDispatcher& dispatcher) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Swapped rather than erased, so the dropped entries stay spare with their buffers
+        size_t kept = 0;
+        for (size_t i = 0; i < m_pendingCount; ++i) {
+            if (m_pending[i].dispatcher != &dispatcher) {
+                if (kept != i) {
+                    std::swap(m_pending[kept], m_pending[i]);
+                }
+                ++kept;
+            }
+        }
+        m_pendingCount = kept;
+        for (size_t i = 0; i < m_flushingCount; ++i) {
+            if (m_flushing[i].dispatcher == &dispatcher) {
+                m_flushing[i].dispatcher = nullptr;
+            }
+        }
+    }
+
+    /**
+     * @brief Deliver every pending event to its deferred subscribers
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The batch is moved aside first, so subscribers may raise new events
+     * or destroy entities: a destroyed dispatcher's entries in the batch
+     * are cleared by discard() before they are reached. The delivered
+     * entries become spare for the bursts of the next frames; beyond
+     * RECYCLED_EVENTS of them, and beyond the kept text capacity, their
+     * memory is freed.
+     */
+    void PropertyEventQueue::flush() {
+        Core::TraceRecorder::Scope trace("PropertyEventQueue::flush");
+        ADS_ZONE("PropertyEventQueue::flush");
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_pendingCount == 0 || m_isFlushing) {
+                return;
+            }
+            m_flushing.swap(m_pending);
+            std::swap(m_flushingCount, m_pendingCount);
+            m_isFlushing = true;
+        }
+
+        for (size_t i = 0;; ++i) {
+            PropertyEventDispatcher* dispatcher;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (i >= m_flushingCount) {
+                    if (m_flushing.size() > RECYCLED_EVENTS) {
+                        m_flushing.resize(RECYCLED_EVENTS);
+                    }
+                    for (Pending& pending : m_flushing) {
+                        trimRecycled(pending.oldValue);
+                        trimRecycled(pending.newValue);
+                    }
+                    m_flushingCount = 0;
+                    m_isFlushing = false;
+                    return;
+                }
+                dispatcher = m_flushing[i].dispatcher;
+            }
+            if (dispatcher != nullptr) {
+                const Pending& pending = m_flushing[i];
+                dispatcher->dispatchDeferred(
+                    PropertyChangedEvent(pending.propertyId, pending.oldValue, pending.newValue, pending.source));
+            }
+        }
+    }
+
+    size_t PropertyEventQueue::size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pendingCount;
     }
 }
\ No newline at end of file
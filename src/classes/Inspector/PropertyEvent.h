@@ -14,9 +14,14 @@
 #define ADS_PROPERTY_EVENT_H
 
 #include <string>
+#include <string_view>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <memory>
 #include <mutex>
+#include <vector>
 #include "PropertyValue.h"
 
 namespace ADS::Inspector {
@@ -27,26 +32,99 @@ namespace ADS::Inspector {
      * @brief Event data for property changes
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jan 2026
+     * @version Oct 2026
      *
      * Contains all information about a property change event,
      * including the property identifier, old and new values,
      * and the source object that generated the event.
+     *
+     * The event owns nothing, so raising one copies no id or value: the
+     * values belong to whoever raised it and are valid only while the
+     * subscribers are called. Subscribers that keep a value copy it.
      */
     struct PropertyChangedEvent {
-        std::string propertyId;     ///< The ID of the changed property
-        PropertyValue oldValue;     ///< The previous value
-        PropertyValue newValue;     ///< The new value
-        IInspectable* source;       ///< The object that generated the event
-
-        PropertyChangedEvent() : source(nullptr) {}
+        std::string_view propertyId;    ///< The ID of the changed property; a literal or interned
+        const PropertyValue& oldValue;  ///< The previous value
+        const PropertyValue& newValue;  ///< The new value
+        IInspectable* source;           ///< The object that generated the event
 
         PropertyChangedEvent(
-            std::string id,
-            PropertyValue oldVal,
-            PropertyValue newVal,
+            std::string_view id,
+            const PropertyValue& oldVal,
+            const PropertyValue& newVal,
             IInspectable* src
-        ) : propertyId(std::move(id)), oldValue(std::move(oldVal)), newValue(std::move(newVal)), source(src) {}
+        ) : propertyId(id), oldValue(oldVal), newValue(newVal), source(src) {}
+    };
+
+    /**
+     * @brief Get a copy of a property id that lives as long as the program
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Thread-safe. Ids are few, so the table only grows.
+     *
+     * @param propertyId Property id
+     * @return std::string_view The interned copy; equal ids give the same view
+     */
+    [[nodiscard]] std::string_view internPropertyId(std::string_view propertyId);
+
+    /**
+     * @brief Recycled old and new values of a text property change
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Text is the only kind of property value that allocates; the others
+     * fit in the PropertyValue itself. Each thread keeps a pair of text
+     * values per level of nested notification (a subscriber may change
+     * another property) and the payload copies the texts into its pair,
+     * so once the pair has grown to the length of the texts being edited,
+     * raising a text event allocates nothing.
+     *
+     * Lives on the stack of the setter that raises the event, and is
+     * released in the reverse order it was made.
+     */
+    class TextChangePayload {
+    public:
+        /// Text capacity a pair keeps between events; longer texts are released
+        static constexpr size_t RECYCLED_TEXT_CAPACITY = 1024;
+
+        /**
+         * @brief Copy a text change into this thread's next free pair
+         * @param oldText Text before the change
+         * @param newText Text after the change
+         */
+        TextChangePayload(std::string_view oldText, std::string_view newText);
+
+        /**
+         * @brief Give the pair back for the next text event
+         */
+        ~TextChangePayload();
+
+        TextChangePayload(const TextChangePayload&) = delete;
+        TextChangePayload& operator=(const TextChangePayload&) = delete;
+
+        /**
+         * @brief Get the text before the change, as a property value
+         */
+        [[nodiscard]] const PropertyValue& getOldValue() const;
+
+        /**
+         * @brief Get the text after the change, as a property value
+         */
+        [[nodiscard]] const PropertyValue& getNewValue() const;
+
+    private:
+        struct Slot {
+            PropertyValue oldValue = std::string();
+            PropertyValue newValue = std::string();
+        };
+
+        static thread_local std::vector<std::unique_ptr<Slot>> s_slots;     ///< One pair per nesting level
+        static thread_local size_t s_depth;                                 ///< Pairs in use
+
+        Slot* m_slot;
     };
 
     /**
@@ -59,6 +137,16 @@ namespace ADS::Inspector {
      */
     using SubscriptionHandle = size_t;
 
+    /**
+     * @brief When a subscriber is called
+     */
+    enum class DispatchMode : uint8_t {
+        Immediate,      ///< Inside dispatch(), before the setter returns
+        Deferred        ///< At the next PropertyEventQueue::flush(), once per burst
+    };
+
+    class PropertyEventQueue;
+
     /**
      * @brief Thread-safe event dispatcher for property changes
      *
@@ -69,13 +157,43 @@ namespace ADS::Inspector {
      * to all registered listeners. Each IInspectable object owns
      * its own dispatcher instance.
      *
-     * Thread-safe: All operations are protected by a mutex.
+     * Thread-safe and copy-on-write: subscribe() and unsubscribe()
+     * build a new subscriber list under a mutex and publish it
+     * atomically, while dispatch() only loads the current list and walks
+     * it. A callback that unsubscribes during a dispatch is still called
+     * for that event, since the walk holds the list it started with.
+     * Subscribers are called in subscription order.
+     *
+     * Deferred subscribers are handed to the dispatcher's queue, if
+     * setQueue() gave it one, and are called immediately otherwise.
      */
     class PropertyEventDispatcher {
     private:
-        std::unordered_map<SubscriptionHandle, PropertyChangedCallback> m_subscribers;
+        friend class PropertyEventQueue;
+
+        /**
+         * @brief One registered callback
+         */
+        struct Subscriber {
+            SubscriptionHandle handle;
+            PropertyChangedCallback callback;
+            DispatchMode mode;
+        };
+
+        using SubscriberList = std::vector<Subscriber>;
+
+        std::atomic<std::shared_ptr<const SubscriberList>> m_subscribers;   ///< Published list; empty while nobody subscribed
         SubscriptionHandle m_nextHandle;
-        mutable std::mutex m_mutex;
+        mutable std::mutex m_mutex;                         ///< Serialises writers of m_subscribers and guards m_lifetime
+        mutable std::shared_ptr<const bool> m_lifetime;     ///< Created by the first getLifetime() call
+        std::atomic<PropertyEventQueue*> m_queue;           ///< Where deferred events wait; nullptr calls them at once
+
+        /**
+         * @brief Call the deferred subscribers with a coalesced event
+         *
+         * @param event Event being flushed by the queue
+         */
+        void dispatchDeferred(const PropertyChangedEvent& event) const;
 
     public:
         /**
@@ -103,9 +221,10 @@ namespace ADS::Inspector {
          * @version Jan 2026
          *
          * @param callback Function to call when a property changes
+         * @param mode     Whether to call it from dispatch() or from the queue
          * @return SubscriptionHandle Handle for unsubscribing
          */
-        SubscriptionHandle subscribe(const PropertyChangedCallback& callback);
+        SubscriptionHandle subscribe(const PropertyChangedCallback& callback, DispatchMode mode = DispatchMode::Immediate);
 
         /**
          * @brief Subscribe to property change events - rvalue version
@@ -114,9 +233,10 @@ namespace ADS::Inspector {
          * @version Jan 2026
          *
          * @param callback Function to call when a property changes
+         * @param mode     Whether to call it from dispatch() or from the queue
          * @return SubscriptionHandle Handle for unsubscribing
          */
-        SubscriptionHandle subscribe(PropertyChangedCallback&& callback);
+        SubscriptionHandle subscribe(PropertyChangedCallback&& callback, DispatchMode mode = DispatchMode::Immediate);
 
         /**
          * @brief Unsubscribe from property change events
@@ -149,6 +269,109 @@ namespace ADS::Inspector {
          * @brief Remove all subscribers
          */
         void clear();
+
+        /**
+         * @brief Get a token that expires when this dispatcher is destroyed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Lets a subscriber that may outlive the object check whether it
+         * can still unsubscribe. Only dispatchers asked for a token pay for
+         * one.
+         *
+         * @return std::weak_ptr<const bool> Token, expired once the dispatcher is gone
+         */
+        [[nodiscard]] std::weak_ptr<const bool> getLifetime() const;
+
+        /**
+         * @brief Route deferred subscribers through a queue
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The queue must outlive the dispatcher, or be detached first.
+         *
+         * @param queue Queue to defer to, or nullptr to call deferred subscribers immediately
+         */
+        void setQueue(PropertyEventQueue* queue);
+    };
+
+    /**
+     * @brief Frame-level queue that coalesces deferred property events
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Dragging a slider changes a property once per frame. Listeners that
+     * are expensive and do not need to run inside the setter subscribe as
+     * DispatchMode::Deferred; their events wait here, one per dispatcher
+     * and property, keeping the first old value and the last new value,
+     * until the owner calls flush(), typically once per frame.
+     *
+     * A dispatcher destroyed before the flush takes its pending events
+     * with it. Thread-safe; flush() is meant for the main thread.
+     *
+     * Entries are recycled from frame to frame, so the values of a burst
+     * are copied into buffers that already hold a value of the same kind.
+     */
+    class PropertyEventQueue {
+    private:
+        friend class PropertyEventDispatcher;
+
+        /**
+         * @brief Coalesced event waiting for its dispatcher's deferred subscribers
+         */
+        struct Pending {
+            PropertyEventDispatcher* dispatcher = nullptr;  ///< nullptr once discarded
+            std::string_view propertyId;                    ///< Interned
+            PropertyValue oldValue;
+            PropertyValue newValue;
+            IInspectable* source = nullptr;
+        };
+
+        std::vector<Pending> m_pending;             ///< In order of first change; entries past m_pendingCount are spare
+        std::vector<Pending> m_flushing;            ///< Events being delivered by flush(); likewise
+        size_t m_pendingCount = 0;
+        size_t m_flushingCount = 0;
+        bool m_isFlushing = false;                  ///< Makes a flush() from inside a subscriber a no-op
+        mutable std::mutex m_mutex;
+
+        /**
+         * @brief Queue an event, or fold it into the pending one for the same property
+         */
+        void push(PropertyEventDispatcher& dispatcher, const PropertyChangedEvent& event);
+
+        /**
+         * @brief Drop the events of a dispatcher being destroyed
+         */
+        void discard(const PropertyEventDispatcher& dispatcher);
+
+    public:
+        /// Spare entries kept after a flush; a larger burst frees the rest
+        static constexpr size_t RECYCLED_EVENTS = 64;
+
+        PropertyEventQueue() = default;
+
+        PropertyEventQueue(const PropertyEventQueue&) = delete;
+        PropertyEventQueue& operator=(const PropertyEventQueue&) = delete;
+
+        /**
+         * @brief Deliver every pending event to its deferred subscribers
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Events raised by the subscribers themselves wait for the next
+         * flush, and so does a flush() called from a subscriber.
+         */
+        void flush();
+
+        /**
+         * @brief Get the number of pending coalesced events
+         * @return size_t Events waiting for flush()
+         */
+        [[nodiscard]] size_t size() const;
     };
 }
 
@@ -0,0 +1,162 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file PropertySchema.cpp
+ * @brief Implementation of the PropertySchema class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "PropertySchema.h"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace ADS::Inspector {
+
+    static const std::string DEFAULT_CATEGORY = "General";
+
+    static const std::string& categoryOf(const PropertyDescriptor& descriptor) {
+        return descriptor.getCategory().empty() ? DEFAULT_CATEGORY : descriptor.getCategory();
+    }
+
+    static std::vector<PropertyDescriptor> sortedByCategory(std::vector<PropertyDescriptor> descriptors) {
+        std::stable_sort(descriptors.begin(), descriptors.end(),
+                         [](const PropertyDescriptor& a, const PropertyDescriptor& b) {
+                             return categoryOf(a) < categoryOf(b);
+                         });
+        return descriptors;
+    }
+
+    /**
+     * @brief Build a schema from a type's descriptors
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A stable sort by category groups the descriptors in place; the
+     * categories are then the runs of equal names.
+     *
+     * @param descriptors Descriptors in declaration order
+     */
+    PropertySchema::PropertySchema(std::vector<PropertyDescriptor> descriptors)
+        : m_descriptors(sortedByCategory(std::move(descriptors))),
+          m_validator(m_descriptors) {
+
+        for (size_t begin = 0; begin < m_descriptors.size();) {
+            const std::string& name = categoryOf(m_descriptors[begin]);
+            size_t end = begin + 1;
+            while (end < m_descriptors.size() && categoryOf(m_descriptors[end]) == name) {
+                ++end;
+            }
+            m_categories.push_back({name, std::span<const PropertyDescriptor>(m_descriptors).subspan(begin, end - begin)});
+            begin = end;
+        }
+
+        for (size_t i = 0; i < m_descriptors.size(); ++i) {
+            m_indexes.emplace(m_descriptors[i].getId(), i);
+        }
+        buildDependencyGraph();
+    }
+
+    /**
+     * @brief Build m_dependents from the computed descriptors' inputs
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Sorts the computed descriptors so every one comes after its inputs,
+     * then gives each property the computed descriptors reachable from
+     * it, in that order. Schemas are built once per type, so the quadratic
+     * worst case is paid at startup on a handful of properties.
+     *
+     * @throws std::logic_error If computed properties depend on each other in a cycle
+     */
+    void PropertySchema::buildDependencyGraph() {
+        enum class Mark : uint8_t { None, Visiting, Done };
+        std::vector<Mark> marks(m_descriptors.size(), Mark::None);
+        std::vector<size_t> order;
+
+        const std::function<void(size_t)> visit = [&](size_t index) {
+            if (marks[index] == Mark::Done) {
+                return;
+            }
+            if (marks[index] == Mark::Visiting) {
+                throw std::logic_error("computed property '" + m_descriptors[index].getId() + "' depends on itself");
+            }
+            marks[index] = Mark::Visiting;
+            for (const std::string& input : m_descriptors[index].getComputedInputs()) {
+                if (const auto inputIndex = indexOf(input); inputIndex && m_descriptors[*inputIndex].isComputed()) {
+                    visit(*inputIndex);
+                }
+            }
+            marks[index] = Mark::Done;
+            order.push_back(index);
+        };
+        for (size_t i = 0; i < m_descriptors.size(); ++i) {
+            if (m_descriptors[i].isComputed()) {
+                visit(i);
+            }
+        }
+
+        // In dependency order the inputs' own reads are complete before a property needs them
+        std::unordered_map<size_t, std::vector<std::string_view>> reads;   // computed index → ids it reads, transitively
+        for (const size_t index : order) {
+            std::vector<std::string_view>& own = reads[index];
+            const auto add = [&own](std::string_view id) {
+                if (std::ranges::find(own, id) == own.end()) {
+                    own.push_back(id);
+                }
+            };
+            for (const std::string& input : m_descriptors[index].getComputedInputs()) {
+                add(input);
+                if (const auto inputIndex = indexOf(input); inputIndex && m_descriptors[*inputIndex].isComputed()) {
+                    std::ranges::for_each(reads[*inputIndex], add);
+                }
+            }
+            for (const std::string_view id : own) {
+                m_dependents[std::string(id)].push_back(index);
+            }
+        }
+    }
+
+    std::span<const PropertyDescriptor> PropertySchema::getDescriptors() const {
+        return m_descriptors;
+    }
+
+    std::span<const PropertySchema::Category> PropertySchema::getCategories() const {
+        return m_categories;
+    }
+
+    std::optional<size_t> PropertySchema::indexOf(std::string_view propertyId) const {
+        const auto it = m_indexes.find(propertyId);
+        if (it == m_indexes.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::span<const size_t> PropertySchema::getDependents(std::string_view propertyId) const {
+        const auto it = m_dependents.find(propertyId);
+        if (it == m_dependents.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    const PropertyValidator& PropertySchema::getValidator() const {
+        return m_validator;
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_PROPERTY_SCHEMA_H
+#define ADS_PROPERTY_SCHEMA_H
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "PropertyDescriptor.h"
+#include "PropertyValidator.h"
+
+namespace ADS::Inspector {
+    /**
+     * @brief Immutable set of property descriptors shared by every instance of a type
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Descriptors are the same for every entity of a type, so each type
+     * builds its schema once, as a function-local static, and hands out
+     * references to it. The descriptors are grouped by category when the
+     * schema is built, so the inspector can render a selection without
+     * copying or regrouping anything.
+     *
+     * Categories are ordered by name; descriptors keep their declaration
+     * order within a category. A descriptor without a category is listed
+     * under "General".
+     *
+     * The schema also holds the dependency graph of its computed
+     * properties, closed transitively, so a change to one property tells
+     * at once which computed values are out of date, and the descriptors'
+     * constraints compiled for bulk validation.
+     */
+    class PropertySchema {
+    public:
+        /**
+         * @brief Descriptors sharing a category
+         */
+        struct Category {
+            std::string name;                               ///< Category shown as a header
+            std::span<const PropertyDescriptor> properties; ///< Descriptors of the category
+        };
+
+        /**
+         * @brief Build a schema from a type's descriptors
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param descriptors Descriptors in declaration order
+         */
+        explicit PropertySchema(std::vector<PropertyDescriptor> descriptors);
+
+        // The categories point into m_descriptors
+        PropertySchema(const PropertySchema&) = delete;
+        PropertySchema& operator=(const PropertySchema&) = delete;
+
+        /**
+         * @brief Get every descriptor, grouped by category
+         * @return std::span<const PropertyDescriptor> Descriptors in category order
+         */
+        [[nodiscard]] std::span<const PropertyDescriptor> getDescriptors() const;
+
+        /**
+         * @brief Get the categories and their descriptors
+         * @return std::span<const Category> Categories ordered by name
+         */
+        [[nodiscard]] std::span<const Category> getCategories() const;
+
+        /**
+         * @brief Find the index of a descriptor
+         * @param propertyId Property id
+         * @return std::optional<size_t> Index into getDescriptors(), empty for unknown ids
+         */
+        [[nodiscard]] std::optional<size_t> indexOf(std::string_view propertyId) const;
+
+        /**
+         * @brief Get the computed properties affected by a change
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Includes computed properties that depend on the property through
+         * other computed properties, each once, inputs before the
+         * properties derived from them.
+         *
+         * @param propertyId Id of the changed property
+         * @return std::span<const size_t> Indexes into getDescriptors(); empty if none
+         */
+        [[nodiscard]] std::span<const size_t> getDependents(std::string_view propertyId) const;
+
+        /**
+         * @brief Get the compiled constraints of the descriptors
+         * @return const PropertyValidator& Validator addressing properties by descriptor index
+         */
+        [[nodiscard]] const PropertyValidator& getValidator() const;
+
+    private:
+        std::vector<PropertyDescriptor> m_descriptors;  ///< Grouped by category
+        std::vector<Category> m_categories;
+        std::unordered_map<std::string_view, size_t> m_indexes;            ///< Property id → descriptor index
+        std::unordered_map<std::string, std::vector<size_t>, PropertyIdHash, std::equal_to<>> m_dependents; ///< Property id → computed descriptors, in dependency order
+        PropertyValidator m_validator;                                     ///< Built from m_descriptors once they are grouped
+
+        /**
+         * @brief Build m_dependents from the computed descriptors' inputs
+         */
+        void buildDependencyGraph();
+    };
+}
+
+#endif //ADS_PROPERTY_SCHEMA_H
@@ -0,0 +1,243 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_PROPERTY_TABLE_H
+#define ADS_PROPERTY_TABLE_H
+
+/**
+ * @file PropertyTable.h
+ * @brief Compile-time tables binding property ids to accessors
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The inspector reads every property of the selected entity every frame
+ * through IInspectable::getPropertyValue(). A PropertyTable replaces the
+ * chain of string comparisons an entity would otherwise walk with a
+ * perfect hash computed by the compiler: a lookup hashes the id, indexes
+ * one slot and compares one string.
+ *
+ * @code
+ * using Property = Inspector::PropertyBinding<Scene>;
+ * static constexpr Inspector::PropertyTable SCENE_PROPERTIES({
+ *     Property::of<&Scene::getName, &Scene::setName>("name"),
+ *     Property::of<&Scene::getWidth, &Scene::setWidth>("width"),
+ *     Property::of<&Scene::getId>("id"),                          // read-only
+ * });
+ * @endcode
+ */
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include "PropertyValue.h"
+
+namespace ADS::Inspector {
+
+    namespace detail {
+        /**
+         * @brief Value type taken by a setter member function
+         */
+        template <class Setter>
+        struct SetterArgument;
+
+        template <class Class, class Argument>
+        struct SetterArgument<void (Class::*)(Argument)> {
+            using type = std::remove_cvref_t<Argument>;
+        };
+
+        /**
+         * @brief Seeded FNV-1a hash of a property id
+         */
+        constexpr uint32_t hashPropertyId(std::string_view id, uint32_t seed) {
+            uint32_t hash = 2166136261u ^ seed;
+            for (const char c : id) {
+                hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+            }
+            return hash ^ (hash >> 15);
+        }
+    }
+
+    /**
+     * @brief Accessors of one property of an entity type
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Usually built with of(), which wraps a getter and a setter member
+     * function. Properties needing a conversion, such as enumerations,
+     * can be written out with captureless lambdas instead.
+     *
+     * @tparam Entity Type the accessors are called on
+     */
+    template <class Entity>
+    struct PropertyBinding {
+        using Getter = PropertyValue (*)(const Entity&);
+        using Setter = bool (*)(Entity&, const PropertyValue&);
+
+        std::string_view id;        ///< Property id, as in its PropertyDescriptor
+        Getter get;                 ///< Read the value
+        Setter set;                 ///< Write the value; nullptr for read-only properties
+
+        /**
+         * @brief Bind a property to a getter and, optionally, a setter
+         *
+         * The getter may return the value or a pointer to it, as lazily
+         * loaded texts do. The setter is only called when the incoming
+         * value holds exactly the type it takes.
+         *
+         * @tparam Get Getter member function
+         * @tparam Set Setter member function, or nullptr for a read-only property
+         * @param id   Property id
+         */
+        template <auto Get, auto Set = nullptr>
+        static constexpr PropertyBinding of(std::string_view id) {
+            return {id, &read<Get>, writer<Set>()};
+        }
+
+    private:
+        template <auto Get>
+        static PropertyValue read(const Entity& entity) {
+            decltype(auto) value = std::invoke(Get, entity);
+            if constexpr (requires { *value; }) {
+                return *value;
+            } else {
+                return value;
+            }
+        }
+
+        template <auto Set>
+        static constexpr Setter writer() {
+            if constexpr (std::is_null_pointer_v<decltype(Set)>) {
+                return nullptr;
+            } else {
+                return [](Entity& entity, const PropertyValue& value) {
+                    using Argument = typename detail::SetterArgument<decltype(Set)>::type;
+                    if (const auto* argument = std::get_if<Argument>(&value)) {
+                        std::invoke(Set, entity, *argument);
+                        return true;
+                    }
+                    return false;
+                };
+            }
+        }
+    };
+
+    /**
+     * @brief Perfect-hash dispatch from property ids to their accessors
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The constructor is consteval: it searches for a hash seed under
+     * which every id lands in its own slot, so a duplicate id is a
+     * compile error rather than a property that silently never matches.
+     *
+     * @tparam Entity Type the accessors are called on
+     * @tparam N      Number of properties
+     */
+    template <class Entity, size_t N>
+    class PropertyTable {
+    private:
+        static constexpr size_t SLOT_COUNT = std::bit_ceil(2 * N);    ///< Power of two, at most half full
+
+        std::array<PropertyBinding<Entity>, N> m_bindings{};
+        std::array<uint8_t, SLOT_COUNT> m_slots{};     ///< Binding index + 1, 0 for empty
+        uint32_t m_seed = 0;
+
+    public:
+        static_assert(N > 0 && N < UINT8_MAX, "a property table holds between 1 and 254 properties");
+
+        /**
+         * @brief Build the table and its perfect hash at compile time
+         * @param bindings Properties of the entity, in any order
+         */
+        consteval explicit PropertyTable(const PropertyBinding<Entity> (&bindings)[N]) {
+            for (size_t i = 0; i < N; ++i) {
+                m_bindings[i] = bindings[i];
+                for (size_t j = 0; j < i; ++j) {
+                    if (bindings[i].id == bindings[j].id) {
+                        throw "duplicate property id";
+                    }
+                }
+            }
+
+            for (uint32_t seed = 1; seed != 0; ++seed) {
+                std::array<uint8_t, SLOT_COUNT> slots{};
+                bool collision = false;
+                for (size_t i = 0; i < N && !collision; ++i) {
+                    uint8_t& slot = slots[detail::hashPropertyId(m_bindings[i].id, seed) & (SLOT_COUNT - 1)];
+                    collision = slot != 0;
+                    slot = static_cast<uint8_t>(i + 1);
+                }
+                if (!collision) {
+                    m_slots = slots;
+                    m_seed = seed;
+                    return;
+                }
+            }
+            throw "no perfect hash found";
+        }
+
+        /**
+         * @brief Find the binding of a property
+         * @param id Property id
+         * @return const PropertyBinding<Entity>* nullptr for unknown ids
+         */
+        [[nodiscard]] constexpr const PropertyBinding<Entity>* find(std::string_view id) const {
+            const uint8_t slot = m_slots[detail::hashPropertyId(id, m_seed) & (SLOT_COUNT - 1)];
+            if (slot == 0 || m_bindings[slot - 1].id != id) {
+                return nullptr;
+            }
+            return &m_bindings[slot - 1];
+        }
+
+        /**
+         * @brief Read a property of an entity
+         * @return PropertyValue The value, or std::monostate for unknown ids
+         */
+        [[nodiscard]] PropertyValue get(const Entity& entity, std::string_view id) const {
+            const PropertyBinding<Entity>* binding = find(id);
+            return binding != nullptr ? binding->get(entity) : PropertyValue();
+        }
+
+        /**
+         * @brief Write a property of an entity
+         * @return bool False for unknown or read-only ids, or a value of the wrong type
+         */
+        bool set(Entity& entity, std::string_view id, const PropertyValue& value) const {
+            const PropertyBinding<Entity>* binding = find(id);
+            return binding != nullptr && binding->set != nullptr && binding->set(entity, value);
+        }
+
+        /// Number of properties
+        [[nodiscard]] constexpr size_t size() const {
+            return N;
+        }
+
+        /// Bindings in declaration order
+        [[nodiscard]] constexpr auto begin() const {
+            return m_bindings.begin();
+        }
+
+        [[nodiscard]] constexpr auto end() const {
+            return m_bindings.end();
+        }
+    };
+
+} // namespace ADS::Inspector
+
+#endif // ADS_PROPERTY_TABLE_H
@@ -13,6 +13,8 @@
 #ifndef ADS_PROPERTY_TYPE_H
 #define ADS_PROPERTY_TYPE_H
 
+#include <cstddef>
+
 namespace ADS::Inspector {
     /**
      * @brief Enumeration of supported property types
@@ -34,6 +36,9 @@ namespace ADS::Inspector {
         Enum        ///< Enumeration (selection from predefined values)
     };
 
+    /// Number of PropertyType values, for tables indexed by type
+    inline constexpr size_t PROPERTY_TYPE_COUNT = static_cast<size_t>(PropertyType::Enum) + 1;
+
     /**
      * @brief Get the display name of a property type
      *
@@ -0,0 +1,140 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_PROPERTY_VALIDATOR_H
+#define ADS_PROPERTY_VALIDATOR_H
+
+/**
+ * @file PropertyValidator.h
+ * @brief Constraints of a schema compiled for checking values in bulk
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Editors read a descriptor's PropertyConstraints one value at a time.
+ * Imports and batch edits check many values of the same property at once,
+ * so the validator flattens each descriptor's constraints into a rule of
+ * plain numbers and checks a whole column of values against it in one
+ * pass. Integer and float columns can also be clamped in place, in loops
+ * the compiler vectorises.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+#include "PropertyDescriptor.h"
+#include "PropertyValue.h"
+
+namespace ADS::Inspector {
+
+    /**
+     * @brief Way in which a value breaks its property's constraints
+     */
+    enum class ConstraintViolation : uint8_t {
+        WrongType,      ///< The value does not hold the property's type
+        BelowMinimum,   ///< Number under minValue
+        AboveMaximum,   ///< Number over maxValue
+        TooLong,        ///< String longer than maxLength
+        UnknownOption   ///< Enum index outside the options
+    };
+
+    /**
+     * @brief One violation found in a batch, 8 bytes
+     */
+    struct ConstraintError {
+        uint32_t row;                   ///< Position of the value in the batch, plus the batch's first row
+        uint16_t property;              ///< Index of the descriptor in the schema
+        ConstraintViolation violation;
+    };
+
+    /**
+     * @brief Compiled constraints of every descriptor of a schema
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Built once with the schema and immutable afterwards, so it may be
+     * used from any thread. Properties are addressed by descriptor index,
+     * as returned by PropertySchema::indexOf(). Computed properties are
+     * never validated.
+     */
+    class PropertyValidator {
+    private:
+        /**
+         * @brief Constraints of one property, flattened
+         */
+        struct Rule {
+            PropertyType type = PropertyType::Unknown;
+            float minValue = 0.0f;      ///< Lowest allowed float
+            float maxValue = 0.0f;      ///< Highest allowed float
+            int minInt = 0;             ///< Lowest allowed integer
+            int maxInt = 0;             ///< Highest allowed integer
+            size_t maxLength = 0;       ///< Longest allowed string, in bytes
+            size_t optionCount = 0;     ///< Number of enum options; 0 if unchecked
+        };
+
+        std::vector<Rule> m_rules;      ///< By descriptor index; type Unknown for unchecked properties
+
+    public:
+        /**
+         * @brief Compile the constraints of a schema's descriptors
+         * @param descriptors Descriptors, in schema order
+         */
+        explicit PropertyValidator(std::span<const PropertyDescriptor> descriptors);
+
+        /**
+         * @brief Check one value
+         *
+         * @param property Descriptor index
+         * @param value    Value to check
+         * @return std::optional<ConstraintViolation> The violation, or empty if the value is valid
+         */
+        [[nodiscard]] std::optional<ConstraintViolation> check(size_t property, const PropertyValue& value) const;
+
+        /**
+         * @brief Check a batch of values of one property
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param property Descriptor index
+         * @param values   Values to check, one per row
+         * @param errors   Receives one error per invalid value, in row order
+         * @param firstRow Row number of values[0], so batches can be chained
+         * @return size_t Number of errors appended
+         */
+        size_t validate(size_t property, std::span<const PropertyValue> values,
+                        std::vector<ConstraintError>& errors, uint32_t firstRow = 0) const;
+
+        /**
+         * @brief Clamp integers to a property's range, in place
+         *
+         * @param property Descriptor index of an Int property
+         * @param values   Values to clamp
+         * @return size_t Number of values that were out of range
+         */
+        size_t clamp(size_t property, std::span<int> values) const;
+
+        /**
+         * @brief Clamp floats to a property's range, in place
+         *
+         * @param property Descriptor index of a Float property
+         * @param values   Values to clamp
+         * @return size_t Number of values that were out of range
+         */
+        size_t clamp(size_t property, std::span<float> values) const;
+    };
+}
+
+#endif //ADS_PROPERTY_VALIDATOR_H
@@ -15,24 +15,29 @@
 
 #include <variant>
 #include <string>
+#include <type_traits>
 #include "imgui.h"
+#include "EnumOptions.h"
 #include "PropertyType.h"
 
 namespace ADS::Inspector {
     /**
      * @brief Type alias for enum value storage
      *
-     * Stores the selected index and available options for enum properties.
+     * Stores the selected index and the interned options of an enum
+     * property. Trivially copyable: the option names are never copied.
      */
     struct EnumValue {
         int selectedIndex = 0;
-        std::vector<std::string> options;
+        const EnumOptions* options = nullptr;   ///< Shared option table; nullptr if unknown
 
         EnumValue() = default;
-        EnumValue(int index, std::vector<std::string> opts)
-            : selectedIndex(index), options(std::move(opts)) {}
+        EnumValue(int index, const EnumOptions* opts)
+            : selectedIndex(index), options(opts) {}
     };
 
+    static_assert(std::is_trivially_copyable_v<EnumValue>);
+
     /**
      * @brief Type-safe container for property values
      *
@@ -112,6 +117,34 @@ namespace ADS::Inspector {
         }
         return defaultValue;
     }
+
+    /**
+     * @brief Check whether two PropertyValues hold the same value
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Vectors and colours compare component-wise; enumerations compare
+     * their selected index only, since the options belong to the property.
+     *
+     * @param a First value
+     * @param b Second value
+     * @return true if both hold the same alternative with equal contents
+     */
+    inline bool isSameValue(const PropertyValue& a, const PropertyValue& b) {
+        if (a.index() != b.index()) {
+            return false;
+        }
+        return std::visit([&b](const auto& value) -> bool {
+            using T = std::decay_t<decltype(value)>;
+            const T& other = std::get<T>(b);
+            if constexpr (std::is_same_v<T, std::monostate>) return true;
+            else if constexpr (std::is_same_v<T, ImVec4>) return value.x == other.x && value.y == other.y && value.z == other.z && value.w == other.w;
+            else if constexpr (std::is_same_v<T, ImVec2>) return value.x == other.x && value.y == other.y;
+            else if constexpr (std::is_same_v<T, EnumValue>) return value.selectedIndex == other.selectedIndex;
+            else return value == other;
+        }, a);
+    }
 }
 
 #endif //ADS_PROPERTY_VALUE_H
\ No newline at end of file
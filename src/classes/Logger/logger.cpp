@@ -12,15 +12,48 @@
 
 
 #include "logger.h"
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <ranges>
+#include <string>
 #include <chrono>
+#include <csignal>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 
 std::shared_ptr<spdlog::logger> ADS::Core::Logger::instance = nullptr;
+std::shared_ptr<spdlog::details::thread_pool> ADS::Core::Logger::threadPool = nullptr;
+std::shared_ptr<spdlog::logger> ADS::Core::Logger::crashInstance = nullptr;
+
+namespace {
+    /// Longest onCrash() waits for the logging thread to empty the queue
+    constexpr auto CRASH_DRAIN_TIMEOUT = std::chrono::milliseconds(500);
+
+    /// Set by the first fatal signal; any later one goes straight to the default action
+    std::atomic_flag crashing;
+
+    /// Id of the logging thread, which must not wait for its own queue
+    std::atomic<std::thread::id> loggerThread;
+}
+
+/**
+ * @brief Parse the LOG_OVERFLOW setting
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @param name "block" or "drop_oldest"; anything else is Block
+ * @return LogOverflowPolicy The policy named
+ */
+ADS::Core::LogOverflowPolicy ADS::Core::parseLogOverflowPolicy(const std::string_view name)
+{
+    return name == "drop_oldest" ? LogOverflowPolicy::DropOldest : LogOverflowPolicy::Block;
+}
 
 /**
  * @brief Generate current date string in YYYY-MM-DD format
@@ -52,9 +85,13 @@ std::string ADS::Core::Logger::getDateString()
  * and a rotating log file. The log file is named with the current date
  * and rotates when it reaches 5MB. Creates the logs/ directory if needed.
  *
- * @see getInstance()
+ * The sinks are driven by one logging thread fed through a bounded queue.
+ * Errors are flushed as soon as the thread writes them, and the crash
+ * signals flush whatever is still queued before the program dies.
+ *
+ * @see getInstance(), shutdown()
  */
-void ADS::Core::Logger::init(const bool useStdout)
+void ADS::Core::Logger::init(const bool useStdout, const LogOverflowPolicy overflow, const size_t queueSize)
 {
     std::vector<spdlog::sink_ptr> sinks;
 
@@ -78,10 +115,133 @@ void ADS::Core::Logger::init(const bool useStdout)
         sinks.push_back(stderr_sink);
     }
 
-    instance = std::make_shared<spdlog::logger>("ADS", sinks.begin(), sinks.end());
+    threadPool = std::make_shared<spdlog::details::thread_pool>(
+        queueSize > 0 ? queueSize : DEFAULT_QUEUE_SIZE, 1, [] { loggerThread = std::this_thread::get_id(); });
+    instance = std::make_shared<spdlog::async_logger>(
+        "ADS", sinks.begin(), sinks.end(), threadPool,
+        overflow == LogOverflowPolicy::DropOldest ? spdlog::async_overflow_policy::overrun_oldest
+                                                  : spdlog::async_overflow_policy::block);
+    instance->flush_on(spdlog::level::err);
+    crashInstance = std::make_shared<spdlog::async_logger>(
+        "ADS", sinks.begin(), sinks.end(), threadPool, spdlog::async_overflow_policy::overrun_oldest);
+    crashInstance->flush_on(spdlog::level::err);
+
+    constexpr std::array<const char*, LOG_CHANNEL_COUNT> channelNames = {"i18n", "project", "ui", "io"};
+    for (size_t channel = 0; channel < LOG_CHANNEL_COUNT; ++channel) {
+        channels[channel] = instance->clone(channelNames[channel]);
+        channels[channel]->set_level(spdlog::level::trace);
+    }
 
     spdlog::set_default_logger(instance);
     spdlog::set_level(spdlog::level::trace);
+
+    for (const int signal : {SIGSEGV, SIGABRT, SIGFPE, SIGILL}) {
+        std::signal(signal, &Logger::onCrash);
+    }
+}
+
+/**
+ * @brief Set the runtime level of the channels listed
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Unknown channel names and levels are reported and skipped.
+ *
+ * @param levels Comma separated channel=level pairs
+ */
+void ADS::Core::Logger::setLevels(const std::string_view levels)
+{
+    for (const auto part : std::views::split(levels, ',')) {
+        const std::string_view pair(part.begin(), part.end());
+        const size_t equals = pair.find('=');
+        if (equals == std::string_view::npos) {
+            continue;
+        }
+        const std::string_view name = pair.substr(0, equals);
+        const std::string levelName(pair.substr(equals + 1));
+        const spdlog::level::level_enum level = spdlog::level::from_str(levelName);
+        // from_str() maps anything unknown to off, which must be asked for by name
+        if (level == spdlog::level::off && levelName != "off") {
+            spdlog::warn("LOG_LEVELS: unknown level '{}'", levelName);
+            continue;
+        }
+
+        const auto channel = std::ranges::find_if(channels, [name](const auto& logger) {
+            return logger != nullptr && logger->name() == name;
+        });
+        if (channel == channels.end()) {
+            spdlog::warn("LOG_LEVELS: unknown channel '{}'", name);
+            continue;
+        }
+        (*channel)->set_level(level);
+    }
+}
+
+/**
+ * @brief Drain the queue and stop the logging thread
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Destroying the thread pool makes its thread write every message still
+ * queued before it exits, so nothing logged before this call is lost.
+ *
+ * @see init()
+ */
+void ADS::Core::Logger::shutdown()
+{
+    if (instance == nullptr) {
+        return;
+    }
+    instance->flush();
+    spdlog::shutdown();
+    channels = {};
+    crashInstance.reset();
+    instance.reset();
+    threadPool.reset();
+}
+
+/**
+ * @brief Flush the log when the program crashes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Not async-signal-safe, so this is a best effort: the messages that led
+ * to the crash are the most useful ones, and the process is dying anyway.
+ * Nothing here may wait without a bound. The report goes through
+ * crashInstance, which never waits for room in the queue. The logging
+ * thread is waited for at most CRASH_DRAIN_TIMEOUT and is never joined.
+ * Nothing is waited for when the logging thread itself crashed, or when
+ * a fault hits while another is being handled. In every case the default
+ * action is restored and the signal raised again, so the crash still
+ * produces its core dump and exit status.
+ *
+ * @param signal Signal that stopped the program
+ */
+void ADS::Core::Logger::onCrash(const int signal)
+{
+    std::signal(signal, SIG_DFL);
+
+    if (!crashing.test_and_set() && crashInstance != nullptr && std::this_thread::get_id() != loggerThread.load()) {
+        crashInstance->critical("Fatal signal {}", signal);
+
+        const auto deadline = std::chrono::steady_clock::now() + CRASH_DRAIN_TIMEOUT;
+        bool drained = false;
+        while (!(drained = threadPool->queue_size() == 0) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // Only the logging thread writes to the sinks, so their locks wait at most for its last message
+        if (drained) {
+            for (const spdlog::sink_ptr &sink : crashInstance->sinks()) {
+                sink->flush();
+            }
+        }
+    }
+
+    std::raise(signal);
 }
 
 /**
@@ -14,9 +14,42 @@
 #ifndef ADS_LOGGER_H
 #define ADS_LOGGER_H
 
+#include <array>
+#include <cstddef>
+#include <string_view>
+
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 
 namespace ADS::Core {
+    /**
+     * @brief What a log call does when the logging queue is full
+     */
+    enum class LogOverflowPolicy {
+        Block,          ///< Wait for the logging thread to make room; nothing is lost
+        DropOldest      ///< Overwrite the oldest queued message; never waits
+    };
+
+    /**
+     * @brief Parse the LOG_OVERFLOW setting
+     *
+     * @param name "block" or "drop_oldest"; anything else is Block
+     * @return LogOverflowPolicy The policy named
+     */
+    LogOverflowPolicy parseLogOverflowPolicy(std::string_view name);
+
+    /**
+     * @brief Subsystem a message comes from, each with its own runtime level
+     */
+    enum class LogChannel : size_t {
+        I18n,           ///< Translations and catalogues, "i18n"
+        Project,        ///< Project open, save and autosave, "project"
+        Ui,             ///< Windows, fonts, panels and rendering, "ui"
+        Io,             ///< Files read and written by the editor, "io"
+    };
+
+    inline constexpr size_t LOG_CHANNEL_COUNT = 4; ///< Number of LogChannel values
+
     /**
      * @brief Singleton logger facade for spdlog integration
      *
@@ -31,6 +64,11 @@ namespace ADS::Core {
      * excessive disk usage while maintaining comprehensive logging for debugging
      * and monitoring purposes.
      *
+     * Logging is asynchronous: a log call formats the message and queues it,
+     * and a dedicated thread writes the queue to the sinks, so the frame
+     * loop never waits on the disk or the console. The queue is flushed on
+     * shutdown() and, as far as possible, when the process crashes.
+     *
      * @note This class follows the singleton pattern with static members only
      * @see spdlog::logger
      */
@@ -42,6 +80,25 @@ namespace ADS::Core {
          */
         static std::shared_ptr<spdlog::logger> instance;
 
+        /**
+         * Queue and thread of the logger, owned here because the logger
+         * only keeps a weak reference to them
+         */
+        static std::shared_ptr<spdlog::details::thread_pool> threadPool;
+
+        /**
+         * Logger used by onCrash(), on the sinks and thread of instance but
+         * overwriting the oldest message instead of waiting for a full queue
+         */
+        static std::shared_ptr<spdlog::logger> crashInstance;
+
+        /**
+         * Logger of each channel, sharing the sinks and thread of instance.
+         * Inline so code that only logs, such as the i18n library, does
+         * not need this class' translation unit.
+         */
+        inline static std::array<std::shared_ptr<spdlog::logger>, LOG_CHANNEL_COUNT> channels;
+
         /**
          * @brief Get the current date as a formatted string
          *
@@ -55,7 +112,22 @@ namespace ADS::Core {
          */
         static std::string getDateString();
 
+        /**
+         * @brief Write the queued messages and re-raise a fatal signal
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param signal Signal that stopped the program
+         */
+        static void onCrash(int signal);
+
     public:
+        /**
+         * Default number of messages the queue holds before the overflow policy applies
+         */
+        static constexpr size_t DEFAULT_QUEUE_SIZE = 8192;
+
         /**
          * @brief Initialize the logger with console and file sinks
          *
@@ -71,10 +143,25 @@ namespace ADS::Core {
          * Must be called once during application startup before any logging occurs.
          *
          * @param outputStream Configuration string (use ALL_CONSOLE for debug mode, "" for production)
+         * @param overflow     What log calls do when the queue is full
+         * @param queueSize    Number of messages the queue holds
          *
          * @note Subsequent calls have no effect as the instance is already initialized
          */
-        static void init(const bool useStdout = false);
+        static void init(const bool useStdout = false,
+                         LogOverflowPolicy overflow = LogOverflowPolicy::Block,
+                         size_t queueSize = DEFAULT_QUEUE_SIZE);
+
+        /**
+         * @brief Write the queued messages and stop the logging thread
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Must be the last logging related call of the program: spdlog has
+         * no default logger afterwards.
+         */
+        static void shutdown();
 
         /**
          * @brief Get the logger instance
@@ -93,7 +180,92 @@ namespace ADS::Core {
          */
         static std::shared_ptr<spdlog::logger> getInstance();
 
+        /**
+         * @brief Get the logger of a subsystem
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Before init(), and in programs that never call it, this is the
+         * spdlog default logger.
+         *
+         * @param channel Subsystem logging
+         * @return spdlog::logger* Its logger
+         * @see ADS_LOG_INFO()
+         */
+        static spdlog::logger* get(const LogChannel channel)
+        {
+            spdlog::logger* logger = channels[static_cast<size_t>(channel)].get();
+            return logger != nullptr ? logger : spdlog::default_logger_raw();
+        }
+
+        /**
+         * @brief Set the runtime level of some channels
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Takes the LOG_LEVELS setting, a comma separated list such as
+         * "i18n=debug,io=trace". Channels not listed keep their level.
+         * Levels below the one compiled in (SPDLOG_ACTIVE_LEVEL) have no
+         * effect, since those calls are gone from the binary.
+         *
+         * @param levels List of channel=level pairs
+         */
+        static void setLevels(std::string_view levels);
+
     };
 }
 
+/**
+ * @brief Log to a channel, compiled out below SPDLOG_ACTIVE_LEVEL
+ *
+ * The channel is a LogChannel value name: ADS_LOG_DEBUG(Io, "read {}", path).
+ * Calls that are compiled in evaluate and format their arguments only when
+ * the channel's runtime level lets the message through.
+ */
+#define ADS_LOG_CALL(channel, level, ...)                                                                   \
+    do {                                                                                                    \
+        spdlog::logger* adsLogger = ::ADS::Core::Logger::get(::ADS::Core::LogChannel::channel);             \
+        if (adsLogger->should_log(level)) {                                                                 \
+            adsLogger->log(spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, level, __VA_ARGS__);   \
+        }                                                                                                   \
+    } while (false)
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define ADS_LOG_TRACE(channel, ...) ADS_LOG_CALL(channel, spdlog::level::trace, __VA_ARGS__)
+#else
+#define ADS_LOG_TRACE(channel, ...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define ADS_LOG_DEBUG(channel, ...) ADS_LOG_CALL(channel, spdlog::level::debug, __VA_ARGS__)
+#else
+#define ADS_LOG_DEBUG(channel, ...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define ADS_LOG_INFO(channel, ...) ADS_LOG_CALL(channel, spdlog::level::info, __VA_ARGS__)
+#else
+#define ADS_LOG_INFO(channel, ...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+#define ADS_LOG_WARN(channel, ...) ADS_LOG_CALL(channel, spdlog::level::warn, __VA_ARGS__)
+#else
+#define ADS_LOG_WARN(channel, ...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+#define ADS_LOG_ERROR(channel, ...) ADS_LOG_CALL(channel, spdlog::level::err, __VA_ARGS__)
+#else
+#define ADS_LOG_ERROR(channel, ...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_CRITICAL
+#define ADS_LOG_CRITICAL(channel, ...) ADS_LOG_CALL(channel, spdlog::level::critical, __VA_ARGS__)
+#else
+#define ADS_LOG_CRITICAL(channel, ...) (void)0
+#endif
+
 #endif //ADVENTURE_DESIGNER_STUDIO_LOGGER_H
\ No newline at end of file
@@ -0,0 +1,181 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file GameState.cpp
+ * @brief Implementation of the GameState and StateHistory classes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "GameState.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace ADS::Runtime {
+
+    namespace {
+        constexpr size_t DIRECTORY_SLOTS = GameState::PAGE_SIZE * GameState::DIRECTORY_SIZE;
+
+        std::atomic<uint64_t> lastEpoch{0};     ///< Epoch 0 is the nil pages', never written in place
+    }
+
+    uint64_t GameState::nextEpoch() {
+        return lastEpoch.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    GameState::Snapshot::Snapshot(std::shared_ptr<const Root> root)
+        : m_root(std::move(root)) {
+    }
+
+    Value GameState::Snapshot::get(const size_t slot) const {
+        const Directory& directory = *m_root->directories[slot / DIRECTORY_SLOTS];
+        return directory.pages[slot / PAGE_SIZE % DIRECTORY_SIZE]->values[slot % PAGE_SIZE];
+    }
+
+    size_t GameState::Snapshot::size() const {
+        return m_root ? m_root->size : 0;
+    }
+
+    GameState::GameState(const size_t size)
+        : m_root(std::make_shared<Root>()),
+          m_nilPage(std::make_shared<Page>()),
+          m_epoch(nextEpoch()) {
+        m_root->epoch = m_epoch;
+        grow(size);
+    }
+
+    size_t GameState::size() const {
+        return m_root->size;
+    }
+
+    size_t GameState::grow(const size_t count) {
+        if (m_root->epoch != m_epoch) {
+            m_root = std::make_shared<Root>(*m_root);
+            m_root->epoch = m_epoch;
+        }
+        const size_t first = m_root->size;
+        m_root->size += count;
+        while (m_root->directories.size() * DIRECTORY_SLOTS < m_root->size) {
+            auto directory = std::make_shared<Directory>();
+            directory->epoch = m_epoch;
+            directory->pages.fill(m_nilPage);
+            m_root->directories.push_back(std::move(directory));
+        }
+        return first;
+    }
+
+    GameState::Snapshot GameState::snapshot() {
+        // Everything written so far now belongs to the snapshot too
+        m_epoch = nextEpoch();
+        return Snapshot(m_root);
+    }
+
+    void GameState::restore(const Snapshot& snapshot) {
+        // Safe to drop const: the snapshot's nodes are of epochs no longer current anywhere, so they are copied before any write
+        m_root = std::const_pointer_cast<Root>(snapshot.m_root);
+        m_epoch = nextEpoch();
+    }
+
+    void GameState::getChangedPages(const Snapshot& since, std::vector<size_t>& pages) const {
+        pages.clear();
+        if (!since.isValid() || since.m_root == m_root) {
+            return;
+        }
+        const auto& before = since.m_root->directories;
+        const auto& after = m_root->directories;
+        // A directory one side lacks, grown since or gone by a restore(), reads as nil pages
+        const auto pageOf = [this](const std::vector<std::shared_ptr<Directory>>& directories, const size_t d, const size_t p) {
+            return d < directories.size() ? directories[d]->pages[p].get() : m_nilPage.get();
+        };
+        for (size_t d = 0; d < std::max(before.size(), after.size()); ++d) {
+            if (d < before.size() && d < after.size() && before[d] == after[d]) {
+                continue;
+            }
+            for (size_t p = 0; p < DIRECTORY_SIZE; ++p) {
+                if (pageOf(before, d, p) != pageOf(after, d, p)) {
+                    pages.push_back((d * DIRECTORY_SIZE + p) * PAGE_SIZE);
+                }
+            }
+        }
+    }
+
+    uint64_t GameState::getCopiedPages() const {
+        return m_copiedPages;
+    }
+
+    GameState::Page& GameState::writablePage(const size_t slot) {
+        if (m_root->epoch != m_epoch) {
+            m_root = std::make_shared<Root>(*m_root);
+            m_root->epoch = m_epoch;
+        }
+        std::shared_ptr<Directory>& directory = m_root->directories[slot / DIRECTORY_SLOTS];
+        if (directory->epoch != m_epoch) {
+            directory = std::make_shared<Directory>(*directory);
+            directory->epoch = m_epoch;
+        }
+        std::shared_ptr<Page>& page = directory->pages[slot / PAGE_SIZE % DIRECTORY_SIZE];
+        if (page->epoch != m_epoch) {
+            page = std::make_shared<Page>(*page);
+            page->epoch = m_epoch;
+            ++m_copiedPages;
+        }
+        return *page;
+    }
+
+    StateHistory::StateHistory(const size_t capacity)
+        : m_capacity(capacity) {
+    }
+
+    void StateHistory::record(GameState& state, std::string label) {
+        if (m_capacity == 0) {
+            return;
+        }
+        if (m_entries.size() == m_capacity) {
+            m_entries.pop_front();
+        }
+        m_entries.push_back({std::move(label), state.snapshot()});
+    }
+
+    bool StateHistory::stepBack(GameState& state) {
+        if (m_entries.empty()) {
+            return false;
+        }
+        state.restore(m_entries.back().snapshot);
+        m_entries.pop_back();
+        return true;
+    }
+
+    bool StateHistory::restartFrom(GameState& state, const size_t index) {
+        if (index >= m_entries.size()) {
+            return false;
+        }
+        state.restore(m_entries[index].snapshot);
+        m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(index), m_entries.end());
+        return true;
+    }
+
+    const StateHistory::Entry& StateHistory::at(const size_t index) const {
+        return m_entries[index];
+    }
+
+    size_t StateHistory::size() const {
+        return m_entries.size();
+    }
+
+    void StateHistory::clear() {
+        m_entries.clear();
+    }
+}
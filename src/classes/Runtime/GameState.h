@@ -0,0 +1,247 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_GAME_STATE_H
+#define ADS_RUNTIME_GAME_STATE_H
+
+/**
+ * @file GameState.h
+ * @brief Copy-on-write storage of a running game, and the debugger's history of it
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The state of a game session (its variables, the inventory, the runtime
+ * properties of its entities) is an array of Values split in pages of 64.
+ * A snapshot shares every page with the live state; the first write to a
+ * page afterwards copies that page alone. Taking a snapshot is O(1) and
+ * the action that follows pays for the pages it touches, so the debugger
+ * can keep one per action and step back or restart from any of them
+ * without replaying the game.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Value.h"
+
+namespace ADS::Runtime {
+
+    /**
+     * @brief Array of values with O(1) snapshots
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A three-level tree: a root lists directories of 64 pages, and pages
+     * hold 64 values. Every node records the epoch it was written in, and
+     * taking a snapshot starts a new epoch: a node of an older epoch may be
+     * shared with a snapshot, so it is copied, along with the path to it,
+     * before its first write. The path is the page, its directory and the
+     * root's list of directories, one pointer per 4096 values. Pages
+     * nobody wrote share one page of nils, so a large, sparse world costs
+     * little until it is used.
+     *
+     * Reading and writing are not thread-safe; a Snapshot is immutable and
+     * may be read from any thread.
+     */
+    class GameState {
+    public:
+        static constexpr size_t PAGE_SIZE = 64;             ///< Values per page
+        static constexpr size_t DIRECTORY_SIZE = 64;        ///< Pages per directory
+
+    private:
+        struct Page {
+            uint64_t epoch = 0;
+            std::array<Value, PAGE_SIZE> values{};
+        };
+
+        struct Directory {
+            uint64_t epoch = 0;
+            std::array<std::shared_ptr<Page>, DIRECTORY_SIZE> pages;
+        };
+
+        struct Root {
+            uint64_t epoch = 0;
+            size_t size = 0;
+            std::vector<std::shared_ptr<Directory>> directories;
+        };
+
+    public:
+        /**
+         * @brief Frozen state, to restore later
+         */
+        class Snapshot {
+        public:
+            Snapshot() = default;
+
+            /**
+             * @brief Read a value as it was when the snapshot was taken
+             */
+            [[nodiscard]] Value get(size_t slot) const;
+
+            [[nodiscard]] size_t size() const;
+
+            [[nodiscard]] bool isValid() const {
+                return m_root != nullptr;
+            }
+
+        private:
+            friend class GameState;
+
+            explicit Snapshot(std::shared_ptr<const Root> root);
+
+            std::shared_ptr<const Root> m_root;
+        };
+
+        /**
+         * @brief Create a state of nils
+         *
+         * @param size Slots, e.g. the globals of a Program
+         */
+        explicit GameState(size_t size = 0);
+
+        /**
+         * @brief Read a slot
+         */
+        [[nodiscard]] Value get(const size_t slot) const {
+            const Directory& directory = *m_root->directories[slot / (PAGE_SIZE * DIRECTORY_SIZE)];
+            return directory.pages[slot / PAGE_SIZE % DIRECTORY_SIZE]->values[slot % PAGE_SIZE];
+        }
+
+        /**
+         * @brief Write a slot, copying its page first if a snapshot shares it
+         */
+        void set(const size_t slot, const Value value) {
+            writablePage(slot).values[slot % PAGE_SIZE] = value;
+        }
+
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Add slots of nil, e.g. for the properties of the entities
+         * @return size_t First slot added
+         */
+        size_t grow(size_t count);
+
+        /**
+         * @brief Freeze the current state; O(1)
+         */
+        Snapshot snapshot();
+
+        /**
+         * @brief Go back to a snapshot; O(1)
+         *
+         * The snapshot may come from another state with the same slots,
+         * e.g. another session of the same Program on another thread:
+         * epochs are unique across states, so its nodes are copied before
+         * any write like this state's own.
+         */
+        void restore(const Snapshot& snapshot);
+
+        /**
+         * @brief List the pages written since a snapshot of this state
+         *
+         * Compares the two trees: a directory or page still shared with the
+         * snapshot was not written, so it is skipped without reading its
+         * values, and the cost is one pointer compare per directory plus
+         * one per page of the directories written. A page may be listed
+         * and still hold the same values, e.g. if a write stored the value
+         * it replaced. Slots grown since the snapshot are nil until
+         * written, so they are listed once written, like any other; pages
+         * a restore() dropped are listed if they held anything.
+         *
+         * @param since Snapshot of this state
+         * @param pages Receives the first slot of each page, in order; cleared first
+         */
+        void getChangedPages(const Snapshot& since, std::vector<size_t>& pages) const;
+
+        /**
+         * @brief Get the pages copied by writes after snapshots, since the state was created
+         */
+        [[nodiscard]] uint64_t getCopiedPages() const;
+
+    private:
+        std::shared_ptr<Root> m_root;
+        std::shared_ptr<Page> m_nilPage;        ///< Shared by every page never written; epoch 0, so never written in place
+        uint64_t m_epoch;                       ///< Epoch of the nodes this state may write in place
+        uint64_t m_copiedPages = 0;
+
+        /**
+         * @brief Start an epoch no state has used; thread-safe
+         */
+        static uint64_t nextEpoch();
+
+        /**
+         * @brief Get the page of a slot, copied into the current epoch if needed
+         */
+        Page& writablePage(size_t slot);
+    };
+
+    /**
+     * @brief Snapshots of a game session, one per action, for the debugger
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The debugger records the state before each action the player takes.
+     * Stepping back restores the state before the last action. Restarting
+     * from an entry restores the state before its action and forgets it and
+     * the later entries, which the actions played from there record anew.
+     * The oldest entries are dropped beyond the capacity.
+     */
+    class StateHistory {
+    public:
+        /**
+         * @brief An action and the state before it
+         */
+        struct Entry {
+            std::string label;                  ///< E.g. the command the player typed
+            GameState::Snapshot snapshot;
+        };
+
+        explicit StateHistory(size_t capacity = 4096);
+
+        /**
+         * @brief Record the state before an action
+         */
+        void record(GameState& state, std::string label);
+
+        /**
+         * @brief Undo the last recorded action
+         * @return bool False if nothing was recorded
+         */
+        bool stepBack(GameState& state);
+
+        /**
+         * @brief Restore the state before an entry's action and forget that entry and the later ones
+         * @return bool False if the index is out of range
+         */
+        bool restartFrom(GameState& state, size_t index);
+
+        [[nodiscard]] const Entry& at(size_t index) const;
+        [[nodiscard]] size_t size() const;
+        void clear();
+
+    private:
+        std::deque<Entry> m_entries;
+        size_t m_capacity;
+    };
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_GAME_STATE_H
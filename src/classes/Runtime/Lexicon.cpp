@@ -0,0 +1,228 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file Lexicon.cpp
+ * @brief Implementation of the Lexicon and LexiconBuilder classes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "Lexicon.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace ADS::Runtime {
+
+    namespace {
+
+        uint8_t foldCase(const char c) {
+            return static_cast<uint8_t>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+        }
+
+        /**
+         * @brief State of the uncompressed trie LexiconBuilder starts from
+         */
+        struct TrieState {
+            bool accepting = false;
+            std::vector<std::pair<uint8_t, uint32_t>> children;     ///< By byte, to trie states
+        };
+    }
+
+    bool isWordSeparator(const char c) {
+        switch (c) {
+            case ' ': case '\t': case '\n': case '\r': case '\v': case '\f':
+            case '.': case ',': case ';': case ':': case '!': case '?':
+            case '"': case '(': case ')': case '[': case ']': case '-':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    uint32_t Lexicon::step(const uint32_t state, const uint8_t byte, uint32_t& index) const {
+        const State& from = m_states[state];
+        const Edge* first = m_edges.data() + from.firstEdge;
+        const Edge* last = first + from.edgeCount;
+        const Edge* edge = std::lower_bound(first, last, byte, [](const Edge& e, const uint8_t b) {
+            return e.byte < b;
+        });
+        if (edge == last || edge->byte != byte) {
+            return NO_STATE;
+        }
+        index += edge->skipped;
+        return edge->target;
+    }
+
+    std::optional<WordMeaning> Lexicon::find(const std::string_view word) const {
+        if (m_states.empty()) {
+            return std::nullopt;
+        }
+        uint32_t state = 0;
+        uint32_t index = 0;
+        for (const char c : word) {
+            state = step(state, foldCase(c), index);
+            if (state == NO_STATE) {
+                return std::nullopt;
+            }
+        }
+        if (!m_states[state].accepting) {
+            return std::nullopt;
+        }
+        return m_meanings[index];
+    }
+
+    size_t Lexicon::tokenize(const std::string_view phrase, const std::span<WordToken> tokens) const {
+        size_t count = 0;
+        size_t start = 0;
+        bool inWord = false;
+        uint32_t state = 0;
+        uint32_t index = 0;
+
+        const auto finish = [&](const size_t end) {
+            if (count < tokens.size()) {
+                WordToken& token = tokens[count];
+                token.meaning = state != NO_STATE && m_states[state].accepting ? m_meanings[index] : WordMeaning{};
+                token.offset = static_cast<uint32_t>(start);
+                token.length = static_cast<uint32_t>(end - start);
+            }
+            ++count;
+            inWord = false;
+        };
+
+        for (size_t i = 0; i < phrase.size(); ++i) {
+            const char c = phrase[i];
+            if (isWordSeparator(c)) {
+                if (inWord) {
+                    finish(i);
+                }
+                continue;
+            }
+            if (!inWord) {
+                inWord = true;
+                start = i;
+                state = m_states.empty() ? NO_STATE : 0;
+                index = 0;
+            }
+            if (state != NO_STATE) {
+                state = step(state, foldCase(c), index);
+            }
+        }
+        if (inWord) {
+            finish(phrase.size());
+        }
+        return count;
+    }
+
+    size_t Lexicon::size() const {
+        return m_meanings.size();
+    }
+
+    size_t Lexicon::stateCount() const {
+        return m_states.size();
+    }
+
+    bool LexiconBuilder::add(const std::string_view word, const WordCategory category, const uint32_t conceptId) {
+        if (word.empty() || std::ranges::any_of(word, isWordSeparator)) {
+            return false;
+        }
+        std::string folded(word.size(), '\0');
+        std::ranges::transform(word, folded.begin(), [](const char c) {
+            return static_cast<char>(foldCase(c));
+        });
+        m_entries.push_back({std::move(folded), {category, conceptId}});
+        return true;
+    }
+
+    Lexicon LexiconBuilder::build() {
+        std::ranges::stable_sort(m_entries, {}, &Entry::word);
+        const auto duplicates = std::ranges::unique(m_entries, {}, &Entry::word);
+        m_entries.erase(duplicates.begin(), duplicates.end());
+
+        Lexicon lexicon;
+        lexicon.m_meanings.reserve(m_entries.size());
+
+        // The plain trie; words arrive sorted, so children are appended in byte order
+        std::vector<TrieState> trie(1);
+        for (const Entry& entry : m_entries) {
+            uint32_t state = 0;
+            for (const char c : entry.word) {
+                const auto byte = static_cast<uint8_t>(c);
+                auto& children = trie[state].children;
+                if (children.empty() || children.back().first != byte) {
+                    children.emplace_back(byte, static_cast<uint32_t>(trie.size()));
+                    trie.emplace_back();
+                }
+                state = trie[state].children.back().second;
+            }
+            trie[state].accepting = true;
+            lexicon.m_meanings.push_back(entry.meaning);
+        }
+
+        // Merge equivalent states bottom-up. Children always have higher
+        // numbers than their parent, so walking backwards sees them first.
+        // Two states are equivalent when they accept alike and have the same
+        // transitions to already merged states; the signature spells that out.
+        std::vector<uint32_t> merged(trie.size());
+        std::vector<uint32_t> wordsBelow;           // By merged state
+        std::unordered_map<std::string, uint32_t> registry;
+        std::vector<Lexicon::State> states;
+        std::vector<std::vector<Lexicon::Edge>> edges;
+        std::string signature;
+
+        for (size_t i = trie.size(); i-- > 0;) {
+            const TrieState& node = trie[i];
+            signature.assign(1, node.accepting ? '\1' : '\0');
+            for (const auto& [byte, child] : node.children) {
+                signature.push_back(static_cast<char>(byte));
+                signature.append(reinterpret_cast<const char*>(&merged[child]), sizeof(uint32_t));
+            }
+
+            const auto [it, added] = registry.try_emplace(signature, static_cast<uint32_t>(states.size()));
+            if (added) {
+                uint32_t words = node.accepting ? 1 : 0;
+                std::vector<Lexicon::Edge> out;
+                out.reserve(node.children.size());
+                for (const auto& [byte, child] : node.children) {
+                    out.push_back({merged[child], words, byte});
+                    words += wordsBelow[merged[child]];
+                }
+                states.push_back({0, static_cast<uint16_t>(out.size()), node.accepting});
+                edges.push_back(std::move(out));
+                wordsBelow.push_back(words);
+            }
+            merged[i] = it->second;
+        }
+
+        // Number the states so the start is 0, and lay the edges out flat
+        const auto last = static_cast<uint32_t>(states.size() - 1);     // The root was merged last
+        const auto renumber = [last](const uint32_t state) {
+            return last - state;
+        };
+        lexicon.m_states.resize(states.size());
+        for (uint32_t state = 0; state < states.size(); ++state) {
+            Lexicon::State& out = lexicon.m_states[renumber(state)];
+            out = states[state];
+            out.firstEdge = static_cast<uint32_t>(lexicon.m_edges.size());
+            for (Lexicon::Edge edge : edges[state]) {
+                edge.target = renumber(edge.target);
+                lexicon.m_edges.push_back(edge);
+            }
+        }
+
+        m_entries.clear();
+        return lexicon;
+    }
+}
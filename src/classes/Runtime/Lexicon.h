@@ -0,0 +1,207 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_LEXICON_H
+#define ADS_RUNTIME_LEXICON_H
+
+/**
+ * @file Lexicon.h
+ * @brief Words the player command parser understands, in one language
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The words are stored as a minimal acyclic automaton (a DAWG): a trie
+ * whose identical suffix subtrees are shared, so "take", "shake" and
+ * "make" keep one "ake". Each state also knows how many words lie below
+ * it, which numbers the words 0..n-1 in sorted order while walking them:
+ * a minimal perfect hash that indexes the table of meanings, where each
+ * synonym points at its canonical word. Looking a word up costs one
+ * transition per byte, whatever the size of the lexicon.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ADS::Runtime {
+
+    /**
+     * @brief Grammatical role of a word in player commands
+     */
+    enum class WordCategory : uint8_t {
+        Unknown,        ///< Not in the lexicon
+        Verb,
+        Noun,
+        Adjective,
+        Preposition,
+        Article,
+        Pronoun,
+        Conjunction
+    };
+
+    /**
+     * @brief What a word means: its category and the concept it names
+     */
+    struct WordMeaning {
+        WordCategory category = WordCategory::Unknown;
+        uint32_t conceptId = 0;      ///< Creator-assigned id shared by a word and its synonyms
+    };
+
+    /**
+     * @brief One word of a phrase, as found by Lexicon::tokenize()
+     */
+    struct WordToken {
+        WordMeaning meaning;        ///< Unknown category if the word is not in the lexicon
+        uint32_t offset = 0;        ///< Byte offset in the phrase
+        uint32_t length = 0;        ///< Bytes
+    };
+
+    /**
+     * @brief Immutable word list of one language, built by LexiconBuilder
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Matching ignores the case of ASCII letters; other letters, such as
+     * the accented ones of UTF-8 text, must match as written. Any number
+     * of threads may read a lexicon at once.
+     */
+    class Lexicon {
+    public:
+        /**
+         * @brief Look a word up
+         *
+         * @param word A single word, in any ASCII case
+         * @return std::optional<WordMeaning> Its meaning, or nothing if it is not in the lexicon
+         */
+        [[nodiscard]] std::optional<WordMeaning> find(std::string_view word) const;
+
+        /**
+         * @brief Split a phrase into words and look each one up, in one pass
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Words are separated by ASCII spaces and punctuation. Allocates
+         * nothing: each byte of the phrase is read once and drives at most
+         * one transition of the automaton.
+         *
+         * @param phrase Text typed by the player
+         * @param tokens Receives the words in order; words past its size are counted but not stored
+         * @return size_t Number of words in the phrase
+         */
+        size_t tokenize(std::string_view phrase, std::span<WordToken> tokens) const;
+
+        /**
+         * @brief Get the number of words
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Get the number of automaton states, to see how much sharing saved
+         */
+        [[nodiscard]] size_t stateCount() const;
+
+    private:
+        friend class LexiconBuilder;
+
+        /**
+         * @brief State of the automaton; its transitions are m_edges[firstEdge, firstEdge + edgeCount)
+         */
+        struct State {
+            uint32_t firstEdge = 0;
+            uint16_t edgeCount = 0;
+            bool accepting = false;     ///< A word ends here
+        };
+
+        /**
+         * @brief Transition on one byte
+         */
+        struct Edge {
+            uint32_t target;
+            uint32_t skipped;           ///< Words ordered before those reached through this edge, counted from the state
+            uint8_t byte;
+        };
+
+        std::vector<State> m_states;            ///< m_states[0] is the start
+        std::vector<Edge> m_edges;              ///< Sorted by byte within each state
+        std::vector<WordMeaning> m_meanings;    ///< By perfect hash, i.e. in sorted word order
+
+        /**
+         * @brief Follow the transition on a byte
+         * @return uint32_t Target state, or NO_STATE
+         */
+        [[nodiscard]] uint32_t step(uint32_t state, uint8_t byte, uint32_t& index) const;
+
+        static constexpr uint32_t NO_STATE = UINT32_MAX;
+    };
+
+    /**
+     * @brief Collects the words of a language and builds their Lexicon
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @code
+     * LexiconBuilder builder;
+     * builder.add("take", WordCategory::Verb, TAKE);
+     * builder.add("get", WordCategory::Verb, TAKE);      // synonym
+     * builder.add("lamp", WordCategory::Noun, LAMP);
+     * Lexicon english = builder.build();
+     * @endcode
+     */
+    class LexiconBuilder {
+    public:
+        /**
+         * @brief Add a word
+         *
+         * @param word     One word without spaces or punctuation
+         * @param category Its role
+         * @param conceptId Id of what it names; synonyms share it
+         * @return bool False if the word is empty or has a separator in it
+         */
+        bool add(std::string_view word, WordCategory category, uint32_t conceptId);
+
+        /**
+         * @brief Build the automaton of the words added so far
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A word added twice keeps its first meaning.
+         *
+         * @return Lexicon The lexicon; the builder is left empty
+         */
+        Lexicon build();
+
+    private:
+        struct Entry {
+            std::string word;           ///< ASCII letters lower case
+            WordMeaning meaning;
+        };
+
+        std::vector<Entry> m_entries;
+    };
+
+    /**
+     * @brief Check whether a byte separates words
+     */
+    [[nodiscard]] bool isWordSeparator(char c);
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_LEXICON_H
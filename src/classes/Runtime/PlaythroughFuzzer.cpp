@@ -0,0 +1,541 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file PlaythroughFuzzer.cpp
+ * @brief Implementation of the PlaythroughFuzzer class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "PlaythroughFuzzer.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <utility>
+
+#include "Core/JobSystem.h"
+#include "Core/TraceRecorder.h"
+#include "Program.h"
+#include "VirtualMachine.h"
+
+namespace ADS::Runtime {
+
+    /**
+     * @brief A machine and what it found
+     */
+    struct PlaythroughFuzzer::Worker {
+        VirtualMachine machine;
+        std::mt19937_64 random;
+        Findings& findings;
+        std::vector<Node> successors;       ///< Reused by each expansion
+        std::vector<bool> isNew;            ///< Reused by each expansion
+
+        Worker(const Program& program, const uint64_t seed, Findings& found)
+            : machine(program), random(seed), findings(found) {
+        }
+    };
+
+    PlaythroughFuzzer::PlaythroughFuzzer(const Program& program, Options options)
+        : m_program(program),
+          m_options(std::move(options)),
+          m_shards(SHARDS) {
+    }
+
+    uint64_t PlaythroughFuzzer::hash(const GameState& state) {
+        uint64_t hash = 0x9E3779B97F4A7C15ull ^ state.size();
+        for (size_t slot = 0; slot < state.size(); ++slot) {
+            hash = (hash ^ state.get(slot).bits()) * 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 32;
+        }
+        return hash;
+    }
+
+    std::vector<std::string> PlaythroughFuzzer::resolve() {
+        std::vector<std::string> errors;
+        const auto findFunction = [&](const std::string& name) {
+            const Function* function = m_program.findFunction(name);
+            if (function == nullptr || function->parameterCount != 0) {
+                errors.push_back(std::format("'{}' is not a function of no arguments", name));
+                return NO_FUNCTION;
+            }
+            return static_cast<uint16_t>(function - m_program.functions.data());
+        };
+
+        if (m_options.commands.empty()) {
+            errors.emplace_back("No commands to play");
+        }
+        m_commands.clear();
+        for (const std::string& command : m_options.commands) {
+            m_commands.push_back(findFunction(command));
+        }
+        m_won = m_options.won.empty() ? NO_FUNCTION : findFunction(m_options.won);
+        if (!m_options.start.empty()) {
+            findFunction(m_options.start);
+        }
+
+        m_sceneSlot = SIZE_MAX;
+        if (!m_options.scene.empty()) {
+            const auto it = std::ranges::find(m_program.globals, m_options.scene);
+            if (it == m_program.globals.end()) {
+                errors.push_back(std::format("'{}' is not a global", m_options.scene));
+            } else {
+                m_sceneSlot = static_cast<size_t>(it - m_program.globals.begin());
+            }
+        }
+        m_sceneIndex.clear();
+        for (size_t index = 0; index < m_options.scenes.size(); ++index) {
+            m_sceneIndex.emplace(m_options.scenes[index].bits(), index);
+        }
+        return errors;
+    }
+
+    bool PlaythroughFuzzer::visit(const uint64_t hash) {
+        Shard& shard = m_shards[hash % SHARDS];
+        const std::scoped_lock lock(shard.mutex);
+        return shard.states.try_emplace(hash, false).second;
+    }
+
+    bool PlaythroughFuzzer::claim(const uint64_t hash) {
+        Shard& shard = m_shards[hash % SHARDS];
+        const std::scoped_lock lock(shard.mutex);
+        bool& claimed = shard.states[hash];
+        return !std::exchange(claimed, true);
+    }
+
+    bool PlaythroughFuzzer::stopping() {
+        if (!m_stop.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() >= m_deadline) {
+            m_stop.store(true, std::memory_order_relaxed);
+        }
+        return m_stop.load(std::memory_order_relaxed);
+    }
+
+    bool PlaythroughFuzzer::startPlaythrough() {
+        if (stopping()) {
+            return false;
+        }
+        const uint64_t started = m_playthroughs.fetch_add(1, std::memory_order_relaxed);
+        if (m_options.maxPlaythroughs != 0 && started >= m_options.maxPlaythroughs) {
+            m_playthroughs.fetch_sub(1, std::memory_order_relaxed);
+            m_stop.store(true, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    PlaythroughFuzzer::Finding PlaythroughFuzzer::toFinding(const std::shared_ptr<const Trail>& trail, std::string message) {
+        Finding finding;
+        finding.message = std::move(message);
+        for (const Trail* step = trail.get(); step != nullptr; step = step->parent.get()) {
+            finding.path.push_back(step->command);
+        }
+        std::ranges::reverse(finding.path);
+        return finding;
+    }
+
+    void PlaythroughFuzzer::expand(Worker& worker, const Node& node, std::vector<Node>& successors, std::vector<bool>& isNew) {
+        successors.clear();
+        isNew.clear();
+        const bool claimed = claim(node.hash);
+        Findings& findings = worker.findings;
+        GameState& state = worker.machine.getState();
+
+        for (uint16_t command = 0; command < m_commands.size(); ++command) {
+            state.restore(node.snapshot);
+            const Result result = worker.machine.call(m_commands[command]);
+            ++findings.commands;
+            if (!result.ok()) {
+                if (claimed && findings.failureCount++ < m_options.maxFindings) {
+                    findings.failures.push_back(toFinding(std::make_shared<const Trail>(node.trail, command), result.message));
+                }
+                continue;
+            }
+            const uint64_t hash = PlaythroughFuzzer::hash(state);
+            if (hash == node.hash) {
+                continue;
+            }
+
+            Node successor;
+            successor.hash = hash;
+            successor.depth = node.depth + 1;
+            successor.trail = std::make_shared<const Trail>(node.trail, command);
+            if (m_sceneSlot != SIZE_MAX) {
+                const auto scene = m_sceneIndex.find(state.get(m_sceneSlot).bits());
+                if (scene != m_sceneIndex.end()) {
+                    findings.reachedScenes[scene->second] = true;
+                }
+            }
+            if (m_won != NO_FUNCTION) {
+                const Result won = worker.machine.call(m_won);
+                successor.won = won.ok() && won.value.isTruthy();
+            }
+            successor.snapshot = state.snapshot();
+            const bool added = visit(hash);
+            if (added && successor.won) {
+                ++findings.wins;
+            }
+            successors.push_back(std::move(successor));
+            isNew.push_back(added);
+        }
+
+        if (claimed && successors.empty() && findings.softLockCount++ < m_options.maxFindings) {
+            findings.softLocks.push_back(toFinding(node.trail));
+        }
+        if (claimed && m_options.strategy == Strategy::BreadthFirst) {
+            GraphNode& graphNode = findings.graph.emplace_back();
+            graphNode.hash = node.hash;
+            graphNode.trail = node.trail;
+            for (const Node& successor : successors) {
+                graphNode.successors.push_back(successor.hash);
+            }
+        }
+    }
+
+    /**
+     * @brief Play walks from the start, or from the corpus, until the fuzzer stops
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A walk ends at a won state, at maxDepth, or where it has nowhere to
+     * go: no command changes anything, or, for CoverageGuided, nothing
+     * new comes out. The new states a CoverageGuided walk passes by are
+     * kept to start later walks from, so the frontier of what was seen
+     * keeps being pushed instead of replayed from the start.
+     */
+    void PlaythroughFuzzer::walk(Worker& worker) {
+        const bool coverage = m_options.strategy == Strategy::CoverageGuided;
+        Node node;
+        while (startPlaythrough()) {
+            ++worker.findings.playthroughs;
+            node = Node{m_initial, nullptr, m_initialHash, 0, false};
+            if (coverage) {
+                const std::scoped_lock lock(m_nodesMutex);
+                if (!m_corpus.empty()) {
+                    const size_t pick = std::uniform_int_distribution<size_t>(0, m_corpus.size() - 1)(worker.random);
+                    node = std::move(m_corpus[pick]);
+                    m_corpus[pick] = std::move(m_corpus.back());
+                    m_corpus.pop_back();
+                }
+            }
+
+            while (node.depth < m_options.maxDepth && !node.won && !stopping()) {
+                expand(worker, node, worker.successors, worker.isNew);
+                if (worker.successors.empty()) {
+                    break;
+                }
+                size_t next = 0;
+                if (coverage) {
+                    std::vector<size_t> fresh;
+                    for (size_t index = 0; index < worker.successors.size(); ++index) {
+                        if (worker.isNew[index]) {
+                            fresh.push_back(index);
+                        }
+                    }
+                    if (fresh.empty()) {
+                        break;
+                    }
+                    const size_t pick = std::uniform_int_distribution<size_t>(0, fresh.size() - 1)(worker.random);
+                    next = fresh[pick];
+                    const std::scoped_lock lock(m_nodesMutex);
+                    for (const size_t index : fresh) {
+                        if (index == next || worker.successors[index].won) {
+                            continue;
+                        }
+                        if (m_corpus.size() < CORPUS_SIZE) {
+                            m_corpus.push_back(std::move(worker.successors[index]));
+                        } else {
+                            m_corpus[std::uniform_int_distribution<size_t>(0, CORPUS_SIZE - 1)(worker.random)] =
+                                std::move(worker.successors[index]);
+                        }
+                    }
+                } else {
+                    next = std::uniform_int_distribution<size_t>(0, worker.successors.size() - 1)(worker.random);
+                }
+                node = std::move(worker.successors[next]);
+            }
+        }
+    }
+
+    /**
+     * @brief Expand the states depth by depth, with the other workers, until none is left
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The states of a depth are handed out one at a time; the new states
+     * they lead to make the next depth, which starts once the last worker
+     * is done with the current one, so a state is always reached first by
+     * one of its shortest paths.
+     */
+    void PlaythroughFuzzer::breadthFirst(Worker& worker) {
+        std::vector<Node> fresh;
+        std::unique_lock lock(m_nodesMutex);
+        for (;;) {
+            if (m_finished) {
+                return;
+            }
+            if (m_frontierHead == m_frontier.size()) {
+                if (m_expanding > 0) {
+                    m_frontierDone.wait(lock);
+                    continue;
+                }
+                // Last one out of this depth moves on to the next
+                m_frontier = std::move(m_nextFrontier);
+                m_nextFrontier.clear();
+                m_frontierHead = 0;
+                ++m_depth;
+                if (m_frontier.empty() || m_stop.load(std::memory_order_relaxed)) {
+                    m_truncated = m_truncated || !m_frontier.empty();
+                    m_finished = true;
+                    m_frontierDone.notify_all();
+                    return;
+                }
+                m_frontierDone.notify_all();
+                continue;
+            }
+
+            Node node = std::move(m_frontier[m_frontierHead++]);
+            if (node.won) {
+                lock.unlock();
+                if (claim(node.hash)) {
+                    GraphNode& graphNode = worker.findings.graph.emplace_back();
+                    graphNode.hash = node.hash;
+                    graphNode.won = true;
+                    graphNode.trail = node.trail;
+                }
+                lock.lock();
+                continue;
+            }
+            if (node.depth >= m_options.maxDepth || !startPlaythrough()) {
+                m_truncated = true;
+                m_frontierHead = m_frontier.size();
+                continue;
+            }
+            ++m_expanding;
+            lock.unlock();
+
+            ++worker.findings.playthroughs;
+            expand(worker, node, worker.successors, worker.isNew);
+            fresh.clear();
+            for (size_t index = 0; index < worker.successors.size(); ++index) {
+                if (worker.isNew[index]) {
+                    fresh.push_back(std::move(worker.successors[index]));
+                }
+            }
+
+            lock.lock();
+            std::ranges::move(fresh, std::back_inserter(m_nextFrontier));
+            if (--m_expanding == 0 && m_frontierHead == m_frontier.size()) {
+                m_frontierDone.notify_all();
+            }
+        }
+    }
+
+    void PlaythroughFuzzer::work(const size_t index, Findings& findings) {
+        Worker worker(m_program, m_options.seed + index * 0x9E3779B97F4A7C15ull, findings);
+        if (m_options.setup) {
+            m_options.setup(worker.machine);
+        }
+        worker.machine.setInstructionLimit(m_options.instructionLimit);
+        if (m_options.strategy == Strategy::BreadthFirst) {
+            breadthFirst(worker);
+        } else {
+            walk(worker);
+        }
+    }
+
+    /**
+     * @brief Find the states of the recorded graph that no path leads from to a won state
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Walks the edges backwards from every won state; what the walk does
+     * not reach cannot be won. Findings are the shortest paths first, the
+     * states closest to the start being the ones a player hits soonest.
+     */
+    void PlaythroughFuzzer::findUnwinnable(std::vector<Findings>& findings, Report& report) const {
+        std::vector<GraphNode*> nodes;
+        std::unordered_map<uint64_t, uint32_t> indices;
+        for (Findings& found : findings) {
+            for (GraphNode& node : found.graph) {
+                indices.emplace(node.hash, static_cast<uint32_t>(nodes.size()));
+                nodes.push_back(&node);
+            }
+        }
+
+        std::vector<std::vector<uint32_t>> predecessors(nodes.size());
+        std::vector<uint32_t> queue;
+        std::vector<bool> canWin(nodes.size(), false);
+        for (uint32_t index = 0; index < nodes.size(); ++index) {
+            for (const uint64_t successor : nodes[index]->successors) {
+                const auto it = indices.find(successor);
+                if (it != indices.end()) {
+                    predecessors[it->second].push_back(index);
+                }
+            }
+            if (nodes[index]->won) {
+                canWin[index] = true;
+                queue.push_back(index);
+            }
+        }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (const uint32_t predecessor : predecessors[queue[head]]) {
+                if (!canWin[predecessor]) {
+                    canWin[predecessor] = true;
+                    queue.push_back(predecessor);
+                }
+            }
+        }
+
+        for (uint32_t index = 0; index < nodes.size(); ++index) {
+            if (!canWin[index]) {
+                ++report.unwinnableCount;
+                report.unwinnable.push_back(toFinding(nodes[index]->trail));
+            }
+        }
+        std::ranges::stable_sort(report.unwinnable, {}, [](const Finding& finding) { return finding.path.size(); });
+        if (report.unwinnable.size() > m_options.maxFindings) {
+            report.unwinnable.resize(m_options.maxFindings);
+        }
+    }
+
+    /**
+     * @brief Play until a limit is reached or, for BreadthFirst, every state was expanded
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The start is played once, here, and every worker restores its
+     * snapshot: GameState epochs are unique across states, so a snapshot
+     * taken by one machine can be restored into another's state.
+     */
+    PlaythroughFuzzer::Report PlaythroughFuzzer::run(Core::JobSystem* jobs) {
+        Core::TraceRecorder::Scope trace("PlaythroughFuzzer::run");
+        const auto begin = std::chrono::steady_clock::now();
+        Report report;
+        report.errors = resolve();
+        if (!report.errors.empty()) {
+            return report;
+        }
+
+        m_deadline = begin + m_options.timeLimit;
+        m_stop = false;
+        m_playthroughs = 0;
+        for (Shard& shard : m_shards) {
+            shard.states.clear();
+        }
+        m_frontier.clear();
+        m_nextFrontier.clear();
+        m_corpus.clear();
+        m_frontierHead = 0;
+        m_expanding = 0;
+        m_depth = 0;
+        m_truncated = false;
+        m_finished = false;
+
+        const size_t workerCount = jobs == nullptr ? 1
+            : m_options.workers != 0 ? m_options.workers
+            : std::max(1u, std::thread::hardware_concurrency());
+        std::vector<Findings> findings(workerCount);
+        for (Findings& found : findings) {
+            found.reachedScenes.assign(m_options.scenes.size(), false);
+        }
+
+        {
+            VirtualMachine machine(m_program);
+            if (m_options.setup) {
+                m_options.setup(machine);
+            }
+            machine.setInstructionLimit(m_options.instructionLimit);
+            if (!m_options.start.empty()) {
+                const Result result = machine.call(m_options.start);
+                if (!result.ok()) {
+                    report.errors.push_back(std::format("'{}' failed: {}", m_options.start, result.message));
+                    return report;
+                }
+            }
+            Node initial;
+            initial.hash = m_initialHash = hash(machine.getState());
+            if (m_won != NO_FUNCTION) {
+                const Result won = machine.call(m_won);
+                initial.won = won.ok() && won.value.isTruthy();
+                report.wins = initial.won ? 1 : 0;
+            }
+            if (m_sceneSlot != SIZE_MAX) {
+                const auto scene = m_sceneIndex.find(machine.getState().get(m_sceneSlot).bits());
+                if (scene != m_sceneIndex.end()) {
+                    findings[0].reachedScenes[scene->second] = true;
+                }
+            }
+            initial.snapshot = m_initial = machine.getState().snapshot();
+            visit(initial.hash);
+            m_frontier.push_back(std::move(initial));
+        }
+
+        if (jobs == nullptr) {
+            work(0, findings[0]);
+        } else {
+            std::vector<Core::JobSystem::JobHandle> handles;
+            for (size_t index = 0; index < workerCount; ++index) {
+                handles.push_back(jobs->submit([this, index, &findings] { work(index, findings[index]); }));
+            }
+            for (const Core::JobSystem::JobHandle& handle : handles) {
+                jobs->wait(handle);
+            }
+        }
+
+        std::vector<bool> reached(m_options.scenes.size(), false);
+        for (Findings& found : findings) {
+            report.playthroughs += found.playthroughs;
+            report.commands += found.commands;
+            report.wins += found.wins;
+            report.softLockCount += found.softLockCount;
+            report.failureCount += found.failureCount;
+            for (Finding& finding : found.softLocks) {
+                if (report.softLocks.size() < m_options.maxFindings) {
+                    report.softLocks.push_back(std::move(finding));
+                }
+            }
+            for (Finding& finding : found.failures) {
+                if (report.failures.size() < m_options.maxFindings) {
+                    report.failures.push_back(std::move(finding));
+                }
+            }
+            for (size_t index = 0; index < reached.size(); ++index) {
+                reached[index] = reached[index] || found.reachedScenes[index];
+            }
+        }
+        for (size_t index = 0; index < reached.size(); ++index) {
+            if (!reached[index]) {
+                report.unreachedScenes.push_back(m_options.scenes[index]);
+            }
+        }
+        for (const Shard& shard : m_shards) {
+            report.states += shard.states.size();
+        }
+
+        report.exhausted = m_options.strategy == Strategy::BreadthFirst && m_finished && !m_truncated;
+        if (report.exhausted && m_won != NO_FUNCTION) {
+            findUnwinnable(findings, report);
+        }
+        m_frontier.clear();
+        m_corpus.clear();
+        report.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+        return report;
+    }
+}
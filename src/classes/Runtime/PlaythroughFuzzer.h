@@ -0,0 +1,306 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_PLAYTHROUGH_FUZZER_H
+#define ADS_RUNTIME_PLAYTHROUGH_FUZZER_H
+
+/**
+ * @file PlaythroughFuzzer.h
+ * @brief Headless play-throughs of a game on every core, looking for dead ends
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A game is its Program and the functions the player's commands call.
+ * Playing every command from a state and looking at the states that come
+ * out is cheap with GameState snapshots, so many machines sharing the
+ * Program can walk the game at once and report the states a player can
+ * get stuck in and the scenes nobody reaches.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GameState.h"
+#include "Value.h"
+
+namespace ADS::Core {
+    class JobSystem;
+}
+
+namespace ADS::Runtime {
+
+    struct Program;
+    class VirtualMachine;
+
+    /**
+     * @brief Explores the states of a game with many machines in parallel
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each worker owns a VirtualMachine of the shared Program. Expanding a
+     * state restores its snapshot before every command, runs the command
+     * and hashes the state it leaves; the hashes go to a visited set shared
+     * by the workers and sharded by hash, so each state is reported by the
+     * first worker to expand it and the others only pass through.
+     *
+     * What a state is reported for:
+     * - a soft-lock: the game is not won and no command changes anything;
+     * - a failure: a command stops with an error, e.g. an endless loop
+     *   hitting Options::instructionLimit;
+     * - unwinnable: no sequence of commands reaches a won state. This
+     *   needs the whole graph of states, so only BreadthFirst finds it,
+     *   and only when it ran out of states before any limit.
+     *
+     * Every finding carries the commands that lead to it from the start,
+     * to replay it. Scenes are read from a global after every command.
+     */
+    class PlaythroughFuzzer {
+    public:
+        static constexpr size_t SHARDS = 64;                ///< Locks of the visited set
+        static constexpr size_t CORPUS_SIZE = 1 << 16;      ///< States kept by CoverageGuided to start from
+
+        /**
+         * @brief How the next state to expand is chosen
+         */
+        enum class Strategy : uint8_t {
+            Random,             ///< Walk from the start to a random changed state each step
+            CoverageGuided,     ///< Walk to new states only, restarting from states found new earlier
+            BreadthFirst        ///< Expand every state, nearest to the start first
+        };
+
+        /**
+         * @brief What to play and for how long
+         */
+        struct Options {
+            std::vector<std::string> commands;      ///< Functions of no arguments, one per command of the player
+            std::string start;                      ///< Function setting the game up; empty for none
+            std::string won;                        ///< Function of no arguments returning a truthy value once won; empty for none
+            std::string scene;                      ///< Global holding the current scene
+            std::vector<Value> scenes;              ///< Every scene of the game, to report those never reached
+            Strategy strategy = Strategy::CoverageGuided;
+            size_t workers = 0;                     ///< Machines run at once; 0 for one per core
+            uint32_t maxDepth = 64;                 ///< Commands per play-through
+            uint64_t maxPlaythroughs = 0;           ///< Stop after; 0 for no limit
+            std::chrono::milliseconds timeLimit{10000};
+            uint64_t instructionLimit = 1000000;    ///< Per call, so an endless loop is a failure instead of a hung worker
+            uint64_t seed = 0;
+            size_t maxFindings = 64;                ///< Findings kept per kind; all are counted
+            std::function<void(VirtualMachine&)> setup;    ///< Called on each worker's machine first, e.g. to bind natives
+        };
+
+        /**
+         * @brief A state worth a look, and how to get there
+         */
+        struct Finding {
+            std::vector<uint16_t> path;             ///< Commands from the start, as indices into Options::commands
+            std::string message;                    ///< Error of the failed command, for failures
+        };
+
+        /**
+         * @brief Outcome of run()
+         */
+        struct Report {
+            uint64_t playthroughs = 0;              ///< Walks played; for BreadthFirst, states expanded
+            uint64_t commands = 0;                  ///< Commands run
+            uint64_t states = 0;                    ///< Distinct states seen
+            uint64_t wins = 0;                      ///< Distinct won states seen
+            uint64_t softLockCount = 0;
+            uint64_t failureCount = 0;
+            uint64_t unwinnableCount = 0;
+            bool exhausted = false;                 ///< BreadthFirst expanded every state reachable, so unwinnable states were looked for
+            std::vector<Finding> softLocks;
+            std::vector<Finding> failures;
+            std::vector<Finding> unwinnable;
+            std::vector<Value> unreachedScenes;     ///< Of Options::scenes
+            std::vector<std::string> errors;        ///< Why nothing was played, e.g. an unknown function
+            std::chrono::milliseconds elapsed{0};
+        };
+
+        /**
+         * @brief Fuzz a program
+         *
+         * @param program Program played; must outlive the fuzzer
+         * @param options What to play
+         */
+        PlaythroughFuzzer(const Program& program, Options options);
+
+        /**
+         * @brief Play until a limit is reached or, for BreadthFirst, every state was expanded
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param jobs Pool to run the workers on, the calling thread helping; nullptr runs one worker here
+         * @return Report What was found
+         */
+        Report run(Core::JobSystem* jobs = nullptr);
+
+        /**
+         * @brief Hash the values of a state
+         */
+        [[nodiscard]] static uint64_t hash(const GameState& state);
+
+    private:
+        static constexpr uint16_t NO_FUNCTION = UINT16_MAX;
+
+        /**
+         * @brief The command that led to a state, and the one before; shared by the states it leads to
+         */
+        struct Trail {
+            std::shared_ptr<const Trail> parent;
+            uint16_t command = 0;
+        };
+
+        /**
+         * @brief A state to expand
+         */
+        struct Node {
+            GameState::Snapshot snapshot;
+            std::shared_ptr<const Trail> trail;
+            uint64_t hash = 0;
+            uint32_t depth = 0;
+            bool won = false;
+        };
+
+        /**
+         * @brief A state in the graph BreadthFirst records, to find the unwinnable ones
+         */
+        struct GraphNode {
+            uint64_t hash = 0;
+            bool won = false;
+            std::shared_ptr<const Trail> trail;
+            std::vector<uint64_t> successors;
+        };
+
+        /**
+         * @brief Part of the visited set, by hash
+         */
+        struct alignas(64) Shard {
+            std::mutex mutex;
+            std::unordered_map<uint64_t, bool> states;      ///< Seen, to whether it was claimed for expansion
+        };
+
+        /**
+         * @brief What a worker found, merged into the Report at the end
+         */
+        struct Findings {
+            uint64_t playthroughs = 0;
+            uint64_t commands = 0;
+            uint64_t wins = 0;
+            uint64_t softLockCount = 0;
+            uint64_t failureCount = 0;
+            std::vector<Finding> softLocks;
+            std::vector<Finding> failures;
+            std::vector<bool> reachedScenes;                ///< By index into Options::scenes
+            std::vector<GraphNode> graph;
+        };
+
+        struct Worker;
+
+        const Program& m_program;
+        Options m_options;
+        std::vector<uint16_t> m_commands;                   ///< Function slots, by command
+        uint16_t m_won = NO_FUNCTION;
+        size_t m_sceneSlot = SIZE_MAX;
+        std::unordered_map<uint64_t, size_t> m_sceneIndex;  ///< Value bits to index into Options::scenes
+        std::vector<Shard> m_shards;
+        std::atomic<bool> m_stop{false};
+        std::atomic<uint64_t> m_playthroughs{0};
+        std::chrono::steady_clock::time_point m_deadline;
+        GameState::Snapshot m_initial;
+        uint64_t m_initialHash = 0;
+
+        std::mutex m_nodesMutex;                            ///< Guards the members below
+        std::condition_variable m_frontierDone;             ///< BreadthFirst: the last state of a depth was expanded
+        std::vector<Node> m_frontier;                       ///< BreadthFirst: states of the depth being expanded
+        std::vector<Node> m_nextFrontier;                   ///< BreadthFirst: states of the next depth
+        size_t m_frontierHead = 0;
+        size_t m_expanding = 0;                             ///< BreadthFirst: workers expanding a state
+        uint32_t m_depth = 0;                               ///< BreadthFirst: depth of m_frontier
+        bool m_truncated = false;                           ///< BreadthFirst: states left at maxDepth or by a stop
+        bool m_finished = false;                            ///< BreadthFirst: no state left to expand
+        std::vector<Node> m_corpus;                         ///< CoverageGuided: new states to start walks from
+
+        /**
+         * @brief Find the functions and globals the options name
+         * @return std::vector<std::string> What is missing; empty if the game can be played
+         */
+        [[nodiscard]] std::vector<std::string> resolve();
+
+        /**
+         * @brief Add a state to the visited set
+         * @return bool True if it was not there
+         */
+        bool visit(uint64_t hash);
+
+        /**
+         * @brief Take the right to report a state's findings
+         * @return bool True for the first worker to ask
+         */
+        bool claim(uint64_t hash);
+
+        /**
+         * @brief Count a play-through and check the limits
+         * @return bool False once the fuzzer should stop
+         */
+        bool startPlaythrough();
+
+        /**
+         * @brief Check the time limit
+         * @return bool True once the fuzzer should stop
+         */
+        bool stopping();
+
+        /**
+         * @brief Run a worker until the fuzzer stops
+         */
+        void work(size_t index, Findings& findings);
+
+        /**
+         * @brief Play every command from a state
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Appends the states that differ from it to the successors, new or
+         * not, and reports its findings if this worker claims it.
+         */
+        void expand(Worker& worker, const Node& node, std::vector<Node>& successors, std::vector<bool>& isNew);
+
+        void walk(Worker& worker);
+        void breadthFirst(Worker& worker);
+
+        /**
+         * @brief Find the states of the recorded graph that no path leads from to a won state
+         */
+        void findUnwinnable(std::vector<Findings>& findings, Report& report) const;
+
+        /**
+         * @brief Turn a trail into a finding
+         */
+        static Finding toFinding(const std::shared_ptr<const Trail>& trail, std::string message = {});
+    };
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_PLAYTHROUGH_FUZZER_H
@@ -0,0 +1,279 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file Program.cpp
+ * @brief Implementation of the Program and ProgramBuilder classes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "Program.h"
+
+#include <format>
+#include <limits>
+#include <utility>
+
+#include "runtime/bytecode_exception.h"
+
+namespace ADS::Runtime {
+
+    const Function* Program::findFunction(const std::string_view name) const {
+        const auto it = functionsByName.find(std::string(name));
+        return it != functionsByName.end() ? &functions[it->second] : nullptr;
+    }
+
+    uint16_t ProgramBuilder::constant(const Value value) {
+        const auto [it, added] = m_constantSlots.try_emplace(value.bits(), static_cast<uint16_t>(m_program.constants.size()));
+        if (added) {
+            if (m_program.constants.size() > std::numeric_limits<uint16_t>::max()) {
+                throw Exceptions::bytecode_exception("More than 65536 constants");
+            }
+            m_program.constants.push_back(value);
+        }
+        return it->second;
+    }
+
+    Value ProgramBuilder::string(const std::string_view text) {
+        const auto [it, added] = m_stringSlots.try_emplace(std::string(text), static_cast<uint32_t>(m_program.strings.size()));
+        if (added) {
+            m_program.strings.emplace_back(text);
+        }
+        return Value::string(it->second);
+    }
+
+    Value ProgramBuilder::entity(const Core::EntityHandle handle) {
+        const auto [it, added] = m_entitySlots.try_emplace(handle.value(), static_cast<uint32_t>(m_program.entities.size()));
+        if (added) {
+            m_program.entities.push_back(handle);
+        }
+        return Value::entity(it->second);
+    }
+
+    uint16_t ProgramBuilder::global(const std::string_view name) {
+        const auto [it, added] = m_globalSlots.try_emplace(std::string(name), static_cast<uint16_t>(m_program.globals.size()));
+        if (added) {
+            if (m_program.globals.size() > std::numeric_limits<uint16_t>::max()) {
+                throw Exceptions::bytecode_exception("More than 65536 globals");
+            }
+            m_program.globals.emplace_back(name);
+        }
+        return it->second;
+    }
+
+    uint16_t ProgramBuilder::native(const std::string_view name, const uint8_t parameterCount) {
+        const auto [it, added] = m_nativeSlots.try_emplace(std::string(name), static_cast<uint16_t>(m_program.natives.size()));
+        if (added) {
+            if (m_program.natives.size() > std::numeric_limits<uint16_t>::max()) {
+                throw Exceptions::bytecode_exception("More than 65536 natives");
+            }
+            m_program.natives.push_back({std::string(name), parameterCount});
+        } else if (m_program.natives[it->second].parameterCount != parameterCount) {
+            throw Exceptions::bytecode_exception(std::format("Native '{}' declared with {} and {} parameters",
+                                                             name, m_program.natives[it->second].parameterCount, parameterCount));
+        }
+        return it->second;
+    }
+
+    uint16_t ProgramBuilder::function(const std::string_view name) {
+        const auto [it, added] = m_program.functionsByName.try_emplace(std::string(name),
+                                                                       static_cast<uint32_t>(m_program.functions.size()));
+        if (added) {
+            if (m_program.functions.size() > std::numeric_limits<uint16_t>::max()) {
+                throw Exceptions::bytecode_exception("More than 65536 functions");
+            }
+            m_program.functions.push_back({std::string(name), 0, 0, {}});
+            m_defined.push_back(false);
+        }
+        return static_cast<uint16_t>(it->second);
+    }
+
+    uint16_t ProgramBuilder::beginFunction(const std::string_view name, const uint8_t parameterCount,
+                                           const uint8_t registerCount) {
+        if (m_current != SIZE_MAX) {
+            throw Exceptions::bytecode_exception(std::format("Function '{}' begun inside '{}'",
+                                                             name, m_program.functions[m_current].name));
+        }
+        const uint16_t slot = function(name);
+        if (m_defined[slot]) {
+            throw Exceptions::bytecode_exception(std::format("Function '{}' defined twice", name));
+        }
+        if (registerCount < parameterCount) {
+            throw Exceptions::bytecode_exception(std::format("Function '{}' has fewer registers than parameters", name));
+        }
+
+        Function& built = m_program.functions[slot];
+        built.parameterCount = parameterCount;
+        built.registerCount = registerCount;
+        m_defined[slot] = true;
+        m_current = slot;
+        m_labels.clear();
+        m_jumps.clear();
+        return slot;
+    }
+
+    void ProgramBuilder::emit(const OpCode op, const uint8_t a, const uint8_t b, const uint8_t c) {
+        if (m_current == SIZE_MAX) {
+            throw Exceptions::bytecode_exception("Instruction outside a function");
+        }
+        m_program.functions[m_current].code.push_back({op, a, b, c});
+    }
+
+    void ProgramBuilder::emitBx(const OpCode op, const uint8_t a, const uint16_t bx) {
+        emit(op, a, static_cast<uint8_t>(bx & 0xFF), static_cast<uint8_t>(bx >> 8));
+    }
+
+    ProgramBuilder::Label ProgramBuilder::newLabel() {
+        m_labels.push_back(-1);
+        return {static_cast<uint32_t>(m_labels.size() - 1)};
+    }
+
+    void ProgramBuilder::emitJump(const OpCode op, const uint8_t a, const Label target) {
+        emitBx(op, a, 0);
+        m_jumps.push_back({m_program.functions[m_current].code.size() - 1, target.id});
+    }
+
+    void ProgramBuilder::bind(const Label label) {
+        if (m_current == SIZE_MAX) {
+            throw Exceptions::bytecode_exception("Label bound outside a function");
+        }
+        m_labels[label.id] = static_cast<int64_t>(m_program.functions[m_current].code.size());
+    }
+
+    void ProgramBuilder::endFunction() {
+        if (m_current == SIZE_MAX) {
+            throw Exceptions::bytecode_exception("endFunction() without beginFunction()");
+        }
+        Function& built = m_program.functions[m_current];
+        for (const PendingJump& jump : m_jumps) {
+            const int64_t target = m_labels[jump.label];
+            if (target < 0) {
+                throw Exceptions::bytecode_exception(std::format("Unbound label in '{}'", built.name));
+            }
+            const int64_t offset = target - static_cast<int64_t>(jump.instruction) - 1;
+            if (offset < std::numeric_limits<int16_t>::min() || offset > std::numeric_limits<int16_t>::max()) {
+                throw Exceptions::bytecode_exception(std::format("Jump too far in '{}'", built.name));
+            }
+            const auto bx = static_cast<uint16_t>(static_cast<int16_t>(offset));
+            built.code[jump.instruction].b = static_cast<uint8_t>(bx & 0xFF);
+            built.code[jump.instruction].c = static_cast<uint8_t>(bx >> 8);
+        }
+        m_current = SIZE_MAX;
+    }
+
+    Program ProgramBuilder::build() {
+        if (m_current != SIZE_MAX) {
+            throw Exceptions::bytecode_exception(std::format("Function '{}' not ended", m_program.functions[m_current].name));
+        }
+        for (size_t slot = 0; slot < m_program.functions.size(); ++slot) {
+            if (!m_defined[slot]) {
+                throw Exceptions::bytecode_exception(std::format("Function '{}' called but never defined",
+                                                                 m_program.functions[slot].name));
+            }
+            verify(m_program.functions[slot]);
+        }
+
+        Program program = std::move(m_program);
+        *this = ProgramBuilder();
+        return program;
+    }
+
+    void ProgramBuilder::verify(const Function& function) const {
+        const auto fail = [&function](const size_t index, const std::string_view problem) {
+            throw Exceptions::bytecode_exception(std::format("{} at instruction {} of '{}'", problem, index, function.name));
+        };
+        const auto registers = [&](const size_t index, const std::initializer_list<uint8_t> operands) {
+            for (const uint8_t operand : operands) {
+                if (operand >= function.registerCount) {
+                    fail(index, std::format("Register {} out of {}", operand, function.registerCount));
+                }
+            }
+        };
+        const auto slot = [&](const size_t index, const size_t value, const size_t count, const std::string_view table) {
+            if (value >= count) {
+                fail(index, std::format("{} slot {} out of {}", table, value, count));
+            }
+        };
+
+        if (function.code.empty()) {
+            fail(0, "Empty code");
+        }
+        for (size_t index = 0; index < function.code.size(); ++index) {
+            const Instruction& instruction = function.code[index];
+            switch (instruction.op) {
+                case OpCode::LoadConst:
+                    registers(index, {instruction.a});
+                    slot(index, instruction.bx(), m_program.constants.size(), "Constant");
+                    break;
+                case OpCode::LoadNil:
+                case OpCode::LoadBool:
+                case OpCode::Return:
+                    registers(index, {instruction.a});
+                    break;
+                case OpCode::Move:
+                case OpCode::Negate:
+                case OpCode::Not:
+                    registers(index, {instruction.a, instruction.b});
+                    break;
+                case OpCode::GetGlobal:
+                case OpCode::SetGlobal:
+                    registers(index, {instruction.a});
+                    slot(index, instruction.bx(), m_program.globals.size(), "Global");
+                    break;
+                case OpCode::Add:
+                case OpCode::Subtract:
+                case OpCode::Multiply:
+                case OpCode::Divide:
+                case OpCode::Modulo:
+                case OpCode::Equal:
+                case OpCode::Less:
+                case OpCode::LessEqual:
+                    registers(index, {instruction.a, instruction.b, instruction.c});
+                    break;
+                case OpCode::JumpIfFalse:
+                case OpCode::JumpIfTrue:
+                    registers(index, {instruction.a});
+                    [[fallthrough]];
+                case OpCode::Jump: {
+                    const int64_t target = static_cast<int64_t>(index) + 1 + instruction.sbx();
+                    if (target < 0 || target >= static_cast<int64_t>(function.code.size())) {
+                        fail(index, "Jump out of the function");
+                    }
+                    break;
+                }
+                case OpCode::Call:
+                case OpCode::CallNative: {
+                    const bool native = instruction.op == OpCode::CallNative;
+                    slot(index, instruction.bx(), native ? m_program.natives.size() : m_program.functions.size(),
+                         native ? "Native" : "Function");
+                    const size_t arguments = native ? m_program.natives[instruction.bx()].parameterCount
+                                                    : m_program.functions[instruction.bx()].parameterCount;
+                    if (instruction.a + arguments >= function.registerCount) {
+                        fail(index, "Call arguments past the last register");
+                    }
+                    break;
+                }
+                case OpCode::ReturnNil:
+                    break;
+                default:
+                    fail(index, std::format("Unknown opcode {}", static_cast<int>(instruction.op)));
+            }
+        }
+
+        // The machine does not check for running off the end
+        const OpCode last = function.code.back().op;
+        if (last != OpCode::Return && last != OpCode::ReturnNil && last != OpCode::Jump) {
+            fail(function.code.size() - 1, "Code does not end in a return or a jump");
+        }
+    }
+}
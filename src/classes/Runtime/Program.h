@@ -0,0 +1,288 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_PROGRAM_H
+#define ADS_RUNTIME_PROGRAM_H
+
+/**
+ * @file Program.h
+ * @brief Register bytecode of the scene actions and triggers, and its builder
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * An instruction is 32 bits: an opcode and three 8-bit operands, or an
+ * opcode, one 8-bit operand and a 16-bit one. Operands name registers of
+ * the running function, slots of the program tables or jump offsets.
+ * Programs are checked once when built, so the virtual machine runs them
+ * without bounds checks.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/EntityHandle.h"
+#include "Value.h"
+
+namespace ADS::Runtime {
+
+    /**
+     * @brief Operation of an instruction; R is a register, K a constant, G a global
+     */
+    enum class OpCode : uint8_t {
+        LoadConst,      ///< R[a] = K[bx]
+        LoadNil,        ///< R[a] = nil
+        LoadBool,       ///< R[a] = b != 0
+        Move,           ///< R[a] = R[b]
+        GetGlobal,      ///< R[a] = G[bx]
+        SetGlobal,      ///< G[bx] = R[a]
+        Add,            ///< R[a] = R[b] + R[c]; numbers only, as are the arithmetic below
+        Subtract,       ///< R[a] = R[b] - R[c]
+        Multiply,       ///< R[a] = R[b] * R[c]
+        Divide,         ///< R[a] = R[b] / R[c]
+        Modulo,         ///< R[a] = R[b] mod R[c], with the sign of R[c]
+        Negate,         ///< R[a] = -R[b]
+        Not,            ///< R[a] = not R[b]
+        Equal,          ///< R[a] = R[b] == R[c]; any types
+        Less,           ///< R[a] = R[b] < R[c]; numbers only
+        LessEqual,      ///< R[a] = R[b] <= R[c]; numbers only
+        Jump,           ///< pc += sbx
+        JumpIfFalse,    ///< if not R[a]: pc += sbx
+        JumpIfTrue,     ///< if R[a]: pc += sbx
+        Call,           ///< R[a] = functions[bx](R[a + 1], ...), as many arguments as it takes
+        CallNative,     ///< R[a] = natives[bx](R[a + 1], ...), likewise
+        Return,         ///< return R[a]
+        ReturnNil,      ///< return nil
+        Count
+    };
+
+    /**
+     * @brief One 32-bit instruction
+     *
+     * Jump offsets count from the instruction after the jump.
+     */
+    struct Instruction {
+        OpCode op;
+        uint8_t a;
+        uint8_t b;
+        uint8_t c;
+
+        /// b and c read as one 16-bit operand
+        [[nodiscard]] constexpr uint16_t bx() const {
+            return static_cast<uint16_t>(b | (c << 8));
+        }
+
+        /// bx read as a signed jump offset
+        [[nodiscard]] constexpr int16_t sbx() const {
+            return static_cast<int16_t>(bx());
+        }
+    };
+
+    static_assert(sizeof(Instruction) == 4);
+
+    /**
+     * @brief A scene action, trigger or helper
+     */
+    struct Function {
+        std::string name;
+        uint8_t parameterCount = 0;     ///< Arguments, which arrive in registers 0 and up
+        uint8_t registerCount = 0;      ///< Registers of a frame, at least parameterCount
+        std::vector<Instruction> code;
+    };
+
+    /**
+     * @brief Host function a program calls by name, bound by the virtual machine
+     */
+    struct NativeSignature {
+        std::string name;
+        uint8_t parameterCount = 0;
+    };
+
+    /**
+     * @brief Bytecode of a game, ready to run
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Built and checked by ProgramBuilder; immutable afterwards, so any
+     * number of virtual machines may run it at once.
+     */
+    struct Program {
+        std::vector<Value> constants;
+        std::vector<std::string> strings;               ///< Texts of the string values
+        std::vector<Core::EntityHandle> entities;       ///< Entities of the entity values
+        std::vector<std::string> globals;               ///< Names of the game variables
+        std::vector<NativeSignature> natives;
+        std::vector<Function> functions;
+        std::unordered_map<std::string, uint32_t> functionsByName;
+
+        /**
+         * @brief Find a function by name
+         * @return const Function* The function, or nullptr if there is none
+         */
+        [[nodiscard]] const Function* findFunction(std::string_view name) const;
+    };
+
+    /**
+     * @brief Assembles and checks a Program
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The target of the script compiler and of hand-written programs.
+     * Strings, entities, globals and natives are interned, so asking for
+     * the same one twice returns the same slot. Functions are built one
+     * at a time; calls may name functions declared later.
+     *
+     * @code
+     * ProgramBuilder builder;
+     * const uint16_t say = builder.native("say", 1);
+     * builder.beginFunction("onEnter", 0, 2);
+     * builder.emitBx(OpCode::LoadConst, 1, builder.constant(builder.string("Hello")));
+     * builder.emitBx(OpCode::CallNative, 0, say);
+     * builder.emit(OpCode::ReturnNil);
+     * builder.endFunction();
+     * Program program = builder.build();
+     * @endcode
+     */
+    class ProgramBuilder {
+    public:
+        /**
+         * @brief Position in the code of the function being built, for jumps
+         */
+        struct Label {
+            uint32_t id;
+        };
+
+        /**
+         * @brief Get the constant slot of a value
+         */
+        uint16_t constant(Value value);
+
+        /**
+         * @brief Get the string value of a text
+         */
+        Value string(std::string_view text);
+
+        /**
+         * @brief Get the entity value of an entity
+         */
+        Value entity(Core::EntityHandle handle);
+
+        /**
+         * @brief Get the slot of a game variable
+         */
+        uint16_t global(std::string_view name);
+
+        /**
+         * @brief Get the slot of a host function
+         *
+         * @param name           Name the virtual machine binds it by
+         * @param parameterCount Arguments it takes
+         */
+        uint16_t native(std::string_view name, uint8_t parameterCount);
+
+        /**
+         * @brief Get the slot of a function, declaring it if it was not yet
+         */
+        uint16_t function(std::string_view name);
+
+        /**
+         * @brief Start the code of a function
+         *
+         * @param name           Name the host calls it by
+         * @param parameterCount Arguments it takes, in registers 0 and up
+         * @param registerCount  Registers it uses
+         * @return uint16_t Slot of the function
+         */
+        uint16_t beginFunction(std::string_view name, uint8_t parameterCount, uint8_t registerCount);
+
+        /**
+         * @brief Append an instruction with three 8-bit operands
+         */
+        void emit(OpCode op, uint8_t a = 0, uint8_t b = 0, uint8_t c = 0);
+
+        /**
+         * @brief Append an instruction with an 8-bit and a 16-bit operand
+         */
+        void emitBx(OpCode op, uint8_t a, uint16_t bx);
+
+        /**
+         * @brief Create a label, placed later by bind()
+         */
+        Label newLabel();
+
+        /**
+         * @brief Append a Jump, JumpIfFalse or JumpIfTrue to a label
+         */
+        void emitJump(OpCode op, uint8_t a, Label target);
+
+        /**
+         * @brief Place a label before the next instruction
+         */
+        void bind(Label label);
+
+        /**
+         * @brief Resolve the jumps of the current function and close it
+         *
+         * @throws Exceptions::bytecode_exception on an unbound label or a jump out of range
+         */
+        void endFunction();
+
+        /**
+         * @brief Check the program and hand it over
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Every register, slot and jump target is checked against the
+         * tables and the function it is in, and every function must end
+         * in a Return or a Jump.
+         *
+         * @throws Exceptions::bytecode_exception naming the first problem found
+         * @return Program The program; the builder is left empty
+         */
+        Program build();
+
+    private:
+        /**
+         * @brief Jump waiting for its label to be bound
+         */
+        struct PendingJump {
+            size_t instruction;
+            uint32_t label;
+        };
+
+        Program m_program;
+        std::unordered_map<std::string, uint32_t> m_stringSlots;
+        std::unordered_map<uint64_t, uint32_t> m_entitySlots;       ///< By EntityHandle::value()
+        std::unordered_map<uint64_t, uint16_t> m_constantSlots;     ///< By Value::bits()
+        std::unordered_map<std::string, uint16_t> m_globalSlots;
+        std::unordered_map<std::string, uint16_t> m_nativeSlots;
+        std::vector<bool> m_defined;                                ///< Whether each function has code
+        size_t m_current = SIZE_MAX;                                ///< Function being built, SIZE_MAX between functions
+        std::vector<int64_t> m_labels;                              ///< Instruction index of each label, -1 until bound
+        std::vector<PendingJump> m_jumps;
+
+        /**
+         * @brief Check the operands of one function
+         */
+        void verify(const Function& function) const;
+    };
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_PROGRAM_H
@@ -0,0 +1,253 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file TriggerEngine.cpp
+ * @brief Implementation of the TriggerEngine class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "TriggerEngine.h"
+
+#include <algorithm>
+#include <format>
+#include <utility>
+
+#include "Core/TraceRecorder.h"
+#include "VirtualMachine.h"
+
+namespace ADS::Runtime {
+
+    TriggerEngine::TriggerEngine(VirtualMachine& machine)
+        : m_machine(machine),
+          m_pureNatives(machine.getProgram().natives.size(), false),
+          m_subscribers(machine.getProgram().globals.size()) {
+    }
+
+    bool TriggerEngine::setNativePure(const std::string_view native) {
+        const auto& natives = m_machine.getProgram().natives;
+        for (size_t slot = 0; slot < natives.size(); ++slot) {
+            if (natives[slot].name == native) {
+                m_pureNatives[slot] = true;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint16_t TriggerEngine::findFunction(const std::string_view name) const {
+        const Program& program = m_machine.getProgram();
+        const Function* function = program.findFunction(name);
+        if (function == nullptr || function->parameterCount != 0) {
+            return NO_FUNCTION;
+        }
+        return static_cast<uint16_t>(function - program.functions.data());
+    }
+
+    void TriggerEngine::collectReads(const uint16_t function, std::vector<bool>& visited, Trigger& trigger) const {
+        visited[function] = true;
+        for (const Instruction& instruction : m_machine.getProgram().functions[function].code) {
+            switch (instruction.op) {
+                case OpCode::GetGlobal:
+                    trigger.reads.push_back(instruction.bx());
+                    break;
+                case OpCode::Call:
+                    if (!visited[instruction.bx()]) {
+                        collectReads(instruction.bx(), visited, trigger);
+                    }
+                    break;
+                case OpCode::CallNative:
+                    trigger.isVolatile = trigger.isVolatile || !m_pureNatives[instruction.bx()];
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    size_t TriggerEngine::add(const std::string_view name, const std::string_view condition,
+                              const std::string_view action, const std::string_view event) {
+        if (condition.empty() && event.empty()) {
+            return NO_TRIGGER;
+        }
+        Trigger trigger;
+        trigger.name = name;
+        trigger.action = findFunction(action);
+        if (trigger.action == NO_FUNCTION) {
+            return NO_TRIGGER;
+        }
+        if (!condition.empty()) {
+            trigger.condition = findFunction(condition);
+            if (trigger.condition == NO_FUNCTION) {
+                return NO_TRIGGER;
+            }
+            std::vector<bool> visited(m_machine.getProgram().functions.size(), false);
+            collectReads(trigger.condition, visited, trigger);
+            std::ranges::sort(trigger.reads);
+            const auto duplicates = std::ranges::unique(trigger.reads);
+            trigger.reads.erase(duplicates.begin(), duplicates.end());
+        }
+
+        const auto index = static_cast<uint32_t>(m_triggers.size());
+        if (event.empty()) {
+            for (const uint16_t slot : trigger.reads) {
+                m_subscribers[slot].push_back(index);
+            }
+            if (trigger.isVolatile) {
+                m_volatileTriggers.push_back(index);
+            }
+            m_recheck.push_back(index);
+        } else {
+            const auto [it, added] = m_eventIds.try_emplace(std::string(event), static_cast<uint32_t>(m_eventTriggers.size()));
+            if (added) {
+                m_eventTriggers.emplace_back();
+            }
+            trigger.event = it->second;
+            m_eventTriggers[trigger.event].push_back(index);
+        }
+        m_triggers.push_back(std::move(trigger));
+        return index;
+    }
+
+    void TriggerEngine::post(const std::string_view event) {
+        const auto it = m_eventIds.find(std::string(event));
+        if (it != m_eventIds.end()) {
+            m_postedEvents.push_back(it->second);
+        }
+    }
+
+    void TriggerEngine::queue(const uint32_t trigger) {
+        if (m_triggers[trigger].pendingRound != m_round) {
+            m_triggers[trigger].pendingRound = m_round;
+            m_pending.push_back(trigger);
+        }
+    }
+
+    /**
+     * @brief Check the triggers affected by what changed since the last run, and fire them
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A round's changes are those since the snapshot the previous round
+     * took, so what an action writes is seen by the next round, and the
+     * snapshot left by the last round is the next run()'s baseline.
+     */
+    TriggerEngine::Report TriggerEngine::run() {
+        Core::TraceRecorder::Scope trace("TriggerEngine::run");
+        Report report;
+        GameState& state = m_machine.getState();
+
+        for (;;) {
+            ++m_round;
+            m_pending.clear();
+            for (const uint32_t trigger : m_recheck) {
+                queue(trigger);
+            }
+            m_recheck.clear();
+
+            state.getChangedPages(m_baseline, m_changedPages);
+            if (report.rounds == 0 || !m_changedPages.empty()) {
+                for (const uint32_t trigger : m_volatileTriggers) {
+                    queue(trigger);
+                }
+            }
+            for (const size_t page : m_changedPages) {
+                const size_t end = std::min(page + GameState::PAGE_SIZE, m_subscribers.size());
+                for (size_t slot = page; slot < end; ++slot) {
+                    if (m_subscribers[slot].empty()) {
+                        continue;
+                    }
+                    const Value before = slot < m_baseline.size() ? m_baseline.get(slot) : Value::nil();
+                    if (state.get(slot).bits() != before.bits()) {
+                        for (const uint32_t trigger : m_subscribers[slot]) {
+                            queue(trigger);
+                        }
+                    }
+                }
+            }
+            for (const uint32_t event : m_postedEvents) {
+                for (const uint32_t trigger : m_eventTriggers[event]) {
+                    queue(trigger);
+                }
+            }
+            m_postedEvents.clear();
+            m_baseline = state.snapshot();
+
+            if (m_pending.empty()) {
+                break;
+            }
+            if (report.rounds == MAX_ROUNDS) {
+                // Left for the next run(), whose baseline no longer shows what queued them
+                m_recheck.assign(m_pending.begin(), m_pending.end());
+                report.settled = false;
+                break;
+            }
+            ++report.rounds;
+
+            // Check every condition before any action runs, in the order the triggers were added
+            std::ranges::sort(m_pending);
+            m_firing.clear();
+            for (const uint32_t index : m_pending) {
+                Trigger& trigger = m_triggers[index];
+                bool holds = true;
+                if (trigger.condition != NO_FUNCTION) {
+                    ++report.evaluated;
+                    const Result result = m_machine.call(trigger.condition);
+                    if (!result.ok()) {
+                        report.errors.push_back(std::format("Trigger '{}': {}", trigger.name, result.message));
+                    }
+                    holds = result.ok() && result.value.isTruthy();
+                }
+                const bool fires = trigger.event == NO_EVENT ? holds && !trigger.wasTrue : holds;
+                trigger.wasTrue = holds;
+                if (fires) {
+                    m_firing.push_back(index);
+                }
+            }
+            for (const uint32_t index : m_firing) {
+                ++report.fired;
+                const Result result = m_machine.call(m_triggers[index].action);
+                if (!result.ok()) {
+                    report.errors.push_back(std::format("Trigger '{}': {}", m_triggers[index].name, result.message));
+                }
+            }
+        }
+        return report;
+    }
+
+    void TriggerEngine::reset() {
+        m_baseline = {};
+        m_recheck.clear();
+        m_postedEvents.clear();
+        for (uint32_t index = 0; index < m_triggers.size(); ++index) {
+            m_triggers[index].wasTrue = false;
+            if (m_triggers[index].event == NO_EVENT) {
+                m_recheck.push_back(index);
+            }
+        }
+    }
+
+    size_t TriggerEngine::size() const {
+        return m_triggers.size();
+    }
+
+    const std::vector<uint16_t>& TriggerEngine::getReads(const size_t index) const {
+        return m_triggers[index].reads;
+    }
+
+    bool TriggerEngine::isVolatile(const size_t index) const {
+        return m_triggers[index].isVolatile;
+    }
+}
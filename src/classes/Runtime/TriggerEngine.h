@@ -0,0 +1,192 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_TRIGGER_ENGINE_H
+#define ADS_RUNTIME_TRIGGER_ENGINE_H
+
+/**
+ * @file TriggerEngine.h
+ * @brief Fires the triggers of a game when what their conditions read changes
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A trigger is a condition function and an action function of the Program.
+ * Checking every condition after every action would cost the whole game's
+ * triggers per turn; instead each trigger subscribes to the globals its
+ * condition reads, found in its bytecode, and to the event it waits for,
+ * and only the triggers subscribed to what changed are checked again.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "GameState.h"
+
+namespace ADS::Runtime {
+
+    class VirtualMachine;
+
+    /**
+     * @brief Dependency-indexed trigger evaluation for one game session
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * State triggers fire when their condition becomes true, on the first
+     * run() and then whenever a global it reads changes and the condition
+     * goes from false to true. Event triggers fire when their event is
+     * posted and their condition, if any, holds.
+     *
+     * The reads of a condition are the GetGlobal instructions of its
+     * function and of the functions it calls. A condition that calls a
+     * native may read anything, so it is checked on every run() unless the
+     * native is declared pure.
+     *
+     * Changes are found by diffing the machine's GameState against a
+     * snapshot taken at the end of the previous run(), so writes pay
+     * nothing for the index: pages left alone are skipped whole, and only
+     * the subscribed slots of the written pages are compared.
+     *
+     * Not thread-safe; the machine must outlive the engine.
+     */
+    class TriggerEngine {
+    public:
+        static constexpr size_t NO_TRIGGER = SIZE_MAX;
+        static constexpr uint32_t MAX_ROUNDS = 16;          ///< Rounds of actions triggering others in one run()
+
+        /**
+         * @brief Outcome of run()
+         */
+        struct Report {
+            uint32_t evaluated = 0;             ///< Conditions called
+            uint32_t fired = 0;                 ///< Actions called
+            uint32_t rounds = 0;                ///< Rounds with something to check
+            bool settled = true;                ///< False if MAX_ROUNDS ended with triggers still pending
+            std::vector<std::string> errors;    ///< Messages of the calls that failed
+        };
+
+        explicit TriggerEngine(VirtualMachine& machine);
+
+        /**
+         * @brief Declare a native that reads no game state, so calling it does not make a condition volatile
+         * @return bool False if the program has no such native
+         */
+        bool setNativePure(std::string_view native);
+
+        /**
+         * @brief Add a trigger
+         *
+         * @param name      Label, used in error messages
+         * @param condition Function of no arguments returning a truthy value when the trigger should fire;
+         *                  empty for an event trigger that always fires
+         * @param action    Function of no arguments run when it fires
+         * @param event     Event it waits for; empty for a state trigger, which then needs a condition
+         * @return size_t Index of the trigger, or NO_TRIGGER if a function is unknown or takes arguments
+         */
+        size_t add(std::string_view name, std::string_view condition, std::string_view action,
+                   std::string_view event = {});
+
+        /**
+         * @brief Queue an event for the next run()
+         *
+         * Events nobody waits for are ignored; an event posted twice
+         * before a run() fires its triggers once.
+         */
+        void post(std::string_view event);
+
+        /**
+         * @brief Check the triggers affected by what changed since the last run, and fire them
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Each round checks every affected condition first and then runs
+         * the actions of those that fire, in the order they were added.
+         * What the actions change is checked in the next round, up to
+         * MAX_ROUNDS.
+         *
+         * @return Report What was checked and fired
+         */
+        Report run();
+
+        /**
+         * @brief Forget the state seen so far, so the next run() checks every state trigger as new
+         */
+        void reset();
+
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Get the globals a trigger's condition was found to read
+         */
+        [[nodiscard]] const std::vector<uint16_t>& getReads(size_t index) const;
+
+        /**
+         * @brief Check whether a trigger's condition is checked on every run()
+         */
+        [[nodiscard]] bool isVolatile(size_t index) const;
+
+    private:
+        static constexpr uint16_t NO_FUNCTION = UINT16_MAX;
+        static constexpr uint32_t NO_EVENT = UINT32_MAX;
+
+        struct Trigger {
+            std::string name;
+            uint16_t condition = NO_FUNCTION;
+            uint16_t action = NO_FUNCTION;
+            uint32_t event = NO_EVENT;
+            std::vector<uint16_t> reads;        ///< Globals the condition reads, sorted
+            bool isVolatile = false;            ///< Calls a native that may read anything
+            bool wasTrue = false;               ///< Condition at its last check, for state triggers
+            uint64_t pendingRound = 0;          ///< Round it was last queued for, to queue it once
+        };
+
+        VirtualMachine& m_machine;
+        std::vector<Trigger> m_triggers;
+        std::vector<bool> m_pureNatives;                                ///< By native slot
+        std::vector<std::vector<uint32_t>> m_subscribers;               ///< State triggers by global slot
+        std::unordered_map<std::string, uint32_t> m_eventIds;
+        std::vector<std::vector<uint32_t>> m_eventTriggers;             ///< By event id
+        std::vector<uint32_t> m_postedEvents;
+        std::vector<uint32_t> m_volatileTriggers;
+        std::vector<uint32_t> m_recheck;                                ///< To check next run() whatever changed: new ones, and those MAX_ROUNDS left
+        GameState::Snapshot m_baseline;                                 ///< State at the end of the last run()
+        std::vector<size_t> m_changedPages;                             ///< Reused by run()
+        std::vector<uint32_t> m_pending;                                ///< Reused by run()
+        std::vector<uint32_t> m_firing;                                 ///< Reused by run()
+        uint64_t m_round = 0;                                           ///< Rounds ever run, so 0 marks nothing
+
+        /**
+         * @brief Collect the globals a function reads, and whether it calls a native that is not pure
+         */
+        void collectReads(uint16_t function, std::vector<bool>& visited, Trigger& trigger) const;
+
+        /**
+         * @brief Find a function of no arguments by name
+         * @return uint16_t Its slot, or NO_FUNCTION
+         */
+        [[nodiscard]] uint16_t findFunction(std::string_view name) const;
+
+        /**
+         * @brief Queue a trigger to be checked this round, once
+         */
+        void queue(uint32_t trigger);
+    };
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_TRIGGER_ENGINE_H
@@ -0,0 +1,163 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_VALUE_H
+#define ADS_RUNTIME_VALUE_H
+
+/**
+ * @file Value.h
+ * @brief NaN-boxed value of the game runtime
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Every value fits in 64 bits, so a register file is a plain array and
+ * copying a value is copying a word. Numbers are stored as themselves;
+ * the other types live in the payload of a quiet NaN that arithmetic
+ * never produces, tagged by two bits above the payload.
+ */
+
+#include <bit>
+#include <cstdint>
+
+namespace ADS::Runtime {
+
+    /**
+     * @brief A nil, boolean, number, string or entity of a running game
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Strings and entities are indexes into the tables of the Program the
+     * value belongs to, so they compare by identity and need no memory of
+     * their own.
+     */
+    class Value {
+    public:
+        enum class Type : uint8_t {
+            Nil,
+            Bool,
+            Number,
+            String,     ///< Index into Program::strings
+            Entity      ///< Index into Program::entities
+        };
+
+        /**
+         * @brief Nil
+         */
+        constexpr Value() = default;
+
+        [[nodiscard]] static constexpr Value nil() {
+            return {};
+        }
+
+        [[nodiscard]] static constexpr Value boolean(const bool value) {
+            return fromBits(BOXED | (TAG_BOOL << TAG_SHIFT) | (value ? 1u : 0u));
+        }
+
+        [[nodiscard]] static constexpr Value number(const double value) {
+            // A NaN with the boxed bits set would read back as another type
+            return fromBits(value != value ? CANONICAL_NAN : std::bit_cast<uint64_t>(value));
+        }
+
+        [[nodiscard]] static constexpr Value string(const uint32_t index) {
+            return fromBits(BOXED | (TAG_STRING << TAG_SHIFT) | index);
+        }
+
+        [[nodiscard]] static constexpr Value entity(const uint32_t index) {
+            return fromBits(BOXED | (TAG_ENTITY << TAG_SHIFT) | index);
+        }
+
+        [[nodiscard]] constexpr Type type() const {
+            if (isNumber()) {
+                return Type::Number;
+            }
+            switch ((m_bits >> TAG_SHIFT) & TAG_MASK) {
+                case TAG_BOOL:
+                    return Type::Bool;
+                case TAG_STRING:
+                    return Type::String;
+                case TAG_ENTITY:
+                    return Type::Entity;
+                default:
+                    return Type::Nil;
+            }
+        }
+
+        [[nodiscard]] constexpr bool isNumber() const {
+            return (m_bits & BOXED) != BOXED;
+        }
+
+        [[nodiscard]] constexpr bool isNil() const {
+            return m_bits == NIL;
+        }
+
+        /// Only meaningful if isNumber()
+        [[nodiscard]] constexpr double asNumber() const {
+            return std::bit_cast<double>(m_bits);
+        }
+
+        /// Only meaningful for booleans
+        [[nodiscard]] constexpr bool asBool() const {
+            return (m_bits & 1u) != 0;
+        }
+
+        /// Table index of a string or entity
+        [[nodiscard]] constexpr uint32_t asIndex() const {
+            return static_cast<uint32_t>(m_bits);
+        }
+
+        /// False for nil and false, true for everything else, zero included
+        [[nodiscard]] constexpr bool isTruthy() const {
+            return m_bits != NIL && m_bits != FALSE_BITS;
+        }
+
+        /// Raw 64 bits, e.g. for saving a game
+        [[nodiscard]] constexpr uint64_t bits() const {
+            return m_bits;
+        }
+
+        [[nodiscard]] static constexpr Value fromBits(const uint64_t bits) {
+            Value value;
+            value.m_bits = bits;
+            return value;
+        }
+
+        /// Numbers compare by value, so NaN differs from itself; the rest by identity
+        friend constexpr bool operator==(const Value& a, const Value& b) {
+            if (a.isNumber() && b.isNumber()) {
+                return a.asNumber() == b.asNumber();
+            }
+            return a.m_bits == b.m_bits;
+        }
+
+    private:
+        // Quiet NaN plus one more bit; the NaNs of arithmetic, 0x7FF8... and 0xFFF8..., lack it
+        static constexpr uint64_t BOXED = 0x7FFC000000000000ull;
+        static constexpr uint64_t CANONICAL_NAN = 0x7FF8000000000000ull;
+        static constexpr uint64_t TAG_SHIFT = 48;
+        static constexpr uint64_t TAG_MASK = 0x3;
+        static constexpr uint64_t TAG_NIL = 0;
+        static constexpr uint64_t TAG_BOOL = 1;
+        static constexpr uint64_t TAG_STRING = 2;
+        static constexpr uint64_t TAG_ENTITY = 3;
+        static constexpr uint64_t NIL = BOXED | (TAG_NIL << TAG_SHIFT);
+        static constexpr uint64_t FALSE_BITS = BOXED | (TAG_BOOL << TAG_SHIFT);
+
+        uint64_t m_bits = NIL;
+    };
+
+    static_assert(sizeof(Value) == 8);
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_VALUE_H
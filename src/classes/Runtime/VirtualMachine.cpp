@@ -0,0 +1,364 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file VirtualMachine.cpp
+ * @brief Implementation of the VirtualMachine class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "VirtualMachine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <utility>
+
+#include "Core/TraceRecorder.h"
+
+// Labels as values are a GCC extension that Clang shares
+#if defined(__GNUC__) || defined(__clang__)
+#define ADS_VM_COMPUTED_GOTO 1
+#endif
+
+namespace ADS::Runtime {
+    namespace {
+        // One frame has at most 255 registers
+        constexpr size_t ARENA_SIZE = VirtualMachine::MAX_CALL_DEPTH * std::numeric_limits<uint8_t>::max();
+
+        const char* opName(const OpCode op) {
+            static constexpr const char* names[] = {
+                "LoadConst", "LoadNil", "LoadBool", "Move", "GetGlobal", "SetGlobal", "Add", "Subtract",
+                "Multiply", "Divide", "Modulo", "Negate", "Not", "Equal", "Less", "LessEqual", "Jump",
+                "JumpIfFalse", "JumpIfTrue", "Call", "CallNative", "Return", "ReturnNil"
+            };
+            static_assert(std::size(names) == static_cast<size_t>(OpCode::Count));
+            return names[static_cast<size_t>(op)];
+        }
+    }
+
+    VirtualMachine::VirtualMachine(const Program& program)
+        : m_program(program),
+          m_registers(ARENA_SIZE),
+          m_state(program.globals.size()),
+          m_natives(program.natives.size()),
+          m_instructionLimit(0),
+          m_samplePeriod(DEFAULT_SAMPLE_PERIOD),
+          m_executed(0) {
+        m_frames.reserve(MAX_CALL_DEPTH);
+    }
+
+    bool VirtualMachine::bind(const std::string_view name, NativeFunction function) {
+        for (size_t slot = 0; slot < m_program.natives.size(); ++slot) {
+            if (m_program.natives[slot].name == name) {
+                m_natives[slot] = std::move(function);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Result VirtualMachine::call(const std::string_view name, const std::span<const Value> arguments) {
+        const Function* function = m_program.findFunction(name);
+        if (function == nullptr) {
+            return {Status::UnknownFunction, {}, std::format("No function '{}'", name)};
+        }
+        return execute(*function, arguments);
+    }
+
+    Result VirtualMachine::call(const uint16_t function, const std::span<const Value> arguments) {
+        if (function >= m_program.functions.size()) {
+            return {Status::UnknownFunction, {}, std::format("No function in slot {}", function)};
+        }
+        return execute(m_program.functions[function], arguments);
+    }
+
+    void VirtualMachine::setInstructionLimit(const uint64_t limit) {
+        m_instructionLimit = limit;
+    }
+
+    void VirtualMachine::setSampler(Sampler sampler, const uint64_t period) {
+        m_sampler = std::move(sampler);
+        m_samplePeriod = std::max<uint64_t>(period, 1);
+    }
+
+    uint64_t VirtualMachine::getExecutedInstructions() const {
+        return m_executed;
+    }
+
+    Value VirtualMachine::getGlobal(const std::string_view name) const {
+        const auto it = std::ranges::find(m_program.globals, name);
+        return it != m_program.globals.end() ? m_state.get(it - m_program.globals.begin()) : Value::nil();
+    }
+
+    bool VirtualMachine::setGlobal(const std::string_view name, const Value value) {
+        const auto it = std::ranges::find(m_program.globals, name);
+        if (it == m_program.globals.end()) {
+            return false;
+        }
+        m_state.set(it - m_program.globals.begin(), value);
+        return true;
+    }
+
+    GameState& VirtualMachine::getState() {
+        return m_state;
+    }
+
+    const GameState& VirtualMachine::getState() const {
+        return m_state;
+    }
+
+    std::string_view VirtualMachine::getString(const Value value) const {
+        if (value.type() != Value::Type::String || value.asIndex() >= m_program.strings.size()) {
+            return {};
+        }
+        return m_program.strings[value.asIndex()];
+    }
+
+    const Program& VirtualMachine::getProgram() const {
+        return m_program;
+    }
+
+    Result VirtualMachine::execute(const Function& function, const std::span<const Value> arguments) {
+        Core::TraceRecorder::Scope trace("VirtualMachine::execute");
+        if (arguments.size() != function.parameterCount) {
+            return {Status::BadArguments, {},
+                    std::format("'{}' takes {} arguments, not {}", function.name, function.parameterCount, arguments.size())};
+        }
+        if (m_frames.size() == MAX_CALL_DEPTH) {
+            return {Status::CallDepthExceeded, {}, std::format("Too many nested calls entering '{}'", function.name)};
+        }
+
+        // A native may call back in: the new frames go above the ones already running
+        const size_t baseDepth = m_frames.size();
+        Value* base = m_frames.empty() ? m_registers.data()
+                                       : m_frames.back().registers + m_frames.back().function->registerCount;
+        std::ranges::copy(arguments, base);
+        std::fill(base + function.parameterCount, base + function.registerCount, Value::nil());
+        m_frames.push_back({&function, nullptr, base, 0});
+
+        // Drops the frames of this call if a native throws
+        struct Unwind {
+            std::vector<Frame>& frames;
+            size_t depth;
+            ~Unwind() { frames.resize(depth, Frame{}); }
+        } unwind{m_frames, baseDepth};
+
+        Frame* frame = &m_frames.back();
+        Value* R = base;
+        const Instruction* pc = function.code.data();
+        const Value* K = m_program.constants.data();
+        // Counts down on every fetch, a slice of the budget at a time; the fetch that
+        // exhausts the last slice is not run. With no sampler the budget is one slice.
+        const uint64_t budget = m_instructionLimit != 0 ? m_instructionLimit + 1 : std::numeric_limits<uint64_t>::max();
+        uint64_t remaining = m_sampler ? std::min(m_samplePeriod, budget) : budget;
+        uint64_t reserve = budget - remaining;     // Budget beyond the current slice
+        uint64_t counted = 0;                      // Fetches already added to m_executed
+        Instruction instruction{};
+
+        // Called by the fetch that exhausts a slice, which then runs as the first of the next one
+        const auto nextSlice = [&]() -> bool {
+            if (reserve == 0) {
+                return false;
+            }
+            m_executed += budget - reserve - counted;
+            counted = budget - reserve;
+            remaining = std::min(m_samplePeriod, reserve);
+            reserve -= remaining;
+            if (m_sampler) {
+                m_sampler(*this);
+            }
+            return true;
+        };
+
+        const auto fail = [&](const Status status, const std::string_view problem) -> Result {
+            m_executed += budget - reserve - remaining - counted - (remaining == 0 ? 1 : 0);
+            const size_t index = pc - frame->function->code.data() - 1;
+            return {status, {}, std::format("{} in {} at instruction {} of '{}'",
+                                            problem, opName(instruction.op), index, frame->function->name)};
+        };
+
+#ifdef ADS_VM_COMPUTED_GOTO
+        // Indexed by OpCode; the order must match the enumeration
+        static void* const dispatch[] = {
+            &&op_LoadConst, &&op_LoadNil, &&op_LoadBool, &&op_Move, &&op_GetGlobal, &&op_SetGlobal,
+            &&op_Add, &&op_Subtract, &&op_Multiply, &&op_Divide, &&op_Modulo, &&op_Negate, &&op_Not,
+            &&op_Equal, &&op_Less, &&op_LessEqual, &&op_Jump, &&op_JumpIfFalse, &&op_JumpIfTrue,
+            &&op_Call, &&op_CallNative, &&op_Return, &&op_ReturnNil
+        };
+        static_assert(std::size(dispatch) == static_cast<size_t>(OpCode::Count));
+#define VM_CASE(name) op_##name:
+#define VM_NEXT()                                                                   \
+        do {                                                                        \
+            if (--remaining == 0 && !nextSlice()) goto limitReached;                \
+            instruction = *pc++;                                                    \
+            goto *dispatch[static_cast<size_t>(instruction.op)];                    \
+        } while (false)
+        VM_NEXT();
+#else
+#define VM_CASE(name) case OpCode::name:
+#define VM_NEXT() continue
+        for (;;) {
+            if (--remaining == 0 && !nextSlice()) goto limitReached;
+            instruction = *pc++;
+            switch (instruction.op) {
+#endif
+
+// Hands the value to the caller's result register, or ends the call() at its entry frame
+#define VM_RETURN(value)                                                            \
+        {                                                                           \
+            const Value returned = (value);                                         \
+            const uint8_t target = frame->result;                                   \
+            m_frames.pop_back();                                                    \
+            if (m_frames.size() == baseDepth) {                                     \
+                m_executed += budget - reserve - remaining - counted;               \
+                return {Status::Ok, returned, {}};                                  \
+            }                                                                       \
+            frame = &m_frames.back();                                               \
+            R = frame->registers;                                                   \
+            pc = frame->resume;                                                     \
+            R[target] = returned;                                                   \
+            VM_NEXT();                                                              \
+        }
+
+#define VM_ARITHMETIC(name, expression)                                             \
+        VM_CASE(name) {                                                             \
+            const Value b = R[instruction.b];                                       \
+            const Value c = R[instruction.c];                                       \
+            if (!b.isNumber() || !c.isNumber()) [[unlikely]] {                      \
+                return fail(Status::TypeError, "Operand is not a number");          \
+            }                                                                       \
+            const double x = b.asNumber();                                          \
+            const double y = c.asNumber();                                          \
+            R[instruction.a] = (expression);                                        \
+            VM_NEXT();                                                              \
+        }
+
+        VM_CASE(LoadConst) {
+            R[instruction.a] = K[instruction.bx()];
+            VM_NEXT();
+        }
+        VM_CASE(LoadNil) {
+            R[instruction.a] = Value::nil();
+            VM_NEXT();
+        }
+        VM_CASE(LoadBool) {
+            R[instruction.a] = Value::boolean(instruction.b != 0);
+            VM_NEXT();
+        }
+        VM_CASE(Move) {
+            R[instruction.a] = R[instruction.b];
+            VM_NEXT();
+        }
+        VM_CASE(GetGlobal) {
+            R[instruction.a] = m_state.get(instruction.bx());
+            VM_NEXT();
+        }
+        VM_CASE(SetGlobal) {
+            m_state.set(instruction.bx(), R[instruction.a]);
+            VM_NEXT();
+        }
+        VM_ARITHMETIC(Add, Value::number(x + y))
+        VM_ARITHMETIC(Subtract, Value::number(x - y))
+        VM_ARITHMETIC(Multiply, Value::number(x * y))
+        VM_ARITHMETIC(Divide, Value::number(x / y))
+        // Floored, like the modulo of the scripts: the result takes the sign of the divisor
+        VM_ARITHMETIC(Modulo, Value::number(x - std::floor(x / y) * y))
+        VM_ARITHMETIC(Less, Value::boolean(x < y))
+        VM_ARITHMETIC(LessEqual, Value::boolean(x <= y))
+        VM_CASE(Negate) {
+            const Value b = R[instruction.b];
+            if (!b.isNumber()) [[unlikely]] {
+                return fail(Status::TypeError, "Operand is not a number");
+            }
+            R[instruction.a] = Value::number(-b.asNumber());
+            VM_NEXT();
+        }
+        VM_CASE(Not) {
+            R[instruction.a] = Value::boolean(!R[instruction.b].isTruthy());
+            VM_NEXT();
+        }
+        VM_CASE(Equal) {
+            R[instruction.a] = Value::boolean(R[instruction.b] == R[instruction.c]);
+            VM_NEXT();
+        }
+        VM_CASE(Jump) {
+            pc += instruction.sbx();
+            VM_NEXT();
+        }
+        VM_CASE(JumpIfFalse) {
+            if (!R[instruction.a].isTruthy()) {
+                pc += instruction.sbx();
+            }
+            VM_NEXT();
+        }
+        VM_CASE(JumpIfTrue) {
+            if (R[instruction.a].isTruthy()) {
+                pc += instruction.sbx();
+            }
+            VM_NEXT();
+        }
+        VM_CASE(Call) {
+            const Function& callee = m_program.functions[instruction.bx()];
+            if (m_frames.size() == MAX_CALL_DEPTH) [[unlikely]] {
+                return fail(Status::CallDepthExceeded, std::format("Too many nested calls entering '{}'", callee.name));
+            }
+            Value* window = R + frame->function->registerCount;
+            std::copy_n(R + instruction.a + 1, callee.parameterCount, window);
+            std::fill(window + callee.parameterCount, window + callee.registerCount, Value::nil());
+            frame->resume = pc;
+            m_frames.push_back({&callee, nullptr, window, instruction.a});
+            frame = &m_frames.back();
+            R = window;
+            pc = callee.code.data();
+            VM_NEXT();
+        }
+        VM_CASE(CallNative) {
+            const NativeFunction& native = m_natives[instruction.bx()];
+            if (!native) [[unlikely]] {
+                return fail(Status::UnboundNative,
+                            std::format("Native '{}' not bound", m_program.natives[instruction.bx()].name));
+            }
+            const uint8_t count = m_program.natives[instruction.bx()].parameterCount;
+            frame->resume = pc;
+            const Value result = native(*this, std::span<const Value>(R + instruction.a + 1, count));
+            R[instruction.a] = result;
+            VM_NEXT();
+        }
+        VM_CASE(Return) {
+            VM_RETURN(R[instruction.a])
+        }
+        VM_CASE(ReturnNil) {
+            VM_RETURN(Value::nil())
+        }
+
+#ifndef ADS_VM_COMPUTED_GOTO
+                default:
+                    break;
+            }
+        }
+#endif
+
+    limitReached:
+        // Report the instruction that would have run next
+        instruction = *pc++;
+        return fail(Status::InstructionLimit, std::format("Stopped after {} instructions", m_instructionLimit));
+
+#undef VM_ARITHMETIC
+#undef VM_RETURN
+#undef VM_NEXT
+#undef VM_CASE
+    }
+}
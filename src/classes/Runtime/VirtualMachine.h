@@ -0,0 +1,230 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_VIRTUAL_MACHINE_H
+#define ADS_RUNTIME_VIRTUAL_MACHINE_H
+
+/**
+ * @file VirtualMachine.h
+ * @brief Interpreter of the runtime bytecode
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GameState.h"
+#include "Program.h"
+#include "Value.h"
+
+namespace ADS::Runtime {
+
+    class VirtualMachine;
+
+    /**
+     * @brief Host function called by CallNative, e.g. to show a text or move the player
+     *
+     * Receives exactly the arguments its NativeSignature declares. May call
+     * back into the machine.
+     */
+    using NativeFunction = std::function<Value(VirtualMachine& machine, std::span<const Value> arguments)>;
+
+    /**
+     * @brief Host function the machine calls every few instructions, e.g. to sample watched variables
+     *
+     * Runs between two instructions, so the state it reads is consistent.
+     * Must not call into the machine.
+     */
+    using Sampler = std::function<void(const VirtualMachine& machine)>;
+
+    /**
+     * @brief How a call into the machine ended
+     */
+    enum class Status : uint8_t {
+        Ok,
+        UnknownFunction,        ///< No function of that name
+        BadArguments,           ///< Not as many arguments as the function takes
+        TypeError,              ///< Arithmetic or comparison on a value that is not a number
+        UnboundNative,          ///< CallNative of a native the host did not bind()
+        CallDepthExceeded,      ///< More than MAX_CALL_DEPTH nested calls
+        InstructionLimit        ///< setInstructionLimit() reached, e.g. an endless loop
+    };
+
+    /**
+     * @brief Outcome of VirtualMachine::call()
+     */
+    struct Result {
+        Status status = Status::Ok;
+        Value value;                ///< Returned value if ok()
+        std::string message;        ///< What failed, and where, otherwise
+
+        [[nodiscard]] bool ok() const {
+            return status == Status::Ok;
+        }
+    };
+
+    /**
+     * @brief Runs the actions and triggers of a Program
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A register machine: each instruction names the registers it reads
+     * and writes, so an expression takes a few instructions instead of the
+     * pushes and pops of a stack machine. With GCC and Clang the loop
+     * dispatches through a table of label addresses, one indirect jump per
+     * instruction that the branch predictor learns per opcode; elsewhere it
+     * falls back to a switch.
+     *
+     * Frames are windows into one register arena allocated with the
+     * machine: a call moves the window past the caller's registers and
+     * copies the arguments in, so calls allocate nothing. The arena holds
+     * MAX_CALL_DEPTH frames of the largest size, so no call can overflow it.
+     *
+     * The program is checked when built, so operands are not checked here.
+     * Game variables live in the machine's GameState, which makes a machine
+     * one game session; any number may share a Program. Not thread-safe.
+     */
+    class VirtualMachine {
+    public:
+        static constexpr size_t MAX_CALL_DEPTH = 256;
+        static constexpr uint64_t DEFAULT_SAMPLE_PERIOD = 16384;   ///< Instructions between samples
+
+        /**
+         * @brief Create a session of a program, with every global nil
+         *
+         * @param program Program run; must outlive the machine
+         */
+        explicit VirtualMachine(const Program& program);
+
+        VirtualMachine(const VirtualMachine&) = delete;
+        VirtualMachine& operator=(const VirtualMachine&) = delete;
+
+        /**
+         * @brief Provide the host function behind a native
+         *
+         * @param name     Name the program declared the native with
+         * @param function Implementation
+         * @return bool False if the program does not use the native
+         */
+        bool bind(std::string_view name, NativeFunction function);
+
+        /**
+         * @brief Run a function to its end
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Globals set before an error keep their values.
+         *
+         * @param name      Function to run, e.g. the trigger of a scene
+         * @param arguments As many as the function takes
+         * @return Result Returned value, or why the call failed
+         */
+        Result call(std::string_view name, std::span<const Value> arguments = {});
+
+        /**
+         * @brief Run a function, found by its slot, to its end
+         */
+        Result call(uint16_t function, std::span<const Value> arguments = {});
+
+        /**
+         * @brief Stop each call() after a number of instructions
+         *
+         * @param limit Instructions per call(); 0 for no limit
+         */
+        void setInstructionLimit(uint64_t limit);
+
+        /**
+         * @brief Call a function every few instructions while the machine runs
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The sampler rides on the countdown of the instruction limit: the
+         * budget of a call() is handed out in slices of the period, and the
+         * fetch that exhausts a slice calls the sampler before it starts the
+         * next one. Instructions pay nothing more than without a sampler;
+         * the cost is the sampler itself, once per period.
+         *
+         * @param sampler Function to call; empty to stop sampling
+         * @param period  Instructions between calls; a native that calls back into the machine starts its own count
+         */
+        void setSampler(Sampler sampler, uint64_t period = DEFAULT_SAMPLE_PERIOD);
+
+        /**
+         * @brief Get the instructions run by all calls so far
+         *
+         * Up to date when a sampler runs.
+         */
+        [[nodiscard]] uint64_t getExecutedInstructions() const;
+
+        /**
+         * @brief Get or set a game variable
+         * @return Value The value; nil for names the program does not use
+         */
+        [[nodiscard]] Value getGlobal(std::string_view name) const;
+        bool setGlobal(std::string_view name, Value value);
+
+        /**
+         * @brief Get the game variables, in slots indexed like Program::globals
+         *
+         * The debugger snapshots and restores the session through it;
+         * hosts may grow() it to keep more of the session's state there.
+         */
+        [[nodiscard]] GameState& getState();
+        [[nodiscard]] const GameState& getState() const;
+
+        /**
+         * @brief Get the text of a string value
+         */
+        [[nodiscard]] std::string_view getString(Value value) const;
+
+        [[nodiscard]] const Program& getProgram() const;
+
+    private:
+        /**
+         * @brief Activation of a function
+         */
+        struct Frame {
+            const Function* function;
+            const Instruction* resume;      ///< Next instruction, saved while the frame calls another
+            Value* registers;               ///< Window into m_registers
+            uint8_t result;                 ///< Register of the caller that receives the returned value
+        };
+
+        const Program& m_program;
+        std::vector<Value> m_registers;     ///< Arena of every frame's registers
+        GameState m_state;                  ///< Game variables first, then whatever the host added
+        std::vector<NativeFunction> m_natives;
+        std::vector<Frame> m_frames;        ///< Capacity MAX_CALL_DEPTH, so pointers to frames stay valid
+        Sampler m_sampler;
+        uint64_t m_instructionLimit;
+        uint64_t m_samplePeriod;
+        uint64_t m_executed;
+
+        /**
+         * @brief Run a function until it returns to the frame it was called from
+         */
+        Result execute(const Function& function, std::span<const Value> arguments);
+    };
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_VIRTUAL_MACHINE_H
@@ -0,0 +1,139 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file WatchList.cpp
+ * @brief Implementation of the WatchList class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "WatchList.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Program.h"
+#include "VirtualMachine.h"
+
+namespace ADS::Runtime {
+
+    namespace {
+        float plotted(const Value value) {
+            if (value.isNumber()) {
+                return static_cast<float>(value.asNumber());
+            }
+            return value.type() == Value::Type::Bool && value.asBool() ? 1.0f : 0.0f;
+        }
+    }
+
+    size_t WatchList::add(std::string name, const size_t slot) {
+        m_names.push_back(std::move(name));
+        m_slots.push_back(slot);
+        m_values.emplace_back();
+        m_changeTotals.push_back(0);
+        m_samples.resize(m_samples.size() + SAMPLES, 0.0f);
+        m_changes.resize(m_changes.size() + CHANGES);
+        return m_names.size() - 1;
+    }
+
+    void WatchList::addGlobals(const Program& program) {
+        for (size_t slot = 0; slot < program.globals.size(); ++slot) {
+            add(program.globals[slot], slot);
+        }
+    }
+
+    void WatchList::remove(const size_t index) {
+        const auto offset = static_cast<std::ptrdiff_t>(index);
+        m_names.erase(m_names.begin() + offset);
+        m_slots.erase(m_slots.begin() + offset);
+        m_values.erase(m_values.begin() + offset);
+        m_changeTotals.erase(m_changeTotals.begin() + offset);
+        m_samples.erase(m_samples.begin() + offset * SAMPLES, m_samples.begin() + (offset + 1) * SAMPLES);
+        m_changes.erase(m_changes.begin() + offset * CHANGES, m_changes.begin() + (offset + 1) * CHANGES);
+    }
+
+    void WatchList::clear() {
+        m_names.clear();
+        m_slots.clear();
+        m_values.clear();
+        m_changeTotals.clear();
+        m_samples.clear();
+        m_changes.clear();
+        m_sampleHead = 0;
+        m_sampleCount = 0;
+    }
+
+    void WatchList::sample(const GameState& state, const uint64_t tick) {
+        const size_t stateSize = state.size();
+        for (size_t index = 0; index < m_slots.size(); ++index) {
+            const size_t slot = m_slots[index];
+            const Value value = slot < stateSize ? state.get(slot) : Value::nil();
+            m_samples[index * SAMPLES + m_sampleHead] = plotted(value);
+            // Compare bits, so a NaN that stays NaN is not a change; the first sample always is one
+            if (value.bits() != m_values[index].bits() || m_changeTotals[index] == 0) {
+                m_values[index] = value;
+                m_changes[index * CHANGES + m_changeTotals[index] % CHANGES] = {tick, value};
+                ++m_changeTotals[index];
+            }
+        }
+        m_sampleHead = (m_sampleHead + 1) % SAMPLES;
+        m_sampleCount = std::min(m_sampleCount + 1, SAMPLES);
+    }
+
+    void WatchList::attach(VirtualMachine& machine) {
+        machine.setSampler([this](const VirtualMachine& running) {
+            sample(running.getState(), running.getExecutedInstructions());
+        }, samplePeriod());
+    }
+
+    uint64_t WatchList::samplePeriod() const {
+        return std::max<uint64_t>(VirtualMachine::DEFAULT_SAMPLE_PERIOD, m_slots.size() * INSTRUCTIONS_PER_READ);
+    }
+
+    size_t WatchList::size() const {
+        return m_names.size();
+    }
+
+    const std::string& WatchList::getName(const size_t index) const {
+        return m_names[index];
+    }
+
+    size_t WatchList::getSlot(const size_t index) const {
+        return m_slots[index];
+    }
+
+    Value WatchList::getValue(const size_t index) const {
+        return m_values[index];
+    }
+
+    std::span<const float> WatchList::getSamples(const size_t index) const {
+        return {m_samples.data() + index * SAMPLES, SAMPLES};
+    }
+
+    size_t WatchList::getSampleOffset() const {
+        return m_sampleCount < SAMPLES ? 0 : m_sampleHead;
+    }
+
+    size_t WatchList::getSampleCount() const {
+        return m_sampleCount;
+    }
+
+    size_t WatchList::getChangeCount(const size_t index) const {
+        return static_cast<size_t>(std::min<uint64_t>(m_changeTotals[index], CHANGES));
+    }
+
+    const WatchList::Change& WatchList::getChange(const size_t index, const size_t age) const {
+        return m_changes[index * CHANGES + (m_changeTotals[index] - 1 - age) % CHANGES];
+    }
+}
@@ -0,0 +1,172 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RUNTIME_WATCH_LIST_H
+#define ADS_RUNTIME_WATCH_LIST_H
+
+/**
+ * @file WatchList.h
+ * @brief Recent history of the game variables the debugger watches
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "GameState.h"
+#include "Value.h"
+
+namespace ADS::Runtime {
+
+    struct Program;
+    class VirtualMachine;
+
+    /**
+     * @brief Samples watched slots of a GameState into fixed-size rings
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each sample reads every watched slot once and keeps two histories
+     * per variable: the last SAMPLES values as floats, for a sparkline,
+     * and the last CHANGES values that differed from the one before, with
+     * the tick they were first seen at. Both are rings in flat arrays, one
+     * block per variable, so sampling allocates nothing and costs a read
+     * and a compare per variable.
+     *
+     * attach() samples from inside a VirtualMachine, every few
+     * instructions, without stopping it. Not thread-safe: read the list
+     * between calls into the machine, e.g. once per frame.
+     */
+    class WatchList {
+    public:
+        static constexpr size_t SAMPLES = 128;                  ///< Samples kept per variable
+        static constexpr size_t CHANGES = 32;                   ///< Changes kept per variable
+        static constexpr uint64_t INSTRUCTIONS_PER_READ = 256;  ///< Instructions per slot read, see samplePeriod()
+
+        /**
+         * @brief A value a variable took, and when
+         */
+        struct Change {
+            uint64_t tick = 0;          ///< Tick of the first sample that saw it
+            Value value;
+        };
+
+        /**
+         * @brief Watch a slot
+         *
+         * @param name Label, e.g. the global's name
+         * @param slot Slot of the GameState
+         * @return size_t Index of the variable
+         */
+        size_t add(std::string name, size_t slot);
+
+        /**
+         * @brief Watch every global of a program, in slot order
+         */
+        void addGlobals(const Program& program);
+
+        /**
+         * @brief Stop watching a variable; the later ones move down an index
+         */
+        void remove(size_t index);
+
+        void clear();
+
+        /**
+         * @brief Read every watched slot
+         *
+         * Slots past the end of the state read as nil.
+         *
+         * @param state State to read
+         * @param tick  When, e.g. the instructions executed so far
+         */
+        void sample(const GameState& state, uint64_t tick);
+
+        /**
+         * @brief Sample a machine's state while it runs
+         *
+         * Replaces the machine's sampler, at samplePeriod(); attach again
+         * after adding many variables. The list must outlive the
+         * attachment; detach with VirtualMachine::setSampler({}).
+         */
+        void attach(VirtualMachine& machine);
+
+        /**
+         * @brief Get the instructions between samples that keep sampling a small fraction of the run
+         *
+         * Reading a slot and recording it costs a few instructions, so
+         * one read per INSTRUCTIONS_PER_READ instructions keeps sampling
+         * at about two percent of the run however many variables are
+         * watched.
+         */
+        [[nodiscard]] uint64_t samplePeriod() const;
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] const std::string& getName(size_t index) const;
+        [[nodiscard]] size_t getSlot(size_t index) const;
+
+        /**
+         * @brief Get the value of the last sample
+         */
+        [[nodiscard]] Value getValue(size_t index) const;
+
+        /**
+         * @brief Get the samples of a variable, as a ring
+         *
+         * The oldest sample is at getSampleOffset(); numbers are stored as
+         * they are, booleans as 0 or 1, and the rest as 0.
+         */
+        [[nodiscard]] std::span<const float> getSamples(size_t index) const;
+
+        /**
+         * @brief Get the position of the oldest sample in every ring
+         */
+        [[nodiscard]] size_t getSampleOffset() const;
+
+        /**
+         * @brief Get the samples taken so far, up to SAMPLES
+         */
+        [[nodiscard]] size_t getSampleCount() const;
+
+        /**
+         * @brief Get the changes of a variable kept, up to CHANGES
+         */
+        [[nodiscard]] size_t getChangeCount(size_t index) const;
+
+        /**
+         * @brief Get a change of a variable
+         *
+         * @param index Variable
+         * @param age   0 for the latest change
+         */
+        [[nodiscard]] const Change& getChange(size_t index, size_t age) const;
+
+    private:
+        std::vector<std::string> m_names;
+        std::vector<size_t> m_slots;
+        std::vector<Value> m_values;            ///< Last sample
+        std::vector<uint64_t> m_changeTotals;   ///< Changes ever seen, by variable; the ring position is total % CHANGES
+        std::vector<float> m_samples;           ///< SAMPLES per variable
+        std::vector<Change> m_changes;          ///< CHANGES per variable
+        size_t m_sampleHead = 0;                ///< Where the next sample goes, in every ring
+        size_t m_sampleCount = 0;
+    };
+
+} // namespace ADS::Runtime
+
+#endif // ADS_RUNTIME_WATCH_LIST_H
@@ -0,0 +1,559 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file AssetManager.cpp
+ * @brief Implementation of the asynchronous texture cache
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "AssetManager.h"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <SDL_image.h>
+#include <blake3.h>
+#include "spdlog/spdlog.h"
+#include "Logger/logger.h"
+#include "Core/AllocationCounter.h"
+
+namespace ADS::UI {
+
+    /**
+     * @brief Header of a decoded image in the disk cache
+     *
+     * Followed by width * height ARGB8888 pixels, rows tightly packed.
+     */
+    struct CachedImageHeader {
+        std::array<char, 4> magic;
+        uint32_t version;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    static constexpr std::array<char, 4> CACHE_MAGIC = {'A', 'D', 'S', 'P'};
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    /**
+     * @brief Read a whole file into memory
+     * @return bool False if the file cannot be read
+     */
+    static bool readFile(const std::filesystem::path& file, std::vector<char>& bytes) {
+        std::ifstream in(file, std::ios::binary | std::ios::ate);
+        if (!in) {
+            return false;
+        }
+        bytes.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        return static_cast<bool>(in.read(bytes.data(), static_cast<std::streamsize>(bytes.size())));
+    }
+
+    /**
+     * @brief Hex-encoded BLAKE3 hash of a buffer
+     */
+    static std::string hashOf(const std::vector<char>& bytes) {
+        blake3_hasher hasher;
+        blake3_hasher_init(&hasher);
+        blake3_hasher_update(&hasher, bytes.data(), bytes.size());
+        std::array<uint8_t, BLAKE3_OUT_LEN> digest;
+        blake3_hasher_finalize(&hasher, digest.data(), digest.size());
+
+        static constexpr char HEX[] = "0123456789abcdef";
+        std::string hex(digest.size() * 2, '0');
+        for (size_t i = 0; i < digest.size(); ++i) {
+            hex[2 * i] = HEX[digest[i] >> 4];
+            hex[2 * i + 1] = HEX[digest[i] & 0x0F];
+        }
+        return hex;
+    }
+
+    /**
+     * @brief Load decoded pixels from the disk cache
+     * @return SDL_Surface* nullptr if the entry is missing or damaged
+     */
+    static SDL_Surface* readCachedImage(const std::filesystem::path& file) {
+        std::ifstream in(file, std::ios::binary);
+        CachedImageHeader header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION
+            || header.width == 0 || header.height == 0) {
+            return nullptr;
+        }
+
+        SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, static_cast<int>(header.width),
+                                                              static_cast<int>(header.height), 32,
+                                                              SDL_PIXELFORMAT_ARGB8888);
+        if (surface == nullptr) {
+            return nullptr;
+        }
+        const auto rowBytes = static_cast<std::streamsize>(header.width) * 4;
+        for (uint32_t y = 0; y < header.height; ++y) {
+            if (!in.read(static_cast<char*>(surface->pixels) + static_cast<size_t>(y) * surface->pitch, rowBytes)) {
+                SDL_FreeSurface(surface);
+                return nullptr;
+            }
+        }
+        return surface;
+    }
+
+    /**
+     * @brief Store decoded pixels in the disk cache
+     *
+     * Best effort: a failure only costs a decode on the next run. The
+     * entry is written under a private name and renamed into place, so a
+     * reader, or a worker storing the same image, never sees half a file.
+     */
+    static void writeCachedImage(const std::filesystem::path& file, const SDL_Surface* surface) {
+        std::error_code error;
+        std::filesystem::create_directories(file.parent_path(), error);
+
+        std::filesystem::path temporary = file;
+        temporary += std::format(".{}.tmp", std::hash<std::thread::id>()(std::this_thread::get_id()));
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            const CachedImageHeader header{CACHE_MAGIC, CACHE_VERSION,
+                                           static_cast<uint32_t>(surface->w), static_cast<uint32_t>(surface->h)};
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (int y = 0; y < surface->h; ++y) {
+                out.write(static_cast<const char*>(surface->pixels) + static_cast<size_t>(y) * surface->pitch,
+                          static_cast<std::streamsize>(surface->w) * 4);
+            }
+            if (!out) {
+                out.close();
+                std::filesystem::remove(temporary, error);
+                return;
+            }
+        }
+        std::filesystem::rename(temporary, file, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+        }
+    }
+
+    /**
+     * @brief Shrink an ARGB8888 surface so its longest side is maxSize
+     *
+     * Each target pixel averages the source pixels it covers, which keeps
+     * thumbnails of detailed backgrounds from aliasing the way a nearest
+     * neighbour blit would.
+     *
+     * @return SDL_Surface* The scaled copy, or nullptr if no scaling is needed
+     */
+    static SDL_Surface* downscale(const SDL_Surface* source, int maxSize) {
+        const int longest = std::max(source->w, source->h);
+        if (maxSize <= 0 || longest <= maxSize) {
+            return nullptr;
+        }
+        const int width = std::max(1, source->w * maxSize / longest);
+        const int height = std::max(1, source->h * maxSize / longest);
+        SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+        if (target == nullptr) {
+            return nullptr;
+        }
+
+        for (int y = 0; y < height; ++y) {
+            const int top = y * source->h / height;
+            const int bottom = std::max(top + 1, (y + 1) * source->h / height);
+            auto* out = reinterpret_cast<uint32_t*>(static_cast<char*>(target->pixels) + static_cast<size_t>(y) * target->pitch);
+            for (int x = 0; x < width; ++x) {
+                const int left = x * source->w / width;
+                const int right = std::max(left + 1, (x + 1) * source->w / width);
+                uint64_t sum[4] = {0, 0, 0, 0};
+                for (int sy = top; sy < bottom; ++sy) {
+                    const auto* row = reinterpret_cast<const uint32_t*>(
+                        static_cast<const char*>(source->pixels) + static_cast<size_t>(sy) * source->pitch);
+                    for (int sx = left; sx < right; ++sx) {
+                        for (int channel = 0; channel < 4; ++channel) {
+                            sum[channel] += (row[sx] >> (8 * channel)) & 0xFF;
+                        }
+                    }
+                }
+                const uint64_t count = static_cast<uint64_t>(bottom - top) * static_cast<uint64_t>(right - left);
+                uint32_t pixel = 0;
+                for (int channel = 0; channel < 4; ++channel) {
+                    pixel |= static_cast<uint32_t>(sum[channel] / count) << (8 * channel);
+                }
+                out[x] = pixel;
+            }
+        }
+        return target;
+    }
+
+    /**
+     * @brief Create the manager and start its decoding threads
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The image codecs are initialised here, on the main thread, so the
+     * workers never race on their lazy initialisation. Decoding is mostly
+     * bound by inflate and disk reads, so by default half of the cores are
+     * used, leaving the rest to the UI and the other background tasks.
+     *
+     * @param renderer Render backend the textures are created with (must not be nullptr)
+     * @param root     Directory relative asset paths are resolved against
+     * @param settings Budgets and thread count
+     * @throws std::invalid_argument if renderer is nullptr
+     */
+    AssetManager::AssetManager(RenderBackend* renderer, std::filesystem::path root, Settings settings)
+        : m_renderer(renderer),
+          m_root(std::move(root)),
+          m_settings(std::move(settings)),
+          m_residentBytes(0),
+          m_pendingCount(0),
+          m_frame(0),
+          m_stopping(false) {
+        if (m_renderer == nullptr) {
+            throw std::invalid_argument("AssetManager: renderer cannot be nullptr");
+        }
+        IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG);
+
+        const unsigned threads = m_settings.threads > 0
+            ? m_settings.threads
+            : std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+        for (unsigned i = 0; i < threads; ++i) {
+            m_workers.emplace_back(&AssetManager::run, this);
+        }
+    }
+
+    AssetManager::AssetManager(RenderBackend* renderer, std::filesystem::path root)
+        : AssetManager(renderer, std::move(root), Settings()) {
+    }
+
+    AssetManager::~AssetManager() {
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_stopping = true;
+        }
+        m_queueSignal.notify_all();
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+
+        for (DecodedImage& image : m_decoded) {
+            SDL_FreeSurface(image.surface);
+        }
+        for (DecodedImage& image : m_uploads) {
+            SDL_FreeSurface(image.surface);
+        }
+        for (Content& content : m_contents) {
+            m_renderer->destroyTexture(content.texture);
+        }
+        IMG_Quit();
+    }
+
+    TextureHandle AssetManager::acquire(const std::string& path, int maxSize) {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Assets);
+        maxSize = std::max(0, maxSize);
+        std::string key = std::format("{}@{}", path, maxSize);
+        if (const auto it = m_byPath.find(key); it != m_byPath.end()) {
+            Slot& slot = m_slots[it->second];
+            ++slot.references;
+            return {it->second, slot.generation};
+        }
+
+        uint32_t index;
+        if (!m_freeSlots.empty()) {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        Slot& slot = m_slots[index];
+        slot.key = key;
+        slot.references = 1;
+        slot.state = AssetState::Loading;
+        m_byPath.emplace(std::move(key), index);
+        ++m_pendingCount;
+
+        const std::filesystem::path file(path);
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_jobs.push_back({index, slot.generation, file.is_absolute() ? file : m_root / file, maxSize});
+        }
+        m_queueSignal.notify_one();
+        return {index, slot.generation};
+    }
+
+    void AssetManager::release(TextureHandle handle) {
+        if (find(handle) == nullptr) {
+            return;
+        }
+        Slot& slot = m_slots[handle.index()];
+        if (slot.references == 0 || --slot.references > 0) {
+            return;
+        }
+
+        switch (slot.state) {
+            case AssetState::Loading: {
+                // Nobody waits for it any more; a decode already in flight is dropped by update()
+                std::lock_guard lock(m_queueMutex);
+                std::erase_if(m_jobs, [&handle](const DecodeJob& job) {
+                    return job.index == handle.index() && job.generation == handle.generation();
+                });
+                --m_pendingCount;
+                freeSlot(handle.index());
+                break;
+            }
+            case AssetState::Failed:
+                freeSlot(handle.index());       // Let a later acquire() retry
+                break;
+            case AssetState::Ready:
+                slot.releasedAt = m_frame;
+                break;
+        }
+    }
+
+    /**
+     * @brief Upload decoded images and evict unused textures
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Images whose last reference was released while they were decoding,
+     * and images whose pixels are already resident under another path,
+     * cost nothing against the upload budget. Whatever is left over the
+     * budget waits for the next frame, oldest first.
+     */
+    void AssetManager::update() {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Assets);
+        ++m_frame;
+        {
+            std::lock_guard lock(m_decodedMutex);
+            std::move(m_decoded.begin(), m_decoded.end(), std::back_inserter(m_uploads));
+            m_decoded.clear();
+        }
+
+        size_t uploaded = 0;
+        while (!m_uploads.empty() && (uploaded == 0 || uploaded < m_settings.uploadBytesPerFrame)) {
+            DecodedImage image = std::move(m_uploads.front());
+            m_uploads.pop_front();
+
+            Slot& slot = m_slots[image.index];
+            if (slot.generation != image.generation || slot.key.empty()) {
+                SDL_FreeSurface(image.surface);
+                continue;
+            }
+
+            --m_pendingCount;
+            uploaded += attach(slot, image);
+            if (slot.content != NO_CONTENT) {
+                slot.state = AssetState::Ready;
+            } else {
+                slot.state = AssetState::Failed;
+                ADS_LOG_WARN(Io, "AssetManager: cannot load {} — {}", slot.key, image.error);
+            }
+        }
+
+        evict();
+    }
+
+    size_t AssetManager::attach(Slot& slot, DecodedImage& image) {
+        if (const auto it = m_byContent.find(image.contentKey); it != m_byContent.end()) {
+            SDL_FreeSurface(image.surface);
+            slot.content = it->second;
+            ++m_contents[it->second].users;
+            return 0;
+        }
+        if (image.surface == nullptr) {
+            return 0;
+        }
+
+        const ImTextureID texture = m_renderer->createTexture(image.surface);
+        if (texture == 0) {
+            image.error = SDL_GetError();
+            SDL_FreeSurface(image.surface);
+            return 0;
+        }
+
+        uint32_t index;
+        if (!m_freeContents.empty()) {
+            index = m_freeContents.back();
+            m_freeContents.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_contents.size());
+            m_contents.emplace_back();
+        }
+        Content& content = m_contents[index];
+        content.key = image.contentKey;
+        content.texture = texture;
+        content.width = image.surface->w;
+        content.height = image.surface->h;
+        content.bytes = static_cast<size_t>(image.surface->pitch) * static_cast<size_t>(image.surface->h);
+        content.users = 1;
+        SDL_FreeSurface(image.surface);
+
+        m_byContent.emplace(content.key, index);
+        m_residentBytes += content.bytes;
+        slot.content = index;
+        return content.bytes;
+    }
+
+    /**
+     * @brief Worker body: decode queued images until stopped
+     */
+    void AssetManager::run() {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Assets);
+        for (;;) {
+            DecodeJob job;
+            {
+                std::unique_lock lock(m_queueMutex);
+                m_queueSignal.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                if (m_stopping) {
+                    return;
+                }
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            DecodedImage image = load(job);
+            std::lock_guard lock(m_decodedMutex);
+            m_decoded.push_back(std::move(image));
+        }
+    }
+
+    /**
+     * @brief Read, hash and decode one image, going through the disk cache
+     *
+     * The file is hashed from memory and decoded from the same buffer, so
+     * it is read once. Surfaces are converted to 32-bit ARGB, the native
+     * texture format of the common renderers, so the upload on the main
+     * thread is a straight copy; the disk cache stores that same layout.
+     */
+    AssetManager::DecodedImage AssetManager::load(const DecodeJob& job) const {
+        DecodedImage image{job.index, job.generation, {}, nullptr, {}};
+
+        std::vector<char> bytes;
+        if (!readFile(job.file, bytes)) {
+            image.error = "cannot read " + job.file.string();
+            return image;
+        }
+        image.contentKey = std::format("{}-{}", hashOf(bytes), job.maxSize);
+
+        const std::filesystem::path cached = m_settings.cacheDirectory.empty()
+            ? std::filesystem::path()
+            : m_settings.cacheDirectory / image.contentKey.substr(0, 2) / (image.contentKey + ".pixels");
+        if (!cached.empty() && (image.surface = readCachedImage(cached)) != nullptr) {
+            return image;
+        }
+
+        SDL_Surface* loaded = IMG_Load_RW(SDL_RWFromConstMem(bytes.data(), static_cast<int>(bytes.size())), 1);
+        if (loaded == nullptr) {
+            image.error = IMG_GetError();
+            return image;
+        }
+        image.surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(loaded);
+        if (image.surface == nullptr) {
+            image.error = SDL_GetError();
+            return image;
+        }
+        if (SDL_Surface* scaled = downscale(image.surface, job.maxSize)) {
+            SDL_FreeSurface(image.surface);
+            image.surface = scaled;
+        }
+
+        if (!cached.empty()) {
+            writeCachedImage(cached, image.surface);
+        }
+        return image;
+    }
+
+    const AssetManager::Slot* AssetManager::find(TextureHandle handle) const {
+        if (!handle.isValid() || handle.index() >= m_slots.size()) {
+            return nullptr;
+        }
+        const Slot& slot = m_slots[handle.index()];
+        return slot.generation == handle.generation() && !slot.key.empty() ? &slot : nullptr;
+    }
+
+    void AssetManager::freeSlot(uint32_t index) {
+        Slot& slot = m_slots[index];
+        if (slot.content != NO_CONTENT && --m_contents[slot.content].users == 0) {
+            Content& content = m_contents[slot.content];
+            m_renderer->destroyTexture(content.texture);
+            m_residentBytes -= content.bytes;
+            m_byContent.erase(content.key);
+            content = Content();
+            m_freeContents.push_back(slot.content);
+        }
+        m_byPath.erase(slot.key);
+
+        const uint32_t generation = slot.generation + 1;
+        slot = Slot();
+        slot.generation = generation == 0 ? 1 : generation;
+        m_freeSlots.push_back(index);
+    }
+
+    /**
+     * @brief Evict unreferenced textures while over the cache budget
+     *
+     * The scan is linear, but it only runs while over budget, and an
+     * editor keeps at most a few thousand images around. A slot sharing
+     * its content with a referenced one frees no memory, but is dropped
+     * anyway: it costs nothing to reload while the content is resident.
+     */
+    void AssetManager::evict() {
+        while (m_residentBytes > m_settings.cacheBytes) {
+            uint32_t victim = 0;
+            const Slot* oldest = nullptr;
+            for (uint32_t i = 0; i < m_slots.size(); ++i) {
+                const Slot& slot = m_slots[i];
+                if (slot.references == 0 && slot.content != NO_CONTENT
+                    && (oldest == nullptr || slot.releasedAt < oldest->releasedAt)) {
+                    victim = i;
+                    oldest = &slot;
+                }
+            }
+            if (oldest == nullptr) {
+                return;     // Everything resident is in use
+            }
+            freeSlot(victim);
+        }
+    }
+
+    ImTextureID AssetManager::getTexture(TextureHandle handle) const {
+        const Slot* slot = find(handle);
+        return slot != nullptr && slot->content != NO_CONTENT ? m_contents[slot->content].texture : 0;
+    }
+
+    AssetState AssetManager::getState(TextureHandle handle) const {
+        const Slot* slot = find(handle);
+        return slot != nullptr ? slot->state : AssetState::Failed;
+    }
+
+    void AssetManager::getSize(TextureHandle handle, int& width, int& height) const {
+        const Slot* slot = find(handle);
+        const bool ready = slot != nullptr && slot->content != NO_CONTENT;
+        width = ready ? m_contents[slot->content].width : 0;
+        height = ready ? m_contents[slot->content].height : 0;
+    }
+
+    size_t AssetManager::getResidentBytes() const {
+        return m_residentBytes;
+    }
+
+    size_t AssetManager::getPendingCount() const {
+        return m_pendingCount;
+    }
+
+} // namespace ADS::UI
@@ -0,0 +1,341 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_ASSET_MANAGER_H
+#define ADS_ASSET_MANAGER_H
+
+/**
+ * @file AssetManager.h
+ * @brief Streams image assets into SDL textures without blocking the UI
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Reading and decoding an image file takes milliseconds to tens of
+ * milliseconds, far more than a frame can spare. Files are therefore
+ * decoded into surfaces on worker threads, and update() turns the
+ * decoded surfaces into textures on the main thread, which is the only
+ * thread allowed to use the render backend. Uploads are capped per frame so
+ * that opening a scene with many sprites does not hitch either.
+ *
+ * Textures are reference counted. A texture nobody holds stays cached
+ * until the resident size exceeds the cache budget, and then the least
+ * recently released ones are evicted first.
+ *
+ * Images are identified by the BLAKE3 hash of their file contents, not by
+ * their path: the same background saved under several names is decoded
+ * once and shares one texture. Decoded, and possibly downscaled, pixels
+ * are also kept in an on-disk cache named after that hash, so reopening a
+ * project reads raw pixels instead of decoding its images again.
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+
+#include "RenderBackend.h"
+
+namespace ADS::UI {
+
+    /**
+     * @brief Slot index + generation of a texture in an AssetManager
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Generations start at 1, so a default-constructed handle never
+     * matches a live texture. Each handle returned by acquire() holds one
+     * reference and must be given back with release().
+     */
+    class TextureHandle {
+    private:
+        uint32_t m_index = 0;
+        uint32_t m_generation = 0;
+
+    public:
+        constexpr TextureHandle() = default;
+
+        constexpr TextureHandle(uint32_t index, uint32_t generation)
+            : m_index(index), m_generation(generation) {
+        }
+
+        /// Position in the manager's slot table
+        [[nodiscard]] constexpr uint32_t index() const {
+            return m_index;
+        }
+
+        /// Generation of the slot when the handle was issued
+        [[nodiscard]] constexpr uint32_t generation() const {
+            return m_generation;
+        }
+
+        /// True unless default-constructed; says nothing about liveness
+        [[nodiscard]] constexpr bool isValid() const {
+            return m_generation != 0;
+        }
+
+        constexpr bool operator==(const TextureHandle&) const = default;
+    };
+
+    /**
+     * @brief Loading state of an acquired texture
+     */
+    enum class AssetState : uint8_t {
+        Loading,    ///< Queued, decoding or waiting for its upload
+        Ready,      ///< Texture available through getTexture()
+        Failed      ///< File missing or not a supported image
+    };
+
+    /**
+     * @brief Asynchronous, reference-counted texture cache
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * All public methods must be called from the main thread. The manager
+     * must be destroyed before the render backend it uploads to.
+     */
+    class AssetManager {
+    public:
+        /**
+         * @brief Tuning knobs of the manager
+         */
+        struct Settings {
+            size_t uploadBytesPerFrame = 16u << 20;    ///< Pixel bytes turned into textures per update(); at least one image is always uploaded
+            size_t cacheBytes = 256u << 20;            ///< Resident size above which unreferenced textures are evicted
+            unsigned threads = 0;                      ///< Decoding threads; 0 picks from the core count
+            std::filesystem::path cacheDirectory;      ///< Where decoded pixels are kept between runs; empty disables the disk cache
+        };
+
+        /**
+         * @brief Create the manager and start its decoding threads
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param renderer Render backend the textures are created with (must not be nullptr)
+         * @param root     Directory relative asset paths are resolved against
+         * @param settings Budgets and thread count
+         * @throws std::invalid_argument if renderer is nullptr
+         */
+        AssetManager(RenderBackend* renderer, std::filesystem::path root, Settings settings);
+
+        /**
+         * @brief Create the manager with the default settings
+         *
+         * @param renderer Render backend the textures are created with (must not be nullptr)
+         * @param root     Directory relative asset paths are resolved against
+         */
+        AssetManager(RenderBackend* renderer, std::filesystem::path root);
+
+        /**
+         * @brief Stop the decoding threads and destroy every texture
+         */
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        /**
+         * @brief Take a reference to the texture of an image file
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Never touches the disk: a cached texture is returned at once,
+         * anything else is queued for decoding and reported as Loading
+         * until a later update() uploads it.
+         *
+         * @param path    Image path, relative to the asset root or absolute
+         * @param maxSize Longest side of the texture in pixels, e.g. for
+         *                thumbnails; larger images are downscaled. 0 keeps
+         *                the original size
+         * @return TextureHandle Handle holding one reference
+         */
+        TextureHandle acquire(const std::string& path, int maxSize = 0);
+
+        /**
+         * @brief Give back a reference taken by acquire()
+         *
+         * A texture still loading when its last reference goes is dropped
+         * from the queue; a loaded one stays cached until evicted.
+         *
+         * @param handle Handle returned by acquire(); invalid handles are ignored
+         */
+        void release(TextureHandle handle);
+
+        /**
+         * @brief Upload decoded images and evict unused textures
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Call once per frame, before the UI is drawn.
+         */
+        void update();
+
+        /**
+         * @brief Get the texture of a handle
+         * @param handle Handle returned by acquire()
+         * @return ImTextureID The texture, or 0 unless Ready
+         */
+        [[nodiscard]] ImTextureID getTexture(TextureHandle handle) const;
+
+        /**
+         * @brief Get the loading state of a handle
+         * @param handle Handle returned by acquire()
+         * @return AssetState Failed for stale or invalid handles
+         */
+        [[nodiscard]] AssetState getState(TextureHandle handle) const;
+
+        /**
+         * @brief Get the pixel size of a Ready texture
+         * @param handle Handle returned by acquire()
+         * @param width  Receives the width, 0 unless Ready
+         * @param height Receives the height, 0 unless Ready
+         */
+        void getSize(TextureHandle handle, int& width, int& height) const;
+
+        /**
+         * @brief Get the pixel bytes currently held by textures
+         *
+         * Identical images loaded under different paths count once.
+         *
+         * @return size_t Resident size, referenced or not
+         */
+        [[nodiscard]] size_t getResidentBytes() const;
+
+        /**
+         * @brief Get the number of images still waiting for a texture
+         * @return size_t Images queued, decoding or waiting for upload
+         */
+        [[nodiscard]] size_t getPendingCount() const;
+
+    private:
+        static constexpr uint32_t NO_CONTENT = UINT32_MAX;     ///< Slot::content before the image is loaded
+
+        /**
+         * @brief Bookkeeping of one requested path and size
+         */
+        struct Slot {
+            std::string key;                    ///< Key in m_byPath; empty while free
+            uint32_t generation = 1;            ///< Bumped whenever the slot is freed
+            uint32_t references = 0;            ///< Outstanding acquire() handles
+            AssetState state = AssetState::Loading;
+            uint32_t content = NO_CONTENT;      ///< Index into m_contents once Ready
+            uint64_t releasedAt = 0;            ///< Frame the last reference went, for eviction order
+        };
+
+        /**
+         * @brief One uploaded texture, shared by every slot with the same pixels
+         */
+        struct Content {
+            std::string key;                    ///< Key in m_byContent: content hash and size
+            ImTextureID texture = 0;
+            int width = 0;
+            int height = 0;
+            size_t bytes = 0;                   ///< Pixel bytes of texture
+            uint32_t users = 0;                 ///< Slots pointing here
+        };
+
+        /**
+         * @brief Image waiting for a decoding thread
+         */
+        struct DecodeJob {
+            uint32_t index;
+            uint32_t generation;
+            std::filesystem::path file;
+            int maxSize;
+        };
+
+        /**
+         * @brief Image decoded by a worker, waiting for its upload
+         */
+        struct DecodedImage {
+            uint32_t index;
+            uint32_t generation;
+            std::string contentKey;             ///< Content hash and size, as in Content::key
+            SDL_Surface* surface;               ///< nullptr if loading failed
+            std::string error;
+        };
+
+        /**
+         * @brief Worker body: decode queued images until stopped
+         */
+        void run();
+
+        /**
+         * @brief Read, hash and decode one image, going through the disk cache
+         */
+        [[nodiscard]] DecodedImage load(const DecodeJob& job) const;
+
+        /**
+         * @brief Resolve a handle to its slot
+         * @return Slot* nullptr for stale or invalid handles
+         */
+        [[nodiscard]] const Slot* find(TextureHandle handle) const;
+
+        /**
+         * @brief Drop a slot's content and put it on the free list
+         */
+        void freeSlot(uint32_t index);
+
+        /**
+         * @brief Point a slot at the content for a decoded image, uploading it if new
+         * @return size_t Bytes uploaded, 0 if the content was already resident
+         */
+        size_t attach(Slot& slot, DecodedImage& image);
+
+        /**
+         * @brief Evict unreferenced textures while over the cache budget
+         */
+        void evict();
+
+        RenderBackend* m_renderer;
+        std::filesystem::path m_root;
+        Settings m_settings;
+
+        std::vector<Slot> m_slots;                              ///< Indexed by TextureHandle::index()
+        std::vector<uint32_t> m_freeSlots;                      ///< Slots available for reuse
+        std::unordered_map<std::string, uint32_t> m_byPath;     ///< Live slot of each path and size
+        std::vector<Content> m_contents;
+        std::vector<uint32_t> m_freeContents;                   ///< Contents available for reuse
+        std::unordered_map<std::string, uint32_t> m_byContent;  ///< Resident content of each hash and size
+        size_t m_residentBytes;
+        size_t m_pendingCount;
+        uint64_t m_frame;                                       ///< update() calls so far
+
+        std::mutex m_queueMutex;                                ///< Guards m_jobs and m_stopping
+        std::condition_variable m_queueSignal;                  ///< Wakes workers on new jobs or stop
+        std::deque<DecodeJob> m_jobs;
+        bool m_stopping;
+
+        std::mutex m_decodedMutex;                              ///< Guards m_decoded
+        std::vector<DecodedImage> m_decoded;                    ///< Oldest first
+
+        std::deque<DecodedImage> m_uploads;                     ///< Collected from m_decoded, over the frame budget
+
+        std::vector<std::thread> m_workers;
+    };
+
+} // namespace ADS::UI
+
+#endif // ADS_ASSET_MANAGER_H
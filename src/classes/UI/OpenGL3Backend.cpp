@@ -0,0 +1,164 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file OpenGL3Backend.cpp
+ * @brief Implementation of the OpenGL 3 render backend
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "OpenGL3Backend.h"
+
+#include <SDL_opengl.h>
+
+#include "ViewportThrottle.h"
+#include "Window.h"
+#include "imgui_impl_opengl3.h"
+#include "imgui_impl_sdl2.h"
+
+namespace ADS::UI {
+    namespace {
+#if defined(__APPLE__)
+        constexpr const char* GLSL_VERSION = "#version 150";
+#else
+        constexpr const char* GLSL_VERSION = "#version 130";
+#endif
+    }
+
+    OpenGL3Backend::OpenGL3Backend(Window& window)
+        : m_window(window.getWindow()),
+          m_context(window.getGLContext()) {
+    }
+
+    void OpenGL3Backend::setContextAttributes() {
+#if defined(__APPLE__)
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_FORWARD_COMPATIBLE_FLAG);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 2);
+#else
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, 0);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
+#endif
+        SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+        SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+        SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+    }
+
+    const char* OpenGL3Backend::getName() const {
+        return "opengl3";
+    }
+
+    void OpenGL3Backend::init() {
+        ImGui_ImplSDL2_InitForOpenGL(m_window, m_context);
+        ImGui_ImplOpenGL3_Init(GLSL_VERSION);
+    }
+
+    void OpenGL3Backend::newFrame() {
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui_ImplSDL2_NewFrame();
+    }
+
+    void OpenGL3Backend::renderDrawData(ImDrawData* drawData) {
+        int width = 0;
+        int height = 0;
+        getOutputSize(width, height);
+        glViewport(0, 0, width, height);
+        glClearColor(CLEAR_COLOR.x, CLEAR_COLOR.y, CLEAR_COLOR.z, CLEAR_COLOR.w);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData(drawData);
+    }
+
+    void OpenGL3Backend::renderPlatformWindows(ViewportThrottle& throttle) {
+        // Platform windows make their own contexts current while drawing
+        SDL_Window* currentWindow = SDL_GL_GetCurrentWindow();
+        SDL_GLContext currentContext = SDL_GL_GetCurrentContext();
+        ImGui::UpdatePlatformWindows();
+        throttle.render();
+        SDL_GL_MakeCurrent(currentWindow, currentContext);
+    }
+
+    void OpenGL3Backend::present() {
+        SDL_GL_SwapWindow(m_window);
+    }
+
+    void OpenGL3Backend::destroyFontsTexture() {
+        ImGui_ImplOpenGL3_DestroyFontsTexture();
+    }
+
+    void OpenGL3Backend::shutdown() {
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui_ImplSDL2_Shutdown();
+    }
+
+    void OpenGL3Backend::getOutputSize(int& width, int& height) const {
+        SDL_GL_GetDrawableSize(m_window, &width, &height);
+    }
+
+    ImTextureID OpenGL3Backend::createTexture(SDL_Surface* surface) {
+        SDL_Surface* rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        if (rgba == nullptr) {
+            return 0;
+        }
+
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        // Rows of a converted surface may be padded past width * 4 bytes
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, rgba->pitch / 4);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, rgba->w, rgba->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba->pixels);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        SDL_FreeSurface(rgba);
+
+        if (glGetError() != GL_NO_ERROR) {
+            glDeleteTextures(1, &texture);
+            SDL_SetError("glTexImage2D failed");
+            return 0;
+        }
+        return static_cast<ImTextureID>(texture);
+    }
+
+    bool OpenGL3Backend::updateTexture(const ImTextureID texture, const SDL_Rect& area, SDL_Surface* surface) {
+        SDL_Surface* rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        if (rgba == nullptr) {
+            return false;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(texture));
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, rgba->pitch / 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, area.x, area.y, area.w, area.h, GL_RGBA, GL_UNSIGNED_BYTE, rgba->pixels);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        SDL_FreeSurface(rgba);
+
+        if (glGetError() != GL_NO_ERROR) {
+            SDL_SetError("glTexSubImage2D failed");
+            return false;
+        }
+        return true;
+    }
+
+    void OpenGL3Backend::destroyTexture(const ImTextureID texture) {
+        if (texture != 0) {
+            const auto name = static_cast<GLuint>(texture);
+            glDeleteTextures(1, &name);
+        }
+    }
+}
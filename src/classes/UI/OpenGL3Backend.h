@@ -0,0 +1,61 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_OPENGL3_BACKEND_H
+#define ADS_OPENGL3_BACKEND_H
+
+#include "RenderBackend.h"
+
+namespace ADS::UI {
+    /**
+     * @brief Render backend over an OpenGL 3 context
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Selected with RENDERER=opengl3. Textures are GL texture names, so the
+     * scene previews can render into them and sample them in shaders; the
+     * window owns the context and this backend only draws with it.
+     */
+    class OpenGL3Backend : public RenderBackend {
+    public:
+        explicit OpenGL3Backend(Window& window);
+
+        /**
+         * @brief Ask SDL for the context this backend draws with
+         *
+         * Must be called before the window is created: GL 3.0 core, or 3.2
+         * forward-compatible on macOS, double-buffered with depth and
+         * stencil.
+         */
+        static void setContextAttributes();
+
+        [[nodiscard]] const char* getName() const override;
+        void init() override;
+        void newFrame() override;
+        void renderDrawData(ImDrawData* drawData) override;
+        void renderPlatformWindows(ViewportThrottle& throttle) override;
+        void present() override;
+        void destroyFontsTexture() override;
+        void shutdown() override;
+        void getOutputSize(int& width, int& height) const override;
+        [[nodiscard]] ImTextureID createTexture(SDL_Surface* surface) override;
+        bool updateTexture(ImTextureID texture, const SDL_Rect& area, SDL_Surface* surface) override;
+        void destroyTexture(ImTextureID texture) override;
+
+    private:
+        SDL_Window* m_window;
+        SDL_GLContext m_context;
+    };
+}
+
+#endif // ADS_OPENGL3_BACKEND_H
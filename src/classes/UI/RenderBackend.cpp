@@ -0,0 +1,47 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file RenderBackend.cpp
+ * @brief Selection of the render backend
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "RenderBackend.h"
+
+#include <spdlog/spdlog.h>
+#include "Logger/logger.h"
+
+#include "Window.h"
+#include "OpenGL3Backend.h"
+#include "SdlRendererBackend.h"
+
+namespace ADS::UI {
+    RendererKind parseRendererKind(const std::string_view name) {
+        if (name == "opengl3") {
+            return RendererKind::OpenGL3;
+        }
+        if (name != "sdl" && !name.empty()) {
+            ADS_LOG_WARN(Ui, "Unknown RENDERER '{}', using sdl", name);
+        }
+        return RendererKind::SdlRenderer;
+    }
+
+    std::unique_ptr<RenderBackend> RenderBackend::create(Window& window) {
+        if (window.getGLContext() != nullptr) {
+            return std::make_unique<OpenGL3Backend>(window);
+        }
+        return std::make_unique<SdlRendererBackend>(window);
+    }
+}
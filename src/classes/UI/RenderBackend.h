@@ -0,0 +1,164 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_RENDER_BACKEND_H
+#define ADS_RENDER_BACKEND_H
+
+/**
+ * @file RenderBackend.h
+ * @brief Graphics API the ImGui frames and the textures go through
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * The renderer is chosen in `.env` with RENDERER: `sdl` for SDL_Renderer,
+ * the default, or `opengl3`. Window creates the device of the chosen
+ * renderer, an SDL_Renderer or an OpenGL context, and the RenderBackend
+ * that drives it; App, the asset manager and the panels only see this
+ * interface.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include <SDL.h>
+
+#include "imgui.h"
+
+namespace ADS::UI {
+    class ViewportThrottle;
+    class Window;
+
+    /**
+     * @brief Renderer a window is created for
+     */
+    enum class RendererKind : uint8_t {
+        SdlRenderer,
+        OpenGL3
+    };
+
+    /**
+     * @brief Read a RENDERER setting
+     *
+     * @param name `sdl` or `opengl3`; anything else selects SDL_Renderer with a warning
+     * @return RendererKind The renderer named
+     */
+    [[nodiscard]] RendererKind parseRendererKind(std::string_view name);
+
+    /**
+     * @brief ImGui renderer backend and texture factory of a window
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Every method must be called on the main thread, with the window's
+     * device current.
+     */
+    class RenderBackend {
+    public:
+        virtual ~RenderBackend() = default;
+
+        /**
+         * @brief Make the backend of the renderer a window was created for
+         *
+         * @param window Window whose device is already created
+         * @return std::unique_ptr<RenderBackend> The backend, not initialised yet
+         */
+        [[nodiscard]] static std::unique_ptr<RenderBackend> create(Window& window);
+
+        /**
+         * @brief Get the renderer name, as written in `.env`
+         */
+        [[nodiscard]] virtual const char* getName() const = 0;
+
+        /**
+         * @brief Initialise the ImGui platform and renderer backends
+         *
+         * Called once the ImGui context exists and the fonts are loaded.
+         */
+        virtual void init() = 0;
+
+        /**
+         * @brief Start a frame of the ImGui platform and renderer backends
+         */
+        virtual void newFrame() = 0;
+
+        /**
+         * @brief Clear the window and draw ImGui's draw data into it
+         */
+        virtual void renderDrawData(ImDrawData* drawData) = 0;
+
+        /**
+         * @brief Update the multi-viewport platform windows and draw the ones due
+         * @param throttle Picks the windows that changed and are due to be drawn
+         */
+        virtual void renderPlatformWindows(ViewportThrottle& throttle) = 0;
+
+        /**
+         * @brief Show the frame drawn by renderDrawData()
+         */
+        virtual void present() = 0;
+
+        /**
+         * @brief Release the font texture, for the next frame to upload the new atlas
+         */
+        virtual void destroyFontsTexture() = 0;
+
+        /**
+         * @brief Shut the ImGui platform and renderer backends down
+         *
+         * Textures made by createTexture() can still be destroyed after
+         * this, until the window's device is.
+         */
+        virtual void shutdown() = 0;
+
+        /**
+         * @brief Get the size of the window in pixels of the device
+         *
+         * @param width  Drawable width, larger than the window's on high-DPI displays
+         * @param height Drawable height
+         */
+        virtual void getOutputSize(int& width, int& height) const = 0;
+
+        /**
+         * @brief Upload an image for ImGui::Image()
+         *
+         * @param surface Pixels in any format; not modified
+         * @return ImTextureID The texture, or 0 with SDL_GetError() set
+         */
+        [[nodiscard]] virtual ImTextureID createTexture(SDL_Surface* surface) = 0;
+
+        /**
+         * @brief Replace the pixels of part of a texture
+         *
+         * @param texture Texture made by createTexture()
+         * @param area    Region of the texture, inside its bounds
+         * @param surface Pixels of the region, the size of @p area, in any format
+         * @return bool False with SDL_GetError() set if the upload failed
+         */
+        virtual bool updateTexture(ImTextureID texture, const SDL_Rect& area, SDL_Surface* surface) = 0;
+
+        /**
+         * @brief Release a texture made by createTexture()
+         */
+        virtual void destroyTexture(ImTextureID texture) = 0;
+
+    protected:
+        /**
+         * Colour the window is cleared to behind the dock space
+         */
+        static constexpr ImVec4 CLEAR_COLOR = ImVec4(45.0f / 255.0f, 45.0f / 255.0f, 48.0f / 255.0f, 1.0f);
+    };
+}
+
+#endif // ADS_RENDER_BACKEND_H
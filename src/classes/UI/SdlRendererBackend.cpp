@@ -0,0 +1,110 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file SdlRendererBackend.cpp
+ * @brief Implementation of the SDL_Renderer render backend
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "SdlRendererBackend.h"
+
+#include "ViewportThrottle.h"
+#include "Window.h"
+#include "imgui_impl_sdl2.h"
+#include "imgui_impl_sdlrenderer2.h"
+
+namespace ADS::UI {
+    SdlRendererBackend::SdlRendererBackend(Window& window)
+        : m_window(window.getWindow()),
+          m_renderer(window.getRenderer()) {
+    }
+
+    const char* SdlRendererBackend::getName() const {
+        return "sdl";
+    }
+
+    void SdlRendererBackend::init() {
+        ImGui_ImplSDL2_InitForSDLRenderer(m_window, m_renderer);
+        ImGui_ImplSDLRenderer2_Init(m_renderer);
+    }
+
+    void SdlRendererBackend::newFrame() {
+        ImGui_ImplSDLRenderer2_NewFrame();
+        ImGui_ImplSDL2_NewFrame();
+    }
+
+    void SdlRendererBackend::renderDrawData(ImDrawData* drawData) {
+        const ImGuiIO& io = ImGui::GetIO();
+        SDL_RenderSetScale(m_renderer, io.DisplayFramebufferScale.x, io.DisplayFramebufferScale.y);
+        SDL_SetRenderDrawColor(m_renderer,
+                               static_cast<Uint8>(CLEAR_COLOR.x * 255.0f),
+                               static_cast<Uint8>(CLEAR_COLOR.y * 255.0f),
+                               static_cast<Uint8>(CLEAR_COLOR.z * 255.0f),
+                               static_cast<Uint8>(CLEAR_COLOR.w * 255.0f));
+        SDL_RenderClear(m_renderer);
+        ImGui_ImplSDLRenderer2_RenderDrawData(drawData, m_renderer);
+    }
+
+    void SdlRendererBackend::renderPlatformWindows(ViewportThrottle& throttle) {
+        ImGui::UpdatePlatformWindows();
+        throttle.render();
+    }
+
+    void SdlRendererBackend::present() {
+        SDL_RenderPresent(m_renderer);
+    }
+
+    void SdlRendererBackend::destroyFontsTexture() {
+        ImGui_ImplSDLRenderer2_DestroyFontsTexture();
+    }
+
+    void SdlRendererBackend::shutdown() {
+        ImGui_ImplSDLRenderer2_Shutdown();
+        ImGui_ImplSDL2_Shutdown();
+    }
+
+    void SdlRendererBackend::getOutputSize(int& width, int& height) const {
+        SDL_GetRendererOutputSize(m_renderer, &width, &height);
+    }
+
+    ImTextureID SdlRendererBackend::createTexture(SDL_Surface* surface) {
+        return reinterpret_cast<ImTextureID>(SDL_CreateTextureFromSurface(m_renderer, surface));
+    }
+
+    bool SdlRendererBackend::updateTexture(const ImTextureID texture, const SDL_Rect& area, SDL_Surface* surface) {
+        auto* sdlTexture = reinterpret_cast<SDL_Texture*>(texture);
+        Uint32 format = 0;
+        if (SDL_QueryTexture(sdlTexture, &format, nullptr, nullptr, nullptr) != 0) {
+            return false;
+        }
+
+        // The texture took its format from the first surface, which later ones need not share
+        SDL_Surface* converted = surface->format->format == format ? surface : SDL_ConvertSurfaceFormat(surface, format, 0);
+        if (converted == nullptr) {
+            return false;
+        }
+        const bool updated = SDL_UpdateTexture(sdlTexture, &area, converted->pixels, converted->pitch) == 0;
+        if (converted != surface) {
+            SDL_FreeSurface(converted);
+        }
+        return updated;
+    }
+
+    void SdlRendererBackend::destroyTexture(const ImTextureID texture) {
+        if (texture != 0) {
+            SDL_DestroyTexture(reinterpret_cast<SDL_Texture*>(texture));
+        }
+    }
+}
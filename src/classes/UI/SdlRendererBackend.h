@@ -0,0 +1,51 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_SDL_RENDERER_BACKEND_H
+#define ADS_SDL_RENDERER_BACKEND_H
+
+#include "RenderBackend.h"
+
+namespace ADS::UI {
+    /**
+     * @brief Render backend over SDL_Renderer
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Works everywhere SDL does, including the dummy video driver of the
+     * frame benchmark. Textures are SDL_Textures.
+     */
+    class SdlRendererBackend : public RenderBackend {
+    public:
+        explicit SdlRendererBackend(Window& window);
+
+        [[nodiscard]] const char* getName() const override;
+        void init() override;
+        void newFrame() override;
+        void renderDrawData(ImDrawData* drawData) override;
+        void renderPlatformWindows(ViewportThrottle& throttle) override;
+        void present() override;
+        void destroyFontsTexture() override;
+        void shutdown() override;
+        void getOutputSize(int& width, int& height) const override;
+        [[nodiscard]] ImTextureID createTexture(SDL_Surface* surface) override;
+        bool updateTexture(ImTextureID texture, const SDL_Rect& area, SDL_Surface* surface) override;
+        void destroyTexture(ImTextureID texture) override;
+
+    private:
+        SDL_Window* m_window;
+        SDL_Renderer* m_renderer;
+    };
+}
+
+#endif // ADS_SDL_RENDERER_BACKEND_H
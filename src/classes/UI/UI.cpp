@@ -22,6 +22,8 @@
 #include "imgui.h"
 #include "imgui/window_intialization_exception.h"
 #include "spdlog/spdlog.h"
+#include "Logger/logger.h"
+#include "Core/AllocationCounter.h"
 #include "../IDE/themes/Theme.h"
 #include "../IDE/themes/DarkTheme.h"
 #include "../IDE/themes/LightTheme.h"
@@ -50,7 +52,7 @@ namespace ADS::UI {
             0) {
             auto message = std::format("{0}:{1} - Error: {2}", __FILE__, __LINE__,
                                        SDL_GetError());
-            spdlog::error(message);
+            ADS_LOG_ERROR(Ui, "{}", message);
             throw Imgui::Exceptions::window_initialization_exception(message);
         }
 
@@ -68,6 +70,13 @@ namespace ADS::UI {
         ::ImGui::DebugCheckVersionAndDataLayout(
                 IMGUI_VERSION, sizeof(ImGuiIO), sizeof(ImGuiStyle), sizeof(ImVec2),
                 sizeof(ImVec4), sizeof(ImDrawVert), sizeof(ImDrawIdx));
+        // ImGui allocates with malloc() by default; going through operator new
+        // charges its memory, the font atlas first, to the caller's tag
+        if (Core::AllocationCounter::isEnabled()) {
+            ::ImGui::SetAllocatorFunctions(
+                [](size_t size, void *) -> void * { return ::operator new(size); },
+                [](void *memory, void *) { ::operator delete(memory); });
+        }
         ::ImGui::CreateContext();
         this->io = &::ImGui::GetIO();
 
@@ -78,15 +87,11 @@ namespace ADS::UI {
         this->setIniConfiguration();
         this->setIOConfigFlags();
 
-        // Initialize theme based on preference
-        if (this->darkTheme) {
-            this->currentTheme = new IDE::DarkTheme();
-        } else {
-            this->currentTheme = new IDE::LightTheme();
-        }
-
-        // Apply the theme
-        this->currentTheme->apply();
+        // Build every theme once, from the style the I/O flags configured,
+        // and apply the preferred one. newWindow() rebuilds them for the DPI.
+        this->baseStyle = ::ImGui::GetStyle();
+        this->buildThemes(1.0f);
+        this->getCurrentTheme()->apply();
 
         // NOTE: ConfigDpiScaleFonts and ConfigDpiScaleViewports have been removed in ImGui 1.91+
         // DPI scaling is now handled automatically by the platform backends
@@ -114,10 +119,10 @@ namespace ADS::UI {
     {
         this->darkTheme = true;  // Use dark theme by default
         this->fonts = std::vector<std::string>();
-        this->windows = std::unordered_map<boost::uuids::uuid, Window*, boost::hash<boost::uuids::uuid>>();
+        this->windows = std::unordered_map<ADS::Core::Uuid, Window*>();
         this->io = nullptr;
         this->fontManager = nullptr;
-        this->currentTheme = nullptr;
+        this->themeScale = 1.0f;
         this->init();
     }
 
@@ -140,7 +145,7 @@ namespace ADS::UI {
      *
      * @see Window
      */
-    std::pair<boost::uuids::uuid, Window *> ImGuiManager::newWindow(
+    std::pair<ADS::Core::Uuid, Window *> ImGuiManager::newWindow(
             const SDL_WINDOW_INFO *windowInfo, SDL_FLAGS *flags)
     {
         Window *window = new Window(
@@ -151,9 +156,15 @@ namespace ADS::UI {
                 windowInfo->height,
                 flags,
                 this->io);
-        boost::uuids::uuid uuid = getRandomUuid();
+        const ADS::Core::Uuid uuid = ADS::Core::IdGenerator::nextUuid();
         this->windows.insert({uuid, window});
 
+        // Sizes follow the display of the first window, as its fonts do
+        if (this->windows.size() == 1 && window->getMainScale() != this->themeScale) {
+            this->buildThemes(window->getMainScale());
+            this->getCurrentTheme()->apply();
+        }
+
         return std::make_pair(uuid, window);
     }
 
@@ -174,7 +185,7 @@ namespace ADS::UI {
      * @note This function does not throw exceptions on failure
      * @see newWindow()
      */
-    Window *ImGuiManager::getWindowFromId(const boost::uuids::uuid &uuid)
+    Window *ImGuiManager::getWindowFromId(const ADS::Core::Uuid &uuid)
     {
         auto it = this->windows.find(uuid);
 
@@ -237,16 +248,8 @@ namespace ADS::UI {
 
         // Configure tooltip hover delay from environment or use default
         float tooltipDelay = Constants::System::DEFAULT_TOOLTIP_DELAY;
-        Environment* env = Core::App::getEnv();
-        if (env != nullptr) {
-            std::string delayStr = env->getOrDefault("TOOLTIP_DELAY", "");
-            if (!delayStr.empty()) {
-                try {
-                    tooltipDelay = std::stof(delayStr);
-                } catch (...) {
-                    // Use default if parsing fails
-                }
-            }
+        if (const Environment* env = Core::App::getEnv(); env != nullptr) {
+            tooltipDelay = env->getConfig()->tooltipDelay;
         }
         ImGui::GetStyle().HoverDelayNormal = tooltipDelay;
     }
@@ -255,36 +258,53 @@ namespace ADS::UI {
      * @brief Apply dark theme color scheme to ImGui
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
-     * Sets the internal theme flag to true and applies ImGui's built-in
-     * dark color scheme to all windows and widgets. This change takes
+     * Sets the internal theme flag to true and copies the dark style,
+     * built once by buildThemes(), into ImGui. This change takes
      * effect immediately for all rendered UI elements.
      */
     void ImGuiManager::setDarkTheme()
     {
         this->darkTheme = true;
-        delete this->currentTheme;
-        this->currentTheme = new IDE::DarkTheme();
-        this->currentTheme->apply();
+        this->getCurrentTheme()->apply();
     }
 
     /**
      * @brief Apply light theme color scheme to ImGui
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
      *
-     * Sets the internal theme flag to false and applies ImGui's built-in
-     * light color scheme to all windows and widgets. This change takes
+     * Sets the internal theme flag to false and copies the light style,
+     * built once by buildThemes(), into ImGui. This change takes
      * effect immediately for all rendered UI elements.
      */
     void ImGuiManager::setLightTheme()
     {
         this->darkTheme = false;
-        delete this->currentTheme;
-        this->currentTheme = new IDE::LightTheme();
-        this->currentTheme->apply();
+        this->getCurrentTheme()->apply();
+    }
+
+    /**
+     * @brief Scale ImGui's sizes and fonts for another display DPI
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Scaling both styles is a few multiplications per size, cheap enough
+     * for the frame boundary; only the font atlas needs a background build.
+     *
+     * @param scale DPI scale, as Window::getMainScale()
+     */
+    void ImGuiManager::setScale(const float scale)
+    {
+        if (scale == this->themeScale) {
+            return;
+        }
+        this->buildThemes(scale);
+        this->getCurrentTheme()->apply();
+        this->io->FontGlobalScale = scale;
     }
 
     /**
@@ -303,7 +323,7 @@ namespace ADS::UI {
      *
      * @see getWindowFromId(), getActiveWindow()
      */
-    void ImGuiManager::setActiveWindow(boost::uuids::uuid uuid)
+    void ImGuiManager::setActiveWindow(ADS::Core::Uuid uuid)
     {
         Window* window = this->getWindowFromId(uuid);
         if (window != nullptr) {
@@ -381,13 +401,34 @@ namespace ADS::UI {
      * Returns a pointer to the currently active theme instance.
      * This can be used to query theme properties or apply the theme.
      *
-     * @return IDE::Theme* Pointer to current theme
+     * @return const IDE::Theme* Pointer to current theme
      *
      * @see setDarkTheme(), setLightTheme()
      */
-    IDE::Theme* ImGuiManager::getCurrentTheme() const
+    const IDE::Theme* ImGuiManager::getCurrentTheme() const
+    {
+        if (this->darkTheme) {
+            return &this->darkStyle;
+        }
+        return &this->lightStyle;
+    }
+
+    /**
+     * @brief Build the styles of every theme for a DPI scale
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Each theme starts from the unscaled base style, so rebuilding for
+     * another scale does not compound the previous one.
+     *
+     * @param scale DPI scale of the sizes and paddings
+     */
+    void ImGuiManager::buildThemes(const float scale)
     {
-        return this->currentTheme;
+        this->darkStyle.build(this->baseStyle, scale);
+        this->lightStyle.build(this->baseStyle, scale);
+        this->themeScale = scale;
     }
 
 } // ADS::UI
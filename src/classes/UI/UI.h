@@ -19,19 +19,12 @@
 #include <unordered_map>
 #include <vector>
 
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
-#include <boost/functional/hash.hpp>
-
 #include "Window.h"
+#include "Core/IdGenerator.h"
 #include "fonts.h"
 #include "imgui.h"
-
-// Forward declaration to avoid circular dependency
-namespace ADS::IDE {
-    class Theme;
-}
+#include "../IDE/themes/DarkTheme.h"
+#include "../IDE/themes/LightTheme.h"
 
 namespace ADS::UI {
     class ImGuiManager {
@@ -51,7 +44,7 @@ namespace ADS::UI {
         /**
          * A set of windows that conformed the application
          */
-        std::unordered_map<boost::uuids::uuid, Window*, boost::hash<boost::uuids::uuid>> windows;
+        std::unordered_map<ADS::Core::Uuid, Window*> windows;
 
         /**
          * Active Window
@@ -69,9 +62,31 @@ namespace ADS::UI {
         Fonts* fontManager;
 
         /**
-         * Current active theme for the IDE
+         * Styles of both themes, built once so switching is a style copy.
+         * The active one is chosen by darkTheme.
+         */
+        IDE::DarkTheme darkStyle;
+        IDE::LightTheme lightStyle;
+
+        /**
+         * Style the themes are built from, unscaled
          */
-        IDE::Theme* currentTheme;
+        ImGuiStyle baseStyle;
+
+        /**
+         * DPI scale the theme styles were built for
+         */
+        float themeScale;
+
+        /**
+         * @brief Build the styles of every theme for a DPI scale
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param scale DPI scale of the sizes and paddings
+         */
+        void buildThemes(float scale);
 
         /**
          * @brief Initialize SDL library and ImGui context
@@ -99,18 +114,18 @@ namespace ADS::UI {
          *
          * Creates a new Window instance using the provided configuration and
          * registers it in the internal windows collection for lifecycle management.
-         * The window is allocated on the heap and a unique UUID is generated for it.
+         * The window is allocated on the heap and a UUIDv7 is generated for it.
          *
          * @param windowInfo    Pointer to SDL window configuration structure containing
          *                      title, position (x, y), and dimensions (width, height)
          * @param flags         Flags to applied to the new window and its renderer handler
          *
-         * @return std::pair<boost::uuids::uuid, Window*> Pair containing the generated UUID
+         * @return std::pair<ADS::Core::Uuid, Window*> Pair containing the generated UUID
          *                                          and pointer to the newly created window
          *
          * @see Window, getWindowFromId()
          */
-        std::pair<boost::uuids::uuid, Window*> newWindow(const SDL_WINDOW_INFO* windowInfo, SDL_FLAGS* flags);
+        std::pair<ADS::Core::Uuid, Window*> newWindow(const SDL_WINDOW_INFO* windowInfo, SDL_FLAGS* flags);
 
         /**
          * @brief Retrieve a window from the collection by its UUID
@@ -118,7 +133,7 @@ namespace ADS::UI {
          * @param uuid The unique identifier of the window to retrieve
          * @return Window* Pointer to the window if found, nullptr otherwise
          */
-        Window* getWindowFromId(const boost::uuids::uuid& uuid);
+        Window* getWindowFromId(const ADS::Core::Uuid& uuid);
 
         /**
          * @brief Configure ImGui settings persistence
@@ -141,19 +156,34 @@ namespace ADS::UI {
         /**
          * @brief Apply dark theme color scheme to ImGui
          *
-         * Sets the internal theme flag and applies the dark color scheme
-         * to all ImGui windows and widgets.
+         * Sets the internal theme flag and copies the prebuilt dark style
+         * into ImGui; nothing is allocated or recomputed.
          */
         void setDarkTheme();
 
         /**
          * @brief Apply light theme color scheme to ImGui
          *
-         * Sets the internal theme flag and applies the light color scheme
-         * to all ImGui windows and widgets.
+         * Sets the internal theme flag and copies the prebuilt light style
+         * into ImGui; nothing is allocated or recomputed.
          */
         void setLightTheme();
 
+        /**
+         * @brief Scale ImGui's sizes and fonts for another display DPI
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Rebuilds both theme styles for the scale, applies the current one
+         * and sets the global font scale. Call between frames, together with
+         * the swap of an atlas rasterised for the scale, so text and sizes
+         * change in the same frame.
+         *
+         * @param scale DPI scale, as Window::getMainScale()
+         */
+        void setScale(float scale);
+
         /**
          * @brief Set the active window by UUID
          *
@@ -165,7 +195,7 @@ namespace ADS::UI {
          *
          * @see getWindowFromId(), getActiveWindow()
          */
-        void setActiveWindow(boost::uuids::uuid uuid);
+        void setActiveWindow(ADS::Core::Uuid uuid);
 
         /**
          * @brief Retrieve the currently active window
@@ -211,9 +241,9 @@ namespace ADS::UI {
          * Returns a pointer to the currently active theme instance.
          * This can be used to query theme properties or apply the theme.
          *
-         * @return IDE::Theme* Pointer to current theme
+         * @return const IDE::Theme* Pointer to current theme
          */
-        IDE::Theme* getCurrentTheme() const;
+        const IDE::Theme* getCurrentTheme() const;
 
     };
 } // ADS::UI
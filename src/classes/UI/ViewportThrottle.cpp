@@ -0,0 +1,138 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file ViewportThrottle.cpp
+ * @brief Implementation of the ViewportThrottle class
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ */
+
+#include "ViewportThrottle.h"
+
+#include <algorithm>
+
+#include <blake3.h>
+
+#include "System.h"
+
+namespace ADS::UI {
+    /**
+     * @brief Draw and swap the platform windows that are due
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A window is due when its draw data changed since it was last drawn,
+     * and it is focused, hovered, new, invalidated or was last drawn at
+     * least 1 / UNFOCUSED_VIEWPORT_FPS seconds ago. Due windows are all
+     * drawn before any is swapped, as RenderPlatformWindowsDefault() does.
+     * Minimised windows are left alone.
+     *
+     * @param now Current time
+     */
+    void ViewportThrottle::render(const Clock::time_point now) {
+        static constexpr auto UNFOCUSED_INTERVAL =
+            std::chrono::microseconds(1'000'000 / Constants::System::UNFOCUSED_VIEWPORT_FPS);
+        ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+        const ImGuiID hovered = ImGui::GetIO().MouseHoveredViewport;
+        ++m_frame;
+        m_pending = false;
+        m_skipped = 0;
+
+        for (int i = 1; i < platformIO.Viewports.Size; ++i) {
+            ImGuiViewport* viewport = platformIO.Viewports[i];
+            if (viewport->Flags & ImGuiViewportFlags_IsMinimized) {
+                continue;
+            }
+            Shown& shown = m_shown[viewport->ID];
+            const bool fresh = shown.seenFrame == 0;
+            shown.seenFrame = m_frame;
+
+            const uint64_t signature = signatureOf(*viewport);
+            if (!m_invalid && !fresh && signature == shown.signature) {
+                ++m_skipped;
+                continue;
+            }
+            const bool active = (viewport->Flags & ImGuiViewportFlags_IsFocused) != 0 || viewport->ID == hovered;
+            if (!m_invalid && !fresh && !active && now - shown.drawnAt < UNFOCUSED_INTERVAL) {
+                m_pending = true;
+                ++m_skipped;
+                continue;
+            }
+            shown.signature = signature;
+            shown.drawnAt = now;
+            m_due.push_back(viewport);
+        }
+
+        for (ImGuiViewport* viewport: m_due) {
+            if (platformIO.Platform_RenderWindow) platformIO.Platform_RenderWindow(viewport, nullptr);
+            if (platformIO.Renderer_RenderWindow) platformIO.Renderer_RenderWindow(viewport, nullptr);
+        }
+        for (ImGuiViewport* viewport: m_due) {
+            if (platformIO.Platform_SwapBuffers) platformIO.Platform_SwapBuffers(viewport, nullptr);
+            if (platformIO.Renderer_SwapBuffers) platformIO.Renderer_SwapBuffers(viewport, nullptr);
+        }
+        m_drawn = m_due.size();
+        m_due.clear();
+        m_invalid = false;
+
+        // Forget the windows that were closed
+        if (m_shown.size() > static_cast<size_t>(platformIO.Viewports.Size)) {
+            std::erase_if(m_shown, [this](const auto& entry) { return entry.second.seenFrame != m_frame; });
+        }
+    }
+
+    void ViewportThrottle::invalidate() {
+        m_invalid = true;
+    }
+
+    bool ViewportThrottle::hasPending() const {
+        return m_pending;
+    }
+
+    size_t ViewportThrottle::getDrawnCount() const {
+        return m_drawn;
+    }
+
+    size_t ViewportThrottle::getSkippedCount() const {
+        return m_skipped;
+    }
+
+    uint64_t ViewportThrottle::signatureOf(const ImGuiViewport& viewport) {
+        blake3_hasher hasher;
+        blake3_hasher_init(&hasher);
+        auto feed = [&hasher](const auto& value) {
+            blake3_hasher_update(&hasher, &value, sizeof(value));
+        };
+        auto feedVector = [&hasher](const auto& vector) {
+            blake3_hasher_update(&hasher, vector.Data, static_cast<size_t>(vector.size_in_bytes()));
+        };
+
+        feed(viewport.Pos);
+        feed(viewport.Size);
+        if (const ImDrawData* drawData = viewport.DrawData) {
+            feed(drawData->FramebufferScale);
+            // ImVector copies whole elements, so the zeroed padding of ImDrawCmd hashes the same every frame
+            for (const ImDrawList* list: drawData->CmdLists) {
+                feedVector(list->CmdBuffer);
+                feedVector(list->IdxBuffer);
+                feedVector(list->VtxBuffer);
+            }
+        }
+
+        uint64_t signature = 0;
+        blake3_hasher_finalize(&hasher, reinterpret_cast<uint8_t*>(&signature), sizeof(signature));
+        return signature;
+    }
+}
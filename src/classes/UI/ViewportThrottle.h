@@ -0,0 +1,112 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_VIEWPORT_THROTTLE_H
+#define ADS_VIEWPORT_THROTTLE_H
+
+/**
+ * @file ViewportThrottle.h
+ * @brief Draws the detached ImGui windows only when they change
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * With multi-viewports enabled, ImGui::RenderPlatformWindowsDefault()
+ * draws and swaps every detached panel window each frame, whether or not
+ * its contents moved, and each swap may wait for vsync. The throttle
+ * stands in for it: a window whose draw data is the same as the last
+ * time it was drawn keeps what it shows, and one that changed while
+ * neither focused nor hovered is drawn at most UNFOCUSED_VIEWPORT_FPS
+ * times a second.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "imgui.h"
+
+namespace ADS::UI {
+    /**
+     * @brief Chooses which platform windows to draw each frame
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Main thread only. The main viewport is not handled here; it is
+     * drawn and presented by the render backend as before.
+     */
+    class ViewportThrottle {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Draw and swap the platform windows that are due
+         *
+         * Call after ImGui::UpdatePlatformWindows(), where
+         * RenderPlatformWindowsDefault() would go.
+         *
+         * @param now Current time
+         */
+        void render(Clock::time_point now = Clock::now());
+
+        /**
+         * @brief Draw every platform window on the next render()
+         *
+         * For when what they show may be lost or stale with the same draw
+         * data: exposed windows, a rebuilt font atlas.
+         */
+        void invalidate();
+
+        /**
+         * @brief Check whether a window changed but was held back by the frame-rate cap
+         */
+        [[nodiscard]] bool hasPending() const;
+
+        /**
+         * @brief Get the platform windows drawn by the last render()
+         */
+        [[nodiscard]] size_t getDrawnCount() const;
+
+        /**
+         * @brief Get the platform windows left as they were by the last render()
+         */
+        [[nodiscard]] size_t getSkippedCount() const;
+
+    private:
+        /**
+         * @brief What a platform window showed when it was last drawn
+         */
+        struct Shown {
+            uint64_t signature = 0;
+            Clock::time_point drawnAt;
+            uint32_t seenFrame = 0;     ///< Last render() the viewport was still open in
+        };
+
+        /**
+         * @brief Hash the draw data of a viewport, with its position and size
+         */
+        [[nodiscard]] static uint64_t signatureOf(const ImGuiViewport& viewport);
+
+        std::unordered_map<ImGuiID, Shown> m_shown;
+        std::vector<ImGuiViewport*> m_due;     ///< Windows to draw this frame, kept to reuse its storage
+        uint32_t m_frame = 0;
+        bool m_invalid = true;
+        bool m_pending = false;
+        size_t m_drawn = 0;
+        size_t m_skipped = 0;
+    };
+}
+
+#endif // ADS_VIEWPORT_THROTTLE_H
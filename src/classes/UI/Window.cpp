@@ -17,7 +17,9 @@
 #include "app.h"
 
 #include "imgui_impl_sdl2.h"
+#include "OpenGL3Backend.h"
 #include "spdlog/spdlog.h"
+#include "Logger/logger.h"
 
 namespace ADS::UI {
     /**
@@ -49,6 +51,13 @@ namespace ADS::UI {
         this->flags = new SDL_FLAGS();
 
         this->flags->windowFlags = static_cast<SDL_WindowFlags>(Window::DEFAULT_FLAGS | flags->windowFlags);
+        this->flags->renderer = flags->renderer;
+        this->renderer = nullptr;
+        this->glContext = nullptr;
+        if (this->flags->renderer == RendererKind::OpenGL3) {
+            OpenGL3Backend::setContextAttributes();
+            this->addWindowFlag(SDL_WINDOW_OPENGL);
+        }
         // NOTE: ImGui_ImplSDL2_GetContentScaleForDisplay has been removed in ImGui 1.91+
         // DPI scaling is now handled via SDL_GetDisplayDPI after window creation
         this->mainScale = 1.0f; // Temporary value, will be updated after window creation
@@ -56,12 +65,26 @@ namespace ADS::UI {
 
         if (this->window == nullptr) {
             string errorMessage = std::format("{}:{} Error: SDL_CreateWindow(): {}\n", __FILE__, __LINE__, SDL_GetError());
-            spdlog::error(errorMessage);
+            ADS_LOG_ERROR(Ui, "{}", errorMessage);
             throw std::runtime_error(std::format("Failed to create window: {}", errorMessage));
         }
 
-        this->flags->rendererFlags = this->getDefaultRenderFlags() | flags->rendererFlags;
-        this->renderer = this->createRenderer();
+        if (this->flags->renderer == RendererKind::OpenGL3) {
+            this->glContext = SDL_GL_CreateContext(this->window);
+            if (this->glContext == nullptr) {
+                ADS_LOG_ERROR(Ui, "{}:{} Error creating OpenGL context: {}\n", __FILE__, __LINE__, SDL_GetError());
+                throw std::runtime_error(std::format("Failed to create OpenGL context: {}", SDL_GetError()));
+            }
+            SDL_GL_MakeCurrent(this->window, this->glContext);
+            SDL_GL_SetSwapInterval(1);
+        } else {
+            // A software renderer is asked for with no display, where accelerated ones fail
+            this->flags->rendererFlags = (flags->rendererFlags & SDL_RENDERER_SOFTWARE)
+                                             ? flags->rendererFlags
+                                             : this->getDefaultRenderFlags() | flags->rendererFlags;
+            this->renderer = this->createRenderer();
+        }
+        this->backend = RenderBackend::create(*this);
         this->setDPIScale();
 
         // Update mainScale with the calculated DPI scale
@@ -118,7 +141,7 @@ namespace ADS::UI {
     {
         SDL_Renderer *renderer = SDL_CreateRenderer(this->getWindow(), index, this->flags->rendererFlags);
         if (renderer == nullptr) {
-            spdlog::error(std::format("{}:{} Error creating renderer: {}\n", __FILE__, __LINE__, SDL_GetError()));
+            ADS_LOG_ERROR(Ui, "{}:{} Error creating renderer: {}\n", __FILE__, __LINE__, SDL_GetError());
             throw std::runtime_error(std::format("Failed to create renderer: {}", SDL_GetError()));
         }
 
@@ -251,7 +274,7 @@ namespace ADS::UI {
      *
      * @return float The content scale factor (1.0 for standard DPI, 2.0+ for high-DPI)
      *
-     * @note This value is set once during construction and doesn't change
+     * @note Set during construction and again by updateDPIScale()
      */
     float Window::getMainScale() const
     {
@@ -288,6 +311,32 @@ namespace ADS::UI {
         this->renderer = rendererHandler;
     }
 
+    /**
+     * @brief Get the OpenGL context of the window
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return SDL_GLContext The context, or nullptr for an SDL_Renderer window
+     */
+    SDL_GLContext Window::getGLContext() const
+    {
+        return this->glContext;
+    }
+
+    /**
+     * @brief Get the backend ImGui and the textures are drawn through
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return RenderBackend& The backend made by the constructor
+     */
+    RenderBackend& Window::getBackend() const
+    {
+        return *this->backend;
+    }
+
     /**
      * @brief Query and store the DPI scaling information for the window's display
      *
@@ -315,6 +364,45 @@ namespace ADS::UI {
         }
     }
 
+    /**
+     * @brief Query the DPI of the window's display again
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A couple of SDL queries, cheap enough for every move or resize.
+     *
+     * @return true if the main scale changed
+     */
+    bool Window::updateDPIScale()
+    {
+        this->setDPIScale();
+        if (this->DPI.scale == this->mainScale) {
+            return false;
+        }
+        this->mainScale = this->DPI.scale;
+        return true;
+    }
+
+    /**
+     * @brief Get the drawable pixels per window coordinate
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return float Ratio of the renderer output width to the window width,
+     *         1.0 if either is unknown
+     */
+    float Window::getPixelRatio() const
+    {
+        int windowWidth = 0;
+        int outputWidth = 0;
+        int outputHeight = 0;
+        SDL_GetWindowSize(this->window, &windowWidth, nullptr);
+        this->backend->getOutputSize(outputWidth, outputHeight);
+        return windowWidth > 0 && outputWidth > 0 ? static_cast<float>(outputWidth) / static_cast<float>(windowWidth) : 1.0f;
+    }
+
     /**
      * @brief Get the complete DPI information structure
      *
@@ -397,25 +485,18 @@ namespace ADS::UI {
      * @brief Configure ImGui style settings for viewports
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Dec 2025
+     * @version Oct 2026
+     *
+     * Retrieves the current ImGui style. The viewport adjustments and the
+     * DPI scaling of the sizes are part of the theme styles, which
+     * ImGuiManager builds for the scale of the first window, so they
+     * survive theme switches and are not applied twice.
      *
-     * Retrieves the current ImGui style and adjusts window rounding and
-     * background opacity when multi-viewport mode is enabled. This ensures
-     * that platform windows (detached viewports) maintain a consistent
-     * appearance with the main application window.
+     * @see ImGuiManager::buildThemes(), IDE::Theme::build()
      */
     void Window::setStyle()
     {
         this->style = &ImGui::GetStyle();
-        if (this->io->ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
-            this->style->WindowRounding = 0.0f;
-            this->style->Colors[ImGuiCol_WindowBg].w = 1.0f;
-        }
-
-        // Bake a fixed style scale. (until we have a solution for dynamic
-        // style scaling, changing this requires
-        // resetting Style + calling this again)
-        this->style->ScaleAllSizes(this->mainScale);
 
         // NOTE: FontScaleDpi has been removed from ImGuiStyle in ImGui 1.91+
         // DPI scaling is now handled automatically by platform backends
@@ -15,10 +15,12 @@
 #define ADS_IMGUI_WINDOW_H
 #include <SDL_render.h>
 #include <SDL_video.h>
+#include <memory>
 #include <ratio>
 #include <string>
 
 #include "imgui.h"
+#include "RenderBackend.h"
 
 namespace ADS::UI {
 
@@ -41,6 +43,7 @@ namespace ADS::UI {
     {
         SDL_WindowFlags windowFlags = static_cast<SDL_WindowFlags>(0);
         Uint32 rendererFlags = 0;
+        RendererKind renderer = RendererKind::SdlRenderer;
     };
 
     /**
@@ -82,6 +85,16 @@ namespace ADS::UI {
          */
         SDL_Renderer *renderer;
 
+        /**
+         * OpenGL context of the window, only with RendererKind::OpenGL3
+         */
+        SDL_GLContext glContext;
+
+        /**
+         * Backend ImGui and the textures are drawn through
+         */
+        std::unique_ptr<RenderBackend> backend;
+
         /**
          * When viewports are enabled we tweak WindowRounding/WindowBg
          * so platform windows can look identical to regular ones.
@@ -290,7 +303,8 @@ namespace ADS::UI {
          * @return float The content scale factor (typically 1.0 for standard DPI,
          *               2.0 for Retina/HiDPI displays)
          *
-         * @note This value is set during init() and remains constant during runtime
+         * @note Set during init() and again by updateDPIScale() when the
+         *       window moves to a display of another DPI
          */
         [[nodiscard]] float getMainScale() const;
 
@@ -318,6 +332,27 @@ namespace ADS::UI {
          */
         void setRenderer(SDL_Renderer *rendererHandler);
 
+        /**
+         * @brief Get the OpenGL context of the window
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return SDL_GLContext The context, or nullptr unless the window
+         *         was created for RendererKind::OpenGL3
+         */
+        [[nodiscard]] SDL_GLContext getGLContext() const;
+
+        /**
+         * @brief Get the backend ImGui and the textures are drawn through
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return RenderBackend& The backend of the renderer chosen in SDL_FLAGS
+         */
+        [[nodiscard]] RenderBackend& getBackend() const;
+
         /**
          * @brief Query and store the DPI scaling information for the window's display
          *
@@ -334,6 +369,31 @@ namespace ADS::UI {
          */
         void setDPIScale();
 
+        /**
+         * @brief Query the DPI of the window's display again
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * For window events that may have moved the window to another
+         * display. Only the scale is updated; ImGui's fonts and sizes are
+         * left for the caller to rescale once the fonts are ready.
+         *
+         * @return true if the main scale changed
+         * @see setDPIScale(), getMainScale()
+         */
+        bool updateDPIScale();
+
+        /**
+         * @brief Get the drawable pixels per window coordinate
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @return float 2.0 on Retina displays, 1.0 where the window is not scaled
+         */
+        [[nodiscard]] float getPixelRatio() const;
+
         /**
          * @brief Get the complete DPI information structure
          *
@@ -398,9 +458,8 @@ namespace ADS::UI {
         /**
          * @brief Configure ImGui style settings for viewports
          *
-         * Adjusts window rounding and background opacity when multi-viewport
-         * mode is enabled to ensure platform windows look consistent with
-         * the main window.
+         * Keeps a pointer to the ImGui style. The viewport adjustments and
+         * DPI scaling are built into the theme styles by ImGuiManager.
          */
         void setStyle();
 
@@ -12,11 +12,308 @@
 
 
 #include "fonts.h"
+#include "imgui_internal.h"
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include <blake3.h>
 #include <spdlog/spdlog.h>
+#include "Logger/logger.h"
+#include "Core/AllocationCounter.h"
+#include "Core/Profiling.h"
 
 namespace ADS::UI {
 
+    /**
+     * @brief Header of a cached font atlas
+     *
+     * Followed by TexUvLines, the custom rectangles (x, y, width, height as
+     * uint16), per font its size, ascent, descent, glyph count and glyphs,
+     * and finally width * height alpha pixels.
+     */
+    struct CachedAtlasHeader {
+        std::array<char, 4> magic;
+        uint32_t version;
+        uint32_t width;
+        uint32_t height;
+        uint32_t fonts;
+        uint32_t rects;
+        int32_t packIdMouseCursor;
+        int32_t packIdLines;
+        ImVec2 uvScale;
+        ImVec2 uvWhitePixel;
+    };
+
+    static constexpr std::array<char, 4> ATLAS_MAGIC = {'A', 'D', 'S', 'F'};
+    static constexpr uint32_t ATLAS_VERSION = 1;
+
+    /**
+     * @brief Glyph tables of one font as stored in the cache
+     */
+    struct CachedFont {
+        float size = 0.0f;
+        float ascent = 0.0f;
+        float descent = 0.0f;
+        std::vector<ImFontGlyph> glyphs;
+    };
+
+    /**
+     * @brief Hex-encoded BLAKE3 hash of everything the built atlas depends on
+     *
+     * Glyphs are stored as raw ImFontGlyph, so the ImGui version and the
+     * struct size are part of the key too.
+     */
+    static std::string atlasKey(ImFontAtlas *atlas, const float dpiScale)
+    {
+        blake3_hasher hasher;
+        blake3_hasher_init(&hasher);
+        auto feed = [&hasher](const auto &value) {
+            blake3_hasher_update(&hasher, &value, sizeof(value));
+        };
+
+        const int imguiVersion = IMGUI_VERSION_NUM;
+        const size_t glyphSize = sizeof(ImFontGlyph);
+        feed(imguiVersion);
+        feed(glyphSize);
+        feed(dpiScale);
+        feed(atlas->Flags);
+        feed(atlas->TexDesiredWidth);
+        feed(atlas->TexGlyphPadding);
+        feed(atlas->CustomRects.Size);
+
+        for (const ImFontConfig &config: atlas->ConfigData) {
+            blake3_hasher_update(&hasher, config.FontData, static_cast<size_t>(config.FontDataSize));
+            feed(config.FontNo);
+            feed(config.SizePixels);
+            feed(config.OversampleH);
+            feed(config.OversampleV);
+            feed(config.PixelSnapH);
+            feed(config.GlyphOffset);
+            feed(config.GlyphMinAdvanceX);
+            feed(config.GlyphMaxAdvanceX);
+            feed(config.MergeMode);
+            feed(config.FontBuilderFlags);
+            feed(config.RasterizerMultiply);
+            feed(config.RasterizerDensity);
+            feed(config.EllipsisChar);
+            feed(atlas->Fonts.find_index(config.DstFont));
+
+            const ImWchar *ranges = config.GlyphRanges != nullptr ? config.GlyphRanges : atlas->GetGlyphRangesDefault();
+            for (; *ranges != 0; ++ranges) {
+                feed(*ranges);
+            }
+            feed(ImWchar{0});
+        }
+
+        std::array<uint8_t, BLAKE3_OUT_LEN> digest;
+        blake3_hasher_finalize(&hasher, digest.data(), digest.size());
+
+        static constexpr char HEX[] = "0123456789abcdef";
+        std::string hex(digest.size() * 2, '0');
+        for (size_t i = 0; i < digest.size(); ++i) {
+            hex[2 * i] = HEX[digest[i] >> 4];
+            hex[2 * i + 1] = HEX[digest[i] & 0x0F];
+        }
+        return hex;
+    }
+
+    /**
+     * @brief Restore a built atlas from the disk cache
+     *
+     * The whole entry is read and checked before the atlas is touched, so
+     * a missing or damaged file leaves the atlas ready to be built.
+     *
+     * @return bool False if the entry is missing, damaged or for other fonts
+     */
+    static bool readCachedAtlas(const std::filesystem::path &file, ImFontAtlas *atlas)
+    {
+        std::ifstream in(file, std::ios::binary);
+        CachedAtlasHeader header;
+        if (!in.read(reinterpret_cast<char *>(&header), sizeof(header))
+            || header.magic != ATLAS_MAGIC || header.version != ATLAS_VERSION
+            || header.width == 0 || header.height == 0 || header.width > 16384 || header.height > 16384
+            || header.fonts != static_cast<uint32_t>(atlas->Fonts.Size)) {
+            return false;
+        }
+
+        decltype(atlas->TexUvLines) uvLines;
+        if (!in.read(reinterpret_cast<char *>(uvLines), sizeof(uvLines))) {
+            return false;
+        }
+
+        std::vector<std::array<uint16_t, 4> > rects(header.rects);
+        if (!in.read(reinterpret_cast<char *>(rects.data()),
+                     static_cast<std::streamsize>(rects.size() * sizeof(rects[0])))) {
+            return false;
+        }
+
+        std::vector<CachedFont> fonts(header.fonts);
+        for (CachedFont &font: fonts) {
+            uint32_t glyphCount = 0;
+            if (!in.read(reinterpret_cast<char *>(&font.size), sizeof(font.size))
+                || !in.read(reinterpret_cast<char *>(&font.ascent), sizeof(font.ascent))
+                || !in.read(reinterpret_cast<char *>(&font.descent), sizeof(font.descent))
+                || !in.read(reinterpret_cast<char *>(&glyphCount), sizeof(glyphCount))
+                || glyphCount == 0 || glyphCount >= 32 * 1024) {
+                return false;
+            }
+            font.glyphs.resize(glyphCount);
+            if (!in.read(reinterpret_cast<char *>(font.glyphs.data()),
+                         static_cast<std::streamsize>(glyphCount * sizeof(ImFontGlyph)))) {
+                return false;
+            }
+        }
+
+        std::vector<unsigned char> pixels(static_cast<size_t>(header.width) * header.height);
+        if (!in.read(reinterpret_cast<char *>(pixels.data()), static_cast<std::streamsize>(pixels.size()))) {
+            return false;
+        }
+
+        atlas->ClearTexData();
+        atlas->TexWidth = static_cast<int>(header.width);
+        atlas->TexHeight = static_cast<int>(header.height);
+        atlas->TexUvScale = header.uvScale;
+        atlas->TexUvWhitePixel = header.uvWhitePixel;
+        std::memcpy(atlas->TexUvLines, uvLines, sizeof(uvLines));
+        atlas->TexPixelsAlpha8 = static_cast<unsigned char *>(IM_ALLOC(pixels.size()));
+        std::memcpy(atlas->TexPixelsAlpha8, pixels.data(), pixels.size());
+
+        atlas->CustomRects.resize(static_cast<int>(rects.size()));
+        for (size_t i = 0; i < rects.size(); ++i) {
+            ImFontAtlasCustomRect &rect = atlas->CustomRects[static_cast<int>(i)];
+            rect = ImFontAtlasCustomRect();
+            rect.X = rects[i][0];
+            rect.Y = rects[i][1];
+            rect.Width = rects[i][2];
+            rect.Height = rects[i][3];
+        }
+        atlas->PackIdMouseCursor = header.packIdMouseCursor;
+        atlas->PackIdLines = header.packIdLines;
+
+        for (int i = 0; i < atlas->Fonts.Size; ++i) {
+            ImFont *font = atlas->Fonts[i];
+            const CachedFont &cached = fonts[static_cast<size_t>(i)];
+            font->ClearOutputData();
+            font->ContainerAtlas = atlas;
+            font->FontSize = cached.size;
+            font->Ascent = cached.ascent;
+            font->Descent = cached.descent;
+            font->Glyphs.resize(static_cast<int>(cached.glyphs.size()));
+            std::memcpy(font->Glyphs.Data, cached.glyphs.data(), cached.glyphs.size() * sizeof(ImFontGlyph));
+            font->BuildLookupTable();
+        }
+        atlas->TexReady = true;
+
+        return true;
+    }
+
+    /**
+     * @brief Store a built atlas in the disk cache
+     *
+     * Best effort: a failure only costs a build on the next start. The
+     * entry is written under a temporary name and renamed into place.
+     */
+    static void writeCachedAtlas(const std::filesystem::path &file, ImFontAtlas *atlas)
+    {
+        unsigned char *pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        atlas->GetTexDataAsAlpha8(&pixels, &width, &height);
+        if (pixels == nullptr || atlas->TexPixelsUseColors) {
+            return;
+        }
+        for (const ImFontAtlasCustomRect &rect: atlas->CustomRects) {
+            if (rect.Font != nullptr) {
+                // Glyphs drawn by the application are not rebuilt from the cache
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(file.parent_path(), error);
+
+        std::filesystem::path temporary = file;
+        temporary += ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            const CachedAtlasHeader header{ATLAS_MAGIC, ATLAS_VERSION,
+                                           static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+                                           static_cast<uint32_t>(atlas->Fonts.Size),
+                                           static_cast<uint32_t>(atlas->CustomRects.Size),
+                                           atlas->PackIdMouseCursor, atlas->PackIdLines,
+                                           atlas->TexUvScale, atlas->TexUvWhitePixel};
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char *>(atlas->TexUvLines), sizeof(atlas->TexUvLines));
+            for (const ImFontAtlasCustomRect &rect: atlas->CustomRects) {
+                const std::array<uint16_t, 4> packed = {rect.X, rect.Y, rect.Width, rect.Height};
+                out.write(reinterpret_cast<const char *>(packed.data()), sizeof(packed));
+            }
+            for (const ImFont *font: atlas->Fonts) {
+                const auto glyphCount = static_cast<uint32_t>(font->Glyphs.Size);
+                out.write(reinterpret_cast<const char *>(&font->FontSize), sizeof(font->FontSize));
+                out.write(reinterpret_cast<const char *>(&font->Ascent), sizeof(font->Ascent));
+                out.write(reinterpret_cast<const char *>(&font->Descent), sizeof(font->Descent));
+                out.write(reinterpret_cast<const char *>(&glyphCount), sizeof(glyphCount));
+                out.write(reinterpret_cast<const char *>(font->Glyphs.Data),
+                          static_cast<std::streamsize>(glyphCount * sizeof(ImFontGlyph)));
+            }
+            out.write(reinterpret_cast<const char *>(pixels),
+                      static_cast<std::streamsize>(width) * height);
+            if (!out) {
+                out.close();
+                std::filesystem::remove(temporary, error);
+                return;
+            }
+        }
+        std::filesystem::rename(temporary, file, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+        }
+    }
+
+    /**
+     * @brief Build an atlas, restoring it from the disk cache when possible
+     *
+     * @param atlas Atlas with every font added
+     * @param cacheDirectory Folder holding the cached atlases; empty to always build
+     * @param dpiScale Display scale, part of the cache key
+     * @return bool False if ImGui failed to build the atlas
+     */
+    static bool buildThroughCache(ImFontAtlas *atlas, const std::filesystem::path &cacheDirectory,
+                                  const float dpiScale)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsedMs = [&start]() {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        std::filesystem::path cached;
+        if (!cacheDirectory.empty() && !atlas->Fonts.empty()) {
+            cached = cacheDirectory / (atlasKey(atlas, dpiScale) + ".atlas");
+            if (readCachedAtlas(cached, atlas)) {
+                ADS_LOG_INFO(Ui, "Font atlas restored from cache in {:.1f} ms", elapsedMs());
+                return true;
+            }
+        }
+
+        if (!atlas->Build()) {
+            ADS_LOG_ERROR(Ui, "Failed to build the font atlas");
+            return false;
+        }
+        ADS_LOG_INFO(Ui, "Font atlas built in {:.1f} ms", elapsedMs());
+
+        if (!cached.empty()) {
+            writeCachedAtlas(cached, atlas);
+        }
+
+        return true;
+    }
+
     /**
      * @brief Constructor for Fonts class
      *
@@ -35,11 +332,80 @@ namespace ADS::UI {
     Fonts::Fonts(ImGuiIO *io) : io(io)
     {
         if (this->io == nullptr) {
-            spdlog::error("Fonts::Fonts() - ImGuiIO pointer is null!");
+            ADS_LOG_ERROR(Ui, "Fonts::Fonts() - ImGuiIO pointer is null!");
             throw std::runtime_error("Cannot initialize Fonts with null ImGuiIO");
         }
 
-        spdlog::info("Fonts manager initialized");
+        // Latin-1, as ImGui bakes by default; other scripts are added as they show up
+        this->glyphs.AddRanges(this->io->Fonts->GetGlyphRangesDefault());
+
+        ADS_LOG_INFO(Ui, "Fonts manager initialized");
+    }
+
+    /**
+     * @brief Destructor for Fonts class
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Waits for an atlas rebuild still running and frees the atlas it
+     * built, which was never handed to ImGui.
+     */
+    Fonts::~Fonts()
+    {
+        if (this->rebuildWorker.joinable()) {
+            this->rebuildWorker.join();
+        }
+        if (this->rebuiltAtlas != nullptr) {
+            IM_DELETE(this->rebuiltAtlas);
+        }
+    }
+
+    /**
+     * @brief Add a recorded font to an atlas
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Shared by the load methods and the atlas rebuild, so a rebuilt atlas
+     * holds the same fonts with the same settings, in the same order.
+     *
+     * @param atlas Atlas the font is added to
+     * @param source Font to add
+     * @param textRanges Glyph ranges of default and text fonts; nullptr for ImGui's default ranges
+     * @param dpiScale Display scale the glyphs are rasterised for
+     *
+     * @return ImFont* Font the glyphs went to, or nullptr on failure
+     */
+    ImFont *Fonts::addSource(ImFontAtlas *atlas, const FontSource &source, const ImWchar *textRanges,
+                             const float dpiScale)
+    {
+        // Configure font for high quality rendering on high DPI displays
+        ImFontConfig config;
+        config.OversampleH = 2;   // Horizontal oversampling for sharper fonts
+        config.OversampleV = 2;   // Vertical oversampling for sharper fonts
+        config.PixelSnapH = true; // Align to pixel boundaries
+        config.GlyphRanges = textRanges;
+        config.RasterizerDensity = dpiScale; // More pixels per glyph, same font size
+
+        switch (source.kind) {
+            case SourceKind::Default:
+                // MergeMode is false by default - this is a standalone font
+                return atlas->AddFontDefault(&config);
+            case SourceKind::Text:
+                return atlas->AddFontFromFileTTF(source.path.c_str(), source.size, &config);
+            case SourceKind::Icons: {
+                config.MergeMode = true;                // Merge icons with previous font
+                config.GlyphMinAdvanceX = source.size;  // Make icons monospace for consistency
+
+                // FontAwesome 4 glyph range (0xf000 - 0xf2e0)
+                static const ImWchar icons_ranges[] = { 0xf000, 0xf2e0, 0 };
+                config.GlyphRanges = icons_ranges;
+                return atlas->AddFontFromFileTTF(source.path.c_str(), source.size, &config);
+            }
+        }
+
+        return nullptr;
     }
 
     /**
@@ -56,17 +422,14 @@ namespace ADS::UI {
      */
     void Fonts::loadDefaultFonts()
     {
-        // Configure font for better quality on high DPI displays
-        ImFontConfig config;
-        config.OversampleH = 2;   // Horizontal oversampling for sharper fonts
-        config.OversampleV = 2;   // Vertical oversampling for sharper fonts
-        config.PixelSnapH = true; // Align to pixel boundaries
-        // MergeMode is false by default - this is a standalone font
-
-        ImFont* defaultFont = this->io->Fonts->AddFontDefault(&config);
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Fonts);
+        ADS_ZONE("Fonts::loadDefaultFonts");
+        const FontSource source{SourceKind::Default, "", 0.0f};
+        ImFont* defaultFont = addSource(this->io->Fonts, source, nullptr, this->dpiScale);
+        this->sources.push_back(source);
         this->loadedFonts["default"] = defaultFont;
 
-        spdlog::info("Default font loaded with high DPI configuration");
+        ADS_LOG_INFO(Ui, "Default font loaded with high DPI configuration");
     }
 
     /**
@@ -90,30 +453,26 @@ namespace ADS::UI {
      */
     ImFont *Fonts::loadFontFromFile(const std::string &fontName, const std::string &path, float size)
     {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Fonts);
+        ADS_ZONE("Fonts::loadFontFromFile");
         // Validate file exists
         if (!std::filesystem::exists(path)) {
-            spdlog::error("Font file not found: {}", path);
+            ADS_LOG_ERROR(Ui, "Font file not found: {}", path);
             return nullptr;
         }
 
-        // Configure font for high quality rendering
-        ImFontConfig config;
-        config.OversampleH = 2;   // Horizontal oversampling for sharper fonts
-        config.OversampleV = 2;   // Vertical oversampling for sharper fonts
-        config.PixelSnapH = true; // Align to pixel boundaries
-        // MergeMode is false by default - this is a standalone font
-
-        // Load the font with config
-        ImFont* font = this->io->Fonts->AddFontFromFileTTF(path.c_str(), size, &config);
+        const FontSource source{SourceKind::Text, path, size};
+        ImFont* font = addSource(this->io->Fonts, source, nullptr, this->dpiScale);
 
         if (font == nullptr) {
-            spdlog::error("Failed to load font '{}' from: {}", fontName, path);
+            ADS_LOG_ERROR(Ui, "Failed to load font '{}' from: {}", fontName, path);
             return nullptr;
         }
 
         // Store in the map
+        this->sources.push_back(source);
         this->loadedFonts[fontName] = font;
-        spdlog::info("Font '{}' loaded from: {} (size: {}px)", fontName, path, size);
+        ADS_LOG_INFO(Ui, "Font '{}' loaded from: {} (size: {}px)", fontName, path, size);
 
         return font;
     }
@@ -143,34 +502,27 @@ namespace ADS::UI {
      */
     ImFont *Fonts::loadIconFont(const std::string &path, float size)
     {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Fonts);
+        ADS_ZONE("Fonts::loadIconFont");
         // Validate file exists
         if (!std::filesystem::exists(path)) {
-            spdlog::error("Icon font file not found: {}", path);
+            ADS_LOG_ERROR(Ui, "Icon font file not found: {}", path);
             return nullptr;
         }
 
-        // Configure font for icon loading
-        ImFontConfig config;
-        config.MergeMode = true;            // Merge icons with previous font
-        config.GlyphMinAdvanceX = size;     // Make icons monospace for consistency
-        config.OversampleH = 2;             // High quality rendering
-        config.OversampleV = 2;             // High quality rendering
-        config.PixelSnapH = true;           // Align to pixel boundaries
-
-        // FontAwesome 4 glyph range (0xf000 - 0xf2e0)
-        static const ImWchar icons_ranges[] = { 0xf000, 0xf2e0, 0 };
-
-        // Load the icon font with proper glyph ranges
-        ImFont* iconFont = this->io->Fonts->AddFontFromFileTTF(path.c_str(), size, &config, icons_ranges);
+        // Merged into the previous font with the FontAwesome 4 glyph range
+        const FontSource source{SourceKind::Icons, path, size};
+        ImFont* iconFont = addSource(this->io->Fonts, source, nullptr, this->dpiScale);
 
         if (iconFont == nullptr) {
-            spdlog::error("Failed to load icon font from: {}", path);
+            ADS_LOG_ERROR(Ui, "Failed to load icon font from: {}", path);
             return nullptr;
         }
 
         // Store in the map with 'icons' key
+        this->sources.push_back(source);
         this->loadedFonts["icons"] = iconFont;
-        spdlog::info("Icon font loaded from: {} (size: {}px)", path, size);
+        ADS_LOG_INFO(Ui, "Icon font loaded from: {} (size: {}px)", path, size);
 
         return iconFont;
     }
@@ -200,7 +552,7 @@ namespace ADS::UI {
             return it->second;
         }
 
-        spdlog::warn("Font '{}' not found in loaded fonts", name);
+        ADS_LOG_WARN(Ui, "Font '{}' not found in loaded fonts", name);
         return nullptr;
     }
 
@@ -223,4 +575,285 @@ namespace ADS::UI {
         return this->loadedFonts.find(name) != this->loadedFonts.end();
     }
 
-} // namespace ADS::UI
\ No newline at end of file
+    /**
+     * @brief Build the font atlas, going through the disk cache
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Rasterising every TTF at its size is the most expensive step of the
+     * startup. The built atlas only depends on the font data and the
+     * settings it is built with, so it is stored under a hash of those and
+     * a warm start just copies the pixels and glyphs back; the renderer
+     * backend then uploads the texture without building anything.
+     *
+     * Text fonts get the glyph ranges requested through addGlyphs() so far
+     * instead of one fixed set; the directory and scale are kept for the
+     * later rebuilds.
+     *
+     * @param cacheDirectory Folder holding the cached atlases; empty to always build
+     * @param dpiScale Display scale the fonts are rasterised for
+     *
+     * @return true if the atlas is ready, false if ImGui failed to build it
+     *
+     * @note Fonts added after this call invalidate the atlas, as with ImFontAtlas::Build()
+     */
+    bool Fonts::buildAtlas(const std::filesystem::path &cacheDirectory, float dpiScale)
+    {
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Fonts);
+        ADS_ZONE("Fonts::buildAtlas");
+        this->cacheDirectory = cacheDirectory;
+        this->dpiScale = dpiScale;
+        this->atlasDpiScale = dpiScale;
+
+        // Fonts were added with ImGui's ranges and the previous scale; sources and ConfigData match one to one
+        ImFontAtlas *atlas = this->io->Fonts;
+        this->glyphs.BuildRanges(&this->glyphRanges);
+        if (static_cast<size_t>(atlas->ConfigData.Size) == this->sources.size()) {
+            for (size_t i = 0; i < this->sources.size(); ++i) {
+                ImFontConfig &config = atlas->ConfigData[static_cast<int>(i)];
+                config.RasterizerDensity = dpiScale;
+                if (this->sources[i].kind != SourceKind::Icons) {
+                    config.GlyphRanges = this->glyphRanges.Data;
+                }
+            }
+        }
+        this->glyphsChanged = false;
+        this->dpiScaleChanged = false;
+
+        return buildThroughCache(atlas, cacheDirectory, dpiScale);
+    }
+
+    /**
+     * @brief Make sure the text fonts cover every character of a text
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * ASCII is always in the atlas and is skipped without decoding, so
+     * most strings cost a scan of their bytes.
+     *
+     * @param text UTF-8 text
+     *
+     * @return true if the text had characters not requested before
+     */
+    bool Fonts::addGlyphs(std::string_view text)
+    {
+        bool added = false;
+        const char *cursor = text.data();
+        const char *end = text.data() + text.size();
+
+        while (cursor < end) {
+            if (static_cast<unsigned char>(*cursor) < 0x80) {
+                ++cursor;
+                continue;
+            }
+
+            unsigned int codepoint = 0;
+            cursor += ImTextCharFromUtf8(&codepoint, cursor, end);
+            if (codepoint <= IM_UNICODE_CODEPOINT_MAX && !this->glyphs.GetBit(codepoint)) {
+                this->glyphs.AddChar(static_cast<ImWchar>(codepoint));
+                added = true;
+            }
+        }
+
+        this->glyphsChanged |= added;
+        return added;
+    }
+
+    /**
+     * @brief Rasterise the glyphs for another display scale
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Setting the scale of the atlas being built or shown is a no-op, so
+     * every window event may pass the scale of its display.
+     *
+     * @param dpiScale Pixels per font pixel the glyphs are rasterised for
+     */
+    void Fonts::setDpiScale(const float dpiScale)
+    {
+        if (dpiScale <= 0.0f || dpiScale == this->dpiScale) {
+            return;
+        }
+        this->dpiScale = dpiScale;
+        this->dpiScaleChanged = true;
+    }
+
+    /**
+     * @brief Get the display scale of the atlas ImGui draws with
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return float Scale of the last buildAtlas() or swapped-in atlas
+     */
+    float Fonts::getDpiScale() const
+    {
+        return this->atlasDpiScale;
+    }
+
+    /**
+     * @brief Start rebuilding the atlas in the background if characters or the scale changed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The worker gets its own copy of the sources and ranges and an atlas
+     * nobody else sees, so it shares nothing with the UI thread but the
+     * finished flag. ImGui only counts allocations in its context, which
+     * the worker's allocations may race with; the counts are debug
+     * statistics and nothing reads the atlas memory through them.
+     */
+    void Fonts::rebuildIfNeeded()
+    {
+        if (!(this->glyphsChanged || this->dpiScaleChanged) || this->rebuildWorker.joinable() || this->sources.empty()) {
+            return;
+        }
+        this->glyphsChanged = false;
+        this->dpiScaleChanged = false;
+
+        Core::AllocationCounter::Scope memory(Core::AllocationCounter::Tag::Fonts);
+        this->glyphs.BuildRanges(&this->rebuiltRanges);
+        this->rebuiltAtlas = IM_NEW(ImFontAtlas)();
+        this->rebuiltAtlas->Flags = this->io->Fonts->Flags;
+        this->rebuiltAtlas->TexDesiredWidth = this->io->Fonts->TexDesiredWidth;
+        this->rebuiltAtlas->TexGlyphPadding = this->io->Fonts->TexGlyphPadding;
+        this->rebuildSucceeded = false;
+        this->rebuiltDpiScale = this->dpiScale;
+        this->rebuildFinished.store(false, std::memory_order_relaxed);
+
+        this->rebuildWorker = std::thread([this, sources = this->sources, atlas = this->rebuiltAtlas,
+                                           ranges = this->rebuiltRanges.Data,
+                                           cacheDirectory = this->cacheDirectory, dpiScale = this->dpiScale]() {
+            Core::AllocationCounter::Scope workerMemory(Core::AllocationCounter::Tag::Fonts);
+            ADS_ZONE("Fonts::rebuildIfNeeded worker");
+            bool succeeded = true;
+            for (const FontSource &source: sources) {
+                succeeded = succeeded && addSource(atlas, source, ranges, dpiScale) != nullptr;
+            }
+            this->rebuildSucceeded = succeeded && buildThroughCache(atlas, cacheDirectory, dpiScale);
+            this->rebuildFinished.store(true, std::memory_order_release);
+        });
+    }
+
+    /**
+     * @brief Check whether a rebuild is running or waiting to be swapped in
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return true from rebuildIfNeeded() starting a rebuild until swapAtlas()
+     */
+    bool Fonts::isRebuilding() const
+    {
+        return this->rebuildWorker.joinable();
+    }
+
+    /**
+     * @brief Check whether a rebuilt atlas is waiting for swapAtlas()
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return true once the worker is done, whether or not it succeeded
+     */
+    bool Fonts::hasRebuiltAtlas() const
+    {
+        return this->rebuildWorker.joinable() && this->rebuildFinished.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Replace the ImGui font atlas with the rebuilt one
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Both atlases hold the same fonts in the same order, so every font is
+     * mapped to the one at its position. The old atlas is freed right away:
+     * ImGui picks its current font from io.FontDefault or the atlas on the
+     * next NewFrame(), and nothing else keeps a font across frames.
+     *
+     * @return true if the atlas was replaced, false if no rebuild was
+     *         finished or it failed
+     */
+    bool Fonts::swapAtlas()
+    {
+        if (!this->hasRebuiltAtlas()) {
+            return false;
+        }
+        this->rebuildWorker.join();
+
+        ImFontAtlas *rebuilt = std::exchange(this->rebuiltAtlas, nullptr);
+        if (!this->rebuildSucceeded) {
+            ADS_LOG_ERROR(Ui, "Failed to rebuild the font atlas; keeping the current glyphs");
+            IM_DELETE(rebuilt);
+            return false;
+        }
+
+        ImFontAtlas *previous = this->io->Fonts;
+        auto counterpart = [previous, rebuilt](ImFont *font) -> ImFont * {
+            const int index = previous->Fonts.find_index(font);
+            return (index >= 0 && index < rebuilt->Fonts.Size) ? rebuilt->Fonts[index] : nullptr;
+        };
+        for (auto &[name, font]: this->loadedFonts) {
+            font = counterpart(font);
+        }
+        if (this->io->FontDefault != nullptr) {
+            this->io->FontDefault = counterpart(this->io->FontDefault);
+        }
+
+        // The context owns io.Fonts and frees whichever atlas it holds at shutdown
+        this->io->Fonts = rebuilt;
+        IM_DELETE(previous);
+        this->glyphRanges.swap(this->rebuiltRanges);
+        this->atlasDpiScale = this->rebuiltDpiScale;
+        ADS_LOG_INFO(Ui, "Font atlas rebuilt with {} glyph ranges at scale {}", this->glyphRanges.Size / 2,
+                     this->atlasDpiScale);
+
+        return true;
+    }
+
+    /**
+     * @brief Locate an icon of the icon font in the font texture
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The icons are merged into the font that was loaded before them, so
+     * the glyph is looked up in that font and placed in its line height.
+     *
+     * @param icon UTF-8 icon, e.g. ICON_FA_FILE_O
+     * @param image Filled with the glyph's texture, quad and UVs
+     *
+     * @return true if the icon font is loaded, built and has the icon
+     */
+    bool Fonts::findIcon(std::string_view icon, IconImage &image)
+    {
+        auto it = this->loadedFonts.find("icons");
+        if (it == this->loadedFonts.end() || it->second == nullptr || icon.empty()) {
+            return false;
+        }
+
+        unsigned int codepoint = 0;
+        ImTextCharFromUtf8(&codepoint, icon.data(), icon.data() + icon.size());
+        ImFont *font = it->second;
+        const ImFontGlyph *glyph = codepoint <= IM_UNICODE_CODEPOINT_MAX
+                                       ? font->FindGlyphNoFallback(static_cast<ImWchar>(codepoint))
+                                       : nullptr;
+        if (glyph == nullptr) {
+            return false;
+        }
+
+        image.texture = font->ContainerAtlas->TexID;
+        image.cell = ImVec2(glyph->AdvanceX, font->FontSize);
+        image.min = ImVec2(glyph->X0, glyph->Y0);
+        image.max = ImVec2(glyph->X1, glyph->Y1);
+        image.uv0 = ImVec2(glyph->U0, glyph->V0);
+        image.uv1 = ImVec2(glyph->U1, glyph->V1);
+
+        return true;
+    }
+
+} // namespace ADS::UI
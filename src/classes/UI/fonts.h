@@ -13,19 +13,82 @@
 
 #ifndef ADS_FONTS_H
 #define ADS_FONTS_H
+#include <atomic>
+#include <filesystem>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "imgui.h"
 
 namespace ADS::UI {
     class Fonts
     {
+    public:
+        /**
+         * @brief An icon glyph as an image in the font texture
+         *
+         * Positions are in pixels from the top-left corner of the icon's
+         * cell, the box the glyph takes when laid out as text.
+         */
+        struct IconImage {
+            ImTextureID texture;
+            ImVec2 cell;    ///< Advance and line height of the icon font
+            ImVec2 min;     ///< Top-left corner of the glyph quad in the cell
+            ImVec2 max;     ///< Bottom-right corner of the glyph quad in the cell
+            ImVec2 uv0;
+            ImVec2 uv1;
+        };
+
     private:
+        /**
+         * @brief What a font added to the atlas was loaded from
+         */
+        enum class SourceKind { Default, Text, Icons };
+
+        /**
+         * @brief One font added to the atlas, kept to add it again to a rebuilt atlas
+         */
+        struct FontSource {
+            SourceKind kind;
+            std::string path;       ///< Empty for the default font
+            float size;
+        };
+
         ImGuiIO *io;
 
         std::unordered_map<std::string, ImFont *> loadedFonts;
 
+        std::vector<FontSource> sources;            ///< In the order of the atlas ConfigData
+        ImFontGlyphRangesBuilder glyphs;            ///< Codepoints the text fonts must cover
+        ImVector<ImWchar> glyphRanges;              ///< Ranges of the current atlas; read again by every build
+        bool glyphsChanged = false;                 ///< glyphs has codepoints the current atlas lacks
+        std::filesystem::path cacheDirectory;       ///< From the last buildAtlas()
+        float dpiScale = 1.0f;                      ///< Scale the next atlas is rasterised for
+        float atlasDpiScale = 1.0f;                 ///< Scale the current atlas was rasterised for
+        bool dpiScaleChanged = false;               ///< dpiScale was set after the last build started
+
+        std::thread rebuildWorker;                  ///< Builds rebuiltAtlas off the UI thread
+        ImFontAtlas *rebuiltAtlas = nullptr;        ///< Owned by the worker until rebuildFinished
+        ImVector<ImWchar> rebuiltRanges;            ///< Ranges of rebuiltAtlas
+        std::atomic<bool> rebuildFinished{false};   ///< Set by the worker as its last action
+        bool rebuildSucceeded = false;              ///< Written by the worker before rebuildFinished
+        float rebuiltDpiScale = 1.0f;               ///< Scale rebuiltAtlas is rasterised for
+
+        /**
+         * @brief Add a recorded font to an atlas
+         *
+         * @param atlas Atlas the font is added to
+         * @param source Font to add
+         * @param textRanges Glyph ranges of default and text fonts; nullptr for ImGui's default ranges
+         * @param dpiScale Display scale the glyphs are rasterised for
+         * @return ImFont* Font the glyphs went to, or nullptr on failure
+         */
+        static ImFont *addSource(ImFontAtlas *atlas, const FontSource &source, const ImWchar *textRanges,
+                                 float dpiScale);
+
     public:
         /**
          * @brief Construct a new Fonts manager
@@ -35,6 +98,14 @@ namespace ADS::UI {
          */
         explicit Fonts(ImGuiIO *io);
 
+        /**
+         * @brief Wait for a running atlas rebuild and drop its result
+         */
+        ~Fonts();
+
+        Fonts(const Fonts &) = delete;
+        Fonts &operator=(const Fonts &) = delete;
+
         /**
          * @brief Load ImGui's default font
          *
@@ -81,6 +152,120 @@ namespace ADS::UI {
          */
         bool hasFont(const std::string &name);
 
+        /**
+         * @brief Build the font atlas, going through the disk cache
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Call once every font has been added and before the renderer
+         * backend creates the font texture. The cache entry is named by a
+         * hash of the font data, sizes, glyph ranges, rasterizer settings,
+         * DPI scale and ImGui version, so any change builds a new one. On a
+         * hit the atlas pixels and glyph tables are restored as they were
+         * and no TTF is rasterised; on a miss the atlas is built as usual
+         * and stored for the next start.
+         *
+         * @param cacheDirectory Folder holding the cached atlases; empty to always build
+         * @param dpiScale Display scale the fonts are rasterised for
+         * @return true if the atlas is ready, false if ImGui failed to build it
+         */
+        bool buildAtlas(const std::filesystem::path &cacheDirectory, float dpiScale = 1.0f);
+
+        /**
+         * @brief Make sure the text fonts cover every character of a text
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Characters the atlas lacks are rasterised by the next
+         * rebuildIfNeeded(); until the rebuilt atlas is swapped in they show
+         * as the fallback glyph. Cheap for text already covered, so it can be
+         * called on every string that reaches the screen.
+         *
+         * @param text UTF-8 text
+         * @return true if the text had characters not requested before
+         */
+        bool addGlyphs(std::string_view text);
+
+        /**
+         * @brief Rasterise the glyphs for another display scale
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The next rebuildIfNeeded() builds the atlas again at the new
+         * scale in the background. Font sizes are unchanged: the glyphs get
+         * more or fewer pixels, so text stays sharp once ImGui draws it at
+         * the new scale. Nothing changes on screen until swapAtlas().
+         *
+         * @param dpiScale Pixels per font pixel the glyphs are rasterised for
+         */
+        void setDpiScale(float dpiScale);
+
+        /**
+         * @brief Get the display scale of the atlas ImGui draws with
+         *
+         * @return float Scale of the last buildAtlas() or swapped-in atlas
+         */
+        [[nodiscard]] float getDpiScale() const;
+
+        /**
+         * @brief Start rebuilding the atlas in the background if characters or the scale changed
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The new atlas is built on a worker thread, through the disk cache,
+         * with the same fonts, the glyph ranges requested so far and the
+         * last display scale set. Only one rebuild runs at a time; changes
+         * made meanwhile start another once it has been swapped in. Call
+         * once per frame on the UI thread.
+         */
+        void rebuildIfNeeded();
+
+        /**
+         * @brief Check whether a rebuild is running or waiting to be swapped in
+         */
+        [[nodiscard]] bool isRebuilding() const;
+
+        /**
+         * @brief Check whether a rebuilt atlas is waiting for swapAtlas()
+         */
+        [[nodiscard]] bool hasRebuiltAtlas() const;
+
+        /**
+         * @brief Replace the ImGui font atlas with the rebuilt one
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Call between frames, after the renderer backend has released the
+         * texture of the current atlas; the backend uploads the new one on
+         * the next frame. Fonts returned by getFont() before the swap are
+         * replaced by their counterparts in the new atlas.
+         *
+         * @return true if the atlas was replaced, false if no rebuild was
+         *         finished or it failed
+         */
+        bool swapAtlas();
+
+        /**
+         * @brief Locate an icon of the icon font in the font texture
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Icons are packed into the font atlas with the text, rasterised at
+         * the atlas' DPI, so drawing one as an image needs no font change
+         * and shares the texture, and the draw command, of the text around
+         * it. Look it up every frame: a rebuilt atlas moves the glyphs.
+         *
+         * @param icon UTF-8 icon, e.g. ICON_FA_FILE_O
+         * @param image Filled with the glyph's texture, quad and UVs
+         * @return true if the icon font is loaded, built and has the icon
+         */
+        bool findIcon(std::string_view icon, IconImage &image);
 
     };
 } // ADS
@@ -0,0 +1,101 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+
+#include "Config.h"
+
+#include <charconv>
+#include <utility>
+
+#include "adsString.h"
+
+namespace ADS {
+
+    namespace {
+        using Values = std::unordered_map<std::string, std::string>;
+
+        const std::string* find(const Values& values, const std::string& key)
+        {
+            auto it = values.find(key);
+            return it != values.end() ? &it->second : nullptr;
+        }
+
+        void read(const Values& values, const std::string& key, bool& field)
+        {
+            if (const std::string* value = find(values, key)) {
+                field = stringToBool(*value);
+            }
+        }
+
+        void read(const Values& values, const std::string& key, std::string& field)
+        {
+            if (const std::string* value = find(values, key)) {
+                field = *value;
+            }
+        }
+
+        template <typename T>
+        void readNumber(const Values& values, const std::string& key, T& field)
+        {
+            const std::string* value = find(values, key);
+            if (value == nullptr) {
+                return;
+            }
+            const std::string_view trimmed = trimView(*value);
+            T parsed{};
+            const auto [end, error] = std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), parsed);
+            // A malformed or partly numeric value keeps the default
+            if (error == std::errc() && end == trimmed.data() + trimmed.size()) {
+                field = parsed;
+            }
+        }
+    }
+
+    /**
+     * @brief Build the settings from the raw .env values
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param values Values by upper case key, kept in the result
+     * @return Config The settings, defaults where a value is missing or malformed
+     */
+    Config Config::parse(Values values)
+    {
+        Config config;
+        read(values, "DEBUG", config.debug);
+        if (const std::string* languages = find(values, "LANGUAGES")) {
+            config.languages = explode(*languages, ',');
+        }
+        read(values, "LAZY_LANGUAGES", config.lazyLanguages);
+        read(values, "WATCH_TRANSLATIONS", config.watchTranslations);
+        read(values, "WATCH_ENV", config.watchEnvironment);
+        read(values, "IDLE_RENDERING", config.idleRendering);
+        readNumber(values, "JOB_WORKERS", config.jobWorkers);
+        readNumber(values, "AUTOSAVE_INTERVAL", config.autosaveInterval);
+        readNumber(values, "TOOLTIP_DELAY", config.tooltipDelay);
+        read(values, "RENDERER", config.renderer);
+        read(values, "LOG_OVERFLOW", config.logOverflow);
+        readNumber(values, "LOG_QUEUE_SIZE", config.logQueueSize);
+        read(values, "LOG_LEVELS", config.logLevels);
+        read(values, "TRACE_FILE", config.traceFile);
+        read(values, "INPUT_LOG", config.inputLog);
+        read(values, "STARTUP_PROJECT", config.startupProject);
+        read(values, "SYNC_HOST", config.syncHost);
+        readNumber(values, "SYNC_PORT", config.syncPort);
+        read(values, "LIGHT_FONT", config.lightFont);
+        read(values, "MEDIUM_FONT", config.mediumFont);
+        read(values, "REGULAR_FONT", config.regularFont);
+        config.values = std::move(values);
+        return config;
+    }
+} // ADS
@@ -0,0 +1,74 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_ENV_CONFIG_H
+#define ADS_ENV_CONFIG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "System.h"
+
+namespace ADS {
+
+    /**
+     * @brief Typed settings read from the .env file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Built whenever the .env file is loaded, so reading a setting is a
+     * field access: no key lookup, no string copy and no parsing. Keys
+     * that are missing or do not parse keep the default written here.
+     * A published Config never changes; a reload publishes a new one.
+     */
+    struct Config {
+        std::unordered_map<std::string, std::string> values;   ///< Raw values by upper case key, for Environment::get()
+        uint64_t generation = 0;                            ///< Set when published; unique across Environment instances
+
+        bool debug = false;                                 ///< DEBUG
+        std::vector<std::string> languages;                 ///< LANGUAGES, comma separated
+        bool lazyLanguages = false;                         ///< LAZY_LANGUAGES
+        bool watchTranslations = false;                     ///< WATCH_TRANSLATIONS
+        bool watchEnvironment = false;                      ///< WATCH_ENV
+        bool idleRendering = true;                          ///< IDLE_RENDERING
+        size_t jobWorkers = 0;                              ///< JOB_WORKERS; 0 sizes the pool to the machine
+        float autosaveInterval = 60.0f;                     ///< AUTOSAVE_INTERVAL in seconds; 0 disables autosave
+        float tooltipDelay = Constants::System::DEFAULT_TOOLTIP_DELAY;     ///< TOOLTIP_DELAY in seconds
+        std::string renderer = "sdl";                       ///< RENDERER
+        std::string logOverflow = "block";                  ///< LOG_OVERFLOW
+        size_t logQueueSize = 0;                            ///< LOG_QUEUE_SIZE; 0 keeps the logger default
+        std::string logLevels;                              ///< LOG_LEVELS
+        std::string traceFile;                              ///< TRACE_FILE; empty disables tracing
+        std::string inputLog;                               ///< INPUT_LOG; empty disables input recording
+        std::string startupProject;                         ///< STARTUP_PROJECT; loaded in the background at startup, empty for none
+        std::string syncHost;                               ///< SYNC_HOST; host to join, empty to host the session
+        uint16_t syncPort = 0;                              ///< SYNC_PORT; 0 disables collaborative editing
+        std::string lightFont;                              ///< LIGHT_FONT
+        std::string mediumFont;                             ///< MEDIUM_FONT
+        std::string regularFont;                            ///< REGULAR_FONT
+
+        /**
+         * @brief Build the settings from the raw .env values
+         *
+         * @param values Values by upper case key, kept in the result
+         * @return Config The settings, defaults where a value is missing or malformed
+         */
+        static Config parse(std::unordered_map<std::string, std::string> values);
+    };
+
+} // ADS
+
+#endif //ADS_ENV_CONFIG_H
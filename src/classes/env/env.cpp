@@ -13,11 +13,15 @@
 
 #include "env.h"
 #include <algorithm>
+#include <cctype>
 #include <filesystem>
 #include <fstream>
+#include <system_error>
 #include <utility>
 
 #include "adsString.h"
+#include "Core/TraceRecorder.h"
+#include "Logger/logger.h"
 #include "../../exceptions/filesystem/file_not_found_exception.h"
 
 namespace ADS {
@@ -52,7 +56,21 @@ namespace ADS {
             this->filename = std::move(filename);
         }
 
-        this->open();
+        if (!this->open()) {
+            // Readers always find settings, the defaults if need be
+            this->publish(Config());
+        }
+    }
+
+    /**
+     * @brief Stop watching the file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     */
+    Environment::~Environment()
+    {
+        this->stopWatching();
     }
 
     /**
@@ -76,36 +94,42 @@ namespace ADS {
      */
     bool Environment::open()
     {
+        Core::TraceRecorder::Scope trace("Environment::open");
         std::string line;
         std::ifstream file(std::string(this->filename));
+        unordered_map<string, string> values;
 
         if (!file.is_open()) {
             return false;
         }
 
         while (std::getline(file, line)) {
-            if (line.empty() || line[0] == '#') {
+            const std::string_view entry(line);
+            if (entry.empty() || entry[0] == '#') {
                 continue;
             }
 
-            auto pos = line.find('=');
-            if (pos == std::string::npos) {
+            auto pos = findDelimiter(entry, '=');
+            if (pos == std::string_view::npos) {
                 continue;
             };
 
-            std::string key = line.substr(0, pos);
-            std::string value = line.substr(pos + 1);
+            // Keys are matched case-insensitively; storing them upper case spares get() the conversion
+            std::string key(entry.substr(0, pos));
+            std::transform(key.begin(), key.end(), key.begin(),
+                [](unsigned char c){ return std::toupper(c); });
+            std::string_view value = entry.substr(pos + 1);
 
             // Removes spaces and quotes
             if (!value.empty() && value.front() == '"') {
-                value.erase(0, 1);
+                value.remove_prefix(1);
             }
 
             if (!value.empty() && value.back() == '"') {
-                value.pop_back();
+                value.remove_suffix(1);
             }
 
-            this->environment[key] = value;
+            values.insert_or_assign(std::move(key), std::string(value));
 
 // #if defined(_WIN32)
 //             _putenv_s(key.c_str(), value.c_str());
@@ -115,10 +139,67 @@ namespace ADS {
         }
 
         file.close();
+        this->publish(Config::parse(std::move(values)));
 
         return true;
     }
 
+    /**
+     * @brief Publish new settings and record the keys that differ from the last ones
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param config Settings just parsed
+     */
+    void Environment::publish(Config config)
+    {
+        // Generations are unique across instances, so the per-thread cache of getConfig() needs one slot
+        static atomic<uint64_t> lastGeneration = 0;
+
+        lock_guard lock(this->publishMutex);
+        const shared_ptr<const Config> previous = this->published.load();
+
+        vector<string> keys;
+        if (previous != nullptr) {
+            for (const auto& [key, value] : config.values) {
+                auto it = previous->values.find(key);
+                if (it == previous->values.end() || it->second != value) {
+                    keys.push_back(key);
+                }
+            }
+            for (const auto& [key, value] : previous->values) {
+                if (!config.values.contains(key)) {
+                    keys.push_back(key);
+                }
+            }
+            if (keys.empty()) {
+                // Saved without a change: readers keep what they have
+                return;
+            }
+        }
+
+        config.generation = ++lastGeneration;
+        const uint64_t generation = config.generation;
+        this->published.store(make_shared<const Config>(std::move(config)));
+        this->publishedGeneration.store(generation, memory_order_release);
+
+        if (keys.empty()) {
+            return;
+        }
+        {
+            lock_guard changedLock(this->changedMutex);
+            for (string& key : keys) {
+                if (std::find(this->changedKeys.begin(), this->changedKeys.end(), key) == this->changedKeys.end()) {
+                    this->changedKeys.push_back(std::move(key));
+                }
+            }
+        }
+        if (this->wakeup) {
+            this->wakeup();
+        }
+    }
+
     /**
      * @brief Retrieve value for a given environment variable key
      *
@@ -126,30 +207,30 @@ namespace ADS {
      * @version Jan 2025
      *
      * Searches for the specified key in the internal environment map
-     * and returns a pointer to its value if found. Returns nullptr if
-     * the key does not exist.
+     * and returns a copy of its value if found.
      *
      * @param key Reference to the environment variable name to search
      *
-     * @return Pointer to the string value if key exists
-     * @return nullptr if key is not found
-     *
-     * @warning The returned pointer is only valid while the Environment
-     *          object exists and the internal map is not modified
-     * @note Consider using const string& for the key parameter
+     * @return The string value if key exists
+     * @return std::nullopt if key is not found
      */
-    string* Environment::get(const string& key)
+    optional<string> Environment::get(const string& key) const
     {
-        string upperKey = key;
-        std::transform(upperKey.begin(), upperKey.end(), upperKey.begin(),
-            [](unsigned char c){ return std::toupper(c); });
-
-        auto it = this->environment.find(upperKey);
-        if (it != this->environment.end()) {
-            return &(it->second);
+        const shared_ptr<const Config> config = this->getConfig();
+        const unordered_map<string, string>& values = config->values;
+        auto it = values.find(key);
+        if (it == values.end() &&
+            std::any_of(key.begin(), key.end(), [](unsigned char c){ return std::islower(c); })) {
+            string upperKey = key;
+            std::transform(upperKey.begin(), upperKey.end(), upperKey.begin(),
+                [](unsigned char c){ return std::toupper(c); });
+            it = values.find(upperKey);
+        }
+        if (it != values.end()) {
+            return it->second;
         }
 
-        return nullptr;
+        return nullopt;
     }
 
     /**
@@ -166,10 +247,176 @@ namespace ADS {
      * @param defaultValue Value to return if key is not found
      * @return Environment value or default value
      */
-    string Environment::getOrDefault(const string& key, const string& defaultValue)
+    string Environment::getOrDefault(const string& key, const string& defaultValue) const
+    {
+        return get(key).value_or(defaultValue);
+    }
+
+    /**
+     * @brief Get the typed settings parsed from the .env file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The thread's cached pointer is copied out, so the caller shares
+     * ownership of the settings and a later reload cannot free them.
+     *
+     * @return shared_ptr<const Config> Settings of the calling thread
+     */
+    shared_ptr<const Config> Environment::getConfig() const
+    {
+        thread_local shared_ptr<const Config> cached;
+
+        // Only re-read the shared pointer when newer settings have been published
+        if (cached == nullptr || cached->generation != this->publishedGeneration.load(memory_order_acquire)) {
+            cached = this->published.load();
+        }
+        return cached;
+    }
+
+    /**
+     * @brief Reload the file in the background whenever it changes
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param interval Time between two checks of the file
+     */
+    void Environment::watch(const chrono::milliseconds interval)
+    {
+        this->stopWatching();
+
+        error_code error;
+        this->fileTime = filesystem::last_write_time(this->filename, error);
+        this->filePending = false;
+        this->watchInterval = interval;
+        this->stopping = false;
+        this->watcher = thread(&Environment::run, this);
+    }
+
+    /**
+     * @brief Stop reloading the file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     */
+    void Environment::stopWatching()
+    {
+        {
+            lock_guard lock(this->stopMutex);
+            this->stopping = true;
+        }
+        this->stopSignal.notify_all();
+
+        if (this->watcher.joinable()) {
+            this->watcher.join();
+        }
+    }
+
+    void Environment::run()
     {
-        string* value = get(key);
-        return value ? *value : defaultValue;
+        Core::TraceRecorder::setThreadName("Environment watcher");
+        unique_lock lock(this->stopMutex);
+        while (!this->stopSignal.wait_for(lock, this->watchInterval, [this] { return this->stopping; })) {
+            lock.unlock();
+            this->poll();
+            lock.lock();
+        }
+    }
+
+    void Environment::poll()
+    {
+        // The file may be briefly missing while an editor replaces it; try again next time
+        error_code error;
+        const filesystem::file_time_type time = filesystem::last_write_time(this->filename, error);
+        if (error) {
+            return;
+        }
+
+        if (time != this->fileTime) {
+            // Still being written, or just written: wait for it to settle
+            this->fileTime = time;
+            this->filePending = true;
+        } else if (this->filePending) {
+            this->filePending = false;
+            if (!this->open()) {
+                ADS_LOG_WARN(Io, "Keeping the loaded settings: '{}' could not be reloaded", this->filename);
+            }
+        }
+    }
+
+    /**
+     * @brief Set the function called from the watcher thread when a reload changed some key
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param callback Called from the watcher thread
+     */
+    void Environment::setChangeWakeup(function<void()> callback)
+    {
+        lock_guard lock(this->publishMutex);
+        this->wakeup = std::move(callback);
+    }
+
+    /**
+     * @brief Register a function called with the keys changed by each reload
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param callback Called by update(), on the main thread
+     * @return Subscription Handle for unsubscribe()
+     */
+    Environment::Subscription Environment::subscribe(ChangeCallback callback)
+    {
+        const Subscription subscription = this->nextSubscription++;
+        this->subscribers.emplace_back(subscription, std::move(callback));
+        return subscription;
+    }
+
+    /**
+     * @brief Stop a subscriber registered with subscribe()
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param subscription Handle returned by subscribe()
+     */
+    void Environment::unsubscribe(const Subscription subscription)
+    {
+        std::erase_if(this->subscribers, [subscription](const auto& entry) {
+            return entry.first == subscription;
+        });
+    }
+
+    /**
+     * @brief Report the keys changed by the reloads since the last call to the subscribers
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return size_t Number of changed keys reported
+     */
+    size_t Environment::update()
+    {
+        vector<string> keys;
+        {
+            lock_guard lock(this->changedMutex);
+            keys.swap(this->changedKeys);
+        }
+        if (keys.empty()) {
+            return 0;
+        }
+
+        ADS_LOG_INFO(Io, "Reloaded {}: {} setting(s) changed", this->filename, keys.size());
+        const shared_ptr<const Config> config = this->getConfig();
+        // A subscriber may unsubscribe itself
+        const vector<pair<Subscription, ChangeCallback>> current = this->subscribers;
+        for (const auto& [subscription, callback] : current) {
+            callback(keys, *config);
+        }
+        return keys.size();
     }
 
     /**
@@ -185,29 +432,10 @@ namespace ADS {
      * @return true if DEBUG exists and is set to "TRUE", "1", "YES", or "ON"
      * @return false if DEBUG is missing, empty, or set to any other value
      *
-     * @note The function trims whitespace and performs case-insensitive
-     *       comparison for flexibility in .env file formatting
-     * @see get() for the underlying environment variable retrieval
+     * @note Parsed by open(), see Config
      */
-    bool Environment::isDebug()
+    bool Environment::isDebug() const
     {
-        string* value = this->get("DEBUG");
-
-        if (value == nullptr || value->empty()) {
-            return false;
-        }
-
-        // Trim whitespace and convert to uppercase
-        string trimmedValue = trim(*value);
-
-        // Convert to uppercase
-        std::transform(trimmedValue.begin(), trimmedValue.end(), trimmedValue.begin(),
-            [](unsigned char c){ return std::toupper(c); });
-
-        // Check for common "true" values
-        return trimmedValue == "TRUE" ||
-               trimmedValue == "1" ||
-               trimmedValue == "YES" ||
-               trimmedValue == "ON";
+        return this->getConfig()->debug;
     }
 } // ADS
\ No newline at end of file
@@ -13,8 +13,21 @@
 #ifndef ADS_ENV_H
 #define ADS_ENV_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Config.h"
 
 namespace ADS {
 
@@ -29,8 +42,24 @@ namespace ADS {
      * Handles loading and accessing environment variables from .env files.
      * Parses key-value pairs and optionally sets them as system environment
      * variables. Supports comment lines (starting with #) and quoted values.
+     *
+     * The parsed values are published as an immutable Config. watch()
+     * re-reads the file on a background thread whenever it changes and
+     * publishes the new Config atomically, so readers on any thread take
+     * no lock; the subscribers learn which keys changed from update(), on
+     * the main thread.
      */
     class Environment {
+    public:
+        /**
+         * Called with the keys added, removed or changed by a reload and the new settings
+         */
+        using ChangeCallback = function<void(const vector<string>& keys, const Config& config)>;
+
+        /**
+         * Handle of a subscriber, for unsubscribe()
+         */
+        using Subscription = size_t;
 
     private:
         /**
@@ -39,9 +68,60 @@ namespace ADS {
         string filename;
 
         /**
-         * Internal storage for environment variables as key-value pairs
+         * Last published settings, with the raw values; see getConfig()
          */
-        unordered_map<string, string> environment;
+        atomic<shared_ptr<const Config>> published;
+
+        /**
+         * Generation of published, stored after it so that threads can tell
+         * their cached settings are current without touching the shared_ptr
+         */
+        atomic<uint64_t> publishedGeneration = 0;
+
+        /**
+         * Serialises publications from open() and the watcher thread
+         */
+        mutex publishMutex;
+
+        /**
+         * Keys changed by reloads not yet reported by update()
+         */
+        vector<string> changedKeys;
+        mutex changedMutex;
+
+        /**
+         * Called from the watcher thread after a reload changed some key
+         */
+        function<void()> wakeup;
+
+        /**
+         * Subscribers by handle; only used on the main thread
+         */
+        vector<pair<Subscription, ChangeCallback>> subscribers;
+        Subscription nextSubscription = 1;
+
+        /**
+         * Watcher thread state; see watch()
+         */
+        chrono::milliseconds watchInterval{0};
+        filesystem::file_time_type fileTime;
+        bool filePending = false;
+        mutex stopMutex;
+        condition_variable stopSignal;
+        bool stopping = false;
+        thread watcher;
+
+        /**
+         * @brief Publish new settings and record the keys that differ from the last ones
+         */
+        void publish(Config config);
+
+        /**
+         * @brief Reload the file once its modification time has settled
+         */
+        void poll();
+
+        void run();
 
     public:
         /**
@@ -60,6 +140,15 @@ namespace ADS {
          */
         explicit Environment(string filename = ".env");
 
+        /**
+         * @brief Stop watching the file
+         */
+        ~Environment();
+
+        // Not copyable: the watcher thread and the published settings refer to this instance
+        Environment(const Environment&) = delete;
+        Environment& operator=(const Environment&) = delete;
+
         /**
          * @brief Load and parse environment variables from .env file
          *
@@ -70,7 +159,9 @@ namespace ADS {
          * should follow the format KEY=VALUE. Comments (lines starting with #)
          * and empty lines are ignored. Values enclosed in double quotes have
          * the quotes removed. All parsed variables are stored internally and
-         * set as system environment variables.
+         * set as system environment variables. Keys are stored upper case,
+         * and the settings are published as a new Config. Safe to call
+         * from any thread.
          *
          * @return true if file was successfully opened and parsed
          * @return false if file could not be opened
@@ -88,19 +179,15 @@ namespace ADS {
          * @version Oct 2025
          *
          * Searches for the specified key in the internal environment map
-         * and returns a pointer to its value if found. Returns nullptr if
-         * the key does not exist.
+         * and returns a copy of its value if found, so a reload cannot
+         * invalidate it.
          *
          * @param key Reference to the environment variable name to search
          *
-         * @return Pointer to the string value if key exists
-         * @return nullptr if key is not found
-         *
-         * @warning The returned pointer is only valid while the Environment
-         *          object exists and the internal map is not modified
-         * @note Consider using const string& for the key parameter
+         * @return The string value if key exists
+         * @return std::nullopt if key is not found
          */
-        string* get (const string &key);
+        optional<string> get(const string &key) const;
 
         /**
          * @brief Retrieve value for a key with fallback default
@@ -126,7 +213,75 @@ namespace ADS {
          * string port = env.getOrDefault("PORT", "8080");
          * string debug = env.getOrDefault("DEBUG", "false");
          */
-        string getOrDefault(const string& key, const string& defaultValue = "");
+        string getOrDefault(const string& key, const string& defaultValue = "") const;
+
+        /**
+         * @brief Get the typed settings parsed from the .env file
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Prefer this over get() for the known keys: the values were parsed
+         * once on load, so reading them costs nothing. Each thread keeps the
+         * settings it read last and only takes the new ones after a reload,
+         * which costs a single atomic load; no lock is taken.
+         *
+         * @return shared_ptr<const Config> The settings; never null. They stay
+         *         valid while the pointer is held, whatever reloads happen meanwhile
+         */
+        [[nodiscard]] shared_ptr<const Config> getConfig() const;
+
+        /**
+         * @brief Reload the file in the background whenever it changes
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Polls the modification time of the file, and re-reads it once the
+         * time has stayed the same for a whole interval, so a file an editor
+         * is still writing is not read half-way.
+         *
+         * @param interval Time between two checks of the file
+         */
+        void watch(chrono::milliseconds interval = chrono::milliseconds(500));
+
+        /**
+         * @brief Stop reloading the file
+         */
+        void stopWatching();
+
+        /**
+         * @brief Set the function called from the watcher thread when a reload changed some key
+         *
+         * @param callback Called from the watcher thread, e.g. App::requestRedraw()
+         */
+        void setChangeWakeup(function<void()> callback);
+
+        /**
+         * @brief Register a function called with the keys changed by each reload
+         *
+         * @param callback Called by update(), on the main thread
+         * @return Subscription Handle for unsubscribe()
+         */
+        Subscription subscribe(ChangeCallback callback);
+
+        /**
+         * @brief Stop a subscriber registered with subscribe()
+         * @param subscription Handle returned by subscribe(); unknown handles are ignored
+         */
+        void unsubscribe(Subscription subscription);
+
+        /**
+         * @brief Report the keys changed by the reloads since the last call to the subscribers
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Called once per frame on the main thread.
+         *
+         * @return size_t Number of changed keys reported
+         */
+        size_t update();
 
         /**
          * @brief Return true if debug mode is on (.env). False otherwise
@@ -134,11 +289,11 @@ namespace ADS {
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Nov 2025
          *
-         * Searches into the environment for the 'DEBUG' and return its value
+         * Returns the DEBUG setting parsed when the file was loaded
          *
          * @return Boolean value
          */
-        bool isDebug();
+        bool isDebug() const;
     };
 
 } // ADS
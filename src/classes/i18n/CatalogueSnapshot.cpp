@@ -0,0 +1,91 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "CatalogueSnapshot.h"
+
+namespace ADS::i18n {
+    const TranslationMap *CatalogueSnapshot::catalogue(const string_view language) const
+    {
+        auto it = this->catalogues.find(language);
+
+        return (it != this->catalogues.end()) ? it->second.get() : nullptr;
+    }
+
+    vector<string> CatalogueSnapshot::getLanguages() const
+    {
+        vector<string> languages;
+        languages.reserve(this->catalogues.size());
+        for (const auto &[language, catalogue]: this->catalogues) {
+            languages.push_back(language);
+        }
+
+        return languages;
+    }
+
+    string_view CatalogueSnapshot::lookup(const string_view translationKey, const string_view language) const
+    {
+        const TranslationMap *target = this->currentCatalogue;
+        if (!language.empty() && language != this->locale) {
+            target = this->catalogue(language);
+        }
+
+        // Loaded catalogues already hold the fallback entries they lack
+        if (target == nullptr) {
+            target = this->fallbackCatalogue;
+        }
+
+        return (target != nullptr) ? target->find(translationKey).value_or(translationKey) : translationKey;
+    }
+
+    string_view CatalogueSnapshot::lookupPlural(const string_view translationKey, const int64_t count,
+                                                const string_view language) const
+    {
+        const TranslationMap *target = this->currentCatalogue;
+        PluralRule rule = this->pluralRule;
+        if (!language.empty() && language != this->locale) {
+            target = this->catalogue(language);
+            rule = pluralRuleFor(language);
+        }
+        if (target == nullptr) {
+            target = this->fallbackCatalogue;
+        }
+        if (target == nullptr) {
+            return translationKey;
+        }
+
+        if (auto form = target->findPlural(translationKey, rule(count))) {
+            return *form;
+        }
+
+        return target->find(translationKey).value_or(translationKey);
+    }
+
+    string_view CatalogueSnapshot::formatTo(string &buffer, const string_view translationKey,
+                                            const span<const FormatArg> args, const string_view language) const
+    {
+        const size_t start = buffer.size();
+        MessageTemplate::format(buffer, this->lookup(translationKey, language), args);
+
+        return string_view(buffer).substr(start);
+    }
+
+    void CatalogueSnapshot::bind(const string_view fallbackLanguage)
+    {
+        this->currentCatalogue = this->catalogue(this->locale);
+        this->fallbackCatalogue = this->catalogue(fallbackLanguage);
+        this->pluralRule = pluralRuleFor(this->locale);
+
+        for (size_t key = 0; key < KEY_COUNT; ++key) {
+            this->keyedTranslations[key] = this->lookup(KEY_NAMES[key]);
+        }
+    }
+}
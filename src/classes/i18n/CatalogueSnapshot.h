@@ -0,0 +1,162 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_CATALOGUE_SNAPSHOT_H
+#define ADS_CATALOGUE_SNAPSHOT_H
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MessageTemplate.h"
+#include "PluralRules.h"
+#include "TranslationCoverage.h"
+#include "TranslationKeys.h"
+#include "TranslationMap.h"
+
+namespace ADS::i18n {
+    using namespace std;
+
+    /**
+     * @class CatalogueSnapshot
+     * @brief Immutable copy of the loaded catalogues, safe to read from any thread
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * i18n publishes a new snapshot whenever its catalogues have changed and
+     * update() runs (see i18n::snapshot()). A snapshot is never modified
+     * after publication, so threads that hold one read it without locking
+     * and can never see a half-reloaded table; the views it returns live as
+     * long as the snapshot does. Catalogues that did not change between two
+     * snapshots are shared rather than copied.
+     *
+     * Languages registered in LoadMode::Lazy and not yet parsed are not part
+     * of a snapshot; lookups in them use the fallback language.
+     */
+    class CatalogueSnapshot
+    {
+    public:
+        /**
+         * @brief Get a view of the translation of a key
+         *
+         * @param translationKey The key to translate
+         * @param language Specific language code (empty uses the snapshot's locale)
+         * @return View of the translation, the fallback translation, or translationKey itself
+         */
+        [[nodiscard]] string_view lookup(string_view translationKey, string_view language = {}) const;
+
+        /**
+         * @brief Get a view of the translation of a compile-time key in the snapshot's locale
+         */
+        [[nodiscard]] string_view _t(const Key key) const { return keyedTranslations[static_cast<size_t>(key)]; }
+
+        /**
+         * @brief Get a view of the plural form of a translation for a count
+         *
+         * @see i18n::lookupPlural()
+         */
+        [[nodiscard]] string_view lookupPlural(string_view translationKey, int64_t count,
+                                               string_view language = {}) const;
+
+        /**
+         * @brief Append a translation with its placeholders substituted to a buffer
+         *
+         * Unlike i18n::formatTo() nothing is cached, so any number of threads
+         * can format from the same snapshot.
+         *
+         * @param buffer Buffer the text is appended to
+         * @param translationKey The key to translate
+         * @param args Named values for the placeholders
+         * @param language Specific language code (empty uses the snapshot's locale)
+         * @return View of the appended text
+         */
+        string_view formatTo(string &buffer, string_view translationKey, span<const FormatArg> args,
+                             string_view language = {}) const;
+
+        /**
+         * @brief Append a translation in the snapshot's locale with its placeholders substituted
+         */
+        template<same_as<FormatArg>... Args>
+        string_view formatTo(string &buffer, const string_view translationKey, const Args &...args) const
+        {
+            const array<FormatArg, sizeof...(Args)> erased = {args...};
+            return this->formatTo(buffer, translationKey, span<const FormatArg>(erased));
+        }
+
+        /**
+         * @brief Get the catalogue of a language
+         *
+         * @param language Language code
+         * @return The catalogue, or nullptr if the language is not in the snapshot
+         */
+        [[nodiscard]] const TranslationMap *catalogue(string_view language) const;
+
+        /**
+         * @brief Codes of the languages in the snapshot
+         */
+        [[nodiscard]] vector<string> getLanguages() const;
+
+        /**
+         * @brief Coverage of a language when the snapshot was taken
+         */
+        [[nodiscard]] TranslationCoverage getCoverage(const string_view language) const
+        {
+            return coverage->coverage(language);
+        }
+
+        /**
+         * @brief Locale the snapshot was taken in
+         */
+        [[nodiscard]] const string &getLocale() const { return locale; }
+
+        /**
+         * @brief Number of snapshots published before this one, plus one
+         */
+        [[nodiscard]] uint64_t getGeneration() const { return generation; }
+
+    private:
+        friend class i18n;
+
+        /**
+         * Catalogue of every loaded language, shared with other snapshots when unchanged
+         */
+        unordered_map<string, shared_ptr<const TranslationMap>, TranslationKeyHash, equal_to<>> catalogues;
+
+        /**
+         * Missing keys of every language, shared with other snapshots when unchanged
+         */
+        shared_ptr<const CoverageIndex> coverage;
+
+        string locale;
+        const TranslationMap *currentCatalogue = nullptr;
+        const TranslationMap *fallbackCatalogue = nullptr;
+        array<string_view, KEY_COUNT> keyedTranslations{};
+        PluralRule pluralRule = pluralRuleFor({});
+        uint64_t generation = 0;
+        uint64_t stamp = 0;                    ///< Unique across every i18n instance
+
+        /**
+         * @brief Resolve the current and fallback catalogues and the keyed translations
+         *
+         * @param fallbackLanguage Language used when a key or language is missing
+         */
+        void bind(string_view fallbackLanguage);
+    };
+}
+
+#endif //ADS_CATALOGUE_SNAPSHOT_H
@@ -0,0 +1,276 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "CompiledCatalogue.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "i18n.h"
+#include "../../exceptions/filesystem/file_not_open_exception.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ADS::i18n {
+    /**
+     * Bump when the layout of the file changes
+     */
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    static constexpr char MAGIC[4] = {'A', 'D', 'S', 'L'};
+
+    struct CompiledCatalogue::Header
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t count;
+        uint32_t poolSize;
+    };
+
+    struct CompiledCatalogue::Record
+    {
+        uint64_t hash;
+        uint32_t keyOffset;
+        uint32_t keyLength;
+        uint32_t valueOffset;
+        uint32_t valueLength;
+    };
+
+    uint64_t CompiledCatalogue::hashKey(const string_view key)
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c: key) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ull;
+        }
+
+        return hash;
+    }
+
+    shared_ptr<const CompiledCatalogue> CompiledCatalogue::open(const filesystem::path &path)
+    {
+        shared_ptr<CompiledCatalogue> catalogue(new CompiledCatalogue());
+
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw Exceptions::file_not_open_exception(std::format("Cannot open catalogue: {}", path.string()));
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw translation_file_exception(std::format("Empty or unreadable catalogue: {}", path.string()));
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw Exceptions::file_not_open_exception(std::format("Cannot map catalogue: {}", path.string()));
+        }
+
+        const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mapping);
+            throw Exceptions::file_not_open_exception(std::format("Cannot map catalogue: {}", path.string()));
+        }
+        catalogue->mapping = mapping;
+        catalogue->length = static_cast<size_t>(fileSize.QuadPart);
+#else
+        const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) {
+            throw Exceptions::file_not_open_exception(std::format("Cannot open catalogue: {}", path.string()));
+        }
+
+        struct stat status{};
+        if (fstat(file, &status) != 0 || status.st_size == 0) {
+            ::close(file);
+            throw translation_file_exception(std::format("Empty or unreadable catalogue: {}", path.string()));
+        }
+
+        // A shared read-only mapping lets every process use the same pages
+        void *view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+        ::close(file);
+        if (view == MAP_FAILED) {
+            throw Exceptions::file_not_open_exception(std::format("Cannot map catalogue: {}", path.string()));
+        }
+        catalogue->length = static_cast<size_t>(status.st_size);
+#endif
+        catalogue->data = static_cast<const char *>(view);
+
+        catalogue->validate(path);
+
+        return catalogue;
+    }
+
+    CompiledCatalogue::~CompiledCatalogue()
+    {
+        if (this->data == nullptr) {
+            return;
+        }
+
+#ifdef _WIN32
+        UnmapViewOfFile(this->data);
+        CloseHandle(this->mapping);
+#else
+        munmap(const_cast<char *>(this->data), this->length);
+#endif
+    }
+
+    void CompiledCatalogue::validate(const filesystem::path &path)
+    {
+        static_assert(sizeof(Header) == 16 && sizeof(Record) == 24, "the .adsl layout must not depend on padding");
+
+        auto reject = [&path](const string_view reason) {
+            throw translation_file_exception(std::format("Invalid catalogue {}: {}", path.string(), reason));
+        };
+
+        if (this->length < sizeof(Header)) {
+            reject("truncated header");
+        }
+
+        Header header{};
+        memcpy(&header, this->data, sizeof(Header));
+        if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            reject("not a compiled catalogue");
+        }
+        if (header.version != FORMAT_VERSION) {
+            reject(std::format("format version {} is not supported", header.version));
+        }
+        if (this->length != sizeof(Header) + header.count * sizeof(Record) + header.poolSize) {
+            reject("size does not match its header");
+        }
+
+        this->records = reinterpret_cast<const Record *>(this->data + sizeof(Header));
+        this->count = header.count;
+        this->pool = this->data + sizeof(Header) + header.count * sizeof(Record);
+
+        // Every string must end inside the pool on its NUL terminator
+        auto fits = [&header, this](const uint32_t offset, const uint32_t length) {
+            return static_cast<uint64_t>(offset) + length < header.poolSize && this->pool[offset + length] == '\0';
+        };
+
+        for (size_t index = 0; index < this->count; ++index) {
+            const Record &record = this->records[index];
+            if (!fits(record.keyOffset, record.keyLength) || !fits(record.valueOffset, record.valueLength)) {
+                reject(std::format("entry {} points outside the string pool", index));
+            }
+            if (index > 0 && this->records[index - 1].hash > record.hash) {
+                reject("entries are not sorted");
+            }
+        }
+    }
+
+    string_view CompiledCatalogue::poolString(const uint32_t offset, const uint32_t length) const
+    {
+        return {this->pool + offset, length};
+    }
+
+    optional<string_view> CompiledCatalogue::find(const string_view key) const
+    {
+        const uint64_t hash = hashKey(key);
+        const Record *end = this->records + this->count;
+        const Record *record = std::lower_bound(this->records, end, hash, [](const Record &lhs, const uint64_t rhs) {
+            return lhs.hash < rhs;
+        });
+
+        for (; record != end && record->hash == hash; ++record) {
+            if (this->poolString(record->keyOffset, record->keyLength) == key) {
+                return this->poolString(record->valueOffset, record->valueLength);
+            }
+        }
+
+        return nullopt;
+    }
+
+    pair<string_view, string_view> CompiledCatalogue::entry(const size_t index) const
+    {
+        const Record &record = this->records[index];
+
+        return {
+            this->poolString(record.keyOffset, record.keyLength),
+            this->poolString(record.valueOffset, record.valueLength)
+        };
+    }
+
+    void CompiledCatalogue::write(const TranslationMap &catalogue, const filesystem::path &path)
+    {
+        vector<Record> records;
+        records.reserve(catalogue.size());
+        string pool;
+
+        auto append = [&pool](const string_view text) {
+            const size_t offset = pool.size();
+            pool.append(text);
+            pool.push_back('\0');
+            return offset;
+        };
+
+        for (const auto &[key, translation]: catalogue) {
+            const size_t keyOffset = append(key);
+            const size_t valueOffset = append(translation);
+            if (pool.size() > numeric_limits<uint32_t>::max()) {
+                throw translation_file_exception(std::format("Catalogue too large to compile: {}", path.string()));
+            }
+            records.push_back({
+                hashKey(key),
+                static_cast<uint32_t>(keyOffset), static_cast<uint32_t>(key.size()),
+                static_cast<uint32_t>(valueOffset), static_cast<uint32_t>(translation.size())
+            });
+        }
+
+        // Ties are broken by key so the same catalogue always compiles to the same bytes
+        std::sort(records.begin(), records.end(), [&pool](const Record &lhs, const Record &rhs) {
+            if (lhs.hash != rhs.hash) {
+                return lhs.hash < rhs.hash;
+            }
+            return string_view(pool.data() + lhs.keyOffset, lhs.keyLength)
+                   < string_view(pool.data() + rhs.keyOffset, rhs.keyLength);
+        });
+
+        Header header{};
+        memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = FORMAT_VERSION;
+        header.count = static_cast<uint32_t>(records.size());
+        header.poolSize = static_cast<uint32_t>(pool.size());
+
+        filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            ofstream out(tempPath, ios::binary | ios::trunc);
+            if (!out.is_open()) {
+                throw Exceptions::file_not_open_exception(std::format("Cannot write catalogue: {}", tempPath.string()));
+            }
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char *>(records.data()),
+                      static_cast<streamsize>(records.size() * sizeof(Record)));
+            out.write(pool.data(), static_cast<streamsize>(pool.size()));
+            if (!out.good()) {
+                throw Exceptions::file_not_open_exception(std::format("Failed while writing catalogue: {}", tempPath.string()));
+            }
+        }
+        filesystem::rename(tempPath, path);
+    }
+}
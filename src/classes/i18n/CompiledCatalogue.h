@@ -0,0 +1,152 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_COMPILED_CATALOGUE_H
+#define ADS_COMPILED_CATALOGUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace ADS::i18n {
+    using namespace std;
+
+    class TranslationMap;
+
+    /**
+     * @class CompiledCatalogue
+     * @brief Read-only translation catalogue memory-mapped from a .adsl file
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * A .adsl file is the binary form of one language's JSON catalogue:
+     *
+     *  - a 16-byte header: "ADSL", format version, entry count, pool size;
+     *  - one 24-byte record per entry (64-bit key hash, key and text offsets
+     *    and lengths), sorted by hash;
+     *  - the string pool, every key and text followed by a NUL byte.
+     *
+     * Opening a file maps it read-only and checks that every record points
+     * inside the pool; nothing is copied or parsed, and processes that open
+     * the same file share its pages. Lookups binary-search the hashes, so
+     * the hash is a fixed FNV-1a rather than std::hash, and views returned
+     * by find() are NUL-terminated so they can be passed on as C strings.
+     *
+     * The file is written in the byte order of the machine that compiled
+     * it; a file from the other byte order is rejected as a version mismatch.
+     *
+     * @note The JSON files remain the source of truth; see i18n::compileLanguage()
+     */
+    class CompiledCatalogue
+    {
+    public:
+        /**
+         * File extension of compiled catalogues
+         */
+        static constexpr string_view EXTENSION = ".adsl";
+
+        /**
+         * @brief Map a compiled catalogue into memory
+         *
+         * @param path .adsl file to open
+         * @return The mapped catalogue; it stays mapped while any owner keeps it
+         *
+         * @throws Exceptions::file_not_open_exception if the file cannot be mapped
+         * @throws translation_file_exception if the file is not a valid catalogue
+         */
+        [[nodiscard]] static shared_ptr<const CompiledCatalogue> open(const filesystem::path &path);
+
+        /**
+         * @brief Write the own entries of a catalogue as a .adsl file
+         *
+         * The file is written next to its destination and renamed over it, so
+         * a reader never maps a half-written catalogue.
+         *
+         * @param catalogue Catalogue to compile; inherited entries are left out
+         * @param path Destination file
+         *
+         * @throws Exceptions::file_not_open_exception if the file cannot be written
+         * @throws translation_file_exception if the catalogue exceeds the format limits
+         */
+        static void write(const TranslationMap &catalogue, const filesystem::path &path);
+
+        ~CompiledCatalogue();
+
+        CompiledCatalogue(const CompiledCatalogue &) = delete;
+        CompiledCatalogue &operator=(const CompiledCatalogue &) = delete;
+
+        /**
+         * @brief Find the translation of a key
+         *
+         * @param key Translation key
+         * @return View into the mapped file, or nullopt if the key is not present
+         */
+        [[nodiscard]] optional<string_view> find(string_view key) const;
+
+        /**
+         * @brief Check whether the catalogue translates a key
+         */
+        [[nodiscard]] bool contains(string_view key) const { return find(key).has_value(); }
+
+        /**
+         * @brief Get the key and translation stored at a position, in hash order
+         *
+         * @param index Position, lower than size()
+         */
+        [[nodiscard]] pair<string_view, string_view> entry(size_t index) const;
+
+        [[nodiscard]] size_t size() const { return count; }
+
+    private:
+        struct Header;
+        struct Record;
+
+        const char *data = nullptr;
+        size_t length = 0;
+
+#ifdef _WIN32
+        /**
+         * File mapping object backing data
+         */
+        void *mapping = nullptr;
+#endif
+
+        const Record *records = nullptr;
+        size_t count = 0;
+        const char *pool = nullptr;
+
+        CompiledCatalogue() = default;
+
+        /**
+         * @brief Stable 64-bit FNV-1a hash of a key, the same on every platform
+         */
+        [[nodiscard]] static uint64_t hashKey(string_view key);
+
+        /**
+         * @brief Check the header and every record of the mapped bytes
+         *
+         * @throws translation_file_exception naming path on the first problem found
+         */
+        void validate(const filesystem::path &path);
+
+        /**
+         * @brief View of a NUL-terminated string stored in the pool
+         */
+        [[nodiscard]] string_view poolString(uint32_t offset, uint32_t length) const;
+    };
+}
+
+#endif //ADS_COMPILED_CATALOGUE_H
@@ -0,0 +1,121 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "MessageTemplate.h"
+
+namespace ADS::i18n {
+    namespace {
+        /**
+         * @brief Walk a text, reporting its literal runs and {placeholder} names in order
+         *
+         * Reports nothing when the text has no placeholder.
+         */
+        template<typename Literal, typename Placeholder>
+        void scan(const string_view text, Literal onLiteral, Placeholder onPlaceholder)
+        {
+            size_t literalStart = 0;
+            size_t position = 0;
+            bool found = false;
+
+            while (true) {
+                const size_t open = text.find('{', position);
+                if (open == string_view::npos) {
+                    break;
+                }
+                const size_t close = text.find_first_of("{}", open + 1);
+                if (close == string_view::npos) {
+                    break;
+                }
+
+                // "{{name}" starts over at the inner brace; "{}" is literal
+                if (text[close] == '{' || close == open + 1) {
+                    position = (text[close] == '{') ? close : close + 1;
+                    continue;
+                }
+
+                if (open > literalStart) {
+                    onLiteral(literalStart, open - literalStart);
+                }
+                onPlaceholder(open + 1, close - open - 1);
+                literalStart = position = close + 1;
+                found = true;
+            }
+
+            if (found && literalStart < text.size()) {
+                onLiteral(literalStart, text.size() - literalStart);
+            }
+        }
+
+        /**
+         * @brief Append the value named by a placeholder, or the placeholder itself
+         */
+        void substitute(string &out, const string_view text, const size_t offset, const size_t length,
+                        const span<const FormatArg> args)
+        {
+            const string_view name = text.substr(offset, length);
+            for (const FormatArg &candidate: args) {
+                if (candidate.name == name) {
+                    candidate.append(out, candidate.value);
+                    return;
+                }
+            }
+
+            out.append(text.substr(offset - 1, length + 2));
+        }
+    }
+
+    MessageTemplate::MessageTemplate(const string_view text)
+    {
+        // Without placeholders nothing is reported and the whole text is appended as it is
+        scan(text, [this](const size_t offset, const size_t length) {
+                 this->segments.push_back({static_cast<uint32_t>(offset), static_cast<uint32_t>(length), false});
+             },
+             [this](const size_t offset, const size_t length) {
+                 this->segments.push_back({static_cast<uint32_t>(offset), static_cast<uint32_t>(length), true});
+             });
+        this->segments.shrink_to_fit();
+    }
+
+    void MessageTemplate::formatTo(string &out, const string_view text, const span<const FormatArg> args) const
+    {
+        if (this->segments.empty()) {
+            out.append(text);
+            return;
+        }
+
+        for (const Segment &segment: this->segments) {
+            if (segment.placeholder) {
+                substitute(out, text, segment.offset, segment.length, args);
+            } else {
+                out.append(text.substr(segment.offset, segment.length));
+            }
+        }
+    }
+
+    void MessageTemplate::format(string &out, const string_view text, const span<const FormatArg> args)
+    {
+        bool substituted = false;
+
+        scan(text, [&](const size_t offset, const size_t length) {
+                 out.append(text.substr(offset, length));
+             },
+             [&](const size_t offset, const size_t length) {
+                 substitute(out, text, offset, length, args);
+                 substituted = true;
+             });
+
+        // Nothing was reported, as in a template without placeholders
+        if (!substituted) {
+            out.append(text);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_MESSAGE_TEMPLATE_H
+#define ADS_MESSAGE_TEMPLATE_H
+
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ADS::i18n {
+    using namespace std;
+
+    /**
+     * @struct FormatArg
+     * @brief Named value for a {placeholder}, type-erased so it can be passed in an array
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Built with arg(). It only points to the value, so it must be used
+     * within the expression that creates it, as fmt::arg() is.
+     */
+    struct FormatArg
+    {
+        string_view name;
+        const void *value;
+        void (*append)(string &out, const void *value);
+    };
+
+    /**
+     * @brief Name a value for a {placeholder} of a translation
+     *
+     * Strings are appended as they are; any other type is formatted with
+     * std::format's "{}".
+     *
+     * @param name Placeholder name, without braces
+     * @param value Value to substitute; must outlive the formatting call
+     */
+    template<typename T>
+    [[nodiscard]] FormatArg arg(const string_view name, const T &value)
+    {
+        return {
+            name, &value, [](string &out, const void *erased) {
+                const T &typed = *static_cast<const T *>(erased);
+                if constexpr (is_convertible_v<const T &, string_view>) {
+                    out.append(string_view(typed));
+                } else {
+                    std::format_to(back_inserter(out), "{}", typed);
+                }
+            }
+        };
+    }
+
+    /**
+     * @class MessageTemplate
+     * @brief Translation text split into literal and {placeholder} segments
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Tokenising happens once; formatting then walks the segments and
+     * appends to the caller's buffer in a single pass. Segments are offsets
+     * into the text that was tokenised, which is passed again on format, so
+     * a template stays valid wherever its text is moved.
+     *
+     * A "{" without a matching "}" and an empty "{}" are literal text. A
+     * placeholder without a matching argument is written back unchanged.
+     */
+    class MessageTemplate
+    {
+    public:
+        /**
+         * @brief Tokenise a translation text
+         *
+         * @param text Translation text
+         */
+        explicit MessageTemplate(string_view text);
+
+        /**
+         * @brief Append the text with its placeholders substituted
+         *
+         * @param out Buffer to append to
+         * @param text The same text the template was built from
+         * @param args Named values for the placeholders
+         */
+        void formatTo(string &out, string_view text, span<const FormatArg> args) const;
+
+        /**
+         * @brief Substitute the placeholders of a text without keeping a template
+         *
+         * Same result as MessageTemplate(text).formatTo(out, text, args) but
+         * without allocating the segments, for callers that cannot cache the
+         * template, such as readers of a shared catalogue.
+         *
+         * @param out Buffer to append to
+         * @param text Translation text
+         * @param args Named values for the placeholders
+         */
+        static void format(string &out, string_view text, span<const FormatArg> args);
+
+        /**
+         * @brief Check whether the text has any placeholder
+         */
+        [[nodiscard]] bool hasPlaceholders() const { return !segments.empty(); }
+
+    private:
+        /**
+         * @brief Literal text, or the name of a placeholder without its braces
+         */
+        struct Segment
+        {
+            uint32_t offset;
+            uint32_t length;
+            bool placeholder;
+        };
+
+        /**
+         * Segments in text order; empty when the text is a single literal
+         */
+        vector<Segment> segments;
+    };
+}
+
+#endif //ADS_MESSAGE_TEMPLATE_H
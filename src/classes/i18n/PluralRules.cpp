@@ -0,0 +1,130 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "PluralRules.h"
+
+namespace ADS::i18n {
+    namespace {
+        // CLDR rules apply to the absolute value of the count
+        constexpr uint64_t magnitude(const int64_t count)
+        {
+            return (count < 0) ? 0 - static_cast<uint64_t>(count) : static_cast<uint64_t>(count);
+        }
+
+        // Romance languages: "many" for exact non-zero millions ("1 million de fichiers")
+        constexpr bool isMillions(const uint64_t n)
+        {
+            return n != 0 && n % 1000000 == 0;
+        }
+
+        // en, de, nl, sv and unknown languages
+        PluralCategory oneOther(const int64_t count)
+        {
+            return (magnitude(count) == 1) ? PluralCategory::One : PluralCategory::Other;
+        }
+
+        // es, it, pt_PT
+        PluralCategory oneManyOther(const int64_t count)
+        {
+            const uint64_t n = magnitude(count);
+            if (n == 1) {
+                return PluralCategory::One;
+            }
+
+            return isMillions(n) ? PluralCategory::Many : PluralCategory::Other;
+        }
+
+        // fr, pt_BR: 0 is singular too
+        PluralCategory zeroOneManyOther(const int64_t count)
+        {
+            const uint64_t n = magnitude(count);
+            if (n <= 1) {
+                return PluralCategory::One;
+            }
+
+            return isMillions(n) ? PluralCategory::Many : PluralCategory::Other;
+        }
+
+        PluralCategory russian(const int64_t count)
+        {
+            const uint64_t n = magnitude(count);
+            const uint64_t mod10 = n % 10;
+            const uint64_t mod100 = n % 100;
+
+            if (mod10 == 1 && mod100 != 11) {
+                return PluralCategory::One;
+            }
+            if (mod10 >= 2 && mod10 <= 4 && (mod100 < 12 || mod100 > 14)) {
+                return PluralCategory::Few;
+            }
+
+            return PluralCategory::Many;
+        }
+
+        PluralCategory polish(const int64_t count)
+        {
+            const uint64_t n = magnitude(count);
+            const uint64_t mod10 = n % 10;
+            const uint64_t mod100 = n % 100;
+
+            if (n == 1) {
+                return PluralCategory::One;
+            }
+            if (mod10 >= 2 && mod10 <= 4 && (mod100 < 12 || mod100 > 14)) {
+                return PluralCategory::Few;
+            }
+
+            return PluralCategory::Many;
+        }
+
+        PluralCategory romanian(const int64_t count)
+        {
+            const uint64_t n = magnitude(count);
+            const uint64_t mod100 = n % 100;
+
+            if (n == 1) {
+                return PluralCategory::One;
+            }
+            if (n == 0 || (mod100 >= 1 && mod100 <= 19)) {
+                return PluralCategory::Few;
+            }
+
+            return PluralCategory::Other;
+        }
+    }
+
+    PluralRule pluralRuleFor(const string_view language)
+    {
+        const string_view code = language.substr(0, language.find_first_of("_-"));
+
+        if (code == "ru") {
+            return &russian;
+        }
+        if (code == "pl") {
+            return &polish;
+        }
+        if (code == "ro") {
+            return &romanian;
+        }
+        if (code == "fr") {
+            return &zeroOneManyOther;
+        }
+        if (code == "pt") {
+            return (language.substr(code.size()).ends_with("PT")) ? &oneManyOther : &zeroOneManyOther;
+        }
+        if (code == "es" || code == "it") {
+            return &oneManyOther;
+        }
+
+        return &oneOther;
+    }
+}
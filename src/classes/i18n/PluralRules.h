@@ -0,0 +1,73 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_PLURAL_RULES_H
+#define ADS_PLURAL_RULES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ADS::i18n {
+    using namespace std;
+
+    /**
+     * @brief CLDR plural categories, in CLDR order
+     */
+    enum class PluralCategory : uint8_t
+    {
+        Zero,
+        One,
+        Two,
+        Few,
+        Many,
+        Other
+    };
+
+    /**
+     * Name of each category, as used for the plural forms in translation files
+     */
+    constexpr array<string_view, 6> PLURAL_CATEGORY_NAMES = {"zero", "one", "two", "few", "many", "other"};
+
+    /**
+     * @brief Get the name of a plural category
+     */
+    constexpr string_view pluralCategoryName(const PluralCategory category)
+    {
+        return PLURAL_CATEGORY_NAMES[static_cast<size_t>(category)];
+    }
+
+    /**
+     * @brief Cardinal plural rule of a language, for whole counts
+     */
+    using PluralRule = PluralCategory (*)(int64_t count);
+
+    /**
+     * @brief Get the cardinal plural rule of a language
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The rules are the CLDR cardinal rules of every language in
+     * Constants::Languages, written out as plain integer branches (counts
+     * are whole numbers, so CLDR's operands v, f and t are always 0). Only
+     * the language part of the code matters: "pt_BR" and "pt_PT" differ, the
+     * other regions share their language's rule. Unknown languages use
+     * "one" for 1 and "other" for everything else.
+     *
+     * @param language Language code such as "ru_RU"
+     * @return Rule function; resolve it once and call it per count
+     */
+    [[nodiscard]] PluralRule pluralRuleFor(string_view language);
+}
+
+#endif //ADS_PLURAL_RULES_H
@@ -0,0 +1,228 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "TranslationCoverage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
+
+namespace ADS::i18n {
+    namespace {
+        constexpr size_t wordsFor(const size_t bits)
+        {
+            return (bits + 63) / 64;
+        }
+    }
+
+    bool CoverageIndex::syncReference(const Catalogues &catalogues, const string_view fallbackLanguage)
+    {
+        auto fallbackIt = catalogues.find(fallbackLanguage);
+        const uint64_t revision = (fallbackIt != catalogues.end()) ? fallbackIt->second.keysRevision() : 0;
+        if (this->reference == fallbackLanguage && this->referenceRevision == revision) {
+            return false;
+        }
+
+        this->reference = fallbackLanguage;
+        this->referenceRevision = revision;
+        this->keys.clear();
+        this->keyIndex.clear();
+        this->languages.clear();
+        this->changes++;
+
+        if (fallbackIt == catalogues.end()) {
+            return true;
+        }
+
+        // Sorted keys let missing() return the set bits in order without sorting
+        this->keys.reserve(fallbackIt->second.size());
+        for (const auto &[key, translation]: fallbackIt->second) {
+            this->keys.push_back(key);
+        }
+        sort(this->keys.begin(), this->keys.end());
+
+        this->keyIndex.reserve(this->keys.size());
+        for (size_t index = 0; index < this->keys.size(); ++index) {
+            this->keyIndex.emplace(this->keys[index], static_cast<uint32_t>(index));
+        }
+
+        return true;
+    }
+
+    void CoverageIndex::build(Language &entry, const TranslationMap &catalogue) const
+    {
+        entry.missing.assign(wordsFor(this->keys.size()), 0);
+        entry.missingCount = 0;
+
+        for (size_t index = 0; index < this->keys.size(); ++index) {
+            if (!catalogue.hasOwn(this->keys[index])) {
+                entry.missing[index / 64] |= uint64_t{1} << (index % 64);
+                entry.missingCount++;
+            }
+        }
+        entry.revision = catalogue.keysRevision();
+    }
+
+    void CoverageIndex::refresh(const Catalogues &catalogues, const string_view fallbackLanguage)
+    {
+        this->syncReference(catalogues, fallbackLanguage);
+
+        erase_if(this->languages, [&catalogues](const auto &entry) {
+            return !catalogues.contains(entry.first);
+        });
+
+        vector<pair<Language *, const TranslationMap *> > stale;
+        for (const auto &[language, catalogue]: catalogues) {
+            Language &entry = this->languages[language];
+            if (entry.revision != catalogue.keysRevision() || entry.missing.size() != wordsFor(this->keys.size())) {
+                stale.emplace_back(&entry, &catalogue);
+            }
+        }
+        if (stale.empty()) {
+            return;
+        }
+        this->changes++;
+
+        // Languages share nothing but the keys, which are only read
+        atomic<size_t> next{0};
+        auto worker = [&]() {
+            for (size_t index = next.fetch_add(1, memory_order_relaxed);
+                 index < stale.size();
+                 index = next.fetch_add(1, memory_order_relaxed)) {
+                this->build(*stale[index].first, *stale[index].second);
+            }
+        };
+
+        const size_t workerCount = clamp<size_t>(thread::hardware_concurrency(), 1, stale.size());
+        vector<thread> workers;
+        workers.reserve(workerCount - 1);
+        for (size_t i = 1; i < workerCount; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker(); // The calling thread takes its share too
+        for (thread &running: workers) {
+            running.join();
+        }
+    }
+
+    void CoverageIndex::refresh(const Catalogues &catalogues, const string_view fallbackLanguage,
+                                const string_view language)
+    {
+        this->syncReference(catalogues, fallbackLanguage);
+
+        auto catalogueIt = catalogues.find(language);
+        if (catalogueIt == catalogues.end()) {
+            if (auto entry = this->languages.find(language); entry != this->languages.end()) {
+                this->languages.erase(entry);
+                this->changes++;
+            }
+            return;
+        }
+
+        auto [entry, added] = this->languages.try_emplace(string(language));
+        if (added || entry->second.revision != catalogueIt->second.keysRevision()) {
+            this->build(entry->second, catalogueIt->second);
+            this->changes++;
+        }
+    }
+
+    void CoverageIndex::keyTranslated(const string_view language, const string_view key,
+                                      const uint64_t previousRevision, const TranslationMap &catalogue)
+    {
+        auto entry = this->languages.find(language);
+        if (entry == this->languages.end() || entry->second.revision != previousRevision ||
+            catalogue.keysRevision() == previousRevision) {
+            // Stale already, or the key was its own before
+            return;
+        }
+
+        entry->second.revision = catalogue.keysRevision();
+        this->changes++;
+
+        auto index = this->keyIndex.find(key);
+        if (index == this->keyIndex.end()) {
+            return;
+        }
+
+        uint64_t &word = entry->second.missing[index->second / 64];
+        const uint64_t bit = uint64_t{1} << (index->second % 64);
+        if (word & bit) {
+            word &= ~bit;
+            entry->second.missingCount--;
+        }
+    }
+
+    void CoverageIndex::referenceKeyAdded(const string_view key, const uint64_t previousRevision,
+                                          const Catalogues &catalogues)
+    {
+        auto fallbackIt = catalogues.find(this->reference);
+        if (fallbackIt == catalogues.end() || this->referenceRevision != previousRevision ||
+            fallbackIt->second.keysRevision() == previousRevision) {
+            return;
+        }
+
+        this->referenceRevision = fallbackIt->second.keysRevision();
+        this->changes++;
+
+        const size_t index = this->keys.size();
+        this->keys.emplace_back(key);
+        this->keyIndex.emplace(this->keys.back(), static_cast<uint32_t>(index));
+
+        for (auto &[language, entry]: this->languages) {
+            if (language == this->reference && entry.revision == previousRevision) {
+                entry.revision = this->referenceRevision;
+            }
+
+            entry.missing.resize(wordsFor(this->keys.size()), 0);
+            auto catalogueIt = catalogues.find(language);
+            if (catalogueIt != catalogues.end() && !catalogueIt->second.hasOwn(key)) {
+                entry.missing[index / 64] |= uint64_t{1} << (index % 64);
+                entry.missingCount++;
+            }
+        }
+    }
+
+    TranslationCoverage CoverageIndex::coverage(const string_view language) const
+    {
+        auto entry = this->languages.find(language);
+        if (entry == this->languages.end()) {
+            return {};
+        }
+
+        return {this->keys.size() - entry->second.missingCount, this->keys.size()};
+    }
+
+    vector<string> CoverageIndex::missing(const string_view language) const
+    {
+        vector<string> result;
+
+        auto entry = this->languages.find(language);
+        if (entry == this->languages.end()) {
+            return result;
+        }
+
+        result.reserve(entry->second.missingCount);
+        for (size_t word = 0; word < entry->second.missing.size(); ++word) {
+            for (uint64_t bits = entry->second.missing[word]; bits != 0; bits &= bits - 1) {
+                result.push_back(this->keys[word * 64 + countr_zero(bits)]);
+            }
+        }
+
+        // Keys added one by one since the last numbering are out of order
+        if (!is_sorted(result.begin(), result.end())) {
+            sort(result.begin(), result.end());
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_TRANSLATION_COVERAGE_H
+#define ADS_TRANSLATION_COVERAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "TranslationMap.h"
+
+namespace ADS::i18n {
+    using namespace std;
+
+    /**
+     * @struct TranslationCoverage
+     * @brief How many keys of the fallback language a language translates itself
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     */
+    struct TranslationCoverage
+    {
+        size_t translated = 0;     ///< Keys of the fallback language the language has its own entry for
+        size_t total = 0;          ///< Keys of the fallback language
+
+        [[nodiscard]] size_t missing() const { return total - translated; }
+
+        /**
+         * @brief Translated fraction, 1 when there is nothing to translate
+         */
+        [[nodiscard]] double ratio() const
+        {
+            return (total == 0) ? 1.0 : static_cast<double>(translated) / static_cast<double>(total);
+        }
+    };
+
+    /**
+     * @class CoverageIndex
+     * @brief Missing-key bitsets of every language against the fallback language
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The keys of the fallback language are numbered once; each language
+     * keeps one bit per key, set while it lacks its own entry, and the count
+     * of set bits. Coverage is then read without touching the catalogues and
+     * the missing keys are found by scanning the set bits.
+     *
+     * Entries remember the TranslationMap::keysRevision() they were built
+     * from, so a catalogue replaced or edited behind the index's back is
+     * simply rebuilt on the next refresh(). addTranslation() keeps them
+     * current one key at a time through keyTranslated() and referenceKeyAdded().
+     */
+    class CoverageIndex
+    {
+    public:
+        using Catalogues = unordered_map<string, TranslationMap, TranslationKeyHash, equal_to<> >;
+
+        /**
+         * @brief Rebuild every stale language, in parallel, and forget unloaded ones
+         *
+         * @param catalogues Loaded catalogues by language
+         * @param fallbackLanguage Language whose keys are the reference
+         */
+        void refresh(const Catalogues &catalogues, string_view fallbackLanguage);
+
+        /**
+         * @brief Rebuild one language if it is stale
+         *
+         * @param catalogues Loaded catalogues by language
+         * @param fallbackLanguage Language whose keys are the reference
+         * @param language Language to bring up to date
+         */
+        void refresh(const Catalogues &catalogues, string_view fallbackLanguage, string_view language);
+
+        /**
+         * @brief Record that a language may have gained its own entry for a key
+         *
+         * @param language Language written to
+         * @param key Key written
+         * @param previousRevision keysRevision() of the catalogue before the write
+         * @param catalogue The catalogue after the write
+         */
+        void keyTranslated(string_view language, string_view key, uint64_t previousRevision,
+                           const TranslationMap &catalogue);
+
+        /**
+         * @brief Record that the fallback language may have gained a key
+         *
+         * @param key Key written
+         * @param previousRevision keysRevision() of the fallback catalogue before the write
+         * @param catalogues Loaded catalogues by language, the fallback one already written
+         */
+        void referenceKeyAdded(string_view key, uint64_t previousRevision, const Catalogues &catalogues);
+
+        /**
+         * @brief Coverage of a language as of the last refresh
+         *
+         * @return The coverage; empty if the language is not indexed
+         */
+        [[nodiscard]] TranslationCoverage coverage(string_view language) const;
+
+        /**
+         * @brief Keys of the fallback language a language lacks, as of the last refresh
+         *
+         * @return The keys, sorted; empty if the language is not indexed
+         */
+        [[nodiscard]] vector<string> missing(string_view language) const;
+
+        /**
+         * @brief Counter bumped by every change to the index
+         */
+        [[nodiscard]] uint64_t getChanges() const { return changes; }
+
+    private:
+        /**
+         * @brief Missing keys of one language
+         */
+        struct Language
+        {
+            vector<uint64_t> missing;          ///< Bit i set when keys[i] has no own entry
+            size_t missingCount = 0;
+            uint64_t revision = 0;             ///< keysRevision() the bits were built from
+        };
+
+        string reference;                      ///< Fallback language the keys come from
+        uint64_t referenceRevision = 0;        ///< Its keysRevision() when the keys were numbered
+        vector<string> keys;
+        unordered_map<string, uint32_t, TranslationKeyHash, equal_to<> > keyIndex;
+        unordered_map<string, Language, TranslationKeyHash, equal_to<> > languages;
+        uint64_t changes = 0;
+
+        /**
+         * @brief Number the keys of the fallback catalogue again, dropping every language
+         *
+         * @return false when the keys were already current
+         */
+        bool syncReference(const Catalogues &catalogues, string_view fallbackLanguage);
+
+        /**
+         * @brief Fill the bits of a language from its catalogue
+         */
+        void build(Language &entry, const TranslationMap &catalogue) const;
+    };
+}
+
+#endif //ADS_TRANSLATION_COVERAGE_H
@@ -0,0 +1,323 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "TranslationMap.h"
+#include "CompiledCatalogue.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <functional>
+
+namespace ADS::i18n {
+    TranslationMap::TranslationMap(const initializer_list<value_type> entries)
+    {
+        this->reserve(entries.size());
+        for (const value_type &entry: entries) {
+            (*this)[entry.first] = entry.second;
+        }
+    }
+
+    TranslationMap::TranslationMap(shared_ptr<const CompiledCatalogue> compiled) :
+        compiled(std::move(compiled))
+    {
+    }
+
+    uint64_t TranslationMap::nextStamp()
+    {
+        // Catalogues are built on loader and reload threads too
+        static atomic<uint64_t> counter{0};
+
+        return counter.fetch_add(1, memory_order_relaxed) + 1;
+    }
+
+    size_t TranslationMap::hashKey(const string_view key)
+    {
+        return hash<string_view>{}(key);
+    }
+
+    const TranslationMap::value_type &TranslationMap::entryOf(const Slot &slot) const
+    {
+        return (slot.entry & INHERITED_BIT)
+                   ? this->inherited[slot.entry & ~INHERITED_BIT]
+                   : this->entries[slot.entry];
+    }
+
+    size_t TranslationMap::probe(const string_view key, const size_t hash) const
+    {
+        const size_t mask = this->slots.size() - 1;
+        size_t index = hash & mask;
+
+        // The table is never more than half full, so an empty slot always ends the probe
+        while (this->slots[index].entry != EMPTY_SLOT) {
+            const Slot &slot = this->slots[index];
+            if (slot.hash == hash && this->entryOf(slot).first == key) {
+                break;
+            }
+            index = (index + 1) & mask;
+        }
+
+        return index;
+    }
+
+    optional<string_view> TranslationMap::find(const string_view key) const
+    {
+        if (this->compiled != nullptr) {
+            if (auto translation = this->compiled->find(key)) {
+                return translation;
+            }
+        }
+
+        if (this->slots.empty()) {
+            return nullopt;
+        }
+
+        const Slot &slot = this->slots[this->probe(key, hashKey(key))];
+        if (slot.entry == EMPTY_SLOT) {
+            return nullopt;
+        }
+
+        return this->entryOf(slot).second;
+    }
+
+    optional<string_view> TranslationMap::findPlural(const string_view key, const PluralCategory category) const
+    {
+        // Keys are short, so the form's key is built on the stack
+        array<char, 128> buffer;
+        string spilled;
+        const auto formKey = [&](const string_view name) -> string_view {
+            const size_t length = key.size() + 1 + name.size();
+            if (length > buffer.size()) {
+                spilled.assign(key).append(1, '.').append(name);
+                return spilled;
+            }
+            char *end = copy(key.begin(), key.end(), buffer.data());
+            *end++ = '.';
+            copy(name.begin(), name.end(), end);
+            return {buffer.data(), length};
+        };
+
+        if (auto translation = this->find(formKey(pluralCategoryName(category)))) {
+            return translation;
+        }
+
+        return (category != PluralCategory::Other) ? this->find(formKey(pluralCategoryName(PluralCategory::Other)))
+                                                   : nullopt;
+    }
+
+    bool TranslationMap::formatTo(string &out, const string_view key, const span<const FormatArg> args) const
+    {
+        const optional<string_view> translation = this->find(key);
+        if (!translation) {
+            return false;
+        }
+
+        auto cached = this->templates.find(key);
+        if (cached == this->templates.end()) {
+            cached = this->templates.emplace(string(key), MessageTemplate(*translation)).first;
+        }
+        cached->second.formatTo(out, *translation, args);
+
+        return true;
+    }
+
+    void TranslationMap::forgetTemplate(const string_view key)
+    {
+        if (auto cached = this->templates.find(key); cached != this->templates.end()) {
+            this->templates.erase(cached);
+        }
+    }
+
+    bool TranslationMap::contains(const string_view key) const
+    {
+        return this->find(key).has_value();
+    }
+
+    bool TranslationMap::hasOwn(const string_view key) const
+    {
+        if (this->compiled != nullptr) {
+            return this->compiled->contains(key);
+        }
+
+        if (this->slots.empty()) {
+            return false;
+        }
+
+        const Slot &slot = this->slots[this->probe(key, hashKey(key))];
+
+        return slot.entry != EMPTY_SLOT && !(slot.entry & INHERITED_BIT);
+    }
+
+    void TranslationMap::reserveOne()
+    {
+        if ((this->entries.size() + this->inherited.size() + 1) * 2 > this->slots.size()) {
+            this->rehash(std::max<size_t>(16, this->slots.size() * 2));
+        }
+    }
+
+    string &TranslationMap::operator[](const string_view key)
+    {
+        this->detach();
+        this->forgetTemplate(key);
+        this->reserveOne();
+        this->stamp = nextStamp();
+
+        const size_t hash = hashKey(key);
+        Slot &slot = this->slots[this->probe(key, hash)];
+        if (slot.entry == EMPTY_SLOT) {
+            slot.hash = hash;
+            slot.entry = static_cast<uint32_t>(this->entries.size());
+            this->entries.emplace_back(string(key), string());
+            this->keysStamp = this->stamp;
+        } else if (slot.entry & INHERITED_BIT) {
+            this->keysStamp = this->stamp;
+
+            // Promote to an own entry; the last inherited pair fills the hole
+            const uint32_t hole = slot.entry & ~INHERITED_BIT;
+            slot.entry = static_cast<uint32_t>(this->entries.size());
+            this->entries.push_back(std::move(this->inherited[hole]));
+
+            if (hole + 1 != this->inherited.size()) {
+                // Re-point the last pair's slot while its key can still be probed
+                const string &movedKey = this->inherited.back().first;
+                this->slots[this->probe(movedKey, hashKey(movedKey))].entry = hole | INHERITED_BIT;
+                this->inherited[hole] = std::move(this->inherited.back());
+            }
+            this->inherited.pop_back();
+        }
+
+        return this->entries[slot.entry].second;
+    }
+
+    void TranslationMap::inherit(const string_view key, const string &translation)
+    {
+        if (this->compiled != nullptr && this->compiled->contains(key)) {
+            return;
+        }
+
+        this->reserveOne();
+
+        const size_t hash = hashKey(key);
+        Slot &slot = this->slots[this->probe(key, hash)];
+        if (slot.entry == EMPTY_SLOT) {
+            slot.hash = hash;
+            slot.entry = static_cast<uint32_t>(this->inherited.size()) | INHERITED_BIT;
+            this->inherited.emplace_back(string(key), translation);
+            this->stamp = nextStamp();
+        } else if (slot.entry & INHERITED_BIT) {
+            this->forgetTemplate(key);
+            this->inherited[slot.entry & ~INHERITED_BIT].second = translation;
+            this->stamp = nextStamp();
+        }
+    }
+
+    void TranslationMap::mergeFallback(const TranslationMap &fallback)
+    {
+        this->templates.clear();
+        this->inherited.clear();
+        this->stamp = nextStamp();
+        this->inherited.reserve(fallback.size());
+
+        // Drop the old inherited slots and size the index for the worst case up front
+        const size_t capacity = std::bit_ceil(std::max<size_t>(16, (this->size() + fallback.size()) * 2));
+        this->rehash(std::max(capacity, this->slots.size()), false);
+
+        for (const auto &[key, translation]: fallback) {
+            this->inherit(key, translation);
+        }
+    }
+
+    size_t TranslationMap::size() const
+    {
+        return (this->compiled != nullptr) ? this->compiled->size() : this->entries.size();
+    }
+
+    const vector<TranslationMap::value_type> &TranslationMap::ownEntries() const
+    {
+        if (this->compiled == nullptr) {
+            return this->entries;
+        }
+
+        if (this->compiledEntries.size() != this->compiled->size()) {
+            this->compiledEntries.clear();
+            this->compiledEntries.reserve(this->compiled->size());
+            for (size_t index = 0; index < this->compiled->size(); ++index) {
+                const auto [key, translation] = this->compiled->entry(index);
+                this->compiledEntries.emplace_back(string(key), string(translation));
+            }
+        }
+
+        return this->compiledEntries;
+    }
+
+    void TranslationMap::detach()
+    {
+        if (this->compiled == nullptr) {
+            return;
+        }
+
+        const shared_ptr<const CompiledCatalogue> source = std::move(this->compiled);
+        this->compiledEntries.clear();
+        this->compiledEntries.shrink_to_fit();
+
+        this->reserve(source->size() + this->inherited.size());
+        for (size_t index = 0; index < source->size(); ++index) {
+            const auto [key, translation] = source->entry(index);
+            (*this)[key] = translation;
+        }
+    }
+
+    void TranslationMap::reserve(const size_t count)
+    {
+        this->entries.reserve(count);
+
+        const size_t capacity = std::bit_ceil(std::max<size_t>(16, count * 2));
+        if (capacity > this->slots.size()) {
+            this->rehash(capacity);
+        }
+    }
+
+    void TranslationMap::rehash(const size_t capacity, const bool keepInherited)
+    {
+        vector<Slot> previous(capacity);
+        previous.swap(this->slots);
+
+        const size_t mask = capacity - 1;
+        for (const Slot &slot: previous) {
+            if (slot.entry == EMPTY_SLOT || (!keepInherited && (slot.entry & INHERITED_BIT))) {
+                continue;
+            }
+            size_t index = slot.hash & mask;
+            while (this->slots[index].entry != EMPTY_SLOT) {
+                index = (index + 1) & mask;
+            }
+            this->slots[index] = slot;
+        }
+    }
+
+    bool operator==(const TranslationMap &lhs, const TranslationMap &rhs)
+    {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        for (const auto &[key, translation]: lhs) {
+            const optional<string_view> other = rhs.find(key);
+            if (!other || !rhs.hasOwn(key) || *other != translation) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,345 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_TRANSLATION_MAP_H
+#define ADS_TRANSLATION_MAP_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "MessageTemplate.h"
+#include "PluralRules.h"
+
+namespace ADS::i18n {
+    using namespace std;
+
+    class CompiledCatalogue;
+
+    /**
+     * @struct TranslationKeyHash
+     * @brief Transparent hash so string-keyed maps can be probed with string_view keys
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Paired with std::equal_to<> it enables heterogeneous lookup, so a
+     * language code or translation key given as a literal or string_view is
+     * looked up without first being copied into a temporary std::string.
+     */
+    struct TranslationKeyHash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] size_t operator()(const string_view key) const noexcept
+        {
+            return hash<string_view>{}(key);
+        }
+    };
+
+    /**
+     * @class TranslationMap
+     * @brief Flat key → translated text catalogue of a single language
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Entries live contiguously in insertion order and are indexed by an
+     * open-addressing table with linear probing. Every slot keeps the full
+     * hash of its key, so a probe only compares strings when the hashes
+     * match and growing the table never hashes a key twice. Lookups take
+     * string_view keys and never allocate.
+     *
+     * A catalogue may also inherit the entries of the fallback language it
+     * lacks (see mergeFallback()), so a lookup resolves the whole fallback
+     * chain in one probe. Inherited entries are kept apart from the
+     * language's own ones: iteration, size() and equality only see its own
+     * entries, which is what gets saved and compared.
+     *
+     * Own entries are never removed; a catalogue is rebuilt when its file is
+     * reloaded.
+     *
+     * The own entries may instead come from a memory-mapped CompiledCatalogue.
+     * Lookups then go straight to the mapped file; iterating copies its
+     * entries once, and the first write copies them into the table and drops
+     * the mapping, so an edited catalogue behaves like a parsed one.
+     *
+     * Translations are tokenised into MessageTemplates the first time they
+     * are formatted; writing a key drops its template.
+     *
+     * @note Inserting may move the stored strings, so views obtained from
+     *       find() are only valid until the next insertion
+     */
+    class TranslationMap
+    {
+    public:
+        using value_type = pair<string, string>;
+        using const_iterator = vector<value_type>::const_iterator;
+        using iterator = const_iterator;
+
+        TranslationMap() = default;
+
+        /**
+         * @brief Build a catalogue from key/translation pairs
+         *
+         * @param entries Pairs to insert; later duplicates overwrite earlier ones
+         */
+        TranslationMap(initializer_list<value_type> entries);
+
+        /**
+         * @brief Build a catalogue whose own entries are those of a compiled file
+         *
+         * @param compiled Mapped catalogue; kept alive as long as this catalogue uses it
+         */
+        explicit TranslationMap(shared_ptr<const CompiledCatalogue> compiled);
+
+        /**
+         * @brief Find the translation stored for a key, own or inherited
+         *
+         * @param key Translation key
+         * @return View of the translation, or nullopt if the key is not present
+         */
+        [[nodiscard]] optional<string_view> find(string_view key) const;
+
+        /**
+         * @brief Find the plural form of a key for a category
+         *
+         * Plural forms are stored as "<key>.<category>", which is what a
+         * JSON object such as {"files": {"one": "...", "few": "...", "other": "..."}}
+         * flattens to. A missing form falls back to "<key>.other".
+         *
+         * @param key Translation key, without category
+         * @param category Category picked by the language's plural rule
+         * @return View of the form, or nullopt if the key has neither form
+         */
+        [[nodiscard]] optional<string_view> findPlural(string_view key, PluralCategory category) const;
+
+        /**
+         * @brief Append the translation of a key with its placeholders substituted
+         *
+         * @param out Buffer to append to
+         * @param key Translation key
+         * @param args Named values for the placeholders
+         * @return false, leaving out untouched, if the key is not present
+         */
+        bool formatTo(string &out, string_view key, span<const FormatArg> args) const;
+
+        /**
+         * @brief Check whether a key has a translation, own or inherited
+         *
+         * @param key Translation key
+         * @return true if the key is present
+         */
+        [[nodiscard]] bool contains(string_view key) const;
+
+        /**
+         * @brief Check whether the language itself translates a key
+         *
+         * @param key Translation key
+         * @return true if the key is an own entry, false if missing or inherited
+         */
+        [[nodiscard]] bool hasOwn(string_view key) const;
+
+        /**
+         * @brief Access the own translation of a key, inserting an empty one if missing
+         *
+         * An inherited entry for the key becomes an own entry, keeping its text
+         * until the caller overwrites it. A compiled catalogue is copied into
+         * the table first.
+         *
+         * @param key Translation key
+         * @return Reference to the stored translation
+         */
+        string &operator[](string_view key);
+
+        /**
+         * @brief Replace the inherited entries with the keys of fallback this catalogue lacks
+         *
+         * @param fallback Catalogue of the fallback language; only its own entries are taken
+         */
+        void mergeFallback(const TranslationMap &fallback);
+
+        /**
+         * @brief Inherit or refresh a single fallback entry
+         *
+         * Does nothing when the language has its own translation for the key.
+         *
+         * @param key Translation key
+         * @param translation Fallback translation
+         */
+        void inherit(string_view key, const string &translation);
+
+        /**
+         * @brief Number of entries inherited from the fallback language
+         */
+        [[nodiscard]] size_t inheritedSize() const { return inherited.size(); }
+
+        /**
+         * @brief Stamp of the contents, unique across catalogues and renewed by every change
+         *
+         * Copies share their source's stamp, so equal stamps mean equal contents.
+         */
+        [[nodiscard]] uint64_t revision() const { return stamp; }
+
+        /**
+         * @brief Stamp of the set of own keys, renewed only when a key becomes an own entry
+         *
+         * Changing a translation or the inherited entries keeps it, so it
+         * tells whether coverage against the fallback language may have changed.
+         */
+        [[nodiscard]] uint64_t keysRevision() const { return keysStamp; }
+
+        /**
+         * @brief Check whether the own entries are read from a compiled file
+         */
+        [[nodiscard]] bool isCompiled() const { return compiled != nullptr; }
+
+        /**
+         * @brief Reserve room for a number of entries without rehashing
+         *
+         * @param count Expected number of entries
+         */
+        void reserve(size_t count);
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool empty() const { return size() == 0; }
+        [[nodiscard]] const_iterator begin() const { return ownEntries().begin(); }
+        [[nodiscard]] const_iterator end() const { return ownEntries().end(); }
+
+        /**
+         * @brief Two catalogues are equal when they hold the same own pairs, in any order
+         */
+        friend bool operator==(const TranslationMap &lhs, const TranslationMap &rhs);
+
+    private:
+        /**
+         * Marks a slot that does not reference any entry
+         */
+        static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+        /**
+         * Set in a slot's entry when it indexes inherited instead of entries
+         */
+        static constexpr uint32_t INHERITED_BIT = 0x80000000u;
+
+        /**
+         * @brief Table slot: the precomputed hash and the index of its entry
+         */
+        struct Slot
+        {
+            size_t hash = 0;
+            uint32_t entry = EMPTY_SLOT;
+        };
+
+        /**
+         * Own key/translation pairs in insertion order
+         */
+        vector<value_type> entries;
+
+        /**
+         * Key/translation pairs taken from the fallback language
+         */
+        vector<value_type> inherited;
+
+        /**
+         * Open-addressing index over entries and inherited; its size is zero or a power of two
+         */
+        vector<Slot> slots;
+
+        /**
+         * Mapped own entries; while set, entries is empty and slots only index inherited
+         */
+        shared_ptr<const CompiledCatalogue> compiled;
+
+        /**
+         * Copy of the compiled entries, filled the first time they are iterated
+         */
+        mutable vector<value_type> compiledEntries;
+
+        /**
+         * Contents stamp; see revision()
+         */
+        uint64_t stamp = nextStamp();
+
+        /**
+         * Own keys stamp; see keysRevision()
+         */
+        uint64_t keysStamp = nextStamp();
+
+        /**
+         * @brief Draw a stamp no catalogue has used yet
+         */
+        [[nodiscard]] static uint64_t nextStamp();
+
+        /**
+         * Tokenised translations by key, filled as they are formatted
+         */
+        mutable unordered_map<string, MessageTemplate, TranslationKeyHash, equal_to<>> templates;
+
+        /**
+         * @brief Drop the template of a key about to be rewritten
+         */
+        void forgetTemplate(string_view key);
+
+        /**
+         * @brief Own entries to iterate, copying the compiled ones if needed
+         */
+        [[nodiscard]] const vector<value_type> &ownEntries() const;
+
+        /**
+         * @brief Move the compiled entries into the table and release the mapping
+         */
+        void detach();
+
+        /**
+         * @brief Hash a key the same way for insertion and lookup
+         */
+        [[nodiscard]] static size_t hashKey(string_view key);
+
+        /**
+         * @brief Locate the slot holding key, or the empty slot where it would go
+         *
+         * @param key  Translation key
+         * @param hash hashKey(key)
+         * @return Index into slots
+         *
+         * @note slots must not be empty
+         */
+        [[nodiscard]] size_t probe(string_view key, size_t hash) const;
+
+        /**
+         * @brief Resolve a slot's entry to its pair, own or inherited
+         */
+        [[nodiscard]] const value_type &entryOf(const Slot &slot) const;
+
+        /**
+         * @brief Make room for one more entry, growing the index if needed
+         */
+        void reserveOne();
+
+        /**
+         * @brief Resize the index to a capacity and re-slot the entries
+         *
+         * @param capacity New number of slots, a power of two
+         * @param keepInherited false drops the inherited entries' slots
+         */
+        void rehash(size_t capacity, bool keepInherited = true);
+    };
+}
+
+#endif //ADS_TRANSLATION_MAP_H
@@ -0,0 +1,86 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#include "TranslationWatcher.h"
+
+#include <system_error>
+#include <utility>
+
+namespace ADS::i18n {
+    TranslationWatcher::TranslationWatcher(filesystem::path folder, const chrono::milliseconds interval,
+                                           Callback onChange) :
+        folder(std::move(folder)), interval(interval), onChange(std::move(onChange))
+    {
+        this->poll(false);
+        this->worker = thread(&TranslationWatcher::run, this);
+    }
+
+    TranslationWatcher::~TranslationWatcher()
+    {
+        {
+            lock_guard lock(this->stopMutex);
+            this->stopping = true;
+        }
+        this->stopSignal.notify_all();
+
+        if (this->worker.joinable()) {
+            this->worker.join();
+        }
+    }
+
+    void TranslationWatcher::run()
+    {
+        unique_lock lock(this->stopMutex);
+        while (!this->stopSignal.wait_for(lock, this->interval, [this] { return this->stopping; })) {
+            lock.unlock();
+            this->poll(true);
+            lock.lock();
+        }
+    }
+
+    void TranslationWatcher::poll(const bool report)
+    {
+        // The folder may be briefly unavailable while files are replaced; try again next time
+        error_code error;
+        filesystem::directory_iterator files(this->folder, error);
+        if (error) {
+            return;
+        }
+
+        for (const filesystem::directory_entry &entry: files) {
+            if (entry.path().extension() != ".json" || !entry.is_regular_file(error)) {
+                continue;
+            }
+
+            const filesystem::file_time_type time = entry.last_write_time(error);
+            if (error) {
+                continue;
+            }
+
+            const string language = entry.path().stem().string();
+            auto [stamp, added] = this->stamps.try_emplace(language, Stamp{time});
+            if (added) {
+                stamp->second.pending = report;
+                continue;
+            }
+
+            if (stamp->second.time != time) {
+                // Still being written, or just written: wait for it to settle
+                stamp->second.time = time;
+                stamp->second.pending = true;
+            } else if (stamp->second.pending) {
+                stamp->second.pending = false;
+                this->onChange(language);
+            }
+        }
+    }
+}
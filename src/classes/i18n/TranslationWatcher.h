@@ -0,0 +1,97 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#ifndef ADS_TRANSLATION_WATCHER_H
+#define ADS_TRANSLATION_WATCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace ADS::i18n {
+    using namespace std;
+
+    /**
+     * @class TranslationWatcher
+     * @brief Background thread that reports translation files changed on disk
+     *
+     * @autor   Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Polls the modification time of every <language>.json in a folder,
+     * which works the same on every platform and on network drives. A
+     * change is only reported once the time has stayed the same for a whole
+     * interval, so a file an editor is still writing is not read half-way.
+     * Files present when the watcher starts are taken as already loaded.
+     *
+     * The callback runs on the watcher thread.
+     */
+    class TranslationWatcher
+    {
+    public:
+        using Callback = function<void(const string &language)>;
+
+        /**
+         * @brief Start watching a folder
+         *
+         * @param folder Folder holding the translation files
+         * @param interval Time between two polls
+         * @param onChange Called with the language code of each changed file
+         */
+        TranslationWatcher(filesystem::path folder, chrono::milliseconds interval, Callback onChange);
+
+        /**
+         * @brief Stop the thread, waiting for a running callback to return
+         */
+        ~TranslationWatcher();
+
+        TranslationWatcher(const TranslationWatcher &) = delete;
+        TranslationWatcher &operator=(const TranslationWatcher &) = delete;
+
+    private:
+        /**
+         * @brief Last modification time seen for a file, and whether it still has to be reported
+         */
+        struct Stamp
+        {
+            filesystem::file_time_type time;
+            bool pending = false;
+        };
+
+        filesystem::path folder;
+        chrono::milliseconds interval;
+        Callback onChange;
+
+        unordered_map<string, Stamp> stamps;      ///< By language; only used by the thread
+
+        mutex stopMutex;                          ///< Guards stopping
+        condition_variable stopSignal;            ///< Wakes the thread early to stop
+        bool stopping = false;
+
+        thread worker;
+
+        /**
+         * @brief Compare the files with the stamps and report the settled changes
+         *
+         * @param report false records the current times without reporting anything
+         */
+        void poll(bool report);
+
+        void run();
+    };
+}
+
+#endif //ADS_TRANSLATION_WATCHER_H
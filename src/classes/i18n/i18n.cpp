@@ -11,19 +11,27 @@
  */
 
 #include "i18n.h"
+#include "CompiledCatalogue.h"
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <functional>
 #include <regex>
 #include <fstream>
 #include <locale>
+#include <thread>
 #include <nlohmann/json.hpp>
 
 #include "../../exceptions/filesystem/file_not_found_exception.h"
 #include "../../exceptions/json/json_parse_exception.h"
 #include "adsString.h"
 #include "spdlog/spdlog.h"
+#include "Logger/logger.h"
+#include "Core/AllocationCounter.h"
+#include "Core/Profiling.h"
+#include "Core/TraceRecorder.h"
 
 using json = nlohmann::json;
 
@@ -33,6 +41,118 @@ using json = nlohmann::json;
 #endif
 
 namespace ADS::i18n {
+    namespace {
+        /**
+         * @brief SAX consumer that flattens a translation file into a catalogue
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Nested objects become dotted keys ("menu": {"file": ...} is
+         * "menu.file"). The key being read is kept in one buffer; each open
+         * object remembers how long its prefix is, so a new key only
+         * truncates and appends. String values are moved out of the
+         * parser's buffer into the catalogue. Anything but objects and
+         * strings is reported as a type error at the offending key.
+         */
+        class TranslationSaxHandler final : public nlohmann::json_sax<json>
+        {
+        private:
+            TranslationMap &m_catalogue;
+            const std::string &m_filePath;
+            std::string m_path;                  ///< Dotted key of the value being read
+            std::vector<size_t> m_prefixLengths; ///< Length of the prefix of each open object
+
+            [[noreturn]] void reject(const char *found) const
+            {
+                throw ADS::Exceptions::json_parse_exception(
+                    m_filePath, m_path,
+                    json::type_error::create(302, std::format("type must be string, but is {}", found), nullptr));
+            }
+
+        public:
+            TranslationSaxHandler(TranslationMap &catalogue, const std::string &prefix, const std::string &filePath) :
+                m_catalogue(catalogue), m_filePath(filePath), m_path(prefix)
+            {
+            }
+
+            bool null() override { reject("null"); }
+            bool boolean(bool) override { reject("boolean"); }
+            bool number_integer(number_integer_t) override { reject("number"); }
+            bool number_unsigned(number_unsigned_t) override { reject("number"); }
+            bool number_float(number_float_t, const string_t &) override { reject("number"); }
+            bool binary(binary_t &) override { reject("binary"); }
+            bool start_array(std::size_t) override { reject("array"); }
+            bool end_array() override { return true; }
+
+            bool string(string_t &val) override
+            {
+                if (m_prefixLengths.empty()) {
+                    reject("string");
+                }
+                m_catalogue[m_path] = std::move(val);
+                return true;
+            }
+
+            bool start_object(std::size_t) override
+            {
+                if (!m_path.empty()) {
+                    m_path += '.';
+                }
+                m_prefixLengths.push_back(m_path.size());
+                return true;
+            }
+
+            bool key(string_t &val) override
+            {
+                m_path.resize(m_prefixLengths.back());
+                m_path += val;
+                return true;
+            }
+
+            bool end_object() override
+            {
+                m_prefixLengths.pop_back();
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string &, const nlohmann::json::exception &ex) override
+            {
+                throw ADS::Exceptions::json_parse_exception(m_filePath, m_path, ex);
+            }
+        };
+
+        /**
+         * Source of CatalogueSnapshot stamps, shared by every i18n instance
+         */
+        atomic<uint64_t> snapshotStamps = 0;
+
+        /**
+         * @brief Copy a text read off the owning thread into storage of the calling thread
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A snapshot may be freed by any later update(), so views handed
+         * out on other threads point here instead. Each distinct text is
+         * copied once and kept for the life of the thread.
+         *
+         * @param text Text to keep
+         * @return View of the thread's copy; null-terminated
+         */
+        string_view keepOnThread(const string_view text)
+        {
+            thread_local unordered_set<string, TranslationKeyHash, equal_to<> > texts;
+
+            auto it = texts.find(text);
+            if (it == texts.end()) {
+                it = texts.emplace(text).first;
+            }
+
+            return *it;
+        }
+    }
+
     /**
      * @brief Construct i18n system with base folder and fallback language
      *
@@ -84,6 +204,7 @@ namespace ADS::i18n {
      */
     void i18n::init()
     {
+        ADS::Core::AllocationCounter::Scope memory(ADS::Core::AllocationCounter::Tag::I18n);
         try {
             // Extract system locale information
             this->extractSystemLocale();
@@ -109,11 +230,131 @@ namespace ADS::i18n {
                     // If current locale can't be loaded, stick with fallback
                 }
             }
+
+            this->publishSnapshot();
         } catch (const std::exception &e) {
             throw i18n_exception("Failed to initialize i18n system: " + string(e.what()));
         }
     }
 
+    /**
+     * @brief Refresh the cached current and fallback catalogue pointers
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The pointers stay valid while the languages are loaded because the
+     * nodes of an unordered_map never move on rehash. The keyed translations
+     * point into the catalogues, or into KEY_NAMES when a key is missing.
+     */
+    void i18n::bindCatalogues()
+    {
+        auto currentIt = this->translations.find(currentLocale.locale);
+        this->currentCatalogue = (currentIt != this->translations.end()) ? &currentIt->second : nullptr;
+
+        auto fallbackIt = this->translations.find(fallbackLanguage);
+        this->fallbackCatalogue = (fallbackIt != this->translations.end()) ? &fallbackIt->second : nullptr;
+        this->currentPluralRule = pluralRuleFor(currentLocale.locale);
+
+        for (size_t key = 0; key < KEY_COUNT; ++key) {
+            this->keyedTranslations[key] = this->lookup(KEY_NAMES[key]);
+        }
+
+        ++this->keyedRevision;
+        this->snapshotStale = true;
+    }
+
+    /**
+     * @brief Publish an immutable copy of the catalogues for other threads
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Readers load the snapshot pointer atomically and keep the snapshot
+     * alive while they hold it, so the previous one is freed by whichever
+     * thread drops it last.
+     */
+    void i18n::publishSnapshot()
+    {
+        const shared_ptr<const CatalogueSnapshot> previous = this->publishedSnapshot.load();
+        auto next = make_shared<CatalogueSnapshot>();
+
+        for (const auto &[language, catalogue]: this->translations) {
+            if (previous != nullptr) {
+                auto shared = previous->catalogues.find(language);
+                if (shared != previous->catalogues.end() && shared->second->revision() == catalogue.revision()) {
+                    next->catalogues.emplace(language, shared->second);
+                    continue;
+                }
+            }
+            next->catalogues.emplace(language, make_shared<const TranslationMap>(catalogue));
+        }
+
+        // Workers read coverage from the snapshot, so bring it up to date first
+        this->coverageIndex.refresh(this->translations, this->fallbackLanguage);
+        next->coverage = (previous != nullptr && previous->coverage->getChanges() == this->coverageIndex.getChanges())
+                             ? previous->coverage
+                             : make_shared<const CoverageIndex>(this->coverageIndex);
+
+        next->locale = this->currentLocale.locale;
+        next->generation = (previous != nullptr) ? previous->generation + 1 : 1;
+        next->stamp = ++snapshotStamps;
+        next->bind(this->fallbackLanguage);
+
+        const uint64_t stamp = next->stamp;
+        this->publishedSnapshot.store(std::move(next));
+        this->publishedStamp.store(stamp, memory_order_release);
+        this->snapshotStale = false;
+    }
+
+    /**
+     * @brief Merge the fallback catalogue into one language, or all of them
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language Language to merge; empty or the fallback merges all
+     */
+    void i18n::mergeFallback(const string &language)
+    {
+        auto fallbackIt = this->translations.find(fallbackLanguage);
+        if (fallbackIt == this->translations.end()) {
+            return;
+        }
+
+        if (!language.empty() && language != fallbackLanguage) {
+            auto langIt = this->translations.find(language);
+            if (langIt != this->translations.end()) {
+                langIt->second.mergeFallback(fallbackIt->second);
+            }
+            return;
+        }
+
+        for (auto &[lang, catalogue]: this->translations) {
+            if (lang != fallbackLanguage) {
+                catalogue.mergeFallback(fallbackIt->second);
+            }
+        }
+    }
+
+    /**
+     * @brief Pass a new or changed fallback translation on to every other catalogue
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param key Translation key
+     * @param translation Translation in the fallback language
+     */
+    void i18n::inheritFallback(const string &key, const string &translation)
+    {
+        for (auto &[lang, catalogue]: this->translations) {
+            if (lang != fallbackLanguage) {
+                catalogue.inherit(key, translation);
+            }
+        }
+    }
+
     /**
      * @brief Extract and normalize system locale information
      *
@@ -219,6 +460,19 @@ namespace ADS::i18n {
         return this->currentLocale;
     }
 
+    /**
+     * @brief Get a number that changes whenever translations may have
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return uint64_t Current revision
+     */
+    [[nodiscard]] uint64_t i18n::getRevision() const
+    {
+        return this->keyedRevision;
+    }
+
     /**
      * @brief Load translation file for a specific language
      *
@@ -237,6 +491,37 @@ namespace ADS::i18n {
      */
     bool i18n::loadTranslationFile(const string &language)
     {
+        TranslationMap languageTranslations;
+        if (!this->readTranslationFile(language, languageTranslations)) {
+            return false;
+        }
+
+        this->translations[language] = std::move(languageTranslations);
+
+        return true;
+    }
+
+    /**
+     * @brief Read and parse the translation file of a language without storing it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language The language code to read (e.g., "es_ES")
+     * @param catalogue Output catalogue filled with the parsed entries
+     * @param useCompiled false always parses the JSON file
+     * @return true if the file exists and was parsed, false otherwise
+     *
+     * @note Parse and I/O errors are logged and reported as false
+     */
+    bool i18n::readTranslationFile(const string &language, TranslationMap &catalogue, const bool useCompiled) const
+    {
+        ADS::Core::TraceRecorder::Scope trace("i18n::readTranslationFile");
+        ADS_ZONE("i18n::readTranslationFile");
+        if (useCompiled && this->readCompiledFile(language, catalogue)) {
+            return true;
+        }
+
         filesystem::path filePath = baseFolder / (language + ".json");
 
         if (std::filesystem::exists(filePath)) {
@@ -245,29 +530,20 @@ namespace ADS::i18n {
 
                 string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
                 file.close();
-                unordered_map<string, string> languageTranslations;
 
-                if (this->parseJsonContent("", content, languageTranslations, filePath.string())) {
-                    this->translations[language] = std::move(languageTranslations);
-
-                    return true;
-                }
+                return this->parseJsonContent("", content, catalogue, filePath.string());
             } catch (const ADS::Exceptions::json_parse_exception &e) {
                 // Custom exception already contains detailed information
-                spdlog::error(e.what());
+                ADS_LOG_ERROR(I18n, "{}", e.what());
                 return false;
             } catch (const json::exception &e) {
                 // Other JSON errors
-                spdlog::error(std::format(
-                    "JSON error loading {} translations from '{}': {}",
-                    language, filePath.string(), e.what())
-                );
+                ADS_LOG_ERROR(I18n, "JSON error loading {} translations from '{}': {}",
+                              language, filePath.string(), e.what());
                 return false;
             } catch (const std::ios_base::failure &e) {
-                spdlog::error(std::format(
-                    "Failed to read {} translation file '{}': {} (error code: {})",
-                    language, filePath.string(), e.what(), e.code().value())
-                );
+                ADS_LOG_ERROR(I18n, "Failed to read {} translation file '{}': {} (error code: {})",
+                              language, filePath.string(), e.what(), e.code().value());
                 return false;
             }
         }
@@ -275,6 +551,42 @@ namespace ADS::i18n {
         return false; // File not found
     }
 
+    /**
+     * @brief Map the compiled catalogue of a language if it is up to date
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language The language code to read (e.g., "es_ES")
+     * @param catalogue Output catalogue backed by the mapped file
+     * @return true if the .adsl file was mapped, false if missing, stale or invalid
+     */
+    bool i18n::readCompiledFile(const string &language, TranslationMap &catalogue) const
+    {
+        const filesystem::path compiledPath = baseFolder / (language + string(CompiledCatalogue::EXTENSION));
+        const filesystem::path sourcePath = baseFolder / (language + ".json");
+
+        std::error_code error;
+        if (!filesystem::exists(compiledPath, error)) {
+            return false;
+        }
+
+        // The JSON file is the source of truth; an older compiled file is stale
+        if (filesystem::exists(sourcePath, error)
+            && filesystem::last_write_time(sourcePath, error) > filesystem::last_write_time(compiledPath, error)) {
+            ADS_LOG_INFO(I18n, "Ignoring stale compiled catalogue '{}'", compiledPath.string());
+            return false;
+        }
+
+        try {
+            catalogue = TranslationMap(CompiledCatalogue::open(compiledPath));
+            return true;
+        } catch (const Exceptions::BaseException &e) {
+            ADS_LOG_WARN(I18n, "{}; loading '{}' instead", e.what(), sourcePath.string());
+            return false;
+        }
+    }
+
     /**
      * @brief Parse JSON format translation file content
      *
@@ -283,44 +595,36 @@ namespace ADS::i18n {
      *
      * Parses JSON content containing translation key-value pairs. Supports
      * nested objects using dot notation (e.g., "menu.file.open"). Handles
-     * both flat and hierarchical JSON structures.
+     * both flat and hierarchical JSON structures in a single SAX pass,
+     * without building a DOM.
      *
-     * @param key Key to add to the translations. It could be empty
+     * @param key Prefix for every key in the content. It could be empty
      * @param content JSON file content as string
      * @param translations Output map to store parsed key-value pairs
      *
      * @return true if parsing was successful, false on error
      *
-     * @note Requires nlohmann/json library for JSON parsing
-     * @see parseNestedJson() for nested object handling
+     * @throws ADS::Exceptions::json_parse_exception on malformed JSON or non-string values
+     * @see TranslationSaxHandler
      */
-    bool i18n::parseJsonContent(const string &key, const string &content, unordered_map<string, string> &translations, const string &file_path)
+    bool i18n::parseJsonContent(const string &key, const string &content, TranslationMap &translations, const string &file_path) const
     {
         try {
-            // Parse JSON directly - this will throw json::parse_error if malformed
-            json jsonData = json::parse(content);
-
-            for (auto it = jsonData.begin(); it != jsonData.end(); ++it) {
-                if (it.value().is_object()) {
-                    // It's another JSON object. It needs to be parsed again
-                    this->parseJsonContent(it.key(), it.value().dump(), translations, file_path);
-                } else {
-                    // it's a string...
-                    translations[key.empty() ? it.key() : key + "." + it.key()] = it.value().get<string>();
-                }
-            }
+            // The handler throws json_parse_exception with the key path on any error
+            TranslationSaxHandler handler(translations, key, file_path);
+            json::sax_parse(content, &handler);
 
             return !translations.empty();
 
+        } catch (const ADS::Exceptions::json_parse_exception &) {
+            throw;
         } catch (const json::exception &e) {
             // Create custom exception with file and key path information
             throw ADS::Exceptions::json_parse_exception(file_path, key, e);
         } catch (const std::exception &e) {
             // Log unexpected errors and re-throw
-            spdlog::error(std::format(
-                "Unexpected error parsing JSON for key '{}' in file '{}': {}",
-                key.empty() ? "<root>" : key, file_path, e.what())
-            );
+            ADS_LOG_ERROR(I18n, "Unexpected error parsing JSON for key '{}' in file '{}': {}",
+                          key.empty() ? "<root>" : key, file_path, e.what());
             throw;
         }
     }
@@ -351,6 +655,8 @@ namespace ADS::i18n {
         if (!hasLanguage(locale.locale)) {
             this->addLanguage(locale.locale);
         }
+
+        this->bindCatalogues();
     }
 
     /**
@@ -394,7 +700,7 @@ namespace ADS::i18n {
 
         auto it = this->translations.find(targetLanguage);
         if (it != this->translations.end()) {
-            return it->second;
+            return {it->second.begin(), it->second.end()};
         }
 
         return {};
@@ -413,7 +719,7 @@ namespace ADS::i18n {
      *
      * @note The returned pointer is valid until translations are modified
      */
-    const pair<const string, unordered_map<string, string> > *i18n::getFallbackLanguageTranslations() const
+    const pair<const string, TranslationMap> *i18n::getFallbackLanguageTranslations() const
     {
         auto it = this->translations.find(fallbackLanguage);
         return (it != this->translations.end()) ? &(*it) : nullptr;
@@ -433,7 +739,7 @@ namespace ADS::i18n {
      *
      * @note The returned pointer is valid until translations are modified
      */
-    const pair<const string, unordered_map<string, string> > *i18n::getLanguage(const string &language) const
+    const pair<const string, TranslationMap> *i18n::getLanguage(const string &language) const
     {
         auto it = this->translations.find(language);
         return (it != this->translations.end()) ? &(*it) : nullptr;
@@ -474,7 +780,7 @@ namespace ADS::i18n {
      *
      * @see loadTranslationFile(), Constants::Languages::isLanguageSupported()
      */
-    pair<const string, unordered_map<string, string> > *i18n::addLanguage(const string &language)
+    pair<const string, TranslationMap> *i18n::addLanguage(const string &language)
     {
         // Validate language support
         if (!Constants::Languages::isLanguageSupported(language)) {
@@ -487,16 +793,246 @@ namespace ADS::i18n {
             return &(*it);
         }
 
+        // The active languages are always needed; the rest can wait for their first use
+        if (this->loadMode == LoadMode::Lazy && language != currentLocale.locale && language != fallbackLanguage) {
+            this->registeredLanguages.insert(language);
+            return nullptr;
+        }
+
+        return this->loadLanguage(language);
+    }
+
+    /**
+     * @brief Load a language now, whatever the load mode
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language Supported language code
+     * @return Pointer to the language translation entry
+     */
+    pair<const string, TranslationMap> *i18n::loadLanguage(const string &language)
+    {
+        ADS::Core::AllocationCounter::Scope memory(ADS::Core::AllocationCounter::Tag::I18n);
+        auto it = this->translations.find(language);
+        if (it != this->translations.end()) {
+            return &(*it);
+        }
+
+        if (auto registered = this->registeredLanguages.find(language); registered != this->registeredLanguages.end()) {
+            this->registeredLanguages.erase(registered);
+        }
+
         // Try to load from file
         if (!loadTranslationFile(language)) {
             // Create empty translation map if file doesn't exist
-            translations[language] = unordered_map<string, string>();
+            translations[language] = TranslationMap();
         }
 
+        this->mergeFallback(language);
+        this->bindCatalogues();
+
         auto result = this->translations.find(language);
         return &(*result);
     }
 
+    /**
+     * @brief Load several languages concurrently
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Every worker claims the next pending language through an atomic
+     * index and parses it into its own slot, so the workers share nothing
+     * but that counter. The translations map is only touched by the calling
+     * thread, after every worker has joined.
+     *
+     * @param languages Language codes to load; duplicates and loaded ones are skipped
+     * @return Number of languages loaded from a file
+     *
+     * @throws locale_exception if any language is not supported; nothing is loaded then
+     */
+    size_t i18n::addLanguages(const vector<string> &languages)
+    {
+        ADS_ZONE("i18n::addLanguages");
+        ADS::Core::AllocationCounter::Scope memory(ADS::Core::AllocationCounter::Tag::I18n);
+        vector<string> pending;
+        for (const string &language: languages) {
+            if (!Constants::Languages::isLanguageSupported(language)) {
+                throw locale_exception("Language not supported: " + language);
+            }
+            if (hasLanguage(language) || std::find(pending.begin(), pending.end(), language) != pending.end()) {
+                continue;
+            }
+            if (this->loadMode == LoadMode::Lazy && language != currentLocale.locale && language != fallbackLanguage) {
+                this->registeredLanguages.insert(language);
+                continue;
+            }
+            pending.push_back(language);
+        }
+
+        if (pending.empty()) {
+            return 0;
+        }
+
+        struct Slot
+        {
+            TranslationMap catalogue;
+            bool loaded = false;
+            std::exception_ptr error;
+        };
+        vector<Slot> slots(pending.size());
+        std::atomic<size_t> next{0};
+
+        auto worker = [&]() {
+            for (size_t index = next.fetch_add(1, std::memory_order_relaxed);
+                 index < pending.size();
+                 index = next.fetch_add(1, std::memory_order_relaxed)) {
+                try {
+                    slots[index].loaded = this->readTranslationFile(pending[index], slots[index].catalogue);
+                } catch (...) {
+                    slots[index].error = std::current_exception();
+                }
+            }
+        };
+
+        const size_t workerCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, pending.size());
+        vector<std::thread> workers;
+        workers.reserve(workerCount - 1);
+        for (size_t i = 1; i < workerCount; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker(); // The calling thread takes its share too
+        for (std::thread &thread: workers) {
+            thread.join();
+        }
+
+        for (const Slot &slot: slots) {
+            if (slot.error) {
+                std::rethrow_exception(slot.error);
+            }
+        }
+
+        // Publish every catalogue in one go
+        size_t loadedCount = 0;
+        for (size_t index = 0; index < pending.size(); ++index) {
+            this->registeredLanguages.erase(pending[index]);
+            // A file that failed to parse leaves an empty catalogue, as addLanguage() does
+            if (slots[index].loaded) {
+                loadedCount++;
+                this->translations[pending[index]] = std::move(slots[index].catalogue);
+            } else {
+                this->translations[pending[index]] = TranslationMap();
+            }
+        }
+
+        this->mergeFallback();
+        this->bindCatalogues();
+        this->coverageIndex.refresh(this->translations, this->fallbackLanguage);
+
+        return loadedCount;
+    }
+
+    /**
+     * @brief Parse a language registered in LoadMode::Lazy on its first use
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language Language code to look up
+     * @return The catalogue, or nullptr if the language was not registered
+     */
+    const TranslationMap *i18n::loadRegistered(const string_view language) const
+    {
+        ADS::Core::AllocationCounter::Scope memory(ADS::Core::AllocationCounter::Tag::I18n);
+        auto registered = this->registeredLanguages.find(language);
+        if (registered == this->registeredLanguages.end()) {
+            return nullptr;
+        }
+
+        const string code = *registered;
+        this->registeredLanguages.erase(registered);
+
+        TranslationMap catalogue;
+        if (!this->readTranslationFile(code, catalogue)) {
+            catalogue = TranslationMap();
+        }
+        if (this->fallbackCatalogue != nullptr) {
+            catalogue.mergeFallback(*this->fallbackCatalogue);
+        }
+
+        this->snapshotStale = true;
+
+        return &this->translations.emplace(code, std::move(catalogue)).first->second;
+    }
+
+    /**
+     * @brief Choose whether languages are parsed when added or on first use
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param mode LoadMode::Eager (default) or LoadMode::Lazy
+     */
+    void i18n::setLoadMode(const LoadMode mode)
+    {
+        this->loadMode = mode;
+    }
+
+    /**
+     * @brief Make the calling thread the owner of the object
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The hand-over is ordered by whatever the new owner waited on, e.g.
+     * JobSystem::wait(), so a plain store is enough.
+     */
+    void i18n::takeOwnership()
+    {
+        this->ownerThread = this_thread::get_id();
+    }
+
+    /**
+     * @brief Check if a language is loaded or registered for lazy loading
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language The language code to check
+     * @return true if the language is loaded or will be on first use
+     */
+    bool i18n::isLanguageKnown(const string &language) const
+    {
+        return this->hasLanguage(language) || this->registeredLanguages.contains(language);
+    }
+
+    /**
+     * @brief Unload every catalogue but the current locale and the fallback
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return Number of catalogues unloaded
+     */
+    size_t i18n::unloadUnusedLanguages()
+    {
+        size_t unloaded = 0;
+        for (auto it = this->translations.begin(); it != this->translations.end();) {
+            if (it->first == currentLocale.locale || it->first == fallbackLanguage) {
+                ++it;
+                continue;
+            }
+            this->registeredLanguages.insert(it->first);
+            it = this->translations.erase(it);
+            unloaded++;
+        }
+
+        this->bindCatalogues();
+
+        return unloaded;
+    }
+
     /**
      * @brief Add a translation key-value pair to the system
      *
@@ -517,23 +1053,42 @@ namespace ADS::i18n {
     void i18n::addTranslation(const string &key, const string &translation,
                               const string &language, const string &fallbackTranslation)
     {
+        ADS::Core::AllocationCounter::Scope memory(ADS::Core::AllocationCounter::Tag::I18n);
         string targetLanguage = language.empty() ? currentLocale.locale : language;
 
-        // Ensure language exists
+        // Ensure language is loaded, even if it was only registered
         if (!hasLanguage(targetLanguage)) {
-            addLanguage(targetLanguage);
+            if (!Constants::Languages::isLanguageSupported(targetLanguage)) {
+                throw locale_exception("Language not supported: " + targetLanguage);
+            }
+            this->loadLanguage(targetLanguage);
         }
 
         // Add translation
-        translations[targetLanguage][key] = translation;
+        TranslationMap &target = translations[targetLanguage];
+        const uint64_t targetKeys = target.keysRevision();
+        target[key] = translation;
+        if (targetLanguage == fallbackLanguage) {
+            this->inheritFallback(key, translation);
+            this->coverageIndex.referenceKeyAdded(key, targetKeys, this->translations);
+        } else {
+            this->coverageIndex.keyTranslated(targetLanguage, key, targetKeys, target);
+        }
 
         // Add fallback translation if provided
         if (!fallbackTranslation.empty() && targetLanguage != fallbackLanguage) {
             if (!hasLanguage(fallbackLanguage)) {
                 addLanguage(fallbackLanguage);
             }
-            translations[fallbackLanguage][key] = fallbackTranslation;
+            TranslationMap &fallback = translations[fallbackLanguage];
+            const uint64_t fallbackKeys = fallback.keysRevision();
+            fallback[key] = fallbackTranslation;
+            this->inheritFallback(key, fallbackTranslation);
+            this->coverageIndex.referenceKeyAdded(key, fallbackKeys, this->translations);
         }
+
+        // Inserting may have moved the strings the keyed translations point to
+        this->bindCatalogues();
     }
 
     /**
@@ -545,13 +1100,114 @@ namespace ADS::i18n {
      *
      * @param text          Key to translate. It must exist in translations
      *
-     * @return Reference to the i18n translations instance
+     * @return View of the translation; see lookup() for its lifetime
+     *
+     * @see i18n::lookup
+     */
+    string_view i18n::_t(const string_view text) const
+    {
+        return this->lookup(text);
+    }
+
+    /**
+     * @brief Return the translation of a compile-time key on the current locale
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param key Key ID generated from en_US.json
+     *
+     * @return View of the translation; see lookup() for its lifetime
+     */
+    string_view i18n::_t(const Key key) const
+    {
+        if (!this->onOwnerThread()) {
+            return keepOnThread(this->threadSnapshot()._t(key));
+        }
+
+        return this->keyedTranslations[static_cast<size_t>(key)];
+    }
+
+    /**
+     * @brief Get a view of the translation of a compile-time key in any language
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * The current locale is served from the keyed array; any other language
+     * goes through the string lookup with the key's name.
+     *
+     * @param key Key ID generated from en_US.json
+     * @param language Specific language code (empty uses current locale)
+     *
+     * @return View of the translation, the fallback translation, or the key name
+     */
+    string_view i18n::lookup(const Key key, const string_view language) const
+    {
+        if (!this->onOwnerThread()) {
+            const CatalogueSnapshot &snapshot = this->threadSnapshot();
+            return keepOnThread((language.empty() || language == snapshot.getLocale())
+                                    ? snapshot._t(key)
+                                    : snapshot.lookup(keyName(key), language));
+        }
+
+        if (language.empty() || language == currentLocale.locale) {
+            return this->_t(key);
+        }
+
+        return this->lookup(keyName(key), language);
+    }
+
+    /**
+     * @brief Get a view of the translation for a key without copying it
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Walks the chain specified language → fallback language → key. Loaded
+     * catalogues already hold the fallback entries they lack, so one probe
+     * resolves both steps; the fallback catalogue is only searched for a
+     * language that is not loaded. The current and fallback catalogues are
+     * reached through cached pointers.
+     *
+     * @param translationKey The key to translate
+     * @param language Specific language code (empty uses current locale)
+     * @return View of the translation, the fallback translation, or translationKey itself
+     */
+    string_view i18n::lookup(const string_view translationKey, const string_view language) const
+    {
+        if (!this->onOwnerThread()) {
+            return keepOnThread(this->threadSnapshot().lookup(translationKey, language));
+        }
+
+        const TranslationMap *catalogue = this->catalogueFor(language);
+
+        // Return key as last resort
+        return (catalogue != nullptr) ? catalogue->find(translationKey).value_or(translationKey) : translationKey;
+    }
+
+    /**
+     * @brief Catalogue that answers lookups in a language
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Loaded catalogues already hold the fallback entries they lack, so the
+     * fallback catalogue is only returned for a language that is not loaded.
      *
-     * @see i18n::i18n
+     * @param language Language code (empty uses current locale)
+     * @return The catalogue to search, or nullptr when none is loaded
      */
-    string i18n::_t(const string &text) const
+    const TranslationMap *i18n::catalogueFor(const string_view language) const
     {
-        return this->translate(text, this->getCurrentLocale().locale);
+        const TranslationMap *target = this->currentCatalogue;
+        if (!language.empty() && language != currentLocale.locale) {
+            auto langIt = this->translations.find(language);
+            target = (langIt != this->translations.end()) ? &langIt->second : this->loadRegistered(language);
+        }
+
+        // Language not loaded: try fallback language
+        return (target != nullptr) ? target : this->fallbackCatalogue;
     }
 
     /**
@@ -572,41 +1228,22 @@ namespace ADS::i18n {
      */
     string i18n::translate(const string &translationKey, const string &language) const
     {
-        string targetLanguage = language.empty() ? currentLocale.locale : language;
-
-        // Try target language first
-        auto langIt = this->translations.find(targetLanguage);
-        if (langIt != this->translations.end()) {
-            auto transIt = langIt->second.find(translationKey);
-            if (transIt != langIt->second.end()) {
-                return transIt->second;
-            }
+        if (!this->onOwnerThread()) {
+            return string(this->threadSnapshot().lookup(translationKey, language));
         }
 
-        // Try fallback language
-        if (targetLanguage != fallbackLanguage) {
-            auto fallbackIt = this->translations.find(fallbackLanguage);
-            if (fallbackIt != this->translations.end()) {
-                auto transIt = fallbackIt->second.find(translationKey);
-                if (transIt != fallbackIt->second.end()) {
-                    return transIt->second;
-                }
-            }
-        }
-
-        // Return key as last resort
-        return translationKey;
+        return string(this->lookup(translationKey, language));
     }
 
     /**
      * @brief Get translation with pluralization support
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jul 2025
+     * @version Oct 2026
      *
-     * Returns appropriate singular or plural translation based on the count value.
-     * Uses language-specific pluralization rules where available, otherwise
-     * uses simple English pluralization (count == 1 for singular).
+     * Picks the singular key when the language's plural rule puts the count
+     * in the "one" category and the plural key otherwise, then looks up only
+     * that key. Languages with more than two forms should use lookupPlural().
      *
      * @param singularKey Translation key for singular form
      * @param pluralKey Translation key for plural form
@@ -618,12 +1255,87 @@ namespace ADS::i18n {
      */
     string i18n::translatePlural(const string &singularKey,
                                  const string &pluralKey,
-                                 int count,
+                                 const int count,
                                  const string &language) const
     {
-        // Simple English pluralization rules (can be extended for other languages)
-        string key = (count == 1) ? singularKey : pluralKey;
-        return translate(key, language);
+        const bool singular = this->pluralRuleOf(language)(count) == PluralCategory::One;
+
+        return translate(singular ? singularKey : pluralKey, language);
+    }
+
+    /**
+     * @brief Get the plural form of a translation for a count
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param translationKey Key holding the plural forms
+     * @param count Number that selects the form
+     * @param language Specific language code (empty uses current locale)
+     * @return Translated string in the form for count
+     */
+    string i18n::translatePlural(const string &translationKey, const int64_t count, const string &language) const
+    {
+        if (!this->onOwnerThread()) {
+            return string(this->threadSnapshot().lookupPlural(translationKey, count, language));
+        }
+
+        return string(this->lookupPlural(translationKey, count, language));
+    }
+
+    /**
+     * @brief Get a view of the plural form of a translation for a count
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * One call to the language's plural rule and one probe for
+     * "<key>.<category>"; "<key>.other" and then the plain key are only
+     * tried when that form is missing.
+     *
+     * @param translationKey Key holding the plural forms
+     * @param count Number that selects the form
+     * @param language Specific language code (empty uses current locale)
+     * @return View of the form, the plain translation of the key, or the key itself
+     */
+    string_view i18n::lookupPlural(const string_view translationKey, const int64_t count,
+                                   const string_view language) const
+    {
+        if (!this->onOwnerThread()) {
+            return keepOnThread(this->threadSnapshot().lookupPlural(translationKey, count, language));
+        }
+
+        const TranslationMap *catalogue = this->catalogueFor(language);
+        if (catalogue == nullptr) {
+            return translationKey;
+        }
+
+        if (auto form = catalogue->findPlural(translationKey, this->pluralRuleOf(language)(count))) {
+            return *form;
+        }
+
+        return catalogue->find(translationKey).value_or(translationKey);
+    }
+
+    /**
+     * @brief Plural rule for a language
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language Language code (empty uses current locale, whose rule is cached)
+     * @return The rule
+     */
+    PluralRule i18n::pluralRuleOf(const string_view language) const
+    {
+        if (!this->onOwnerThread()) {
+            const CatalogueSnapshot &snapshot = this->threadSnapshot();
+            return (language.empty() || language == snapshot.getLocale()) ? snapshot.pluralRule
+                                                                          : pluralRuleFor(language);
+        }
+
+        return (language.empty() || language == currentLocale.locale) ? this->currentPluralRule
+                                                                      : pluralRuleFor(language);
     }
 
     /**
@@ -643,27 +1355,57 @@ namespace ADS::i18n {
      * @return Translated string with parameters substituted
      *
      * @note Unmatched parameters in the translation are left unchanged
+     * @see formatTo() to format into a reused buffer without building a map
      * @example translate("hello.user", {{"name", "John"}}) → "Hello, John!"
      */
     string i18n::translateWithParams(const string &translationKey,
                                      const unordered_map<string, string> &parameters,
                                      const string &language) const
     {
-        string result = translate(translationKey, language);
-
-        // Replace parameters in format {param_name}
-        for (const pair<const string, string> &param: parameters) {
-            string placeholder = "{" + param.first + "}";
-            size_t pos = 0;
-            while ((pos = result.find(placeholder, pos)) != string::npos) {
-                result.replace(pos, placeholder.length(), param.second);
-                pos += param.second.length();
-            }
+        vector<FormatArg> args;
+        args.reserve(parameters.size());
+        for (const auto &[name, value]: parameters) {
+            args.push_back(arg(name, value));
         }
 
+        string result;
+        this->formatTo(result, translationKey, args, language);
+
         return result;
     }
 
+    /**
+     * @brief Append a translation in any language with its placeholders substituted
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param buffer Buffer the text is appended to
+     * @param translationKey The key to translate
+     * @param args Named values for the placeholders
+     * @param language Specific language code (empty uses current locale)
+     * @return View of the appended text
+     */
+    string_view i18n::formatTo(string &buffer,
+                               const string_view translationKey,
+                               const span<const FormatArg> args,
+                               const string_view language) const
+    {
+        // Other threads cannot share the template caches of the live catalogues
+        if (!this->onOwnerThread()) {
+            return this->threadSnapshot().formatTo(buffer, translationKey, args, language);
+        }
+
+        const size_t start = buffer.size();
+
+        const TranslationMap *catalogue = this->catalogueFor(language);
+        if (catalogue == nullptr || !catalogue->formatTo(buffer, translationKey, args)) {
+            MessageTemplate::format(buffer, translationKey, args);
+        }
+
+        return string_view(buffer).substr(start);
+    }
+
     /**
      * @brief Get all currently loaded/available language codes
      *
@@ -734,6 +1476,9 @@ namespace ADS::i18n {
      */
     size_t i18n::reloadTranslations()
     {
+        ADS::Core::TraceRecorder::Scope trace("i18n::reloadTranslations");
+        ADS_ZONE("i18n::reloadTranslations");
+        ADS::Core::AllocationCounter::Scope memory(ADS::Core::AllocationCounter::Tag::I18n);
         size_t reloadedCount = 0;
         vector<string> languagesToReload = getAvailableLanguages();
 
@@ -743,13 +1488,139 @@ namespace ADS::i18n {
                 reloadedCount++;
             } else {
                 // Re-add empty map if file doesn't exist
-                translations[lang] = unordered_map<string, string>();
+                translations[lang] = TranslationMap();
             }
         }
 
+        this->mergeFallback();
+        this->bindCatalogues();
+
         return reloadedCount;
     }
 
+    /**
+     * @brief Reload translation files in the background whenever they change on disk
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param interval Time between two checks of the files
+     */
+    void i18n::watchTranslations(const chrono::milliseconds interval)
+    {
+        this->stopWatching();
+
+        // readTranslationFile() only reads baseFolder, so it is safe on the watcher thread
+        this->watcher = make_unique<TranslationWatcher>(this->baseFolder, interval, [this](const string &language) {
+            TranslationMap catalogue;
+            if (!this->readTranslationFile(language, catalogue)) {
+                ADS_LOG_WARN(I18n, "Keeping the loaded {} translations: '{}' could not be reloaded",
+                             language, (this->baseFolder / (language + ".json")).string());
+                return;
+            }
+
+            lock_guard lock(this->reloadMutex);
+            this->reloadedCatalogues.emplace_back(language, std::move(catalogue));
+        });
+    }
+
+    /**
+     * @brief Stop reloading changed translation files
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     */
+    void i18n::stopWatching()
+    {
+        this->watcher.reset();
+    }
+
+    /**
+     * @brief Swap in the catalogues reloaded in the background and publish a new snapshot
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return Number of catalogues swapped in
+     */
+    size_t i18n::update()
+    {
+        vector<pair<string, TranslationMap>> reloaded;
+        {
+            lock_guard lock(this->reloadMutex);
+            reloaded.swap(this->reloadedCatalogues);
+        }
+
+        size_t swapped = 0;
+        bool fallbackChanged = false;
+        for (auto &[language, catalogue]: reloaded) {
+            // Languages unloaded or only registered meanwhile are read again when used
+            auto langIt = this->translations.find(language);
+            if (langIt == this->translations.end()) {
+                continue;
+            }
+
+            langIt->second = std::move(catalogue);
+            fallbackChanged |= (language == this->fallbackLanguage);
+            if (!fallbackChanged) {
+                this->mergeFallback(language);
+            }
+            swapped++;
+        }
+
+        if (swapped > 0) {
+            ADS_LOG_INFO(I18n, "Reloaded {} translation catalogue(s)", swapped);
+            if (fallbackChanged) {
+                this->mergeFallback();
+            }
+            this->bindCatalogues();
+        }
+
+        if (this->snapshotStale) {
+            this->publishSnapshot();
+        }
+
+        return swapped;
+    }
+
+    /**
+     * @brief Get the last published snapshot of the catalogues
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @return The snapshot; never null
+     */
+    shared_ptr<const CatalogueSnapshot> i18n::snapshot() const
+    {
+        return this->publishedSnapshot.load();
+    }
+
+    /**
+     * @brief Get the snapshot the calling thread reads translations from
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Stamps are unique across instances, so one slot per thread is enough
+     * even when a thread reads from several i18n objects. The slot is
+     * replaced on the thread's next call after a publication, so nothing
+     * read from it may outlive the call that read it.
+     *
+     * @return The thread's snapshot
+     */
+    const CatalogueSnapshot &i18n::threadSnapshot() const
+    {
+        thread_local shared_ptr<const CatalogueSnapshot> cached;
+
+        // Only re-read the shared pointer when a newer snapshot has been published
+        if (cached == nullptr || cached->stamp != this->publishedStamp.load(memory_order_acquire)) {
+            cached = this->publishedSnapshot.load();
+        }
+
+        return *cached;
+    }
+
     /**
      * @brief Save translation data to file in appropriate format
      *
@@ -778,13 +1649,13 @@ namespace ADS::i18n {
 
         if (useExisting) {
             filesystem::path filePath = this->baseFolder / (language + ".json");
-            spdlog::info(std::format("File {} exists", filePath.string()));
+            ADS_LOG_INFO(I18n, "File {} exists", filePath.string());
             // std::cout << "File " << filePath << " exists" << std::endl;
             try {
                 ofstream file(filePath, std::ios::trunc);
                 std::vector<std::string> languageParts;
                 string identifier = "";
-                spdlog::info(std::format("Language: {}", langIt->first));
+                ADS_LOG_INFO(I18n, "Language: {}", langIt->first);
                 // std::cout << "Language: " << langIt->first << std::endl << std::endl;
                 nlohmann::json data;
                 for (const auto &[lang, translations]: langIt->second) {
@@ -804,7 +1675,7 @@ namespace ADS::i18n {
 
                 return true;
             } catch (const std::ios_base::failure &e) {
-                spdlog::error(std::format("Caught an ios_base::failure.\nExplanatory string: {}\nError code: {}", e.what(), e.code().value()));
+                ADS_LOG_ERROR(I18n, "Caught an ios_base::failure.\nExplanatory string: {}\nError code: {}", e.what(), e.code().value());
                 // std::cout << "Caught an ios_base::failure.\n"
                 //         << "Explanatory string: " << e.what() << '\n'
                 //         << "Error code: " << e.code() << '\n';
@@ -814,6 +1685,32 @@ namespace ADS::i18n {
         return false;
     }
 
+    /**
+     * @brief Compile the JSON catalogue of a language into a .adsl file
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language Language code to compile
+     * @return Path of the written catalogue
+     *
+     * @throws translation_file_exception if the JSON file is missing or invalid
+     */
+    filesystem::path i18n::compileLanguage(const string &language) const
+    {
+        TranslationMap catalogue;
+        if (!this->readTranslationFile(language, catalogue, false)) {
+            throw translation_file_exception(std::format(
+                "Cannot compile {}: no valid {}.json in '{}'", language, language, this->baseFolder.string())
+            );
+        }
+
+        filesystem::path compiledPath = this->baseFolder / (language + string(CompiledCatalogue::EXTENSION));
+        CompiledCatalogue::write(catalogue, compiledPath);
+
+        return compiledPath;
+    }
+
     /**
      * @brief Get translation statistics for all loaded languages
      *
@@ -841,11 +1738,11 @@ namespace ADS::i18n {
      * @brief Find missing translation keys compared to fallback language
      *
      * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-     * @version Jul 2025
+     * @version Oct 2026
      *
-     * Compares the specified language's translations with the fallback
-     * language and returns a list of keys that exist in fallback but
-     * are missing in the target language.
+     * Reads the language's missing-key bitset, rebuilding it first only if
+     * the language or the fallback gained keys some other way than
+     * addTranslation().
      *
      * @param language Language code to check for missing translations
      * @return Vector of translation keys missing in the specified language
@@ -854,22 +1751,32 @@ namespace ADS::i18n {
      */
     vector<string> i18n::findMissingTranslations(const string &language) const
     {
-        vector<string> missing;
+        if (!this->onOwnerThread()) {
+            return this->threadSnapshot().coverage->missing(language);
+        }
 
-        auto fallbackIt = this->translations.find(fallbackLanguage);
-        auto targetIt = this->translations.find(language);
+        this->coverageIndex.refresh(this->translations, this->fallbackLanguage, language);
 
-        if (fallbackIt == this->translations.end() || targetIt == this->translations.end()) {
-            return missing;
-        }
+        return this->coverageIndex.missing(language);
+    }
 
-        for (const auto &fallbackTrans: fallbackIt->second) {
-            if (targetIt->second.find(fallbackTrans.first) == targetIt->second.end()) {
-                missing.push_back(fallbackTrans.first);
-            }
+    /**
+     * @brief Get how much of the fallback language a language translates
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * @param language Language code
+     * @return The coverage; empty if the language or the fallback is not loaded
+     */
+    TranslationCoverage i18n::getCoverage(const string_view language) const
+    {
+        if (!this->onOwnerThread()) {
+            return this->threadSnapshot().coverage->coverage(language);
         }
 
-        sort(missing.begin(), missing.end());
-        return missing;
+        this->coverageIndex.refresh(this->translations, this->fallbackLanguage, language);
+
+        return this->coverageIndex.coverage(language);
     }
 }
@@ -12,13 +12,31 @@
 #ifndef ADS_I18N_H
 #define ADS_I18N_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "base_exception.h"
 #include "languages.h"
+#include "CatalogueSnapshot.h"
+#include "PluralRules.h"
+#include "TranslationCoverage.h"
+#include "TranslationKeys.h"
+#include "TranslationMap.h"
+#include "TranslationWatcher.h"
 
 namespace ADS::i18n {
     using namespace std;
@@ -99,6 +117,16 @@ namespace ADS::i18n {
         }
     };
 
+    /**
+     * @enum LoadMode
+     * @brief When addLanguage() parses a catalogue
+     */
+    enum class LoadMode
+    {
+        Eager, ///< Parse every added language straight away
+        Lazy   ///< Only register it; parse on first setLocale() or lookup() in that language
+    };
+
     /**
      * @class i18n
      * @brief Main internationalization class for translation management
@@ -113,6 +141,15 @@ namespace ADS::i18n {
      * - Pluralization and parameter substitution
      * - Fallback language support
      * - Translation statistics and validation
+     *
+     * The object belongs to the thread that constructs it. lookup(), _t(),
+     * lookupPlural(), translate(), formatTo() and the coverage queries may
+     * also be called from any other thread: there they read the last
+     * published CatalogueSnapshot instead of the live catalogues, and the
+     * views they return point to copies kept by the calling thread.
+     * A worker that reads many translations should hold snapshot() and read
+     * through it instead. Every other member must be called from the owning
+     * thread.
      */
     class i18n
     {
@@ -121,7 +158,46 @@ namespace ADS::i18n {
          * Translations storage.
          * Stores translations under the language identifier like es_ES
          */
-        unordered_map<string, unordered_map<string, string> > translations;
+        mutable unordered_map<string, TranslationMap, TranslationKeyHash, equal_to<> > translations;
+
+        /**
+         * Languages added in LoadMode::Lazy whose file has not been parsed yet.
+         * translations and this set are mutable because a const lookup() in
+         * such a language loads it on demand.
+         */
+        mutable unordered_set<string, TranslationKeyHash, equal_to<> > registeredLanguages;
+
+        /**
+         * Whether addLanguage() parses or only registers non-active languages
+         */
+        LoadMode loadMode = LoadMode::Eager;
+
+        /**
+         * Catalogue of the current locale, or nullptr if it is not loaded.
+         * Points into translations, whose nodes never move; see bindCatalogues()
+         */
+        const TranslationMap *currentCatalogue = nullptr;
+
+        /**
+         * Catalogue of the fallback language, or nullptr if it is not loaded
+         */
+        const TranslationMap *fallbackCatalogue = nullptr;
+
+        /**
+         * Translation of every Key in the current locale, fallback and key
+         * already applied, indexed by the Key value. Rebuilt by bindCatalogues()
+         */
+        array<string_view, KEY_COUNT> keyedTranslations{};
+
+        /**
+         * Plural rule of the current locale. Rebuilt by bindCatalogues()
+         */
+        PluralRule currentPluralRule = pluralRuleFor({});
+
+        /**
+         * Incremented by bindCatalogues(); see getRevision()
+         */
+        uint64_t keyedRevision = 0;
 
         /**
          * Current system locale information
@@ -153,6 +229,50 @@ namespace ADS::i18n {
          */
         string fallbackLanguage;
 
+        /**
+         * Missing keys of every loaded language. Mutable because queries
+         * rebuild the entries of catalogues changed since the last one
+         */
+        mutable CoverageIndex coverageIndex;
+
+        /**
+         * Set when the catalogues differ from the published snapshot; mutable
+         * because a const lookup() may load a registered language
+         */
+        mutable bool snapshotStale = true;
+
+        /**
+         * Last published snapshot; see snapshot()
+         */
+        atomic<shared_ptr<const CatalogueSnapshot>> publishedSnapshot;
+
+        /**
+         * Stamp of publishedSnapshot, stored after it so that threads can tell
+         * their cached snapshot is current without touching the shared_ptr
+         */
+        atomic<uint64_t> publishedStamp = 0;
+
+        /**
+         * Thread that constructed the object and may modify it
+         */
+        thread::id ownerThread = this_thread::get_id();
+
+        /**
+         * Guards reloadedCatalogues, shared with the watcher thread
+         */
+        mutex reloadMutex;
+
+        /**
+         * Catalogues parsed in the background, waiting for update() to swap them in
+         */
+        vector<pair<string, TranslationMap>> reloadedCatalogues;
+
+        /**
+         * Watches the translation files while hot reload is on. Declared last so
+         * its thread stops before the members its callback uses are destroyed
+         */
+        unique_ptr<TranslationWatcher> watcher;
+
         /**
          * @brief Initialize the internationalization system
          *
@@ -168,6 +288,126 @@ namespace ADS::i18n {
          */
         void init();
 
+        /**
+         * @brief Refresh the cached current and fallback catalogue pointers
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Must be called whenever a language is added to or removed from
+         * translations, a translation is added, or the current locale changes,
+         * so lookup() can skip the per-language map for the two catalogues it
+         * hits every frame and _t(Key) stays a plain array index.
+         */
+        void bindCatalogues();
+
+        /**
+         * @brief Publish an immutable copy of the catalogues for other threads
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Catalogues whose revision matches the previous snapshot are shared
+         * with it; only the changed ones are copied.
+         */
+        void publishSnapshot();
+
+        /**
+         * @brief Check whether the calling thread owns the live catalogues
+         */
+        [[nodiscard]] bool onOwnerThread() const { return this_thread::get_id() == ownerThread; }
+
+        /**
+         * @brief Get the snapshot the calling thread reads translations from
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Each thread keeps the last snapshot it used and only takes a new
+         * one after update() has published another, which it notices with a
+         * single atomic load; no lock is taken. Calls made off the owning
+         * thread go through it and copy what they return out of it.
+         *
+         * @return The thread's snapshot, valid until the thread's next call
+         */
+        [[nodiscard]] const CatalogueSnapshot &threadSnapshot() const;
+
+        /**
+         * @brief Plural rule for a language
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param language Language code (empty uses current locale, whose rule is cached)
+         * @return The rule
+         */
+        [[nodiscard]] PluralRule pluralRuleOf(string_view language) const;
+
+        /**
+         * @brief Merge the fallback catalogue into one language, or all of them
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Each catalogue inherits the fallback entries it lacks, flagged as
+         * inherited, so a lookup resolves in one probe. Merging the fallback
+         * language itself, or an empty language, refreshes every catalogue.
+         *
+         * @param language Language to merge; empty or the fallback merges all
+         */
+        void mergeFallback(const string &language = "");
+
+        /**
+         * @brief Pass a new or changed fallback translation on to every other catalogue
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param key Translation key
+         * @param translation Translation in the fallback language
+         */
+        void inheritFallback(const string &key, const string &translation);
+
+        /**
+         * @brief Load a language now, whatever the load mode
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reads the language's file, or creates an empty catalogue if there is
+         * none, merges the fallback into it and rebinds the catalogue pointers.
+         *
+         * @param language Supported language code
+         * @return Pointer to the language translation entry
+         */
+        pair<const string, TranslationMap> *loadLanguage(const string &language);
+
+        /**
+         * @brief Parse a language registered in LoadMode::Lazy on its first use
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Inserting into translations neither moves the other catalogues nor
+         * their strings, so views handed out earlier stay valid.
+         *
+         * @param language Language code to look up
+         * @return The catalogue, or nullptr if the language was not registered
+         */
+        const TranslationMap *loadRegistered(string_view language) const;
+
+        /**
+         * @brief Catalogue that answers lookups in a language
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param language Language code (empty uses current locale)
+         * @return The language's catalogue, loading it if registered, else the
+         *         fallback catalogue, or nullptr when neither is loaded
+         */
+        const TranslationMap *catalogueFor(string_view language) const;
+
         /**
          * @brief Extract and normalize system locale information
          *
@@ -201,6 +441,38 @@ namespace ADS::i18n {
          */
         bool loadTranslationFile(const string &language);
 
+        /**
+         * @brief Read and parse the translation file of a language without storing it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Touches no member besides baseFolder, so several languages can be
+         * read at once from worker threads (see addLanguages()). A compiled
+         * .adsl catalogue is mapped instead of parsing the JSON file when it
+         * is at least as recent as the JSON file.
+         *
+         * @param language The language code to read (e.g., "es_ES")
+         * @param catalogue Output catalogue filled with the parsed entries
+         * @param useCompiled false always parses the JSON file
+         * @return true if the file exists and was parsed, false otherwise
+         *
+         * @note Parse and I/O errors are logged and reported as false
+         */
+        bool readTranslationFile(const string &language, TranslationMap &catalogue, bool useCompiled = true) const;
+
+        /**
+         * @brief Map the compiled catalogue of a language if it is up to date
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param language The language code to read (e.g., "es_ES")
+         * @param catalogue Output catalogue backed by the mapped file
+         * @return true if the .adsl file was mapped, false if missing, stale or invalid
+         */
+        bool readCompiledFile(const string &language, TranslationMap &catalogue) const;
+
         /**
          * @brief Parse JSON format translation file content
          *
@@ -222,8 +494,8 @@ namespace ADS::i18n {
          */
         bool parseJsonContent(const string &key,
                               const string &content,
-                              unordered_map<string, string> &translations,
-                              const string &file_path = "");
+                              TranslationMap &translations,
+                              const string &file_path = "") const;
 
         /**
          * @brief Create LocaleInfo structure from language code
@@ -300,9 +572,10 @@ namespace ADS::i18n {
 
         i18n &operator=(const i18n &) = delete;
 
-        i18n(i18n &&) = default;
+        // Not movable: the watcher thread and published snapshots refer to this instance
+        i18n(i18n &&) = delete;
 
-        i18n &operator=(i18n &&) = default;
+        i18n &operator=(i18n &&) = delete;
 
         /**
          * @brief Set the current active locale using LocaleInfo
@@ -350,6 +623,20 @@ namespace ADS::i18n {
          */
         [[nodiscard]] LocaleInfo getCurrentLocale() const;
 
+        /**
+         * @brief Get a number that changes whenever translations may have
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Bumped on every locale change, reload or added translation, so a
+         * caller keeping strings built from _t(Key) rebuilds them only when
+         * this differs from the value it saw last.
+         *
+         * @return uint64_t Current revision
+         */
+        [[nodiscard]] uint64_t getRevision() const;
+
         /**
          * @brief Get all translation key-value pairs for a language
          *
@@ -379,7 +666,7 @@ namespace ADS::i18n {
          *
          * @note The returned pointer is valid until translations are modified
          */
-        [[nodiscard]] const pair<const string, unordered_map<string, string> > *getFallbackLanguageTranslations() const;
+        [[nodiscard]] const pair<const string, TranslationMap> *getFallbackLanguageTranslations() const;
 
         /**
          * @brief Get pointer to specific language translation data
@@ -395,7 +682,7 @@ namespace ADS::i18n {
          *
          * @note The returned pointer is valid until translations are modified
          */
-        [[nodiscard]] const pair<const string, unordered_map<string, string> > *getLanguage(const string &language) const;
+        [[nodiscard]] const pair<const string, TranslationMap> *getLanguage(const string &language) const;
 
         /**
          * @brief Check if a language is currently loaded
@@ -421,15 +708,86 @@ namespace ADS::i18n {
          * an empty translation set if no file exists. Validates language support
          * and handles duplicate loading attempts.
          *
+         * In LoadMode::Lazy a language other than the current locale and the
+         * fallback is only registered; it is parsed when it is first needed.
+         *
          * @param language The language code to add/load
-         * @return Pointer to the language translation entry
+         * @return Pointer to the language translation entry, or nullptr if it was only registered
          *
          * @throws std::invalid_argument if language is not supported
          * @throws std::runtime_error if language cannot be loaded
          *
          * @see loadTranslationFile(), Constants::Languages::isLanguageSupported()
          */
-        pair<const string, unordered_map<string, string> > *addLanguage(const string &language);
+        pair<const string, TranslationMap> *addLanguage(const string &language);
+
+        /**
+         * @brief Load several languages concurrently
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reads and parses the files of every language not loaded yet on a
+         * pool of worker threads, then publishes all the catalogues at once
+         * from the calling thread and merges the fallback language into them.
+         * Languages without a file get an empty catalogue, as with addLanguage().
+         *
+         * @param languages Language codes to load; duplicates and loaded ones are skipped
+         * @return Number of languages loaded from a file
+         *
+         * @throws locale_exception if any language is not supported; nothing is loaded then
+         *
+         * @see addLanguage(), readTranslationFile()
+         */
+        size_t addLanguages(const vector<string> &languages);
+
+        /**
+         * @brief Choose whether languages are parsed when added or on first use
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Only affects languages added afterwards.
+         *
+         * @param mode LoadMode::Eager (default) or LoadMode::Lazy
+         */
+        void setLoadMode(LoadMode mode);
+
+        /**
+         * @brief Make the calling thread the owner of the object
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * For an object built and loaded by a job: once the job is done, the
+         * thread that waited for it takes the live catalogues over. The
+         * previous owner may then only make the calls allowed from any thread.
+         */
+        void takeOwnership();
+
+        /**
+         * @brief Check if a language is loaded or registered for lazy loading
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param language The language code to check
+         * @return true if the language is loaded or will be on first use
+         */
+        [[nodiscard]] bool isLanguageKnown(const string &language) const;
+
+        /**
+         * @brief Unload every catalogue but the current locale and the fallback
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The unloaded languages stay registered and are parsed again on their
+         * next use. Views obtained from lookup() in those languages become invalid.
+         *
+         * @return Number of catalogues unloaded
+         */
+        size_t unloadUnusedLanguages();
 
         /**
          * @brief Add a translation key-value pair to the system
@@ -454,29 +812,85 @@ namespace ADS::i18n {
                             const string &fallbackTranslation = "");
 
 
+        /**
+         * @brief Get a view of the translation for a key without copying it
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Same fallback chain as translate(), but the result points into the
+         * loaded catalogue instead of being copied, so per-frame UI lookups do
+         * not allocate. Catalogue values are std::string, hence the view's
+         * data() is always null-terminated and can be handed to ImGui.
+         *
+         * @param translationKey The key to translate
+         * @param language Specific language code (empty uses current locale)
+         * @return View of the translation, the fallback translation, or translationKey itself
+         *
+         * @note The view stays valid until the catalogues are modified (addTranslation,
+         *       addLanguage, reloadTranslations). When the key itself is returned it
+         *       shares the caller's storage, so pass literals or long-lived strings.
+         *       Off the owning thread the view points to a copy kept for the life of
+         *       the calling thread, whatever update() does meanwhile.
+         */
+        [[nodiscard]] string_view lookup(string_view translationKey,
+                                         string_view language = {}) const;
+
         /**
          * @brief Return the translations for the text on selected language
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
          * @version Nov 2025
          *
+         * Shortcut to lookup() for the current locale.
+         *
          * @param text          Key to translate. It must exist in translations
          *
-         * @return Reference to the i18n translations instance
+         * @return View of the translation; see lookup() for its lifetime
+         *
+         * @see i18n::lookup
+         */
+        [[nodiscard]] string_view _t(string_view text) const;
+
+        /**
+         * @brief Return the translation of a compile-time key on the current locale
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Keys are generated from the reference catalogue at build time, so a
+         * misspelt or removed key does not compile. The lookup is an index into
+         * an array resolved when the locale or catalogues change; no hashing.
+         *
+         * @param key Key ID generated from en_US.json
+         *
+         * @return View of the translation; see lookup() for its lifetime
+         */
+        [[nodiscard]] string_view _t(Key key) const;
+
+        /**
+         * @brief Get a view of the translation of a compile-time key in any language
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param key Key ID generated from en_US.json
+         * @param language Specific language code (empty uses current locale)
          *
-         * @see i18n::i18n
+         * @return View of the translation, the fallback translation, or the key name
          */
-        string _t(const string &text) const;
+        [[nodiscard]] string_view lookup(Key key, string_view language = {}) const;
 
         /**
          * @brief Get translation with pluralization support
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jul 2025
+         * @version Oct 2026
          *
-         * Returns appropriate singular or plural translation based on the count value.
-         * Uses language-specific pluralization rules where available, otherwise
-         * uses simple English pluralization (count == 1 for singular).
+         * Picks the singular key when the language's plural rule puts the count
+         * in the "one" category and the plural key otherwise, then looks up only
+         * that key. Languages with more than two forms, such as Russian or
+         * Polish, need the forms of translatePlural(const string &, int64_t, const string &).
          *
          * @param singularKey Translation key for singular form
          * @param pluralKey Translation key for plural form
@@ -491,6 +905,45 @@ namespace ADS::i18n {
                                              int count,
                                              const string &language = "") const;
 
+        /**
+         * @brief Get the plural form of a translation for a count
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @see lookupPlural()
+         */
+        [[nodiscard]] string translatePlural(const string &translationKey,
+                                             int64_t count,
+                                             const string &language = "") const;
+
+        /**
+         * @brief Get a view of the plural form of a translation for a count
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * The forms are stored by CLDR category under the key:
+         *
+         * @code
+         * "files": {"one": "{count} файл", "few": "{count} файла", "many": "{count} файлов"}
+         * @endcode
+         *
+         * The language's plural rule picks the category, resolved once per
+         * locale, and the form is fetched with a single probe. A missing form
+         * falls back to "other", and a key without forms to its plain
+         * translation.
+         *
+         * @param translationKey Key holding the plural forms
+         * @param count Number that selects the form
+         * @param language Specific language code (empty uses current locale)
+         * @return View of the form, the plain translation of the key, or the key itself;
+         *         see lookup() for its lifetime
+         */
+        [[nodiscard]] string_view lookupPlural(string_view translationKey,
+                                               int64_t count,
+                                               string_view language = {}) const;
+
         /**
          * @brief Get translation with parameter substitution
          *
@@ -508,12 +961,73 @@ namespace ADS::i18n {
          * @return Translated string with parameters substituted
          *
          * @note Unmatched parameters in the translation are left unchanged
+         * @see formatTo() to format into a reused buffer without building a map
          * @example translate("hello.user", {{"name", "John"}}) → "Hello, John!"
          */
         [[nodiscard]] string translateWithParams(const string &translationKey,
                                                  const unordered_map<string, string> &parameters,
                                                  const string &language = "") const;
 
+        /**
+         * @brief Append a translation with its placeholders substituted to a buffer
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Each translation is tokenised once, on its first use, and then
+         * formatted in a single pass straight into the buffer. Values are
+         * given fmt-style with arg(), so no map is built per call:
+         *
+         * @code
+         * string buffer;
+         * tm->formatTo(buffer, Key::VALIDATION_SUMMARY, arg("errors", 2), arg("warnings", 1));
+         * @endcode
+         *
+         * @param buffer Buffer the text is appended to; reuse it to avoid allocations
+         * @param translationKey The key to translate
+         * @param args Named values created with arg()
+         * @return View of the appended text, which ends at the buffer's NUL terminator
+         *
+         * @note A missing key is formatted as if it were its own translation
+         */
+        template<same_as<FormatArg>... Args>
+        string_view formatTo(string &buffer, const string_view translationKey, const Args &...args) const
+        {
+            const array<FormatArg, sizeof...(Args)> erased = {args...};
+            return this->formatTo(buffer, translationKey, span<const FormatArg>(erased), {});
+        }
+
+        /**
+         * @brief Append the translation of a compile-time key with its placeholders substituted
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @see formatTo(string &, string_view, const Args &...)
+         */
+        template<same_as<FormatArg>... Args>
+        string_view formatTo(string &buffer, const Key key, const Args &...args) const
+        {
+            return this->formatTo(buffer, keyName(key), args...);
+        }
+
+        /**
+         * @brief Append a translation in any language with its placeholders substituted
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * @param buffer Buffer the text is appended to
+         * @param translationKey The key to translate
+         * @param args Named values for the placeholders
+         * @param language Specific language code (empty uses current locale)
+         * @return View of the appended text
+         */
+        string_view formatTo(string &buffer,
+                             string_view translationKey,
+                             span<const FormatArg> args,
+                             string_view language) const;
+
         /**
          * @brief Get all currently loaded/available language codes
          *
@@ -559,6 +1073,59 @@ namespace ADS::i18n {
          */
         size_t reloadTranslations();
 
+        /**
+         * @brief Reload translation files in the background whenever they change on disk
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * A watcher thread parses each changed <language>.json of a loaded
+         * language as soon as the file settles; update() then swaps the new
+         * catalogue in. Parsing never blocks the thread that owns the
+         * catalogues, and a file that fails to parse keeps the old catalogue.
+         *
+         * @param interval Time between two checks of the files
+         */
+        void watchTranslations(chrono::milliseconds interval = chrono::milliseconds(500));
+
+        /**
+         * @brief Stop reloading changed translation files
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         */
+        void stopWatching();
+
+        /**
+         * @brief Swap in the catalogues reloaded in the background and publish a new snapshot
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Call it once per frame from the thread that owns this object, where
+         * no view handed out by lookup() or _t() is still in use: views into a
+         * replaced catalogue become invalid. Then, if anything changed since
+         * the last snapshot, a new one is published for the other threads.
+         *
+         * @return Number of catalogues swapped in
+         */
+        size_t update();
+
+        /**
+         * @brief Get the last published snapshot of the catalogues
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Safe to call from any thread. The snapshot never changes, so holding
+         * it keeps its catalogues and every view taken from it alive; take a
+         * new one to see later changes. Changes made on the owning thread are
+         * published by the next update().
+         *
+         * @return The snapshot; never null
+         */
+        [[nodiscard]] shared_ptr<const CatalogueSnapshot> snapshot() const;
+
         /**
          * @brief Save translation data to file in appropriate format
          *
@@ -579,6 +1146,25 @@ namespace ADS::i18n {
          */
         bool saveTranslations(const string &language, const bool &useExisting = false) const;
 
+        /**
+         * @brief Compile the JSON catalogue of a language into a .adsl file
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Parses <language>.json from the base folder and writes
+         * <language>.adsl next to it, which later loads map instead of
+         * parsing. The JSON file stays the editable source: a compiled file
+         * older than it is ignored until it is compiled again.
+         *
+         * @param language Language code to compile
+         * @return Path of the written catalogue
+         *
+         * @throws translation_file_exception if the JSON file is missing or invalid
+         * @see CompiledCatalogue
+         */
+        filesystem::path compileLanguage(const string &language) const;
+
         /**
          * @brief Get translation statistics for all loaded languages
          *
@@ -597,18 +1183,35 @@ namespace ADS::i18n {
          * @brief Find missing translation keys compared to fallback language
          *
          * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
-         * @version Jul 2025
+         * @version Oct 2026
          *
          * Compares the specified language's translations with the fallback
          * language and returns a list of keys that exist in fallback but
-         * are missing in the target language.
+         * are missing in the target language. Each language keeps a bitset
+         * of its missing keys, updated by addTranslation() and rebuilt only
+         * after the catalogue or the fallback was reloaded, so this is a
+         * scan of the set bits.
          *
          * @param language Language code to check for missing translations
-         * @return Vector of translation keys missing in the specified language
+         * @return Vector of translation keys missing in the specified language, sorted
          *
          * @note Useful for identifying incomplete translations during development
          */
         [[nodiscard]] vector<string> findMissingTranslations(const string &language) const;
+
+        /**
+         * @brief Get how much of the fallback language a language translates
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Reads counters kept with the missing-key bitsets; constant time
+         * unless the catalogues changed since the last query.
+         *
+         * @param language Language code
+         * @return The coverage; empty if the language or the fallback is not loaded
+         */
+        [[nodiscard]] TranslationCoverage getCoverage(string_view language) const;
     };
 
     /**
@@ -47,6 +47,27 @@ namespace ADS::Constants {
          */
         static constexpr auto CONFIG_FILE = "imgui.ini";
 
+        /**
+         * Directory holding decoded images between runs, named by content hash.
+         */
+        static constexpr auto ASSET_CACHE_DIR = "cache/assets";
+
+        /**
+         * Directory holding built font atlases between runs, named by a hash of their inputs.
+         */
+        static constexpr auto FONT_CACHE_DIR = "cache/fonts";
+
+        /**
+         * ImGui ids of the docked panels. A panel label is its translated
+         * title followed by one of these, so the window, and the saved dock
+         * layout, keep their identity whatever the language.
+         */
+        static constexpr auto ENTITIES_WINDOW_ID = "###hEntities";
+        static constexpr auto INSPECTOR_WINDOW_ID = "###hInspector";
+        static constexpr auto WORKING_AREA_WINDOW_ID = "###hWorkingArea";
+        static constexpr auto VALIDATION_WINDOW_ID = "###hValidation";
+        static constexpr auto WATCH_WINDOW_ID = "###hWatch";
+
         /**
          * Default main window width in pixels.
          */
@@ -100,6 +121,52 @@ namespace ADS::Constants {
 
         static constexpr float DEFULT_TEXT_SPACER = 10.0f;
 
+        /**
+         * Width in pixels of the save progress bar shown in the status bar.
+         */
+        static constexpr float STATUS_PROGRESS_WIDTH = 160.0f;
+
+        /**
+         * Seconds a transient status bar message stays visible.
+         */
+        static constexpr double STATUS_MESSAGE_SECONDS = 4.0;
+
+        /**
+         * Frames still rendered after the last event before the idle loop
+         * waits again, so ImGui can settle hover states and layout.
+         */
+        static constexpr int IDLE_SETTLE_FRAMES = 3;
+
+        /**
+         * Milliseconds the idle loop waits for an event before rendering
+         * anyway, which keeps autosave and status message timers running.
+         */
+        static constexpr int IDLE_WAIT_MS = 500;
+
+        /**
+         * Milliseconds the idle loop waits while a text field has focus, so
+         * the caret keeps blinking.
+         */
+        static constexpr int IDLE_TEXT_INPUT_WAIT_MS = 100;
+
+        /**
+         * Most frames per second drawn for a detached panel window that
+         * changed while neither focused nor hovered.
+         */
+        static constexpr int UNFOCUSED_VIEWPORT_FPS = 10;
+
+        /**
+         * Microseconds per frame spent running jobs posted to the main
+         * thread; the rest wait for the next frame.
+         */
+        static constexpr int MAIN_THREAD_JOB_BUDGET_US = 4000;
+
+        /**
+         * Seconds a document tab stays in the background before its editor
+         * is dropped and only its text is kept.
+         */
+        static constexpr double DOCUMENT_PARK_SECONDS = 120.0;
+
         // #ifdef _WIN32
         //         static constexpr char DIRECTORY_SEPARATOR = std::string("\\");
         // #else
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -204,6 +206,95 @@ namespace ADS::Constants::Languages {
                 {ROMANIAN_ROMANIA, "Română (România)"},
             });
 
+    /**
+     * @brief Metadata of a supported locale, split once at compile time
+     */
+    struct LocaleEntry {
+        std::string_view code;       // POSIX code (e.g., "es_ES")
+        std::string_view name;       // Full name (e.g., "Español (España)")
+        std::string_view language;   // Language part (e.g., "es")
+        std::string_view country;    // Country part (e.g., "ES")
+    };
+
+    namespace Detail {
+        // Slots of the perfect-hash table; a power of two well above the locale count
+        constexpr std::size_t LOCALE_SLOTS = 256;
+        constexpr std::uint8_t EMPTY_SLOT = 0xFF;
+
+        static_assert(languages.size() < EMPTY_SLOT, "Locale indexes no longer fit the slot type");
+
+        constexpr std::uint32_t hashLocale(const std::string_view code, const std::uint32_t seed) {
+            // FNV-1a with a seed, so a collision-free one can be searched for
+            std::uint32_t hash = 2166136261u ^ seed;
+            for (const char c : code) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+            }
+            return hash ^ (hash >> 15);
+        }
+
+        constexpr auto buildLocaleEntries() {
+            std::array<LocaleEntry, languages.size()> entries{};
+            for (std::size_t i = 0; i < languages.size(); ++i) {
+                const std::string_view code = languages[i].first;
+                const std::size_t separator = code.find('_');
+                entries[i] = {code, languages[i].second, code.substr(0, separator), code.substr(separator + 1)};
+            }
+            return entries;
+        }
+
+        // First seed under which no two locale codes share a slot
+        consteval std::uint32_t findLocaleSeed() {
+            for (std::uint32_t seed = 0;; ++seed) {
+                std::array<bool, LOCALE_SLOTS> used{};
+                bool collision = false;
+                for (const auto &[code, name] : languages) {
+                    bool &slot = used[hashLocale(code, seed) % LOCALE_SLOTS];
+                    collision = collision || slot;
+                    slot = true;
+                }
+                if (!collision) {
+                    return seed;
+                }
+            }
+        }
+
+        constexpr std::uint32_t LOCALE_SEED = findLocaleSeed();
+
+        constexpr auto buildLocaleSlots() {
+            std::array<std::uint8_t, LOCALE_SLOTS> slots{};
+            slots.fill(EMPTY_SLOT);
+            for (std::size_t i = 0; i < languages.size(); ++i) {
+                slots[hashLocale(languages[i].first, LOCALE_SEED) % LOCALE_SLOTS] = static_cast<std::uint8_t>(i);
+            }
+            return slots;
+        }
+
+        constexpr auto localeEntries = buildLocaleEntries();
+        constexpr auto localeSlots = buildLocaleSlots();
+    }
+
+    /**
+     * @brief Finds the metadata of a supported POSIX locale code
+     *
+     * One hash and one comparison: the table is a perfect hash over every
+     * code in languages, built at compile time. Platform-specific names are
+     * not recognised; see getLanguageName() for those.
+     *
+     * @param code The POSIX locale code (e.g., "es_ES")
+     *
+     * @return The locale's metadata, or nullptr if the code is not supported
+     */
+    [[nodiscard]] constexpr const LocaleEntry *findLocale(const std::string_view code) {
+        const std::uint8_t index = Detail::localeSlots[Detail::hashLocale(code, Detail::LOCALE_SEED) % Detail::LOCALE_SLOTS];
+        if (index == Detail::EMPTY_SLOT || Detail::localeEntries[index].code != code) {
+            return nullptr;
+        }
+        return &Detail::localeEntries[index];
+    }
+
+    static_assert(findLocale(RUSSIAN_RUSSIA) != nullptr && findLocale(RUSSIAN_RUSSIA)->country == "RU");
+    static_assert(findLocale("xx_XX") == nullptr);
+
 #ifdef _WIN32
     // WIN32 to POSIX locale mapping
     const std::unordered_map<std::string_view, std::string_view> win32ToPosixMap = {
@@ -314,12 +405,7 @@ namespace ADS::Constants::Languages {
 #else
         // Unix/Linux/macOS: assume already in POSIX format
         // Just validate it exists in our supported languages
-        auto langIt = std::find_if(languages.cbegin(), languages.cend(),
-                                   [baseName](const auto &pair) {
-                                       return pair.first == baseName;
-                                   });
-
-        if (langIt != languages.cend()) {
+        if (findLocale(baseName) != nullptr) {
             return std::string(baseName);
         }
 
@@ -341,28 +427,14 @@ namespace ADS::Constants::Languages {
      */
     [[nodiscard]] inline std::string getLanguageName(const std::string_view code) {
         // First try direct lookup
-        auto it = std::find_if(
-            languages.cbegin(),
-            languages.cend(),
-            [code](const auto &pair) {
-                return pair.first == code;
-            });
-
-        if (it != languages.cend()) {
-            return std::string(it->second);
+        if (const LocaleEntry *entry = findLocale(code)) {
+            return std::string(entry->name);
         }
 
         // Try normalizing the locale first
         std::string normalizedCode = normalizePlatformLocale(code);
-        if (!normalizedCode.empty()) {
-            auto normalizedIt = std::find_if(languages.cbegin(), languages.cend(),
-                                             [normalizedCode](const auto &pair) {
-                                                 return pair.first == normalizedCode;
-                                             });
-
-            if (normalizedIt != languages.cend()) {
-                return std::string(normalizedIt->second);
-            }
+        if (const LocaleEntry *entry = findLocale(normalizedCode)) {
+            return std::string(entry->name);
         }
 
         return {}; // Not found
@@ -370,11 +442,15 @@ namespace ADS::Constants::Languages {
 
     /**
      * @brief Checks if a language code is supported
+     *
+     * POSIX codes are answered from the perfect-hash table without building
+     * any string; only platform-specific names go through normalisation.
+     *
      * @param code The language code to check
      * @return true if supported, false otherwise
      */
     [[nodiscard]] inline bool isLanguageSupported(const std::string_view code) {
-        return !getLanguageName(code).empty();
+        return findLocale(code) != nullptr || !normalizePlatformLocale(code).empty();
     }
 
     /**
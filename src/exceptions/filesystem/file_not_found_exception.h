@@ -9,8 +9,8 @@
  * The original author's name must be displayed in any user interface or
  * promotional material.
  */
-#ifndef ADS_FILE_NOT_OPEN_EXCEPTION_H
-#define ADS_FILE_NOT_OPEN_EXCEPTION_H
+#ifndef ADS_FILE_NOT_FOUND_EXCEPTION_H
+#define ADS_FILE_NOT_FOUND_EXCEPTION_H
 #include <utility>
 #include "../base_exception.h"
 
@@ -47,4 +47,4 @@ namespace ADS::Exceptions {
     };
 } // ADS::Exceptions
 
-#endif //ADS_FILE_NOT_OPEN_EXCEPTION_H
+#endif //ADS_FILE_NOT_FOUND_EXCEPTION_H
@@ -0,0 +1,52 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_PROJECT_FORMAT_EXCEPTION_H
+#define ADS_PROJECT_FORMAT_EXCEPTION_H
+#include <string>
+#include <utility>
+#include "../base_exception.h"
+
+namespace ADS::Exceptions {
+    /**
+     * @brief Exception thrown when a project file is malformed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Raised by the project readers when a file has the wrong magic number,
+     * an unsupported version, or offsets and lengths that point outside the
+     * file. The message describes which structure failed validation.
+     *
+     * @note Inherits from BaseException for automatic file/line tracking
+     * @see BaseException
+     */
+    class project_format_exception final : public BaseException {
+    public:
+        /**
+         * @brief Construct project format exception
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Creates an exception indicating a project file could not be decoded.
+         *
+         * @param msg Description of the structure that failed validation
+         * @param file Source file where exception occurred (auto-captured)
+         * @param line Line number where exception occurred (auto-captured)
+         */
+        explicit project_format_exception(const std::string &msg, std::string file = __FILE__, const int line = __LINE__):
+            BaseException(msg, std::move(file), line) {}
+    };
+} // ADS::Exceptions
+
+#endif //ADS_PROJECT_FORMAT_EXCEPTION_H
@@ -0,0 +1,52 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+#ifndef ADS_BYTECODE_EXCEPTION_H
+#define ADS_BYTECODE_EXCEPTION_H
+#include <string>
+#include <utility>
+#include "../base_exception.h"
+
+namespace ADS::Exceptions {
+    /**
+     * @brief Exception thrown when runtime bytecode is malformed
+     *
+     * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+     * @version Oct 2026
+     *
+     * Raised by Runtime::ProgramBuilder when an instruction names a register,
+     * table slot or jump target that does not exist, or a function falls off
+     * its end. The message names the function and instruction.
+     *
+     * @note Inherits from BaseException for automatic file/line tracking
+     * @see BaseException
+     */
+    class bytecode_exception final : public BaseException {
+    public:
+        /**
+         * @brief Construct bytecode exception
+         *
+         * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+         * @version Oct 2026
+         *
+         * Creates an exception indicating a program could not be built.
+         *
+         * @param msg Description of the instruction that failed validation
+         * @param file Source file where exception occurred (auto-captured)
+         * @param line Line number where exception occurred (auto-captured)
+         */
+        explicit bytecode_exception(const std::string &msg, std::string file = __FILE__, const int line = __LINE__):
+            BaseException(msg, std::move(file), line) {}
+    };
+} // ADS::Exceptions
+
+#endif //ADS_BYTECODE_EXCEPTION_H
@@ -10,14 +10,13 @@
  * promotional material.
  */
 
+#include "adsString.h"
+
+#include <cctype>
+#include <cstring>
 #include <string>
 #include <vector>
-#include <sstream>
-#include <algorithm>
 
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
 #include <fmt/chrono.h>
 
 /**
@@ -39,22 +38,46 @@ std::vector<std::string> explode(const std::string& str,
                                  const bool trimEmpty)
 {
     std::vector<std::string> result;
-    std::stringstream ss(str);
-    std::string item;
 
     if (str.empty()) {
         return result;
     }
 
-    while (std::getline(ss, item, delimiter)) {
+    // Like getline(), a delimiter at the very end does not start another part
+    const std::string_view parts = str.back() == delimiter
+        ? std::string_view(str).substr(0, str.size() - 1)
+        : std::string_view(str);
+    for (const std::string_view item : split(parts, delimiter)) {
         if (!trimEmpty || !item.empty()) {
-            result.push_back(item);
+            result.emplace_back(item);
         }
     }
 
     return result;
 }
 
+/**
+ * @brief Find the next occurrence of a character
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @param str String to search
+ * @param delimiter Character to find
+ * @param from Position to start at
+ * @return Position of the character, or std::string_view::npos
+ */
+std::size_t findDelimiter(const std::string_view str, const char delimiter, const std::size_t from)
+{
+    if (from >= str.size()) {
+        return std::string_view::npos;
+    }
+
+    const void* found = std::memchr(str.data() + from, delimiter, str.size() - from);
+    return found != nullptr ? static_cast<std::size_t>(static_cast<const char*>(found) - str.data())
+                            : std::string_view::npos;
+}
+
 /**
  * @brief Join vector of strings with delimiter (PHP implode equivalent)
  *
@@ -194,17 +217,54 @@ std::string extractQuotedString(const std::string& str)
  * @note If the string contains only characters to trim, an empty string is returned
  * @note Default whitespace characters include space, tab, newline, and carriage return
  */
-std::string trim(const std::string& str, const std::string& charsToTrim = " \t\n\r")
+std::string trim(const std::string& str, const std::string& charsToTrim)
 {
-    std::string result = str;
+    return std::string(trimView(str, charsToTrim));
+}
 
-    // Remove leading characters
-    result.erase(0, result.find_first_not_of(charsToTrim));
+/**
+ * @brief Trim specified characters from both ends of a string without copying it
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @param str The string to be trimmed
+ * @param charsToTrim Characters to remove
+ * @return View of the part of @p str left after trimming
+ */
+std::string_view trimView(const std::string_view str, const std::string_view charsToTrim)
+{
+    const std::size_t first = str.find_first_not_of(charsToTrim);
+    if (first == std::string_view::npos) {
+        return str.substr(str.size());
+    }
 
-    // Remove trailing characters
-    result.erase(result.find_last_not_of(charsToTrim) + 1);
+    return str.substr(first, str.find_last_not_of(charsToTrim) - first + 1);
+}
 
-    return result;
+/**
+ * @brief Compare two strings ignoring the case of ASCII letters
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @param a First string
+ * @param b Second string
+ * @return true if both have the same length and the same letters up to case
+ */
+bool equalsIgnoreCase(const std::string_view a, const std::string_view b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(a[i])) != std::toupper(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 /**
@@ -223,25 +283,16 @@ std::string trim(const std::string& str, const std::string& charsToTrim = " \t\n
  * @param value String value to convert to boolean
  * @return Boolean conversion result
  */
-bool stringToBool(const std::string& value)
+bool stringToBool(const std::string_view value)
 {
-    // Return false for empty strings
-    if (value.empty()) {
-        return false;
-    }
-
-    // Trim whitespace
-    std::string trimmedValue = trim(value);
-
-    // Convert to uppercase for case-insensitive comparison
-    std::transform(trimmedValue.begin(), trimmedValue.end(), trimmedValue.begin(),
-        [](unsigned char c){ return std::toupper(c); });
+    // Trim whitespace; the comparisons ignore case, so nothing is copied
+    const std::string_view trimmedValue = trimView(value);
 
     // Check for common "true" values
-    return trimmedValue == "TRUE" ||
+    return equalsIgnoreCase(trimmedValue, "TRUE") ||
            trimmedValue == "1" ||
-           trimmedValue == "YES" ||
-           trimmedValue == "ON";
+           equalsIgnoreCase(trimmedValue, "YES") ||
+           equalsIgnoreCase(trimmedValue, "ON");
 }
 
 /**
@@ -264,20 +315,4 @@ bool stringToBool(const std::string& value)
 std::size_t makeHash(const std::string& str)
 {
     return std::hash<std::string>{}(str);
-}
-
-/**
- * @brief Generate a random UUIDv4
- *
- * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
- * @version Dec 2025
- *
- * Computes a random UUIDv4
- *
- * @return A new UUIDv4
- */
-boost::uuids::uuid getRandomUuid()
-{
-    static boost::uuids::random_generator uuidGenerator;
-    return uuidGenerator();
 }
\ No newline at end of file
@@ -14,13 +14,12 @@
 #ifndef ADS_STRING_H
 #define ADS_STRING_H
 
+#include <cstddef>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
-
 /**
  * @brief Split a string by delimiter (PHP explode equivalent)
  *
@@ -39,6 +38,122 @@ std::vector<std::string> explode(const std::string& str,
                                  char delimiter = ',',
                                  bool trimEmpty = false);
 
+/**
+ * @brief Find the next occurrence of a character
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Scans with memchr(), which the C library implements with vector
+ * instructions, so long inputs are searched many bytes at a time.
+ *
+ * @param str String to search
+ * @param delimiter Character to find
+ * @param from Position to start at
+ * @return Position of the character, or std::string_view::npos
+ */
+std::size_t findDelimiter(std::string_view str, char delimiter, std::size_t from = 0);
+
+/**
+ * @brief Parts of a string between delimiters, as views into it
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * A range for split(): iterating it allocates nothing, and the parts
+ * are views valid while the split string is. "a,,b" gives "a", "" and
+ * "b"; an empty string gives one empty part.
+ */
+class SplitView
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        iterator() = default;
+
+        reference operator*() const { return part; }
+        pointer operator->() const { return &part; }
+
+        iterator& operator++()
+        {
+            if (next == std::string_view::npos) {
+                str = {};
+                done = true;
+            } else {
+                advance(next + 1);
+            }
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b)
+        {
+            return a.done == b.done && (a.done || a.part.data() == b.part.data());
+        }
+
+    private:
+        friend class SplitView;
+
+        std::string_view str;
+        std::string_view part;
+        std::size_t next = std::string_view::npos;      ///< Position of the delimiter after part
+        char delimiter = ',';
+        bool done = true;
+
+        iterator(std::string_view str, char delimiter) : str(str), delimiter(delimiter), done(false)
+        {
+            advance(0);
+        }
+
+        void advance(std::size_t start)
+        {
+            next = findDelimiter(str, delimiter, start);
+            part = str.substr(start, next == std::string_view::npos ? std::string_view::npos : next - start);
+        }
+    };
+
+    SplitView(std::string_view str, char delimiter) : str(str), delimiter(delimiter) {}
+
+    [[nodiscard]] iterator begin() const { return iterator(str, delimiter); }
+    [[nodiscard]] iterator end() const { return {}; }
+
+private:
+    std::string_view str;
+    char delimiter;
+};
+
+/**
+ * @brief Split a string by delimiter without copying it
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @code
+ * for (std::string_view language : split(languages, ',')) { ... }
+ * @endcode
+ *
+ * @param str String to split; must outlive the parts
+ * @param delimiter Character to use as separator
+ * @return Range of the parts
+ */
+inline SplitView split(const std::string_view str, const char delimiter = ',')
+{
+    return {str, delimiter};
+}
+
 /**
  * @brief Unescape common string escape sequences
  *
@@ -112,6 +227,28 @@ std::string extractQuotedString(const std::string& str);
  */
 std::string trim(const std::string& str, const std::string& charsToTrim = " \t\n\r");
 
+/**
+ * @brief Trim specified characters from both ends of a string without copying it
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @param str The string to be trimmed; must outlive the result
+ * @param charsToTrim Characters to remove (default: whitespace)
+ * @return View of the part of @p str left after trimming
+ */
+std::string_view trimView(std::string_view str, std::string_view charsToTrim = " \t\n\r");
+
+/**
+ * @brief Compare two strings ignoring the case of ASCII letters
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * @return true if both have the same length and the same letters up to case
+ */
+bool equalsIgnoreCase(std::string_view a, std::string_view b);
+
 /**
  * @brief Convert string representation to boolean value
  *
@@ -132,6 +269,7 @@ std::string trim(const std::string& str, const std::string& charsToTrim = " \t\n
  *
  * @note Comparison is case-insensitive (e.g., "true", "True", "TRUE" all return true)
  * @note Whitespace is automatically trimmed before comparison
+ * @note Allocates nothing
  *
  * @example
  * stringToBool("true")   // returns true
@@ -143,7 +281,7 @@ std::string trim(const std::string& str, const std::string& charsToTrim = " \t\n
  * stringToBool("0")      // returns false
  * stringToBool("")       // returns false
  */
-bool stringToBool(const std::string& value);
+bool stringToBool(std::string_view value);
 
 /**
  * @brief Generate hash value for a string
@@ -164,16 +302,4 @@ bool stringToBool(const std::string& value);
  */
 std::size_t makeHash(const std::string& str);
 
-/**
- * @brief Generate a random UUIDv4
- *
- * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
- * @version Dec 2025
- *
- * Computes a random UUIDv4
- *
- * @return A new UUIDv4
- */
-boost::uuids::uuid getRandomUuid();
-
 #endif //ADS_STRING_H
\ No newline at end of file
@@ -0,0 +1,292 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file i18nBench.cpp
+ * @brief Google Benchmark suite for the i18n subsystem
+ *
+ * Every benchmark reports ns/op and, through the "allocs" counter, the heap
+ * allocations per iteration, counted by the replaced global operator new.
+ * Catalogues are generated into a temporary folder so the sizes are
+ * controlled and the numbers comparable between runs.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+
+#include "i18n/i18n.h"
+#include "i18n/CompiledCatalogue.h"
+
+using namespace ADS::i18n;
+using namespace ADS::Constants::Languages;
+
+namespace fs = std::filesystem;
+
+// =============================================================================
+// ALLOCATION COUNTING
+// =============================================================================
+
+namespace {
+    std::atomic<std::uint64_t> allocations{0};
+}
+
+void *operator new(const std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace {
+    /**
+     * @brief Report the allocations made since construction as a per-iteration counter
+     */
+    class AllocationCounter
+    {
+    public:
+        explicit AllocationCounter(benchmark::State &state) : state(state), start(allocations.load()) {}
+
+        ~AllocationCounter()
+        {
+            state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.load() - start),
+                                                          benchmark::Counter::kAvgIterations);
+        }
+
+    private:
+        benchmark::State &state;
+        std::uint64_t start;
+    };
+
+    // =============================================================================
+    // FIXTURE DATA
+    // =============================================================================
+
+    const fs::path &benchFolder()
+    {
+        static const fs::path folder = fs::temp_directory_path() / "ads_i18n_bench";
+        return folder;
+    }
+
+    /**
+     * @brief Write a flat catalogue of count keys named key.<i>
+     */
+    void writeCatalogue(const std::string &language, const std::int64_t count, const std::string &prefix)
+    {
+        fs::create_directories(benchFolder());
+        fs::remove(benchFolder() / (language + std::string(CompiledCatalogue::EXTENSION)));
+
+        std::ofstream file(benchFolder() / (language + ".json"));
+        file << "{\n";
+        for (std::int64_t i = 0; i < count; ++i) {
+            file << "  \"key." << i << "\": \"" << prefix << ' ' << i << "\",\n";
+        }
+        file << "  \"greeting\": \"" << prefix << " {name}, you have {count} messages\",\n";
+        file << "  \"files\": {\"one\": \"{count} file\", \"few\": \"{count} files (few)\", "
+                "\"many\": \"{count} files (many)\", \"other\": \"{count} files\"},\n";
+        file << "  \"file\": \"file\",\n";
+        file << "  \"files.plural\": \"files\"\n";
+        file << "}\n";
+    }
+
+    /**
+     * @brief Manager with a 1000-key en_US fallback and an es_ES current locale lacking key.999
+     */
+    std::unique_ptr<i18n> makeManager()
+    {
+        writeCatalogue(ENGLISH_UNITED_STATES.data(), 1000, "Hello");
+        writeCatalogue(SPANISH_SPAIN.data(), 999, "Hola");
+        writeCatalogue(RUSSIAN_RUSSIA.data(), 10, "Privet");
+
+        auto manager = std::make_unique<i18n>(benchFolder().string(), ENGLISH_UNITED_STATES.data());
+        manager->addLanguages({SPANISH_SPAIN.data(), RUSSIAN_RUSSIA.data()});
+        manager->setLocale(SPANISH_SPAIN.data());
+
+        return manager;
+    }
+
+    i18n &manager()
+    {
+        static const std::unique_ptr<i18n> instance = makeManager();
+        return *instance;
+    }
+}
+
+// =============================================================================
+// LOADING
+// =============================================================================
+
+static void BM_LoadJson(benchmark::State &state)
+{
+    writeCatalogue(ENGLISH_UNITED_STATES.data(), state.range(0), "Hello");
+    i18n loader(benchFolder().string(), ENGLISH_UNITED_STATES.data());
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(loader.reloadTranslations());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadJson)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_LoadCompiled(benchmark::State &state)
+{
+    writeCatalogue(ENGLISH_UNITED_STATES.data(), state.range(0), "Hello");
+    i18n loader(benchFolder().string(), ENGLISH_UNITED_STATES.data());
+    loader.compileLanguage(ENGLISH_UNITED_STATES.data());
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(loader.reloadTranslations());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadCompiled)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// LOOKUPS
+// =============================================================================
+
+static void BM_TranslateHit(benchmark::State &state)
+{
+    const i18n &translations = manager();
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations._t("key.500"));
+    }
+}
+BENCHMARK(BM_TranslateHit);
+
+static void BM_TranslateMiss(benchmark::State &state)
+{
+    const i18n &translations = manager();
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations._t("no.such.key"));
+    }
+}
+BENCHMARK(BM_TranslateMiss);
+
+static void BM_TranslateFallback(benchmark::State &state)
+{
+    const i18n &translations = manager();
+
+    // Only the en_US fallback has key.999
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations._t("key.999"));
+    }
+}
+BENCHMARK(BM_TranslateFallback);
+
+static void BM_TranslateKeyed(benchmark::State &state)
+{
+    const i18n &translations = manager();
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations._t(static_cast<Key>(0)));
+    }
+}
+BENCHMARK(BM_TranslateKeyed);
+
+static void BM_LookupOtherLanguage(benchmark::State &state)
+{
+    const i18n &translations = manager();
+
+    // Neither the current locale nor the fallback: goes through the language map
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations.lookup("key.5", RUSSIAN_RUSSIA));
+    }
+}
+BENCHMARK(BM_LookupOtherLanguage);
+
+// =============================================================================
+// PARAMETERS AND PLURALS
+// =============================================================================
+
+static void BM_TranslateWithParams(benchmark::State &state)
+{
+    const i18n &translations = manager();
+    const std::unordered_map<std::string, std::string> parameters = {{"name", "Ann"}, {"count", "3"}};
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations.translateWithParams("greeting", parameters));
+    }
+}
+BENCHMARK(BM_TranslateWithParams);
+
+static void BM_FormatTo(benchmark::State &state)
+{
+    const i18n &translations = manager();
+    std::string buffer;
+    const std::string name = "Ann";
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        buffer.clear();
+        benchmark::DoNotOptimize(translations.formatTo(buffer, "greeting", arg("name", name), arg("count", 3)));
+    }
+}
+BENCHMARK(BM_FormatTo);
+
+static void BM_TranslatePlural(benchmark::State &state)
+{
+    const i18n &translations = manager();
+    const std::string singular = "file";
+    const std::string plural = "files.plural";
+    int count = 0;
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations.translatePlural(singular, plural, count++ % 30));
+    }
+}
+BENCHMARK(BM_TranslatePlural);
+
+static void BM_LookupPlural(benchmark::State &state)
+{
+    const i18n &translations = manager();
+    std::int64_t count = 0;
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(translations.lookupPlural("files", count++ % 30, RUSSIAN_RUSSIA));
+    }
+}
+BENCHMARK(BM_LookupPlural);
+
+BENCHMARK_MAIN();
@@ -11,15 +11,21 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 #include <algorithm>
 #include <cstdlib>
 
 #include "i18n/i18n.h"
+#include "i18n/CompiledCatalogue.h"
+#include "Core/AllocationCounter.h"
 #include "i18nTests.h"
 
 using namespace ADS::i18n;
@@ -354,6 +360,84 @@ TEST_F(i18nTests, BasicTranslation)
     EXPECT_EQ(result, "Hola");
 }
 
+TEST_F(i18nTests, LookupReturnsViewIntoCatalogue)
+{
+    auto i18nObject =
+            SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+
+    i18nObject->addTranslation("hello", "Hello", ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("bye", "Adios", SPANISH_SPAIN.data());
+
+    string_view first = i18nObject->lookup("hello");
+    string_view second = i18nObject->lookup("hello");
+    EXPECT_EQ(first, "Hello");
+    EXPECT_EQ(first.data(), second.data());
+
+    // Missing in es_ES falls back to en_US, missing everywhere returns the key
+    EXPECT_EQ(i18nObject->lookup("hello", SPANISH_SPAIN.data()), "Hello");
+    EXPECT_EQ(i18nObject->lookup("bye", SPANISH_SPAIN.data()), "Adios");
+    EXPECT_EQ(i18nObject->lookup("missing.key"), "missing.key");
+}
+
+TEST_F(i18nTests, KeyedTranslationFollowsCataloguesAndLocale)
+{
+    auto i18nObject =
+            SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+
+    // Not in the test catalogues: the key name is returned
+    EXPECT_EQ(i18nObject->_t(Key::MENU_FILE_NEW), keyName(Key::MENU_FILE_NEW));
+    EXPECT_EQ(keyName(Key::MENU_FILE_NEW), "MENU.FILE_NEW");
+
+    i18nObject->addTranslation("MENU.FILE_NEW", "New", ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("MENU.FILE_NEW", "Nuevo", SPANISH_SPAIN.data());
+    EXPECT_EQ(i18nObject->_t(Key::MENU_FILE_NEW), "New");
+    EXPECT_EQ(i18nObject->lookup(Key::MENU_FILE_NEW, SPANISH_SPAIN.data()), "Nuevo");
+
+    i18nObject->setLocale(SPANISH_SPAIN.data());
+    EXPECT_EQ(i18nObject->_t(Key::MENU_FILE_NEW), "Nuevo");
+}
+
+TEST_F(i18nTests, RevisionChangesWithKeyedTranslations)
+{
+    auto i18nObject =
+            SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+
+    const uint64_t initial = i18nObject->getRevision();
+    EXPECT_EQ(i18nObject->getRevision(), initial);
+
+    i18nObject->addTranslation("MENU.FILE_NEW", "New", ENGLISH_UNITED_STATES.data());
+    const uint64_t translated = i18nObject->getRevision();
+    EXPECT_NE(translated, initial);
+
+    i18nObject->setLocale(SPANISH_SPAIN.data());
+    EXPECT_NE(i18nObject->getRevision(), translated);
+}
+
+TEST_F(i18nTests, FallbackEntriesAreMergedButStillMissing)
+{
+    auto i18nObject =
+            SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+
+    i18nObject->addLanguage(SPANISH_SPAIN.data());
+    i18nObject->addTranslation("only.english", "English only", ENGLISH_UNITED_STATES.data());
+
+    const TranslationMap &spanish = i18nObject->getLanguage(SPANISH_SPAIN.data())->second;
+    EXPECT_TRUE(spanish.contains("only.english"));
+    EXPECT_FALSE(spanish.hasOwn("only.english"));
+    EXPECT_EQ(i18nObject->lookup("only.english", SPANISH_SPAIN.data()), "English only");
+
+    vector<string> missing = i18nObject->findMissingTranslations(SPANISH_SPAIN.data());
+    EXPECT_NE(std::find(missing.begin(), missing.end(), "only.english"), missing.end());
+
+    // Translating the key makes it an own entry of the language
+    i18nObject->addTranslation("only.english", "Solo inglés", SPANISH_SPAIN.data());
+    EXPECT_TRUE(spanish.hasOwn("only.english"));
+    EXPECT_EQ(i18nObject->lookup("only.english", SPANISH_SPAIN.data()), "Solo inglés");
+
+    missing = i18nObject->findMissingTranslations(SPANISH_SPAIN.data());
+    EXPECT_EQ(std::find(missing.begin(), missing.end(), "only.english"), missing.end());
+}
+
 TEST_F(i18nTests, SetLocale)
 {
     auto i18nObject =
@@ -394,6 +478,48 @@ TEST_F(i18nTests, AddLanguage)
     EXPECT_TRUE(i18nObject->hasLanguage(FRENCH_FRANCE.data()));
 }
 
+TEST_F(i18nTests, AddLanguagesLoadsAllConcurrently)
+{
+    auto i18nObject =
+            SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+
+    size_t loaded = i18nObject->addLanguages({
+            SPANISH_SPAIN.data(), FRENCH_FRANCE.data(), SPANISH_SPAIN.data()
+    });
+
+    EXPECT_TRUE(i18nObject->hasLanguage(SPANISH_SPAIN.data()));
+    EXPECT_TRUE(i18nObject->hasLanguage(FRENCH_FRANCE.data()));
+    // Only the French catalogue is a JSON file
+    EXPECT_EQ(loaded, 1u);
+    EXPECT_EQ(i18nObject->lookup("hello", FRENCH_FRANCE.data()), "Bonjour");
+    EXPECT_EQ(i18nObject->addLanguages({SPANISH_SPAIN.data()}), 0u);
+    EXPECT_THROW(i18nObject->addLanguages({"XX"}), locale_exception);
+}
+
+TEST_F(i18nTests, LazyLanguagesLoadOnFirstUse)
+{
+    auto i18nObject =
+            SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->setLoadMode(LoadMode::Lazy);
+
+    EXPECT_EQ(i18nObject->addLanguage(FRENCH_FRANCE.data()), nullptr);
+    EXPECT_FALSE(i18nObject->hasLanguage(FRENCH_FRANCE.data()));
+    EXPECT_TRUE(i18nObject->isLanguageKnown(FRENCH_FRANCE.data()));
+
+    // An explicit lookup parses the catalogue
+    EXPECT_EQ(i18nObject->lookup("hello", FRENCH_FRANCE.data()), "Bonjour");
+    EXPECT_TRUE(i18nObject->hasLanguage(FRENCH_FRANCE.data()));
+
+    // Unloading keeps it registered, and it comes back on demand
+    EXPECT_EQ(i18nObject->unloadUnusedLanguages(), 1u);
+    EXPECT_FALSE(i18nObject->hasLanguage(FRENCH_FRANCE.data()));
+    EXPECT_TRUE(i18nObject->isLanguageKnown(FRENCH_FRANCE.data()));
+
+    i18nObject->setLocale(FRENCH_FRANCE.data());
+    EXPECT_TRUE(i18nObject->hasLanguage(FRENCH_FRANCE.data()));
+    EXPECT_EQ(i18nObject->lookup("goodbye"), "Au revoir");
+}
+
 TEST_F(i18nTests, AddLanguageTwice)
 {
     auto i18nObject =
@@ -485,11 +611,11 @@ TEST_F(i18nTests, GetTranslationsForFallbackLanguage)
 
     i18nObject->addTranslation("hello", "Hello", ENGLISH_UNITED_STATES.data());
 
-    const pair<const string, unordered_map<string, string> >*
+    const pair<const string, TranslationMap>*
             fallbackTranslations = i18nObject->
             getFallbackLanguageTranslations();
 
-    std::unordered_map<string, string> englishExpectedTranslations = {
+    TranslationMap englishExpectedTranslations = {
             {"hello", "Hello"}
     };
 
@@ -505,11 +631,11 @@ TEST_F(i18nTests, GetExistingLanguage)
     i18nObject->addTranslation("hello", "Hello", ENGLISH_UNITED_STATES.data());
     i18nObject->addTranslation("hello", "Hola", SPANISH_SPAIN.data());
 
-    const pair<const string, unordered_map<string, string> >* spanishLanguage =
+    const pair<const string, TranslationMap>* spanishLanguage =
             i18nObject->getLanguage(
                     SPANISH_SPAIN.data());
 
-    std::unordered_map<string, string> spanishExpectedTranslations = {
+    TranslationMap spanishExpectedTranslations = {
             {"hello", "Hola"},
             {"goodbye", "Adiós"},
             {"welcome", "Bienvenido {name}"},
@@ -1769,4 +1895,422 @@ TEST_F(i18nTests, findMissingTranslations_LargeScale_PerformanceTest)
 
     // Results should still be sorted
     EXPECT_TRUE(std::is_sorted(missing.begin(), missing.end()));
-}
\ No newline at end of file
+}
+TEST_F(i18nTests, TranslationMapGrowsAndKeepsEntries)
+{
+    TranslationMap catalogue;
+    const int numTranslations = 1000;
+
+    for (int i = 0; i < numTranslations; ++i) {
+        catalogue["key_" + std::to_string(i)] = "Value " + std::to_string(i);
+    }
+
+    EXPECT_EQ(catalogue.size(), numTranslations);
+    for (int i = 0; i < numTranslations; ++i) {
+        const std::optional<std::string_view> value = catalogue.find("key_" + std::to_string(i));
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(*value, "Value " + std::to_string(i));
+    }
+    EXPECT_EQ(catalogue.find("key_missing"), std::nullopt);
+
+    // Overwriting an existing key must not add a new entry
+    catalogue["key_0"] = "Changed";
+    EXPECT_EQ(catalogue.size(), numTranslations);
+    EXPECT_EQ(*catalogue.find("key_0"), "Changed");
+}
+
+TEST_F(i18nTests, TranslationMapEqualityIgnoresOrder)
+{
+    TranslationMap first = {{"hello", "Hola"}, {"goodbye", "Adiós"}};
+    TranslationMap second = {{"goodbye", "Adiós"}, {"hello", "Hola"}};
+    TranslationMap different = {{"hello", "Hola"}, {"goodbye", "Chao"}};
+
+    EXPECT_EQ(first, second);
+    EXPECT_FALSE(first == different);
+}
+
+TEST_F(i18nTests, JsonNestedKeysKeepTheirFullPath)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+
+    const TranslationMap &french = i18nObject->getLanguage("fr_FR")->second;
+    ASSERT_TRUE(french.find("nested.menu.file").has_value());
+    EXPECT_EQ(*french.find("nested.menu.file"), "Fichier");
+    EXPECT_EQ(*french.find("nested.menu.edit"), "Modifier");
+    EXPECT_EQ(*french.find("hello"), "Bonjour");
+    EXPECT_EQ(french.find("menu.file"), std::nullopt);
+}
+
+TEST_F(i18nTests, CompiledCatalogueIsMappedUntilTheJsonChanges)
+{
+    auto compiler = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    const std::filesystem::path compiledPath = compiler->compileLanguage("fr_FR");
+    ASSERT_TRUE(std::filesystem::exists(compiledPath));
+
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+    const TranslationMap &french = i18nObject->getLanguage("fr_FR")->second;
+    EXPECT_TRUE(french.isCompiled());
+    EXPECT_EQ(french.size(), 4);
+    EXPECT_EQ(i18nObject->lookup("nested.menu.edit", "fr_FR"), "Modifier");
+    EXPECT_EQ(*(i18nObject->lookup("hello", "fr_FR").data() + 7), '\0');
+
+    // A JSON file newer than the compiled one wins
+    std::filesystem::last_write_time(testDir / "fr_FR.json",
+                                     std::filesystem::last_write_time(compiledPath) + std::chrono::seconds(1));
+    auto reloaded = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    reloaded->addLanguage("fr_FR");
+    EXPECT_FALSE(reloaded->getLanguage("fr_FR")->second.isCompiled());
+}
+
+TEST_F(i18nTests, CompiledTranslationMapCopiesEntriesOnWrite)
+{
+    const std::filesystem::path path = testDir / "compiled.adsl";
+    const TranslationMap source = {{"hello", "Hola"}, {"goodbye", "Adiós"}, {"empty", ""}};
+    CompiledCatalogue::write(source, path);
+
+    TranslationMap catalogue(CompiledCatalogue::open(path));
+    EXPECT_EQ(catalogue, source);
+    EXPECT_TRUE(catalogue.hasOwn("empty"));
+    EXPECT_EQ(catalogue.find("missing"), std::nullopt);
+
+    // Fallback entries are inherited only for the keys the file lacks
+    catalogue.mergeFallback({{"hello", "Hello"}, {"welcome", "Welcome"}});
+    EXPECT_EQ(catalogue.inheritedSize(), 1);
+    EXPECT_EQ(*catalogue.find("hello"), "Hola");
+    EXPECT_EQ(*catalogue.find("welcome"), "Welcome");
+    EXPECT_FALSE(catalogue.hasOwn("welcome"));
+
+    catalogue["hello"] = "Buenas";
+    EXPECT_FALSE(catalogue.isCompiled());
+    EXPECT_EQ(catalogue.size(), 3);
+    EXPECT_EQ(*catalogue.find("hello"), "Buenas");
+    EXPECT_EQ(*catalogue.find("goodbye"), "Adiós");
+    EXPECT_EQ(*catalogue.find("welcome"), "Welcome");
+
+    std::ofstream(testDir / "broken.adsl", std::ios::binary) << "ADSL";
+    EXPECT_THROW(auto mapped = CompiledCatalogue::open(testDir / "broken.adsl"), ADS::i18n::translation_file_exception);
+}
+
+TEST_F(i18nTests, FormatToSubstitutesNamedArgumentsInOnePass)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("summary", "{errors} errors, {warnings} warnings in {file}",
+                               ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("summary", "{errors} errores, {warnings} avisos", SPANISH_SPAIN.data());
+
+    std::string buffer = "> ";
+    const std::string_view text = i18nObject->formatTo(buffer, "summary", arg("errors", 3), arg("warnings", 1));
+    EXPECT_EQ(text, "3 errors, 1 warnings in {file}");
+    EXPECT_EQ(buffer, "> 3 errors, 1 warnings in {file}");
+
+    const std::string warnings = "0";
+    const std::vector<FormatArg> args = {arg("warnings", warnings), arg("errors", "2")};
+    buffer.clear();
+    EXPECT_EQ(i18nObject->formatTo(buffer, "summary", args, SPANISH_SPAIN.data()), "2 errores, 0 avisos");
+
+    // A changed translation is tokenised again
+    i18nObject->addTranslation("summary", "{{errors}} / {}", ENGLISH_UNITED_STATES.data());
+    buffer.clear();
+    EXPECT_EQ(i18nObject->formatTo(buffer, "summary", arg("errors", 5)), "{5} / {}");
+
+    // A missing key is formatted as its own translation
+    buffer.clear();
+    EXPECT_EQ(i18nObject->formatTo(buffer, "Hi {name}", arg("name", "Ann")), "Hi Ann");
+}
+
+TEST_F(i18nTests, WatchedTranslationFileIsSwappedInByUpdate)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+    EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Bonjour");
+
+    i18nObject->watchTranslations(std::chrono::milliseconds(10));
+    createJsonFile("fr_FR", R"({"hello": "Salut"})");
+    std::filesystem::last_write_time(testDir / "fr_FR.json",
+                                     std::filesystem::last_write_time(testDir / "fr_FR.json") + std::chrono::seconds(2));
+
+    // Nothing changes between two calls to update()
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (i18nObject->lookup("hello", "fr_FR") == "Bonjour" && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        i18nObject->update();
+    }
+    i18nObject->stopWatching();
+
+    EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Salut");
+    EXPECT_EQ(i18nObject->snapshot()->lookup("hello", "fr_FR"), "Salut");
+}
+
+TEST_F(i18nTests, SnapshotsAreImmutableAndShareUnchangedCatalogues)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+    i18nObject->update();
+
+    const std::shared_ptr<const CatalogueSnapshot> before = i18nObject->snapshot();
+    ASSERT_NE(before, nullptr);
+    EXPECT_EQ(before->lookup("hello", "fr_FR"), "Bonjour");
+
+    i18nObject->addTranslation("hello", "Coucou", "fr_FR");
+    EXPECT_EQ(i18nObject->snapshot(), before);
+    i18nObject->update();
+
+    const std::shared_ptr<const CatalogueSnapshot> after = i18nObject->snapshot();
+    EXPECT_EQ(after->getGeneration(), before->getGeneration() + 1);
+    EXPECT_EQ(after->lookup("hello", "fr_FR"), "Coucou");
+    EXPECT_EQ(before->lookup("hello", "fr_FR"), "Bonjour");
+    EXPECT_EQ(after->catalogue(ENGLISH_UNITED_STATES.data()), before->catalogue(ENGLISH_UNITED_STATES.data()));
+    EXPECT_NE(after->catalogue("fr_FR"), before->catalogue("fr_FR"));
+
+    // Nothing changed: no new snapshot
+    i18nObject->update();
+    EXPECT_EQ(i18nObject->snapshot(), after);
+}
+
+TEST_F(i18nTests, WorkerThreadsReadThePublishedSnapshot)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+    i18nObject->update();
+
+    // Changes on the owning thread stay invisible to workers until update()
+    i18nObject->addTranslation("hello", "Coucou", "fr_FR");
+    std::string pending;
+    std::thread([&] { pending = i18nObject->lookup("hello", "fr_FR"); }).join();
+    EXPECT_EQ(pending, "Bonjour");
+
+    i18nObject->update();
+    std::atomic<int> mismatches = 0;
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 4; ++worker) {
+        workers.emplace_back([&] {
+            std::string buffer;
+            for (int i = 0; i < 1000; ++i) {
+                const std::string_view hello = i18nObject->lookup("hello", "fr_FR");
+                buffer.clear();
+                const std::string_view formatted = i18nObject->formatTo(buffer, "{count} items", arg("count", i));
+                if ((hello != "Coucou" && hello != "Salut") || formatted != std::to_string(i) + " items") {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    // The owner keeps publishing while the workers read
+    for (int i = 0; i < 50; ++i) {
+        i18nObject->addTranslation("hello", (i % 2 == 0) ? "Salut" : "Coucou", "fr_FR");
+        i18nObject->update();
+    }
+    for (std::thread &worker: workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(mismatches, 0);
+}
+
+TEST_F(i18nTests, WorkerViewsOutliveLaterPublications)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+    i18nObject->update();
+
+    std::string_view first;
+    std::atomic<int> step = 0;
+    std::thread worker([&] {
+        first = i18nObject->lookup("hello", "fr_FR");
+        step = 1;
+        // Every read after a publication replaces the thread's snapshot
+        while (step != 2) {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Coucou");
+        step = 3;
+        while (step != 4) {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Salut");
+        EXPECT_EQ(first, "Bonjour");
+    });
+
+    while (step != 1) {
+        std::this_thread::yield();
+    }
+    i18nObject->addTranslation("hello", "Coucou", "fr_FR");
+    i18nObject->update();
+    step = 2;
+    while (step != 3) {
+        std::this_thread::yield();
+    }
+    i18nObject->addTranslation("hello", "Salut", "fr_FR");
+    i18nObject->update();
+    step = 4;
+    worker.join();
+}
+
+TEST_F(i18nTests, TakeOwnershipHandsTheLiveCataloguesOver)
+{
+    // Built and loaded on another thread, as the startup job does
+    std::unique_ptr<i18n> i18nObject;
+    std::thread([&] {
+        i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+        i18nObject->addLanguage("fr_FR");
+    }).join();
+
+    // Nothing was published yet: without the hand-over this thread reads an empty snapshot
+    EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "hello");
+
+    i18nObject->takeOwnership();
+    EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Bonjour");
+    i18nObject->addTranslation("hello", "Coucou", "fr_FR");
+    EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Coucou");
+}
+
+TEST_F(i18nTests, PluralRulesFollowCldrCategories)
+{
+    const PluralRule russian = pluralRuleFor(RUSSIAN_RUSSIA);
+    EXPECT_EQ(russian(1), PluralCategory::One);
+    EXPECT_EQ(russian(21), PluralCategory::One);
+    EXPECT_EQ(russian(3), PluralCategory::Few);
+    EXPECT_EQ(russian(-24), PluralCategory::Few);
+    EXPECT_EQ(russian(0), PluralCategory::Many);
+    EXPECT_EQ(russian(11), PluralCategory::Many);
+    EXPECT_EQ(russian(112), PluralCategory::Many);
+
+    EXPECT_EQ(pluralRuleFor(POLISH_POLAND)(21), PluralCategory::Many);
+    EXPECT_EQ(pluralRuleFor(POLISH_POLAND)(22), PluralCategory::Few);
+    EXPECT_EQ(pluralRuleFor(ROMANIAN_ROMANIA)(19), PluralCategory::Few);
+    EXPECT_EQ(pluralRuleFor(ROMANIAN_ROMANIA)(20), PluralCategory::Other);
+    EXPECT_EQ(pluralRuleFor(FRENCH_FRANCE)(0), PluralCategory::One);
+    EXPECT_EQ(pluralRuleFor(FRENCH_FRANCE)(2000000), PluralCategory::Many);
+    EXPECT_EQ(pluralRuleFor(PORTUGUESE_PORTUGAL)(0), PluralCategory::Other);
+    EXPECT_EQ(pluralRuleFor(PORTUGUESE_BRAZIL)(0), PluralCategory::One);
+    EXPECT_EQ(pluralRuleFor(ENGLISH_UNITED_STATES)(0), PluralCategory::Other);
+    EXPECT_EQ(pluralRuleFor("xx_XX")(1), PluralCategory::One);
+}
+
+TEST_F(i18nTests, LookupPluralPicksTheFormOfTheCategory)
+{
+    createJsonFile("ru_RU", R"({"files": {"one": "{count} файл", "few": "{count} файла", "many": "{count} файлов"}})");
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("files.one", "{count} file", ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("files.other", "{count} files", ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage(RUSSIAN_RUSSIA.data());
+
+    EXPECT_EQ(i18nObject->lookupPlural("files", 1, RUSSIAN_RUSSIA), "{count} файл");
+    EXPECT_EQ(i18nObject->lookupPlural("files", 22, RUSSIAN_RUSSIA), "{count} файла");
+    EXPECT_EQ(i18nObject->lookupPlural("files", 5, RUSSIAN_RUSSIA), "{count} файлов");
+    EXPECT_EQ(i18nObject->lookupPlural("files", 0), "{count} files");
+    EXPECT_EQ(i18nObject->translatePlural("files", int64_t{1}), "{count} file");
+
+    // Keys without forms keep their plain translation
+    EXPECT_EQ(i18nObject->lookupPlural("hello", 3, RUSSIAN_RUSSIA), "hello");
+    i18nObject->addTranslation("file", "file", ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("files.plain", "files", ENGLISH_UNITED_STATES.data());
+    EXPECT_EQ(i18nObject->translatePlural("file", "files.plain", 0), "files");
+    EXPECT_EQ(i18nObject->translatePlural("file", "files.plain", 1), "file");
+}
+
+TEST_F(i18nTests, CoverageFollowsTranslationsAndReloads)
+{
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("hello", "Hello", ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("bye", "Bye", ENGLISH_UNITED_STATES.data());
+    i18nObject->addTranslation("hello", "Hola", SPANISH_SPAIN.data());
+
+    EXPECT_EQ(i18nObject->getCoverage(SPANISH_SPAIN).translated, 1);
+    EXPECT_EQ(i18nObject->getCoverage(SPANISH_SPAIN).missing(), 1);
+    EXPECT_EQ(i18nObject->findMissingTranslations(SPANISH_SPAIN.data()), std::vector<std::string>{"bye"});
+
+    // New fallback keys are missing everywhere else until translated
+    i18nObject->addTranslation("accept", "Aceptar", SPANISH_SPAIN.data(), "Accept");
+    i18nObject->addTranslation("cancel", "Cancel", ENGLISH_UNITED_STATES.data());
+    EXPECT_EQ(i18nObject->getCoverage(SPANISH_SPAIN).total, 4);
+    EXPECT_EQ(i18nObject->findMissingTranslations(SPANISH_SPAIN.data()),
+              (std::vector<std::string>{"bye", "cancel"}));
+    EXPECT_EQ(i18nObject->getCoverage(ENGLISH_UNITED_STATES).ratio(), 1.0);
+
+    // Workers read the coverage published with the snapshot
+    i18nObject->update();
+    size_t missing = 0;
+    std::thread([&] { missing = i18nObject->findMissingTranslations(SPANISH_SPAIN.data()).size(); }).join();
+    EXPECT_EQ(missing, 2);
+    EXPECT_EQ(i18nObject->snapshot()->getCoverage(SPANISH_SPAIN).translated, 2);
+
+    // A catalogue replaced from its file is indexed again
+    i18nObject->addLanguage("fr_FR");
+    EXPECT_EQ(i18nObject->getCoverage("fr_FR").translated, 1);
+    EXPECT_EQ(i18nObject->getCoverage("xx_XX").total, 0);
+}
+
+TEST_F(i18nTests, LocaleTableFindsEverySupportedCode)
+{
+    for (const std::string_view code: ADS::Constants::Languages::getSupportedLocales()) {
+        const auto *entry = ADS::Constants::Languages::findLocale(code);
+        ASSERT_NE(entry, nullptr) << code;
+        EXPECT_EQ(entry->code, code);
+        EXPECT_EQ(std::string(entry->language) + "_" + std::string(entry->country), code);
+    }
+
+    EXPECT_EQ(ADS::Constants::Languages::findLocale("es"), nullptr);
+    EXPECT_EQ(ADS::Constants::Languages::findLocale("es_ES.UTF-8"), nullptr);
+    EXPECT_TRUE(ADS::Constants::Languages::isLanguageSupported("es_ES.UTF-8"));
+    EXPECT_EQ(ADS::Constants::Languages::getLanguageName(GERMAN_GERMANY), "Deutsch (Deutschland)");
+}
+
+namespace {
+    size_t violationBytes = 0;
+    std::string violationStack;
+
+    void recordViolation(const char *, const size_t size, const std::string_view stack)
+    {
+        violationBytes += size;
+        violationStack = stack;
+    }
+}
+
+TEST_F(i18nTests, NoAllocationScopeReportsAllocationsWithTheirStack)
+{
+    using namespace ADS::Core;
+    if (!AllocationCounter::isEnabled()) {
+        GTEST_SKIP() << "Not built with ADS_COUNT_ALLOCATIONS";
+    }
+
+    violationBytes = 0;
+    AllocationCounter::setViolationHandler(&recordViolation);
+    uint64_t violations = 0;
+    {
+        AllocationCounter::NoAllocationScope scope("test");
+        std::vector<int> allocated(256);
+        allocated[0] = 1;
+        violations = scope.getViolations();
+    }
+    // Outside the scope nothing is reported
+    std::vector<int> unchecked(256);
+    AllocationCounter::setViolationHandler(nullptr);
+
+    EXPECT_EQ(violations, 1u);
+    EXPECT_EQ(violationBytes, 256 * sizeof(int));
+    EXPECT_FALSE(violationStack.empty());
+}
+
+TEST_F(i18nTests, LookupOfALoadedKeyDoesNotAllocate)
+{
+    using namespace ADS::Core;
+    if (!AllocationCounter::isEnabled()) {
+        GTEST_SKIP() << "Not built with ADS_COUNT_ALLOCATIONS";
+    }
+
+    auto i18nObject = SetupI18nObject(BASE_FOLDER, ENGLISH_UNITED_STATES.data());
+    i18nObject->addLanguage("fr_FR");
+    i18nObject->update();
+    std::string buffer;
+    buffer.reserve(64);
+
+    // What an idle frame asks of the catalogues
+    AllocationCounter::NoAllocationScope scope("lookup");
+    EXPECT_EQ(i18nObject->lookup("hello", "fr_FR"), "Bonjour");
+    EXPECT_EQ(i18nObject->formatTo(buffer, "{count} items", arg("count", 42)), "42 items");
+    EXPECT_EQ(scope.getViolations(), 0u);
+}
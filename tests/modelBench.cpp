@@ -0,0 +1,718 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file modelBench.cpp
+ * @brief Google Benchmark suite for the core data model
+ *
+ * Covers the Project's entity collections, the inspector properties of
+ * each entity type, property event dispatch, the editor registry, id
+ * generation, entity copy/paste, property column queries and shared text.
+ * It links the model alone, no window or renderer, so it runs anywhere the
+ * tests do. Allocations per iteration are reported through the "allocs"
+ * counter, as in i18nBench.cpp.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Core/EntityClipboard.h"
+#include "Core/CsvImportParser.h"
+#include "Core/IdGenerator.h"
+#include "Core/Project.h"
+#include "Core/ProjectImporter.h"
+#include "Core/SyncSession.h"
+#include "Entities/Character.h"
+#include "Entities/Item.h"
+#include "Entities/Scene.h"
+#include "Inspector/PropertyEditorRegistry.h"
+#include "Inspector/PropertyEvent.h"
+
+using namespace ADS;
+
+// =============================================================================
+// ALLOCATION COUNTING
+// =============================================================================
+
+namespace {
+    std::atomic<std::uint64_t> allocations{0};
+}
+
+void *operator new(const std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace {
+    /**
+     * @brief Report the allocations made since construction as a per-iteration counter
+     */
+    class AllocationCounter
+    {
+    public:
+        explicit AllocationCounter(benchmark::State &state) : state(state), start(allocations.load()) {}
+
+        ~AllocationCounter()
+        {
+            state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations.load() - start),
+                                                          benchmark::Counter::kAvgIterations);
+        }
+
+    private:
+        benchmark::State &state;
+        std::uint64_t start;
+    };
+
+    // =============================================================================
+    // FIXTURE DATA
+    // =============================================================================
+
+    std::vector<std::string> makeIds(const std::int64_t count)
+    {
+        std::vector<std::string> ids;
+        ids.reserve(static_cast<std::size_t>(count));
+        for (std::int64_t i = 0; i < count; ++i) {
+            ids.push_back("scene." + std::to_string(i));
+        }
+        return ids;
+    }
+
+    /**
+     * @brief Project holding count scenes named scene.<i>
+     */
+    std::unique_ptr<Core::Project> makeProject(const std::vector<std::string> &ids)
+    {
+        auto project = std::make_unique<Core::Project>("Bench");
+        std::vector<Core::Project::NewEntity> entries;
+        entries.reserve(ids.size());
+        for (const std::string &id: ids) {
+            entries.push_back({id, id});
+        }
+        project->addScenes(entries);
+        return project;
+    }
+
+    /**
+     * @brief Integer property each entity type is benchmarked on
+     */
+    template<typename T>
+    struct IntProperty;
+
+    template<>
+    struct IntProperty<Entities::Scene>
+    {
+        static constexpr const char *id = "width";
+    };
+
+    template<>
+    struct IntProperty<Entities::Character>
+    {
+        static constexpr const char *id = "health";
+    };
+
+    template<>
+    struct IntProperty<Entities::Item>
+    {
+        static constexpr const char *id = "quantity";
+    };
+}
+
+// =============================================================================
+// PROJECT
+// =============================================================================
+
+static void BM_ProjectFindScene(benchmark::State &state)
+{
+    const std::vector<std::string> ids = makeIds(state.range(0));
+    const auto project = makeProject(ids);
+    std::size_t next = 0;
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(project->findScene(ids[next]));
+        next = (next + 7919) % ids.size();
+    }
+}
+BENCHMARK(BM_ProjectFindScene)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_ProjectFindSceneMiss(benchmark::State &state)
+{
+    const auto project = makeProject(makeIds(state.range(0)));
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(project->findScene("no.such.scene"));
+    }
+}
+BENCHMARK(BM_ProjectFindSceneMiss)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_ProjectAddRemoveLast(benchmark::State &state)
+{
+    const auto project = makeProject(makeIds(state.range(0)));
+    const std::string id = "added";
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(project->addScene(id, id));
+        project->removeScene(id);
+    }
+}
+BENCHMARK(BM_ProjectAddRemoveLast)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_ProjectRemoveAddFirst(benchmark::State &state)
+{
+    const std::vector<std::string> ids = makeIds(state.range(0));
+    const auto project = makeProject(ids);
+
+    // Removing the first scene moves every scene after it; the re-add goes to the end
+    AllocationCounter counter(state);
+    std::size_t next = 0;
+    for (auto _: state) {
+        project->removeScene(ids[next]);
+        benchmark::DoNotOptimize(project->addScene(ids[next], ids[next]));
+        next = (next + 1) % ids.size();
+    }
+}
+BENCHMARK(BM_ProjectRemoveAddFirst)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ProjectAddScenes(benchmark::State &state)
+{
+    const std::vector<std::string> ids = makeIds(state.range(0));
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(makeProject(ids));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ProjectAddScenes)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// =============================================================================
+// PROPERTIES
+// =============================================================================
+
+template<typename T>
+static void BM_GetPropertySchema(benchmark::State &state)
+{
+    const T entity("bench", "Bench");
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(entity.getPropertySchema().getDescriptors().size());
+    }
+}
+BENCHMARK_TEMPLATE(BM_GetPropertySchema, Entities::Scene);
+BENCHMARK_TEMPLATE(BM_GetPropertySchema, Entities::Character);
+BENCHMARK_TEMPLATE(BM_GetPropertySchema, Entities::Item);
+
+template<typename T>
+static void BM_GetPropertyValue(benchmark::State &state)
+{
+    const T entity("bench", "Bench");
+    const std::string property = IntProperty<T>::id;
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(entity.getPropertyValue(property));
+    }
+}
+BENCHMARK_TEMPLATE(BM_GetPropertyValue, Entities::Scene);
+BENCHMARK_TEMPLATE(BM_GetPropertyValue, Entities::Character);
+BENCHMARK_TEMPLATE(BM_GetPropertyValue, Entities::Item);
+
+template<typename T>
+static void BM_GetPropertyValueString(benchmark::State &state)
+{
+    const T entity("bench", "Bench");
+    const std::string property = "name";
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(entity.getPropertyValue(property));
+    }
+}
+BENCHMARK_TEMPLATE(BM_GetPropertyValueString, Entities::Scene);
+BENCHMARK_TEMPLATE(BM_GetPropertyValueString, Entities::Character);
+BENCHMARK_TEMPLATE(BM_GetPropertyValueString, Entities::Item);
+
+template<typename T>
+static void BM_SetPropertyValue(benchmark::State &state)
+{
+    T entity("bench", "Bench");
+    const std::string property = IntProperty<T>::id;
+    const Inspector::PropertyValue values[] = {1, 2};
+    std::size_t next = 0;
+
+    // Alternating values, so every set is a change and fires an event
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(entity.setPropertyValue(property, values[next]));
+        next ^= 1;
+    }
+}
+BENCHMARK_TEMPLATE(BM_SetPropertyValue, Entities::Scene);
+BENCHMARK_TEMPLATE(BM_SetPropertyValue, Entities::Character);
+BENCHMARK_TEMPLATE(BM_SetPropertyValue, Entities::Item);
+
+// =============================================================================
+// EVENTS
+// =============================================================================
+
+static void BM_Dispatch(benchmark::State &state)
+{
+    Inspector::PropertyEventDispatcher dispatcher;
+    std::uint64_t calls = 0;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        dispatcher.subscribe([&calls](const Inspector::PropertyChangedEvent &) { ++calls; });
+    }
+    const Inspector::PropertyValue oldValue = 1;
+    const Inspector::PropertyValue newValue = 2;
+    const Inspector::PropertyChangedEvent event("width", oldValue, newValue, nullptr);
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        dispatcher.dispatch(event);
+    }
+    benchmark::DoNotOptimize(calls);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Dispatch)->RangeMultiplier(2)->Range(1, 64);
+
+static void BM_DispatchDeferred(benchmark::State &state)
+{
+    Inspector::PropertyEventQueue queue;
+    Inspector::PropertyEventDispatcher dispatcher;
+    dispatcher.setQueue(&queue);
+    std::uint64_t calls = 0;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        dispatcher.subscribe([&calls](const Inspector::PropertyChangedEvent &) { ++calls; },
+                             Inspector::DispatchMode::Deferred);
+    }
+    const Inspector::PropertyValue oldValue = 1;
+    const Inspector::PropertyValue newValue = 2;
+    const Inspector::PropertyChangedEvent event("width", oldValue, newValue, nullptr);
+
+    // A burst of 16 changes to one property, flushed once as a frame would
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        for (int change = 0; change < 16; ++change) {
+            dispatcher.dispatch(event);
+        }
+        queue.flush();
+    }
+    benchmark::DoNotOptimize(calls);
+}
+BENCHMARK(BM_DispatchDeferred)->RangeMultiplier(2)->Range(1, 64);
+
+static void BM_DispatchText(benchmark::State &state)
+{
+    Inspector::PropertyEventQueue queue;
+    Entities::Scene scene("bench", "Bench");
+    scene.getEventDispatcher().setQueue(&queue);
+    std::uint64_t calls = 0;
+    scene.getEventDispatcher().subscribe([&calls](const Inspector::PropertyChangedEvent &) { ++calls; });
+    scene.getEventDispatcher().subscribe([&calls](const Inspector::PropertyChangedEvent &) { ++calls; },
+                                         Inspector::DispatchMode::Deferred);
+    // Longer than the small-string buffer, so every copy of a value would allocate
+    const std::string names[] = {"The long hall under the old clock tower", "The long hall over the old clock tower"};
+    std::size_t next = 0;
+
+    // Typing into the name field: 16 edits a frame, flushed once
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        for (int change = 0; change < 16; ++change) {
+            scene.setName(names[next]);
+            next ^= 1;
+        }
+        queue.flush();
+    }
+    scene.getEventDispatcher().setQueue(nullptr);
+    benchmark::DoNotOptimize(calls);
+}
+BENCHMARK(BM_DispatchText);
+
+// =============================================================================
+// EDITOR REGISTRY
+// =============================================================================
+
+static void BM_RegistryGetEditor(benchmark::State &state)
+{
+    const Inspector::PropertyEditorRegistry registry;
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(registry.getEditor(Inspector::PropertyType::Int));
+    }
+}
+BENCHMARK(BM_RegistryGetEditor);
+
+static void BM_RegistryGetEditorForProperty(benchmark::State &state)
+{
+    const Inspector::PropertyEditorRegistry registry;
+    const Entities::Scene scene("bench", "Bench");
+    const auto descriptors = scene.getPropertySchema().getDescriptors();
+    std::size_t next = 0;
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(registry.getEditorForProperty(descriptors[next]));
+        next = (next + 1) % descriptors.size();
+    }
+}
+BENCHMARK(BM_RegistryGetEditorForProperty);
+
+static void BM_RegistryResolveEditors(benchmark::State &state)
+{
+    const Inspector::PropertyEditorRegistry registry;
+    const Entities::Scene scene("bench", "Bench");
+    const Inspector::PropertySchema &schema = scene.getPropertySchema();
+
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(registry.resolveEditors(schema));
+    }
+}
+BENCHMARK(BM_RegistryResolveEditors);
+
+// =============================================================================
+// IDS
+// =============================================================================
+
+static void BM_IdGeneratorNext(benchmark::State &state)
+{
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Core::IdGenerator::next());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IdGeneratorNext)->Threads(1)->Threads(4)->Threads(16);
+
+static void BM_IdGeneratorUuid(benchmark::State &state)
+{
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Core::IdGenerator::nextUuid());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IdGeneratorUuid)->Threads(1)->Threads(4)->Threads(16);
+
+static void BM_IdGeneratorEntityId(benchmark::State &state)
+{
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Core::IdGenerator::makeEntityId("scene"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IdGeneratorEntityId);
+
+// =============================================================================
+// CLIPBOARD
+// =============================================================================
+
+/**
+ * @brief A project of state.range(0) scenes in a chain of exits, and their handles
+ */
+static std::unique_ptr<Core::Project> makeClipboardSource(benchmark::State &state, std::vector<Core::EntityHandle> &handles)
+{
+    auto project = std::make_unique<Core::Project>("Source");
+    std::vector<Core::NewEntity> scenes;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        scenes.push_back({"scene_" + std::to_string(i), "Scene " + std::to_string(i)});
+    }
+    project->addScenes(scenes);
+    std::vector<std::pair<std::string_view, std::string_view>> exits;
+    for (std::size_t i = 1; i < scenes.size(); ++i) {
+        exits.emplace_back(scenes[i - 1].id, scenes[i].id);
+    }
+    project->addExits(exits);
+    for (const auto &scene : project->getScenes()) {
+        handles.push_back(scene->getHandle());
+    }
+    return project;
+}
+
+static void BM_ClipboardCopy(benchmark::State &state)
+{
+    std::vector<Core::EntityHandle> handles;
+    const auto source = makeClipboardSource(state, handles);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Core::EntityClipboard::copy(*source, handles));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ClipboardCopy)->Arg(2000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ClipboardPaste(benchmark::State &state)
+{
+    std::vector<Core::EntityHandle> handles;
+    const auto source = makeClipboardSource(state, handles);
+    const std::string payload = Core::EntityClipboard::copy(*source, handles);
+
+    // Every other id is taken in the target, so half the scenes are renamed
+    std::vector<Core::NewEntity> taken;
+    for (std::int64_t i = 0; i < state.range(0); i += 2) {
+        taken.push_back({"scene_" + std::to_string(i), "Taken"});
+    }
+    std::unique_ptr<Core::Project> target;
+    for (auto _: state) {
+        state.PauseTiming();
+        target = std::make_unique<Core::Project>("Target");
+        target->addScenes(taken);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(Core::EntityClipboard::paste(*target, payload));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ClipboardPaste)->Arg(2000)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// IMPORT
+// =============================================================================
+
+/**
+ * @brief A CSV source of state.range(0) scenes, each with an exit to the next
+ */
+static std::string makeImportSource(benchmark::State &state)
+{
+    std::string csv = "kind,id,name,description,exits\n";
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        csv += std::format("scene,scene_{0},Scene {0},\"A room, numbered {0}\",scene_{1}\n", i, (i + 1) % state.range(0));
+    }
+    return csv;
+}
+
+static void BM_ImportParseCsv(benchmark::State &state)
+{
+    const std::string csv = makeImportSource(state);
+    for (auto _: state) {
+        std::istringstream in(csv);
+        Core::CsvImportParser parser(in, ',');
+        Core::ImportBatch batch;
+        while (parser.read(batch)) {
+            benchmark::DoNotOptimize(batch.entities.data());
+            batch = {};
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(csv.size()));
+}
+BENCHMARK(BM_ImportParseCsv)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_ImportProject(benchmark::State &state)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "ads_import_bench.csv";
+    std::ofstream(path, std::ios::binary) << makeImportSource(state);
+
+    // Parsed inside poll(), so the figure is the whole pipeline on one thread
+    Core::ProjectImporter importer;
+    for (auto _: state) {
+        state.PauseTiming();
+        Core::Project project("Target");
+        state.ResumeTiming();
+        importer.start(path, nullptr);
+        while (!importer.poll(project)) {
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ImportProject)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Import state.range(0) items whose descriptions cycle through state.range(1) texts
+ *
+ * Reports the allocations of the import and the characters of description
+ * text the project ends up holding; with few distinct texts both fall as
+ * the items share their descriptions through the project's string pool.
+ */
+static void BM_ImportRepeatedText(benchmark::State &state)
+{
+    std::string csv = "kind,id,name,description\n";
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        csv += std::format("item,item_{0},Item {0},\"A worn leather pouch, model {1}, of no value\"\n", i, i % state.range(1));
+    }
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "ads_import_text_bench.csv";
+    std::ofstream(path, std::ios::binary) << csv;
+
+    Core::ProjectImporter importer;
+    size_t textBytes = 0;
+    AllocationCounter counter(state);
+    for (auto _: state) {
+        state.PauseTiming();
+        Core::Project project("Target");
+        state.ResumeTiming();
+        importer.start(path, nullptr);
+        while (!importer.poll(project)) {
+        }
+        textBytes = project.getStringPool().getBytes();
+    }
+    state.counters["textBytes"] = static_cast<double>(textBytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ImportRepeatedText)->Args({10000, 10000})->Args({10000, 16})->Unit(benchmark::kMillisecond);
+
+// =============================================================================
+// COLLABORATIVE SYNC
+// =============================================================================
+
+/**
+ * @brief A project of state.range(1) scenes followed by a sync session
+ */
+static std::unique_ptr<Core::Project> makeSyncProject(benchmark::State &state)
+{
+    auto project = std::make_unique<Core::Project>("Sync");
+    std::vector<Core::NewEntity> entries;
+    for (std::int64_t i = 0; i < state.range(1); ++i) {
+        entries.push_back({"scene_" + std::to_string(i), "Scene " + std::to_string(i)});
+    }
+    project->addScenes(entries);
+    return project;
+}
+
+/**
+ * @brief Rename the first state.range(0) scenes of a project
+ */
+static void editSyncProject(benchmark::State &state, Core::Project &project, int round)
+{
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        project.getScenes()[i]->setName(std::format("Renamed {} {}", round, i));
+    }
+}
+
+static void BM_SyncEncode(benchmark::State &state)
+{
+    const auto project = makeSyncProject(state);
+    Core::SyncSession session;
+    session.attach(*project);
+    const auto later = Core::SyncSession::Clock::now() + std::chrono::hours(1);
+    int round = 0;
+    size_t bytes = 0;
+    for (auto _: state) {
+        state.PauseTiming();
+        editSyncProject(state, *project, ++round);
+        state.ResumeTiming();
+        const std::string payload = session.takeOutgoing(later);
+        bytes = payload.size();
+        benchmark::DoNotOptimize(payload.data());
+    }
+    state.counters["bytes/edit"] = static_cast<double>(bytes) / static_cast<double>(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SyncEncode)->Args({1000, 1000})->Args({1000, 100000})->Unit(benchmark::kMicrosecond);
+
+static void BM_SyncApply(benchmark::State &state)
+{
+    const auto source = makeSyncProject(state);
+    const auto target = makeSyncProject(state);
+    Core::SyncSession sender;
+    Core::SyncSession receiver;
+    sender.attach(*source);
+    receiver.attach(*target);
+    const auto later = Core::SyncSession::Clock::now() + std::chrono::hours(1);
+    int round = 0;
+    for (auto _: state) {
+        state.PauseTiming();
+        editSyncProject(state, *source, ++round);
+        const std::string payload = sender.takeOutgoing(later);
+        state.ResumeTiming();
+        receiver.receive(payload);
+        while (receiver.applyRemote() > 0) {
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SyncApply)->Args({1000, 1000})->Args({1000, 100000})->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// COLUMN QUERIES
+// =============================================================================
+
+/**
+ * @brief A project of state.range(0) items with varied quantities
+ */
+static std::unique_ptr<Core::Project> makeItemProject(benchmark::State &state)
+{
+    auto project = std::make_unique<Core::Project>("Columns");
+    std::vector<Core::NewEntity> entries;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        entries.push_back({"item_" + std::to_string(i), "Item " + std::to_string(i)});
+    }
+    project->addItems(entries, [](Entities::Item &item, const size_t entry) {
+        item.setQuantity(static_cast<int>(entry * 7919 % 50));
+        item.setPickable(entry % 3 != 0);
+    });
+    return project;
+}
+
+// "Pickable items with a quantity above 10, and how many units they hold"
+static void BM_ColumnQuery(benchmark::State &state)
+{
+    const auto project = makeItemProject(state);
+
+    for (auto _: state) {
+        const Core::ColumnQuery query = project->query(Core::EntityKind::Item)
+            .where("quantity", Core::Compare::Greater, 10)
+            .where("isPickable", true);
+        benchmark::DoNotOptimize(query.sum("quantity"));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnQuery)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// The same question through each entity's getPropertyValue()
+static void BM_PropertyValueScan(benchmark::State &state)
+{
+    const auto project = makeItemProject(state);
+    const std::string quantityId = "quantity";
+    const std::string pickableId = "isPickable";
+
+    for (auto _: state) {
+        double sum = 0;
+        for (const auto &item : project->getItems()) {
+            const int quantity = std::get<int>(item->getPropertyValue(quantityId));
+            if (quantity > 10 && std::get<bool>(item->getPropertyValue(pickableId))) {
+                sum += quantity;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PropertyValueScan)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
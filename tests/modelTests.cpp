@@ -0,0 +1,544 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file modelTests.cpp
+ * @brief Google Test suite for the core data model
+ *
+ * Covers entity storage, the import parsers, the project file formats and
+ * their autosave journal, and the invariants the rest of the model relies
+ * on. It links model_lib alone, no window or renderer.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "Core/BinaryProjectFile.h"
+#include "Core/CsvImportParser.h"
+#include "Core/EntityCollection.h"
+#include "Core/IdGenerator.h"
+#include "Core/JsonProjectSerializer.h"
+#include "Core/MappedTextSource.h"
+#include "Core/Project.h"
+#include "Core/ProjectJournal.h"
+#include "Core/ProjectStorage.h"
+#include "project/project_format_exception.h"
+
+using namespace ADS;
+
+// =============================================================================
+// HELPER FUNCTIONS
+// =============================================================================
+
+namespace {
+
+    /**
+     * @brief Entity whose constructor throws on demand
+     */
+    class FragileEntity {
+    public:
+        static inline bool failNext = false;
+
+        FragileEntity(const std::string& id, const std::string& name) : m_id(id), m_name(name) {
+            if (failNext) {
+                failNext = false;
+                throw std::runtime_error("construction failed");
+            }
+        }
+
+        [[nodiscard]] const std::string& getId() const { return m_id; }
+        [[nodiscard]] const std::string& getName() const { return m_name; }
+
+    private:
+        std::string m_id;
+        std::string m_name;
+    };
+
+    /**
+     * @brief Description long enough to be bound lazily when read from a `.ads` file
+     */
+    std::string longText(const std::string& seed)
+    {
+        std::string text;
+        while (text.size() < Core::BinaryFormat::LAZY_TEXT_MIN_BYTES) {
+            text += seed + " ";
+        }
+        return text;
+    }
+
+    /**
+     * @brief Small project that sets every field the file formats store
+     */
+    std::unique_ptr<Core::Project> makeSampleProject()
+    {
+        auto project = std::make_unique<Core::Project>("Sample");
+        Entities::Scene* hall = project->addScene("hall", "Hall");
+        hall->setDescription(longText("A cold hall with a marble floor."));
+        hall->setStartScene(true);
+        hall->setBackgroundColor(ImVec4(0.25f, 0.5f, 0.75f, 1.0f));
+        hall->setWidth(640);
+        hall->setHeight(480);
+        project->addScene("cellar", "Cellar")->setDescription("Damp.");
+        project->addExit("hall", "cellar");
+
+        Entities::Character* guard = project->addCharacter("guard", "Guard");
+        guard->setDescription("Asleep.");
+        guard->setMaxHealth(10);
+        guard->setHealth(7);
+        guard->setDialogColor(ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
+        project->addCharacter("hero", "Hero")->setPlayer(true);
+
+        Entities::Item* lamp = project->addItem("lamp", "Lamp");
+        lamp->setDescription(longText("A brass lamp."));
+        lamp->setQuantity(2);
+        lamp->setItemType(1);
+        lamp->setPickable(true);
+        lamp->setUsable(false);
+        return project;
+    }
+
+    /**
+     * @brief Description text of an entity, empty if it has none
+     */
+    template<typename T>
+    std::string descriptionOf(const T& entity)
+    {
+        const auto description = entity.getDescription();
+        return description ? *description : std::string();
+    }
+
+    /**
+     * @brief Expect two projects to hold the same entities, fields and exits
+     */
+    void expectSameProject(const Core::Project& expected, const Core::Project& actual)
+    {
+        EXPECT_EQ(expected.getName(), actual.getName());
+
+        ASSERT_EQ(expected.getScenes().size(), actual.getScenes().size());
+        for (const auto& scene : expected.getScenes()) {
+            const Entities::Scene* other = actual.findScene(scene->getId());
+            ASSERT_NE(nullptr, other) << scene->getId();
+            EXPECT_EQ(scene->getName(), other->getName());
+            EXPECT_EQ(descriptionOf(*scene), descriptionOf(*other));
+            EXPECT_EQ(scene->isStartScene(), other->isStartScene());
+            EXPECT_EQ(scene->getBackgroundColor().x, other->getBackgroundColor().x);
+            EXPECT_EQ(scene->getBackgroundColor().w, other->getBackgroundColor().w);
+            EXPECT_EQ(scene->getWidth(), other->getWidth());
+            EXPECT_EQ(scene->getHeight(), other->getHeight());
+
+            std::vector<std::string> exits;
+            for (const Entities::Scene* target : expected.getExits(*scene)) {
+                exits.push_back(target->getId());
+            }
+            std::vector<std::string> otherExits;
+            for (const Entities::Scene* target : actual.getExits(*other)) {
+                otherExits.push_back(target->getId());
+            }
+            std::ranges::sort(exits);
+            std::ranges::sort(otherExits);
+            EXPECT_EQ(exits, otherExits) << scene->getId();
+        }
+
+        ASSERT_EQ(expected.getCharacters().size(), actual.getCharacters().size());
+        for (const auto& character : expected.getCharacters()) {
+            const Entities::Character* other = actual.findCharacter(character->getId());
+            ASSERT_NE(nullptr, other) << character->getId();
+            EXPECT_EQ(character->getName(), other->getName());
+            EXPECT_EQ(descriptionOf(*character), descriptionOf(*other));
+            EXPECT_EQ(character->getHealth(), other->getHealth());
+            EXPECT_EQ(character->getMaxHealth(), other->getMaxHealth());
+            EXPECT_EQ(character->isPlayer(), other->isPlayer());
+            EXPECT_EQ(character->getDialogColor().x, other->getDialogColor().x);
+        }
+
+        ASSERT_EQ(expected.getItems().size(), actual.getItems().size());
+        for (const auto& item : expected.getItems()) {
+            const Entities::Item* other = actual.findItem(item->getId());
+            ASSERT_NE(nullptr, other) << item->getId();
+            EXPECT_EQ(item->getName(), other->getName());
+            EXPECT_EQ(descriptionOf(*item), descriptionOf(*other));
+            EXPECT_EQ(item->getQuantity(), other->getQuantity());
+            EXPECT_EQ(item->getItemType(), other->getItemType());
+            EXPECT_EQ(item->isPickable(), other->isPickable());
+            EXPECT_EQ(item->isUsable(), other->isUsable());
+        }
+    }
+
+    /**
+     * @brief Read a whole file
+     */
+    std::string readFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    /**
+     * @brief Replace a whole file
+     */
+    void writeFile(const std::filesystem::path& path, const std::string& bytes)
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+    }
+}
+
+/**
+ * @brief Fixture giving each test an empty folder for project files
+ */
+class ProjectFileTests : public ::testing::Test {
+protected:
+    std::filesystem::path folder;
+
+    void SetUp() override
+    {
+        folder = std::filesystem::temp_directory_path()
+            / ("ads_model_tests_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(folder);
+        std::filesystem::create_directories(folder);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(folder);
+    }
+};
+
+// =============================================================================
+// ENTITY COLLECTION
+// =============================================================================
+
+TEST(EntityCollectionTests, FailedConstructionLeavesNoIndexEntry)
+{
+    Core::EntityCollection<FragileEntity> collection;
+    ASSERT_NE(nullptr, collection.add("a", "A"));
+
+    FragileEntity::failNext = true;
+    EXPECT_THROW(collection.add("b", "B"), std::runtime_error);
+
+    EXPECT_EQ(1u, collection.size());
+    EXPECT_EQ(nullptr, collection.find("b"));
+
+    // The id is free again and positions stay in range
+    FragileEntity* b = collection.add("b", "B");
+    ASSERT_NE(nullptr, b);
+    EXPECT_EQ(b, collection.find("b"));
+    EXPECT_EQ("A", collection.find("a")->getName());
+    EXPECT_EQ(2u, collection.size());
+}
+
+// =============================================================================
+// ID GENERATOR
+// =============================================================================
+
+TEST(IdGeneratorTests, EntityIdsSortInTheOrderTheyWereMade)
+{
+    std::string previous = Core::IdGenerator::makeEntityId("scene");
+    for (int i = 0; i < 10000; ++i) {
+        std::string id = Core::IdGenerator::makeEntityId("scene");
+        ASSERT_EQ(previous.size(), id.size());
+        ASSERT_LT(previous, id);
+        previous = std::move(id);
+    }
+}
+
+#ifndef _WIN32
+TEST(IdGeneratorTests, EntityIdsOfTwoProcessesDoNotOverlap)
+{
+    constexpr int COUNT = 100000;
+    constexpr size_t ID_SIZE = 32;      // "scene_" and 26 digits
+
+    // The child inherits the state of this thread, random streams included
+    ASSERT_EQ(ID_SIZE, Core::IdGenerator::makeEntityId("scene").size());
+
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    const pid_t child = fork();
+    ASSERT_NE(-1, child);
+    if (child == 0) {
+        close(fds[0]);
+        std::string out;
+        out.reserve(COUNT * ID_SIZE);
+        for (int i = 0; i < COUNT; ++i) {
+            out += Core::IdGenerator::makeEntityId("scene");
+        }
+        size_t written = 0;
+        while (written < out.size()) {
+            const ssize_t n = write(fds[1], out.data() + written, out.size() - written);
+            if (n <= 0) {
+                _exit(1);
+            }
+            written += static_cast<size_t>(n);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+
+    std::vector<std::string> ids;
+    ids.reserve(2 * COUNT);
+    for (int i = 0; i < COUNT; ++i) {
+        ids.push_back(Core::IdGenerator::makeEntityId("scene"));
+    }
+
+    std::string in;
+    char buffer[65536];
+    ssize_t n;
+    while ((n = read(fds[0], buffer, sizeof(buffer))) > 0) {
+        in.append(buffer, static_cast<size_t>(n));
+    }
+    close(fds[0]);
+    int status = 0;
+    waitpid(child, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    ASSERT_EQ(COUNT * ID_SIZE, in.size());
+
+    for (size_t offset = 0; offset < in.size(); offset += ID_SIZE) {
+        ids.push_back(in.substr(offset, ID_SIZE));
+    }
+    std::ranges::sort(ids);
+    EXPECT_EQ(ids.end(), std::ranges::adjacent_find(ids));
+}
+#endif
+
+// =============================================================================
+// PROJECT FILES
+// =============================================================================
+
+TEST_F(ProjectFileTests, BinaryFileReadsBackWhatWasWritten)
+{
+    const auto project = makeSampleProject();
+    const std::filesystem::path path = folder / "sample.ads";
+    Core::BinaryProjectFile::write(*project, path);
+
+    const Core::BinaryProjectFile file(path);
+    EXPECT_EQ("Sample", file.getProjectName());
+    EXPECT_EQ(2u, file.getScenes().size());
+    EXPECT_EQ(1u, file.getExits().size());
+    expectSameProject(*project, *file.toProject(path));
+
+    // Loaded through the facade the long descriptions stay in the mapping until read
+    expectSameProject(*project, *Core::ProjectStorage::load(path));
+}
+
+TEST_F(ProjectFileTests, BinaryFileRejectsTruncation)
+{
+    const std::filesystem::path path = folder / "sample.ads";
+    Core::BinaryProjectFile::write(*makeSampleProject(), path);
+    const std::string bytes = readFile(path);
+
+    for (const size_t size : {bytes.size() - 1, bytes.size() / 2, sizeof(Core::BinaryFormat::FileHeader) + 1}) {
+        writeFile(path, bytes.substr(0, size));
+        EXPECT_THROW(Core::BinaryProjectFile{path}, Exceptions::project_format_exception) << size << " bytes";
+    }
+    writeFile(path, bytes.substr(0, 4));
+    EXPECT_THROW(Core::BinaryProjectFile{path}, Exceptions::project_format_exception);
+}
+
+TEST_F(ProjectFileTests, BinaryFileRejectsABadDirectory)
+{
+    using Core::BinaryFormat::FileHeader;
+    using Core::BinaryFormat::SectionEntry;
+    const std::filesystem::path path = folder / "sample.ads";
+    Core::BinaryProjectFile::write(*makeSampleProject(), path);
+    const std::string bytes = readFile(path);
+
+    // Each change to the header or the first directory entry must be caught on open
+    const auto corrupt = [&](auto change) {
+        std::string copy = bytes;
+        FileHeader header;
+        SectionEntry section;
+        std::memcpy(&header, copy.data(), sizeof(header));
+        std::memcpy(&section, copy.data() + sizeof(header), sizeof(section));
+        change(header, section);
+        std::memcpy(copy.data(), &header, sizeof(header));
+        std::memcpy(copy.data() + sizeof(header), &section, sizeof(section));
+        writeFile(path, copy);
+        EXPECT_THROW(Core::BinaryProjectFile{path}, Exceptions::project_format_exception);
+    };
+    corrupt([](FileHeader& header, SectionEntry&) { header.magic[0] = 'X'; });
+    corrupt([](FileHeader& header, SectionEntry&) { header.versionMajor += 1; });
+    corrupt([](FileHeader& header, SectionEntry&) { header.byteOrderMark = 0x04030201; });
+    corrupt([](FileHeader& header, SectionEntry&) { header.sectionCount = 1000000; });
+    corrupt([&bytes](FileHeader&, SectionEntry& section) { section.offset = bytes.size(); section.size = 8; });
+    corrupt([](FileHeader&, SectionEntry& section) { section.offset = 0; });
+    corrupt([](FileHeader&, SectionEntry& section) { section.count += 1; });
+}
+
+TEST_F(ProjectFileTests, SavingOverAMappedFileReleasesTheMapping)
+{
+    const auto original = makeSampleProject();
+    const std::filesystem::path path = folder / "sample.ads";
+    const std::filesystem::path other = folder / "other.ads";
+    Core::BinaryProjectFile::write(*original, path);
+    Core::BinaryProjectFile::write(*original, other);
+
+    auto file = std::make_shared<const Core::BinaryProjectFile>(path);
+    const auto source = std::make_shared<Core::MappedTextSource>(file);
+    const auto project = file->toProject(path, source);
+    file.reset();
+    const auto otherSource = std::make_shared<Core::MappedTextSource>(
+        std::make_shared<const Core::BinaryProjectFile>(other));
+
+    // Nothing read yet: the long descriptions are still in the old file
+    project->setName("Sample, saved again");
+    Core::ProjectStorage::save(*project, path);
+    EXPECT_FALSE(source->isMapped());
+    EXPECT_TRUE(otherSource->isMapped());
+
+    EXPECT_EQ(descriptionOf(*original->findScene("hall")), descriptionOf(*project->findScene("hall")));
+    EXPECT_EQ(descriptionOf(*original->findItem("lamp")), descriptionOf(*project->findItem("lamp")));
+    expectSameProject(*project, *Core::ProjectStorage::load(path));
+}
+
+TEST_F(ProjectFileTests, JsonFileReadsBackWhatWasWritten)
+{
+    const auto project = makeSampleProject();
+
+    std::stringstream stream;
+    Core::JsonProjectSerializer::write(*project, stream);
+    const auto fromStream = Core::JsonProjectSerializer::read(stream, "memory");
+    expectSameProject(*project, *fromStream);
+    EXPECT_FALSE(fromStream->isDirty());
+
+    const std::filesystem::path path = folder / "sample.adsproj";
+    Core::ProjectStorage::write(*project, path);
+    expectSameProject(*project, *Core::ProjectStorage::load(path));
+}
+
+TEST_F(ProjectFileTests, JsonFileRejectsAnotherFormat)
+{
+    std::stringstream stream(R"({"format": "something-else", "version": 1})");
+    EXPECT_THROW(Core::JsonProjectSerializer::read(stream, "memory"), Exceptions::project_format_exception);
+}
+
+// =============================================================================
+// AUTOSAVE JOURNAL
+// =============================================================================
+
+TEST_F(ProjectFileTests, AutosaveIsReplayedOnLoad)
+{
+    const std::filesystem::path path = folder / "sample.ads";
+    auto project = makeSampleProject();
+    Core::ProjectStorage::save(*project, path);
+    EXPECT_FALSE(Core::ProjectStorage::autosave(*project));
+
+    project->setName("Sample, edited");
+    project->findItem("lamp")->setDescription("A dented lamp.");
+    project->addItem("key", "Key")->setQuantity(3);
+    project->removeCharacter("guard");
+    project->addScene("attic", "Attic");
+    project->addExit("cellar", "attic");
+    ASSERT_TRUE(Core::ProjectStorage::autosave(*project));
+    EXPECT_FALSE(project->isDirty());
+    EXPECT_TRUE(std::filesystem::exists(Core::ProjectJournal::pathFor(path)));
+
+    // Changes of a second autosave follow the first
+    project->findItem("key")->setQuantity(4);
+    ASSERT_TRUE(Core::ProjectStorage::autosave(*project));
+
+    const auto loaded = Core::ProjectStorage::load(path);
+    expectSameProject(*project, *loaded);
+    EXPECT_FALSE(loaded->isDirty());
+
+    // A full save folds the journal into the base file
+    Core::ProjectStorage::save(*project, path);
+    EXPECT_FALSE(std::filesystem::exists(Core::ProjectJournal::pathFor(path)));
+    expectSameProject(*project, *Core::ProjectStorage::load(path));
+}
+
+TEST_F(ProjectFileTests, LargeJournalIsCompactedIntoTheBaseFile)
+{
+    const std::filesystem::path path = folder / "sample.ads";
+    const std::filesystem::path journal = Core::ProjectJournal::pathFor(path);
+    auto project = makeSampleProject();
+    Core::ProjectStorage::save(*project, path);
+
+    // Each autosave appends the whole description again
+    bool compacted = false;
+    for (int round = 0; round < 100 && !compacted; ++round) {
+        project->findScene("cellar")->setDescription(std::string(64 * 1024, static_cast<char>('a' + round % 26)));
+        ASSERT_TRUE(Core::ProjectStorage::autosave(*project));
+        compacted = !std::filesystem::exists(journal);
+    }
+    ASSERT_TRUE(compacted);
+    EXPECT_GE(std::filesystem::file_size(path), 64u * 1024);
+    expectSameProject(*project, *Core::ProjectStorage::load(path));
+
+    // Autosave carries on from the compacted file
+    project->findItem("lamp")->setQuantity(9);
+    ASSERT_TRUE(Core::ProjectStorage::autosave(*project));
+    EXPECT_TRUE(std::filesystem::exists(journal));
+    expectSameProject(*project, *Core::ProjectStorage::load(path));
+}
+
+TEST_F(ProjectFileTests, TruncatedJournalEntryIsIgnored)
+{
+    const std::filesystem::path path = folder / "sample.ads";
+    const std::filesystem::path journal = Core::ProjectJournal::pathFor(path);
+    auto project = makeSampleProject();
+    Core::ProjectStorage::save(*project, path);
+
+    project->findItem("lamp")->setQuantity(5);
+    ASSERT_TRUE(Core::ProjectStorage::autosave(*project));
+    const uintmax_t complete = std::filesystem::file_size(journal);
+    project->findItem("lamp")->setQuantity(6);
+    ASSERT_TRUE(Core::ProjectStorage::autosave(*project));
+
+    // A crash in the middle of the second append
+    std::filesystem::resize_file(journal, complete + (std::filesystem::file_size(journal) - complete) / 2);
+    EXPECT_EQ(5, Core::ProjectStorage::load(path)->findItem("lamp")->getQuantity());
+}
+
+// =============================================================================
+// IMPORT PARSERS
+// =============================================================================
+
+TEST(CsvImportParserTests, ByteOrderMarkIsNotPartOfTheFirstColumn)
+{
+    std::istringstream in("\xEF\xBB\xBFkind,name\nitem,Lamp\ncharacter,Guard\n");
+    Core::CsvImportParser parser(in, ',');
+    Core::ImportBatch batch;
+    while (parser.read(batch)) {
+    }
+
+    ASSERT_EQ(2u, batch.entities.size());
+    EXPECT_EQ(Core::EntityKind::Item, batch.entities[0].kind);
+    EXPECT_EQ("Lamp", batch.entities[0].name);
+    EXPECT_EQ(Core::EntityKind::Character, batch.entities[1].kind);
+    EXPECT_EQ(0u, parser.getSkipped());
+}
+
+TEST(CsvImportParserTests, ByteOrderMarkIsOnlyStrippedFromTheFirstLine)
+{
+    std::istringstream in("name,description\nLamp,\xEF\xBB\xBFlit\n");
+    Core::CsvImportParser parser(in, ',');
+    Core::ImportBatch batch;
+    while (parser.read(batch)) {
+    }
+
+    ASSERT_EQ(1u, batch.entities.size());
+    EXPECT_EQ("\xEF\xBB\xBFlit", batch.entities[0].description);
+}
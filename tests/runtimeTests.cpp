@@ -0,0 +1,1232 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file runtimeTests.cpp
+ * @brief Google Test suite for the game runtime and the 8-bit compiler
+ *
+ * Covers NaN-boxed values, the bytecode verifier (against an independent
+ * model of its rules, on random programs), the virtual machine (against a
+ * reference interpreter, and its instruction limit), copy-on-write game
+ * state, trigger cascades, the watch list, the lexicon, the play-through
+ * fuzzer, text compression and the budget packer (against brute force).
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Compiler/BudgetPacker.h"
+#include "Compiler/TextCompressor.h"
+#include "Core/JobSystem.h"
+#include "Core/Project.h"
+#include "Entities/Item.h"
+#include "Runtime/GameState.h"
+#include "Runtime/Lexicon.h"
+#include "Runtime/PlaythroughFuzzer.h"
+#include "Runtime/Program.h"
+#include "Runtime/TriggerEngine.h"
+#include "Runtime/Value.h"
+#include "Runtime/VirtualMachine.h"
+#include "Runtime/WatchList.h"
+#include "runtime/bytecode_exception.h"
+
+using namespace ADS;
+using namespace ADS::Runtime;
+using Exceptions::bytecode_exception;
+
+// =============================================================================
+// HELPER FUNCTIONS
+// =============================================================================
+
+namespace {
+
+    /**
+     * @brief Emit "G[global] = value" using register 0
+     */
+    void emitSetNumber(ProgramBuilder& builder, const std::string& global, const double value)
+    {
+        builder.emitBx(OpCode::LoadConst, 0, builder.constant(Value::number(value)));
+        builder.emitBx(OpCode::SetGlobal, 0, builder.global(global));
+    }
+
+    /**
+     * @brief Emit "R[2] = G[global] == value" using registers 0 to 2
+     */
+    void emitGlobalEquals(ProgramBuilder& builder, const std::string& global, const double value)
+    {
+        builder.emitBx(OpCode::GetGlobal, 0, builder.global(global));
+        builder.emitBx(OpCode::LoadConst, 1, builder.constant(Value::number(value)));
+        builder.emit(OpCode::Equal, 2, 0, 1);
+    }
+
+    /**
+     * @brief Define a function of no arguments returning G[global] == value
+     */
+    void defineCondition(ProgramBuilder& builder, const std::string& name, const std::string& global, const double value)
+    {
+        builder.beginFunction(name, 0, 3);
+        emitGlobalEquals(builder, global, value);
+        builder.emit(OpCode::Return, 2);
+        builder.endFunction();
+    }
+
+    /**
+     * @brief Define a function of no arguments setting G[global] = value
+     */
+    void defineAction(ProgramBuilder& builder, const std::string& name, const std::string& global, const double value)
+    {
+        builder.beginFunction(name, 0, 1);
+        emitSetNumber(builder, global, value);
+        builder.emit(OpCode::ReturnNil);
+        builder.endFunction();
+    }
+
+    /**
+     * @brief Define a command that moves from one room to another, and does nothing elsewhere
+     */
+    void defineMove(ProgramBuilder& builder, const std::string& name, const double from, const double to)
+    {
+        builder.beginFunction(name, 0, 3);
+        const ProgramBuilder::Label done = builder.newLabel();
+        emitGlobalEquals(builder, "room", from);
+        builder.emitJump(OpCode::JumpIfFalse, 2, done);
+        emitSetNumber(builder, "room", to);
+        builder.bind(done);
+        builder.emit(OpCode::ReturnNil);
+        builder.endFunction();
+    }
+
+    /**
+     * @brief Whether the verifier should accept a one-function program, written from Program.h alone
+     *
+     * @param program Tables of the program; its only function is checked
+     */
+    bool shouldVerify(const Program& program, const Function& function)
+    {
+        if (function.code.empty()) {
+            return false;
+        }
+        const auto inRegisters = [&function](std::initializer_list<uint8_t> operands) {
+            return std::ranges::all_of(operands, [&function](const uint8_t r) { return r < function.registerCount; });
+        };
+        for (size_t index = 0; index < function.code.size(); ++index) {
+            const Instruction& i = function.code[index];
+            bool valid = true;
+            switch (i.op) {
+                case OpCode::LoadConst:
+                    valid = inRegisters({i.a}) && i.bx() < program.constants.size();
+                    break;
+                case OpCode::GetGlobal:
+                case OpCode::SetGlobal:
+                    valid = inRegisters({i.a}) && i.bx() < program.globals.size();
+                    break;
+                case OpCode::LoadNil:
+                case OpCode::LoadBool:
+                case OpCode::Return:
+                    valid = inRegisters({i.a});
+                    break;
+                case OpCode::Move:
+                case OpCode::Negate:
+                case OpCode::Not:
+                    valid = inRegisters({i.a, i.b});
+                    break;
+                case OpCode::Add:
+                case OpCode::Subtract:
+                case OpCode::Multiply:
+                case OpCode::Divide:
+                case OpCode::Modulo:
+                case OpCode::Equal:
+                case OpCode::Less:
+                case OpCode::LessEqual:
+                    valid = inRegisters({i.a, i.b, i.c});
+                    break;
+                case OpCode::Jump:
+                case OpCode::JumpIfFalse:
+                case OpCode::JumpIfTrue: {
+                    const int64_t target = static_cast<int64_t>(index) + 1 + i.sbx();
+                    valid = (i.op == OpCode::Jump || inRegisters({i.a}))
+                        && target >= 0 && target < static_cast<int64_t>(function.code.size());
+                    break;
+                }
+                case OpCode::Call:
+                    valid = i.bx() < program.functions.size()
+                        && i.a + program.functions[i.bx()].parameterCount < function.registerCount;
+                    break;
+                case OpCode::CallNative:
+                    valid = i.bx() < program.natives.size()
+                        && i.a + program.natives[i.bx()].parameterCount < function.registerCount;
+                    break;
+                case OpCode::ReturnNil:
+                    break;
+                default:
+                    valid = false;
+            }
+            if (!valid) {
+                return false;
+            }
+        }
+        const OpCode last = function.code.back().op;
+        return last == OpCode::Return || last == OpCode::ReturnNil || last == OpCode::Jump;
+    }
+
+    /**
+     * @brief Outcome of the reference interpreter: a value, or a type error
+     */
+    struct Reference {
+        std::optional<Value> value;
+    };
+
+    /**
+     * @brief Run straight-line code with forward conditional skips, the way OpCode documents each instruction
+     */
+    Reference interpret(const Program& program, const Function& function)
+    {
+        std::vector<Value> registers(function.registerCount);
+        for (size_t pc = 0; pc < function.code.size();) {
+            const Instruction& i = function.code[pc++];
+            const Value b = registers[i.b];
+            const Value c = registers[i.c];
+            const auto numbers = [&b, &c] { return b.isNumber() && c.isNumber(); };
+            switch (i.op) {
+                case OpCode::LoadConst: registers[i.a] = program.constants[i.bx()]; break;
+                case OpCode::Move:      registers[i.a] = b; break;
+                case OpCode::Not:       registers[i.a] = Value::boolean(!b.isTruthy()); break;
+                case OpCode::Equal:     registers[i.a] = Value::boolean(b == c); break;
+                case OpCode::Negate:
+                    if (!b.isNumber()) return {};
+                    registers[i.a] = Value::number(-b.asNumber());
+                    break;
+                case OpCode::Add:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::number(b.asNumber() + c.asNumber());
+                    break;
+                case OpCode::Subtract:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::number(b.asNumber() - c.asNumber());
+                    break;
+                case OpCode::Multiply:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::number(b.asNumber() * c.asNumber());
+                    break;
+                case OpCode::Divide:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::number(b.asNumber() / c.asNumber());
+                    break;
+                case OpCode::Modulo:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::number(b.asNumber() - std::floor(b.asNumber() / c.asNumber()) * c.asNumber());
+                    break;
+                case OpCode::Less:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::boolean(b.asNumber() < c.asNumber());
+                    break;
+                case OpCode::LessEqual:
+                    if (!numbers()) return {};
+                    registers[i.a] = Value::boolean(b.asNumber() <= c.asNumber());
+                    break;
+                case OpCode::JumpIfFalse:
+                    if (!registers[i.a].isTruthy()) pc += i.sbx();
+                    break;
+                case OpCode::JumpIfTrue:
+                    if (registers[i.a].isTruthy()) pc += i.sbx();
+                    break;
+                case OpCode::Return:
+                    return {registers[i.a]};
+                default:
+                    ADD_FAILURE() << "Unexpected opcode " << static_cast<int>(i.op);
+                    return {};
+            }
+        }
+        ADD_FAILURE() << "Ran off the end";
+        return {};
+    }
+
+    /**
+     * @brief A game of three rooms: 0 to start, 1 to win, and 2, a pit with no way out
+     */
+    Program makeRoomsGame()
+    {
+        ProgramBuilder builder;
+        defineAction(builder, "start", "room", 0);
+        defineMove(builder, "north", 0, 1);
+        defineMove(builder, "south", 1, 0);
+        defineMove(builder, "jump", 0, 2);
+        defineCondition(builder, "won", "room", 1);
+        return builder.build();
+    }
+}
+
+// =============================================================================
+// VALUE
+// =============================================================================
+
+TEST(ValueTests, EveryTypeReadsBackAsItself)
+{
+    EXPECT_EQ(Value::Type::Nil, Value::nil().type());
+    EXPECT_EQ(Value::Type::Bool, Value::boolean(true).type());
+    EXPECT_TRUE(Value::boolean(true).asBool());
+    EXPECT_FALSE(Value::boolean(false).asBool());
+    EXPECT_EQ(Value::Type::Number, Value::number(-2.5).type());
+    EXPECT_EQ(-2.5, Value::number(-2.5).asNumber());
+    EXPECT_EQ(Value::Type::String, Value::string(7).type());
+    EXPECT_EQ(7u, Value::string(7).asIndex());
+    EXPECT_EQ(Value::Type::Entity, Value::entity(0xFFFFFFFFu).type());
+    EXPECT_EQ(0xFFFFFFFFu, Value::entity(0xFFFFFFFFu).asIndex());
+    EXPECT_EQ(Value::string(3), Value::fromBits(Value::string(3).bits()));
+}
+
+TEST(ValueTests, NaNStaysANumber)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(Value::number(nan).isNumber());
+    EXPECT_TRUE(Value::number(-nan).isNumber());
+    EXPECT_TRUE(Value::number(std::numeric_limits<double>::infinity()).isNumber());
+    EXPECT_NE(Value::number(nan), Value::number(nan));
+}
+
+TEST(ValueTests, OnlyNilAndFalseAreFalsy)
+{
+    EXPECT_FALSE(Value::nil().isTruthy());
+    EXPECT_FALSE(Value::boolean(false).isTruthy());
+    EXPECT_TRUE(Value::number(0).isTruthy());
+    EXPECT_TRUE(Value::string(0).isTruthy());
+    EXPECT_TRUE(Value::boolean(true).isTruthy());
+    EXPECT_NE(Value::number(0), Value::boolean(false));
+    EXPECT_EQ(Value::number(0.0), Value::number(-0.0));
+}
+
+// =============================================================================
+// PROGRAM BUILDER
+// =============================================================================
+
+TEST(ProgramBuilderTests, InternsEveryTable)
+{
+    ProgramBuilder builder;
+    EXPECT_EQ(builder.string("lamp"), builder.string("lamp"));
+    EXPECT_NE(builder.string("lamp"), builder.string("key"));
+    EXPECT_EQ(builder.constant(Value::number(4)), builder.constant(Value::number(4)));
+    EXPECT_EQ(builder.global("score"), builder.global("score"));
+    EXPECT_EQ(builder.native("say", 1), builder.native("say", 1));
+    EXPECT_THROW(builder.native("say", 2), bytecode_exception);
+    EXPECT_EQ(builder.function("later"), builder.function("later"));
+}
+
+TEST(ProgramBuilderTests, RejectsMalformedFunctions)
+{
+    {
+        ProgramBuilder builder;
+        builder.beginFunction("f", 0, 1);
+        builder.emit(OpCode::Add, 0, 1, 0);
+        builder.emit(OpCode::ReturnNil);
+        builder.endFunction();
+        EXPECT_THROW(builder.build(), bytecode_exception);
+    }
+    {
+        ProgramBuilder builder;
+        builder.beginFunction("f", 0, 1);
+        builder.emit(OpCode::LoadNil, 0);
+        builder.endFunction();
+        EXPECT_THROW(builder.build(), bytecode_exception);
+    }
+    {
+        ProgramBuilder builder;
+        builder.beginFunction("f", 0, 1);
+        builder.emitJump(OpCode::Jump, 0, builder.newLabel());
+        EXPECT_THROW(builder.endFunction(), bytecode_exception);
+    }
+    {
+        ProgramBuilder builder;
+        builder.beginFunction("f", 0, 2);
+        builder.emitBx(OpCode::Call, 0, builder.function("missing"));
+        builder.emit(OpCode::ReturnNil);
+        builder.endFunction();
+        EXPECT_THROW(builder.build(), bytecode_exception);
+    }
+    {
+        ProgramBuilder builder;
+        EXPECT_THROW(builder.beginFunction("f", 2, 1), bytecode_exception);
+    }
+}
+
+TEST(ProgramBuilderTests, VerifierAgreesWithTheRulesOnRandomPrograms)
+{
+    std::mt19937_64 random(88);
+    size_t accepted = 0;
+    size_t rejected = 0;
+    for (int round = 0; round < 20000; ++round) {
+        // The tables the builder below ends up with
+        Program model;
+        model.constants = {Value::number(1), Value::string(0)};
+        model.globals = {"a"};
+        model.natives = {{"say", 1}};
+        Function function{"f", 0, static_cast<uint8_t>(1 + random() % 6), {}};
+        const size_t length = 1 + random() % 6;
+        for (size_t index = 0; index < length; ++index) {
+            // Some past the last opcode, and small operands and offsets so that many programs are valid
+            const auto op = static_cast<OpCode>(random() % (static_cast<size_t>(OpCode::Count) + 3));
+            const auto a = static_cast<uint8_t>(random() % 8);
+            if (random() % 2 == 0) {
+                const auto offset = static_cast<uint16_t>(static_cast<int16_t>(static_cast<int>(random() % 9) - 4));
+                function.code.push_back({op, a, static_cast<uint8_t>(offset & 0xFF), static_cast<uint8_t>(offset >> 8)});
+            } else {
+                function.code.push_back({op, a, static_cast<uint8_t>(random() % 8), static_cast<uint8_t>(random() % 8)});
+            }
+        }
+        model.functions = {function};
+
+        ProgramBuilder builder;
+        builder.constant(Value::number(1));
+        builder.constant(Value::string(0));
+        builder.global("a");
+        builder.native("say", 1);
+        builder.beginFunction("f", 0, function.registerCount);
+        for (const Instruction& instruction : function.code) {
+            builder.emit(instruction.op, instruction.a, instruction.b, instruction.c);
+        }
+        builder.endFunction();
+
+        const bool expected = shouldVerify(model, function);
+        std::optional<Program> program;
+        try {
+            program = builder.build();
+        } catch (const bytecode_exception&) {
+        }
+        ASSERT_EQ(expected, program.has_value()) << "Disagreement on round " << round;
+        if (!program) {
+            ++rejected;
+            continue;
+        }
+        ++accepted;
+
+        // Whatever a verified program does, it ends, and says why if it failed
+        VirtualMachine machine(*program);
+        machine.bind("say", [](VirtualMachine&, std::span<const Value>) { return Value::nil(); });
+        machine.setInstructionLimit(1000);
+        const Result result = machine.call("f");
+        EXPECT_TRUE(result.ok() || !result.message.empty());
+    }
+    EXPECT_GT(accepted, 100u);
+    EXPECT_GT(rejected, 100u);
+}
+
+// =============================================================================
+// VIRTUAL MACHINE
+// =============================================================================
+
+TEST(VirtualMachineTests, MatchesTheReferenceOnRandomArithmetic)
+{
+    constexpr OpCode OPS[] = {OpCode::Add, OpCode::Subtract, OpCode::Multiply, OpCode::Divide, OpCode::Modulo,
+                              OpCode::Negate, OpCode::Move, OpCode::Not, OpCode::Equal, OpCode::Less,
+                              OpCode::LessEqual, OpCode::JumpIfFalse, OpCode::JumpIfTrue};
+    constexpr uint8_t REGISTERS = 6;
+    std::mt19937_64 random(72);
+    size_t typeErrors = 0;
+
+    for (int round = 0; round < 5000; ++round) {
+        ProgramBuilder builder;
+        builder.beginFunction("f", 0, REGISTERS);
+        for (uint8_t r = 0; r < REGISTERS; ++r) {
+            const double number = static_cast<double>(static_cast<int>(random() % 19) - 9);
+            builder.emitBx(OpCode::LoadConst, r, builder.constant(Value::number(number)));
+        }
+        const size_t length = 1 + random() % 24;
+        for (size_t index = 0; index < length; ++index) {
+            const OpCode op = OPS[random() % std::size(OPS)];
+            const auto a = static_cast<uint8_t>(random() % REGISTERS);
+            if (op == OpCode::JumpIfFalse || op == OpCode::JumpIfTrue) {
+                // Skip the next instruction, but never the final return
+                builder.emitBx(index + 1 < length ? op : OpCode::Not, a, 1);
+            } else {
+                builder.emit(op, a, static_cast<uint8_t>(random() % REGISTERS), static_cast<uint8_t>(random() % REGISTERS));
+            }
+        }
+        builder.emit(OpCode::Return, static_cast<uint8_t>(random() % REGISTERS));
+        builder.endFunction();
+        const Program program = builder.build();
+
+        const Reference expected = interpret(program, program.functions[0]);
+        VirtualMachine machine(program);
+        const Result result = machine.call("f");
+        if (!expected.value) {
+            ASSERT_EQ(Status::TypeError, result.status) << "Round " << round;
+            ++typeErrors;
+            continue;
+        }
+        ASSERT_TRUE(result.ok()) << result.message << ", round " << round;
+        ASSERT_EQ(expected.value->bits(), result.value.bits()) << "Round " << round;
+    }
+    EXPECT_GT(typeErrors, 0u);
+}
+
+TEST(VirtualMachineTests, CallsFunctionsAndNatives)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("twice", 1, 2);
+    builder.emit(OpCode::Add, 1, 0, 0);
+    builder.emit(OpCode::Return, 1);
+    builder.endFunction();
+    builder.beginFunction("main", 1, 4);
+    builder.emit(OpCode::Move, 2, 0);
+    builder.emitBx(OpCode::Call, 1, builder.function("twice"));
+    builder.emit(OpCode::Move, 3, 1);
+    builder.emitBx(OpCode::CallNative, 2, builder.native("addOne", 1));
+    builder.emit(OpCode::Return, 2);
+    builder.endFunction();
+    const Program program = builder.build();
+
+    VirtualMachine machine(program);
+    EXPECT_EQ(Status::UnboundNative, machine.call("main", std::vector{Value::number(1)}).status);
+    ASSERT_TRUE(machine.bind("addOne", [](VirtualMachine& vm, std::span<const Value> arguments) {
+        // Natives may call back into the machine
+        const Result again = vm.call("twice", arguments);
+        return Value::number(again.value.asNumber() / 2 + 1);
+    }));
+    EXPECT_FALSE(machine.bind("unused", {}));
+
+    const Result result = machine.call("main", std::vector{Value::number(5)});
+    ASSERT_TRUE(result.ok()) << result.message;
+    EXPECT_EQ(11.0, result.value.asNumber());
+    EXPECT_EQ(Status::BadArguments, machine.call("main").status);
+    EXPECT_EQ(Status::UnknownFunction, machine.call("nothing").status);
+}
+
+TEST(VirtualMachineTests, ModuloTakesTheSignOfTheDivisor)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("mod", 2, 3);
+    builder.emit(OpCode::Modulo, 2, 0, 1);
+    builder.emit(OpCode::Return, 2);
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+
+    EXPECT_EQ(2.0, machine.call("mod", std::vector{Value::number(-1), Value::number(3)}).value.asNumber());
+    EXPECT_EQ(-2.0, machine.call("mod", std::vector{Value::number(1), Value::number(-3)}).value.asNumber());
+    EXPECT_EQ(Status::TypeError, machine.call("mod", std::vector{Value::nil(), Value::number(3)}).status);
+}
+
+TEST(VirtualMachineTests, InstructionLimitCountsEveryInstructionRun)
+{
+    // Three instructions, then return
+    ProgramBuilder builder;
+    builder.beginFunction("three", 0, 1);
+    builder.emit(OpCode::LoadNil, 0);
+    builder.emit(OpCode::LoadBool, 0, 1);
+    builder.emit(OpCode::Return, 0);
+    builder.endFunction();
+    builder.beginFunction("spin", 0, 1);
+    builder.emitBx(OpCode::Jump, 0, static_cast<uint16_t>(-1));
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+
+    machine.setInstructionLimit(3);
+    EXPECT_TRUE(machine.call("three").ok());
+    EXPECT_EQ(3u, machine.getExecutedInstructions());
+
+    machine.setInstructionLimit(2);
+    const Result stopped = machine.call("three");
+    EXPECT_EQ(Status::InstructionLimit, stopped.status);
+    EXPECT_EQ(5u, machine.getExecutedInstructions());
+
+    machine.setInstructionLimit(1000);
+    EXPECT_EQ(Status::InstructionLimit, machine.call("spin").status);
+    EXPECT_EQ(1005u, machine.getExecutedInstructions());
+
+    // The limit is per call
+    EXPECT_TRUE(machine.call("three").ok());
+}
+
+TEST(VirtualMachineTests, SamplerRunsEveryPeriodWithinTheLimit)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("spin", 0, 1);
+    builder.emitBx(OpCode::Jump, 0, static_cast<uint16_t>(-1));
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+
+    std::vector<uint64_t> ticks;
+    machine.setSampler([&ticks](const VirtualMachine& vm) { ticks.push_back(vm.getExecutedInstructions()); }, 100);
+    machine.setInstructionLimit(1000);
+    EXPECT_EQ(Status::InstructionLimit, machine.call("spin").status);
+    EXPECT_EQ(1000u, machine.getExecutedInstructions());
+
+    ASSERT_FALSE(ticks.empty());
+    for (size_t index = 0; index < ticks.size(); ++index) {
+        EXPECT_EQ(100 * (index + 1), ticks[index]);
+    }
+    EXPECT_GE(ticks.size(), 9u);
+}
+
+TEST(VirtualMachineTests, EndlessRecursionStopsAtTheCallDepth)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("again", 0, 1);
+    builder.emitBx(OpCode::Call, 0, builder.function("again"));
+    builder.emit(OpCode::Return, 0);
+    builder.endFunction();
+    builder.beginFunction("count", 0, 1);
+    emitSetNumber(builder, "calls", 1);
+    builder.emit(OpCode::ReturnNil);
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+
+    EXPECT_EQ(Status::CallDepthExceeded, machine.call("again").status);
+    // The machine is usable afterwards
+    EXPECT_TRUE(machine.call("count").ok());
+    EXPECT_EQ(1.0, machine.getGlobal("calls").asNumber());
+}
+
+TEST(VirtualMachineTests, GlobalsSetBeforeAnErrorStay)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("fail", 0, 2);
+    emitSetNumber(builder, "score", 10);
+    builder.emit(OpCode::LoadNil, 1);
+    builder.emit(OpCode::Negate, 1, 1);
+    builder.emit(OpCode::ReturnNil);
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+
+    const Result result = machine.call("fail");
+    EXPECT_EQ(Status::TypeError, result.status);
+    EXPECT_NE(std::string::npos, result.message.find("'fail'"));
+    EXPECT_EQ(10.0, machine.getGlobal("score").asNumber());
+    EXPECT_TRUE(machine.getGlobal("unknown").isNil());
+    EXPECT_FALSE(machine.setGlobal("unknown", Value::number(1)));
+}
+
+// =============================================================================
+// GAME STATE
+// =============================================================================
+
+TEST(GameStateTests, SnapshotKeepsTheValuesAndCopiesOnlyWrittenPages)
+{
+    GameState state(10000);
+    state.set(5, Value::number(1));
+    state.set(9000, Value::number(2));
+    const GameState::Snapshot before = state.snapshot();
+    const uint64_t copied = state.getCopiedPages();
+
+    state.set(5, Value::number(3));
+    state.set(6, Value::number(4));
+    EXPECT_EQ(copied + 1, state.getCopiedPages());
+    EXPECT_EQ(1.0, before.get(5).asNumber());
+    EXPECT_TRUE(before.get(6).isNil());
+
+    std::vector<size_t> pages;
+    state.getChangedPages(before, pages);
+    EXPECT_EQ(std::vector<size_t>{0}, pages);
+
+    state.restore(before);
+    EXPECT_EQ(1.0, state.get(5).asNumber());
+    EXPECT_TRUE(state.get(6).isNil());
+    EXPECT_EQ(2.0, state.get(9000).asNumber());
+}
+
+TEST(GameStateTests, SnapshotRestoresIntoAnotherState)
+{
+    GameState first(100);
+    first.set(70, Value::boolean(true));
+    const GameState::Snapshot snapshot = first.snapshot();
+
+    GameState second(100);
+    second.restore(snapshot);
+    second.set(70, Value::boolean(false));
+    EXPECT_FALSE(second.get(70).asBool());
+    EXPECT_TRUE(first.get(70).asBool());
+    EXPECT_TRUE(snapshot.get(70).asBool());
+}
+
+TEST(GameStateTests, GrownSlotsStartNil)
+{
+    GameState state(3);
+    const size_t first = state.grow(5000);
+    EXPECT_EQ(3u, first);
+    EXPECT_EQ(5003u, state.size());
+    EXPECT_TRUE(state.get(5002).isNil());
+    state.set(5002, Value::number(8));
+    EXPECT_EQ(8.0, state.get(5002).asNumber());
+}
+
+TEST(StateHistoryTests, StepsBackAndRestarts)
+{
+    GameState state(1);
+    StateHistory history;
+    for (int turn = 1; turn <= 3; ++turn) {
+        history.record(state, "turn " + std::to_string(turn));
+        state.set(0, Value::number(turn));
+    }
+    ASSERT_EQ(3u, history.size());
+
+    EXPECT_TRUE(history.stepBack(state));
+    EXPECT_EQ(2.0, state.get(0).asNumber());
+
+    EXPECT_TRUE(history.restartFrom(state, 1));
+    EXPECT_EQ(1.0, state.get(0).asNumber());
+    EXPECT_EQ(1u, history.size());
+    EXPECT_EQ("turn 1", history.at(0).label);
+    EXPECT_FALSE(history.restartFrom(state, 5));
+}
+
+// =============================================================================
+// TRIGGER ENGINE
+// =============================================================================
+
+TEST(TriggerEngineTests, CascadeSettlesInOneRun)
+{
+    ProgramBuilder builder;
+    defineCondition(builder, "aIsSet", "a", 1);
+    defineAction(builder, "setB", "b", 1);
+    defineCondition(builder, "bIsSet", "b", 1);
+    defineAction(builder, "setC", "c", 1);
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+    TriggerEngine engine(machine);
+
+    ASSERT_EQ(0u, engine.add("first", "aIsSet", "setB"));
+    ASSERT_EQ(1u, engine.add("second", "bIsSet", "setC"));
+    EXPECT_EQ(std::vector<uint16_t>{0}, engine.getReads(0));
+
+    TriggerEngine::Report report = engine.run();
+    EXPECT_EQ(2u, report.evaluated);
+    EXPECT_EQ(0u, report.fired);
+
+    machine.setGlobal("a", Value::number(1));
+    report = engine.run();
+    EXPECT_EQ(2u, report.fired);
+    EXPECT_EQ(2u, report.rounds);
+    EXPECT_TRUE(report.settled);
+    EXPECT_EQ(1.0, machine.getGlobal("c").asNumber());
+
+    // Nothing changed: nothing is checked
+    report = engine.run();
+    EXPECT_EQ(0u, report.evaluated);
+}
+
+TEST(TriggerEngineTests, StateTriggerFiresOnlyWhenItBecomesTrue)
+{
+    ProgramBuilder builder;
+    defineCondition(builder, "lit", "lamp", 1);
+    builder.beginFunction("count", 0, 2);
+    builder.emitBx(OpCode::GetGlobal, 0, builder.global("fired"));
+    builder.emitBx(OpCode::LoadConst, 1, builder.constant(Value::number(1)));
+    builder.emit(OpCode::Add, 0, 0, 1);
+    builder.emitBx(OpCode::SetGlobal, 0, builder.global("fired"));
+    builder.emit(OpCode::ReturnNil);
+    builder.endFunction();
+    defineAction(builder, "reset", "fired", 0);
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+    machine.call("reset");
+    TriggerEngine engine(machine);
+    engine.add("lit", "lit", "count");
+
+    machine.setGlobal("lamp", Value::number(1));
+    engine.run();
+    machine.setGlobal("lamp", Value::number(1));
+    engine.run();
+    EXPECT_EQ(1.0, machine.getGlobal("fired").asNumber());
+
+    machine.setGlobal("lamp", Value::number(0));
+    engine.run();
+    machine.setGlobal("lamp", Value::number(1));
+    engine.run();
+    EXPECT_EQ(2.0, machine.getGlobal("fired").asNumber());
+}
+
+TEST(TriggerEngineTests, EndlessCascadeStopsAfterMaxRounds)
+{
+    // flip sets x when it is unset, flop clears it when it is set
+    ProgramBuilder builder;
+    builder.beginFunction("unset", 0, 2);
+    builder.emitBx(OpCode::GetGlobal, 0, builder.global("x"));
+    builder.emit(OpCode::Not, 1, 0);
+    builder.emit(OpCode::Return, 1);
+    builder.endFunction();
+    builder.beginFunction("set", 0, 1);
+    builder.emitBx(OpCode::GetGlobal, 0, builder.global("x"));
+    builder.emit(OpCode::Return, 0);
+    builder.endFunction();
+    builder.beginFunction("flip", 0, 1);
+    builder.emit(OpCode::LoadBool, 0, 1);
+    builder.emitBx(OpCode::SetGlobal, 0, builder.global("x"));
+    builder.emit(OpCode::ReturnNil);
+    builder.endFunction();
+    builder.beginFunction("flop", 0, 1);
+    builder.emit(OpCode::LoadBool, 0, 0);
+    builder.emitBx(OpCode::SetGlobal, 0, builder.global("x"));
+    builder.emit(OpCode::ReturnNil);
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+    TriggerEngine engine(machine);
+    engine.add("flip", "unset", "flip");
+    engine.add("flop", "set", "flop");
+
+    const TriggerEngine::Report report = engine.run();
+    EXPECT_FALSE(report.settled);
+    EXPECT_EQ(TriggerEngine::MAX_ROUNDS, report.rounds);
+    EXPECT_EQ(TriggerEngine::MAX_ROUNDS, report.fired);
+}
+
+TEST(TriggerEngineTests, EventsFireOncePerRunAndNativesMakeConditionsVolatile)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("ring", 0, 2);
+    builder.emitBx(OpCode::GetGlobal, 0, builder.global("rings"));
+    builder.emitBx(OpCode::LoadConst, 1, builder.constant(Value::number(1)));
+    builder.emit(OpCode::Add, 0, 0, 1);
+    builder.emitBx(OpCode::SetGlobal, 0, builder.global("rings"));
+    builder.emit(OpCode::ReturnNil);
+    builder.endFunction();
+    defineAction(builder, "reset", "rings", 0);
+    builder.beginFunction("lucky", 0, 2);
+    builder.emitBx(OpCode::CallNative, 0, builder.native("random", 0));
+    builder.emit(OpCode::Return, 0);
+    builder.endFunction();
+    builder.beginFunction("even", 0, 2);
+    builder.emitBx(OpCode::CallNative, 0, builder.native("pure", 0));
+    builder.emit(OpCode::Return, 0);
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+    machine.bind("random", [](VirtualMachine&, std::span<const Value>) { return Value::boolean(false); });
+    machine.bind("pure", [](VirtualMachine&, std::span<const Value>) { return Value::boolean(false); });
+    machine.call("reset");
+    TriggerEngine engine(machine);
+    EXPECT_TRUE(engine.setNativePure("pure"));
+    EXPECT_FALSE(engine.setNativePure("missing"));
+
+    engine.add("bell", "", "ring", "bell");
+    const size_t lucky = engine.add("lucky", "lucky", "ring");
+    const size_t even = engine.add("even", "even", "ring");
+    EXPECT_TRUE(engine.isVolatile(lucky));
+    EXPECT_FALSE(engine.isVolatile(even));
+    EXPECT_EQ(TriggerEngine::NO_TRIGGER, engine.add("bad", "", "ring"));
+    EXPECT_EQ(TriggerEngine::NO_TRIGGER, engine.add("bad", "missing", "ring"));
+    engine.run();
+
+    engine.post("bell");
+    engine.post("bell");
+    engine.post("nobody");
+    const TriggerEngine::Report report = engine.run();
+    EXPECT_EQ(1u, report.fired);
+    EXPECT_EQ(1.0, machine.getGlobal("rings").asNumber());
+    // The volatile condition was checked in both rounds, ringing and after, the pure one in neither
+    EXPECT_EQ(2u, report.rounds);
+    EXPECT_EQ(2u, report.evaluated);
+}
+
+// =============================================================================
+// WATCH LIST
+// =============================================================================
+
+TEST(WatchListTests, KeepsSamplesAndChanges)
+{
+    GameState state(2);
+    WatchList watches;
+    EXPECT_EQ(0u, watches.add("score", 0));
+    EXPECT_EQ(1u, watches.add("lit", 1));
+    watches.add("outside", 99);
+
+    for (uint64_t tick = 0; tick < 10; ++tick) {
+        state.set(0, Value::number(static_cast<double>(tick / 3)));
+        state.set(1, Value::boolean(tick % 2 == 1));
+        watches.sample(state, tick);
+    }
+
+    EXPECT_EQ(10u, watches.getSampleCount());
+    EXPECT_EQ(3.0, watches.getValue(0).asNumber());
+    // 0, 1, 2 and 3, newest first
+    ASSERT_EQ(4u, watches.getChangeCount(0));
+    EXPECT_EQ(9u, watches.getChange(0, 0).tick);
+    EXPECT_EQ(3.0, watches.getChange(0, 0).value.asNumber());
+    EXPECT_EQ(6u, watches.getChange(0, 1).tick);
+    EXPECT_EQ(0u, watches.getChange(0, 3).tick);
+    EXPECT_EQ(1.0f, watches.getSamples(1)[(watches.getSampleOffset() + 9) % WatchList::SAMPLES]);
+    EXPECT_TRUE(watches.getValue(2).isNil());
+
+    watches.remove(0);
+    EXPECT_EQ("lit", watches.getName(0));
+    EXPECT_EQ(1u, watches.getSlot(0));
+}
+
+TEST(WatchListTests, SamplesWhileTheMachineRuns)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("count", 0, 3);
+    const ProgramBuilder::Label loop = builder.newLabel();
+    builder.emitBx(OpCode::LoadConst, 1, builder.constant(Value::number(1)));
+    builder.bind(loop);
+    builder.emitBx(OpCode::GetGlobal, 0, builder.global("n"));
+    builder.emit(OpCode::Add, 0, 0, 1);
+    builder.emitBx(OpCode::SetGlobal, 0, builder.global("n"));
+    builder.emitJump(OpCode::Jump, 0, loop);
+    builder.endFunction();
+    const Program program = builder.build();
+    VirtualMachine machine(program);
+    machine.setGlobal("n", Value::number(0));
+
+    WatchList watches;
+    watches.addGlobals(program);
+    watches.attach(machine);
+    machine.setInstructionLimit(100 * watches.samplePeriod());
+    EXPECT_EQ(Status::InstructionLimit, machine.call("count").status);
+
+    EXPECT_GE(watches.getSampleCount(), 90u);
+    EXPECT_EQ(std::min(watches.getSampleCount(), WatchList::CHANGES), watches.getChangeCount(0));
+}
+
+// =============================================================================
+// LEXICON
+// =============================================================================
+
+TEST(LexiconTests, FindsWordsAndSynonymsInAnyCase)
+{
+    LexiconBuilder builder;
+    EXPECT_TRUE(builder.add("take", WordCategory::Verb, 1));
+    EXPECT_TRUE(builder.add("get", WordCategory::Verb, 1));
+    EXPECT_TRUE(builder.add("lamp", WordCategory::Noun, 2));
+    EXPECT_TRUE(builder.add("lámpara", WordCategory::Noun, 2));
+    EXPECT_TRUE(builder.add("the", WordCategory::Article, 3));
+    EXPECT_FALSE(builder.add("two words", WordCategory::Noun, 4));
+    EXPECT_FALSE(builder.add("", WordCategory::Noun, 4));
+    const Lexicon lexicon = builder.build();
+
+    EXPECT_EQ(5u, lexicon.size());
+    ASSERT_TRUE(lexicon.find("TaKe").has_value());
+    EXPECT_EQ(WordCategory::Verb, lexicon.find("TaKe")->category);
+    EXPECT_EQ(lexicon.find("take")->conceptId, lexicon.find("GET")->conceptId);
+    EXPECT_EQ(2u, lexicon.find("lámpara")->conceptId);
+    EXPECT_FALSE(lexicon.find("LÁMPARA").has_value());
+    EXPECT_FALSE(lexicon.find("tak").has_value());
+    EXPECT_FALSE(lexicon.find("takes").has_value());
+}
+
+TEST(LexiconTests, TokenizesAPhraseInOnePass)
+{
+    LexiconBuilder builder;
+    builder.add("take", WordCategory::Verb, 1);
+    builder.add("lamp", WordCategory::Noun, 2);
+    builder.add("the", WordCategory::Article, 3);
+    const Lexicon lexicon = builder.build();
+
+    std::vector<WordToken> tokens(3);
+    const size_t count = lexicon.tokenize("  Take the LAMP, quickly!", tokens);
+    EXPECT_EQ(4u, count);
+    EXPECT_EQ(WordCategory::Verb, tokens[0].meaning.category);
+    EXPECT_EQ(2u, tokens[0].offset);
+    EXPECT_EQ(4u, tokens[0].length);
+    EXPECT_EQ(WordCategory::Article, tokens[1].meaning.category);
+    EXPECT_EQ(2u, tokens[2].meaning.conceptId);
+    EXPECT_EQ(11u, tokens[2].offset);
+}
+
+TEST(LexiconTests, SharesSuffixesAndNumbersEveryWord)
+{
+    LexiconBuilder builder;
+    const std::vector<std::string> words = {"make", "shake", "take", "bake", "wake", "fake"};
+    for (size_t index = 0; index < words.size(); ++index) {
+        builder.add(words[index], WordCategory::Verb, static_cast<uint32_t>(index));
+    }
+    const Lexicon lexicon = builder.build();
+
+    for (size_t index = 0; index < words.size(); ++index) {
+        ASSERT_TRUE(lexicon.find(words[index]).has_value());
+        EXPECT_EQ(index, lexicon.find(words[index])->conceptId);
+    }
+    // A trie needs a state per letter; shared "ake" leaves far fewer
+    EXPECT_LT(lexicon.stateCount(), 12u);
+}
+
+// =============================================================================
+// PLAYTHROUGH FUZZER
+// =============================================================================
+
+TEST(PlaythroughFuzzerTests, BreadthFirstFindsTheDeadEnd)
+{
+    const Program program = makeRoomsGame();
+    PlaythroughFuzzer::Options options;
+    options.commands = {"north", "south", "jump"};
+    options.start = "start";
+    options.won = "won";
+    options.scene = "room";
+    options.scenes = {Value::number(0), Value::number(1), Value::number(2), Value::number(3)};
+    options.strategy = PlaythroughFuzzer::Strategy::BreadthFirst;
+    PlaythroughFuzzer fuzzer(program, options);
+
+    const PlaythroughFuzzer::Report report = fuzzer.run();
+    ASSERT_TRUE(report.errors.empty());
+    EXPECT_TRUE(report.exhausted);
+    EXPECT_EQ(3u, report.states);
+    EXPECT_EQ(1u, report.wins);
+    ASSERT_EQ(1u, report.softLockCount);
+    EXPECT_EQ(std::vector<uint16_t>{2}, report.softLocks[0].path);
+    ASSERT_EQ(1u, report.unwinnableCount);
+    EXPECT_EQ(std::vector<uint16_t>{2}, report.unwinnable[0].path);
+    ASSERT_EQ(1u, report.unreachedScenes.size());
+    EXPECT_EQ(3.0, report.unreachedScenes[0].asNumber());
+}
+
+TEST(PlaythroughFuzzerTests, EndlessLoopIsAFailure)
+{
+    ProgramBuilder builder;
+    builder.beginFunction("spin", 0, 1);
+    builder.emitBx(OpCode::Jump, 0, static_cast<uint16_t>(-1));
+    builder.endFunction();
+    const Program program = builder.build();
+
+    PlaythroughFuzzer::Options options;
+    options.commands = {"spin"};
+    options.strategy = PlaythroughFuzzer::Strategy::BreadthFirst;
+    options.instructionLimit = 1000;
+    PlaythroughFuzzer fuzzer(program, options);
+
+    const PlaythroughFuzzer::Report report = fuzzer.run();
+    ASSERT_EQ(1u, report.failureCount);
+    EXPECT_EQ(std::vector<uint16_t>{0}, report.failures[0].path);
+    EXPECT_FALSE(report.failures[0].message.empty());
+}
+
+TEST(PlaythroughFuzzerTests, WorkersOnAPoolSeeEveryState)
+{
+    const Program program = makeRoomsGame();
+    PlaythroughFuzzer::Options options;
+    options.commands = {"north", "south", "jump"};
+    options.start = "start";
+    options.won = "won";
+    options.strategy = PlaythroughFuzzer::Strategy::CoverageGuided;
+    options.workers = 4;
+    options.maxPlaythroughs = 200;
+    PlaythroughFuzzer fuzzer(program, options);
+
+    Core::JobSystem jobs(4);
+    const PlaythroughFuzzer::Report report = fuzzer.run(&jobs);
+    ASSERT_TRUE(report.errors.empty());
+    EXPECT_EQ(3u, report.states);
+    EXPECT_EQ(1u, report.wins);
+    EXPECT_EQ(1u, report.softLockCount);
+}
+
+TEST(PlaythroughFuzzerTests, ReportsWhatCannotBePlayed)
+{
+    const Program program = makeRoomsGame();
+    PlaythroughFuzzer::Options options;
+    options.commands = {"north", "fly"};
+    options.scene = "altitude";
+    PlaythroughFuzzer fuzzer(program, options);
+
+    const PlaythroughFuzzer::Report report = fuzzer.run();
+    EXPECT_EQ(2u, report.errors.size());
+    EXPECT_EQ(0u, report.playthroughs);
+}
+
+// =============================================================================
+// TEXT COMPRESSOR
+// =============================================================================
+
+TEST(TextCompressorTests, EveryTextDecodesToItself)
+{
+    const std::vector<std::string> words = {"the", "dark", "cave", "lamp", "door", "north", "a", "of", "is", "ñu"};
+    std::mt19937_64 random(75);
+    Compiler::TextCompressor compressor;
+    std::vector<std::pair<std::string, std::string>> texts;
+    for (int index = 0; index < 300; ++index) {
+        std::string text;
+        const size_t length = random() % 12;
+        for (size_t word = 0; word < length; ++word) {
+            text += words[random() % words.size()];
+            text += random() % 5 == 0 ? ". " : " ";
+        }
+        const std::string locale = index % 2 == 0 ? "en_US" : "es_ES";
+        const std::string key = "text:" + std::to_string(index);
+        ASSERT_TRUE(compressor.setText(locale, key, text));
+        texts.emplace_back(locale + "/" + key, text);
+    }
+
+    Core::JobSystem jobs(2);
+    EXPECT_EQ(300u, compressor.build(&jobs));
+    for (int index = 0; index < 300; ++index) {
+        const std::string locale = index % 2 == 0 ? "en_US" : "es_ES";
+        const std::string key = "text:" + std::to_string(index);
+        const Compiler::TextDictionary* dictionary = compressor.getDictionary(locale);
+        ASSERT_NE(nullptr, dictionary);
+        EXPECT_LE(dictionary->firstPair() + dictionary->pairs.size(), 256u);
+        const std::span<const uint8_t> encoded = compressor.getEncoded(locale, key);
+        ASSERT_FALSE(encoded.empty());
+        EXPECT_EQ(0, encoded.back());
+        EXPECT_EQ(texts[index].second, Compiler::decodeText(*dictionary, encoded));
+    }
+
+    const Compiler::TextCompressor::Statistics statistics = compressor.getStatistics("en_US");
+    EXPECT_EQ(150u, statistics.texts);
+    EXPECT_LT(statistics.encodedBytes, statistics.sourceBytes);
+}
+
+TEST(TextCompressorTests, SmallEditsKeepTheDictionary)
+{
+    Compiler::TextCompressor compressor;
+    for (int index = 0; index < 100; ++index) {
+        compressor.setText("en_US", std::to_string(index), "You are standing in a dark and narrow cave.");
+    }
+    compressor.build();
+    const std::vector<std::array<uint8_t, 2>> pairs = compressor.getDictionary("en_US")->pairs;
+
+    compressor.setText("en_US", "5", "You are standing in a narrow cave.");
+    EXPECT_EQ(1u, compressor.build());
+    EXPECT_EQ(pairs, compressor.getDictionary("en_US")->pairs);
+    EXPECT_EQ("You are standing in a narrow cave.",
+              Compiler::decodeText(*compressor.getDictionary("en_US"), compressor.getEncoded("en_US", "5")));
+
+    // A byte the alphabet lacks forces a new dictionary
+    compressor.setText("en_US", "6", "Zzz");
+    EXPECT_EQ(100u, compressor.build());
+    EXPECT_EQ("Zzz", Compiler::decodeText(*compressor.getDictionary("en_US"), compressor.getEncoded("en_US", "6")));
+}
+
+TEST(TextCompressorTests, RejectsTextsHoldingNul)
+{
+    Compiler::TextCompressor compressor;
+    EXPECT_TRUE(compressor.setText("en_US", "door", "A door"));
+    EXPECT_FALSE(compressor.setText("en_US", "door", std::string_view("A\0door", 6)));
+    compressor.build();
+    EXPECT_EQ("A door", Compiler::decodeText(*compressor.getDictionary("en_US"), compressor.getEncoded("en_US", "door")));
+
+    Core::Project project("Texts");
+    project.addItem("lamp", "Lamp")->setDescription(std::string("Brass\0lamp", 10));
+    project.addItem("key", "Key");
+    const std::vector<std::string> rejected = compressor.setProjectTexts(project, "en_US");
+    EXPECT_EQ(std::vector<std::string>{"item:lamp:description"}, rejected);
+    compressor.build();
+    EXPECT_EQ("Key", Compiler::decodeText(*compressor.getDictionary("en_US"), compressor.getEncoded("en_US", "item:key:name")));
+}
+
+// =============================================================================
+// BUDGET PACKER
+// =============================================================================
+
+TEST(BudgetPackerTests, CostsAreTheCompressedTextsPlusTheRecord)
+{
+    const std::vector<std::string> texts = {
+        "A dark cave. Water drips from the roof of the cave.",
+        "A brass lamp, dented but working.",
+        "The old hermit of the cave.",
+        ""
+    };
+    Compiler::BudgetPacker packer;
+    Compiler::TextCompressor reference;
+    for (size_t index = 0; index < texts.size(); ++index) {
+        const uint32_t entry = packer.add({}, 8, 1);
+        ASSERT_TRUE(packer.setText(entry, texts[index]));
+        reference.setText("reference", std::to_string(index), texts[index]);
+    }
+    reference.build();
+
+    for (uint32_t index = 0; index < texts.size(); ++index) {
+        EXPECT_EQ(8 + reference.getEncoded("reference", std::to_string(index)).size(), packer.cost(index));
+    }
+    EXPECT_EQ(reference.getDictionary("reference")->targetBytes(), packer.dictionaryBytes());
+    EXPECT_FALSE(packer.setText(0, std::string_view("\0", 1)));
+
+    const Compiler::BudgetPacker::Plan plan = packer.solve(1024);
+    EXPECT_EQ(texts.size(), plan.kept.size());
+    EXPECT_EQ(packer.dictionaryBytes(), plan.dictionaryBytes);
+    uint32_t bytes = plan.dictionaryBytes;
+    for (uint32_t index = 0; index < texts.size(); ++index) {
+        bytes += packer.cost(index);
+    }
+    EXPECT_EQ(bytes, plan.bytes);
+}
+
+TEST(BudgetPackerTests, SolveMatchesBruteForceOnRandomForests)
+{
+    std::mt19937_64 random(74);
+    for (int round = 0; round < 400; ++round) {
+        const auto n = static_cast<uint32_t>(1 + random() % 10);
+        Compiler::BudgetPacker packer;
+        std::vector<uint32_t> priorities(n);
+        std::vector<uint32_t> parents(n, Compiler::BudgetPacker::NO_DEPENDENCY);
+        std::vector<Compiler::BudgetPacker::Choice> choices(n, Compiler::BudgetPacker::Choice::Auto);
+        for (uint32_t index = 0; index < n; ++index) {
+            priorities[index] = static_cast<uint32_t>(random() % 10);
+            packer.add({}, static_cast<uint32_t>(1 + random() % 40), priorities[index]);
+            // Depending on an earlier entry keeps it a forest
+            if (index > 0 && random() % 2 == 0) {
+                parents[index] = static_cast<uint32_t>(random() % index);
+                ASSERT_TRUE(packer.setDependency(index, parents[index]));
+            }
+            const uint64_t pick = random() % 10;
+            choices[index] = pick == 0 ? Compiler::BudgetPacker::Choice::Keep
+                : pick == 1 ? Compiler::BudgetPacker::Choice::Drop
+                : Compiler::BudgetPacker::Choice::Auto;
+            packer.setChoice(index, choices[index]);
+        }
+        if (n > 1 && parents[1] == 0) {
+            EXPECT_FALSE(packer.setDependency(0, 1));
+        }
+        const auto budget = static_cast<uint32_t>(random() % 150);
+
+        std::vector<bool> required(n, false);
+        for (uint32_t index = 0; index < n; ++index) {
+            if (choices[index] == Compiler::BudgetPacker::Choice::Keep) {
+                for (uint32_t up = index; up != Compiler::BudgetPacker::NO_DEPENDENCY; up = parents[up]) {
+                    required[up] = true;
+                }
+            }
+        }
+        int64_t best = -1;
+        for (uint32_t mask = 0; mask < (1u << n); ++mask) {
+            uint64_t bytes = 0;
+            int64_t priority = 0;
+            bool valid = true;
+            for (uint32_t index = 0; index < n && valid; ++index) {
+                const bool kept = (mask >> index & 1) != 0;
+                if (!kept) {
+                    valid = !required[index];
+                    continue;
+                }
+                valid = (parents[index] == Compiler::BudgetPacker::NO_DEPENDENCY || (mask >> parents[index] & 1) != 0)
+                    && (choices[index] != Compiler::BudgetPacker::Choice::Drop || required[index]);
+                bytes += packer.cost(index);
+                priority += priorities[index];
+            }
+            if (valid && bytes + packer.dictionaryBytes() <= budget) {
+                best = std::max(best, priority);
+            }
+        }
+
+        const Compiler::BudgetPacker::Plan plan = packer.solve(budget);
+        ASSERT_EQ(best >= 0, plan.fits) << "Round " << round;
+        if (plan.fits) {
+            ASSERT_EQ(static_cast<uint64_t>(best), plan.priority) << "Round " << round;
+            EXPECT_LE(plan.bytes, budget);
+            for (const uint32_t index : plan.kept) {
+                EXPECT_TRUE(parents[index] == Compiler::BudgetPacker::NO_DEPENDENCY
+                            || std::ranges::find(plan.kept, parents[index]) != plan.kept.end());
+            }
+        }
+    }
+}
@@ -0,0 +1,497 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+
+/**
+ * @file syncTests.cpp
+ * @brief Google Test suite for the delta stream and sync sessions
+ *
+ * Covers the DeltaStream payload format (round trip, compressed bodies and
+ * rejection of malformed payloads) and the merge rules of SyncSession
+ * between two sites: last writer wins per property, and removals win over
+ * older edits and additions.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/DeltaStream.h"
+#include "Core/Project.h"
+#include "Core/SyncSession.h"
+#include "Entities/Scene.h"
+#include "project/project_format_exception.h"
+
+using namespace ADS;
+using Exceptions::project_format_exception;
+
+// =============================================================================
+// HELPER FUNCTIONS
+// =============================================================================
+
+namespace {
+
+    /**
+     * @brief A batch with one op of each type and a value of each alternative
+     */
+    Core::DeltaBatch makeBatch()
+    {
+        Core::DeltaBatch batch;
+        batch.site = 0x1234567890ULL;
+
+        Core::DeltaOp create;
+        create.type = Core::DeltaOp::Type::Create;
+        create.kind = Core::EntityKind::Item;
+        create.entity = "item_1";
+        create.clock = 40;
+        create.properties.emplace_back("name", std::string("Lamp"));
+        create.properties.emplace_back("quantity", -3);
+        create.properties.emplace_back("isPickable", true);
+        create.properties.emplace_back("weight", 2.5f);
+        batch.ops.push_back(create);
+
+        const std::vector<Inspector::PropertyValue> values = {
+            std::monostate{},
+            false,
+            -123456,
+            0.25f,
+            std::string("Dark hall"),
+            ImVec4(0.1f, 0.2f, 0.3f, 1.0f),
+            ImVec2(640.0f, 480.0f),
+            Inspector::EnumValue(2, nullptr)
+        };
+        uint64_t clock = 41;
+        for (const Inspector::PropertyValue& value : values) {
+            Core::DeltaOp set;
+            set.type = Core::DeltaOp::Type::Set;
+            set.kind = Core::EntityKind::Scene;
+            set.entity = "scene_1";
+            set.clock = clock++;
+            set.property = "value_" + std::to_string(set.clock);
+            set.value = value;
+            batch.ops.push_back(set);
+        }
+
+        Core::DeltaOp remove;
+        remove.type = Core::DeltaOp::Type::Remove;
+        remove.kind = Core::EntityKind::Character;
+        remove.entity = "npc_1";
+        remove.clock = 60;
+        batch.ops.push_back(remove);
+        return batch;
+    }
+
+    void expectSameValue(const Inspector::PropertyValue& expected, const Inspector::PropertyValue& actual)
+    {
+        ASSERT_EQ(expected.index(), actual.index());
+        if (const auto* color = std::get_if<ImVec4>(&expected)) {
+            const ImVec4& decoded = std::get<ImVec4>(actual);
+            EXPECT_EQ(color->x, decoded.x);
+            EXPECT_EQ(color->y, decoded.y);
+            EXPECT_EQ(color->z, decoded.z);
+            EXPECT_EQ(color->w, decoded.w);
+        } else if (const auto* vector = std::get_if<ImVec2>(&expected)) {
+            const ImVec2& decoded = std::get<ImVec2>(actual);
+            EXPECT_EQ(vector->x, decoded.x);
+            EXPECT_EQ(vector->y, decoded.y);
+        } else if (const auto* selection = std::get_if<Inspector::EnumValue>(&expected)) {
+            EXPECT_EQ(selection->selectedIndex, std::get<Inspector::EnumValue>(actual).selectedIndex);
+        } else if (const auto* text = std::get_if<std::string>(&expected)) {
+            EXPECT_EQ(*text, std::get<std::string>(actual));
+        } else if (const auto* number = std::get_if<int>(&expected)) {
+            EXPECT_EQ(*number, std::get<int>(actual));
+        } else if (const auto* real = std::get_if<float>(&expected)) {
+            EXPECT_EQ(*real, std::get<float>(actual));
+        } else if (const auto* flag = std::get_if<bool>(&expected)) {
+            EXPECT_EQ(*flag, std::get<bool>(actual));
+        }
+    }
+
+    void expectSameBatch(const Core::DeltaBatch& expected, const Core::DeltaBatch& actual)
+    {
+        EXPECT_EQ(expected.site, actual.site);
+        ASSERT_EQ(expected.ops.size(), actual.ops.size());
+        for (size_t i = 0; i < expected.ops.size(); ++i) {
+            const Core::DeltaOp& op = expected.ops[i];
+            const Core::DeltaOp& decoded = actual.ops[i];
+            EXPECT_EQ(op.type, decoded.type);
+            EXPECT_EQ(op.kind, decoded.kind);
+            EXPECT_EQ(op.entity, decoded.entity);
+            EXPECT_EQ(op.clock, decoded.clock);
+            EXPECT_EQ(op.property, decoded.property);
+            expectSameValue(op.value, decoded.value);
+            ASSERT_EQ(op.properties.size(), decoded.properties.size());
+            for (size_t j = 0; j < op.properties.size(); ++j) {
+                EXPECT_EQ(op.properties[j].first, decoded.properties[j].first);
+                expectSameValue(op.properties[j].second, decoded.properties[j].second);
+            }
+        }
+    }
+
+    /**
+     * @brief A project holding the scenes both sites start from
+     */
+    std::unique_ptr<Core::Project> makeProject()
+    {
+        auto project = std::make_unique<Core::Project>("Sync");
+        project->addScene("hall", "Hall");
+        project->addScene("cellar", "Cellar");
+        return project;
+    }
+
+    /**
+     * @brief Flush one session's edits into the other and apply them
+     */
+    void deliver(Core::SyncSession& from, Core::SyncSession& to)
+    {
+        const auto later = Core::SyncSession::Clock::now() + std::chrono::hours(1);
+        const std::string payload = from.takeOutgoing(later);
+        if (payload.empty()) {
+            return;
+        }
+        to.receive(payload);
+        while (to.applyRemote() > 0) {
+        }
+    }
+
+    Core::DeltaOp makeOp(Core::DeltaOp::Type type, const std::string& entity, uint64_t clock)
+    {
+        Core::DeltaOp op;
+        op.type = type;
+        op.kind = Core::EntityKind::Scene;
+        op.entity = entity;
+        op.clock = clock;
+        return op;
+    }
+}
+
+// =============================================================================
+// DELTA STREAM
+// =============================================================================
+
+TEST(DeltaStreamTests, RoundTripKeepsEveryOpAndValue)
+{
+    const Core::DeltaBatch batch = makeBatch();
+    const std::string payload = Core::DeltaStream::encode(batch);
+
+    ASSERT_GE(payload.size(), 2u);
+    EXPECT_EQ(Core::DeltaFormat::VERSION, static_cast<uint8_t>(payload[0]));
+    EXPECT_EQ(0, payload[1] & Core::DeltaFormat::FLAG_DEFLATED);
+    expectSameBatch(batch, Core::DeltaStream::decode(payload));
+}
+
+TEST(DeltaStreamTests, RoundTripOfLargeBatchIsDeflated)
+{
+    Core::DeltaBatch batch;
+    batch.site = 7;
+    for (uint64_t i = 0; i < 500; ++i) {
+        Core::DeltaOp op = makeOp(Core::DeltaOp::Type::Set, "scene_" + std::to_string(i), 1000 + i);
+        op.property = "description";
+        op.value = std::string("A long and repetitive description of the scene");
+        batch.ops.push_back(op);
+    }
+    const std::string payload = Core::DeltaStream::encode(batch);
+
+    EXPECT_NE(0, payload[1] & Core::DeltaFormat::FLAG_DEFLATED);
+    expectSameBatch(batch, Core::DeltaStream::decode(payload));
+}
+
+TEST(DeltaStreamTests, EmptyBatchRoundTrips)
+{
+    Core::DeltaBatch batch;
+    batch.site = 99;
+    const Core::DeltaBatch decoded = Core::DeltaStream::decode(Core::DeltaStream::encode(batch));
+
+    EXPECT_EQ(99u, decoded.site);
+    EXPECT_TRUE(decoded.ops.empty());
+}
+
+TEST(DeltaStreamTests, RejectsEmptyPayload)
+{
+    EXPECT_THROW((void)Core::DeltaStream::decode(""), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsUnknownVersion)
+{
+    std::string payload = Core::DeltaStream::encode(makeBatch());
+    payload[0] = static_cast<char>(Core::DeltaFormat::VERSION + 1);
+
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsEveryTruncation)
+{
+    const std::string payload = Core::DeltaStream::encode(makeBatch());
+    for (size_t size = 0; size < payload.size(); ++size) {
+        EXPECT_THROW((void)Core::DeltaStream::decode(payload.substr(0, size)), project_format_exception)
+            << "payload cut to " << size << " bytes";
+    }
+}
+
+TEST(DeltaStreamTests, RejectsTrailingBytes)
+{
+    std::string payload = Core::DeltaStream::encode(makeBatch());
+    payload.push_back('\0');
+
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsUnknownOperation)
+{
+    Core::DeltaBatch batch;
+    batch.ops.push_back(makeOp(Core::DeltaOp::Type::Remove, "hall", 1));
+    std::string payload = Core::DeltaStream::encode(batch);
+
+    // Header, site, clock base, one string "hall", op count, then the type/kind byte
+    const size_t typeAndKind = 2 + 1 + 1 + 1 + 5 + 1;
+    ASSERT_EQ(static_cast<char>(static_cast<uint8_t>(Core::DeltaOp::Type::Remove) << 4), payload[typeAndKind]);
+    payload[typeAndKind] = static_cast<char>(0x40);
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+
+    payload[typeAndKind] = static_cast<char>(static_cast<uint8_t>(Core::DeltaOp::Type::Remove) << 4 | 0x0F);
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsMissingString)
+{
+    Core::DeltaBatch batch;
+    batch.ops.push_back(makeOp(Core::DeltaOp::Type::Remove, "hall", 1));
+    std::string payload = Core::DeltaStream::encode(batch);
+
+    // The entity refers to string 0; point it past the one-entry table
+    payload[payload.size() - 2] = 1;
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsUnknownValueTag)
+{
+    Core::DeltaBatch batch;
+    Core::DeltaOp op = makeOp(Core::DeltaOp::Type::Set, "hall", 1);
+    op.property = "width";
+    op.value = std::monostate{};
+    batch.ops.push_back(op);
+    std::string payload = Core::DeltaStream::encode(batch);
+
+    // The value of a None-valued Set is its tag alone, the last byte
+    ASSERT_EQ(0, payload.back());
+    payload.back() = static_cast<char>(0x7F);
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsCountLargerThanPayload)
+{
+    // Version, flags, site 0, clock base 0, then a string table claiming 1000 entries
+    const std::string payload = {static_cast<char>(Core::DeltaFormat::VERSION), 0, 0, 0,
+                                 static_cast<char>(0xE8), 0x07};
+
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsCorruptDeflatedBody)
+{
+    Core::DeltaBatch batch;
+    for (uint64_t i = 0; i < 200; ++i) {
+        batch.ops.push_back(makeOp(Core::DeltaOp::Type::Remove, "scene_" + std::to_string(i), i + 1));
+    }
+    std::string payload = Core::DeltaStream::encode(batch);
+    ASSERT_NE(0, payload[1] & Core::DeltaFormat::FLAG_DEFLATED);
+
+    std::string corrupt = payload;
+    for (size_t i = payload.size() / 2; i < payload.size(); ++i) {
+        corrupt[i] = static_cast<char>(~corrupt[i]);
+    }
+    EXPECT_THROW((void)Core::DeltaStream::decode(corrupt), project_format_exception);
+
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload.substr(0, payload.size() - 4)), project_format_exception);
+}
+
+TEST(DeltaStreamTests, RejectsOversizedDeflatedBody)
+{
+    // Declared inflated size of 1 GiB, above MAX_BODY_BYTES
+    const std::string payload = {static_cast<char>(Core::DeltaFormat::VERSION),
+                                 static_cast<char>(Core::DeltaFormat::FLAG_DEFLATED),
+                                 static_cast<char>(0x80), static_cast<char>(0x80),
+                                 static_cast<char>(0x80), static_cast<char>(0x80), 0x04};
+
+    EXPECT_THROW((void)Core::DeltaStream::decode(payload), project_format_exception);
+}
+
+// =============================================================================
+// SYNC SESSION
+// =============================================================================
+
+TEST(SyncSessionTests, LocalEditsReachThePeer)
+{
+    const auto first = makeProject();
+    const auto second = makeProject();
+    Core::SyncSession a(1);
+    Core::SyncSession b(2);
+    a.attach(*first);
+    b.attach(*second);
+
+    first->findScene("hall")->setWidth(1000);
+    first->findScene("hall")->setWidth(900);
+    first->addScene("attic", "Attic");
+    deliver(a, b);
+
+    EXPECT_EQ(900, second->findScene("hall")->getWidth());
+    ASSERT_NE(nullptr, second->findScene("attic"));
+    EXPECT_EQ("Attic", second->findScene("attic")->getName());
+    EXPECT_EQ(2u, a.getStats().sentOps);
+    EXPECT_EQ(1u, b.getStats().addedEntities);
+    EXPECT_FALSE(b.hasOutgoing());
+}
+
+TEST(SyncSessionTests, ConcurrentEditsConvergeOnLastWriter)
+{
+    const auto first = makeProject();
+    const auto second = makeProject();
+    Core::SyncSession a(1);
+    Core::SyncSession b(2);
+    a.attach(*first);
+    b.attach(*second);
+
+    // Same Lamport time on both sites: the higher site id breaks the tie
+    first->findScene("hall")->setWidth(1280);
+    second->findScene("hall")->setWidth(1024);
+    deliver(a, b);
+    deliver(b, a);
+
+    EXPECT_EQ(1024, first->findScene("hall")->getWidth());
+    EXPECT_EQ(1024, second->findScene("hall")->getWidth());
+    EXPECT_EQ(1u, b.getStats().discardedOps);
+
+    // Having seen site 2's edit, site 1's next edit is later and wins everywhere
+    first->findScene("hall")->setWidth(640);
+    deliver(a, b);
+
+    EXPECT_EQ(640, first->findScene("hall")->getWidth());
+    EXPECT_EQ(640, second->findScene("hall")->getWidth());
+}
+
+TEST(SyncSessionTests, RemovalWinsOverConcurrentEdit)
+{
+    const auto first = makeProject();
+    const auto second = makeProject();
+    Core::SyncSession a(1);
+    Core::SyncSession b(2);
+    a.attach(*first);
+    b.attach(*second);
+
+    first->removeScene("cellar");
+    second->findScene("cellar")->setWidth(320);
+    deliver(a, b);
+    deliver(b, a);
+
+    EXPECT_EQ(nullptr, first->findScene("cellar"));
+    EXPECT_EQ(nullptr, second->findScene("cellar"));
+    EXPECT_EQ(1u, a.getStats().discardedOps);
+}
+
+TEST(SyncSessionTests, TombstoneDiscardsOlderAdditionsAndEdits)
+{
+    const auto project = makeProject();
+    Core::SyncSession session(2);
+    session.attach(*project);
+
+    Core::DeltaBatch removal;
+    removal.site = 3;
+    removal.ops.push_back(makeOp(Core::DeltaOp::Type::Remove, "hall", 10));
+    session.receive(Core::DeltaStream::encode(removal));
+    session.applyRemote();
+    ASSERT_EQ(nullptr, project->findScene("hall"));
+
+    // Edits made before the removal arrive late and must not bring the scene back
+    Core::DeltaBatch stale;
+    stale.site = 4;
+    Core::DeltaOp create = makeOp(Core::DeltaOp::Type::Create, "hall", 5);
+    create.properties.emplace_back("name", std::string("Hall"));
+    stale.ops.push_back(create);
+    Core::DeltaOp set = makeOp(Core::DeltaOp::Type::Set, "hall", 7);
+    set.property = "width";
+    set.value = 200;
+    stale.ops.push_back(set);
+    session.receive(Core::DeltaStream::encode(stale));
+    session.applyRemote();
+
+    EXPECT_EQ(nullptr, project->findScene("hall"));
+    EXPECT_EQ(2u, session.getStats().discardedOps);
+
+    // An addition after the removal restores it
+    Core::DeltaBatch readd;
+    readd.site = 4;
+    Core::DeltaOp again = makeOp(Core::DeltaOp::Type::Create, "hall", 11);
+    again.properties.emplace_back("name", std::string("New hall"));
+    again.properties.emplace_back("width", 300);
+    readd.ops.push_back(again);
+    session.receive(Core::DeltaStream::encode(readd));
+    session.applyRemote();
+
+    ASSERT_NE(nullptr, project->findScene("hall"));
+    EXPECT_EQ("New hall", project->findScene("hall")->getName());
+    EXPECT_EQ(300, project->findScene("hall")->getWidth());
+    EXPECT_FALSE(session.hasOutgoing());
+}
+
+TEST(SyncSessionTests, CreationUnderAnIdInUseIsAConflict)
+{
+    const auto first = makeProject();
+    const auto second = makeProject();
+    Core::SyncSession a(1);
+    Core::SyncSession b(2);
+    a.attach(*first);
+    b.attach(*second);
+
+    // Two unrelated scenes that happen to share an id
+    first->addScene("attic", "Attic");
+    second->addScene("attic", "Loft");
+    second->findScene("attic")->setWidth(1000);
+    deliver(a, b);
+    deliver(b, a);
+
+    EXPECT_EQ("Attic", first->findScene("attic")->getName());
+    EXPECT_EQ(800, first->findScene("attic")->getWidth());
+    EXPECT_EQ("Loft", second->findScene("attic")->getName());
+    EXPECT_EQ(1u, a.getStats().conflicts);
+    EXPECT_EQ(1u, b.getStats().conflicts);
+
+    // Later edits and the removal of the other site's scene leave ours alone
+    second->findScene("attic")->setWidth(900);
+    second->removeScene("attic");
+    deliver(b, a);
+
+    ASSERT_NE(nullptr, first->findScene("attic"));
+    EXPECT_EQ(800, first->findScene("attic")->getWidth());
+    EXPECT_EQ(0u, a.getStats().addedEntities);
+}
+
+TEST(SyncSessionTests, DefaultSiteIdsAreRandom)
+{
+    Core::SyncSession a;
+    Core::SyncSession b;
+    EXPECT_NE(0u, a.getSite());
+    EXPECT_NE(a.getSite(), b.getSite());
+}
+
+TEST(SyncSessionTests, RejectsMalformedPayloadWithoutQueueing)
+{
+    const auto project = makeProject();
+    Core::SyncSession session(2);
+    session.attach(*project);
+
+    EXPECT_THROW(session.receive("\x01"), project_format_exception);
+    EXPECT_EQ(0u, session.getPendingRemoteOps());
+    EXPECT_EQ(0u, session.applyRemote());
+}
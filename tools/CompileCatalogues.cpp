@@ -0,0 +1,71 @@
+/*
+ * Adventure Designer Studio
+ * Copyright (c) 2025 Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ *
+ * This file is licensed under the GNU General Public License version 3 (GPLv3).
+ * See LICENSE.md and COPYING for full license details.
+ *
+ * This software includes an additional requirement for visible attribution:
+ * The original author's name must be displayed in any user interface or
+ * promotional material.
+ */
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "i18n/i18n.h"
+#include "languages.h"
+
+using namespace std;
+
+/**
+ * @brief Compile translation catalogues into memory-mappable .adsl files
+ *
+ * @author Cayetano H. Osma <cayetano.hernandez.osma@gmail.com>
+ * @version Oct 2026
+ *
+ * Usage: ads_compile_catalogues <translations folder> [language...]
+ *
+ * Compiles the listed languages, or every <language>.json in the folder
+ * when none is given, writing <language>.adsl next to each JSON file.
+ *
+ * @return 0 when every catalogue was compiled, 1 otherwise
+ */
+int main(const int argc, char *argv[])
+{
+    if (argc < 2) {
+        cerr << "Usage: " << argv[0] << " <translations folder> [language...]" << endl;
+        return 1;
+    }
+
+    const filesystem::path folder = filesystem::absolute(argv[1]);
+    vector<string> languages(argv + 2, argv + argc);
+    if (languages.empty()) {
+        for (const auto &entry: filesystem::directory_iterator(folder)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".json") {
+                languages.push_back(entry.path().stem().string());
+            }
+        }
+    }
+
+    int failures = 0;
+    try {
+        const ADS::i18n::i18n translations(folder.string(),
+                                           string(ADS::Constants::Languages::ENGLISH_UNITED_STATES));
+        for (const string &language: languages) {
+            try {
+                cout << translations.compileLanguage(language).string() << endl;
+            } catch (const exception &e) {
+                cerr << e.what() << endl;
+                ++failures;
+            }
+        }
+    } catch (const exception &e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+
+    return failures == 0 ? 0 : 1;
+}